@@ -509,6 +509,16 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-reset
 *
 *                   (2) 'cpu_core.c', if CPU_CFG_TRAIL_ZEROS_ASM_PRESENT  NOT #define'd in 'cpu.h'/
 *                                         'cpu_cfg.h' to enable C-source-optimized function(s)
+*
+*           (3) CPU_DCAS() prototyped only if CPU_CFG_DCAS_PRESENT #define'd in 'cpu.h'/'cpu_cfg.h' & defined
+*               in 'cpu_a.asm'. It atomically compares the two CPU address-sized words pointed to by 'p_dest'
+*               with the ones pointed to by 'p_cmp' :
+*
+*               (a) If equal, the two words pointed to by 'p_new' are stored at 'p_dest' & DEF_YES is returned.
+*               (b) Otherwise, the current words at 'p_dest' are copied to 'p_cmp' & DEF_NO  is returned.
+*
+*               The words pointed to by 'p_dest' MUST be aligned on twice the CPU address size. The operation
+*               MUST be lock-free & act as a full memory barrier.
 *********************************************************************************************************
 */
 
@@ -626,6 +636,21 @@ CPU_DATA         CPU_CntTrailZeros64      (CPU_INT64U  val);
 
 CPU_INT08U       CPU_PopCnt32             (CPU_INT32U  value);
 
+                                                                        /* --------- CPU DOUBLE-WORD CMP & SWAP -------- */
+#ifdef  CPU_CFG_DCAS_PRESENT                                            /* See Note #3.                                 */
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+CPU_BOOLEAN      CPU_DCAS                 (void       *p_dest,
+                                           void       *p_cmp,
+                                           void       *p_new);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
                                                                         /* ------------ CPU PERF MON RESET ------------ */
 #if (CPU_CFG_PERF_MON_EN == DEF_ENABLED)
 void             CPU_StatReset            (void);
@@ -985,6 +1010,13 @@ CPU_INT64U  CPU_TS64_to_uSec(CPU_TS64  ts_cnts);
 #endif
 
 
+#ifndef  CPU_CFG_DCAS_PRESENT
+#if 0                                                           /* Optionally configured in 'cpu_cfg.h'; DO NOT MODIFY. */
+#error  "CPU_CFG_DCAS_PRESENT                  not #define'd in 'cpu.h'/'cpu_cfg.h'"
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    CPU PORT CONFIGURATION ERRORS
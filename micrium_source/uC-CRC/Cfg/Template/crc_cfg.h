@@ -43,11 +43,22 @@
 *           (3) Each of these determine whether the associated table of pre-computed CRC values will
 *               be included in the build.  For more information about the tables, the meaning of the
 *               identifiers, and how these are used, please refer to the documentation.
+*
+*           (4) Configure EDC_CRC_CFG_OPTIMIZE_HW_EN to enable/disable CPU CRC instructions for the
+*               reflected 32-bit models.  Requires the port's 'edc_crc_hw.c' to be built.
+*
+*           (5) Configure EDC_CRC_CFG_TBL_SLICE_EN to enable/disable the constant slicing-by-8 tables
+*               of the enabled models.  Each table adds 4 KB (16-bit models) or 8 KB (32-bit models)
+*               of constant data & lets the CRC be calculated 8 octets per iteration.  With all nine
+*               models enabled, the tables total 48 KB (6 x 4 KB + 3 x 8 KB); thus slicing is disabled
+*               by default & SHOULD be enabled ONLY for the models actually used.
 *********************************************************************************************************
 */
 
 #define  EDC_CRC_CFG_ERR_ARG_CHK_EXT_EN          DEF_ENABLED    /* See Note #1.                                         */
 #define  EDC_CRC_CFG_OPTIMIZE_ASM_EN             DEF_DISABLED   /* See Note #2.                                         */
+#define  EDC_CRC_CFG_OPTIMIZE_HW_EN              DEF_DISABLED   /* See Note #4.                                         */
+#define  EDC_CRC_CFG_TBL_SLICE_EN                DEF_DISABLED   /* See Note #5.                                         */
 
 #define  EDC_CRC_CFG_CRC16_1021_EN               DEF_ENABLED    /* See Note #3.                                         */
 #define  EDC_CRC_CFG_CRC16_8005_EN               DEF_ENABLED
@@ -57,6 +68,7 @@
 #define  EDC_CRC_CFG_CRC16_8005_REF_EN           DEF_ENABLED
 #define  EDC_CRC_CFG_CRC16_8048_REF_EN           DEF_ENABLED
 #define  EDC_CRC_CFG_CRC32_REF_EN                DEF_ENABLED
+#define  EDC_CRC_CFG_CRC32C_REF_EN               DEF_ENABLED
 
 /*
 *********************************************************************************************************
@@ -65,10 +77,13 @@
 * Note(s) : (1) Configure ECC_HAMMING_CFG_ARG_CHK_EXT_EN to enable/disable the Hamming code external
 *               argument check feature
 *
+*           (2) Configure ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN to enable/disable SIMD-optimized Hamming code
+*               calculation.  Requires the port's 'ecc_hamming_simd.c' to be built.
 *********************************************************************************************************
 */
 
 #define  ECC_HAMMING_CFG_ARG_CHK_EXT_EN          DEF_ENABLED    /* See Note #1.                                         */
+#define  ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN        DEF_DISABLED   /* See Note #2.                                         */
 
 
 #endif
@@ -0,0 +1,198 @@
+/*
+*********************************************************************************************************
+*                                               uC/CRC
+*           ERROR DETECTING CODE (EDC) & ERROR CORRECTING CODE (ECC) CALCULATION UTILITIES
+*
+*                    Copyright 2007-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SIMD-OPTIMIZED HAMMING CODE CALCULATION
+*
+*                                     ARM-Cortex-A (ARMv7-A/ARMv8-A)
+*                                             GNU Compiler
+*
+* Filename : ecc_hamming_simd.c
+* Version  : V1.10.00
+*********************************************************************************************************
+* Note(s)  : (1) NEON kernels are written with the ACLE intrinsics ('arm_neon.h') so that the same file
+*                builds for both AArch32 (-mfpu=neon) & AArch64 targets.  NEON loads do NOT require
+*                aligned addresses on ARMv7-A/ARMv8-A normal memory.
+*
+*            (2) Each 16-octet vector holds 4 consecutive 32-bit words, in memory order.  The 2 least
+*                significant bits of the word index are the lane index; the 3 next bits are the index of
+*                the vector within its 128-octet group.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <ecc_hamming.h>
+
+
+#if (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+
+#ifndef  __ARM_NEON
+#error  "ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN  requires NEON [see 'ecc_hamming_simd.c  Note #1']"
+#endif
+
+#include  <arm_neon.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  HAMMING_SIMD_VEC_NBR_WORD                         4u   /* Nbr of 32-bit words per vector.                      */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  Hamming_VecXor(uint32x4_t  vec);
+
+
+/*
+*********************************************************************************************************
+*                                      Hamming_ParCalcGrpSIMD()
+*
+* Description : Calculate line & column parities of 128-octet groups, using NEON instructions.
+*
+* Argument(s) : p_buf       Pointer to buffer that contains the groups.
+*
+*               nbr_grp     Number of groups to process, starting with group index 0.
+*
+*               p_par       Pointer to parities to update (see 'ecc_hamming.h  HAMMING PARITY DATA TYPE').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Hamming_Calc().
+*
+* Note(s)     : (1) The word parities of the vector index bits are accumulated as vectors & reduced to
+*                   32-bit words once all groups are processed.  The word parities of the lane index bits
+*                   are extracted from the XOR of all vectors (see 'ecc_hamming_simd.c  Note #2').
+*********************************************************************************************************
+*/
+
+void  Hamming_ParCalcGrpSIMD (void         *p_buf,
+                              CPU_SIZE_T    nbr_grp,
+                              HAMMING_PAR  *p_par)
+{
+    const  CPU_INT32U  *p_buf_32;
+           uint32x4_t   vec_1;
+           uint32x4_t   vec_3;
+           uint32x4_t   vec_5;
+           uint32x4_t   vec_7;
+           uint32x4_t   pair_01;
+           uint32x4_t   pair_23;
+           uint32x4_t   pair_45;
+           uint32x4_t   pair_67;
+           uint32x4_t   vec_tot;
+           uint32x4_t   vec_word_4;
+           uint32x4_t   vec_word_8;
+           uint32x4_t   vec_word_16;
+           CPU_INT32U   lane_tot[4];
+           CPU_INT32U   par_grp;
+           CPU_SIZE_T   grp_ix;
+
+
+    p_buf_32    = (const CPU_INT32U *)p_buf;
+    vec_tot     = vdupq_n_u32(0u);
+    vec_word_4  = vdupq_n_u32(0u);
+    vec_word_8  = vdupq_n_u32(0u);
+    vec_word_16 = vdupq_n_u32(0u);
+    par_grp     = 0u;
+
+    for (grp_ix = 0u; grp_ix < nbr_grp; grp_ix++) {
+        vec_1       = vld1q_u32(&p_buf_32[1u * HAMMING_SIMD_VEC_NBR_WORD]);
+        vec_3       = vld1q_u32(&p_buf_32[3u * HAMMING_SIMD_VEC_NBR_WORD]);
+        vec_5       = vld1q_u32(&p_buf_32[5u * HAMMING_SIMD_VEC_NBR_WORD]);
+        vec_7       = vld1q_u32(&p_buf_32[7u * HAMMING_SIMD_VEC_NBR_WORD]);
+        pair_01     = veorq_u32(vld1q_u32(&p_buf_32[0u * HAMMING_SIMD_VEC_NBR_WORD]), vec_1);
+        pair_23     = veorq_u32(vld1q_u32(&p_buf_32[2u * HAMMING_SIMD_VEC_NBR_WORD]), vec_3);
+        pair_45     = veorq_u32(vld1q_u32(&p_buf_32[4u * HAMMING_SIMD_VEC_NBR_WORD]), vec_5);
+        pair_67     = veorq_u32(vld1q_u32(&p_buf_32[6u * HAMMING_SIMD_VEC_NBR_WORD]), vec_7);
+
+                                                                /* Odd vectors.                                         */
+        vec_word_4  = veorq_u32(vec_word_4, veorq_u32(veorq_u32(vec_1, vec_3),
+                                                      veorq_u32(vec_5, vec_7)));
+                                                                /* Odd groups of 2 vectors.                             */
+        vec_word_8  = veorq_u32(vec_word_8, veorq_u32(pair_23, pair_67));
+        pair_45     = veorq_u32(pair_45, pair_67);              /* Odd groups of 4 vectors.                             */
+        vec_word_16 = veorq_u32(vec_word_16, pair_45);
+
+        pair_01     = veorq_u32(pair_01, veorq_u32(pair_23, pair_45));
+        vec_tot     = veorq_u32(vec_tot, pair_01);
+                                                                /* XOR grp ix if grp par is odd.                        */
+        par_grp    ^= (CPU_INT32U)grp_ix * (CPU_INT32U)__builtin_parity(Hamming_VecXor(pair_01));
+
+        p_buf_32   += HAMMING_GRP_LEN_OCTET / sizeof(CPU_INT32U);
+    }
+
+    vst1q_u32(&lane_tot[0], vec_tot);                           /* See Note #1.                                         */
+    p_par->ParWord[0] ^= lane_tot[1] ^ lane_tot[3];
+    p_par->ParWord[1] ^= lane_tot[2] ^ lane_tot[3];
+    p_par->ParWord[2] ^= Hamming_VecXor(vec_word_4);
+    p_par->ParWord[3] ^= Hamming_VecXor(vec_word_8);
+    p_par->ParWord[4] ^= Hamming_VecXor(vec_word_16);
+    p_par->ParTot     ^= lane_tot[0] ^ lane_tot[1] ^ lane_tot[2] ^ lane_tot[3];
+    p_par->ParGrp     ^= par_grp;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          Hamming_VecXor()
+*
+* Description : XOR the 4 32-bit lanes of a vector.
+*
+* Argument(s) : vec         Vector.
+*
+* Return(s)   : XOR of the vector lanes.
+*
+* Caller(s)   : Hamming_ParCalcGrpSIMD().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  Hamming_VecXor (uint32x4_t  vec)
+{
+    uint32x2_t  vec_half;
+
+
+    vec_half = veor_u32(vget_low_u32(vec), vget_high_u32(vec));
+
+    return ((CPU_INT32U)(vget_lane_u32(vec_half, 0) ^ vget_lane_u32(vec_half, 1)));
+}
+
+#endif                                                          /* End of ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN.             */
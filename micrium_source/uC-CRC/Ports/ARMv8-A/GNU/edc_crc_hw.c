@@ -0,0 +1,176 @@
+/*
+*********************************************************************************************************
+*                                               uC/CRC
+*           ERROR DETECTING CODE (EDC) & ERROR CORRECTING CODE (ECC) CALCULATION UTILITIES
+*
+*                    Copyright 2007-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                         CYCLIC REDUNDANCY CHECK (CRC) CPU INSTRUCTION CALCULATION
+*
+*                                              ARMv8-A
+*                                            GNU Compiler
+*
+* Filename : edc_crc_hw.c
+* Version  : V1.10.00
+*********************************************************************************************************
+* Note(s)  : (1) Uses the ARMv8-A CRC32 extension through the ACLE intrinsics ('arm_acle.h'); the compiler
+*                MUST target it (e.g. -march=armv8-a+crc).  Both AArch32 & AArch64 are supported.
+*
+*            (2) The CRC32 instructions implement the reflected polynomials 0x04C11DB7 (CRC32) & 0x1EDC6F41
+*                (CRC32C) without the initial value nor the final XOR, exactly like the table functions.
+*
+*            (3) Data is read one octet at a time until aligned on 8 octets, then 8 octets at a time.  The
+*                8-octet read is little-endian, which matches the reflected bit order; big-endian CPUs are
+*                NOT supported.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <edc_crc.h>
+
+
+#if (EDC_CRC_CFG_OPTIMIZE_HW_EN == DEF_ENABLED)
+
+#ifndef  __ARM_FEATURE_CRC32
+#error  "EDC_CRC_CFG_OPTIMIZE_HW_EN  requires the ARMv8-A CRC32 extension [see 'edc_crc_hw.c  Note #1']"
+#endif
+
+#if (CPU_CFG_ENDIAN_TYPE != CPU_ENDIAN_TYPE_LITTLE)
+#error  "EDC_CRC_CFG_OPTIMIZE_HW_EN  requires a little-endian CPU [see 'edc_crc_hw.c  Note #3']"
+#endif
+
+#include  <arm_acle.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  CRC_HW_BLK_SIZE                         sizeof(CPU_INT64U)
+
+
+/*
+*********************************************************************************************************
+*                                    CRC_ChkSumCalcHW_CRC32_ref()
+*
+* Description : Calculate a reflected CRC32 (polynomial 0x04C11DB7) using the CRC32 instructions.
+*
+* Argument(s) : init_val    Initial CRC value.
+*
+*               p_data      Pointer to data buffer.
+*
+*               size        Size of buffer, in octets.
+*
+* Return(s)   : 32-bit CRC.
+*
+* Caller(s)   : CRC_ChkSumCalcTblModel_32Bit(), via the model's 'HW_Fnct'.
+*
+* Note(s)     : (1) See 'edc_crc_hw.c  Note #3'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CRC_ChkSumCalcHW_CRC32_ref (CPU_INT32U   init_val,
+                                        CPU_INT08U  *p_data,
+                                        CPU_SIZE_T   size)
+{
+    CPU_INT32U  crc;
+
+
+    crc = init_val;
+                                                                /* Process octets until aligned ...                     */
+    while ((size > 0u) &&                                       /* ... (see 'edc_crc_hw.c  Note #3').                   */
+           (((CPU_ADDR)p_data % CRC_HW_BLK_SIZE) != 0u)) {
+        crc = __crc32b(crc, *p_data);
+        p_data++;
+        size--;
+    }
+
+    while (size >= CRC_HW_BLK_SIZE) {                           /* Process aligned 8-octet words.                       */
+        crc     = __crc32d(crc, *(CPU_INT64U *)p_data);
+        p_data += CRC_HW_BLK_SIZE;
+        size   -= CRC_HW_BLK_SIZE;
+    }
+
+    while (size > 0u) {                                         /* Process remaining octets.                            */
+        crc = __crc32b(crc, *p_data);
+        p_data++;
+        size--;
+    }
+
+    return (crc);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    CRC_ChkSumCalcHW_CRC32C_ref()
+*
+* Description : Calculate a reflected CRC32C (polynomial 0x1EDC6F41) using the CRC32C instructions.
+*
+* Argument(s) : init_val    Initial CRC value.
+*
+*               p_data      Pointer to data buffer.
+*
+*               size        Size of buffer, in octets.
+*
+* Return(s)   : 32-bit CRC.
+*
+* Caller(s)   : CRC_ChkSumCalcTblModel_32Bit(), via the model's 'HW_Fnct'.
+*
+* Note(s)     : (1) See 'edc_crc_hw.c  Note #3'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CRC_ChkSumCalcHW_CRC32C_ref (CPU_INT32U   init_val,
+                                         CPU_INT08U  *p_data,
+                                         CPU_SIZE_T   size)
+{
+    CPU_INT32U  crc;
+
+
+    crc = init_val;
+                                                                /* Process octets until aligned ...                     */
+    while ((size > 0u) &&                                       /* ... (see 'edc_crc_hw.c  Note #3').                   */
+           (((CPU_ADDR)p_data % CRC_HW_BLK_SIZE) != 0u)) {
+        crc = __crc32cb(crc, *p_data);
+        p_data++;
+        size--;
+    }
+
+    while (size >= CRC_HW_BLK_SIZE) {                           /* Process aligned 8-octet words.                       */
+        crc     = __crc32cd(crc, *(CPU_INT64U *)p_data);
+        p_data += CRC_HW_BLK_SIZE;
+        size   -= CRC_HW_BLK_SIZE;
+    }
+
+    while (size > 0u) {                                         /* Process remaining octets.                            */
+        crc = __crc32cb(crc, *p_data);
+        p_data++;
+        size--;
+    }
+
+    return (crc);
+}
+
+#endif                                                          /* End of EDC_CRC_CFG_OPTIMIZE_HW_EN.                   */
@@ -0,0 +1,194 @@
+/*
+*********************************************************************************************************
+*                                               uC/CRC
+*           ERROR DETECTING CODE (EDC) & ERROR CORRECTING CODE (ECC) CALCULATION UTILITIES
+*
+*                    Copyright 2007-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                SIMD-OPTIMIZED HAMMING CODE CALCULATION
+*
+*                                          POSIX (x86/x86-64)
+*                                             GNU Compiler
+*
+* Filename : ecc_hamming_simd.c
+* Version  : V1.10.00
+*********************************************************************************************************
+* Note(s)  : (1) Uses SSE2 instructions; unaligned loads are used, so buffers do NOT need to be aligned.
+*
+*            (2) Each 16-octet vector holds 4 consecutive 32-bit words, in memory order.  The 2 least
+*                significant bits of the word index are the lane index; the 3 next bits are the index of
+*                the vector within its 128-octet group.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <ecc_hamming.h>
+
+
+#if (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+
+#ifndef  __SSE2__
+#error  "ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN  requires SSE2 [see 'ecc_hamming_simd.c  Note #1']"
+#endif
+
+#include  <emmintrin.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  HAMMING_SIMD_VEC_SIZE                            16u
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  Hamming_VecXor(__m128i  vec);
+
+
+/*
+*********************************************************************************************************
+*                                      Hamming_ParCalcGrpSIMD()
+*
+* Description : Calculate line & column parities of 128-octet groups, using SSE2 instructions.
+*
+* Argument(s) : p_buf       Pointer to buffer that contains the groups.
+*
+*               nbr_grp     Number of groups to process, starting with group index 0.
+*
+*               p_par       Pointer to parities to update (see 'ecc_hamming.h  HAMMING PARITY DATA TYPE').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Hamming_Calc().
+*
+* Note(s)     : (1) The word parities of the vector index bits are accumulated as vectors & reduced to
+*                   32-bit words once all groups are processed.  The word parities of the lane index bits
+*                   are extracted from the XOR of all vectors (see 'ecc_hamming_simd.c  Note #2').
+*********************************************************************************************************
+*/
+
+void  Hamming_ParCalcGrpSIMD (void         *p_buf,
+                              CPU_SIZE_T    nbr_grp,
+                              HAMMING_PAR  *p_par)
+{
+    const  CPU_INT08U  *p_buf_08;
+           __m128i      vec_1;
+           __m128i      vec_3;
+           __m128i      vec_5;
+           __m128i      vec_7;
+           __m128i      pair_01;
+           __m128i      pair_23;
+           __m128i      pair_45;
+           __m128i      pair_67;
+           __m128i      vec_tot;
+           __m128i      vec_word_4;
+           __m128i      vec_word_8;
+           __m128i      vec_word_16;
+           CPU_INT32U   lane_tot[4];
+           CPU_INT32U   par_grp;
+           CPU_SIZE_T   grp_ix;
+
+
+    p_buf_08    = (const CPU_INT08U *)p_buf;
+    vec_tot     = _mm_setzero_si128();
+    vec_word_4  = _mm_setzero_si128();
+    vec_word_8  = _mm_setzero_si128();
+    vec_word_16 = _mm_setzero_si128();
+    par_grp     = 0u;
+
+    for (grp_ix = 0u; grp_ix < nbr_grp; grp_ix++) {
+        vec_1       = _mm_loadu_si128((const __m128i *)&p_buf_08[1u * HAMMING_SIMD_VEC_SIZE]);
+        vec_3       = _mm_loadu_si128((const __m128i *)&p_buf_08[3u * HAMMING_SIMD_VEC_SIZE]);
+        vec_5       = _mm_loadu_si128((const __m128i *)&p_buf_08[5u * HAMMING_SIMD_VEC_SIZE]);
+        vec_7       = _mm_loadu_si128((const __m128i *)&p_buf_08[7u * HAMMING_SIMD_VEC_SIZE]);
+        pair_01     = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p_buf_08[0u * HAMMING_SIMD_VEC_SIZE]), vec_1);
+        pair_23     = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p_buf_08[2u * HAMMING_SIMD_VEC_SIZE]), vec_3);
+        pair_45     = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p_buf_08[4u * HAMMING_SIMD_VEC_SIZE]), vec_5);
+        pair_67     = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p_buf_08[6u * HAMMING_SIMD_VEC_SIZE]), vec_7);
+
+                                                                /* Odd vectors.                                         */
+        vec_word_4  = _mm_xor_si128(vec_word_4, _mm_xor_si128(_mm_xor_si128(vec_1, vec_3),
+                                                              _mm_xor_si128(vec_5, vec_7)));
+                                                                /* Odd groups of 2 vectors.                             */
+        vec_word_8  = _mm_xor_si128(vec_word_8, _mm_xor_si128(pair_23, pair_67));
+        pair_45     = _mm_xor_si128(pair_45, pair_67);          /* Odd groups of 4 vectors.                             */
+        vec_word_16 = _mm_xor_si128(vec_word_16, pair_45);
+
+        pair_01     = _mm_xor_si128(pair_01, _mm_xor_si128(pair_23, pair_45));
+        vec_tot     = _mm_xor_si128(vec_tot, pair_01);
+                                                                /* XOR grp ix if grp par is odd.                        */
+        par_grp    ^= (CPU_INT32U)grp_ix * (CPU_INT32U)__builtin_parity(Hamming_VecXor(pair_01));
+
+        p_buf_08   += HAMMING_GRP_LEN_OCTET;
+    }
+
+    _mm_storeu_si128((__m128i *)&lane_tot[0], vec_tot);         /* See Note #1.                                         */
+    p_par->ParWord[0] ^= lane_tot[1] ^ lane_tot[3];
+    p_par->ParWord[1] ^= lane_tot[2] ^ lane_tot[3];
+    p_par->ParWord[2] ^= Hamming_VecXor(vec_word_4);
+    p_par->ParWord[3] ^= Hamming_VecXor(vec_word_8);
+    p_par->ParWord[4] ^= Hamming_VecXor(vec_word_16);
+    p_par->ParTot     ^= lane_tot[0] ^ lane_tot[1] ^ lane_tot[2] ^ lane_tot[3];
+    p_par->ParGrp     ^= par_grp;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          Hamming_VecXor()
+*
+* Description : XOR the 4 32-bit lanes of a vector.
+*
+* Argument(s) : vec         Vector.
+*
+* Return(s)   : XOR of the vector lanes.
+*
+* Caller(s)   : Hamming_ParCalcGrpSIMD().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  Hamming_VecXor (__m128i  vec)
+{
+    vec = _mm_xor_si128(vec, _mm_srli_si128(vec, 8));
+    vec = _mm_xor_si128(vec, _mm_srli_si128(vec, 4));
+
+    return ((CPU_INT32U)_mm_cvtsi128_si32(vec));
+}
+
+#endif                                                          /* End of ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN.             */
@@ -0,0 +1,130 @@
+/*
+*********************************************************************************************************
+*                                               uC/CRC
+*           ERROR DETECTING CODE (EDC) & ERROR CORRECTING CODE (ECC) CALCULATION UTILITIES
+*
+*                    Copyright 2007-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                         CYCLIC REDUNDANCY CHECK (CRC) CPU INSTRUCTION CALCULATION
+*
+*                                          POSIX (x86/x86-64)
+*                                             GNU Compiler
+*
+* Filename : edc_crc_hw.c
+* Version  : V1.10.00
+*********************************************************************************************************
+* Note(s)  : (1) Uses the SSE4.2 CRC32 instruction; the compiler MUST target it (e.g. -msse4.2).
+*
+*            (2) The SSE4.2 CRC32 instruction ONLY implements the reflected CRC32C polynomial (0x1EDC6F41).
+*                CRC_ChkSumCalcHW_CRC32_ref() is NOT provided : models using polynomial 0x04C11DB7 MUST
+*                keep a NULL 'HW_Fnct' & use the slicing-by-8 or byte tables.
+*
+*            (3) Data is read one octet at a time until aligned on a CPU word, then one CPU word at a time.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <edc_crc.h>
+
+
+#if (EDC_CRC_CFG_OPTIMIZE_HW_EN == DEF_ENABLED)
+
+#ifndef  __SSE4_2__
+#error  "EDC_CRC_CFG_OPTIMIZE_HW_EN  requires SSE4.2 [see 'edc_crc_hw.c  Note #1']"
+#endif
+
+#include  <nmmintrin.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#ifdef  __x86_64__
+#define  CRC_HW_BLK_SIZE                         sizeof(CPU_INT64U)
+#else
+#define  CRC_HW_BLK_SIZE                         sizeof(CPU_INT32U)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    CRC_ChkSumCalcHW_CRC32C_ref()
+*
+* Description : Calculate a reflected CRC32C (polynomial 0x1EDC6F41) using the SSE4.2 CRC32 instruction.
+*
+* Argument(s) : init_val    Initial CRC value.
+*
+*               p_data      Pointer to data buffer.
+*
+*               size        Size of buffer, in octets.
+*
+* Return(s)   : 32-bit CRC.
+*
+* Caller(s)   : CRC_ChkSumCalcTblModel_32Bit(), via the model's 'HW_Fnct'.
+*
+* Note(s)     : (1) See 'edc_crc_hw.c  Note #3'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  CRC_ChkSumCalcHW_CRC32C_ref (CPU_INT32U   init_val,
+                                         CPU_INT08U  *p_data,
+                                         CPU_SIZE_T   size)
+{
+#ifdef  __x86_64__
+    CPU_INT64U  crc;
+#else
+    CPU_INT32U  crc;
+#endif
+
+
+    crc = init_val;
+                                                                /* Process octets until aligned ...                     */
+    while ((size > 0u) &&                                       /* ... (see 'edc_crc_hw.c  Note #3').                   */
+           (((CPU_ADDR)p_data % CRC_HW_BLK_SIZE) != 0u)) {
+        crc = _mm_crc32_u8((CPU_INT32U)crc, *p_data);
+        p_data++;
+        size--;
+    }
+
+    while (size >= CRC_HW_BLK_SIZE) {                           /* Process aligned CPU words.                           */
+#ifdef  __x86_64__
+        crc     = _mm_crc32_u64(crc, *(CPU_INT64U *)p_data);
+#else
+        crc     = _mm_crc32_u32(crc, *(CPU_INT32U *)p_data);
+#endif
+        p_data += CRC_HW_BLK_SIZE;
+        size   -= CRC_HW_BLK_SIZE;
+    }
+
+    while (size > 0u) {                                         /* Process remaining octets.                            */
+        crc = _mm_crc32_u8((CPU_INT32U)crc, *p_data);
+        p_data++;
+        size--;
+    }
+
+    return ((CPU_INT32U)crc);
+}
+
+#endif                                                          /* End of EDC_CRC_CFG_OPTIMIZE_HW_EN.                   */
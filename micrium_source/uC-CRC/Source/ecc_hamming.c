@@ -60,6 +60,9 @@
 #define  HAMMING_LEN_OCTET_BUF_MAX                      8192u   /* Max buf len must limit the size of ECC to 4 octets.  */
 #define  HAMMING_LEN_OCTET_BUF_MIN                         1u
 #define  HAMMING_LEN_OCTET_PER_LOOP_ITER                  32u
+                                                                /* Nbr of 32-octet blks per grp.                        */
+#define  HAMMING_GRP_NBR_BLK                     (HAMMING_GRP_LEN_OCTET / HAMMING_LEN_OCTET_PER_LOOP_ITER)
+#define  HAMMING_GRP_NBR_BLK_SHIFT                         2u   /* Log2 of HAMMING_GRP_NBR_BLK.                         */
 
 #define  HAMMING_DIFF_CNT_EXPECTED                ((DEF_OCTET_NBR_BITS * HAMMING_LEN_OCTET_ECC) / 2u)
 
@@ -145,6 +148,13 @@ static  void        Hamming_CalcErrLoc(CPU_INT32U    ecc_xor,
                                                                 /* Calc par on 32-bit val.                              */
 static  CPU_INT32U  Hamming_ParCalc_32(CPU_INT32U    data_32);
 
+#if (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN == DEF_DISABLED)
+                                                                /* Calc par's of 128-octet grps.                        */
+static  void        Hamming_ParCalcGrp(CPU_INT08U   *p_buf,
+                                       CPU_DATA      nbr_grp,
+                                       HAMMING_PAR  *p_par);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -345,6 +355,12 @@ static  CPU_INT32U  Hamming_ParCalc_32(CPU_INT32U    data_32);
 *                                     par_data_whole =   C2e +   C2o
 *                                     par_data_whole = L512e + L512o
 *
+*                   (d) The buffer is first processed in groups of HAMMING_GRP_LEN_OCTET octets (see
+*                       'ecc_hamming.h  DEFINES  Note #1'), so that the parity of the words of a group is
+*                       reduced to a single bit once per group instead of once per 32-octet block.  The
+*                       group parities are calculated by Hamming_ParCalcGrpSIMD() if SIMD optimization
+*                       is enabled.  Remaining 32-octet blocks are then processed one at a time.
+*
 *               (6) Pointers to variables that return values MUST be initialized PRIOR to all other
 *                   validation or function handling in case of any error(s).
 *********************************************************************************************************
@@ -392,6 +408,10 @@ void  Hamming_Calc (void        *p_buf,
     CPU_DATA     loop_ext_nbr_iter;
     CPU_DATA     loop_ext_len_rem;
     CPU_DATA     loop_main_nbr_iter;
+    CPU_DATA     nbr_grp;
+    CPU_DATA     blk_ix_start;
+    CPU_INT08U  *p_buf_rem;
+    HAMMING_PAR  par;
 #if (ECC_HAMMING_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     CPU_DATA     loop_main_mod;
     CPU_DATA     len_tot;
@@ -438,11 +458,7 @@ void  Hamming_Calc (void        *p_buf,
 
                                                                 /* ----------------- INIT VARIABLES ------------------- */
     loop_main_nbr_iter = len / HAMMING_LEN_OCTET_PER_LOOP_ITER;
-    L0004o             = 0u;
-    L0008o             = 0u;
-    L0016o             = 0u;
-    L0032o             = 0u;
-    L0064o             = 0u;
+    nbr_grp            = len / HAMMING_GRP_LEN_OCTET;
     L0128o             = 0u;
     L0256o             = 0u;
     L0512o             = 0u;
@@ -450,16 +466,41 @@ void  Hamming_Calc (void        *p_buf,
     L2048o             = 0u;
     L4096o             = 0u;
     hamming_odd        = 0u;
-    par_tot            = 0u;
-    par_big_blk        = 0u;
+
+    for (ix = 0u; ix < HAMMING_GRP_NBR_PAR_WORD; ix++) {
+        par.ParWord[ix] = 0u;
+    }
+    par.ParTot         = 0u;
+    par.ParGrp         = 0u;
 
     align_mod_32       = (CPU_ADDR)p_buf % sizeof(CPU_INT32U);
 
+
+                                                                /* --------------- CALC PARITY OF GROUPS -------------- */
+    if (nbr_grp > 0u) {                                         /* See Note #5d.                                        */
+#if (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+        Hamming_ParCalcGrpSIMD(p_buf, nbr_grp, &par);
+#else
+        Hamming_ParCalcGrp((CPU_INT08U *)p_buf, nbr_grp, &par);
+#endif
+    }
+
+    L0004o             = par.ParWord[0];
+    L0008o             = par.ParWord[1];
+    L0016o             = par.ParWord[2];
+    L0032o             = par.ParWord[3];
+    L0064o             = par.ParWord[4];
+    par_tot            = par.ParTot;
+    par_big_blk        = par.ParGrp << HAMMING_GRP_NBR_BLK_SHIFT;
+    blk_ix_start       = nbr_grp    *  HAMMING_GRP_NBR_BLK;
+    p_buf_rem          = (CPU_INT08U *)p_buf + (nbr_grp * HAMMING_GRP_LEN_OCTET);
+
+
+                                                                /* ------------ CALC PARITY OF REM'ING BLKS ----------- */
     if (align_mod_32 == 0u) {                                   /* --------- ACCESS MEM ON 4-OCTET BOUNDARIES --------- */
-        p_line_data_32  = (CPU_INT32U *)p_buf;
-                                                                /* -------------------- CALC PARITY ------------------- */
+        p_line_data_32  = (CPU_INT32U *)p_buf_rem;
                                                                 /* Calc odd par's (see Note #5c).                       */
-        for (ix = 0u; ix < loop_main_nbr_iter; ix++) {
+        for (ix = blk_ix_start; ix < loop_main_nbr_iter; ix++) {
             par_col         = *p_line_data_32;
 
             p_line_data_32++;
@@ -513,11 +554,10 @@ void  Hamming_Calc (void        *p_buf,
         }
 
     } else {                                                    /* --------- ACCESS MEM ON 1-OCTET BOUNDARIES --------- */
-        p_line_data_08  = (CPU_INT08U *)p_buf;
+        p_line_data_08  =  p_buf_rem;
 
-                                                                /* -------------------- CALC PARITY ------------------- */
                                                                 /* Calc odd par's (see Note #5c).                       */
-        for (ix = 0u; ix < loop_main_nbr_iter; ix++) {
+        for (ix = blk_ix_start; ix < loop_main_nbr_iter; ix++) {
             MEM_VAL_COPY_GET_INT32U(&line_data_32, p_line_data_08);
             par_col         = line_data_32;
 
@@ -1122,7 +1162,8 @@ static  void  Hamming_CalcErrLoc (CPU_INT32U    ecc_xor,
 *
 * Return(s)   : Parity.
 *
-* Caller(s)   : Hamming_Calc().
+* Caller(s)   : Hamming_Calc(),
+*               Hamming_ParCalcGrp().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -1145,3 +1186,120 @@ static  CPU_INT32U  Hamming_ParCalc_32 (CPU_INT32U  data_32)
     return (par);
 }
 
+
+/*
+*********************************************************************************************************
+*                                        Hamming_ParCalcGrp()
+*
+* Description : Calculate line & column parities of 128-octet groups (see 'ecc_hamming.h  DEFINES').
+*
+* Argument(s) : p_buf       Pointer to buffer that contains the groups (see Note #3).
+*
+*               nbr_grp     Number of groups to process, starting with group index 0.
+*
+*               p_par       Pointer to parities to update (see 'ecc_hamming.h  HAMMING PARITY DATA TYPE').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Hamming_Calc().
+*
+* Note(s)     : (1) Each 8-word block is reduced with pairwise XORs :
+*
+*                       par_word_1 ^= w1 ^ w3 ^ w5 ^ w7             (odd                words)
+*                       par_word_2 ^= (w2 ^ w3) ^ (w6 ^ w7)         (odd  groups of 2 words)
+*                       par_word_4 ^= (w4 ^ w5) ^ (w6 ^ w7)         (odd  groups of 4 words)
+*
+*                   & the XOR of the whole block is accumulated in the word parities of blocks 1 & 3
+*                   (odd blocks) & of blocks 2 & 3 (odd groups of 2 blocks).
+*
+*               (2) The parity of the whole group is reduced to a single bit & the group index XOR'd in
+*                   'ParGrp' if odd (see 'ecc_hamming.h  HAMMING PARITY DATA TYPE  Note #2').
+*
+*               (3) The calculation is optimized for 'CPU_INT32U'-aligned buffers.  Otherwise, the words
+*                   of each group are first copied to an aligned buffer.
+*********************************************************************************************************
+*/
+
+#if (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN == DEF_DISABLED)
+                                                                /* Calc par's of 8-word blk (see Note #1).              */
+#define  HAMMING_PAR_CALC_BLK(p_blk_32, par_blk)    do {                                                        \
+                                                        pair_01     = (p_blk_32)[0] ^ (p_blk_32)[1];            \
+                                                        pair_23     = (p_blk_32)[2] ^ (p_blk_32)[3];            \
+                                                        pair_45     = (p_blk_32)[4] ^ (p_blk_32)[5];            \
+                                                        pair_67     = (p_blk_32)[6] ^ (p_blk_32)[7];            \
+                                                        par_word_1 ^= (p_blk_32)[1] ^ (p_blk_32)[3] ^           \
+                                                                      (p_blk_32)[5] ^ (p_blk_32)[7];            \
+                                                        par_word_2 ^=  pair_23      ^  pair_67;                 \
+                                                        pair_45    ^=  pair_67;                                 \
+                                                        par_word_4 ^=  pair_45;                                 \
+                                                       (par_blk)    =  pair_01      ^  pair_23 ^ pair_45;       \
+                                                    } while (0)
+
+static  void  Hamming_ParCalcGrp (CPU_INT08U   *p_buf,
+                                  CPU_DATA      nbr_grp,
+                                  HAMMING_PAR  *p_par)
+{
+    CPU_INT32U    grp_buf[HAMMING_GRP_LEN_OCTET / sizeof(CPU_INT32U)];
+    CPU_INT32U   *p_buf_32;
+    CPU_INT32U    par_word_1;
+    CPU_INT32U    par_word_2;
+    CPU_INT32U    par_word_4;
+    CPU_INT32U    par_word_8;
+    CPU_INT32U    par_word_16;
+    CPU_INT32U    par_tot;
+    CPU_INT32U    par_grp;
+    CPU_INT32U    par_blk_0;
+    CPU_INT32U    par_blk_1;
+    CPU_INT32U    par_blk_2;
+    CPU_INT32U    par_blk_3;
+    CPU_INT32U    pair_01;
+    CPU_INT32U    pair_23;
+    CPU_INT32U    pair_45;
+    CPU_INT32U    pair_67;
+    CPU_DATA      grp_ix;
+    CPU_DATA      word_ix;
+    CPU_BOOLEAN   buf_aligned;
+
+
+    par_word_1  = p_par->ParWord[0];
+    par_word_2  = p_par->ParWord[1];
+    par_word_4  = p_par->ParWord[2];
+    par_word_8  = p_par->ParWord[3];
+    par_word_16 = p_par->ParWord[4];
+    par_tot     = p_par->ParTot;
+    par_grp     = p_par->ParGrp;
+    buf_aligned = (((CPU_ADDR)p_buf % sizeof(CPU_INT32U)) == 0u) ? DEF_YES : DEF_NO;
+
+    for (grp_ix = 0u; grp_ix < nbr_grp; grp_ix++) {
+        if (buf_aligned == DEF_YES) {
+            p_buf_32 = (CPU_INT32U *)p_buf;
+        } else {                                                /* Copy grp to aligned buf (see Note #3).               */
+            for (word_ix = 0u; word_ix < (HAMMING_GRP_LEN_OCTET / sizeof(CPU_INT32U)); word_ix++) {
+                MEM_VAL_COPY_GET_INT32U(&grp_buf[word_ix], &p_buf[word_ix * sizeof(CPU_INT32U)]);
+            }
+            p_buf_32 = &grp_buf[0];
+        }
+
+        HAMMING_PAR_CALC_BLK(&p_buf_32[ 0], par_blk_0);
+        HAMMING_PAR_CALC_BLK(&p_buf_32[ 8], par_blk_1);
+        HAMMING_PAR_CALC_BLK(&p_buf_32[16], par_blk_2);
+        HAMMING_PAR_CALC_BLK(&p_buf_32[24], par_blk_3);
+
+        par_word_8  ^= par_blk_1 ^ par_blk_3;                   /* Odd blks.                                            */
+        par_word_16 ^= par_blk_2 ^ par_blk_3;                   /* Odd grps of 2 blks.                                  */
+        par_blk_0   ^= par_blk_1 ^ par_blk_2 ^ par_blk_3;       /* Whole grp.                                           */
+        par_tot     ^= par_blk_0;
+        par_grp     ^= grp_ix * Hamming_ParCalc_32(par_blk_0);  /* See Note #2.                                         */
+
+        p_buf       += HAMMING_GRP_LEN_OCTET;
+    }
+
+    p_par->ParWord[0] = par_word_1;
+    p_par->ParWord[1] = par_word_2;
+    p_par->ParWord[2] = par_word_4;
+    p_par->ParWord[3] = par_word_8;
+    p_par->ParWord[4] = par_word_16;
+    p_par->ParTot     = par_tot;
+    p_par->ParGrp     = par_grp;
+}
+#endif
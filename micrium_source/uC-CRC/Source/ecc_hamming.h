@@ -62,12 +62,32 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        DEFAULT CONFIGURATION
+*********************************************************************************************************
+*/
+
+#ifndef  ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN
+#define  ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN       DEF_DISABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               DEFINES
+*
+* Note(s) : (1) Hamming_Calc() processes the data buffer in groups of HAMMING_GRP_LEN_OCTET octets, i.e.
+*               32 32-bit words, so that the parity of each group is reduced to a single bit only once.
+*
+*           (2) Within a group, the line parities of the 5 least significant bits of the word index are
+*               accumulated as 32-bit words (see 'HAMMING PARITY DATA TYPE').
 *********************************************************************************************************
 */
 
+#define  HAMMING_GRP_LEN_OCTET                           128u   /* See Note #1.                                         */
+#define  HAMMING_GRP_NBR_PAR_WORD                          5u   /* See Note #2.                                         */
+
 
 /*
 *********************************************************************************************************
@@ -75,6 +95,25 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                      HAMMING PARITY DATA TYPE
+*
+* Note(s) : (1) 'ParWord[k]' is the XOR of all 32-bit words whose index within their group has bit k set;
+*               its parity is the odd line parity bit L(4 * 2^k)o (see 'ecc_hamming.c  Hamming_Calc()
+*               Note #4c1').
+*
+*           (2) 'ParGrp' is the XOR of the indexes of all groups with an odd parity; its bits are the
+*               odd line parity bits L0128o to L4096o.
+*********************************************************************************************************
+*/
+
+typedef  struct  hamming_par {
+    CPU_INT32U  ParWord[HAMMING_GRP_NBR_PAR_WORD];              /* Line par words (see Note #1).                        */
+    CPU_INT32U  ParTot;                                         /* XOR of all words (col par's).                        */
+    CPU_INT32U  ParGrp;                                         /* Grp par's (see Note #2).                             */
+} HAMMING_PAR;
+
 
 /*
 *********************************************************************************************************
@@ -120,6 +159,24 @@ void        Hamming_Correct(void          *p_buf,               /* Correct error
                             CPU_INT08U    *p_ecc,
                             ECC_ERR       *p_err);
 
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*                                     defined in ecc_hamming_simd.c
+*
+* Note(s) : (1) SIMD-optimized group parity calculation is implemented in
+*               '\<CRC>\Ports\<cpu>\<compiler>\ecc_hamming_simd.c'.
+*********************************************************************************************************
+*/
+
+#if (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+void        Hamming_ParCalcGrpSIMD(void          *p_buf,        /* Calc grp par's with SIMD instructions.               */
+                                   CPU_SIZE_T     nbr_grp,
+                                   HAMMING_PAR   *p_par);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        CONFIGURATION ERRORS
@@ -139,6 +196,14 @@ void        Hamming_Correct(void          *p_buf,               /* Correct error
 #endif
 
 
+#if    ((ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN != DEF_DISABLED) && \
+        (ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN != DEF_ENABLED ))
+#error  "ECC_HAMMING_CFG_OPTIMIZE_SIMD_EN illegally #define'd in 'crc_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -69,12 +69,150 @@ const  CPU_INT16U  CRC_TblCRC16_1021[256] = {
     0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u, 0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT16U  CRC_TblSliceCRC16_1021[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u, 0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+    0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u, 0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+    0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u, 0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u, 0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+    0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u, 0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+    0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u, 0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u, 0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+    0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u, 0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+    0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu, 0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu, 0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+    0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du, 0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+    0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu, 0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu, 0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+    0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au, 0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+    0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u, 0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u, 0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u,
+    0x0000u, 0x3331u, 0x6662u, 0x5553u, 0xCCC4u, 0xFFF5u, 0xAAA6u, 0x9997u, 0x89A9u, 0xBA98u, 0xEFCBu, 0xDCFAu, 0x456Du, 0x765Cu, 0x230Fu, 0x103Eu,
+    0x0373u, 0x3042u, 0x6511u, 0x5620u, 0xCFB7u, 0xFC86u, 0xA9D5u, 0x9AE4u, 0x8ADAu, 0xB9EBu, 0xECB8u, 0xDF89u, 0x461Eu, 0x752Fu, 0x207Cu, 0x134Du,
+    0x06E6u, 0x35D7u, 0x6084u, 0x53B5u, 0xCA22u, 0xF913u, 0xAC40u, 0x9F71u, 0x8F4Fu, 0xBC7Eu, 0xE92Du, 0xDA1Cu, 0x438Bu, 0x70BAu, 0x25E9u, 0x16D8u,
+    0x0595u, 0x36A4u, 0x63F7u, 0x50C6u, 0xC951u, 0xFA60u, 0xAF33u, 0x9C02u, 0x8C3Cu, 0xBF0Du, 0xEA5Eu, 0xD96Fu, 0x40F8u, 0x73C9u, 0x269Au, 0x15ABu,
+    0x0DCCu, 0x3EFDu, 0x6BAEu, 0x589Fu, 0xC108u, 0xF239u, 0xA76Au, 0x945Bu, 0x8465u, 0xB754u, 0xE207u, 0xD136u, 0x48A1u, 0x7B90u, 0x2EC3u, 0x1DF2u,
+    0x0EBFu, 0x3D8Eu, 0x68DDu, 0x5BECu, 0xC27Bu, 0xF14Au, 0xA419u, 0x9728u, 0x8716u, 0xB427u, 0xE174u, 0xD245u, 0x4BD2u, 0x78E3u, 0x2DB0u, 0x1E81u,
+    0x0B2Au, 0x381Bu, 0x6D48u, 0x5E79u, 0xC7EEu, 0xF4DFu, 0xA18Cu, 0x92BDu, 0x8283u, 0xB1B2u, 0xE4E1u, 0xD7D0u, 0x4E47u, 0x7D76u, 0x2825u, 0x1B14u,
+    0x0859u, 0x3B68u, 0x6E3Bu, 0x5D0Au, 0xC49Du, 0xF7ACu, 0xA2FFu, 0x91CEu, 0x81F0u, 0xB2C1u, 0xE792u, 0xD4A3u, 0x4D34u, 0x7E05u, 0x2B56u, 0x1867u,
+    0x1B98u, 0x28A9u, 0x7DFAu, 0x4ECBu, 0xD75Cu, 0xE46Du, 0xB13Eu, 0x820Fu, 0x9231u, 0xA100u, 0xF453u, 0xC762u, 0x5EF5u, 0x6DC4u, 0x3897u, 0x0BA6u,
+    0x18EBu, 0x2BDAu, 0x7E89u, 0x4DB8u, 0xD42Fu, 0xE71Eu, 0xB24Du, 0x817Cu, 0x9142u, 0xA273u, 0xF720u, 0xC411u, 0x5D86u, 0x6EB7u, 0x3BE4u, 0x08D5u,
+    0x1D7Eu, 0x2E4Fu, 0x7B1Cu, 0x482Du, 0xD1BAu, 0xE28Bu, 0xB7D8u, 0x84E9u, 0x94D7u, 0xA7E6u, 0xF2B5u, 0xC184u, 0x5813u, 0x6B22u, 0x3E71u, 0x0D40u,
+    0x1E0Du, 0x2D3Cu, 0x786Fu, 0x4B5Eu, 0xD2C9u, 0xE1F8u, 0xB4ABu, 0x879Au, 0x97A4u, 0xA495u, 0xF1C6u, 0xC2F7u, 0x5B60u, 0x6851u, 0x3D02u, 0x0E33u,
+    0x1654u, 0x2565u, 0x7036u, 0x4307u, 0xDA90u, 0xE9A1u, 0xBCF2u, 0x8FC3u, 0x9FFDu, 0xACCCu, 0xF99Fu, 0xCAAEu, 0x5339u, 0x6008u, 0x355Bu, 0x066Au,
+    0x1527u, 0x2616u, 0x7345u, 0x4074u, 0xD9E3u, 0xEAD2u, 0xBF81u, 0x8CB0u, 0x9C8Eu, 0xAFBFu, 0xFAECu, 0xC9DDu, 0x504Au, 0x637Bu, 0x3628u, 0x0519u,
+    0x10B2u, 0x2383u, 0x76D0u, 0x45E1u, 0xDC76u, 0xEF47u, 0xBA14u, 0x8925u, 0x991Bu, 0xAA2Au, 0xFF79u, 0xCC48u, 0x55DFu, 0x66EEu, 0x33BDu, 0x008Cu,
+    0x13C1u, 0x20F0u, 0x75A3u, 0x4692u, 0xDF05u, 0xEC34u, 0xB967u, 0x8A56u, 0x9A68u, 0xA959u, 0xFC0Au, 0xCF3Bu, 0x56ACu, 0x659Du, 0x30CEu, 0x03FFu,
+    0x0000u, 0x3730u, 0x6E60u, 0x5950u, 0xDCC0u, 0xEBF0u, 0xB2A0u, 0x8590u, 0xA9A1u, 0x9E91u, 0xC7C1u, 0xF0F1u, 0x7561u, 0x4251u, 0x1B01u, 0x2C31u,
+    0x4363u, 0x7453u, 0x2D03u, 0x1A33u, 0x9FA3u, 0xA893u, 0xF1C3u, 0xC6F3u, 0xEAC2u, 0xDDF2u, 0x84A2u, 0xB392u, 0x3602u, 0x0132u, 0x5862u, 0x6F52u,
+    0x86C6u, 0xB1F6u, 0xE8A6u, 0xDF96u, 0x5A06u, 0x6D36u, 0x3466u, 0x0356u, 0x2F67u, 0x1857u, 0x4107u, 0x7637u, 0xF3A7u, 0xC497u, 0x9DC7u, 0xAAF7u,
+    0xC5A5u, 0xF295u, 0xABC5u, 0x9CF5u, 0x1965u, 0x2E55u, 0x7705u, 0x4035u, 0x6C04u, 0x5B34u, 0x0264u, 0x3554u, 0xB0C4u, 0x87F4u, 0xDEA4u, 0xE994u,
+    0x1DADu, 0x2A9Du, 0x73CDu, 0x44FDu, 0xC16Du, 0xF65Du, 0xAF0Du, 0x983Du, 0xB40Cu, 0x833Cu, 0xDA6Cu, 0xED5Cu, 0x68CCu, 0x5FFCu, 0x06ACu, 0x319Cu,
+    0x5ECEu, 0x69FEu, 0x30AEu, 0x079Eu, 0x820Eu, 0xB53Eu, 0xEC6Eu, 0xDB5Eu, 0xF76Fu, 0xC05Fu, 0x990Fu, 0xAE3Fu, 0x2BAFu, 0x1C9Fu, 0x45CFu, 0x72FFu,
+    0x9B6Bu, 0xAC5Bu, 0xF50Bu, 0xC23Bu, 0x47ABu, 0x709Bu, 0x29CBu, 0x1EFBu, 0x32CAu, 0x05FAu, 0x5CAAu, 0x6B9Au, 0xEE0Au, 0xD93Au, 0x806Au, 0xB75Au,
+    0xD808u, 0xEF38u, 0xB668u, 0x8158u, 0x04C8u, 0x33F8u, 0x6AA8u, 0x5D98u, 0x71A9u, 0x4699u, 0x1FC9u, 0x28F9u, 0xAD69u, 0x9A59u, 0xC309u, 0xF439u,
+    0x3B5Au, 0x0C6Au, 0x553Au, 0x620Au, 0xE79Au, 0xD0AAu, 0x89FAu, 0xBECAu, 0x92FBu, 0xA5CBu, 0xFC9Bu, 0xCBABu, 0x4E3Bu, 0x790Bu, 0x205Bu, 0x176Bu,
+    0x7839u, 0x4F09u, 0x1659u, 0x2169u, 0xA4F9u, 0x93C9u, 0xCA99u, 0xFDA9u, 0xD198u, 0xE6A8u, 0xBFF8u, 0x88C8u, 0x0D58u, 0x3A68u, 0x6338u, 0x5408u,
+    0xBD9Cu, 0x8AACu, 0xD3FCu, 0xE4CCu, 0x615Cu, 0x566Cu, 0x0F3Cu, 0x380Cu, 0x143Du, 0x230Du, 0x7A5Du, 0x4D6Du, 0xC8FDu, 0xFFCDu, 0xA69Du, 0x91ADu,
+    0xFEFFu, 0xC9CFu, 0x909Fu, 0xA7AFu, 0x223Fu, 0x150Fu, 0x4C5Fu, 0x7B6Fu, 0x575Eu, 0x606Eu, 0x393Eu, 0x0E0Eu, 0x8B9Eu, 0xBCAEu, 0xE5FEu, 0xD2CEu,
+    0x26F7u, 0x11C7u, 0x4897u, 0x7FA7u, 0xFA37u, 0xCD07u, 0x9457u, 0xA367u, 0x8F56u, 0xB866u, 0xE136u, 0xD606u, 0x5396u, 0x64A6u, 0x3DF6u, 0x0AC6u,
+    0x6594u, 0x52A4u, 0x0BF4u, 0x3CC4u, 0xB954u, 0x8E64u, 0xD734u, 0xE004u, 0xCC35u, 0xFB05u, 0xA255u, 0x9565u, 0x10F5u, 0x27C5u, 0x7E95u, 0x49A5u,
+    0xA031u, 0x9701u, 0xCE51u, 0xF961u, 0x7CF1u, 0x4BC1u, 0x1291u, 0x25A1u, 0x0990u, 0x3EA0u, 0x67F0u, 0x50C0u, 0xD550u, 0xE260u, 0xBB30u, 0x8C00u,
+    0xE352u, 0xD462u, 0x8D32u, 0xBA02u, 0x3F92u, 0x08A2u, 0x51F2u, 0x66C2u, 0x4AF3u, 0x7DC3u, 0x2493u, 0x13A3u, 0x9633u, 0xA103u, 0xF853u, 0xCF63u,
+    0x0000u, 0x76B4u, 0xED68u, 0x9BDCu, 0xCAF1u, 0xBC45u, 0x2799u, 0x512Du, 0x85C3u, 0xF377u, 0x68ABu, 0x1E1Fu, 0x4F32u, 0x3986u, 0xA25Au, 0xD4EEu,
+    0x1BA7u, 0x6D13u, 0xF6CFu, 0x807Bu, 0xD156u, 0xA7E2u, 0x3C3Eu, 0x4A8Au, 0x9E64u, 0xE8D0u, 0x730Cu, 0x05B8u, 0x5495u, 0x2221u, 0xB9FDu, 0xCF49u,
+    0x374Eu, 0x41FAu, 0xDA26u, 0xAC92u, 0xFDBFu, 0x8B0Bu, 0x10D7u, 0x6663u, 0xB28Du, 0xC439u, 0x5FE5u, 0x2951u, 0x787Cu, 0x0EC8u, 0x9514u, 0xE3A0u,
+    0x2CE9u, 0x5A5Du, 0xC181u, 0xB735u, 0xE618u, 0x90ACu, 0x0B70u, 0x7DC4u, 0xA92Au, 0xDF9Eu, 0x4442u, 0x32F6u, 0x63DBu, 0x156Fu, 0x8EB3u, 0xF807u,
+    0x6E9Cu, 0x1828u, 0x83F4u, 0xF540u, 0xA46Du, 0xD2D9u, 0x4905u, 0x3FB1u, 0xEB5Fu, 0x9DEBu, 0x0637u, 0x7083u, 0x21AEu, 0x571Au, 0xCCC6u, 0xBA72u,
+    0x753Bu, 0x038Fu, 0x9853u, 0xEEE7u, 0xBFCAu, 0xC97Eu, 0x52A2u, 0x2416u, 0xF0F8u, 0x864Cu, 0x1D90u, 0x6B24u, 0x3A09u, 0x4CBDu, 0xD761u, 0xA1D5u,
+    0x59D2u, 0x2F66u, 0xB4BAu, 0xC20Eu, 0x9323u, 0xE597u, 0x7E4Bu, 0x08FFu, 0xDC11u, 0xAAA5u, 0x3179u, 0x47CDu, 0x16E0u, 0x6054u, 0xFB88u, 0x8D3Cu,
+    0x4275u, 0x34C1u, 0xAF1Du, 0xD9A9u, 0x8884u, 0xFE30u, 0x65ECu, 0x1358u, 0xC7B6u, 0xB102u, 0x2ADEu, 0x5C6Au, 0x0D47u, 0x7BF3u, 0xE02Fu, 0x969Bu,
+    0xDD38u, 0xAB8Cu, 0x3050u, 0x46E4u, 0x17C9u, 0x617Du, 0xFAA1u, 0x8C15u, 0x58FBu, 0x2E4Fu, 0xB593u, 0xC327u, 0x920Au, 0xE4BEu, 0x7F62u, 0x09D6u,
+    0xC69Fu, 0xB02Bu, 0x2BF7u, 0x5D43u, 0x0C6Eu, 0x7ADAu, 0xE106u, 0x97B2u, 0x435Cu, 0x35E8u, 0xAE34u, 0xD880u, 0x89ADu, 0xFF19u, 0x64C5u, 0x1271u,
+    0xEA76u, 0x9CC2u, 0x071Eu, 0x71AAu, 0x2087u, 0x5633u, 0xCDEFu, 0xBB5Bu, 0x6FB5u, 0x1901u, 0x82DDu, 0xF469u, 0xA544u, 0xD3F0u, 0x482Cu, 0x3E98u,
+    0xF1D1u, 0x8765u, 0x1CB9u, 0x6A0Du, 0x3B20u, 0x4D94u, 0xD648u, 0xA0FCu, 0x7412u, 0x02A6u, 0x997Au, 0xEFCEu, 0xBEE3u, 0xC857u, 0x538Bu, 0x253Fu,
+    0xB3A4u, 0xC510u, 0x5ECCu, 0x2878u, 0x7955u, 0x0FE1u, 0x943Du, 0xE289u, 0x3667u, 0x40D3u, 0xDB0Fu, 0xADBBu, 0xFC96u, 0x8A22u, 0x11FEu, 0x674Au,
+    0xA803u, 0xDEB7u, 0x456Bu, 0x33DFu, 0x62F2u, 0x1446u, 0x8F9Au, 0xF92Eu, 0x2DC0u, 0x5B74u, 0xC0A8u, 0xB61Cu, 0xE731u, 0x9185u, 0x0A59u, 0x7CEDu,
+    0x84EAu, 0xF25Eu, 0x6982u, 0x1F36u, 0x4E1Bu, 0x38AFu, 0xA373u, 0xD5C7u, 0x0129u, 0x779Du, 0xEC41u, 0x9AF5u, 0xCBD8u, 0xBD6Cu, 0x26B0u, 0x5004u,
+    0x9F4Du, 0xE9F9u, 0x7225u, 0x0491u, 0x55BCu, 0x2308u, 0xB8D4u, 0xCE60u, 0x1A8Eu, 0x6C3Au, 0xF7E6u, 0x8152u, 0xD07Fu, 0xA6CBu, 0x3D17u, 0x4BA3u,
+    0x0000u, 0xAA51u, 0x4483u, 0xEED2u, 0x8906u, 0x2357u, 0xCD85u, 0x67D4u, 0x022Du, 0xA87Cu, 0x46AEu, 0xECFFu, 0x8B2Bu, 0x217Au, 0xCFA8u, 0x65F9u,
+    0x045Au, 0xAE0Bu, 0x40D9u, 0xEA88u, 0x8D5Cu, 0x270Du, 0xC9DFu, 0x638Eu, 0x0677u, 0xAC26u, 0x42F4u, 0xE8A5u, 0x8F71u, 0x2520u, 0xCBF2u, 0x61A3u,
+    0x08B4u, 0xA2E5u, 0x4C37u, 0xE666u, 0x81B2u, 0x2BE3u, 0xC531u, 0x6F60u, 0x0A99u, 0xA0C8u, 0x4E1Au, 0xE44Bu, 0x839Fu, 0x29CEu, 0xC71Cu, 0x6D4Du,
+    0x0CEEu, 0xA6BFu, 0x486Du, 0xE23Cu, 0x85E8u, 0x2FB9u, 0xC16Bu, 0x6B3Au, 0x0EC3u, 0xA492u, 0x4A40u, 0xE011u, 0x87C5u, 0x2D94u, 0xC346u, 0x6917u,
+    0x1168u, 0xBB39u, 0x55EBu, 0xFFBAu, 0x986Eu, 0x323Fu, 0xDCEDu, 0x76BCu, 0x1345u, 0xB914u, 0x57C6u, 0xFD97u, 0x9A43u, 0x3012u, 0xDEC0u, 0x7491u,
+    0x1532u, 0xBF63u, 0x51B1u, 0xFBE0u, 0x9C34u, 0x3665u, 0xD8B7u, 0x72E6u, 0x171Fu, 0xBD4Eu, 0x539Cu, 0xF9CDu, 0x9E19u, 0x3448u, 0xDA9Au, 0x70CBu,
+    0x19DCu, 0xB38Du, 0x5D5Fu, 0xF70Eu, 0x90DAu, 0x3A8Bu, 0xD459u, 0x7E08u, 0x1BF1u, 0xB1A0u, 0x5F72u, 0xF523u, 0x92F7u, 0x38A6u, 0xD674u, 0x7C25u,
+    0x1D86u, 0xB7D7u, 0x5905u, 0xF354u, 0x9480u, 0x3ED1u, 0xD003u, 0x7A52u, 0x1FABu, 0xB5FAu, 0x5B28u, 0xF179u, 0x96ADu, 0x3CFCu, 0xD22Eu, 0x787Fu,
+    0x22D0u, 0x8881u, 0x6653u, 0xCC02u, 0xABD6u, 0x0187u, 0xEF55u, 0x4504u, 0x20FDu, 0x8AACu, 0x647Eu, 0xCE2Fu, 0xA9FBu, 0x03AAu, 0xED78u, 0x4729u,
+    0x268Au, 0x8CDBu, 0x6209u, 0xC858u, 0xAF8Cu, 0x05DDu, 0xEB0Fu, 0x415Eu, 0x24A7u, 0x8EF6u, 0x6024u, 0xCA75u, 0xADA1u, 0x07F0u, 0xE922u, 0x4373u,
+    0x2A64u, 0x8035u, 0x6EE7u, 0xC4B6u, 0xA362u, 0x0933u, 0xE7E1u, 0x4DB0u, 0x2849u, 0x8218u, 0x6CCAu, 0xC69Bu, 0xA14Fu, 0x0B1Eu, 0xE5CCu, 0x4F9Du,
+    0x2E3Eu, 0x846Fu, 0x6ABDu, 0xC0ECu, 0xA738u, 0x0D69u, 0xE3BBu, 0x49EAu, 0x2C13u, 0x8642u, 0x6890u, 0xC2C1u, 0xA515u, 0x0F44u, 0xE196u, 0x4BC7u,
+    0x33B8u, 0x99E9u, 0x773Bu, 0xDD6Au, 0xBABEu, 0x10EFu, 0xFE3Du, 0x546Cu, 0x3195u, 0x9BC4u, 0x7516u, 0xDF47u, 0xB893u, 0x12C2u, 0xFC10u, 0x5641u,
+    0x37E2u, 0x9DB3u, 0x7361u, 0xD930u, 0xBEE4u, 0x14B5u, 0xFA67u, 0x5036u, 0x35CFu, 0x9F9Eu, 0x714Cu, 0xDB1Du, 0xBCC9u, 0x1698u, 0xF84Au, 0x521Bu,
+    0x3B0Cu, 0x915Du, 0x7F8Fu, 0xD5DEu, 0xB20Au, 0x185Bu, 0xF689u, 0x5CD8u, 0x3921u, 0x9370u, 0x7DA2u, 0xD7F3u, 0xB027u, 0x1A76u, 0xF4A4u, 0x5EF5u,
+    0x3F56u, 0x9507u, 0x7BD5u, 0xD184u, 0xB650u, 0x1C01u, 0xF2D3u, 0x5882u, 0x3D7Bu, 0x972Au, 0x79F8u, 0xD3A9u, 0xB47Du, 0x1E2Cu, 0xF0FEu, 0x5AAFu,
+    0x0000u, 0x45A0u, 0x8B40u, 0xCEE0u, 0x06A1u, 0x4301u, 0x8DE1u, 0xC841u, 0x0D42u, 0x48E2u, 0x8602u, 0xC3A2u, 0x0BE3u, 0x4E43u, 0x80A3u, 0xC503u,
+    0x1A84u, 0x5F24u, 0x91C4u, 0xD464u, 0x1C25u, 0x5985u, 0x9765u, 0xD2C5u, 0x17C6u, 0x5266u, 0x9C86u, 0xD926u, 0x1167u, 0x54C7u, 0x9A27u, 0xDF87u,
+    0x3508u, 0x70A8u, 0xBE48u, 0xFBE8u, 0x33A9u, 0x7609u, 0xB8E9u, 0xFD49u, 0x384Au, 0x7DEAu, 0xB30Au, 0xF6AAu, 0x3EEBu, 0x7B4Bu, 0xB5ABu, 0xF00Bu,
+    0x2F8Cu, 0x6A2Cu, 0xA4CCu, 0xE16Cu, 0x292Du, 0x6C8Du, 0xA26Du, 0xE7CDu, 0x22CEu, 0x676Eu, 0xA98Eu, 0xEC2Eu, 0x246Fu, 0x61CFu, 0xAF2Fu, 0xEA8Fu,
+    0x6A10u, 0x2FB0u, 0xE150u, 0xA4F0u, 0x6CB1u, 0x2911u, 0xE7F1u, 0xA251u, 0x6752u, 0x22F2u, 0xEC12u, 0xA9B2u, 0x61F3u, 0x2453u, 0xEAB3u, 0xAF13u,
+    0x7094u, 0x3534u, 0xFBD4u, 0xBE74u, 0x7635u, 0x3395u, 0xFD75u, 0xB8D5u, 0x7DD6u, 0x3876u, 0xF696u, 0xB336u, 0x7B77u, 0x3ED7u, 0xF037u, 0xB597u,
+    0x5F18u, 0x1AB8u, 0xD458u, 0x91F8u, 0x59B9u, 0x1C19u, 0xD2F9u, 0x9759u, 0x525Au, 0x17FAu, 0xD91Au, 0x9CBAu, 0x54FBu, 0x115Bu, 0xDFBBu, 0x9A1Bu,
+    0x459Cu, 0x003Cu, 0xCEDCu, 0x8B7Cu, 0x433Du, 0x069Du, 0xC87Du, 0x8DDDu, 0x48DEu, 0x0D7Eu, 0xC39Eu, 0x863Eu, 0x4E7Fu, 0x0BDFu, 0xC53Fu, 0x809Fu,
+    0xD420u, 0x9180u, 0x5F60u, 0x1AC0u, 0xD281u, 0x9721u, 0x59C1u, 0x1C61u, 0xD962u, 0x9CC2u, 0x5222u, 0x1782u, 0xDFC3u, 0x9A63u, 0x5483u, 0x1123u,
+    0xCEA4u, 0x8B04u, 0x45E4u, 0x0044u, 0xC805u, 0x8DA5u, 0x4345u, 0x06E5u, 0xC3E6u, 0x8646u, 0x48A6u, 0x0D06u, 0xC547u, 0x80E7u, 0x4E07u, 0x0BA7u,
+    0xE128u, 0xA488u, 0x6A68u, 0x2FC8u, 0xE789u, 0xA229u, 0x6CC9u, 0x2969u, 0xEC6Au, 0xA9CAu, 0x672Au, 0x228Au, 0xEACBu, 0xAF6Bu, 0x618Bu, 0x242Bu,
+    0xFBACu, 0xBE0Cu, 0x70ECu, 0x354Cu, 0xFD0Du, 0xB8ADu, 0x764Du, 0x33EDu, 0xF6EEu, 0xB34Eu, 0x7DAEu, 0x380Eu, 0xF04Fu, 0xB5EFu, 0x7B0Fu, 0x3EAFu,
+    0xBE30u, 0xFB90u, 0x3570u, 0x70D0u, 0xB891u, 0xFD31u, 0x33D1u, 0x7671u, 0xB372u, 0xF6D2u, 0x3832u, 0x7D92u, 0xB5D3u, 0xF073u, 0x3E93u, 0x7B33u,
+    0xA4B4u, 0xE114u, 0x2FF4u, 0x6A54u, 0xA215u, 0xE7B5u, 0x2955u, 0x6CF5u, 0xA9F6u, 0xEC56u, 0x22B6u, 0x6716u, 0xAF57u, 0xEAF7u, 0x2417u, 0x61B7u,
+    0x8B38u, 0xCE98u, 0x0078u, 0x45D8u, 0x8D99u, 0xC839u, 0x06D9u, 0x4379u, 0x867Au, 0xC3DAu, 0x0D3Au, 0x489Au, 0x80DBu, 0xC57Bu, 0x0B9Bu, 0x4E3Bu,
+    0x91BCu, 0xD41Cu, 0x1AFCu, 0x5F5Cu, 0x971Du, 0xD2BDu, 0x1C5Du, 0x59FDu, 0x9CFEu, 0xD95Eu, 0x17BEu, 0x521Eu, 0x9A5Fu, 0xDFFFu, 0x111Fu, 0x54BFu,
+    0x0000u, 0xB861u, 0x60E3u, 0xD882u, 0xC1C6u, 0x79A7u, 0xA125u, 0x1944u, 0x93ADu, 0x2BCCu, 0xF34Eu, 0x4B2Fu, 0x526Bu, 0xEA0Au, 0x3288u, 0x8AE9u,
+    0x377Bu, 0x8F1Au, 0x5798u, 0xEFF9u, 0xF6BDu, 0x4EDCu, 0x965Eu, 0x2E3Fu, 0xA4D6u, 0x1CB7u, 0xC435u, 0x7C54u, 0x6510u, 0xDD71u, 0x05F3u, 0xBD92u,
+    0x6EF6u, 0xD697u, 0x0E15u, 0xB674u, 0xAF30u, 0x1751u, 0xCFD3u, 0x77B2u, 0xFD5Bu, 0x453Au, 0x9DB8u, 0x25D9u, 0x3C9Du, 0x84FCu, 0x5C7Eu, 0xE41Fu,
+    0x598Du, 0xE1ECu, 0x396Eu, 0x810Fu, 0x984Bu, 0x202Au, 0xF8A8u, 0x40C9u, 0xCA20u, 0x7241u, 0xAAC3u, 0x12A2u, 0x0BE6u, 0xB387u, 0x6B05u, 0xD364u,
+    0xDDECu, 0x658Du, 0xBD0Fu, 0x056Eu, 0x1C2Au, 0xA44Bu, 0x7CC9u, 0xC4A8u, 0x4E41u, 0xF620u, 0x2EA2u, 0x96C3u, 0x8F87u, 0x37E6u, 0xEF64u, 0x5705u,
+    0xEA97u, 0x52F6u, 0x8A74u, 0x3215u, 0x2B51u, 0x9330u, 0x4BB2u, 0xF3D3u, 0x793Au, 0xC15Bu, 0x19D9u, 0xA1B8u, 0xB8FCu, 0x009Du, 0xD81Fu, 0x607Eu,
+    0xB31Au, 0x0B7Bu, 0xD3F9u, 0x6B98u, 0x72DCu, 0xCABDu, 0x123Fu, 0xAA5Eu, 0x20B7u, 0x98D6u, 0x4054u, 0xF835u, 0xE171u, 0x5910u, 0x8192u, 0x39F3u,
+    0x8461u, 0x3C00u, 0xE482u, 0x5CE3u, 0x45A7u, 0xFDC6u, 0x2544u, 0x9D25u, 0x17CCu, 0xAFADu, 0x772Fu, 0xCF4Eu, 0xD60Au, 0x6E6Bu, 0xB6E9u, 0x0E88u,
+    0xABF9u, 0x1398u, 0xCB1Au, 0x737Bu, 0x6A3Fu, 0xD25Eu, 0x0ADCu, 0xB2BDu, 0x3854u, 0x8035u, 0x58B7u, 0xE0D6u, 0xF992u, 0x41F3u, 0x9971u, 0x2110u,
+    0x9C82u, 0x24E3u, 0xFC61u, 0x4400u, 0x5D44u, 0xE525u, 0x3DA7u, 0x85C6u, 0x0F2Fu, 0xB74Eu, 0x6FCCu, 0xD7ADu, 0xCEE9u, 0x7688u, 0xAE0Au, 0x166Bu,
+    0xC50Fu, 0x7D6Eu, 0xA5ECu, 0x1D8Du, 0x04C9u, 0xBCA8u, 0x642Au, 0xDC4Bu, 0x56A2u, 0xEEC3u, 0x3641u, 0x8E20u, 0x9764u, 0x2F05u, 0xF787u, 0x4FE6u,
+    0xF274u, 0x4A15u, 0x9297u, 0x2AF6u, 0x33B2u, 0x8BD3u, 0x5351u, 0xEB30u, 0x61D9u, 0xD9B8u, 0x013Au, 0xB95Bu, 0xA01Fu, 0x187Eu, 0xC0FCu, 0x789Du,
+    0x7615u, 0xCE74u, 0x16F6u, 0xAE97u, 0xB7D3u, 0x0FB2u, 0xD730u, 0x6F51u, 0xE5B8u, 0x5DD9u, 0x855Bu, 0x3D3Au, 0x247Eu, 0x9C1Fu, 0x449Du, 0xFCFCu,
+    0x416Eu, 0xF90Fu, 0x218Du, 0x99ECu, 0x80A8u, 0x38C9u, 0xE04Bu, 0x582Au, 0xD2C3u, 0x6AA2u, 0xB220u, 0x0A41u, 0x1305u, 0xAB64u, 0x73E6u, 0xCB87u,
+    0x18E3u, 0xA082u, 0x7800u, 0xC061u, 0xD925u, 0x6144u, 0xB9C6u, 0x01A7u, 0x8B4Eu, 0x332Fu, 0xEBADu, 0x53CCu, 0x4A88u, 0xF2E9u, 0x2A6Bu, 0x920Au,
+    0x2F98u, 0x97F9u, 0x4F7Bu, 0xF71Au, 0xEE5Eu, 0x563Fu, 0x8EBDu, 0x36DCu, 0xBC35u, 0x0454u, 0xDCD6u, 0x64B7u, 0x7DF3u, 0xC592u, 0x1D10u, 0xA571u,
+    0x0000u, 0x47D3u, 0x8FA6u, 0xC875u, 0x0F6Du, 0x48BEu, 0x80CBu, 0xC718u, 0x1EDAu, 0x5909u, 0x917Cu, 0xD6AFu, 0x11B7u, 0x5664u, 0x9E11u, 0xD9C2u,
+    0x3DB4u, 0x7A67u, 0xB212u, 0xF5C1u, 0x32D9u, 0x750Au, 0xBD7Fu, 0xFAACu, 0x236Eu, 0x64BDu, 0xACC8u, 0xEB1Bu, 0x2C03u, 0x6BD0u, 0xA3A5u, 0xE476u,
+    0x7B68u, 0x3CBBu, 0xF4CEu, 0xB31Du, 0x7405u, 0x33D6u, 0xFBA3u, 0xBC70u, 0x65B2u, 0x2261u, 0xEA14u, 0xADC7u, 0x6ADFu, 0x2D0Cu, 0xE579u, 0xA2AAu,
+    0x46DCu, 0x010Fu, 0xC97Au, 0x8EA9u, 0x49B1u, 0x0E62u, 0xC617u, 0x81C4u, 0x5806u, 0x1FD5u, 0xD7A0u, 0x9073u, 0x576Bu, 0x10B8u, 0xD8CDu, 0x9F1Eu,
+    0xF6D0u, 0xB103u, 0x7976u, 0x3EA5u, 0xF9BDu, 0xBE6Eu, 0x761Bu, 0x31C8u, 0xE80Au, 0xAFD9u, 0x67ACu, 0x207Fu, 0xE767u, 0xA0B4u, 0x68C1u, 0x2F12u,
+    0xCB64u, 0x8CB7u, 0x44C2u, 0x0311u, 0xC409u, 0x83DAu, 0x4BAFu, 0x0C7Cu, 0xD5BEu, 0x926Du, 0x5A18u, 0x1DCBu, 0xDAD3u, 0x9D00u, 0x5575u, 0x12A6u,
+    0x8DB8u, 0xCA6Bu, 0x021Eu, 0x45CDu, 0x82D5u, 0xC506u, 0x0D73u, 0x4AA0u, 0x9362u, 0xD4B1u, 0x1CC4u, 0x5B17u, 0x9C0Fu, 0xDBDCu, 0x13A9u, 0x547Au,
+    0xB00Cu, 0xF7DFu, 0x3FAAu, 0x7879u, 0xBF61u, 0xF8B2u, 0x30C7u, 0x7714u, 0xAED6u, 0xE905u, 0x2170u, 0x66A3u, 0xA1BBu, 0xE668u, 0x2E1Du, 0x69CEu,
+    0xFD81u, 0xBA52u, 0x7227u, 0x35F4u, 0xF2ECu, 0xB53Fu, 0x7D4Au, 0x3A99u, 0xE35Bu, 0xA488u, 0x6CFDu, 0x2B2Eu, 0xEC36u, 0xABE5u, 0x6390u, 0x2443u,
+    0xC035u, 0x87E6u, 0x4F93u, 0x0840u, 0xCF58u, 0x888Bu, 0x40FEu, 0x072Du, 0xDEEFu, 0x993Cu, 0x5149u, 0x169Au, 0xD182u, 0x9651u, 0x5E24u, 0x19F7u,
+    0x86E9u, 0xC13Au, 0x094Fu, 0x4E9Cu, 0x8984u, 0xCE57u, 0x0622u, 0x41F1u, 0x9833u, 0xDFE0u, 0x1795u, 0x5046u, 0x975Eu, 0xD08Du, 0x18F8u, 0x5F2Bu,
+    0xBB5Du, 0xFC8Eu, 0x34FBu, 0x7328u, 0xB430u, 0xF3E3u, 0x3B96u, 0x7C45u, 0xA587u, 0xE254u, 0x2A21u, 0x6DF2u, 0xAAEAu, 0xED39u, 0x254Cu, 0x629Fu,
+    0x0B51u, 0x4C82u, 0x84F7u, 0xC324u, 0x043Cu, 0x43EFu, 0x8B9Au, 0xCC49u, 0x158Bu, 0x5258u, 0x9A2Du, 0xDDFEu, 0x1AE6u, 0x5D35u, 0x9540u, 0xD293u,
+    0x36E5u, 0x7136u, 0xB943u, 0xFE90u, 0x3988u, 0x7E5Bu, 0xB62Eu, 0xF1FDu, 0x283Fu, 0x6FECu, 0xA799u, 0xE04Au, 0x2752u, 0x6081u, 0xA8F4u, 0xEF27u,
+    0x7039u, 0x37EAu, 0xFF9Fu, 0xB84Cu, 0x7F54u, 0x3887u, 0xF0F2u, 0xB721u, 0x6EE3u, 0x2930u, 0xE145u, 0xA696u, 0x618Eu, 0x265Du, 0xEE28u, 0xA9FBu,
+    0x4D8Du, 0x0A5Eu, 0xC22Bu, 0x85F8u, 0x42E0u, 0x0533u, 0xCD46u, 0x8A95u, 0x5357u, 0x1484u, 0xDCF1u, 0x9B22u, 0x5C3Au, 0x1BE9u, 0xD39Cu, 0x944Fu
+};
+#endif
+
 const  CRC_MODEL_16  CRC_ModelCRC16_1021 = {
     0x1021u,
     0xFFFFu,
     DEF_NO,
     0x0000u,
-   &CRC_TblCRC16_1021[0]
+   &CRC_TblCRC16_1021[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+   &CRC_TblSliceCRC16_1021[0]
+#else
+    (const CPU_INT16U *)0
+#endif
 };
 #endif
 
@@ -99,12 +237,150 @@ const  CPU_INT16U  CRC_TblCRC16_1021_ref[256] = {
     0xF78Fu, 0xE606u, 0xD49Du, 0xC514u, 0xB1ABu, 0xA022u, 0x92B9u, 0x8330u, 0x7BC7u, 0x6A4Eu, 0x58D5u, 0x495Cu, 0x3DE3u, 0x2C6Au, 0x1EF1u, 0x0F78u
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT16U  CRC_TblSliceCRC16_1021_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x0000u, 0x1189u, 0x2312u, 0x329Bu, 0x4624u, 0x57ADu, 0x6536u, 0x74BFu, 0x8C48u, 0x9DC1u, 0xAF5Au, 0xBED3u, 0xCA6Cu, 0xDBE5u, 0xE97Eu, 0xF8F7u,
+    0x1081u, 0x0108u, 0x3393u, 0x221Au, 0x56A5u, 0x472Cu, 0x75B7u, 0x643Eu, 0x9CC9u, 0x8D40u, 0xBFDBu, 0xAE52u, 0xDAEDu, 0xCB64u, 0xF9FFu, 0xE876u,
+    0x2102u, 0x308Bu, 0x0210u, 0x1399u, 0x6726u, 0x76AFu, 0x4434u, 0x55BDu, 0xAD4Au, 0xBCC3u, 0x8E58u, 0x9FD1u, 0xEB6Eu, 0xFAE7u, 0xC87Cu, 0xD9F5u,
+    0x3183u, 0x200Au, 0x1291u, 0x0318u, 0x77A7u, 0x662Eu, 0x54B5u, 0x453Cu, 0xBDCBu, 0xAC42u, 0x9ED9u, 0x8F50u, 0xFBEFu, 0xEA66u, 0xD8FDu, 0xC974u,
+    0x4204u, 0x538Du, 0x6116u, 0x709Fu, 0x0420u, 0x15A9u, 0x2732u, 0x36BBu, 0xCE4Cu, 0xDFC5u, 0xED5Eu, 0xFCD7u, 0x8868u, 0x99E1u, 0xAB7Au, 0xBAF3u,
+    0x5285u, 0x430Cu, 0x7197u, 0x601Eu, 0x14A1u, 0x0528u, 0x37B3u, 0x263Au, 0xDECDu, 0xCF44u, 0xFDDFu, 0xEC56u, 0x98E9u, 0x8960u, 0xBBFBu, 0xAA72u,
+    0x6306u, 0x728Fu, 0x4014u, 0x519Du, 0x2522u, 0x34ABu, 0x0630u, 0x17B9u, 0xEF4Eu, 0xFEC7u, 0xCC5Cu, 0xDDD5u, 0xA96Au, 0xB8E3u, 0x8A78u, 0x9BF1u,
+    0x7387u, 0x620Eu, 0x5095u, 0x411Cu, 0x35A3u, 0x242Au, 0x16B1u, 0x0738u, 0xFFCFu, 0xEE46u, 0xDCDDu, 0xCD54u, 0xB9EBu, 0xA862u, 0x9AF9u, 0x8B70u,
+    0x8408u, 0x9581u, 0xA71Au, 0xB693u, 0xC22Cu, 0xD3A5u, 0xE13Eu, 0xF0B7u, 0x0840u, 0x19C9u, 0x2B52u, 0x3ADBu, 0x4E64u, 0x5FEDu, 0x6D76u, 0x7CFFu,
+    0x9489u, 0x8500u, 0xB79Bu, 0xA612u, 0xD2ADu, 0xC324u, 0xF1BFu, 0xE036u, 0x18C1u, 0x0948u, 0x3BD3u, 0x2A5Au, 0x5EE5u, 0x4F6Cu, 0x7DF7u, 0x6C7Eu,
+    0xA50Au, 0xB483u, 0x8618u, 0x9791u, 0xE32Eu, 0xF2A7u, 0xC03Cu, 0xD1B5u, 0x2942u, 0x38CBu, 0x0A50u, 0x1BD9u, 0x6F66u, 0x7EEFu, 0x4C74u, 0x5DFDu,
+    0xB58Bu, 0xA402u, 0x9699u, 0x8710u, 0xF3AFu, 0xE226u, 0xD0BDu, 0xC134u, 0x39C3u, 0x284Au, 0x1AD1u, 0x0B58u, 0x7FE7u, 0x6E6Eu, 0x5CF5u, 0x4D7Cu,
+    0xC60Cu, 0xD785u, 0xE51Eu, 0xF497u, 0x8028u, 0x91A1u, 0xA33Au, 0xB2B3u, 0x4A44u, 0x5BCDu, 0x6956u, 0x78DFu, 0x0C60u, 0x1DE9u, 0x2F72u, 0x3EFBu,
+    0xD68Du, 0xC704u, 0xF59Fu, 0xE416u, 0x90A9u, 0x8120u, 0xB3BBu, 0xA232u, 0x5AC5u, 0x4B4Cu, 0x79D7u, 0x685Eu, 0x1CE1u, 0x0D68u, 0x3FF3u, 0x2E7Au,
+    0xE70Eu, 0xF687u, 0xC41Cu, 0xD595u, 0xA12Au, 0xB0A3u, 0x8238u, 0x93B1u, 0x6B46u, 0x7ACFu, 0x4854u, 0x59DDu, 0x2D62u, 0x3CEBu, 0x0E70u, 0x1FF9u,
+    0xF78Fu, 0xE606u, 0xD49Du, 0xC514u, 0xB1ABu, 0xA022u, 0x92B9u, 0x8330u, 0x7BC7u, 0x6A4Eu, 0x58D5u, 0x495Cu, 0x3DE3u, 0x2C6Au, 0x1EF1u, 0x0F78u,
+    0x0000u, 0x19D8u, 0x33B0u, 0x2A68u, 0x6760u, 0x7EB8u, 0x54D0u, 0x4D08u, 0xCEC0u, 0xD718u, 0xFD70u, 0xE4A8u, 0xA9A0u, 0xB078u, 0x9A10u, 0x83C8u,
+    0x9591u, 0x8C49u, 0xA621u, 0xBFF9u, 0xF2F1u, 0xEB29u, 0xC141u, 0xD899u, 0x5B51u, 0x4289u, 0x68E1u, 0x7139u, 0x3C31u, 0x25E9u, 0x0F81u, 0x1659u,
+    0x2333u, 0x3AEBu, 0x1083u, 0x095Bu, 0x4453u, 0x5D8Bu, 0x77E3u, 0x6E3Bu, 0xEDF3u, 0xF42Bu, 0xDE43u, 0xC79Bu, 0x8A93u, 0x934Bu, 0xB923u, 0xA0FBu,
+    0xB6A2u, 0xAF7Au, 0x8512u, 0x9CCAu, 0xD1C2u, 0xC81Au, 0xE272u, 0xFBAAu, 0x7862u, 0x61BAu, 0x4BD2u, 0x520Au, 0x1F02u, 0x06DAu, 0x2CB2u, 0x356Au,
+    0x4666u, 0x5FBEu, 0x75D6u, 0x6C0Eu, 0x2106u, 0x38DEu, 0x12B6u, 0x0B6Eu, 0x88A6u, 0x917Eu, 0xBB16u, 0xA2CEu, 0xEFC6u, 0xF61Eu, 0xDC76u, 0xC5AEu,
+    0xD3F7u, 0xCA2Fu, 0xE047u, 0xF99Fu, 0xB497u, 0xAD4Fu, 0x8727u, 0x9EFFu, 0x1D37u, 0x04EFu, 0x2E87u, 0x375Fu, 0x7A57u, 0x638Fu, 0x49E7u, 0x503Fu,
+    0x6555u, 0x7C8Du, 0x56E5u, 0x4F3Du, 0x0235u, 0x1BEDu, 0x3185u, 0x285Du, 0xAB95u, 0xB24Du, 0x9825u, 0x81FDu, 0xCCF5u, 0xD52Du, 0xFF45u, 0xE69Du,
+    0xF0C4u, 0xE91Cu, 0xC374u, 0xDAACu, 0x97A4u, 0x8E7Cu, 0xA414u, 0xBDCCu, 0x3E04u, 0x27DCu, 0x0DB4u, 0x146Cu, 0x5964u, 0x40BCu, 0x6AD4u, 0x730Cu,
+    0x8CCCu, 0x9514u, 0xBF7Cu, 0xA6A4u, 0xEBACu, 0xF274u, 0xD81Cu, 0xC1C4u, 0x420Cu, 0x5BD4u, 0x71BCu, 0x6864u, 0x256Cu, 0x3CB4u, 0x16DCu, 0x0F04u,
+    0x195Du, 0x0085u, 0x2AEDu, 0x3335u, 0x7E3Du, 0x67E5u, 0x4D8Du, 0x5455u, 0xD79Du, 0xCE45u, 0xE42Du, 0xFDF5u, 0xB0FDu, 0xA925u, 0x834Du, 0x9A95u,
+    0xAFFFu, 0xB627u, 0x9C4Fu, 0x8597u, 0xC89Fu, 0xD147u, 0xFB2Fu, 0xE2F7u, 0x613Fu, 0x78E7u, 0x528Fu, 0x4B57u, 0x065Fu, 0x1F87u, 0x35EFu, 0x2C37u,
+    0x3A6Eu, 0x23B6u, 0x09DEu, 0x1006u, 0x5D0Eu, 0x44D6u, 0x6EBEu, 0x7766u, 0xF4AEu, 0xED76u, 0xC71Eu, 0xDEC6u, 0x93CEu, 0x8A16u, 0xA07Eu, 0xB9A6u,
+    0xCAAAu, 0xD372u, 0xF91Au, 0xE0C2u, 0xADCAu, 0xB412u, 0x9E7Au, 0x87A2u, 0x046Au, 0x1DB2u, 0x37DAu, 0x2E02u, 0x630Au, 0x7AD2u, 0x50BAu, 0x4962u,
+    0x5F3Bu, 0x46E3u, 0x6C8Bu, 0x7553u, 0x385Bu, 0x2183u, 0x0BEBu, 0x1233u, 0x91FBu, 0x8823u, 0xA24Bu, 0xBB93u, 0xF69Bu, 0xEF43u, 0xC52Bu, 0xDCF3u,
+    0xE999u, 0xF041u, 0xDA29u, 0xC3F1u, 0x8EF9u, 0x9721u, 0xBD49u, 0xA491u, 0x2759u, 0x3E81u, 0x14E9u, 0x0D31u, 0x4039u, 0x59E1u, 0x7389u, 0x6A51u,
+    0x7C08u, 0x65D0u, 0x4FB8u, 0x5660u, 0x1B68u, 0x02B0u, 0x28D8u, 0x3100u, 0xB2C8u, 0xAB10u, 0x8178u, 0x98A0u, 0xD5A8u, 0xCC70u, 0xE618u, 0xFFC0u,
+    0x0000u, 0x5ADCu, 0xB5B8u, 0xEF64u, 0x6361u, 0x39BDu, 0xD6D9u, 0x8C05u, 0xC6C2u, 0x9C1Eu, 0x737Au, 0x29A6u, 0xA5A3u, 0xFF7Fu, 0x101Bu, 0x4AC7u,
+    0x8595u, 0xDF49u, 0x302Du, 0x6AF1u, 0xE6F4u, 0xBC28u, 0x534Cu, 0x0990u, 0x4357u, 0x198Bu, 0xF6EFu, 0xAC33u, 0x2036u, 0x7AEAu, 0x958Eu, 0xCF52u,
+    0x033Bu, 0x59E7u, 0xB683u, 0xEC5Fu, 0x605Au, 0x3A86u, 0xD5E2u, 0x8F3Eu, 0xC5F9u, 0x9F25u, 0x7041u, 0x2A9Du, 0xA698u, 0xFC44u, 0x1320u, 0x49FCu,
+    0x86AEu, 0xDC72u, 0x3316u, 0x69CAu, 0xE5CFu, 0xBF13u, 0x5077u, 0x0AABu, 0x406Cu, 0x1AB0u, 0xF5D4u, 0xAF08u, 0x230Du, 0x79D1u, 0x96B5u, 0xCC69u,
+    0x0676u, 0x5CAAu, 0xB3CEu, 0xE912u, 0x6517u, 0x3FCBu, 0xD0AFu, 0x8A73u, 0xC0B4u, 0x9A68u, 0x750Cu, 0x2FD0u, 0xA3D5u, 0xF909u, 0x166Du, 0x4CB1u,
+    0x83E3u, 0xD93Fu, 0x365Bu, 0x6C87u, 0xE082u, 0xBA5Eu, 0x553Au, 0x0FE6u, 0x4521u, 0x1FFDu, 0xF099u, 0xAA45u, 0x2640u, 0x7C9Cu, 0x93F8u, 0xC924u,
+    0x054Du, 0x5F91u, 0xB0F5u, 0xEA29u, 0x662Cu, 0x3CF0u, 0xD394u, 0x8948u, 0xC38Fu, 0x9953u, 0x7637u, 0x2CEBu, 0xA0EEu, 0xFA32u, 0x1556u, 0x4F8Au,
+    0x80D8u, 0xDA04u, 0x3560u, 0x6FBCu, 0xE3B9u, 0xB965u, 0x5601u, 0x0CDDu, 0x461Au, 0x1CC6u, 0xF3A2u, 0xA97Eu, 0x257Bu, 0x7FA7u, 0x90C3u, 0xCA1Fu,
+    0x0CECu, 0x5630u, 0xB954u, 0xE388u, 0x6F8Du, 0x3551u, 0xDA35u, 0x80E9u, 0xCA2Eu, 0x90F2u, 0x7F96u, 0x254Au, 0xA94Fu, 0xF393u, 0x1CF7u, 0x462Bu,
+    0x8979u, 0xD3A5u, 0x3CC1u, 0x661Du, 0xEA18u, 0xB0C4u, 0x5FA0u, 0x057Cu, 0x4FBBu, 0x1567u, 0xFA03u, 0xA0DFu, 0x2CDAu, 0x7606u, 0x9962u, 0xC3BEu,
+    0x0FD7u, 0x550Bu, 0xBA6Fu, 0xE0B3u, 0x6CB6u, 0x366Au, 0xD90Eu, 0x83D2u, 0xC915u, 0x93C9u, 0x7CADu, 0x2671u, 0xAA74u, 0xF0A8u, 0x1FCCu, 0x4510u,
+    0x8A42u, 0xD09Eu, 0x3FFAu, 0x6526u, 0xE923u, 0xB3FFu, 0x5C9Bu, 0x0647u, 0x4C80u, 0x165Cu, 0xF938u, 0xA3E4u, 0x2FE1u, 0x753Du, 0x9A59u, 0xC085u,
+    0x0A9Au, 0x5046u, 0xBF22u, 0xE5FEu, 0x69FBu, 0x3327u, 0xDC43u, 0x869Fu, 0xCC58u, 0x9684u, 0x79E0u, 0x233Cu, 0xAF39u, 0xF5E5u, 0x1A81u, 0x405Du,
+    0x8F0Fu, 0xD5D3u, 0x3AB7u, 0x606Bu, 0xEC6Eu, 0xB6B2u, 0x59D6u, 0x030Au, 0x49CDu, 0x1311u, 0xFC75u, 0xA6A9u, 0x2AACu, 0x7070u, 0x9F14u, 0xC5C8u,
+    0x09A1u, 0x537Du, 0xBC19u, 0xE6C5u, 0x6AC0u, 0x301Cu, 0xDF78u, 0x85A4u, 0xCF63u, 0x95BFu, 0x7ADBu, 0x2007u, 0xAC02u, 0xF6DEu, 0x19BAu, 0x4366u,
+    0x8C34u, 0xD6E8u, 0x398Cu, 0x6350u, 0xEF55u, 0xB589u, 0x5AEDu, 0x0031u, 0x4AF6u, 0x102Au, 0xFF4Eu, 0xA592u, 0x2997u, 0x734Bu, 0x9C2Fu, 0xC6F3u,
+    0x0000u, 0x1CBBu, 0x3976u, 0x25CDu, 0x72ECu, 0x6E57u, 0x4B9Au, 0x5721u, 0xE5D8u, 0xF963u, 0xDCAEu, 0xC015u, 0x9734u, 0x8B8Fu, 0xAE42u, 0xB2F9u,
+    0xC3A1u, 0xDF1Au, 0xFAD7u, 0xE66Cu, 0xB14Du, 0xADF6u, 0x883Bu, 0x9480u, 0x2679u, 0x3AC2u, 0x1F0Fu, 0x03B4u, 0x5495u, 0x482Eu, 0x6DE3u, 0x7158u,
+    0x8F53u, 0x93E8u, 0xB625u, 0xAA9Eu, 0xFDBFu, 0xE104u, 0xC4C9u, 0xD872u, 0x6A8Bu, 0x7630u, 0x53FDu, 0x4F46u, 0x1867u, 0x04DCu, 0x2111u, 0x3DAAu,
+    0x4CF2u, 0x5049u, 0x7584u, 0x693Fu, 0x3E1Eu, 0x22A5u, 0x0768u, 0x1BD3u, 0xA92Au, 0xB591u, 0x905Cu, 0x8CE7u, 0xDBC6u, 0xC77Du, 0xE2B0u, 0xFE0Bu,
+    0x16B7u, 0x0A0Cu, 0x2FC1u, 0x337Au, 0x645Bu, 0x78E0u, 0x5D2Du, 0x4196u, 0xF36Fu, 0xEFD4u, 0xCA19u, 0xD6A2u, 0x8183u, 0x9D38u, 0xB8F5u, 0xA44Eu,
+    0xD516u, 0xC9ADu, 0xEC60u, 0xF0DBu, 0xA7FAu, 0xBB41u, 0x9E8Cu, 0x8237u, 0x30CEu, 0x2C75u, 0x09B8u, 0x1503u, 0x4222u, 0x5E99u, 0x7B54u, 0x67EFu,
+    0x99E4u, 0x855Fu, 0xA092u, 0xBC29u, 0xEB08u, 0xF7B3u, 0xD27Eu, 0xCEC5u, 0x7C3Cu, 0x6087u, 0x454Au, 0x59F1u, 0x0ED0u, 0x126Bu, 0x37A6u, 0x2B1Du,
+    0x5A45u, 0x46FEu, 0x6333u, 0x7F88u, 0x28A9u, 0x3412u, 0x11DFu, 0x0D64u, 0xBF9Du, 0xA326u, 0x86EBu, 0x9A50u, 0xCD71u, 0xD1CAu, 0xF407u, 0xE8BCu,
+    0x2D6Eu, 0x31D5u, 0x1418u, 0x08A3u, 0x5F82u, 0x4339u, 0x66F4u, 0x7A4Fu, 0xC8B6u, 0xD40Du, 0xF1C0u, 0xED7Bu, 0xBA5Au, 0xA6E1u, 0x832Cu, 0x9F97u,
+    0xEECFu, 0xF274u, 0xD7B9u, 0xCB02u, 0x9C23u, 0x8098u, 0xA555u, 0xB9EEu, 0x0B17u, 0x17ACu, 0x3261u, 0x2EDAu, 0x79FBu, 0x6540u, 0x408Du, 0x5C36u,
+    0xA23Du, 0xBE86u, 0x9B4Bu, 0x87F0u, 0xD0D1u, 0xCC6Au, 0xE9A7u, 0xF51Cu, 0x47E5u, 0x5B5Eu, 0x7E93u, 0x6228u, 0x3509u, 0x29B2u, 0x0C7Fu, 0x10C4u,
+    0x619Cu, 0x7D27u, 0x58EAu, 0x4451u, 0x1370u, 0x0FCBu, 0x2A06u, 0x36BDu, 0x8444u, 0x98FFu, 0xBD32u, 0xA189u, 0xF6A8u, 0xEA13u, 0xCFDEu, 0xD365u,
+    0x3BD9u, 0x2762u, 0x02AFu, 0x1E14u, 0x4935u, 0x558Eu, 0x7043u, 0x6CF8u, 0xDE01u, 0xC2BAu, 0xE777u, 0xFBCCu, 0xACEDu, 0xB056u, 0x959Bu, 0x8920u,
+    0xF878u, 0xE4C3u, 0xC10Eu, 0xDDB5u, 0x8A94u, 0x962Fu, 0xB3E2u, 0xAF59u, 0x1DA0u, 0x011Bu, 0x24D6u, 0x386Du, 0x6F4Cu, 0x73F7u, 0x563Au, 0x4A81u,
+    0xB48Au, 0xA831u, 0x8DFCu, 0x9147u, 0xC666u, 0xDADDu, 0xFF10u, 0xE3ABu, 0x5152u, 0x4DE9u, 0x6824u, 0x749Fu, 0x23BEu, 0x3F05u, 0x1AC8u, 0x0673u,
+    0x772Bu, 0x6B90u, 0x4E5Du, 0x52E6u, 0x05C7u, 0x197Cu, 0x3CB1u, 0x200Au, 0x92F3u, 0x8E48u, 0xAB85u, 0xB73Eu, 0xE01Fu, 0xFCA4u, 0xD969u, 0xC5D2u,
+    0x0000u, 0x0B44u, 0x1688u, 0x1DCCu, 0x2D10u, 0x2654u, 0x3B98u, 0x30DCu, 0x5A20u, 0x5164u, 0x4CA8u, 0x47ECu, 0x7730u, 0x7C74u, 0x61B8u, 0x6AFCu,
+    0xB440u, 0xBF04u, 0xA2C8u, 0xA98Cu, 0x9950u, 0x9214u, 0x8FD8u, 0x849Cu, 0xEE60u, 0xE524u, 0xF8E8u, 0xF3ACu, 0xC370u, 0xC834u, 0xD5F8u, 0xDEBCu,
+    0x6091u, 0x6BD5u, 0x7619u, 0x7D5Du, 0x4D81u, 0x46C5u, 0x5B09u, 0x504Du, 0x3AB1u, 0x31F5u, 0x2C39u, 0x277Du, 0x17A1u, 0x1CE5u, 0x0129u, 0x0A6Du,
+    0xD4D1u, 0xDF95u, 0xC259u, 0xC91Du, 0xF9C1u, 0xF285u, 0xEF49u, 0xE40Du, 0x8EF1u, 0x85B5u, 0x9879u, 0x933Du, 0xA3E1u, 0xA8A5u, 0xB569u, 0xBE2Du,
+    0xC122u, 0xCA66u, 0xD7AAu, 0xDCEEu, 0xEC32u, 0xE776u, 0xFABAu, 0xF1FEu, 0x9B02u, 0x9046u, 0x8D8Au, 0x86CEu, 0xB612u, 0xBD56u, 0xA09Au, 0xABDEu,
+    0x7562u, 0x7E26u, 0x63EAu, 0x68AEu, 0x5872u, 0x5336u, 0x4EFAu, 0x45BEu, 0x2F42u, 0x2406u, 0x39CAu, 0x328Eu, 0x0252u, 0x0916u, 0x14DAu, 0x1F9Eu,
+    0xA1B3u, 0xAAF7u, 0xB73Bu, 0xBC7Fu, 0x8CA3u, 0x87E7u, 0x9A2Bu, 0x916Fu, 0xFB93u, 0xF0D7u, 0xED1Bu, 0xE65Fu, 0xD683u, 0xDDC7u, 0xC00Bu, 0xCB4Fu,
+    0x15F3u, 0x1EB7u, 0x037Bu, 0x083Fu, 0x38E3u, 0x33A7u, 0x2E6Bu, 0x252Fu, 0x4FD3u, 0x4497u, 0x595Bu, 0x521Fu, 0x62C3u, 0x6987u, 0x744Bu, 0x7F0Fu,
+    0x8A55u, 0x8111u, 0x9CDDu, 0x9799u, 0xA745u, 0xAC01u, 0xB1CDu, 0xBA89u, 0xD075u, 0xDB31u, 0xC6FDu, 0xCDB9u, 0xFD65u, 0xF621u, 0xEBEDu, 0xE0A9u,
+    0x3E15u, 0x3551u, 0x289Du, 0x23D9u, 0x1305u, 0x1841u, 0x058Du, 0x0EC9u, 0x6435u, 0x6F71u, 0x72BDu, 0x79F9u, 0x4925u, 0x4261u, 0x5FADu, 0x54E9u,
+    0xEAC4u, 0xE180u, 0xFC4Cu, 0xF708u, 0xC7D4u, 0xCC90u, 0xD15Cu, 0xDA18u, 0xB0E4u, 0xBBA0u, 0xA66Cu, 0xAD28u, 0x9DF4u, 0x96B0u, 0x8B7Cu, 0x8038u,
+    0x5E84u, 0x55C0u, 0x480Cu, 0x4348u, 0x7394u, 0x78D0u, 0x651Cu, 0x6E58u, 0x04A4u, 0x0FE0u, 0x122Cu, 0x1968u, 0x29B4u, 0x22F0u, 0x3F3Cu, 0x3478u,
+    0x4B77u, 0x4033u, 0x5DFFu, 0x56BBu, 0x6667u, 0x6D23u, 0x70EFu, 0x7BABu, 0x1157u, 0x1A13u, 0x07DFu, 0x0C9Bu, 0x3C47u, 0x3703u, 0x2ACFu, 0x218Bu,
+    0xFF37u, 0xF473u, 0xE9BFu, 0xE2FBu, 0xD227u, 0xD963u, 0xC4AFu, 0xCFEBu, 0xA517u, 0xAE53u, 0xB39Fu, 0xB8DBu, 0x8807u, 0x8343u, 0x9E8Fu, 0x95CBu,
+    0x2BE6u, 0x20A2u, 0x3D6Eu, 0x362Au, 0x06F6u, 0x0DB2u, 0x107Eu, 0x1B3Au, 0x71C6u, 0x7A82u, 0x674Eu, 0x6C0Au, 0x5CD6u, 0x5792u, 0x4A5Eu, 0x411Au,
+    0x9FA6u, 0x94E2u, 0x892Eu, 0x826Au, 0xB2B6u, 0xB9F2u, 0xA43Eu, 0xAF7Au, 0xC586u, 0xCEC2u, 0xD30Eu, 0xD84Au, 0xE896u, 0xE3D2u, 0xFE1Eu, 0xF55Au,
+    0x0000u, 0x042Bu, 0x0856u, 0x0C7Du, 0x10ACu, 0x1487u, 0x18FAu, 0x1CD1u, 0x2158u, 0x2573u, 0x290Eu, 0x2D25u, 0x31F4u, 0x35DFu, 0x39A2u, 0x3D89u,
+    0x42B0u, 0x469Bu, 0x4AE6u, 0x4ECDu, 0x521Cu, 0x5637u, 0x5A4Au, 0x5E61u, 0x63E8u, 0x67C3u, 0x6BBEu, 0x6F95u, 0x7344u, 0x776Fu, 0x7B12u, 0x7F39u,
+    0x8560u, 0x814Bu, 0x8D36u, 0x891Du, 0x95CCu, 0x91E7u, 0x9D9Au, 0x99B1u, 0xA438u, 0xA013u, 0xAC6Eu, 0xA845u, 0xB494u, 0xB0BFu, 0xBCC2u, 0xB8E9u,
+    0xC7D0u, 0xC3FBu, 0xCF86u, 0xCBADu, 0xD77Cu, 0xD357u, 0xDF2Au, 0xDB01u, 0xE688u, 0xE2A3u, 0xEEDEu, 0xEAF5u, 0xF624u, 0xF20Fu, 0xFE72u, 0xFA59u,
+    0x02D1u, 0x06FAu, 0x0A87u, 0x0EACu, 0x127Du, 0x1656u, 0x1A2Bu, 0x1E00u, 0x2389u, 0x27A2u, 0x2BDFu, 0x2FF4u, 0x3325u, 0x370Eu, 0x3B73u, 0x3F58u,
+    0x4061u, 0x444Au, 0x4837u, 0x4C1Cu, 0x50CDu, 0x54E6u, 0x589Bu, 0x5CB0u, 0x6139u, 0x6512u, 0x696Fu, 0x6D44u, 0x7195u, 0x75BEu, 0x79C3u, 0x7DE8u,
+    0x87B1u, 0x839Au, 0x8FE7u, 0x8BCCu, 0x971Du, 0x9336u, 0x9F4Bu, 0x9B60u, 0xA6E9u, 0xA2C2u, 0xAEBFu, 0xAA94u, 0xB645u, 0xB26Eu, 0xBE13u, 0xBA38u,
+    0xC501u, 0xC12Au, 0xCD57u, 0xC97Cu, 0xD5ADu, 0xD186u, 0xDDFBu, 0xD9D0u, 0xE459u, 0xE072u, 0xEC0Fu, 0xE824u, 0xF4F5u, 0xF0DEu, 0xFCA3u, 0xF888u,
+    0x05A2u, 0x0189u, 0x0DF4u, 0x09DFu, 0x150Eu, 0x1125u, 0x1D58u, 0x1973u, 0x24FAu, 0x20D1u, 0x2CACu, 0x2887u, 0x3456u, 0x307Du, 0x3C00u, 0x382Bu,
+    0x4712u, 0x4339u, 0x4F44u, 0x4B6Fu, 0x57BEu, 0x5395u, 0x5FE8u, 0x5BC3u, 0x664Au, 0x6261u, 0x6E1Cu, 0x6A37u, 0x76E6u, 0x72CDu, 0x7EB0u, 0x7A9Bu,
+    0x80C2u, 0x84E9u, 0x8894u, 0x8CBFu, 0x906Eu, 0x9445u, 0x9838u, 0x9C13u, 0xA19Au, 0xA5B1u, 0xA9CCu, 0xADE7u, 0xB136u, 0xB51Du, 0xB960u, 0xBD4Bu,
+    0xC272u, 0xC659u, 0xCA24u, 0xCE0Fu, 0xD2DEu, 0xD6F5u, 0xDA88u, 0xDEA3u, 0xE32Au, 0xE701u, 0xEB7Cu, 0xEF57u, 0xF386u, 0xF7ADu, 0xFBD0u, 0xFFFBu,
+    0x0773u, 0x0358u, 0x0F25u, 0x0B0Eu, 0x17DFu, 0x13F4u, 0x1F89u, 0x1BA2u, 0x262Bu, 0x2200u, 0x2E7Du, 0x2A56u, 0x3687u, 0x32ACu, 0x3ED1u, 0x3AFAu,
+    0x45C3u, 0x41E8u, 0x4D95u, 0x49BEu, 0x556Fu, 0x5144u, 0x5D39u, 0x5912u, 0x649Bu, 0x60B0u, 0x6CCDu, 0x68E6u, 0x7437u, 0x701Cu, 0x7C61u, 0x784Au,
+    0x8213u, 0x8638u, 0x8A45u, 0x8E6Eu, 0x92BFu, 0x9694u, 0x9AE9u, 0x9EC2u, 0xA34Bu, 0xA760u, 0xAB1Du, 0xAF36u, 0xB3E7u, 0xB7CCu, 0xBBB1u, 0xBF9Au,
+    0xC0A3u, 0xC488u, 0xC8F5u, 0xCCDEu, 0xD00Fu, 0xD424u, 0xD859u, 0xDC72u, 0xE1FBu, 0xE5D0u, 0xE9ADu, 0xED86u, 0xF157u, 0xF57Cu, 0xF901u, 0xFD2Au,
+    0x0000u, 0x9FD5u, 0x37BBu, 0xA86Eu, 0x6F76u, 0xF0A3u, 0x58CDu, 0xC718u, 0xDEECu, 0x4139u, 0xE957u, 0x7682u, 0xB19Au, 0x2E4Fu, 0x8621u, 0x19F4u,
+    0xB5C9u, 0x2A1Cu, 0x8272u, 0x1DA7u, 0xDABFu, 0x456Au, 0xED04u, 0x72D1u, 0x6B25u, 0xF4F0u, 0x5C9Eu, 0xC34Bu, 0x0453u, 0x9B86u, 0x33E8u, 0xAC3Du,
+    0x6383u, 0xFC56u, 0x5438u, 0xCBEDu, 0x0CF5u, 0x9320u, 0x3B4Eu, 0xA49Bu, 0xBD6Fu, 0x22BAu, 0x8AD4u, 0x1501u, 0xD219u, 0x4DCCu, 0xE5A2u, 0x7A77u,
+    0xD64Au, 0x499Fu, 0xE1F1u, 0x7E24u, 0xB93Cu, 0x26E9u, 0x8E87u, 0x1152u, 0x08A6u, 0x9773u, 0x3F1Du, 0xA0C8u, 0x67D0u, 0xF805u, 0x506Bu, 0xCFBEu,
+    0xC706u, 0x58D3u, 0xF0BDu, 0x6F68u, 0xA870u, 0x37A5u, 0x9FCBu, 0x001Eu, 0x19EAu, 0x863Fu, 0x2E51u, 0xB184u, 0x769Cu, 0xE949u, 0x4127u, 0xDEF2u,
+    0x72CFu, 0xED1Au, 0x4574u, 0xDAA1u, 0x1DB9u, 0x826Cu, 0x2A02u, 0xB5D7u, 0xAC23u, 0x33F6u, 0x9B98u, 0x044Du, 0xC355u, 0x5C80u, 0xF4EEu, 0x6B3Bu,
+    0xA485u, 0x3B50u, 0x933Eu, 0x0CEBu, 0xCBF3u, 0x5426u, 0xFC48u, 0x639Du, 0x7A69u, 0xE5BCu, 0x4DD2u, 0xD207u, 0x151Fu, 0x8ACAu, 0x22A4u, 0xBD71u,
+    0x114Cu, 0x8E99u, 0x26F7u, 0xB922u, 0x7E3Au, 0xE1EFu, 0x4981u, 0xD654u, 0xCFA0u, 0x5075u, 0xF81Bu, 0x67CEu, 0xA0D6u, 0x3F03u, 0x976Du, 0x08B8u,
+    0x861Du, 0x19C8u, 0xB1A6u, 0x2E73u, 0xE96Bu, 0x76BEu, 0xDED0u, 0x4105u, 0x58F1u, 0xC724u, 0x6F4Au, 0xF09Fu, 0x3787u, 0xA852u, 0x003Cu, 0x9FE9u,
+    0x33D4u, 0xAC01u, 0x046Fu, 0x9BBAu, 0x5CA2u, 0xC377u, 0x6B19u, 0xF4CCu, 0xED38u, 0x72EDu, 0xDA83u, 0x4556u, 0x824Eu, 0x1D9Bu, 0xB5F5u, 0x2A20u,
+    0xE59Eu, 0x7A4Bu, 0xD225u, 0x4DF0u, 0x8AE8u, 0x153Du, 0xBD53u, 0x2286u, 0x3B72u, 0xA4A7u, 0x0CC9u, 0x931Cu, 0x5404u, 0xCBD1u, 0x63BFu, 0xFC6Au,
+    0x5057u, 0xCF82u, 0x67ECu, 0xF839u, 0x3F21u, 0xA0F4u, 0x089Au, 0x974Fu, 0x8EBBu, 0x116Eu, 0xB900u, 0x26D5u, 0xE1CDu, 0x7E18u, 0xD676u, 0x49A3u,
+    0x411Bu, 0xDECEu, 0x76A0u, 0xE975u, 0x2E6Du, 0xB1B8u, 0x19D6u, 0x8603u, 0x9FF7u, 0x0022u, 0xA84Cu, 0x3799u, 0xF081u, 0x6F54u, 0xC73Au, 0x58EFu,
+    0xF4D2u, 0x6B07u, 0xC369u, 0x5CBCu, 0x9BA4u, 0x0471u, 0xAC1Fu, 0x33CAu, 0x2A3Eu, 0xB5EBu, 0x1D85u, 0x8250u, 0x4548u, 0xDA9Du, 0x72F3u, 0xED26u,
+    0x2298u, 0xBD4Du, 0x1523u, 0x8AF6u, 0x4DEEu, 0xD23Bu, 0x7A55u, 0xE580u, 0xFC74u, 0x63A1u, 0xCBCFu, 0x541Au, 0x9302u, 0x0CD7u, 0xA4B9u, 0x3B6Cu,
+    0x9751u, 0x0884u, 0xA0EAu, 0x3F3Fu, 0xF827u, 0x67F2u, 0xCF9Cu, 0x5049u, 0x49BDu, 0xD668u, 0x7E06u, 0xE1D3u, 0x26CBu, 0xB91Eu, 0x1170u, 0x8EA5u,
+    0x0000u, 0x81BFu, 0x0B6Fu, 0x8AD0u, 0x16DEu, 0x9761u, 0x1DB1u, 0x9C0Eu, 0x2DBCu, 0xAC03u, 0x26D3u, 0xA76Cu, 0x3B62u, 0xBADDu, 0x300Du, 0xB1B2u,
+    0x5B78u, 0xDAC7u, 0x5017u, 0xD1A8u, 0x4DA6u, 0xCC19u, 0x46C9u, 0xC776u, 0x76C4u, 0xF77Bu, 0x7DABu, 0xFC14u, 0x601Au, 0xE1A5u, 0x6B75u, 0xEACAu,
+    0xB6F0u, 0x374Fu, 0xBD9Fu, 0x3C20u, 0xA02Eu, 0x2191u, 0xAB41u, 0x2AFEu, 0x9B4Cu, 0x1AF3u, 0x9023u, 0x119Cu, 0x8D92u, 0x0C2Du, 0x86FDu, 0x0742u,
+    0xED88u, 0x6C37u, 0xE6E7u, 0x6758u, 0xFB56u, 0x7AE9u, 0xF039u, 0x7186u, 0xC034u, 0x418Bu, 0xCB5Bu, 0x4AE4u, 0xD6EAu, 0x5755u, 0xDD85u, 0x5C3Au,
+    0x65F1u, 0xE44Eu, 0x6E9Eu, 0xEF21u, 0x732Fu, 0xF290u, 0x7840u, 0xF9FFu, 0x484Du, 0xC9F2u, 0x4322u, 0xC29Du, 0x5E93u, 0xDF2Cu, 0x55FCu, 0xD443u,
+    0x3E89u, 0xBF36u, 0x35E6u, 0xB459u, 0x2857u, 0xA9E8u, 0x2338u, 0xA287u, 0x1335u, 0x928Au, 0x185Au, 0x99E5u, 0x05EBu, 0x8454u, 0x0E84u, 0x8F3Bu,
+    0xD301u, 0x52BEu, 0xD86Eu, 0x59D1u, 0xC5DFu, 0x4460u, 0xCEB0u, 0x4F0Fu, 0xFEBDu, 0x7F02u, 0xF5D2u, 0x746Du, 0xE863u, 0x69DCu, 0xE30Cu, 0x62B3u,
+    0x8879u, 0x09C6u, 0x8316u, 0x02A9u, 0x9EA7u, 0x1F18u, 0x95C8u, 0x1477u, 0xA5C5u, 0x247Au, 0xAEAAu, 0x2F15u, 0xB31Bu, 0x32A4u, 0xB874u, 0x39CBu,
+    0xCBE2u, 0x4A5Du, 0xC08Du, 0x4132u, 0xDD3Cu, 0x5C83u, 0xD653u, 0x57ECu, 0xE65Eu, 0x67E1u, 0xED31u, 0x6C8Eu, 0xF080u, 0x713Fu, 0xFBEFu, 0x7A50u,
+    0x909Au, 0x1125u, 0x9BF5u, 0x1A4Au, 0x8644u, 0x07FBu, 0x8D2Bu, 0x0C94u, 0xBD26u, 0x3C99u, 0xB649u, 0x37F6u, 0xABF8u, 0x2A47u, 0xA097u, 0x2128u,
+    0x7D12u, 0xFCADu, 0x767Du, 0xF7C2u, 0x6BCCu, 0xEA73u, 0x60A3u, 0xE11Cu, 0x50AEu, 0xD111u, 0x5BC1u, 0xDA7Eu, 0x4670u, 0xC7CFu, 0x4D1Fu, 0xCCA0u,
+    0x266Au, 0xA7D5u, 0x2D05u, 0xACBAu, 0x30B4u, 0xB10Bu, 0x3BDBu, 0xBA64u, 0x0BD6u, 0x8A69u, 0x00B9u, 0x8106u, 0x1D08u, 0x9CB7u, 0x1667u, 0x97D8u,
+    0xAE13u, 0x2FACu, 0xA57Cu, 0x24C3u, 0xB8CDu, 0x3972u, 0xB3A2u, 0x321Du, 0x83AFu, 0x0210u, 0x88C0u, 0x097Fu, 0x9571u, 0x14CEu, 0x9E1Eu, 0x1FA1u,
+    0xF56Bu, 0x74D4u, 0xFE04u, 0x7FBBu, 0xE3B5u, 0x620Au, 0xE8DAu, 0x6965u, 0xD8D7u, 0x5968u, 0xD3B8u, 0x5207u, 0xCE09u, 0x4FB6u, 0xC566u, 0x44D9u,
+    0x18E3u, 0x995Cu, 0x138Cu, 0x9233u, 0x0E3Du, 0x8F82u, 0x0552u, 0x84EDu, 0x355Fu, 0xB4E0u, 0x3E30u, 0xBF8Fu, 0x2381u, 0xA23Eu, 0x28EEu, 0xA951u,
+    0x439Bu, 0xC224u, 0x48F4u, 0xC94Bu, 0x5545u, 0xD4FAu, 0x5E2Au, 0xDF95u, 0x6E27u, 0xEF98u, 0x6548u, 0xE4F7u, 0x78F9u, 0xF946u, 0x7396u, 0xF229u
+};
+#endif
+
 const  CRC_MODEL_16  CRC_ModelCRC16_1021_ref = {
      0x1021u,
      0xFFFFu,
      DEF_YES,
      0x0000u,
-    &CRC_TblCRC16_1021_ref[0]
+    &CRC_TblCRC16_1021_ref[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+    &CRC_TblSliceCRC16_1021_ref[0]
+#else
+     (const CPU_INT16U *)0
+#endif
 };
 #endif
 
@@ -129,12 +405,150 @@ const  CPU_INT16U  CRC_TblCRC16_8005[256] = {
     0x0220u, 0x8225u, 0x822Fu, 0x022Au, 0x823Bu, 0x023Eu, 0x0234u, 0x8231u, 0x8213u, 0x0216u, 0x021Cu, 0x8219u, 0x0208u, 0x820Du, 0x8207u, 0x0202u
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT16U  CRC_TblSliceCRC16_8005[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x0000u, 0x8005u, 0x800Fu, 0x000Au, 0x801Bu, 0x001Eu, 0x0014u, 0x8011u, 0x8033u, 0x0036u, 0x003Cu, 0x8039u, 0x0028u, 0x802Du, 0x8027u, 0x0022u,
+    0x8063u, 0x0066u, 0x006Cu, 0x8069u, 0x0078u, 0x807Du, 0x8077u, 0x0072u, 0x0050u, 0x8055u, 0x805Fu, 0x005Au, 0x804Bu, 0x004Eu, 0x0044u, 0x8041u,
+    0x80C3u, 0x00C6u, 0x00CCu, 0x80C9u, 0x00D8u, 0x80DDu, 0x80D7u, 0x00D2u, 0x00F0u, 0x80F5u, 0x80FFu, 0x00FAu, 0x80EBu, 0x00EEu, 0x00E4u, 0x80E1u,
+    0x00A0u, 0x80A5u, 0x80AFu, 0x00AAu, 0x80BBu, 0x00BEu, 0x00B4u, 0x80B1u, 0x8093u, 0x0096u, 0x009Cu, 0x8099u, 0x0088u, 0x808Du, 0x8087u, 0x0082u,
+    0x8183u, 0x0186u, 0x018Cu, 0x8189u, 0x0198u, 0x819Du, 0x8197u, 0x0192u, 0x01B0u, 0x81B5u, 0x81BFu, 0x01BAu, 0x81ABu, 0x01AEu, 0x01A4u, 0x81A1u,
+    0x01E0u, 0x81E5u, 0x81EFu, 0x01EAu, 0x81FBu, 0x01FEu, 0x01F4u, 0x81F1u, 0x81D3u, 0x01D6u, 0x01DCu, 0x81D9u, 0x01C8u, 0x81CDu, 0x81C7u, 0x01C2u,
+    0x0140u, 0x8145u, 0x814Fu, 0x014Au, 0x815Bu, 0x015Eu, 0x0154u, 0x8151u, 0x8173u, 0x0176u, 0x017Cu, 0x8179u, 0x0168u, 0x816Du, 0x8167u, 0x0162u,
+    0x8123u, 0x0126u, 0x012Cu, 0x8129u, 0x0138u, 0x813Du, 0x8137u, 0x0132u, 0x0110u, 0x8115u, 0x811Fu, 0x011Au, 0x810Bu, 0x010Eu, 0x0104u, 0x8101u,
+    0x8303u, 0x0306u, 0x030Cu, 0x8309u, 0x0318u, 0x831Du, 0x8317u, 0x0312u, 0x0330u, 0x8335u, 0x833Fu, 0x033Au, 0x832Bu, 0x032Eu, 0x0324u, 0x8321u,
+    0x0360u, 0x8365u, 0x836Fu, 0x036Au, 0x837Bu, 0x037Eu, 0x0374u, 0x8371u, 0x8353u, 0x0356u, 0x035Cu, 0x8359u, 0x0348u, 0x834Du, 0x8347u, 0x0342u,
+    0x03C0u, 0x83C5u, 0x83CFu, 0x03CAu, 0x83DBu, 0x03DEu, 0x03D4u, 0x83D1u, 0x83F3u, 0x03F6u, 0x03FCu, 0x83F9u, 0x03E8u, 0x83EDu, 0x83E7u, 0x03E2u,
+    0x83A3u, 0x03A6u, 0x03ACu, 0x83A9u, 0x03B8u, 0x83BDu, 0x83B7u, 0x03B2u, 0x0390u, 0x8395u, 0x839Fu, 0x039Au, 0x838Bu, 0x038Eu, 0x0384u, 0x8381u,
+    0x0280u, 0x8285u, 0x828Fu, 0x028Au, 0x829Bu, 0x029Eu, 0x0294u, 0x8291u, 0x82B3u, 0x02B6u, 0x02BCu, 0x82B9u, 0x02A8u, 0x82ADu, 0x82A7u, 0x02A2u,
+    0x82E3u, 0x02E6u, 0x02ECu, 0x82E9u, 0x02F8u, 0x82FDu, 0x82F7u, 0x02F2u, 0x02D0u, 0x82D5u, 0x82DFu, 0x02DAu, 0x82CBu, 0x02CEu, 0x02C4u, 0x82C1u,
+    0x8243u, 0x0246u, 0x024Cu, 0x8249u, 0x0258u, 0x825Du, 0x8257u, 0x0252u, 0x0270u, 0x8275u, 0x827Fu, 0x027Au, 0x826Bu, 0x026Eu, 0x0264u, 0x8261u,
+    0x0220u, 0x8225u, 0x822Fu, 0x022Au, 0x823Bu, 0x023Eu, 0x0234u, 0x8231u, 0x8213u, 0x0216u, 0x021Cu, 0x8219u, 0x0208u, 0x820Du, 0x8207u, 0x0202u,
+    0x0000u, 0x8603u, 0x8C03u, 0x0A00u, 0x9803u, 0x1E00u, 0x1400u, 0x9203u, 0xB003u, 0x3600u, 0x3C00u, 0xBA03u, 0x2800u, 0xAE03u, 0xA403u, 0x2200u,
+    0xE003u, 0x6600u, 0x6C00u, 0xEA03u, 0x7800u, 0xFE03u, 0xF403u, 0x7200u, 0x5000u, 0xD603u, 0xDC03u, 0x5A00u, 0xC803u, 0x4E00u, 0x4400u, 0xC203u,
+    0x4003u, 0xC600u, 0xCC00u, 0x4A03u, 0xD800u, 0x5E03u, 0x5403u, 0xD200u, 0xF000u, 0x7603u, 0x7C03u, 0xFA00u, 0x6803u, 0xEE00u, 0xE400u, 0x6203u,
+    0xA000u, 0x2603u, 0x2C03u, 0xAA00u, 0x3803u, 0xBE00u, 0xB400u, 0x3203u, 0x1003u, 0x9600u, 0x9C00u, 0x1A03u, 0x8800u, 0x0E03u, 0x0403u, 0x8200u,
+    0x8006u, 0x0605u, 0x0C05u, 0x8A06u, 0x1805u, 0x9E06u, 0x9406u, 0x1205u, 0x3005u, 0xB606u, 0xBC06u, 0x3A05u, 0xA806u, 0x2E05u, 0x2405u, 0xA206u,
+    0x6005u, 0xE606u, 0xEC06u, 0x6A05u, 0xF806u, 0x7E05u, 0x7405u, 0xF206u, 0xD006u, 0x5605u, 0x5C05u, 0xDA06u, 0x4805u, 0xCE06u, 0xC406u, 0x4205u,
+    0xC005u, 0x4606u, 0x4C06u, 0xCA05u, 0x5806u, 0xDE05u, 0xD405u, 0x5206u, 0x7006u, 0xF605u, 0xFC05u, 0x7A06u, 0xE805u, 0x6E06u, 0x6406u, 0xE205u,
+    0x2006u, 0xA605u, 0xAC05u, 0x2A06u, 0xB805u, 0x3E06u, 0x3406u, 0xB205u, 0x9005u, 0x1606u, 0x1C06u, 0x9A05u, 0x0806u, 0x8E05u, 0x8405u, 0x0206u,
+    0x8009u, 0x060Au, 0x0C0Au, 0x8A09u, 0x180Au, 0x9E09u, 0x9409u, 0x120Au, 0x300Au, 0xB609u, 0xBC09u, 0x3A0Au, 0xA809u, 0x2E0Au, 0x240Au, 0xA209u,
+    0x600Au, 0xE609u, 0xEC09u, 0x6A0Au, 0xF809u, 0x7E0Au, 0x740Au, 0xF209u, 0xD009u, 0x560Au, 0x5C0Au, 0xDA09u, 0x480Au, 0xCE09u, 0xC409u, 0x420Au,
+    0xC00Au, 0x4609u, 0x4C09u, 0xCA0Au, 0x5809u, 0xDE0Au, 0xD40Au, 0x5209u, 0x7009u, 0xF60Au, 0xFC0Au, 0x7A09u, 0xE80Au, 0x6E09u, 0x6409u, 0xE20Au,
+    0x2009u, 0xA60Au, 0xAC0Au, 0x2A09u, 0xB80Au, 0x3E09u, 0x3409u, 0xB20Au, 0x900Au, 0x1609u, 0x1C09u, 0x9A0Au, 0x0809u, 0x8E0Au, 0x840Au, 0x0209u,
+    0x000Fu, 0x860Cu, 0x8C0Cu, 0x0A0Fu, 0x980Cu, 0x1E0Fu, 0x140Fu, 0x920Cu, 0xB00Cu, 0x360Fu, 0x3C0Fu, 0xBA0Cu, 0x280Fu, 0xAE0Cu, 0xA40Cu, 0x220Fu,
+    0xE00Cu, 0x660Fu, 0x6C0Fu, 0xEA0Cu, 0x780Fu, 0xFE0Cu, 0xF40Cu, 0x720Fu, 0x500Fu, 0xD60Cu, 0xDC0Cu, 0x5A0Fu, 0xC80Cu, 0x4E0Fu, 0x440Fu, 0xC20Cu,
+    0x400Cu, 0xC60Fu, 0xCC0Fu, 0x4A0Cu, 0xD80Fu, 0x5E0Cu, 0x540Cu, 0xD20Fu, 0xF00Fu, 0x760Cu, 0x7C0Cu, 0xFA0Fu, 0x680Cu, 0xEE0Fu, 0xE40Fu, 0x620Cu,
+    0xA00Fu, 0x260Cu, 0x2C0Cu, 0xAA0Fu, 0x380Cu, 0xBE0Fu, 0xB40Fu, 0x320Cu, 0x100Cu, 0x960Fu, 0x9C0Fu, 0x1A0Cu, 0x880Fu, 0x0E0Cu, 0x040Cu, 0x820Fu,
+    0x0000u, 0x8017u, 0x802Bu, 0x003Cu, 0x8053u, 0x0044u, 0x0078u, 0x806Fu, 0x80A3u, 0x00B4u, 0x0088u, 0x809Fu, 0x00F0u, 0x80E7u, 0x80DBu, 0x00CCu,
+    0x8143u, 0x0154u, 0x0168u, 0x817Fu, 0x0110u, 0x8107u, 0x813Bu, 0x012Cu, 0x01E0u, 0x81F7u, 0x81CBu, 0x01DCu, 0x81B3u, 0x01A4u, 0x0198u, 0x818Fu,
+    0x8283u, 0x0294u, 0x02A8u, 0x82BFu, 0x02D0u, 0x82C7u, 0x82FBu, 0x02ECu, 0x0220u, 0x8237u, 0x820Bu, 0x021Cu, 0x8273u, 0x0264u, 0x0258u, 0x824Fu,
+    0x03C0u, 0x83D7u, 0x83EBu, 0x03FCu, 0x8393u, 0x0384u, 0x03B8u, 0x83AFu, 0x8363u, 0x0374u, 0x0348u, 0x835Fu, 0x0330u, 0x8327u, 0x831Bu, 0x030Cu,
+    0x8503u, 0x0514u, 0x0528u, 0x853Fu, 0x0550u, 0x8547u, 0x857Bu, 0x056Cu, 0x05A0u, 0x85B7u, 0x858Bu, 0x059Cu, 0x85F3u, 0x05E4u, 0x05D8u, 0x85CFu,
+    0x0440u, 0x8457u, 0x846Bu, 0x047Cu, 0x8413u, 0x0404u, 0x0438u, 0x842Fu, 0x84E3u, 0x04F4u, 0x04C8u, 0x84DFu, 0x04B0u, 0x84A7u, 0x849Bu, 0x048Cu,
+    0x0780u, 0x8797u, 0x87ABu, 0x07BCu, 0x87D3u, 0x07C4u, 0x07F8u, 0x87EFu, 0x8723u, 0x0734u, 0x0708u, 0x871Fu, 0x0770u, 0x8767u, 0x875Bu, 0x074Cu,
+    0x86C3u, 0x06D4u, 0x06E8u, 0x86FFu, 0x0690u, 0x8687u, 0x86BBu, 0x06ACu, 0x0660u, 0x8677u, 0x864Bu, 0x065Cu, 0x8633u, 0x0624u, 0x0618u, 0x860Fu,
+    0x8A03u, 0x0A14u, 0x0A28u, 0x8A3Fu, 0x0A50u, 0x8A47u, 0x8A7Bu, 0x0A6Cu, 0x0AA0u, 0x8AB7u, 0x8A8Bu, 0x0A9Cu, 0x8AF3u, 0x0AE4u, 0x0AD8u, 0x8ACFu,
+    0x0B40u, 0x8B57u, 0x8B6Bu, 0x0B7Cu, 0x8B13u, 0x0B04u, 0x0B38u, 0x8B2Fu, 0x8BE3u, 0x0BF4u, 0x0BC8u, 0x8BDFu, 0x0BB0u, 0x8BA7u, 0x8B9Bu, 0x0B8Cu,
+    0x0880u, 0x8897u, 0x88ABu, 0x08BCu, 0x88D3u, 0x08C4u, 0x08F8u, 0x88EFu, 0x8823u, 0x0834u, 0x0808u, 0x881Fu, 0x0870u, 0x8867u, 0x885Bu, 0x084Cu,
+    0x89C3u, 0x09D4u, 0x09E8u, 0x89FFu, 0x0990u, 0x8987u, 0x89BBu, 0x09ACu, 0x0960u, 0x8977u, 0x894Bu, 0x095Cu, 0x8933u, 0x0924u, 0x0918u, 0x890Fu,
+    0x0F00u, 0x8F17u, 0x8F2Bu, 0x0F3Cu, 0x8F53u, 0x0F44u, 0x0F78u, 0x8F6Fu, 0x8FA3u, 0x0FB4u, 0x0F88u, 0x8F9Fu, 0x0FF0u, 0x8FE7u, 0x8FDBu, 0x0FCCu,
+    0x8E43u, 0x0E54u, 0x0E68u, 0x8E7Fu, 0x0E10u, 0x8E07u, 0x8E3Bu, 0x0E2Cu, 0x0EE0u, 0x8EF7u, 0x8ECBu, 0x0EDCu, 0x8EB3u, 0x0EA4u, 0x0E98u, 0x8E8Fu,
+    0x8D83u, 0x0D94u, 0x0DA8u, 0x8DBFu, 0x0DD0u, 0x8DC7u, 0x8DFBu, 0x0DECu, 0x0D20u, 0x8D37u, 0x8D0Bu, 0x0D1Cu, 0x8D73u, 0x0D64u, 0x0D58u, 0x8D4Fu,
+    0x0CC0u, 0x8CD7u, 0x8CEBu, 0x0CFCu, 0x8C93u, 0x0C84u, 0x0CB8u, 0x8CAFu, 0x8C63u, 0x0C74u, 0x0C48u, 0x8C5Fu, 0x0C30u, 0x8C27u, 0x8C1Bu, 0x0C0Cu,
+    0x0000u, 0x9403u, 0xA803u, 0x3C00u, 0xD003u, 0x4400u, 0x7800u, 0xEC03u, 0x2003u, 0xB400u, 0x8800u, 0x1C03u, 0xF000u, 0x6403u, 0x5803u, 0xCC00u,
+    0x4006u, 0xD405u, 0xE805u, 0x7C06u, 0x9005u, 0x0406u, 0x3806u, 0xAC05u, 0x6005u, 0xF406u, 0xC806u, 0x5C05u, 0xB006u, 0x2405u, 0x1805u, 0x8C06u,
+    0x800Cu, 0x140Fu, 0x280Fu, 0xBC0Cu, 0x500Fu, 0xC40Cu, 0xF80Cu, 0x6C0Fu, 0xA00Fu, 0x340Cu, 0x080Cu, 0x9C0Fu, 0x700Cu, 0xE40Fu, 0xD80Fu, 0x4C0Cu,
+    0xC00Au, 0x5409u, 0x6809u, 0xFC0Au, 0x1009u, 0x840Au, 0xB80Au, 0x2C09u, 0xE009u, 0x740Au, 0x480Au, 0xDC09u, 0x300Au, 0xA409u, 0x9809u, 0x0C0Au,
+    0x801Du, 0x141Eu, 0x281Eu, 0xBC1Du, 0x501Eu, 0xC41Du, 0xF81Du, 0x6C1Eu, 0xA01Eu, 0x341Du, 0x081Du, 0x9C1Eu, 0x701Du, 0xE41Eu, 0xD81Eu, 0x4C1Du,
+    0xC01Bu, 0x5418u, 0x6818u, 0xFC1Bu, 0x1018u, 0x841Bu, 0xB81Bu, 0x2C18u, 0xE018u, 0x741Bu, 0x481Bu, 0xDC18u, 0x301Bu, 0xA418u, 0x9818u, 0x0C1Bu,
+    0x0011u, 0x9412u, 0xA812u, 0x3C11u, 0xD012u, 0x4411u, 0x7811u, 0xEC12u, 0x2012u, 0xB411u, 0x8811u, 0x1C12u, 0xF011u, 0x6412u, 0x5812u, 0xCC11u,
+    0x4017u, 0xD414u, 0xE814u, 0x7C17u, 0x9014u, 0x0417u, 0x3817u, 0xAC14u, 0x6014u, 0xF417u, 0xC817u, 0x5C14u, 0xB017u, 0x2414u, 0x1814u, 0x8C17u,
+    0x803Fu, 0x143Cu, 0x283Cu, 0xBC3Fu, 0x503Cu, 0xC43Fu, 0xF83Fu, 0x6C3Cu, 0xA03Cu, 0x343Fu, 0x083Fu, 0x9C3Cu, 0x703Fu, 0xE43Cu, 0xD83Cu, 0x4C3Fu,
+    0xC039u, 0x543Au, 0x683Au, 0xFC39u, 0x103Au, 0x8439u, 0xB839u, 0x2C3Au, 0xE03Au, 0x7439u, 0x4839u, 0xDC3Au, 0x3039u, 0xA43Au, 0x983Au, 0x0C39u,
+    0x0033u, 0x9430u, 0xA830u, 0x3C33u, 0xD030u, 0x4433u, 0x7833u, 0xEC30u, 0x2030u, 0xB433u, 0x8833u, 0x1C30u, 0xF033u, 0x6430u, 0x5830u, 0xCC33u,
+    0x4035u, 0xD436u, 0xE836u, 0x7C35u, 0x9036u, 0x0435u, 0x3835u, 0xAC36u, 0x6036u, 0xF435u, 0xC835u, 0x5C36u, 0xB035u, 0x2436u, 0x1836u, 0x8C35u,
+    0x0022u, 0x9421u, 0xA821u, 0x3C22u, 0xD021u, 0x4422u, 0x7822u, 0xEC21u, 0x2021u, 0xB422u, 0x8822u, 0x1C21u, 0xF022u, 0x6421u, 0x5821u, 0xCC22u,
+    0x4024u, 0xD427u, 0xE827u, 0x7C24u, 0x9027u, 0x0424u, 0x3824u, 0xAC27u, 0x6027u, 0xF424u, 0xC824u, 0x5C27u, 0xB024u, 0x2427u, 0x1827u, 0x8C24u,
+    0x802Eu, 0x142Du, 0x282Du, 0xBC2Eu, 0x502Du, 0xC42Eu, 0xF82Eu, 0x6C2Du, 0xA02Du, 0x342Eu, 0x082Eu, 0x9C2Du, 0x702Eu, 0xE42Du, 0xD82Du, 0x4C2Eu,
+    0xC028u, 0x542Bu, 0x682Bu, 0xFC28u, 0x102Bu, 0x8428u, 0xB828u, 0x2C2Bu, 0xE02Bu, 0x7428u, 0x4828u, 0xDC2Bu, 0x3028u, 0xA42Bu, 0x982Bu, 0x0C28u,
+    0x0000u, 0x807Bu, 0x80F3u, 0x0088u, 0x81E3u, 0x0198u, 0x0110u, 0x816Bu, 0x83C3u, 0x03B8u, 0x0330u, 0x834Bu, 0x0220u, 0x825Bu, 0x82D3u, 0x02A8u,
+    0x8783u, 0x07F8u, 0x0770u, 0x870Bu, 0x0660u, 0x861Bu, 0x8693u, 0x06E8u, 0x0440u, 0x843Bu, 0x84B3u, 0x04C8u, 0x85A3u, 0x05D8u, 0x0550u, 0x852Bu,
+    0x8F03u, 0x0F78u, 0x0FF0u, 0x8F8Bu, 0x0EE0u, 0x8E9Bu, 0x8E13u, 0x0E68u, 0x0CC0u, 0x8CBBu, 0x8C33u, 0x0C48u, 0x8D23u, 0x0D58u, 0x0DD0u, 0x8DABu,
+    0x0880u, 0x88FBu, 0x8873u, 0x0808u, 0x8963u, 0x0918u, 0x0990u, 0x89EBu, 0x8B43u, 0x0B38u, 0x0BB0u, 0x8BCBu, 0x0AA0u, 0x8ADBu, 0x8A53u, 0x0A28u,
+    0x9E03u, 0x1E78u, 0x1EF0u, 0x9E8Bu, 0x1FE0u, 0x9F9Bu, 0x9F13u, 0x1F68u, 0x1DC0u, 0x9DBBu, 0x9D33u, 0x1D48u, 0x9C23u, 0x1C58u, 0x1CD0u, 0x9CABu,
+    0x1980u, 0x99FBu, 0x9973u, 0x1908u, 0x9863u, 0x1818u, 0x1890u, 0x98EBu, 0x9A43u, 0x1A38u, 0x1AB0u, 0x9ACBu, 0x1BA0u, 0x9BDBu, 0x9B53u, 0x1B28u,
+    0x1100u, 0x917Bu, 0x91F3u, 0x1188u, 0x90E3u, 0x1098u, 0x1010u, 0x906Bu, 0x92C3u, 0x12B8u, 0x1230u, 0x924Bu, 0x1320u, 0x935Bu, 0x93D3u, 0x13A8u,
+    0x9683u, 0x16F8u, 0x1670u, 0x960Bu, 0x1760u, 0x971Bu, 0x9793u, 0x17E8u, 0x1540u, 0x953Bu, 0x95B3u, 0x15C8u, 0x94A3u, 0x14D8u, 0x1450u, 0x942Bu,
+    0xBC03u, 0x3C78u, 0x3CF0u, 0xBC8Bu, 0x3DE0u, 0xBD9Bu, 0xBD13u, 0x3D68u, 0x3FC0u, 0xBFBBu, 0xBF33u, 0x3F48u, 0xBE23u, 0x3E58u, 0x3ED0u, 0xBEABu,
+    0x3B80u, 0xBBFBu, 0xBB73u, 0x3B08u, 0xBA63u, 0x3A18u, 0x3A90u, 0xBAEBu, 0xB843u, 0x3838u, 0x38B0u, 0xB8CBu, 0x39A0u, 0xB9DBu, 0xB953u, 0x3928u,
+    0x3300u, 0xB37Bu, 0xB3F3u, 0x3388u, 0xB2E3u, 0x3298u, 0x3210u, 0xB26Bu, 0xB0C3u, 0x30B8u, 0x3030u, 0xB04Bu, 0x3120u, 0xB15Bu, 0xB1D3u, 0x31A8u,
+    0xB483u, 0x34F8u, 0x3470u, 0xB40Bu, 0x3560u, 0xB51Bu, 0xB593u, 0x35E8u, 0x3740u, 0xB73Bu, 0xB7B3u, 0x37C8u, 0xB6A3u, 0x36D8u, 0x3650u, 0xB62Bu,
+    0x2200u, 0xA27Bu, 0xA2F3u, 0x2288u, 0xA3E3u, 0x2398u, 0x2310u, 0xA36Bu, 0xA1C3u, 0x21B8u, 0x2130u, 0xA14Bu, 0x2020u, 0xA05Bu, 0xA0D3u, 0x20A8u,
+    0xA583u, 0x25F8u, 0x2570u, 0xA50Bu, 0x2460u, 0xA41Bu, 0xA493u, 0x24E8u, 0x2640u, 0xA63Bu, 0xA6B3u, 0x26C8u, 0xA7A3u, 0x27D8u, 0x2750u, 0xA72Bu,
+    0xAD03u, 0x2D78u, 0x2DF0u, 0xAD8Bu, 0x2CE0u, 0xAC9Bu, 0xAC13u, 0x2C68u, 0x2EC0u, 0xAEBBu, 0xAE33u, 0x2E48u, 0xAF23u, 0x2F58u, 0x2FD0u, 0xAFABu,
+    0x2A80u, 0xAAFBu, 0xAA73u, 0x2A08u, 0xAB63u, 0x2B18u, 0x2B90u, 0xABEBu, 0xA943u, 0x2938u, 0x29B0u, 0xA9CBu, 0x28A0u, 0xA8DBu, 0xA853u, 0x2828u,
+    0x0000u, 0xF803u, 0x7003u, 0x8800u, 0xE006u, 0x1805u, 0x9005u, 0x6806u, 0x4009u, 0xB80Au, 0x300Au, 0xC809u, 0xA00Fu, 0x580Cu, 0xD00Cu, 0x280Fu,
+    0x8012u, 0x7811u, 0xF011u, 0x0812u, 0x6014u, 0x9817u, 0x1017u, 0xE814u, 0xC01Bu, 0x3818u, 0xB018u, 0x481Bu, 0x201Du, 0xD81Eu, 0x501Eu, 0xA81Du,
+    0x8021u, 0x7822u, 0xF022u, 0x0821u, 0x6027u, 0x9824u, 0x1024u, 0xE827u, 0xC028u, 0x382Bu, 0xB02Bu, 0x4828u, 0x202Eu, 0xD82Du, 0x502Du, 0xA82Eu,
+    0x0033u, 0xF830u, 0x7030u, 0x8833u, 0xE035u, 0x1836u, 0x9036u, 0x6835u, 0x403Au, 0xB839u, 0x3039u, 0xC83Au, 0xA03Cu, 0x583Fu, 0xD03Fu, 0x283Cu,
+    0x8047u, 0x7844u, 0xF044u, 0x0847u, 0x6041u, 0x9842u, 0x1042u, 0xE841u, 0xC04Eu, 0x384Du, 0xB04Du, 0x484Eu, 0x2048u, 0xD84Bu, 0x504Bu, 0xA848u,
+    0x0055u, 0xF856u, 0x7056u, 0x8855u, 0xE053u, 0x1850u, 0x9050u, 0x6853u, 0x405Cu, 0xB85Fu, 0x305Fu, 0xC85Cu, 0xA05Au, 0x5859u, 0xD059u, 0x285Au,
+    0x0066u, 0xF865u, 0x7065u, 0x8866u, 0xE060u, 0x1863u, 0x9063u, 0x6860u, 0x406Fu, 0xB86Cu, 0x306Cu, 0xC86Fu, 0xA069u, 0x586Au, 0xD06Au, 0x2869u,
+    0x8074u, 0x7877u, 0xF077u, 0x0874u, 0x6072u, 0x9871u, 0x1071u, 0xE872u, 0xC07Du, 0x387Eu, 0xB07Eu, 0x487Du, 0x207Bu, 0xD878u, 0x5078u, 0xA87Bu,
+    0x808Bu, 0x7888u, 0xF088u, 0x088Bu, 0x608Du, 0x988Eu, 0x108Eu, 0xE88Du, 0xC082u, 0x3881u, 0xB081u, 0x4882u, 0x2084u, 0xD887u, 0x5087u, 0xA884u,
+    0x0099u, 0xF89Au, 0x709Au, 0x8899u, 0xE09Fu, 0x189Cu, 0x909Cu, 0x689Fu, 0x4090u, 0xB893u, 0x3093u, 0xC890u, 0xA096u, 0x5895u, 0xD095u, 0x2896u,
+    0x00AAu, 0xF8A9u, 0x70A9u, 0x88AAu, 0xE0ACu, 0x18AFu, 0x90AFu, 0x68ACu, 0x40A3u, 0xB8A0u, 0x30A0u, 0xC8A3u, 0xA0A5u, 0x58A6u, 0xD0A6u, 0x28A5u,
+    0x80B8u, 0x78BBu, 0xF0BBu, 0x08B8u, 0x60BEu, 0x98BDu, 0x10BDu, 0xE8BEu, 0xC0B1u, 0x38B2u, 0xB0B2u, 0x48B1u, 0x20B7u, 0xD8B4u, 0x50B4u, 0xA8B7u,
+    0x00CCu, 0xF8CFu, 0x70CFu, 0x88CCu, 0xE0CAu, 0x18C9u, 0x90C9u, 0x68CAu, 0x40C5u, 0xB8C6u, 0x30C6u, 0xC8C5u, 0xA0C3u, 0x58C0u, 0xD0C0u, 0x28C3u,
+    0x80DEu, 0x78DDu, 0xF0DDu, 0x08DEu, 0x60D8u, 0x98DBu, 0x10DBu, 0xE8D8u, 0xC0D7u, 0x38D4u, 0xB0D4u, 0x48D7u, 0x20D1u, 0xD8D2u, 0x50D2u, 0xA8D1u,
+    0x80EDu, 0x78EEu, 0xF0EEu, 0x08EDu, 0x60EBu, 0x98E8u, 0x10E8u, 0xE8EBu, 0xC0E4u, 0x38E7u, 0xB0E7u, 0x48E4u, 0x20E2u, 0xD8E1u, 0x50E1u, 0xA8E2u,
+    0x00FFu, 0xF8FCu, 0x70FCu, 0x88FFu, 0xE0F9u, 0x18FAu, 0x90FAu, 0x68F9u, 0x40F6u, 0xB8F5u, 0x30F5u, 0xC8F6u, 0xA0F0u, 0x58F3u, 0xD0F3u, 0x28F0u,
+    0x0000u, 0x8113u, 0x8223u, 0x0330u, 0x8443u, 0x0550u, 0x0660u, 0x8773u, 0x8883u, 0x0990u, 0x0AA0u, 0x8BB3u, 0x0CC0u, 0x8DD3u, 0x8EE3u, 0x0FF0u,
+    0x9103u, 0x1010u, 0x1320u, 0x9233u, 0x1540u, 0x9453u, 0x9763u, 0x1670u, 0x1980u, 0x9893u, 0x9BA3u, 0x1AB0u, 0x9DC3u, 0x1CD0u, 0x1FE0u, 0x9EF3u,
+    0xA203u, 0x2310u, 0x2020u, 0xA133u, 0x2640u, 0xA753u, 0xA463u, 0x2570u, 0x2A80u, 0xAB93u, 0xA8A3u, 0x29B0u, 0xAEC3u, 0x2FD0u, 0x2CE0u, 0xADF3u,
+    0x3300u, 0xB213u, 0xB123u, 0x3030u, 0xB743u, 0x3650u, 0x3560u, 0xB473u, 0xBB83u, 0x3A90u, 0x39A0u, 0xB8B3u, 0x3FC0u, 0xBED3u, 0xBDE3u, 0x3CF0u,
+    0xC403u, 0x4510u, 0x4620u, 0xC733u, 0x4040u, 0xC153u, 0xC263u, 0x4370u, 0x4C80u, 0xCD93u, 0xCEA3u, 0x4FB0u, 0xC8C3u, 0x49D0u, 0x4AE0u, 0xCBF3u,
+    0x5500u, 0xD413u, 0xD723u, 0x5630u, 0xD143u, 0x5050u, 0x5360u, 0xD273u, 0xDD83u, 0x5C90u, 0x5FA0u, 0xDEB3u, 0x59C0u, 0xD8D3u, 0xDBE3u, 0x5AF0u,
+    0x6600u, 0xE713u, 0xE423u, 0x6530u, 0xE243u, 0x6350u, 0x6060u, 0xE173u, 0xEE83u, 0x6F90u, 0x6CA0u, 0xEDB3u, 0x6AC0u, 0xEBD3u, 0xE8E3u, 0x69F0u,
+    0xF703u, 0x7610u, 0x7520u, 0xF433u, 0x7340u, 0xF253u, 0xF163u, 0x7070u, 0x7F80u, 0xFE93u, 0xFDA3u, 0x7CB0u, 0xFBC3u, 0x7AD0u, 0x79E0u, 0xF8F3u,
+    0x0803u, 0x8910u, 0x8A20u, 0x0B33u, 0x8C40u, 0x0D53u, 0x0E63u, 0x8F70u, 0x8080u, 0x0193u, 0x02A3u, 0x83B0u, 0x04C3u, 0x85D0u, 0x86E0u, 0x07F3u,
+    0x9900u, 0x1813u, 0x1B23u, 0x9A30u, 0x1D43u, 0x9C50u, 0x9F60u, 0x1E73u, 0x1183u, 0x9090u, 0x93A0u, 0x12B3u, 0x95C0u, 0x14D3u, 0x17E3u, 0x96F0u,
+    0xAA00u, 0x2B13u, 0x2823u, 0xA930u, 0x2E43u, 0xAF50u, 0xAC60u, 0x2D73u, 0x2283u, 0xA390u, 0xA0A0u, 0x21B3u, 0xA6C0u, 0x27D3u, 0x24E3u, 0xA5F0u,
+    0x3B03u, 0xBA10u, 0xB920u, 0x3833u, 0xBF40u, 0x3E53u, 0x3D63u, 0xBC70u, 0xB380u, 0x3293u, 0x31A3u, 0xB0B0u, 0x37C3u, 0xB6D0u, 0xB5E0u, 0x34F3u,
+    0xCC00u, 0x4D13u, 0x4E23u, 0xCF30u, 0x4843u, 0xC950u, 0xCA60u, 0x4B73u, 0x4483u, 0xC590u, 0xC6A0u, 0x47B3u, 0xC0C0u, 0x41D3u, 0x42E3u, 0xC3F0u,
+    0x5D03u, 0xDC10u, 0xDF20u, 0x5E33u, 0xD940u, 0x5853u, 0x5B63u, 0xDA70u, 0xD580u, 0x5493u, 0x57A3u, 0xD6B0u, 0x51C3u, 0xD0D0u, 0xD3E0u, 0x52F3u,
+    0x6E03u, 0xEF10u, 0xEC20u, 0x6D33u, 0xEA40u, 0x6B53u, 0x6863u, 0xE970u, 0xE680u, 0x6793u, 0x64A3u, 0xE5B0u, 0x62C3u, 0xE3D0u, 0xE0E0u, 0x61F3u,
+    0xFF00u, 0x7E13u, 0x7D23u, 0xFC30u, 0x7B43u, 0xFA50u, 0xF960u, 0x7873u, 0x7783u, 0xF690u, 0xF5A0u, 0x74B3u, 0xF3C0u, 0x72D3u, 0x71E3u, 0xF0F0u,
+    0x0000u, 0x1006u, 0x200Cu, 0x300Au, 0x4018u, 0x501Eu, 0x6014u, 0x7012u, 0x8030u, 0x9036u, 0xA03Cu, 0xB03Au, 0xC028u, 0xD02Eu, 0xE024u, 0xF022u,
+    0x8065u, 0x9063u, 0xA069u, 0xB06Fu, 0xC07Du, 0xD07Bu, 0xE071u, 0xF077u, 0x0055u, 0x1053u, 0x2059u, 0x305Fu, 0x404Du, 0x504Bu, 0x6041u, 0x7047u,
+    0x80CFu, 0x90C9u, 0xA0C3u, 0xB0C5u, 0xC0D7u, 0xD0D1u, 0xE0DBu, 0xF0DDu, 0x00FFu, 0x10F9u, 0x20F3u, 0x30F5u, 0x40E7u, 0x50E1u, 0x60EBu, 0x70EDu,
+    0x00AAu, 0x10ACu, 0x20A6u, 0x30A0u, 0x40B2u, 0x50B4u, 0x60BEu, 0x70B8u, 0x809Au, 0x909Cu, 0xA096u, 0xB090u, 0xC082u, 0xD084u, 0xE08Eu, 0xF088u,
+    0x819Bu, 0x919Du, 0xA197u, 0xB191u, 0xC183u, 0xD185u, 0xE18Fu, 0xF189u, 0x01ABu, 0x11ADu, 0x21A7u, 0x31A1u, 0x41B3u, 0x51B5u, 0x61BFu, 0x71B9u,
+    0x01FEu, 0x11F8u, 0x21F2u, 0x31F4u, 0x41E6u, 0x51E0u, 0x61EAu, 0x71ECu, 0x81CEu, 0x91C8u, 0xA1C2u, 0xB1C4u, 0xC1D6u, 0xD1D0u, 0xE1DAu, 0xF1DCu,
+    0x0154u, 0x1152u, 0x2158u, 0x315Eu, 0x414Cu, 0x514Au, 0x6140u, 0x7146u, 0x8164u, 0x9162u, 0xA168u, 0xB16Eu, 0xC17Cu, 0xD17Au, 0xE170u, 0xF176u,
+    0x8131u, 0x9137u, 0xA13Du, 0xB13Bu, 0xC129u, 0xD12Fu, 0xE125u, 0xF123u, 0x0101u, 0x1107u, 0x210Du, 0x310Bu, 0x4119u, 0x511Fu, 0x6115u, 0x7113u,
+    0x8333u, 0x9335u, 0xA33Fu, 0xB339u, 0xC32Bu, 0xD32Du, 0xE327u, 0xF321u, 0x0303u, 0x1305u, 0x230Fu, 0x3309u, 0x431Bu, 0x531Du, 0x6317u, 0x7311u,
+    0x0356u, 0x1350u, 0x235Au, 0x335Cu, 0x434Eu, 0x5348u, 0x6342u, 0x7344u, 0x8366u, 0x9360u, 0xA36Au, 0xB36Cu, 0xC37Eu, 0xD378u, 0xE372u, 0xF374u,
+    0x03FCu, 0x13FAu, 0x23F0u, 0x33F6u, 0x43E4u, 0x53E2u, 0x63E8u, 0x73EEu, 0x83CCu, 0x93CAu, 0xA3C0u, 0xB3C6u, 0xC3D4u, 0xD3D2u, 0xE3D8u, 0xF3DEu,
+    0x8399u, 0x939Fu, 0xA395u, 0xB393u, 0xC381u, 0xD387u, 0xE38Du, 0xF38Bu, 0x03A9u, 0x13AFu, 0x23A5u, 0x33A3u, 0x43B1u, 0x53B7u, 0x63BDu, 0x73BBu,
+    0x02A8u, 0x12AEu, 0x22A4u, 0x32A2u, 0x42B0u, 0x52B6u, 0x62BCu, 0x72BAu, 0x8298u, 0x929Eu, 0xA294u, 0xB292u, 0xC280u, 0xD286u, 0xE28Cu, 0xF28Au,
+    0x82CDu, 0x92CBu, 0xA2C1u, 0xB2C7u, 0xC2D5u, 0xD2D3u, 0xE2D9u, 0xF2DFu, 0x02FDu, 0x12FBu, 0x22F1u, 0x32F7u, 0x42E5u, 0x52E3u, 0x62E9u, 0x72EFu,
+    0x8267u, 0x9261u, 0xA26Bu, 0xB26Du, 0xC27Fu, 0xD279u, 0xE273u, 0xF275u, 0x0257u, 0x1251u, 0x225Bu, 0x325Du, 0x424Fu, 0x5249u, 0x6243u, 0x7245u,
+    0x0202u, 0x1204u, 0x220Eu, 0x3208u, 0x421Au, 0x521Cu, 0x6216u, 0x7210u, 0x8232u, 0x9234u, 0xA23Eu, 0xB238u, 0xC22Au, 0xD22Cu, 0xE226u, 0xF220u
+};
+#endif
+
 const  CRC_MODEL_16  CRC_ModelCRC16_8005 = {
      0x8005u,
      0x0000u,
      DEF_NO,
      0x0000u,
-    &CRC_TblCRC16_8005[0]
+    &CRC_TblCRC16_8005[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+    &CRC_TblSliceCRC16_8005[0]
+#else
+     (const CPU_INT16U *)0
+#endif
 };
 #endif
 
@@ -159,12 +573,150 @@ const  CPU_INT16U  CRC_TblCRC16_8005_ref[256] = {
     0x4400u, 0x84C1u, 0x8581u, 0x4540u, 0x8701u, 0x47C0u, 0x4680u, 0x8641u, 0x8201u, 0x42C0u, 0x4380u, 0x8341u, 0x4100u, 0x81C1u, 0x8081u, 0x4040u
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT16U  CRC_TblSliceCRC16_8005_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x0000u, 0xC0C1u, 0xC181u, 0x0140u, 0xC301u, 0x03C0u, 0x0280u, 0xC241u, 0xC601u, 0x06C0u, 0x0780u, 0xC741u, 0x0500u, 0xC5C1u, 0xC481u, 0x0440u,
+    0xCC01u, 0x0CC0u, 0x0D80u, 0xCD41u, 0x0F00u, 0xCFC1u, 0xCE81u, 0x0E40u, 0x0A00u, 0xCAC1u, 0xCB81u, 0x0B40u, 0xC901u, 0x09C0u, 0x0880u, 0xC841u,
+    0xD801u, 0x18C0u, 0x1980u, 0xD941u, 0x1B00u, 0xDBC1u, 0xDA81u, 0x1A40u, 0x1E00u, 0xDEC1u, 0xDF81u, 0x1F40u, 0xDD01u, 0x1DC0u, 0x1C80u, 0xDC41u,
+    0x1400u, 0xD4C1u, 0xD581u, 0x1540u, 0xD701u, 0x17C0u, 0x1680u, 0xD641u, 0xD201u, 0x12C0u, 0x1380u, 0xD341u, 0x1100u, 0xD1C1u, 0xD081u, 0x1040u,
+    0xF001u, 0x30C0u, 0x3180u, 0xF141u, 0x3300u, 0xF3C1u, 0xF281u, 0x3240u, 0x3600u, 0xF6C1u, 0xF781u, 0x3740u, 0xF501u, 0x35C0u, 0x3480u, 0xF441u,
+    0x3C00u, 0xFCC1u, 0xFD81u, 0x3D40u, 0xFF01u, 0x3FC0u, 0x3E80u, 0xFE41u, 0xFA01u, 0x3AC0u, 0x3B80u, 0xFB41u, 0x3900u, 0xF9C1u, 0xF881u, 0x3840u,
+    0x2800u, 0xE8C1u, 0xE981u, 0x2940u, 0xEB01u, 0x2BC0u, 0x2A80u, 0xEA41u, 0xEE01u, 0x2EC0u, 0x2F80u, 0xEF41u, 0x2D00u, 0xEDC1u, 0xEC81u, 0x2C40u,
+    0xE401u, 0x24C0u, 0x2580u, 0xE541u, 0x2700u, 0xE7C1u, 0xE681u, 0x2640u, 0x2200u, 0xE2C1u, 0xE381u, 0x2340u, 0xE101u, 0x21C0u, 0x2080u, 0xE041u,
+    0xA001u, 0x60C0u, 0x6180u, 0xA141u, 0x6300u, 0xA3C1u, 0xA281u, 0x6240u, 0x6600u, 0xA6C1u, 0xA781u, 0x6740u, 0xA501u, 0x65C0u, 0x6480u, 0xA441u,
+    0x6C00u, 0xACC1u, 0xAD81u, 0x6D40u, 0xAF01u, 0x6FC0u, 0x6E80u, 0xAE41u, 0xAA01u, 0x6AC0u, 0x6B80u, 0xAB41u, 0x6900u, 0xA9C1u, 0xA881u, 0x6840u,
+    0x7800u, 0xB8C1u, 0xB981u, 0x7940u, 0xBB01u, 0x7BC0u, 0x7A80u, 0xBA41u, 0xBE01u, 0x7EC0u, 0x7F80u, 0xBF41u, 0x7D00u, 0xBDC1u, 0xBC81u, 0x7C40u,
+    0xB401u, 0x74C0u, 0x7580u, 0xB541u, 0x7700u, 0xB7C1u, 0xB681u, 0x7640u, 0x7200u, 0xB2C1u, 0xB381u, 0x7340u, 0xB101u, 0x71C0u, 0x7080u, 0xB041u,
+    0x5000u, 0x90C1u, 0x9181u, 0x5140u, 0x9301u, 0x53C0u, 0x5280u, 0x9241u, 0x9601u, 0x56C0u, 0x5780u, 0x9741u, 0x5500u, 0x95C1u, 0x9481u, 0x5440u,
+    0x9C01u, 0x5CC0u, 0x5D80u, 0x9D41u, 0x5F00u, 0x9FC1u, 0x9E81u, 0x5E40u, 0x5A00u, 0x9AC1u, 0x9B81u, 0x5B40u, 0x9901u, 0x59C0u, 0x5880u, 0x9841u,
+    0x8801u, 0x48C0u, 0x4980u, 0x8941u, 0x4B00u, 0x8BC1u, 0x8A81u, 0x4A40u, 0x4E00u, 0x8EC1u, 0x8F81u, 0x4F40u, 0x8D01u, 0x4DC0u, 0x4C80u, 0x8C41u,
+    0x4400u, 0x84C1u, 0x8581u, 0x4540u, 0x8701u, 0x47C0u, 0x4680u, 0x8641u, 0x8201u, 0x42C0u, 0x4380u, 0x8341u, 0x4100u, 0x81C1u, 0x8081u, 0x4040u,
+    0x0000u, 0x9001u, 0x6001u, 0xF000u, 0xC002u, 0x5003u, 0xA003u, 0x3002u, 0xC007u, 0x5006u, 0xA006u, 0x3007u, 0x0005u, 0x9004u, 0x6004u, 0xF005u,
+    0xC00Du, 0x500Cu, 0xA00Cu, 0x300Du, 0x000Fu, 0x900Eu, 0x600Eu, 0xF00Fu, 0x000Au, 0x900Bu, 0x600Bu, 0xF00Au, 0xC008u, 0x5009u, 0xA009u, 0x3008u,
+    0xC019u, 0x5018u, 0xA018u, 0x3019u, 0x001Bu, 0x901Au, 0x601Au, 0xF01Bu, 0x001Eu, 0x901Fu, 0x601Fu, 0xF01Eu, 0xC01Cu, 0x501Du, 0xA01Du, 0x301Cu,
+    0x0014u, 0x9015u, 0x6015u, 0xF014u, 0xC016u, 0x5017u, 0xA017u, 0x3016u, 0xC013u, 0x5012u, 0xA012u, 0x3013u, 0x0011u, 0x9010u, 0x6010u, 0xF011u,
+    0xC031u, 0x5030u, 0xA030u, 0x3031u, 0x0033u, 0x9032u, 0x6032u, 0xF033u, 0x0036u, 0x9037u, 0x6037u, 0xF036u, 0xC034u, 0x5035u, 0xA035u, 0x3034u,
+    0x003Cu, 0x903Du, 0x603Du, 0xF03Cu, 0xC03Eu, 0x503Fu, 0xA03Fu, 0x303Eu, 0xC03Bu, 0x503Au, 0xA03Au, 0x303Bu, 0x0039u, 0x9038u, 0x6038u, 0xF039u,
+    0x0028u, 0x9029u, 0x6029u, 0xF028u, 0xC02Au, 0x502Bu, 0xA02Bu, 0x302Au, 0xC02Fu, 0x502Eu, 0xA02Eu, 0x302Fu, 0x002Du, 0x902Cu, 0x602Cu, 0xF02Du,
+    0xC025u, 0x5024u, 0xA024u, 0x3025u, 0x0027u, 0x9026u, 0x6026u, 0xF027u, 0x0022u, 0x9023u, 0x6023u, 0xF022u, 0xC020u, 0x5021u, 0xA021u, 0x3020u,
+    0xC061u, 0x5060u, 0xA060u, 0x3061u, 0x0063u, 0x9062u, 0x6062u, 0xF063u, 0x0066u, 0x9067u, 0x6067u, 0xF066u, 0xC064u, 0x5065u, 0xA065u, 0x3064u,
+    0x006Cu, 0x906Du, 0x606Du, 0xF06Cu, 0xC06Eu, 0x506Fu, 0xA06Fu, 0x306Eu, 0xC06Bu, 0x506Au, 0xA06Au, 0x306Bu, 0x0069u, 0x9068u, 0x6068u, 0xF069u,
+    0x0078u, 0x9079u, 0x6079u, 0xF078u, 0xC07Au, 0x507Bu, 0xA07Bu, 0x307Au, 0xC07Fu, 0x507Eu, 0xA07Eu, 0x307Fu, 0x007Du, 0x907Cu, 0x607Cu, 0xF07Du,
+    0xC075u, 0x5074u, 0xA074u, 0x3075u, 0x0077u, 0x9076u, 0x6076u, 0xF077u, 0x0072u, 0x9073u, 0x6073u, 0xF072u, 0xC070u, 0x5071u, 0xA071u, 0x3070u,
+    0x0050u, 0x9051u, 0x6051u, 0xF050u, 0xC052u, 0x5053u, 0xA053u, 0x3052u, 0xC057u, 0x5056u, 0xA056u, 0x3057u, 0x0055u, 0x9054u, 0x6054u, 0xF055u,
+    0xC05Du, 0x505Cu, 0xA05Cu, 0x305Du, 0x005Fu, 0x905Eu, 0x605Eu, 0xF05Fu, 0x005Au, 0x905Bu, 0x605Bu, 0xF05Au, 0xC058u, 0x5059u, 0xA059u, 0x3058u,
+    0xC049u, 0x5048u, 0xA048u, 0x3049u, 0x004Bu, 0x904Au, 0x604Au, 0xF04Bu, 0x004Eu, 0x904Fu, 0x604Fu, 0xF04Eu, 0xC04Cu, 0x504Du, 0xA04Du, 0x304Cu,
+    0x0044u, 0x9045u, 0x6045u, 0xF044u, 0xC046u, 0x5047u, 0xA047u, 0x3046u, 0xC043u, 0x5042u, 0xA042u, 0x3043u, 0x0041u, 0x9040u, 0x6040u, 0xF041u,
+    0x0000u, 0xC051u, 0xC0A1u, 0x00F0u, 0xC141u, 0x0110u, 0x01E0u, 0xC1B1u, 0xC281u, 0x02D0u, 0x0220u, 0xC271u, 0x03C0u, 0xC391u, 0xC361u, 0x0330u,
+    0xC501u, 0x0550u, 0x05A0u, 0xC5F1u, 0x0440u, 0xC411u, 0xC4E1u, 0x04B0u, 0x0780u, 0xC7D1u, 0xC721u, 0x0770u, 0xC6C1u, 0x0690u, 0x0660u, 0xC631u,
+    0xCA01u, 0x0A50u, 0x0AA0u, 0xCAF1u, 0x0B40u, 0xCB11u, 0xCBE1u, 0x0BB0u, 0x0880u, 0xC8D1u, 0xC821u, 0x0870u, 0xC9C1u, 0x0990u, 0x0960u, 0xC931u,
+    0x0F00u, 0xCF51u, 0xCFA1u, 0x0FF0u, 0xCE41u, 0x0E10u, 0x0EE0u, 0xCEB1u, 0xCD81u, 0x0DD0u, 0x0D20u, 0xCD71u, 0x0CC0u, 0xCC91u, 0xCC61u, 0x0C30u,
+    0xD401u, 0x1450u, 0x14A0u, 0xD4F1u, 0x1540u, 0xD511u, 0xD5E1u, 0x15B0u, 0x1680u, 0xD6D1u, 0xD621u, 0x1670u, 0xD7C1u, 0x1790u, 0x1760u, 0xD731u,
+    0x1100u, 0xD151u, 0xD1A1u, 0x11F0u, 0xD041u, 0x1010u, 0x10E0u, 0xD0B1u, 0xD381u, 0x13D0u, 0x1320u, 0xD371u, 0x12C0u, 0xD291u, 0xD261u, 0x1230u,
+    0x1E00u, 0xDE51u, 0xDEA1u, 0x1EF0u, 0xDF41u, 0x1F10u, 0x1FE0u, 0xDFB1u, 0xDC81u, 0x1CD0u, 0x1C20u, 0xDC71u, 0x1DC0u, 0xDD91u, 0xDD61u, 0x1D30u,
+    0xDB01u, 0x1B50u, 0x1BA0u, 0xDBF1u, 0x1A40u, 0xDA11u, 0xDAE1u, 0x1AB0u, 0x1980u, 0xD9D1u, 0xD921u, 0x1970u, 0xD8C1u, 0x1890u, 0x1860u, 0xD831u,
+    0xE801u, 0x2850u, 0x28A0u, 0xE8F1u, 0x2940u, 0xE911u, 0xE9E1u, 0x29B0u, 0x2A80u, 0xEAD1u, 0xEA21u, 0x2A70u, 0xEBC1u, 0x2B90u, 0x2B60u, 0xEB31u,
+    0x2D00u, 0xED51u, 0xEDA1u, 0x2DF0u, 0xEC41u, 0x2C10u, 0x2CE0u, 0xECB1u, 0xEF81u, 0x2FD0u, 0x2F20u, 0xEF71u, 0x2EC0u, 0xEE91u, 0xEE61u, 0x2E30u,
+    0x2200u, 0xE251u, 0xE2A1u, 0x22F0u, 0xE341u, 0x2310u, 0x23E0u, 0xE3B1u, 0xE081u, 0x20D0u, 0x2020u, 0xE071u, 0x21C0u, 0xE191u, 0xE161u, 0x2130u,
+    0xE701u, 0x2750u, 0x27A0u, 0xE7F1u, 0x2640u, 0xE611u, 0xE6E1u, 0x26B0u, 0x2580u, 0xE5D1u, 0xE521u, 0x2570u, 0xE4C1u, 0x2490u, 0x2460u, 0xE431u,
+    0x3C00u, 0xFC51u, 0xFCA1u, 0x3CF0u, 0xFD41u, 0x3D10u, 0x3DE0u, 0xFDB1u, 0xFE81u, 0x3ED0u, 0x3E20u, 0xFE71u, 0x3FC0u, 0xFF91u, 0xFF61u, 0x3F30u,
+    0xF901u, 0x3950u, 0x39A0u, 0xF9F1u, 0x3840u, 0xF811u, 0xF8E1u, 0x38B0u, 0x3B80u, 0xFBD1u, 0xFB21u, 0x3B70u, 0xFAC1u, 0x3A90u, 0x3A60u, 0xFA31u,
+    0xF601u, 0x3650u, 0x36A0u, 0xF6F1u, 0x3740u, 0xF711u, 0xF7E1u, 0x37B0u, 0x3480u, 0xF4D1u, 0xF421u, 0x3470u, 0xF5C1u, 0x3590u, 0x3560u, 0xF531u,
+    0x3300u, 0xF351u, 0xF3A1u, 0x33F0u, 0xF241u, 0x3210u, 0x32E0u, 0xF2B1u, 0xF181u, 0x31D0u, 0x3120u, 0xF171u, 0x30C0u, 0xF091u, 0xF061u, 0x3030u,
+    0x0000u, 0xFC01u, 0xB801u, 0x4400u, 0x3001u, 0xCC00u, 0x8800u, 0x7401u, 0x6002u, 0x9C03u, 0xD803u, 0x2402u, 0x5003u, 0xAC02u, 0xE802u, 0x1403u,
+    0xC004u, 0x3C05u, 0x7805u, 0x8404u, 0xF005u, 0x0C04u, 0x4804u, 0xB405u, 0xA006u, 0x5C07u, 0x1807u, 0xE406u, 0x9007u, 0x6C06u, 0x2806u, 0xD407u,
+    0xC00Bu, 0x3C0Au, 0x780Au, 0x840Bu, 0xF00Au, 0x0C0Bu, 0x480Bu, 0xB40Au, 0xA009u, 0x5C08u, 0x1808u, 0xE409u, 0x9008u, 0x6C09u, 0x2809u, 0xD408u,
+    0x000Fu, 0xFC0Eu, 0xB80Eu, 0x440Fu, 0x300Eu, 0xCC0Fu, 0x880Fu, 0x740Eu, 0x600Du, 0x9C0Cu, 0xD80Cu, 0x240Du, 0x500Cu, 0xAC0Du, 0xE80Du, 0x140Cu,
+    0xC015u, 0x3C14u, 0x7814u, 0x8415u, 0xF014u, 0x0C15u, 0x4815u, 0xB414u, 0xA017u, 0x5C16u, 0x1816u, 0xE417u, 0x9016u, 0x6C17u, 0x2817u, 0xD416u,
+    0x0011u, 0xFC10u, 0xB810u, 0x4411u, 0x3010u, 0xCC11u, 0x8811u, 0x7410u, 0x6013u, 0x9C12u, 0xD812u, 0x2413u, 0x5012u, 0xAC13u, 0xE813u, 0x1412u,
+    0x001Eu, 0xFC1Fu, 0xB81Fu, 0x441Eu, 0x301Fu, 0xCC1Eu, 0x881Eu, 0x741Fu, 0x601Cu, 0x9C1Du, 0xD81Du, 0x241Cu, 0x501Du, 0xAC1Cu, 0xE81Cu, 0x141Du,
+    0xC01Au, 0x3C1Bu, 0x781Bu, 0x841Au, 0xF01Bu, 0x0C1Au, 0x481Au, 0xB41Bu, 0xA018u, 0x5C19u, 0x1819u, 0xE418u, 0x9019u, 0x6C18u, 0x2818u, 0xD419u,
+    0xC029u, 0x3C28u, 0x7828u, 0x8429u, 0xF028u, 0x0C29u, 0x4829u, 0xB428u, 0xA02Bu, 0x5C2Au, 0x182Au, 0xE42Bu, 0x902Au, 0x6C2Bu, 0x282Bu, 0xD42Au,
+    0x002Du, 0xFC2Cu, 0xB82Cu, 0x442Du, 0x302Cu, 0xCC2Du, 0x882Du, 0x742Cu, 0x602Fu, 0x9C2Eu, 0xD82Eu, 0x242Fu, 0x502Eu, 0xAC2Fu, 0xE82Fu, 0x142Eu,
+    0x0022u, 0xFC23u, 0xB823u, 0x4422u, 0x3023u, 0xCC22u, 0x8822u, 0x7423u, 0x6020u, 0x9C21u, 0xD821u, 0x2420u, 0x5021u, 0xAC20u, 0xE820u, 0x1421u,
+    0xC026u, 0x3C27u, 0x7827u, 0x8426u, 0xF027u, 0x0C26u, 0x4826u, 0xB427u, 0xA024u, 0x5C25u, 0x1825u, 0xE424u, 0x9025u, 0x6C24u, 0x2824u, 0xD425u,
+    0x003Cu, 0xFC3Du, 0xB83Du, 0x443Cu, 0x303Du, 0xCC3Cu, 0x883Cu, 0x743Du, 0x603Eu, 0x9C3Fu, 0xD83Fu, 0x243Eu, 0x503Fu, 0xAC3Eu, 0xE83Eu, 0x143Fu,
+    0xC038u, 0x3C39u, 0x7839u, 0x8438u, 0xF039u, 0x0C38u, 0x4838u, 0xB439u, 0xA03Au, 0x5C3Bu, 0x183Bu, 0xE43Au, 0x903Bu, 0x6C3Au, 0x283Au, 0xD43Bu,
+    0xC037u, 0x3C36u, 0x7836u, 0x8437u, 0xF036u, 0x0C37u, 0x4837u, 0xB436u, 0xA035u, 0x5C34u, 0x1834u, 0xE435u, 0x9034u, 0x6C35u, 0x2835u, 0xD434u,
+    0x0033u, 0xFC32u, 0xB832u, 0x4433u, 0x3032u, 0xCC33u, 0x8833u, 0x7432u, 0x6031u, 0x9C30u, 0xD830u, 0x2431u, 0x5030u, 0xAC31u, 0xE831u, 0x1430u,
+    0x0000u, 0xC03Du, 0xC079u, 0x0044u, 0xC0F1u, 0x00CCu, 0x0088u, 0xC0B5u, 0xC1E1u, 0x01DCu, 0x0198u, 0xC1A5u, 0x0110u, 0xC12Du, 0xC169u, 0x0154u,
+    0xC3C1u, 0x03FCu, 0x03B8u, 0xC385u, 0x0330u, 0xC30Du, 0xC349u, 0x0374u, 0x0220u, 0xC21Du, 0xC259u, 0x0264u, 0xC2D1u, 0x02ECu, 0x02A8u, 0xC295u,
+    0xC781u, 0x07BCu, 0x07F8u, 0xC7C5u, 0x0770u, 0xC74Du, 0xC709u, 0x0734u, 0x0660u, 0xC65Du, 0xC619u, 0x0624u, 0xC691u, 0x06ACu, 0x06E8u, 0xC6D5u,
+    0x0440u, 0xC47Du, 0xC439u, 0x0404u, 0xC4B1u, 0x048Cu, 0x04C8u, 0xC4F5u, 0xC5A1u, 0x059Cu, 0x05D8u, 0xC5E5u, 0x0550u, 0xC56Du, 0xC529u, 0x0514u,
+    0xCF01u, 0x0F3Cu, 0x0F78u, 0xCF45u, 0x0FF0u, 0xCFCDu, 0xCF89u, 0x0FB4u, 0x0EE0u, 0xCEDDu, 0xCE99u, 0x0EA4u, 0xCE11u, 0x0E2Cu, 0x0E68u, 0xCE55u,
+    0x0CC0u, 0xCCFDu, 0xCCB9u, 0x0C84u, 0xCC31u, 0x0C0Cu, 0x0C48u, 0xCC75u, 0xCD21u, 0x0D1Cu, 0x0D58u, 0xCD65u, 0x0DD0u, 0xCDEDu, 0xCDA9u, 0x0D94u,
+    0x0880u, 0xC8BDu, 0xC8F9u, 0x08C4u, 0xC871u, 0x084Cu, 0x0808u, 0xC835u, 0xC961u, 0x095Cu, 0x0918u, 0xC925u, 0x0990u, 0xC9ADu, 0xC9E9u, 0x09D4u,
+    0xCB41u, 0x0B7Cu, 0x0B38u, 0xCB05u, 0x0BB0u, 0xCB8Du, 0xCBC9u, 0x0BF4u, 0x0AA0u, 0xCA9Du, 0xCAD9u, 0x0AE4u, 0xCA51u, 0x0A6Cu, 0x0A28u, 0xCA15u,
+    0xDE01u, 0x1E3Cu, 0x1E78u, 0xDE45u, 0x1EF0u, 0xDECDu, 0xDE89u, 0x1EB4u, 0x1FE0u, 0xDFDDu, 0xDF99u, 0x1FA4u, 0xDF11u, 0x1F2Cu, 0x1F68u, 0xDF55u,
+    0x1DC0u, 0xDDFDu, 0xDDB9u, 0x1D84u, 0xDD31u, 0x1D0Cu, 0x1D48u, 0xDD75u, 0xDC21u, 0x1C1Cu, 0x1C58u, 0xDC65u, 0x1CD0u, 0xDCEDu, 0xDCA9u, 0x1C94u,
+    0x1980u, 0xD9BDu, 0xD9F9u, 0x19C4u, 0xD971u, 0x194Cu, 0x1908u, 0xD935u, 0xD861u, 0x185Cu, 0x1818u, 0xD825u, 0x1890u, 0xD8ADu, 0xD8E9u, 0x18D4u,
+    0xDA41u, 0x1A7Cu, 0x1A38u, 0xDA05u, 0x1AB0u, 0xDA8Du, 0xDAC9u, 0x1AF4u, 0x1BA0u, 0xDB9Du, 0xDBD9u, 0x1BE4u, 0xDB51u, 0x1B6Cu, 0x1B28u, 0xDB15u,
+    0x1100u, 0xD13Du, 0xD179u, 0x1144u, 0xD1F1u, 0x11CCu, 0x1188u, 0xD1B5u, 0xD0E1u, 0x10DCu, 0x1098u, 0xD0A5u, 0x1010u, 0xD02Du, 0xD069u, 0x1054u,
+    0xD2C1u, 0x12FCu, 0x12B8u, 0xD285u, 0x1230u, 0xD20Du, 0xD249u, 0x1274u, 0x1320u, 0xD31Du, 0xD359u, 0x1364u, 0xD3D1u, 0x13ECu, 0x13A8u, 0xD395u,
+    0xD681u, 0x16BCu, 0x16F8u, 0xD6C5u, 0x1670u, 0xD64Du, 0xD609u, 0x1634u, 0x1760u, 0xD75Du, 0xD719u, 0x1724u, 0xD791u, 0x17ACu, 0x17E8u, 0xD7D5u,
+    0x1540u, 0xD57Du, 0xD539u, 0x1504u, 0xD5B1u, 0x158Cu, 0x15C8u, 0xD5F5u, 0xD4A1u, 0x149Cu, 0x14D8u, 0xD4E5u, 0x1450u, 0xD46Du, 0xD429u, 0x1414u,
+    0x0000u, 0xD101u, 0xE201u, 0x3300u, 0x8401u, 0x5500u, 0x6600u, 0xB701u, 0x4801u, 0x9900u, 0xAA00u, 0x7B01u, 0xCC00u, 0x1D01u, 0x2E01u, 0xFF00u,
+    0x9002u, 0x4103u, 0x7203u, 0xA302u, 0x1403u, 0xC502u, 0xF602u, 0x2703u, 0xD803u, 0x0902u, 0x3A02u, 0xEB03u, 0x5C02u, 0x8D03u, 0xBE03u, 0x6F02u,
+    0x6007u, 0xB106u, 0x8206u, 0x5307u, 0xE406u, 0x3507u, 0x0607u, 0xD706u, 0x2806u, 0xF907u, 0xCA07u, 0x1B06u, 0xAC07u, 0x7D06u, 0x4E06u, 0x9F07u,
+    0xF005u, 0x2104u, 0x1204u, 0xC305u, 0x7404u, 0xA505u, 0x9605u, 0x4704u, 0xB804u, 0x6905u, 0x5A05u, 0x8B04u, 0x3C05u, 0xED04u, 0xDE04u, 0x0F05u,
+    0xC00Eu, 0x110Fu, 0x220Fu, 0xF30Eu, 0x440Fu, 0x950Eu, 0xA60Eu, 0x770Fu, 0x880Fu, 0x590Eu, 0x6A0Eu, 0xBB0Fu, 0x0C0Eu, 0xDD0Fu, 0xEE0Fu, 0x3F0Eu,
+    0x500Cu, 0x810Du, 0xB20Du, 0x630Cu, 0xD40Du, 0x050Cu, 0x360Cu, 0xE70Du, 0x180Du, 0xC90Cu, 0xFA0Cu, 0x2B0Du, 0x9C0Cu, 0x4D0Du, 0x7E0Du, 0xAF0Cu,
+    0xA009u, 0x7108u, 0x4208u, 0x9309u, 0x2408u, 0xF509u, 0xC609u, 0x1708u, 0xE808u, 0x3909u, 0x0A09u, 0xDB08u, 0x6C09u, 0xBD08u, 0x8E08u, 0x5F09u,
+    0x300Bu, 0xE10Au, 0xD20Au, 0x030Bu, 0xB40Au, 0x650Bu, 0x560Bu, 0x870Au, 0x780Au, 0xA90Bu, 0x9A0Bu, 0x4B0Au, 0xFC0Bu, 0x2D0Au, 0x1E0Au, 0xCF0Bu,
+    0xC01Fu, 0x111Eu, 0x221Eu, 0xF31Fu, 0x441Eu, 0x951Fu, 0xA61Fu, 0x771Eu, 0x881Eu, 0x591Fu, 0x6A1Fu, 0xBB1Eu, 0x0C1Fu, 0xDD1Eu, 0xEE1Eu, 0x3F1Fu,
+    0x501Du, 0x811Cu, 0xB21Cu, 0x631Du, 0xD41Cu, 0x051Du, 0x361Du, 0xE71Cu, 0x181Cu, 0xC91Du, 0xFA1Du, 0x2B1Cu, 0x9C1Du, 0x4D1Cu, 0x7E1Cu, 0xAF1Du,
+    0xA018u, 0x7119u, 0x4219u, 0x9318u, 0x2419u, 0xF518u, 0xC618u, 0x1719u, 0xE819u, 0x3918u, 0x0A18u, 0xDB19u, 0x6C18u, 0xBD19u, 0x8E19u, 0x5F18u,
+    0x301Au, 0xE11Bu, 0xD21Bu, 0x031Au, 0xB41Bu, 0x651Au, 0x561Au, 0x871Bu, 0x781Bu, 0xA91Au, 0x9A1Au, 0x4B1Bu, 0xFC1Au, 0x2D1Bu, 0x1E1Bu, 0xCF1Au,
+    0x0011u, 0xD110u, 0xE210u, 0x3311u, 0x8410u, 0x5511u, 0x6611u, 0xB710u, 0x4810u, 0x9911u, 0xAA11u, 0x7B10u, 0xCC11u, 0x1D10u, 0x2E10u, 0xFF11u,
+    0x9013u, 0x4112u, 0x7212u, 0xA313u, 0x1412u, 0xC513u, 0xF613u, 0x2712u, 0xD812u, 0x0913u, 0x3A13u, 0xEB12u, 0x5C13u, 0x8D12u, 0xBE12u, 0x6F13u,
+    0x6016u, 0xB117u, 0x8217u, 0x5316u, 0xE417u, 0x3516u, 0x0616u, 0xD717u, 0x2817u, 0xF916u, 0xCA16u, 0x1B17u, 0xAC16u, 0x7D17u, 0x4E17u, 0x9F16u,
+    0xF014u, 0x2115u, 0x1215u, 0xC314u, 0x7415u, 0xA514u, 0x9614u, 0x4715u, 0xB815u, 0x6914u, 0x5A14u, 0x8B15u, 0x3C14u, 0xED15u, 0xDE15u, 0x0F14u,
+    0x0000u, 0xC010u, 0xC023u, 0x0033u, 0xC045u, 0x0055u, 0x0066u, 0xC076u, 0xC089u, 0x0099u, 0x00AAu, 0xC0BAu, 0x00CCu, 0xC0DCu, 0xC0EFu, 0x00FFu,
+    0xC111u, 0x0101u, 0x0132u, 0xC122u, 0x0154u, 0xC144u, 0xC177u, 0x0167u, 0x0198u, 0xC188u, 0xC1BBu, 0x01ABu, 0xC1DDu, 0x01CDu, 0x01FEu, 0xC1EEu,
+    0xC221u, 0x0231u, 0x0202u, 0xC212u, 0x0264u, 0xC274u, 0xC247u, 0x0257u, 0x02A8u, 0xC2B8u, 0xC28Bu, 0x029Bu, 0xC2EDu, 0x02FDu, 0x02CEu, 0xC2DEu,
+    0x0330u, 0xC320u, 0xC313u, 0x0303u, 0xC375u, 0x0365u, 0x0356u, 0xC346u, 0xC3B9u, 0x03A9u, 0x039Au, 0xC38Au, 0x03FCu, 0xC3ECu, 0xC3DFu, 0x03CFu,
+    0xC441u, 0x0451u, 0x0462u, 0xC472u, 0x0404u, 0xC414u, 0xC427u, 0x0437u, 0x04C8u, 0xC4D8u, 0xC4EBu, 0x04FBu, 0xC48Du, 0x049Du, 0x04AEu, 0xC4BEu,
+    0x0550u, 0xC540u, 0xC573u, 0x0563u, 0xC515u, 0x0505u, 0x0536u, 0xC526u, 0xC5D9u, 0x05C9u, 0x05FAu, 0xC5EAu, 0x059Cu, 0xC58Cu, 0xC5BFu, 0x05AFu,
+    0x0660u, 0xC670u, 0xC643u, 0x0653u, 0xC625u, 0x0635u, 0x0606u, 0xC616u, 0xC6E9u, 0x06F9u, 0x06CAu, 0xC6DAu, 0x06ACu, 0xC6BCu, 0xC68Fu, 0x069Fu,
+    0xC771u, 0x0761u, 0x0752u, 0xC742u, 0x0734u, 0xC724u, 0xC717u, 0x0707u, 0x07F8u, 0xC7E8u, 0xC7DBu, 0x07CBu, 0xC7BDu, 0x07ADu, 0x079Eu, 0xC78Eu,
+    0xC881u, 0x0891u, 0x08A2u, 0xC8B2u, 0x08C4u, 0xC8D4u, 0xC8E7u, 0x08F7u, 0x0808u, 0xC818u, 0xC82Bu, 0x083Bu, 0xC84Du, 0x085Du, 0x086Eu, 0xC87Eu,
+    0x0990u, 0xC980u, 0xC9B3u, 0x09A3u, 0xC9D5u, 0x09C5u, 0x09F6u, 0xC9E6u, 0xC919u, 0x0909u, 0x093Au, 0xC92Au, 0x095Cu, 0xC94Cu, 0xC97Fu, 0x096Fu,
+    0x0AA0u, 0xCAB0u, 0xCA83u, 0x0A93u, 0xCAE5u, 0x0AF5u, 0x0AC6u, 0xCAD6u, 0xCA29u, 0x0A39u, 0x0A0Au, 0xCA1Au, 0x0A6Cu, 0xCA7Cu, 0xCA4Fu, 0x0A5Fu,
+    0xCBB1u, 0x0BA1u, 0x0B92u, 0xCB82u, 0x0BF4u, 0xCBE4u, 0xCBD7u, 0x0BC7u, 0x0B38u, 0xCB28u, 0xCB1Bu, 0x0B0Bu, 0xCB7Du, 0x0B6Du, 0x0B5Eu, 0xCB4Eu,
+    0x0CC0u, 0xCCD0u, 0xCCE3u, 0x0CF3u, 0xCC85u, 0x0C95u, 0x0CA6u, 0xCCB6u, 0xCC49u, 0x0C59u, 0x0C6Au, 0xCC7Au, 0x0C0Cu, 0xCC1Cu, 0xCC2Fu, 0x0C3Fu,
+    0xCDD1u, 0x0DC1u, 0x0DF2u, 0xCDE2u, 0x0D94u, 0xCD84u, 0xCDB7u, 0x0DA7u, 0x0D58u, 0xCD48u, 0xCD7Bu, 0x0D6Bu, 0xCD1Du, 0x0D0Du, 0x0D3Eu, 0xCD2Eu,
+    0xCEE1u, 0x0EF1u, 0x0EC2u, 0xCED2u, 0x0EA4u, 0xCEB4u, 0xCE87u, 0x0E97u, 0x0E68u, 0xCE78u, 0xCE4Bu, 0x0E5Bu, 0xCE2Du, 0x0E3Du, 0x0E0Eu, 0xCE1Eu,
+    0x0FF0u, 0xCFE0u, 0xCFD3u, 0x0FC3u, 0xCFB5u, 0x0FA5u, 0x0F96u, 0xCF86u, 0xCF79u, 0x0F69u, 0x0F5Au, 0xCF4Au, 0x0F3Cu, 0xCF2Cu, 0xCF1Fu, 0x0F0Fu,
+    0x0000u, 0xCCC1u, 0xD981u, 0x1540u, 0xF301u, 0x3FC0u, 0x2A80u, 0xE641u, 0xA601u, 0x6AC0u, 0x7F80u, 0xB341u, 0x5500u, 0x99C1u, 0x8C81u, 0x4040u,
+    0x0C01u, 0xC0C0u, 0xD580u, 0x1941u, 0xFF00u, 0x33C1u, 0x2681u, 0xEA40u, 0xAA00u, 0x66C1u, 0x7381u, 0xBF40u, 0x5901u, 0x95C0u, 0x8080u, 0x4C41u,
+    0x1802u, 0xD4C3u, 0xC183u, 0x0D42u, 0xEB03u, 0x27C2u, 0x3282u, 0xFE43u, 0xBE03u, 0x72C2u, 0x6782u, 0xAB43u, 0x4D02u, 0x81C3u, 0x9483u, 0x5842u,
+    0x1403u, 0xD8C2u, 0xCD82u, 0x0143u, 0xE702u, 0x2BC3u, 0x3E83u, 0xF242u, 0xB202u, 0x7EC3u, 0x6B83u, 0xA742u, 0x4103u, 0x8DC2u, 0x9882u, 0x5443u,
+    0x3004u, 0xFCC5u, 0xE985u, 0x2544u, 0xC305u, 0x0FC4u, 0x1A84u, 0xD645u, 0x9605u, 0x5AC4u, 0x4F84u, 0x8345u, 0x6504u, 0xA9C5u, 0xBC85u, 0x7044u,
+    0x3C05u, 0xF0C4u, 0xE584u, 0x2945u, 0xCF04u, 0x03C5u, 0x1685u, 0xDA44u, 0x9A04u, 0x56C5u, 0x4385u, 0x8F44u, 0x6905u, 0xA5C4u, 0xB084u, 0x7C45u,
+    0x2806u, 0xE4C7u, 0xF187u, 0x3D46u, 0xDB07u, 0x17C6u, 0x0286u, 0xCE47u, 0x8E07u, 0x42C6u, 0x5786u, 0x9B47u, 0x7D06u, 0xB1C7u, 0xA487u, 0x6846u,
+    0x2407u, 0xE8C6u, 0xFD86u, 0x3147u, 0xD706u, 0x1BC7u, 0x0E87u, 0xC246u, 0x8206u, 0x4EC7u, 0x5B87u, 0x9746u, 0x7107u, 0xBDC6u, 0xA886u, 0x6447u,
+    0x6008u, 0xACC9u, 0xB989u, 0x7548u, 0x9309u, 0x5FC8u, 0x4A88u, 0x8649u, 0xC609u, 0x0AC8u, 0x1F88u, 0xD349u, 0x3508u, 0xF9C9u, 0xEC89u, 0x2048u,
+    0x6C09u, 0xA0C8u, 0xB588u, 0x7949u, 0x9F08u, 0x53C9u, 0x4689u, 0x8A48u, 0xCA08u, 0x06C9u, 0x1389u, 0xDF48u, 0x3909u, 0xF5C8u, 0xE088u, 0x2C49u,
+    0x780Au, 0xB4CBu, 0xA18Bu, 0x6D4Au, 0x8B0Bu, 0x47CAu, 0x528Au, 0x9E4Bu, 0xDE0Bu, 0x12CAu, 0x078Au, 0xCB4Bu, 0x2D0Au, 0xE1CBu, 0xF48Bu, 0x384Au,
+    0x740Bu, 0xB8CAu, 0xAD8Au, 0x614Bu, 0x870Au, 0x4BCBu, 0x5E8Bu, 0x924Au, 0xD20Au, 0x1ECBu, 0x0B8Bu, 0xC74Au, 0x210Bu, 0xEDCAu, 0xF88Au, 0x344Bu,
+    0x500Cu, 0x9CCDu, 0x898Du, 0x454Cu, 0xA30Du, 0x6FCCu, 0x7A8Cu, 0xB64Du, 0xF60Du, 0x3ACCu, 0x2F8Cu, 0xE34Du, 0x050Cu, 0xC9CDu, 0xDC8Du, 0x104Cu,
+    0x5C0Du, 0x90CCu, 0x858Cu, 0x494Du, 0xAF0Cu, 0x63CDu, 0x768Du, 0xBA4Cu, 0xFA0Cu, 0x36CDu, 0x238Du, 0xEF4Cu, 0x090Du, 0xC5CCu, 0xD08Cu, 0x1C4Du,
+    0x480Eu, 0x84CFu, 0x918Fu, 0x5D4Eu, 0xBB0Fu, 0x77CEu, 0x628Eu, 0xAE4Fu, 0xEE0Fu, 0x22CEu, 0x378Eu, 0xFB4Fu, 0x1D0Eu, 0xD1CFu, 0xC48Fu, 0x084Eu,
+    0x440Fu, 0x88CEu, 0x9D8Eu, 0x514Fu, 0xB70Eu, 0x7BCFu, 0x6E8Fu, 0xA24Eu, 0xE20Eu, 0x2ECFu, 0x3B8Fu, 0xF74Eu, 0x110Fu, 0xDDCEu, 0xC88Eu, 0x044Fu
+};
+#endif
+
 const  CRC_MODEL_16  CRC_ModelCRC16_8005_ref = {
      0x8005u,
      0x0000u,
      DEF_YES,
      0x0000u,
-    &CRC_TblCRC16_8005_ref[0]
+    &CRC_TblCRC16_8005_ref[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+    &CRC_TblSliceCRC16_8005_ref[0]
+#else
+     (const CPU_INT16U *)0
+#endif
 };
 #endif
 
@@ -189,12 +741,150 @@ const  CPU_INT16U  CRC_TblCRC16_8048[256] = {
     0x2D00u, 0xAD48u, 0xADD8u, 0x2D90u, 0xACF8u, 0x2CB0u, 0x2C20u, 0xAC68u, 0xAEB8u, 0x2EF0u, 0x2E60u, 0xAE28u, 0x2F40u, 0xAF08u, 0xAF98u, 0x2FD0u
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT16U  CRC_TblSliceCRC16_8048[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x0000u, 0x8048u, 0x80D8u, 0x0090u, 0x81F8u, 0x01B0u, 0x0120u, 0x8168u, 0x83B8u, 0x03F0u, 0x0360u, 0x8328u, 0x0240u, 0x8208u, 0x8298u, 0x02D0u,
+    0x8738u, 0x0770u, 0x07E0u, 0x87A8u, 0x06C0u, 0x8688u, 0x8618u, 0x0650u, 0x0480u, 0x84C8u, 0x8458u, 0x0410u, 0x8578u, 0x0530u, 0x05A0u, 0x85E8u,
+    0x8E38u, 0x0E70u, 0x0EE0u, 0x8EA8u, 0x0FC0u, 0x8F88u, 0x8F18u, 0x0F50u, 0x0D80u, 0x8DC8u, 0x8D58u, 0x0D10u, 0x8C78u, 0x0C30u, 0x0CA0u, 0x8CE8u,
+    0x0900u, 0x8948u, 0x89D8u, 0x0990u, 0x88F8u, 0x08B0u, 0x0820u, 0x8868u, 0x8AB8u, 0x0AF0u, 0x0A60u, 0x8A28u, 0x0B40u, 0x8B08u, 0x8B98u, 0x0BD0u,
+    0x9C38u, 0x1C70u, 0x1CE0u, 0x9CA8u, 0x1DC0u, 0x9D88u, 0x9D18u, 0x1D50u, 0x1F80u, 0x9FC8u, 0x9F58u, 0x1F10u, 0x9E78u, 0x1E30u, 0x1EA0u, 0x9EE8u,
+    0x1B00u, 0x9B48u, 0x9BD8u, 0x1B90u, 0x9AF8u, 0x1AB0u, 0x1A20u, 0x9A68u, 0x98B8u, 0x18F0u, 0x1860u, 0x9828u, 0x1940u, 0x9908u, 0x9998u, 0x19D0u,
+    0x1200u, 0x9248u, 0x92D8u, 0x1290u, 0x93F8u, 0x13B0u, 0x1320u, 0x9368u, 0x91B8u, 0x11F0u, 0x1160u, 0x9128u, 0x1040u, 0x9008u, 0x9098u, 0x10D0u,
+    0x9538u, 0x1570u, 0x15E0u, 0x95A8u, 0x14C0u, 0x9488u, 0x9418u, 0x1450u, 0x1680u, 0x96C8u, 0x9658u, 0x1610u, 0x9778u, 0x1730u, 0x17A0u, 0x97E8u,
+    0xB838u, 0x3870u, 0x38E0u, 0xB8A8u, 0x39C0u, 0xB988u, 0xB918u, 0x3950u, 0x3B80u, 0xBBC8u, 0xBB58u, 0x3B10u, 0xBA78u, 0x3A30u, 0x3AA0u, 0xBAE8u,
+    0x3F00u, 0xBF48u, 0xBFD8u, 0x3F90u, 0xBEF8u, 0x3EB0u, 0x3E20u, 0xBE68u, 0xBCB8u, 0x3CF0u, 0x3C60u, 0xBC28u, 0x3D40u, 0xBD08u, 0xBD98u, 0x3DD0u,
+    0x3600u, 0xB648u, 0xB6D8u, 0x3690u, 0xB7F8u, 0x37B0u, 0x3720u, 0xB768u, 0xB5B8u, 0x35F0u, 0x3560u, 0xB528u, 0x3440u, 0xB408u, 0xB498u, 0x34D0u,
+    0xB138u, 0x3170u, 0x31E0u, 0xB1A8u, 0x30C0u, 0xB088u, 0xB018u, 0x3050u, 0x3280u, 0xB2C8u, 0xB258u, 0x3210u, 0xB378u, 0x3330u, 0x33A0u, 0xB3E8u,
+    0x2400u, 0xA448u, 0xA4D8u, 0x2490u, 0xA5F8u, 0x25B0u, 0x2520u, 0xA568u, 0xA7B8u, 0x27F0u, 0x2760u, 0xA728u, 0x2640u, 0xA608u, 0xA698u, 0x26D0u,
+    0xA338u, 0x2370u, 0x23E0u, 0xA3A8u, 0x22C0u, 0xA288u, 0xA218u, 0x2250u, 0x2080u, 0xA0C8u, 0xA058u, 0x2010u, 0xA178u, 0x2130u, 0x21A0u, 0xA1E8u,
+    0xAA38u, 0x2A70u, 0x2AE0u, 0xAAA8u, 0x2BC0u, 0xAB88u, 0xAB18u, 0x2B50u, 0x2980u, 0xA9C8u, 0xA958u, 0x2910u, 0xA878u, 0x2830u, 0x28A0u, 0xA8E8u,
+    0x2D00u, 0xAD48u, 0xADD8u, 0x2D90u, 0xACF8u, 0x2CB0u, 0x2C20u, 0xAC68u, 0xAEB8u, 0x2EF0u, 0x2E60u, 0xAE28u, 0x2F40u, 0xAF08u, 0xAF98u, 0x2FD0u,
+    0x0000u, 0xF038u, 0x6038u, 0x9000u, 0xC070u, 0x3048u, 0xA048u, 0x5070u, 0x00A8u, 0xF090u, 0x6090u, 0x90A8u, 0xC0D8u, 0x30E0u, 0xA0E0u, 0x50D8u,
+    0x0150u, 0xF168u, 0x6168u, 0x9150u, 0xC120u, 0x3118u, 0xA118u, 0x5120u, 0x01F8u, 0xF1C0u, 0x61C0u, 0x91F8u, 0xC188u, 0x31B0u, 0xA1B0u, 0x5188u,
+    0x02A0u, 0xF298u, 0x6298u, 0x92A0u, 0xC2D0u, 0x32E8u, 0xA2E8u, 0x52D0u, 0x0208u, 0xF230u, 0x6230u, 0x9208u, 0xC278u, 0x3240u, 0xA240u, 0x5278u,
+    0x03F0u, 0xF3C8u, 0x63C8u, 0x93F0u, 0xC380u, 0x33B8u, 0xA3B8u, 0x5380u, 0x0358u, 0xF360u, 0x6360u, 0x9358u, 0xC328u, 0x3310u, 0xA310u, 0x5328u,
+    0x0540u, 0xF578u, 0x6578u, 0x9540u, 0xC530u, 0x3508u, 0xA508u, 0x5530u, 0x05E8u, 0xF5D0u, 0x65D0u, 0x95E8u, 0xC598u, 0x35A0u, 0xA5A0u, 0x5598u,
+    0x0410u, 0xF428u, 0x6428u, 0x9410u, 0xC460u, 0x3458u, 0xA458u, 0x5460u, 0x04B8u, 0xF480u, 0x6480u, 0x94B8u, 0xC4C8u, 0x34F0u, 0xA4F0u, 0x54C8u,
+    0x07E0u, 0xF7D8u, 0x67D8u, 0x97E0u, 0xC790u, 0x37A8u, 0xA7A8u, 0x5790u, 0x0748u, 0xF770u, 0x6770u, 0x9748u, 0xC738u, 0x3700u, 0xA700u, 0x5738u,
+    0x06B0u, 0xF688u, 0x6688u, 0x96B0u, 0xC6C0u, 0x36F8u, 0xA6F8u, 0x56C0u, 0x0618u, 0xF620u, 0x6620u, 0x9618u, 0xC668u, 0x3650u, 0xA650u, 0x5668u,
+    0x0A80u, 0xFAB8u, 0x6AB8u, 0x9A80u, 0xCAF0u, 0x3AC8u, 0xAAC8u, 0x5AF0u, 0x0A28u, 0xFA10u, 0x6A10u, 0x9A28u, 0xCA58u, 0x3A60u, 0xAA60u, 0x5A58u,
+    0x0BD0u, 0xFBE8u, 0x6BE8u, 0x9BD0u, 0xCBA0u, 0x3B98u, 0xAB98u, 0x5BA0u, 0x0B78u, 0xFB40u, 0x6B40u, 0x9B78u, 0xCB08u, 0x3B30u, 0xAB30u, 0x5B08u,
+    0x0820u, 0xF818u, 0x6818u, 0x9820u, 0xC850u, 0x3868u, 0xA868u, 0x5850u, 0x0888u, 0xF8B0u, 0x68B0u, 0x9888u, 0xC8F8u, 0x38C0u, 0xA8C0u, 0x58F8u,
+    0x0970u, 0xF948u, 0x6948u, 0x9970u, 0xC900u, 0x3938u, 0xA938u, 0x5900u, 0x09D8u, 0xF9E0u, 0x69E0u, 0x99D8u, 0xC9A8u, 0x3990u, 0xA990u, 0x59A8u,
+    0x0FC0u, 0xFFF8u, 0x6FF8u, 0x9FC0u, 0xCFB0u, 0x3F88u, 0xAF88u, 0x5FB0u, 0x0F68u, 0xFF50u, 0x6F50u, 0x9F68u, 0xCF18u, 0x3F20u, 0xAF20u, 0x5F18u,
+    0x0E90u, 0xFEA8u, 0x6EA8u, 0x9E90u, 0xCEE0u, 0x3ED8u, 0xAED8u, 0x5EE0u, 0x0E38u, 0xFE00u, 0x6E00u, 0x9E38u, 0xCE48u, 0x3E70u, 0xAE70u, 0x5E48u,
+    0x0D60u, 0xFD58u, 0x6D58u, 0x9D60u, 0xCD10u, 0x3D28u, 0xAD28u, 0x5D10u, 0x0DC8u, 0xFDF0u, 0x6DF0u, 0x9DC8u, 0xCDB8u, 0x3D80u, 0xAD80u, 0x5DB8u,
+    0x0C30u, 0xFC08u, 0x6C08u, 0x9C30u, 0xCC40u, 0x3C78u, 0xAC78u, 0x5C40u, 0x0C98u, 0xFCA0u, 0x6CA0u, 0x9C98u, 0xCCE8u, 0x3CD0u, 0xACD0u, 0x5CE8u,
+    0x0000u, 0x1500u, 0x2A00u, 0x3F00u, 0x5400u, 0x4100u, 0x7E00u, 0x6B00u, 0xA800u, 0xBD00u, 0x8200u, 0x9700u, 0xFC00u, 0xE900u, 0xD600u, 0xC300u,
+    0xD048u, 0xC548u, 0xFA48u, 0xEF48u, 0x8448u, 0x9148u, 0xAE48u, 0xBB48u, 0x7848u, 0x6D48u, 0x5248u, 0x4748u, 0x2C48u, 0x3948u, 0x0648u, 0x1348u,
+    0x20D8u, 0x35D8u, 0x0AD8u, 0x1FD8u, 0x74D8u, 0x61D8u, 0x5ED8u, 0x4BD8u, 0x88D8u, 0x9DD8u, 0xA2D8u, 0xB7D8u, 0xDCD8u, 0xC9D8u, 0xF6D8u, 0xE3D8u,
+    0xF090u, 0xE590u, 0xDA90u, 0xCF90u, 0xA490u, 0xB190u, 0x8E90u, 0x9B90u, 0x5890u, 0x4D90u, 0x7290u, 0x6790u, 0x0C90u, 0x1990u, 0x2690u, 0x3390u,
+    0x41B0u, 0x54B0u, 0x6BB0u, 0x7EB0u, 0x15B0u, 0x00B0u, 0x3FB0u, 0x2AB0u, 0xE9B0u, 0xFCB0u, 0xC3B0u, 0xD6B0u, 0xBDB0u, 0xA8B0u, 0x97B0u, 0x82B0u,
+    0x91F8u, 0x84F8u, 0xBBF8u, 0xAEF8u, 0xC5F8u, 0xD0F8u, 0xEFF8u, 0xFAF8u, 0x39F8u, 0x2CF8u, 0x13F8u, 0x06F8u, 0x6DF8u, 0x78F8u, 0x47F8u, 0x52F8u,
+    0x6168u, 0x7468u, 0x4B68u, 0x5E68u, 0x3568u, 0x2068u, 0x1F68u, 0x0A68u, 0xC968u, 0xDC68u, 0xE368u, 0xF668u, 0x9D68u, 0x8868u, 0xB768u, 0xA268u,
+    0xB120u, 0xA420u, 0x9B20u, 0x8E20u, 0xE520u, 0xF020u, 0xCF20u, 0xDA20u, 0x1920u, 0x0C20u, 0x3320u, 0x2620u, 0x4D20u, 0x5820u, 0x6720u, 0x7220u,
+    0x8360u, 0x9660u, 0xA960u, 0xBC60u, 0xD760u, 0xC260u, 0xFD60u, 0xE860u, 0x2B60u, 0x3E60u, 0x0160u, 0x1460u, 0x7F60u, 0x6A60u, 0x5560u, 0x4060u,
+    0x5328u, 0x4628u, 0x7928u, 0x6C28u, 0x0728u, 0x1228u, 0x2D28u, 0x3828u, 0xFB28u, 0xEE28u, 0xD128u, 0xC428u, 0xAF28u, 0xBA28u, 0x8528u, 0x9028u,
+    0xA3B8u, 0xB6B8u, 0x89B8u, 0x9CB8u, 0xF7B8u, 0xE2B8u, 0xDDB8u, 0xC8B8u, 0x0BB8u, 0x1EB8u, 0x21B8u, 0x34B8u, 0x5FB8u, 0x4AB8u, 0x75B8u, 0x60B8u,
+    0x73F0u, 0x66F0u, 0x59F0u, 0x4CF0u, 0x27F0u, 0x32F0u, 0x0DF0u, 0x18F0u, 0xDBF0u, 0xCEF0u, 0xF1F0u, 0xE4F0u, 0x8FF0u, 0x9AF0u, 0xA5F0u, 0xB0F0u,
+    0xC2D0u, 0xD7D0u, 0xE8D0u, 0xFDD0u, 0x96D0u, 0x83D0u, 0xBCD0u, 0xA9D0u, 0x6AD0u, 0x7FD0u, 0x40D0u, 0x55D0u, 0x3ED0u, 0x2BD0u, 0x14D0u, 0x01D0u,
+    0x1298u, 0x0798u, 0x3898u, 0x2D98u, 0x4698u, 0x5398u, 0x6C98u, 0x7998u, 0xBA98u, 0xAF98u, 0x9098u, 0x8598u, 0xEE98u, 0xFB98u, 0xC498u, 0xD198u,
+    0xE208u, 0xF708u, 0xC808u, 0xDD08u, 0xB608u, 0xA308u, 0x9C08u, 0x8908u, 0x4A08u, 0x5F08u, 0x6008u, 0x7508u, 0x1E08u, 0x0B08u, 0x3408u, 0x2108u,
+    0x3240u, 0x2740u, 0x1840u, 0x0D40u, 0x6640u, 0x7340u, 0x4C40u, 0x5940u, 0x9A40u, 0x8F40u, 0xB040u, 0xA540u, 0xCE40u, 0xDB40u, 0xE440u, 0xF140u,
+    0x0000u, 0x8688u, 0x8D58u, 0x0BD0u, 0x9AF8u, 0x1C70u, 0x17A0u, 0x9128u, 0xB5B8u, 0x3330u, 0x38E0u, 0xBE68u, 0x2F40u, 0xA9C8u, 0xA218u, 0x2490u,
+    0xEB38u, 0x6DB0u, 0x6660u, 0xE0E8u, 0x71C0u, 0xF748u, 0xFC98u, 0x7A10u, 0x5E80u, 0xD808u, 0xD3D8u, 0x5550u, 0xC478u, 0x42F0u, 0x4920u, 0xCFA8u,
+    0x5638u, 0xD0B0u, 0xDB60u, 0x5DE8u, 0xCCC0u, 0x4A48u, 0x4198u, 0xC710u, 0xE380u, 0x6508u, 0x6ED8u, 0xE850u, 0x7978u, 0xFFF0u, 0xF420u, 0x72A8u,
+    0xBD00u, 0x3B88u, 0x3058u, 0xB6D0u, 0x27F8u, 0xA170u, 0xAAA0u, 0x2C28u, 0x08B8u, 0x8E30u, 0x85E0u, 0x0368u, 0x9240u, 0x14C8u, 0x1F18u, 0x9990u,
+    0xAC70u, 0x2AF8u, 0x2128u, 0xA7A0u, 0x3688u, 0xB000u, 0xBBD0u, 0x3D58u, 0x19C8u, 0x9F40u, 0x9490u, 0x1218u, 0x8330u, 0x05B8u, 0x0E68u, 0x88E0u,
+    0x4748u, 0xC1C0u, 0xCA10u, 0x4C98u, 0xDDB0u, 0x5B38u, 0x50E8u, 0xD660u, 0xF2F0u, 0x7478u, 0x7FA8u, 0xF920u, 0x6808u, 0xEE80u, 0xE550u, 0x63D8u,
+    0xFA48u, 0x7CC0u, 0x7710u, 0xF198u, 0x60B0u, 0xE638u, 0xEDE8u, 0x6B60u, 0x4FF0u, 0xC978u, 0xC2A8u, 0x4420u, 0xD508u, 0x5380u, 0x5850u, 0xDED8u,
+    0x1170u, 0x97F8u, 0x9C28u, 0x1AA0u, 0x8B88u, 0x0D00u, 0x06D0u, 0x8058u, 0xA4C8u, 0x2240u, 0x2990u, 0xAF18u, 0x3E30u, 0xB8B8u, 0xB368u, 0x35E0u,
+    0xD8A8u, 0x5E20u, 0x55F0u, 0xD378u, 0x4250u, 0xC4D8u, 0xCF08u, 0x4980u, 0x6D10u, 0xEB98u, 0xE048u, 0x66C0u, 0xF7E8u, 0x7160u, 0x7AB0u, 0xFC38u,
+    0x3390u, 0xB518u, 0xBEC8u, 0x3840u, 0xA968u, 0x2FE0u, 0x2430u, 0xA2B8u, 0x8628u, 0x00A0u, 0x0B70u, 0x8DF8u, 0x1CD0u, 0x9A58u, 0x9188u, 0x1700u,
+    0x8E90u, 0x0818u, 0x03C8u, 0x8540u, 0x1468u, 0x92E0u, 0x9930u, 0x1FB8u, 0x3B28u, 0xBDA0u, 0xB670u, 0x30F8u, 0xA1D0u, 0x2758u, 0x2C88u, 0xAA00u,
+    0x65A8u, 0xE320u, 0xE8F0u, 0x6E78u, 0xFF50u, 0x79D8u, 0x7208u, 0xF480u, 0xD010u, 0x5698u, 0x5D48u, 0xDBC0u, 0x4AE8u, 0xCC60u, 0xC7B0u, 0x4138u,
+    0x74D8u, 0xF250u, 0xF980u, 0x7F08u, 0xEE20u, 0x68A8u, 0x6378u, 0xE5F0u, 0xC160u, 0x47E8u, 0x4C38u, 0xCAB0u, 0x5B98u, 0xDD10u, 0xD6C0u, 0x5048u,
+    0x9FE0u, 0x1968u, 0x12B8u, 0x9430u, 0x0518u, 0x8390u, 0x8840u, 0x0EC8u, 0x2A58u, 0xACD0u, 0xA700u, 0x2188u, 0xB0A0u, 0x3628u, 0x3DF8u, 0xBB70u,
+    0x22E0u, 0xA468u, 0xAFB8u, 0x2930u, 0xB818u, 0x3E90u, 0x3540u, 0xB3C8u, 0x9758u, 0x11D0u, 0x1A00u, 0x9C88u, 0x0DA0u, 0x8B28u, 0x80F8u, 0x0670u,
+    0xC9D8u, 0x4F50u, 0x4480u, 0xC208u, 0x5320u, 0xD5A8u, 0xDE78u, 0x58F0u, 0x7C60u, 0xFAE8u, 0xF138u, 0x77B0u, 0xE698u, 0x6010u, 0x6BC0u, 0xED48u,
+    0x0000u, 0x3118u, 0x6230u, 0x5328u, 0xC460u, 0xF578u, 0xA650u, 0x9748u, 0x0888u, 0x3990u, 0x6AB8u, 0x5BA0u, 0xCCE8u, 0xFDF0u, 0xAED8u, 0x9FC0u,
+    0x1110u, 0x2008u, 0x7320u, 0x4238u, 0xD570u, 0xE468u, 0xB740u, 0x8658u, 0x1998u, 0x2880u, 0x7BA8u, 0x4AB0u, 0xDDF8u, 0xECE0u, 0xBFC8u, 0x8ED0u,
+    0x2220u, 0x1338u, 0x4010u, 0x7108u, 0xE640u, 0xD758u, 0x8470u, 0xB568u, 0x2AA8u, 0x1BB0u, 0x4898u, 0x7980u, 0xEEC8u, 0xDFD0u, 0x8CF8u, 0xBDE0u,
+    0x3330u, 0x0228u, 0x5100u, 0x6018u, 0xF750u, 0xC648u, 0x9560u, 0xA478u, 0x3BB8u, 0x0AA0u, 0x5988u, 0x6890u, 0xFFD8u, 0xCEC0u, 0x9DE8u, 0xACF0u,
+    0x4440u, 0x7558u, 0x2670u, 0x1768u, 0x8020u, 0xB138u, 0xE210u, 0xD308u, 0x4CC8u, 0x7DD0u, 0x2EF8u, 0x1FE0u, 0x88A8u, 0xB9B0u, 0xEA98u, 0xDB80u,
+    0x5550u, 0x6448u, 0x3760u, 0x0678u, 0x9130u, 0xA028u, 0xF300u, 0xC218u, 0x5DD8u, 0x6CC0u, 0x3FE8u, 0x0EF0u, 0x99B8u, 0xA8A0u, 0xFB88u, 0xCA90u,
+    0x6660u, 0x5778u, 0x0450u, 0x3548u, 0xA200u, 0x9318u, 0xC030u, 0xF128u, 0x6EE8u, 0x5FF0u, 0x0CD8u, 0x3DC0u, 0xAA88u, 0x9B90u, 0xC8B8u, 0xF9A0u,
+    0x7770u, 0x4668u, 0x1540u, 0x2458u, 0xB310u, 0x8208u, 0xD120u, 0xE038u, 0x7FF8u, 0x4EE0u, 0x1DC8u, 0x2CD0u, 0xBB98u, 0x8A80u, 0xD9A8u, 0xE8B0u,
+    0x8880u, 0xB998u, 0xEAB0u, 0xDBA8u, 0x4CE0u, 0x7DF8u, 0x2ED0u, 0x1FC8u, 0x8008u, 0xB110u, 0xE238u, 0xD320u, 0x4468u, 0x7570u, 0x2658u, 0x1740u,
+    0x9990u, 0xA888u, 0xFBA0u, 0xCAB8u, 0x5DF0u, 0x6CE8u, 0x3FC0u, 0x0ED8u, 0x9118u, 0xA000u, 0xF328u, 0xC230u, 0x5578u, 0x6460u, 0x3748u, 0x0650u,
+    0xAAA0u, 0x9BB8u, 0xC890u, 0xF988u, 0x6EC0u, 0x5FD8u, 0x0CF0u, 0x3DE8u, 0xA228u, 0x9330u, 0xC018u, 0xF100u, 0x6648u, 0x5750u, 0x0478u, 0x3560u,
+    0xBBB0u, 0x8AA8u, 0xD980u, 0xE898u, 0x7FD0u, 0x4EC8u, 0x1DE0u, 0x2CF8u, 0xB338u, 0x8220u, 0xD108u, 0xE010u, 0x7758u, 0x4640u, 0x1568u, 0x2470u,
+    0xCCC0u, 0xFDD8u, 0xAEF0u, 0x9FE8u, 0x08A0u, 0x39B8u, 0x6A90u, 0x5B88u, 0xC448u, 0xF550u, 0xA678u, 0x9760u, 0x0028u, 0x3130u, 0x6218u, 0x5300u,
+    0xDDD0u, 0xECC8u, 0xBFE0u, 0x8EF8u, 0x19B0u, 0x28A8u, 0x7B80u, 0x4A98u, 0xD558u, 0xE440u, 0xB768u, 0x8670u, 0x1138u, 0x2020u, 0x7308u, 0x4210u,
+    0xEEE0u, 0xDFF8u, 0x8CD0u, 0xBDC8u, 0x2A80u, 0x1B98u, 0x48B0u, 0x79A8u, 0xE668u, 0xD770u, 0x8458u, 0xB540u, 0x2208u, 0x1310u, 0x4038u, 0x7120u,
+    0xFFF0u, 0xCEE8u, 0x9DC0u, 0xACD8u, 0x3B90u, 0x0A88u, 0x59A0u, 0x68B8u, 0xF778u, 0xC660u, 0x9548u, 0xA450u, 0x3318u, 0x0200u, 0x5128u, 0x6030u,
+    0x0000u, 0x9148u, 0xA2D8u, 0x3390u, 0xC5F8u, 0x54B0u, 0x6720u, 0xF668u, 0x0BB8u, 0x9AF0u, 0xA960u, 0x3828u, 0xCE40u, 0x5F08u, 0x6C98u, 0xFDD0u,
+    0x1770u, 0x8638u, 0xB5A8u, 0x24E0u, 0xD288u, 0x43C0u, 0x7050u, 0xE118u, 0x1CC8u, 0x8D80u, 0xBE10u, 0x2F58u, 0xD930u, 0x4878u, 0x7BE8u, 0xEAA0u,
+    0x2EE0u, 0xBFA8u, 0x8C38u, 0x1D70u, 0xEB18u, 0x7A50u, 0x49C0u, 0xD888u, 0x2558u, 0xB410u, 0x8780u, 0x16C8u, 0xE0A0u, 0x71E8u, 0x4278u, 0xD330u,
+    0x3990u, 0xA8D8u, 0x9B48u, 0x0A00u, 0xFC68u, 0x6D20u, 0x5EB0u, 0xCFF8u, 0x3228u, 0xA360u, 0x90F0u, 0x01B8u, 0xF7D0u, 0x6698u, 0x5508u, 0xC440u,
+    0x5DC0u, 0xCC88u, 0xFF18u, 0x6E50u, 0x9838u, 0x0970u, 0x3AE0u, 0xABA8u, 0x5678u, 0xC730u, 0xF4A0u, 0x65E8u, 0x9380u, 0x02C8u, 0x3158u, 0xA010u,
+    0x4AB0u, 0xDBF8u, 0xE868u, 0x7920u, 0x8F48u, 0x1E00u, 0x2D90u, 0xBCD8u, 0x4108u, 0xD040u, 0xE3D0u, 0x7298u, 0x84F0u, 0x15B8u, 0x2628u, 0xB760u,
+    0x7320u, 0xE268u, 0xD1F8u, 0x40B0u, 0xB6D8u, 0x2790u, 0x1400u, 0x8548u, 0x7898u, 0xE9D0u, 0xDA40u, 0x4B08u, 0xBD60u, 0x2C28u, 0x1FB8u, 0x8EF0u,
+    0x6450u, 0xF518u, 0xC688u, 0x57C0u, 0xA1A8u, 0x30E0u, 0x0370u, 0x9238u, 0x6FE8u, 0xFEA0u, 0xCD30u, 0x5C78u, 0xAA10u, 0x3B58u, 0x08C8u, 0x9980u,
+    0xBB80u, 0x2AC8u, 0x1958u, 0x8810u, 0x7E78u, 0xEF30u, 0xDCA0u, 0x4DE8u, 0xB038u, 0x2170u, 0x12E0u, 0x83A8u, 0x75C0u, 0xE488u, 0xD718u, 0x4650u,
+    0xACF0u, 0x3DB8u, 0x0E28u, 0x9F60u, 0x6908u, 0xF840u, 0xCBD0u, 0x5A98u, 0xA748u, 0x3600u, 0x0590u, 0x94D8u, 0x62B0u, 0xF3F8u, 0xC068u, 0x5120u,
+    0x9560u, 0x0428u, 0x37B8u, 0xA6F0u, 0x5098u, 0xC1D0u, 0xF240u, 0x6308u, 0x9ED8u, 0x0F90u, 0x3C00u, 0xAD48u, 0x5B20u, 0xCA68u, 0xF9F8u, 0x68B0u,
+    0x8210u, 0x1358u, 0x20C8u, 0xB180u, 0x47E8u, 0xD6A0u, 0xE530u, 0x7478u, 0x89A8u, 0x18E0u, 0x2B70u, 0xBA38u, 0x4C50u, 0xDD18u, 0xEE88u, 0x7FC0u,
+    0xE640u, 0x7708u, 0x4498u, 0xD5D0u, 0x23B8u, 0xB2F0u, 0x8160u, 0x1028u, 0xEDF8u, 0x7CB0u, 0x4F20u, 0xDE68u, 0x2800u, 0xB948u, 0x8AD8u, 0x1B90u,
+    0xF130u, 0x6078u, 0x53E8u, 0xC2A0u, 0x34C8u, 0xA580u, 0x9610u, 0x0758u, 0xFA88u, 0x6BC0u, 0x5850u, 0xC918u, 0x3F70u, 0xAE38u, 0x9DA8u, 0x0CE0u,
+    0xC8A0u, 0x59E8u, 0x6A78u, 0xFB30u, 0x0D58u, 0x9C10u, 0xAF80u, 0x3EC8u, 0xC318u, 0x5250u, 0x61C0u, 0xF088u, 0x06E0u, 0x97A8u, 0xA438u, 0x3570u,
+    0xDFD0u, 0x4E98u, 0x7D08u, 0xEC40u, 0x1A28u, 0x8B60u, 0xB8F0u, 0x29B8u, 0xD468u, 0x4520u, 0x76B0u, 0xE7F8u, 0x1190u, 0x80D8u, 0xB348u, 0x2200u,
+    0x0000u, 0xF748u, 0x6ED8u, 0x9990u, 0xDDB0u, 0x2AF8u, 0xB368u, 0x4420u, 0x3B28u, 0xCC60u, 0x55F0u, 0xA2B8u, 0xE698u, 0x11D0u, 0x8840u, 0x7F08u,
+    0x7650u, 0x8118u, 0x1888u, 0xEFC0u, 0xABE0u, 0x5CA8u, 0xC538u, 0x3270u, 0x4D78u, 0xBA30u, 0x23A0u, 0xD4E8u, 0x90C8u, 0x6780u, 0xFE10u, 0x0958u,
+    0xECA0u, 0x1BE8u, 0x8278u, 0x7530u, 0x3110u, 0xC658u, 0x5FC8u, 0xA880u, 0xD788u, 0x20C0u, 0xB950u, 0x4E18u, 0x0A38u, 0xFD70u, 0x64E0u, 0x93A8u,
+    0x9AF0u, 0x6DB8u, 0xF428u, 0x0360u, 0x4740u, 0xB008u, 0x2998u, 0xDED0u, 0xA1D8u, 0x5690u, 0xCF00u, 0x3848u, 0x7C68u, 0x8B20u, 0x12B0u, 0xE5F8u,
+    0x5908u, 0xAE40u, 0x37D0u, 0xC098u, 0x84B8u, 0x73F0u, 0xEA60u, 0x1D28u, 0x6220u, 0x9568u, 0x0CF8u, 0xFBB0u, 0xBF90u, 0x48D8u, 0xD148u, 0x2600u,
+    0x2F58u, 0xD810u, 0x4180u, 0xB6C8u, 0xF2E8u, 0x05A0u, 0x9C30u, 0x6B78u, 0x1470u, 0xE338u, 0x7AA8u, 0x8DE0u, 0xC9C0u, 0x3E88u, 0xA718u, 0x5050u,
+    0xB5A8u, 0x42E0u, 0xDB70u, 0x2C38u, 0x6818u, 0x9F50u, 0x06C0u, 0xF188u, 0x8E80u, 0x79C8u, 0xE058u, 0x1710u, 0x5330u, 0xA478u, 0x3DE8u, 0xCAA0u,
+    0xC3F8u, 0x34B0u, 0xAD20u, 0x5A68u, 0x1E48u, 0xE900u, 0x7090u, 0x87D8u, 0xF8D0u, 0x0F98u, 0x9608u, 0x6140u, 0x2560u, 0xD228u, 0x4BB8u, 0xBCF0u,
+    0xB210u, 0x4558u, 0xDCC8u, 0x2B80u, 0x6FA0u, 0x98E8u, 0x0178u, 0xF630u, 0x8938u, 0x7E70u, 0xE7E0u, 0x10A8u, 0x5488u, 0xA3C0u, 0x3A50u, 0xCD18u,
+    0xC440u, 0x3308u, 0xAA98u, 0x5DD0u, 0x19F0u, 0xEEB8u, 0x7728u, 0x8060u, 0xFF68u, 0x0820u, 0x91B0u, 0x66F8u, 0x22D8u, 0xD590u, 0x4C00u, 0xBB48u,
+    0x5EB0u, 0xA9F8u, 0x3068u, 0xC720u, 0x8300u, 0x7448u, 0xEDD8u, 0x1A90u, 0x6598u, 0x92D0u, 0x0B40u, 0xFC08u, 0xB828u, 0x4F60u, 0xD6F0u, 0x21B8u,
+    0x28E0u, 0xDFA8u, 0x4638u, 0xB170u, 0xF550u, 0x0218u, 0x9B88u, 0x6CC0u, 0x13C8u, 0xE480u, 0x7D10u, 0x8A58u, 0xCE78u, 0x3930u, 0xA0A0u, 0x57E8u,
+    0xEB18u, 0x1C50u, 0x85C0u, 0x7288u, 0x36A8u, 0xC1E0u, 0x5870u, 0xAF38u, 0xD030u, 0x2778u, 0xBEE8u, 0x49A0u, 0x0D80u, 0xFAC8u, 0x6358u, 0x9410u,
+    0x9D48u, 0x6A00u, 0xF390u, 0x04D8u, 0x40F8u, 0xB7B0u, 0x2E20u, 0xD968u, 0xA660u, 0x5128u, 0xC8B8u, 0x3FF0u, 0x7BD0u, 0x8C98u, 0x1508u, 0xE240u,
+    0x07B8u, 0xF0F0u, 0x6960u, 0x9E28u, 0xDA08u, 0x2D40u, 0xB4D0u, 0x4398u, 0x3C90u, 0xCBD8u, 0x5248u, 0xA500u, 0xE120u, 0x1668u, 0x8FF8u, 0x78B0u,
+    0x71E8u, 0x86A0u, 0x1F30u, 0xE878u, 0xAC58u, 0x5B10u, 0xC280u, 0x35C8u, 0x4AC0u, 0xBD88u, 0x2418u, 0xD350u, 0x9770u, 0x6038u, 0xF9A8u, 0x0EE0u,
+    0x0000u, 0xE468u, 0x4898u, 0xACF0u, 0x9130u, 0x7558u, 0xD9A8u, 0x3DC0u, 0xA228u, 0x4640u, 0xEAB0u, 0x0ED8u, 0x3318u, 0xD770u, 0x7B80u, 0x9FE8u,
+    0xC418u, 0x2070u, 0x8C80u, 0x68E8u, 0x5528u, 0xB140u, 0x1DB0u, 0xF9D8u, 0x6630u, 0x8258u, 0x2EA8u, 0xCAC0u, 0xF700u, 0x1368u, 0xBF98u, 0x5BF0u,
+    0x0878u, 0xEC10u, 0x40E0u, 0xA488u, 0x9948u, 0x7D20u, 0xD1D0u, 0x35B8u, 0xAA50u, 0x4E38u, 0xE2C8u, 0x06A0u, 0x3B60u, 0xDF08u, 0x73F8u, 0x9790u,
+    0xCC60u, 0x2808u, 0x84F8u, 0x6090u, 0x5D50u, 0xB938u, 0x15C8u, 0xF1A0u, 0x6E48u, 0x8A20u, 0x26D0u, 0xC2B8u, 0xFF78u, 0x1B10u, 0xB7E0u, 0x5388u,
+    0x10F0u, 0xF498u, 0x5868u, 0xBC00u, 0x81C0u, 0x65A8u, 0xC958u, 0x2D30u, 0xB2D8u, 0x56B0u, 0xFA40u, 0x1E28u, 0x23E8u, 0xC780u, 0x6B70u, 0x8F18u,
+    0xD4E8u, 0x3080u, 0x9C70u, 0x7818u, 0x45D8u, 0xA1B0u, 0x0D40u, 0xE928u, 0x76C0u, 0x92A8u, 0x3E58u, 0xDA30u, 0xE7F0u, 0x0398u, 0xAF68u, 0x4B00u,
+    0x1888u, 0xFCE0u, 0x5010u, 0xB478u, 0x89B8u, 0x6DD0u, 0xC120u, 0x2548u, 0xBAA0u, 0x5EC8u, 0xF238u, 0x1650u, 0x2B90u, 0xCFF8u, 0x6308u, 0x8760u,
+    0xDC90u, 0x38F8u, 0x9408u, 0x7060u, 0x4DA0u, 0xA9C8u, 0x0538u, 0xE150u, 0x7EB8u, 0x9AD0u, 0x3620u, 0xD248u, 0xEF88u, 0x0BE0u, 0xA710u, 0x4378u,
+    0x21E0u, 0xC588u, 0x6978u, 0x8D10u, 0xB0D0u, 0x54B8u, 0xF848u, 0x1C20u, 0x83C8u, 0x67A0u, 0xCB50u, 0x2F38u, 0x12F8u, 0xF690u, 0x5A60u, 0xBE08u,
+    0xE5F8u, 0x0190u, 0xAD60u, 0x4908u, 0x74C8u, 0x90A0u, 0x3C50u, 0xD838u, 0x47D0u, 0xA3B8u, 0x0F48u, 0xEB20u, 0xD6E0u, 0x3288u, 0x9E78u, 0x7A10u,
+    0x2998u, 0xCDF0u, 0x6100u, 0x8568u, 0xB8A8u, 0x5CC0u, 0xF030u, 0x1458u, 0x8BB0u, 0x6FD8u, 0xC328u, 0x2740u, 0x1A80u, 0xFEE8u, 0x5218u, 0xB670u,
+    0xED80u, 0x09E8u, 0xA518u, 0x4170u, 0x7CB0u, 0x98D8u, 0x3428u, 0xD040u, 0x4FA8u, 0xABC0u, 0x0730u, 0xE358u, 0xDE98u, 0x3AF0u, 0x9600u, 0x7268u,
+    0x3110u, 0xD578u, 0x7988u, 0x9DE0u, 0xA020u, 0x4448u, 0xE8B8u, 0x0CD0u, 0x9338u, 0x7750u, 0xDBA0u, 0x3FC8u, 0x0208u, 0xE660u, 0x4A90u, 0xAEF8u,
+    0xF508u, 0x1160u, 0xBD90u, 0x59F8u, 0x6438u, 0x8050u, 0x2CA0u, 0xC8C8u, 0x5720u, 0xB348u, 0x1FB8u, 0xFBD0u, 0xC610u, 0x2278u, 0x8E88u, 0x6AE0u,
+    0x3968u, 0xDD00u, 0x71F0u, 0x9598u, 0xA858u, 0x4C30u, 0xE0C0u, 0x04A8u, 0x9B40u, 0x7F28u, 0xD3D8u, 0x37B0u, 0x0A70u, 0xEE18u, 0x42E8u, 0xA680u,
+    0xFD70u, 0x1918u, 0xB5E8u, 0x5180u, 0x6C40u, 0x8828u, 0x24D8u, 0xC0B0u, 0x5F58u, 0xBB30u, 0x17C0u, 0xF3A8u, 0xCE68u, 0x2A00u, 0x86F0u, 0x6298u
+};
+#endif
+
 const  CRC_MODEL_16  CRC_ModelCRC16_8048 = {
     0x8048u,
     0x0000u,
     DEF_NO,
     0x0000u,
-   &CRC_TblCRC16_8048[0]
+   &CRC_TblCRC16_8048[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+   &CRC_TblSliceCRC16_8048[0]
+#else
+    (const CPU_INT16U *)0
+#endif
 };
 #endif
 
@@ -219,12 +909,150 @@ const  CPU_INT16U  CRC_TblCRC16_8048_ref[256] = {
     0x0B40u, 0x175Du, 0x1779u, 0x0B64u, 0x1731u, 0x0B2Cu, 0x0B08u, 0x1715u, 0x17A1u, 0x0BBCu, 0x0B98u, 0x1785u, 0x0BD0u, 0x17CDu, 0x17E9u, 0x0BF4u
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT16U  CRC_TblSliceCRC16_8048_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x0000u, 0x1C1Du, 0x1C39u, 0x0024u, 0x1C71u, 0x006Cu, 0x0048u, 0x1C55u, 0x1CE1u, 0x00FCu, 0x00D8u, 0x1CC5u, 0x0090u, 0x1C8Du, 0x1CA9u, 0x00B4u,
+    0x1DC1u, 0x01DCu, 0x01F8u, 0x1DE5u, 0x01B0u, 0x1DADu, 0x1D89u, 0x0194u, 0x0120u, 0x1D3Du, 0x1D19u, 0x0104u, 0x1D51u, 0x014Cu, 0x0168u, 0x1D75u,
+    0x1F81u, 0x039Cu, 0x03B8u, 0x1FA5u, 0x03F0u, 0x1FEDu, 0x1FC9u, 0x03D4u, 0x0360u, 0x1F7Du, 0x1F59u, 0x0344u, 0x1F11u, 0x030Cu, 0x0328u, 0x1F35u,
+    0x0240u, 0x1E5Du, 0x1E79u, 0x0264u, 0x1E31u, 0x022Cu, 0x0208u, 0x1E15u, 0x1EA1u, 0x02BCu, 0x0298u, 0x1E85u, 0x02D0u, 0x1ECDu, 0x1EE9u, 0x02F4u,
+    0x1B01u, 0x071Cu, 0x0738u, 0x1B25u, 0x0770u, 0x1B6Du, 0x1B49u, 0x0754u, 0x07E0u, 0x1BFDu, 0x1BD9u, 0x07C4u, 0x1B91u, 0x078Cu, 0x07A8u, 0x1BB5u,
+    0x06C0u, 0x1ADDu, 0x1AF9u, 0x06E4u, 0x1AB1u, 0x06ACu, 0x0688u, 0x1A95u, 0x1A21u, 0x063Cu, 0x0618u, 0x1A05u, 0x0650u, 0x1A4Du, 0x1A69u, 0x0674u,
+    0x0480u, 0x189Du, 0x18B9u, 0x04A4u, 0x18F1u, 0x04ECu, 0x04C8u, 0x18D5u, 0x1861u, 0x047Cu, 0x0458u, 0x1845u, 0x0410u, 0x180Du, 0x1829u, 0x0434u,
+    0x1941u, 0x055Cu, 0x0578u, 0x1965u, 0x0530u, 0x192Du, 0x1909u, 0x0514u, 0x05A0u, 0x19BDu, 0x1999u, 0x0584u, 0x19D1u, 0x05CCu, 0x05E8u, 0x19F5u,
+    0x1201u, 0x0E1Cu, 0x0E38u, 0x1225u, 0x0E70u, 0x126Du, 0x1249u, 0x0E54u, 0x0EE0u, 0x12FDu, 0x12D9u, 0x0EC4u, 0x1291u, 0x0E8Cu, 0x0EA8u, 0x12B5u,
+    0x0FC0u, 0x13DDu, 0x13F9u, 0x0FE4u, 0x13B1u, 0x0FACu, 0x0F88u, 0x1395u, 0x1321u, 0x0F3Cu, 0x0F18u, 0x1305u, 0x0F50u, 0x134Du, 0x1369u, 0x0F74u,
+    0x0D80u, 0x119Du, 0x11B9u, 0x0DA4u, 0x11F1u, 0x0DECu, 0x0DC8u, 0x11D5u, 0x1161u, 0x0D7Cu, 0x0D58u, 0x1145u, 0x0D10u, 0x110Du, 0x1129u, 0x0D34u,
+    0x1041u, 0x0C5Cu, 0x0C78u, 0x1065u, 0x0C30u, 0x102Du, 0x1009u, 0x0C14u, 0x0CA0u, 0x10BDu, 0x1099u, 0x0C84u, 0x10D1u, 0x0CCCu, 0x0CE8u, 0x10F5u,
+    0x0900u, 0x151Du, 0x1539u, 0x0924u, 0x1571u, 0x096Cu, 0x0948u, 0x1555u, 0x15E1u, 0x09FCu, 0x09D8u, 0x15C5u, 0x0990u, 0x158Du, 0x15A9u, 0x09B4u,
+    0x14C1u, 0x08DCu, 0x08F8u, 0x14E5u, 0x08B0u, 0x14ADu, 0x1489u, 0x0894u, 0x0820u, 0x143Du, 0x1419u, 0x0804u, 0x1451u, 0x084Cu, 0x0868u, 0x1475u,
+    0x1681u, 0x0A9Cu, 0x0AB8u, 0x16A5u, 0x0AF0u, 0x16EDu, 0x16C9u, 0x0AD4u, 0x0A60u, 0x167Du, 0x1659u, 0x0A44u, 0x1611u, 0x0A0Cu, 0x0A28u, 0x1635u,
+    0x0B40u, 0x175Du, 0x1779u, 0x0B64u, 0x1731u, 0x0B2Cu, 0x0B08u, 0x1715u, 0x17A1u, 0x0BBCu, 0x0B98u, 0x1785u, 0x0BD0u, 0x17CDu, 0x17E9u, 0x0BF4u,
+    0x0000u, 0x0150u, 0x02A0u, 0x03F0u, 0x0540u, 0x0410u, 0x07E0u, 0x06B0u, 0x0A80u, 0x0BD0u, 0x0820u, 0x0970u, 0x0FC0u, 0x0E90u, 0x0D60u, 0x0C30u,
+    0x1500u, 0x1450u, 0x17A0u, 0x16F0u, 0x1040u, 0x1110u, 0x12E0u, 0x13B0u, 0x1F80u, 0x1ED0u, 0x1D20u, 0x1C70u, 0x1AC0u, 0x1B90u, 0x1860u, 0x1930u,
+    0x0E03u, 0x0F53u, 0x0CA3u, 0x0DF3u, 0x0B43u, 0x0A13u, 0x09E3u, 0x08B3u, 0x0483u, 0x05D3u, 0x0623u, 0x0773u, 0x01C3u, 0x0093u, 0x0363u, 0x0233u,
+    0x1B03u, 0x1A53u, 0x19A3u, 0x18F3u, 0x1E43u, 0x1F13u, 0x1CE3u, 0x1DB3u, 0x1183u, 0x10D3u, 0x1323u, 0x1273u, 0x14C3u, 0x1593u, 0x1663u, 0x1733u,
+    0x1C06u, 0x1D56u, 0x1EA6u, 0x1FF6u, 0x1946u, 0x1816u, 0x1BE6u, 0x1AB6u, 0x1686u, 0x17D6u, 0x1426u, 0x1576u, 0x13C6u, 0x1296u, 0x1166u, 0x1036u,
+    0x0906u, 0x0856u, 0x0BA6u, 0x0AF6u, 0x0C46u, 0x0D16u, 0x0EE6u, 0x0FB6u, 0x0386u, 0x02D6u, 0x0126u, 0x0076u, 0x06C6u, 0x0796u, 0x0466u, 0x0536u,
+    0x1205u, 0x1355u, 0x10A5u, 0x11F5u, 0x1745u, 0x1615u, 0x15E5u, 0x14B5u, 0x1885u, 0x19D5u, 0x1A25u, 0x1B75u, 0x1DC5u, 0x1C95u, 0x1F65u, 0x1E35u,
+    0x0705u, 0x0655u, 0x05A5u, 0x04F5u, 0x0245u, 0x0315u, 0x00E5u, 0x01B5u, 0x0D85u, 0x0CD5u, 0x0F25u, 0x0E75u, 0x08C5u, 0x0995u, 0x0A65u, 0x0B35u,
+    0x1C0Fu, 0x1D5Fu, 0x1EAFu, 0x1FFFu, 0x194Fu, 0x181Fu, 0x1BEFu, 0x1ABFu, 0x168Fu, 0x17DFu, 0x142Fu, 0x157Fu, 0x13CFu, 0x129Fu, 0x116Fu, 0x103Fu,
+    0x090Fu, 0x085Fu, 0x0BAFu, 0x0AFFu, 0x0C4Fu, 0x0D1Fu, 0x0EEFu, 0x0FBFu, 0x038Fu, 0x02DFu, 0x012Fu, 0x007Fu, 0x06CFu, 0x079Fu, 0x046Fu, 0x053Fu,
+    0x120Cu, 0x135Cu, 0x10ACu, 0x11FCu, 0x174Cu, 0x161Cu, 0x15ECu, 0x14BCu, 0x188Cu, 0x19DCu, 0x1A2Cu, 0x1B7Cu, 0x1DCCu, 0x1C9Cu, 0x1F6Cu, 0x1E3Cu,
+    0x070Cu, 0x065Cu, 0x05ACu, 0x04FCu, 0x024Cu, 0x031Cu, 0x00ECu, 0x01BCu, 0x0D8Cu, 0x0CDCu, 0x0F2Cu, 0x0E7Cu, 0x08CCu, 0x099Cu, 0x0A6Cu, 0x0B3Cu,
+    0x0009u, 0x0159u, 0x02A9u, 0x03F9u, 0x0549u, 0x0419u, 0x07E9u, 0x06B9u, 0x0A89u, 0x0BD9u, 0x0829u, 0x0979u, 0x0FC9u, 0x0E99u, 0x0D69u, 0x0C39u,
+    0x1509u, 0x1459u, 0x17A9u, 0x16F9u, 0x1049u, 0x1119u, 0x12E9u, 0x13B9u, 0x1F89u, 0x1ED9u, 0x1D29u, 0x1C79u, 0x1AC9u, 0x1B99u, 0x1869u, 0x1939u,
+    0x0E0Au, 0x0F5Au, 0x0CAAu, 0x0DFAu, 0x0B4Au, 0x0A1Au, 0x09EAu, 0x08BAu, 0x048Au, 0x05DAu, 0x062Au, 0x077Au, 0x01CAu, 0x009Au, 0x036Au, 0x023Au,
+    0x1B0Au, 0x1A5Au, 0x19AAu, 0x18FAu, 0x1E4Au, 0x1F1Au, 0x1CEAu, 0x1DBAu, 0x118Au, 0x10DAu, 0x132Au, 0x127Au, 0x14CAu, 0x159Au, 0x166Au, 0x173Au,
+    0x0000u, 0x06C1u, 0x0D82u, 0x0B43u, 0x1B04u, 0x1DC5u, 0x1686u, 0x1047u, 0x120Bu, 0x14CAu, 0x1F89u, 0x1948u, 0x090Fu, 0x0FCEu, 0x048Du, 0x024Cu,
+    0x0015u, 0x06D4u, 0x0D97u, 0x0B56u, 0x1B11u, 0x1DD0u, 0x1693u, 0x1052u, 0x121Eu, 0x14DFu, 0x1F9Cu, 0x195Du, 0x091Au, 0x0FDBu, 0x0498u, 0x0259u,
+    0x002Au, 0x06EBu, 0x0DA8u, 0x0B69u, 0x1B2Eu, 0x1DEFu, 0x16ACu, 0x106Du, 0x1221u, 0x14E0u, 0x1FA3u, 0x1962u, 0x0925u, 0x0FE4u, 0x04A7u, 0x0266u,
+    0x003Fu, 0x06FEu, 0x0DBDu, 0x0B7Cu, 0x1B3Bu, 0x1DFAu, 0x16B9u, 0x1078u, 0x1234u, 0x14F5u, 0x1FB6u, 0x1977u, 0x0930u, 0x0FF1u, 0x04B2u, 0x0273u,
+    0x0054u, 0x0695u, 0x0DD6u, 0x0B17u, 0x1B50u, 0x1D91u, 0x16D2u, 0x1013u, 0x125Fu, 0x149Eu, 0x1FDDu, 0x191Cu, 0x095Bu, 0x0F9Au, 0x04D9u, 0x0218u,
+    0x0041u, 0x0680u, 0x0DC3u, 0x0B02u, 0x1B45u, 0x1D84u, 0x16C7u, 0x1006u, 0x124Au, 0x148Bu, 0x1FC8u, 0x1909u, 0x094Eu, 0x0F8Fu, 0x04CCu, 0x020Du,
+    0x007Eu, 0x06BFu, 0x0DFCu, 0x0B3Du, 0x1B7Au, 0x1DBBu, 0x16F8u, 0x1039u, 0x1275u, 0x14B4u, 0x1FF7u, 0x1936u, 0x0971u, 0x0FB0u, 0x04F3u, 0x0232u,
+    0x006Bu, 0x06AAu, 0x0DE9u, 0x0B28u, 0x1B6Fu, 0x1DAEu, 0x16EDu, 0x102Cu, 0x1260u, 0x14A1u, 0x1FE2u, 0x1923u, 0x0964u, 0x0FA5u, 0x04E6u, 0x0227u,
+    0x00A8u, 0x0669u, 0x0D2Au, 0x0BEBu, 0x1BACu, 0x1D6Du, 0x162Eu, 0x10EFu, 0x12A3u, 0x1462u, 0x1F21u, 0x19E0u, 0x09A7u, 0x0F66u, 0x0425u, 0x02E4u,
+    0x00BDu, 0x067Cu, 0x0D3Fu, 0x0BFEu, 0x1BB9u, 0x1D78u, 0x163Bu, 0x10FAu, 0x12B6u, 0x1477u, 0x1F34u, 0x19F5u, 0x09B2u, 0x0F73u, 0x0430u, 0x02F1u,
+    0x0082u, 0x0643u, 0x0D00u, 0x0BC1u, 0x1B86u, 0x1D47u, 0x1604u, 0x10C5u, 0x1289u, 0x1448u, 0x1F0Bu, 0x19CAu, 0x098Du, 0x0F4Cu, 0x040Fu, 0x02CEu,
+    0x0097u, 0x0656u, 0x0D15u, 0x0BD4u, 0x1B93u, 0x1D52u, 0x1611u, 0x10D0u, 0x129Cu, 0x145Du, 0x1F1Eu, 0x19DFu, 0x0998u, 0x0F59u, 0x041Au, 0x02DBu,
+    0x00FCu, 0x063Du, 0x0D7Eu, 0x0BBFu, 0x1BF8u, 0x1D39u, 0x167Au, 0x10BBu, 0x12F7u, 0x1436u, 0x1F75u, 0x19B4u, 0x09F3u, 0x0F32u, 0x0471u, 0x02B0u,
+    0x00E9u, 0x0628u, 0x0D6Bu, 0x0BAAu, 0x1BEDu, 0x1D2Cu, 0x166Fu, 0x10AEu, 0x12E2u, 0x1423u, 0x1F60u, 0x19A1u, 0x09E6u, 0x0F27u, 0x0464u, 0x02A5u,
+    0x00D6u, 0x0617u, 0x0D54u, 0x0B95u, 0x1BD2u, 0x1D13u, 0x1650u, 0x1091u, 0x12DDu, 0x141Cu, 0x1F5Fu, 0x199Eu, 0x09D9u, 0x0F18u, 0x045Bu, 0x029Au,
+    0x00C3u, 0x0602u, 0x0D41u, 0x0B80u, 0x1BC7u, 0x1D06u, 0x1645u, 0x1084u, 0x12C8u, 0x1409u, 0x1F4Au, 0x198Bu, 0x09CCu, 0x0F0Du, 0x044Eu, 0x028Fu,
+    0x0000u, 0x151Bu, 0x0E35u, 0x1B2Eu, 0x1C6Au, 0x0971u, 0x125Fu, 0x0744u, 0x1CD7u, 0x09CCu, 0x12E2u, 0x07F9u, 0x00BDu, 0x15A6u, 0x0E88u, 0x1B93u,
+    0x1DADu, 0x08B6u, 0x1398u, 0x0683u, 0x01C7u, 0x14DCu, 0x0FF2u, 0x1AE9u, 0x017Au, 0x1461u, 0x0F4Fu, 0x1A54u, 0x1D10u, 0x080Bu, 0x1325u, 0x063Eu,
+    0x1F59u, 0x0A42u, 0x116Cu, 0x0477u, 0x0333u, 0x1628u, 0x0D06u, 0x181Du, 0x038Eu, 0x1695u, 0x0DBBu, 0x18A0u, 0x1FE4u, 0x0AFFu, 0x11D1u, 0x04CAu,
+    0x02F4u, 0x17EFu, 0x0CC1u, 0x19DAu, 0x1E9Eu, 0x0B85u, 0x10ABu, 0x05B0u, 0x1E23u, 0x0B38u, 0x1016u, 0x050Du, 0x0249u, 0x1752u, 0x0C7Cu, 0x1967u,
+    0x1AB1u, 0x0FAAu, 0x1484u, 0x019Fu, 0x06DBu, 0x13C0u, 0x08EEu, 0x1DF5u, 0x0666u, 0x137Du, 0x0853u, 0x1D48u, 0x1A0Cu, 0x0F17u, 0x1439u, 0x0122u,
+    0x071Cu, 0x1207u, 0x0929u, 0x1C32u, 0x1B76u, 0x0E6Du, 0x1543u, 0x0058u, 0x1BCBu, 0x0ED0u, 0x15FEu, 0x00E5u, 0x07A1u, 0x12BAu, 0x0994u, 0x1C8Fu,
+    0x05E8u, 0x10F3u, 0x0BDDu, 0x1EC6u, 0x1982u, 0x0C99u, 0x17B7u, 0x02ACu, 0x193Fu, 0x0C24u, 0x170Au, 0x0211u, 0x0555u, 0x104Eu, 0x0B60u, 0x1E7Bu,
+    0x1845u, 0x0D5Eu, 0x1670u, 0x036Bu, 0x042Fu, 0x1134u, 0x0A1Au, 0x1F01u, 0x0492u, 0x1189u, 0x0AA7u, 0x1FBCu, 0x18F8u, 0x0DE3u, 0x16CDu, 0x03D6u,
+    0x1161u, 0x047Au, 0x1F54u, 0x0A4Fu, 0x0D0Bu, 0x1810u, 0x033Eu, 0x1625u, 0x0DB6u, 0x18ADu, 0x0383u, 0x1698u, 0x11DCu, 0x04C7u, 0x1FE9u, 0x0AF2u,
+    0x0CCCu, 0x19D7u, 0x02F9u, 0x17E2u, 0x10A6u, 0x05BDu, 0x1E93u, 0x0B88u, 0x101Bu, 0x0500u, 0x1E2Eu, 0x0B35u, 0x0C71u, 0x196Au, 0x0244u, 0x175Fu,
+    0x0E38u, 0x1B23u, 0x000Du, 0x1516u, 0x1252u, 0x0749u, 0x1C67u, 0x097Cu, 0x12EFu, 0x07F4u, 0x1CDAu, 0x09C1u, 0x0E85u, 0x1B9Eu, 0x00B0u, 0x15ABu,
+    0x1395u, 0x068Eu, 0x1DA0u, 0x08BBu, 0x0FFFu, 0x1AE4u, 0x01CAu, 0x14D1u, 0x0F42u, 0x1A59u, 0x0177u, 0x146Cu, 0x1328u, 0x0633u, 0x1D1Du, 0x0806u,
+    0x0BD0u, 0x1ECBu, 0x05E5u, 0x10FEu, 0x17BAu, 0x02A1u, 0x198Fu, 0x0C94u, 0x1707u, 0x021Cu, 0x1932u, 0x0C29u, 0x0B6Du, 0x1E76u, 0x0558u, 0x1043u,
+    0x167Du, 0x0366u, 0x1848u, 0x0D53u, 0x0A17u, 0x1F0Cu, 0x0422u, 0x1139u, 0x0AAAu, 0x1FB1u, 0x049Fu, 0x1184u, 0x16C0u, 0x03DBu, 0x18F5u, 0x0DEEu,
+    0x1489u, 0x0192u, 0x1ABCu, 0x0FA7u, 0x08E3u, 0x1DF8u, 0x06D6u, 0x13CDu, 0x085Eu, 0x1D45u, 0x066Bu, 0x1370u, 0x1434u, 0x012Fu, 0x1A01u, 0x0F1Au,
+    0x0924u, 0x1C3Fu, 0x0711u, 0x120Au, 0x154Eu, 0x0055u, 0x1B7Bu, 0x0E60u, 0x15F3u, 0x00E8u, 0x1BC6u, 0x0EDDu, 0x0999u, 0x1C82u, 0x07ACu, 0x12B7u,
+    0x0000u, 0x0111u, 0x0222u, 0x0333u, 0x0444u, 0x0555u, 0x0666u, 0x0777u, 0x0888u, 0x0999u, 0x0AAAu, 0x0BBBu, 0x0CCCu, 0x0DDDu, 0x0EEEu, 0x0FFFu,
+    0x1110u, 0x1001u, 0x1332u, 0x1223u, 0x1554u, 0x1445u, 0x1776u, 0x1667u, 0x1998u, 0x1889u, 0x1BBAu, 0x1AABu, 0x1DDCu, 0x1CCDu, 0x1FFEu, 0x1EEFu,
+    0x0623u, 0x0732u, 0x0401u, 0x0510u, 0x0267u, 0x0376u, 0x0045u, 0x0154u, 0x0EABu, 0x0FBAu, 0x0C89u, 0x0D98u, 0x0AEFu, 0x0BFEu, 0x08CDu, 0x09DCu,
+    0x1733u, 0x1622u, 0x1511u, 0x1400u, 0x1377u, 0x1266u, 0x1155u, 0x1044u, 0x1FBBu, 0x1EAAu, 0x1D99u, 0x1C88u, 0x1BFFu, 0x1AEEu, 0x19DDu, 0x18CCu,
+    0x0C46u, 0x0D57u, 0x0E64u, 0x0F75u, 0x0802u, 0x0913u, 0x0A20u, 0x0B31u, 0x04CEu, 0x05DFu, 0x06ECu, 0x07FDu, 0x008Au, 0x019Bu, 0x02A8u, 0x03B9u,
+    0x1D56u, 0x1C47u, 0x1F74u, 0x1E65u, 0x1912u, 0x1803u, 0x1B30u, 0x1A21u, 0x15DEu, 0x14CFu, 0x17FCu, 0x16EDu, 0x119Au, 0x108Bu, 0x13B8u, 0x12A9u,
+    0x0A65u, 0x0B74u, 0x0847u, 0x0956u, 0x0E21u, 0x0F30u, 0x0C03u, 0x0D12u, 0x02EDu, 0x03FCu, 0x00CFu, 0x01DEu, 0x06A9u, 0x07B8u, 0x048Bu, 0x059Au,
+    0x1B75u, 0x1A64u, 0x1957u, 0x1846u, 0x1F31u, 0x1E20u, 0x1D13u, 0x1C02u, 0x13FDu, 0x12ECu, 0x11DFu, 0x10CEu, 0x17B9u, 0x16A8u, 0x159Bu, 0x148Au,
+    0x188Cu, 0x199Du, 0x1AAEu, 0x1BBFu, 0x1CC8u, 0x1DD9u, 0x1EEAu, 0x1FFBu, 0x1004u, 0x1115u, 0x1226u, 0x1337u, 0x1440u, 0x1551u, 0x1662u, 0x1773u,
+    0x099Cu, 0x088Du, 0x0BBEu, 0x0AAFu, 0x0DD8u, 0x0CC9u, 0x0FFAu, 0x0EEBu, 0x0114u, 0x0005u, 0x0336u, 0x0227u, 0x0550u, 0x0441u, 0x0772u, 0x0663u,
+    0x1EAFu, 0x1FBEu, 0x1C8Du, 0x1D9Cu, 0x1AEBu, 0x1BFAu, 0x18C9u, 0x19D8u, 0x1627u, 0x1736u, 0x1405u, 0x1514u, 0x1263u, 0x1372u, 0x1041u, 0x1150u,
+    0x0FBFu, 0x0EAEu, 0x0D9Du, 0x0C8Cu, 0x0BFBu, 0x0AEAu, 0x09D9u, 0x08C8u, 0x0737u, 0x0626u, 0x0515u, 0x0404u, 0x0373u, 0x0262u, 0x0151u, 0x0040u,
+    0x14CAu, 0x15DBu, 0x16E8u, 0x17F9u, 0x108Eu, 0x119Fu, 0x12ACu, 0x13BDu, 0x1C42u, 0x1D53u, 0x1E60u, 0x1F71u, 0x1806u, 0x1917u, 0x1A24u, 0x1B35u,
+    0x05DAu, 0x04CBu, 0x07F8u, 0x06E9u, 0x019Eu, 0x008Fu, 0x03BCu, 0x02ADu, 0x0D52u, 0x0C43u, 0x0F70u, 0x0E61u, 0x0916u, 0x0807u, 0x0B34u, 0x0A25u,
+    0x12E9u, 0x13F8u, 0x10CBu, 0x11DAu, 0x16ADu, 0x17BCu, 0x148Fu, 0x159Eu, 0x1A61u, 0x1B70u, 0x1843u, 0x1952u, 0x1E25u, 0x1F34u, 0x1C07u, 0x1D16u,
+    0x03F9u, 0x02E8u, 0x01DBu, 0x00CAu, 0x07BDu, 0x06ACu, 0x059Fu, 0x048Eu, 0x0B71u, 0x0A60u, 0x0953u, 0x0842u, 0x0F35u, 0x0E24u, 0x0D17u, 0x0C06u,
+    0x0000u, 0x01DDu, 0x03BAu, 0x0267u, 0x0774u, 0x06A9u, 0x04CEu, 0x0513u, 0x0EE8u, 0x0F35u, 0x0D52u, 0x0C8Fu, 0x099Cu, 0x0841u, 0x0A26u, 0x0BFBu,
+    0x1DD0u, 0x1C0Du, 0x1E6Au, 0x1FB7u, 0x1AA4u, 0x1B79u, 0x191Eu, 0x18C3u, 0x1338u, 0x12E5u, 0x1082u, 0x115Fu, 0x144Cu, 0x1591u, 0x17F6u, 0x162Bu,
+    0x1FA3u, 0x1E7Eu, 0x1C19u, 0x1DC4u, 0x18D7u, 0x190Au, 0x1B6Du, 0x1AB0u, 0x114Bu, 0x1096u, 0x12F1u, 0x132Cu, 0x163Fu, 0x17E2u, 0x1585u, 0x1458u,
+    0x0273u, 0x03AEu, 0x01C9u, 0x0014u, 0x0507u, 0x04DAu, 0x06BDu, 0x0760u, 0x0C9Bu, 0x0D46u, 0x0F21u, 0x0EFCu, 0x0BEFu, 0x0A32u, 0x0855u, 0x0988u,
+    0x1B45u, 0x1A98u, 0x18FFu, 0x1922u, 0x1C31u, 0x1DECu, 0x1F8Bu, 0x1E56u, 0x15ADu, 0x1470u, 0x1617u, 0x17CAu, 0x12D9u, 0x1304u, 0x1163u, 0x10BEu,
+    0x0695u, 0x0748u, 0x052Fu, 0x04F2u, 0x01E1u, 0x003Cu, 0x025Bu, 0x0386u, 0x087Du, 0x09A0u, 0x0BC7u, 0x0A1Au, 0x0F09u, 0x0ED4u, 0x0CB3u, 0x0D6Eu,
+    0x04E6u, 0x053Bu, 0x075Cu, 0x0681u, 0x0392u, 0x024Fu, 0x0028u, 0x01F5u, 0x0A0Eu, 0x0BD3u, 0x09B4u, 0x0869u, 0x0D7Au, 0x0CA7u, 0x0EC0u, 0x0F1Du,
+    0x1936u, 0x18EBu, 0x1A8Cu, 0x1B51u, 0x1E42u, 0x1F9Fu, 0x1DF8u, 0x1C25u, 0x17DEu, 0x1603u, 0x1464u, 0x15B9u, 0x10AAu, 0x1177u, 0x1310u, 0x12CDu,
+    0x1289u, 0x1354u, 0x1133u, 0x10EEu, 0x15FDu, 0x1420u, 0x1647u, 0x179Au, 0x1C61u, 0x1DBCu, 0x1FDBu, 0x1E06u, 0x1B15u, 0x1AC8u, 0x18AFu, 0x1972u,
+    0x0F59u, 0x0E84u, 0x0CE3u, 0x0D3Eu, 0x082Du, 0x09F0u, 0x0B97u, 0x0A4Au, 0x01B1u, 0x006Cu, 0x020Bu, 0x03D6u, 0x06C5u, 0x0718u, 0x057Fu, 0x04A2u,
+    0x0D2Au, 0x0CF7u, 0x0E90u, 0x0F4Du, 0x0A5Eu, 0x0B83u, 0x09E4u, 0x0839u, 0x03C2u, 0x021Fu, 0x0078u, 0x01A5u, 0x04B6u, 0x056Bu, 0x070Cu, 0x06D1u,
+    0x10FAu, 0x1127u, 0x1340u, 0x129Du, 0x178Eu, 0x1653u, 0x1434u, 0x15E9u, 0x1E12u, 0x1FCFu, 0x1DA8u, 0x1C75u, 0x1966u, 0x18BBu, 0x1ADCu, 0x1B01u,
+    0x09CCu, 0x0811u, 0x0A76u, 0x0BABu, 0x0EB8u, 0x0F65u, 0x0D02u, 0x0CDFu, 0x0724u, 0x06F9u, 0x049Eu, 0x0543u, 0x0050u, 0x018Du, 0x03EAu, 0x0237u,
+    0x141Cu, 0x15C1u, 0x17A6u, 0x167Bu, 0x1368u, 0x12B5u, 0x10D2u, 0x110Fu, 0x1AF4u, 0x1B29u, 0x194Eu, 0x1893u, 0x1D80u, 0x1C5Du, 0x1E3Au, 0x1FE7u,
+    0x166Fu, 0x17B2u, 0x15D5u, 0x1408u, 0x111Bu, 0x10C6u, 0x12A1u, 0x137Cu, 0x1887u, 0x195Au, 0x1B3Du, 0x1AE0u, 0x1FF3u, 0x1E2Eu, 0x1C49u, 0x1D94u,
+    0x0BBFu, 0x0A62u, 0x0805u, 0x09D8u, 0x0CCBu, 0x0D16u, 0x0F71u, 0x0EACu, 0x0557u, 0x048Au, 0x06EDu, 0x0730u, 0x0223u, 0x03FEu, 0x0199u, 0x0044u,
+    0x0000u, 0x084Du, 0x109Au, 0x18D7u, 0x0537u, 0x0D7Au, 0x15ADu, 0x1DE0u, 0x0A6Eu, 0x0223u, 0x1AF4u, 0x12B9u, 0x0F59u, 0x0714u, 0x1FC3u, 0x178Eu,
+    0x14DCu, 0x1C91u, 0x0446u, 0x0C0Bu, 0x11EBu, 0x19A6u, 0x0171u, 0x093Cu, 0x1EB2u, 0x16FFu, 0x0E28u, 0x0665u, 0x1B85u, 0x13C8u, 0x0B1Fu, 0x0352u,
+    0x0DBBu, 0x05F6u, 0x1D21u, 0x156Cu, 0x088Cu, 0x00C1u, 0x1816u, 0x105Bu, 0x07D5u, 0x0F98u, 0x174Fu, 0x1F02u, 0x02E2u, 0x0AAFu, 0x1278u, 0x1A35u,
+    0x1967u, 0x112Au, 0x09FDu, 0x01B0u, 0x1C50u, 0x141Du, 0x0CCAu, 0x0487u, 0x1309u, 0x1B44u, 0x0393u, 0x0BDEu, 0x163Eu, 0x1E73u, 0x06A4u, 0x0EE9u,
+    0x1B76u, 0x133Bu, 0x0BECu, 0x03A1u, 0x1E41u, 0x160Cu, 0x0EDBu, 0x0696u, 0x1118u, 0x1955u, 0x0182u, 0x09CFu, 0x142Fu, 0x1C62u, 0x04B5u, 0x0CF8u,
+    0x0FAAu, 0x07E7u, 0x1F30u, 0x177Du, 0x0A9Du, 0x02D0u, 0x1A07u, 0x124Au, 0x05C4u, 0x0D89u, 0x155Eu, 0x1D13u, 0x00F3u, 0x08BEu, 0x1069u, 0x1824u,
+    0x16CDu, 0x1E80u, 0x0657u, 0x0E1Au, 0x13FAu, 0x1BB7u, 0x0360u, 0x0B2Du, 0x1CA3u, 0x14EEu, 0x0C39u, 0x0474u, 0x1994u, 0x11D9u, 0x090Eu, 0x0143u,
+    0x0211u, 0x0A5Cu, 0x128Bu, 0x1AC6u, 0x0726u, 0x0F6Bu, 0x17BCu, 0x1FF1u, 0x087Fu, 0x0032u, 0x18E5u, 0x10A8u, 0x0D48u, 0x0505u, 0x1DD2u, 0x159Fu,
+    0x12EFu, 0x1AA2u, 0x0275u, 0x0A38u, 0x17D8u, 0x1F95u, 0x0742u, 0x0F0Fu, 0x1881u, 0x10CCu, 0x081Bu, 0x0056u, 0x1DB6u, 0x15FBu, 0x0D2Cu, 0x0561u,
+    0x0633u, 0x0E7Eu, 0x16A9u, 0x1EE4u, 0x0304u, 0x0B49u, 0x139Eu, 0x1BD3u, 0x0C5Du, 0x0410u, 0x1CC7u, 0x148Au, 0x096Au, 0x0127u, 0x19F0u, 0x11BDu,
+    0x1F54u, 0x1719u, 0x0FCEu, 0x0783u, 0x1A63u, 0x122Eu, 0x0AF9u, 0x02B4u, 0x153Au, 0x1D77u, 0x05A0u, 0x0DEDu, 0x100Du, 0x1840u, 0x0097u, 0x08DAu,
+    0x0B88u, 0x03C5u, 0x1B12u, 0x135Fu, 0x0EBFu, 0x06F2u, 0x1E25u, 0x1668u, 0x01E6u, 0x09ABu, 0x117Cu, 0x1931u, 0x04D1u, 0x0C9Cu, 0x144Bu, 0x1C06u,
+    0x0999u, 0x01D4u, 0x1903u, 0x114Eu, 0x0CAEu, 0x04E3u, 0x1C34u, 0x1479u, 0x03F7u, 0x0BBAu, 0x136Du, 0x1B20u, 0x06C0u, 0x0E8Du, 0x165Au, 0x1E17u,
+    0x1D45u, 0x1508u, 0x0DDFu, 0x0592u, 0x1872u, 0x103Fu, 0x08E8u, 0x00A5u, 0x172Bu, 0x1F66u, 0x07B1u, 0x0FFCu, 0x121Cu, 0x1A51u, 0x0286u, 0x0ACBu,
+    0x0422u, 0x0C6Fu, 0x14B8u, 0x1CF5u, 0x0115u, 0x0958u, 0x118Fu, 0x19C2u, 0x0E4Cu, 0x0601u, 0x1ED6u, 0x169Bu, 0x0B7Bu, 0x0336u, 0x1BE1u, 0x13ACu,
+    0x10FEu, 0x18B3u, 0x0064u, 0x0829u, 0x15C9u, 0x1D84u, 0x0553u, 0x0D1Eu, 0x1A90u, 0x12DDu, 0x0A0Au, 0x0247u, 0x1FA7u, 0x17EAu, 0x0F3Du, 0x0770u,
+    0x0000u, 0x0784u, 0x0F08u, 0x088Cu, 0x1E10u, 0x1994u, 0x1118u, 0x169Cu, 0x1823u, 0x1FA7u, 0x172Bu, 0x10AFu, 0x0633u, 0x01B7u, 0x093Bu, 0x0EBFu,
+    0x1445u, 0x13C1u, 0x1B4Du, 0x1CC9u, 0x0A55u, 0x0DD1u, 0x055Du, 0x02D9u, 0x0C66u, 0x0BE2u, 0x036Eu, 0x04EAu, 0x1276u, 0x15F2u, 0x1D7Eu, 0x1AFAu,
+    0x0C89u, 0x0B0Du, 0x0381u, 0x0405u, 0x1299u, 0x151Du, 0x1D91u, 0x1A15u, 0x14AAu, 0x132Eu, 0x1BA2u, 0x1C26u, 0x0ABAu, 0x0D3Eu, 0x05B2u, 0x0236u,
+    0x18CCu, 0x1F48u, 0x17C4u, 0x1040u, 0x06DCu, 0x0158u, 0x09D4u, 0x0E50u, 0x00EFu, 0x076Bu, 0x0FE7u, 0x0863u, 0x1EFFu, 0x197Bu, 0x11F7u, 0x1673u,
+    0x1912u, 0x1E96u, 0x161Au, 0x119Eu, 0x0702u, 0x0086u, 0x080Au, 0x0F8Eu, 0x0131u, 0x06B5u, 0x0E39u, 0x09BDu, 0x1F21u, 0x18A5u, 0x1029u, 0x17ADu,
+    0x0D57u, 0x0AD3u, 0x025Fu, 0x05DBu, 0x1347u, 0x14C3u, 0x1C4Fu, 0x1BCBu, 0x1574u, 0x12F0u, 0x1A7Cu, 0x1DF8u, 0x0B64u, 0x0CE0u, 0x046Cu, 0x03E8u,
+    0x159Bu, 0x121Fu, 0x1A93u, 0x1D17u, 0x0B8Bu, 0x0C0Fu, 0x0483u, 0x0307u, 0x0DB8u, 0x0A3Cu, 0x02B0u, 0x0534u, 0x13A8u, 0x142Cu, 0x1CA0u, 0x1B24u,
+    0x01DEu, 0x065Au, 0x0ED6u, 0x0952u, 0x1FCEu, 0x184Au, 0x10C6u, 0x1742u, 0x19FDu, 0x1E79u, 0x16F5u, 0x1171u, 0x07EDu, 0x0069u, 0x08E5u, 0x0F61u,
+    0x1627u, 0x11A3u, 0x192Fu, 0x1EABu, 0x0837u, 0x0FB3u, 0x073Fu, 0x00BBu, 0x0E04u, 0x0980u, 0x010Cu, 0x0688u, 0x1014u, 0x1790u, 0x1F1Cu, 0x1898u,
+    0x0262u, 0x05E6u, 0x0D6Au, 0x0AEEu, 0x1C72u, 0x1BF6u, 0x137Au, 0x14FEu, 0x1A41u, 0x1DC5u, 0x1549u, 0x12CDu, 0x0451u, 0x03D5u, 0x0B59u, 0x0CDDu,
+    0x1AAEu, 0x1D2Au, 0x15A6u, 0x1222u, 0x04BEu, 0x033Au, 0x0BB6u, 0x0C32u, 0x028Du, 0x0509u, 0x0D85u, 0x0A01u, 0x1C9Du, 0x1B19u, 0x1395u, 0x1411u,
+    0x0EEBu, 0x096Fu, 0x01E3u, 0x0667u, 0x10FBu, 0x177Fu, 0x1FF3u, 0x1877u, 0x16C8u, 0x114Cu, 0x19C0u, 0x1E44u, 0x08D8u, 0x0F5Cu, 0x07D0u, 0x0054u,
+    0x0F35u, 0x08B1u, 0x003Du, 0x07B9u, 0x1125u, 0x16A1u, 0x1E2Du, 0x19A9u, 0x1716u, 0x1092u, 0x181Eu, 0x1F9Au, 0x0906u, 0x0E82u, 0x060Eu, 0x018Au,
+    0x1B70u, 0x1CF4u, 0x1478u, 0x13FCu, 0x0560u, 0x02E4u, 0x0A68u, 0x0DECu, 0x0353u, 0x04D7u, 0x0C5Bu, 0x0BDFu, 0x1D43u, 0x1AC7u, 0x124Bu, 0x15CFu,
+    0x03BCu, 0x0438u, 0x0CB4u, 0x0B30u, 0x1DACu, 0x1A28u, 0x12A4u, 0x1520u, 0x1B9Fu, 0x1C1Bu, 0x1497u, 0x1313u, 0x058Fu, 0x020Bu, 0x0A87u, 0x0D03u,
+    0x17F9u, 0x107Du, 0x18F1u, 0x1F75u, 0x09E9u, 0x0E6Du, 0x06E1u, 0x0165u, 0x0FDAu, 0x085Eu, 0x00D2u, 0x0756u, 0x11CAu, 0x164Eu, 0x1EC2u, 0x1946u
+};
+#endif
+
 const  CRC_MODEL_16  CRC_ModelCRC16_8048_ref = {
     0x8048u,
     0x0000u,
     DEF_YES,
     0x0000u,
-   &CRC_TblCRC16_8048_ref[0]
+   &CRC_TblCRC16_8048_ref[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+   &CRC_TblSliceCRC16_8048_ref[0]
+#else
+    (const CPU_INT16U *)0
+#endif
 };
 #endif
 
@@ -249,12 +1077,151 @@ const  CPU_INT32U  CRC_TblCRC32[256] = {
     0x89B8FD09u, 0x8D79E0BEu, 0x803AC667u, 0x84FBDBD0u, 0x9ABC8BD5u, 0x9E7D9662u, 0x933EB0BBu, 0x97FFAD0Cu, 0xAFB010B1u, 0xAB710D06u, 0xA6322BDFu, 0xA2F33668u, 0xBCB4666Du, 0xB8757BDAu, 0xB5365D03u, 0xB1F740B4u,
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT32U  CRC_TblSliceCRC32[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x00000000u, 0x04C11DB7u, 0x09823B6Eu, 0x0D4326D9u, 0x130476DCu, 0x17C56B6Bu, 0x1A864DB2u, 0x1E475005u, 0x2608EDB8u, 0x22C9F00Fu, 0x2F8AD6D6u, 0x2B4BCB61u, 0x350C9B64u, 0x31CD86D3u, 0x3C8EA00Au, 0x384FBDBDu,
+    0x4C11DB70u, 0x48D0C6C7u, 0x4593E01Eu, 0x4152FDA9u, 0x5F15ADACu, 0x5BD4B01Bu, 0x569796C2u, 0x52568B75u, 0x6A1936C8u, 0x6ED82B7Fu, 0x639B0DA6u, 0x675A1011u, 0x791D4014u, 0x7DDC5DA3u, 0x709F7B7Au, 0x745E66CDu,
+    0x9823B6E0u, 0x9CE2AB57u, 0x91A18D8Eu, 0x95609039u, 0x8B27C03Cu, 0x8FE6DD8Bu, 0x82A5FB52u, 0x8664E6E5u, 0xBE2B5B58u, 0xBAEA46EFu, 0xB7A96036u, 0xB3687D81u, 0xAD2F2D84u, 0xA9EE3033u, 0xA4AD16EAu, 0xA06C0B5Du,
+    0xD4326D90u, 0xD0F37027u, 0xDDB056FEu, 0xD9714B49u, 0xC7361B4Cu, 0xC3F706FBu, 0xCEB42022u, 0xCA753D95u, 0xF23A8028u, 0xF6FB9D9Fu, 0xFBB8BB46u, 0xFF79A6F1u, 0xE13EF6F4u, 0xE5FFEB43u, 0xE8BCCD9Au, 0xEC7DD02Du,
+    0x34867077u, 0x30476DC0u, 0x3D044B19u, 0x39C556AEu, 0x278206ABu, 0x23431B1Cu, 0x2E003DC5u, 0x2AC12072u, 0x128E9DCFu, 0x164F8078u, 0x1B0CA6A1u, 0x1FCDBB16u, 0x018AEB13u, 0x054BF6A4u, 0x0808D07Du, 0x0CC9CDCAu,
+    0x7897AB07u, 0x7C56B6B0u, 0x71159069u, 0x75D48DDEu, 0x6B93DDDBu, 0x6F52C06Cu, 0x6211E6B5u, 0x66D0FB02u, 0x5E9F46BFu, 0x5A5E5B08u, 0x571D7DD1u, 0x53DC6066u, 0x4D9B3063u, 0x495A2DD4u, 0x44190B0Du, 0x40D816BAu,
+    0xACA5C697u, 0xA864DB20u, 0xA527FDF9u, 0xA1E6E04Eu, 0xBFA1B04Bu, 0xBB60ADFCu, 0xB6238B25u, 0xB2E29692u, 0x8AAD2B2Fu, 0x8E6C3698u, 0x832F1041u, 0x87EE0DF6u, 0x99A95DF3u, 0x9D684044u, 0x902B669Du, 0x94EA7B2Au,
+    0xE0B41DE7u, 0xE4750050u, 0xE9362689u, 0xEDF73B3Eu, 0xF3B06B3Bu, 0xF771768Cu, 0xFA325055u, 0xFEF34DE2u, 0xC6BCF05Fu, 0xC27DEDE8u, 0xCF3ECB31u, 0xCBFFD686u, 0xD5B88683u, 0xD1799B34u, 0xDC3ABDEDu, 0xD8FBA05Au,
+    0x690CE0EEu, 0x6DCDFD59u, 0x608EDB80u, 0x644FC637u, 0x7A089632u, 0x7EC98B85u, 0x738AAD5Cu, 0x774BB0EBu, 0x4F040D56u, 0x4BC510E1u, 0x46863638u, 0x42472B8Fu, 0x5C007B8Au, 0x58C1663Du, 0x558240E4u, 0x51435D53u,
+    0x251D3B9Eu, 0x21DC2629u, 0x2C9F00F0u, 0x285E1D47u, 0x36194D42u, 0x32D850F5u, 0x3F9B762Cu, 0x3B5A6B9Bu, 0x0315D626u, 0x07D4CB91u, 0x0A97ED48u, 0x0E56F0FFu, 0x1011A0FAu, 0x14D0BD4Du, 0x19939B94u, 0x1D528623u,
+    0xF12F560Eu, 0xF5EE4BB9u, 0xF8AD6D60u, 0xFC6C70D7u, 0xE22B20D2u, 0xE6EA3D65u, 0xEBA91BBCu, 0xEF68060Bu, 0xD727BBB6u, 0xD3E6A601u, 0xDEA580D8u, 0xDA649D6Fu, 0xC423CD6Au, 0xC0E2D0DDu, 0xCDA1F604u, 0xC960EBB3u,
+    0xBD3E8D7Eu, 0xB9FF90C9u, 0xB4BCB610u, 0xB07DABA7u, 0xAE3AFBA2u, 0xAAFBE615u, 0xA7B8C0CCu, 0xA379DD7Bu, 0x9B3660C6u, 0x9FF77D71u, 0x92B45BA8u, 0x9675461Fu, 0x8832161Au, 0x8CF30BADu, 0x81B02D74u, 0x857130C3u,
+    0x5D8A9099u, 0x594B8D2Eu, 0x5408ABF7u, 0x50C9B640u, 0x4E8EE645u, 0x4A4FFBF2u, 0x470CDD2Bu, 0x43CDC09Cu, 0x7B827D21u, 0x7F436096u, 0x7200464Fu, 0x76C15BF8u, 0x68860BFDu, 0x6C47164Au, 0x61043093u, 0x65C52D24u,
+    0x119B4BE9u, 0x155A565Eu, 0x18197087u, 0x1CD86D30u, 0x029F3D35u, 0x065E2082u, 0x0B1D065Bu, 0x0FDC1BECu, 0x3793A651u, 0x3352BBE6u, 0x3E119D3Fu, 0x3AD08088u, 0x2497D08Du, 0x2056CD3Au, 0x2D15EBE3u, 0x29D4F654u,
+    0xC5A92679u, 0xC1683BCEu, 0xCC2B1D17u, 0xC8EA00A0u, 0xD6AD50A5u, 0xD26C4D12u, 0xDF2F6BCBu, 0xDBEE767Cu, 0xE3A1CBC1u, 0xE760D676u, 0xEA23F0AFu, 0xEEE2ED18u, 0xF0A5BD1Du, 0xF464A0AAu, 0xF9278673u, 0xFDE69BC4u,
+    0x89B8FD09u, 0x8D79E0BEu, 0x803AC667u, 0x84FBDBD0u, 0x9ABC8BD5u, 0x9E7D9662u, 0x933EB0BBu, 0x97FFAD0Cu, 0xAFB010B1u, 0xAB710D06u, 0xA6322BDFu, 0xA2F33668u, 0xBCB4666Du, 0xB8757BDAu, 0xB5365D03u, 0xB1F740B4u,
+    0x00000000u, 0xD219C1DCu, 0xA0F29E0Fu, 0x72EB5FD3u, 0x452421A9u, 0x973DE075u, 0xE5D6BFA6u, 0x37CF7E7Au, 0x8A484352u, 0x5851828Eu, 0x2ABADD5Du, 0xF8A31C81u, 0xCF6C62FBu, 0x1D75A327u, 0x6F9EFCF4u, 0xBD873D28u,
+    0x10519B13u, 0xC2485ACFu, 0xB0A3051Cu, 0x62BAC4C0u, 0x5575BABAu, 0x876C7B66u, 0xF58724B5u, 0x279EE569u, 0x9A19D841u, 0x4800199Du, 0x3AEB464Eu, 0xE8F28792u, 0xDF3DF9E8u, 0x0D243834u, 0x7FCF67E7u, 0xADD6A63Bu,
+    0x20A33626u, 0xF2BAF7FAu, 0x8051A829u, 0x524869F5u, 0x6587178Fu, 0xB79ED653u, 0xC5758980u, 0x176C485Cu, 0xAAEB7574u, 0x78F2B4A8u, 0x0A19EB7Bu, 0xD8002AA7u, 0xEFCF54DDu, 0x3DD69501u, 0x4F3DCAD2u, 0x9D240B0Eu,
+    0x30F2AD35u, 0xE2EB6CE9u, 0x9000333Au, 0x4219F2E6u, 0x75D68C9Cu, 0xA7CF4D40u, 0xD5241293u, 0x073DD34Fu, 0xBABAEE67u, 0x68A32FBBu, 0x1A487068u, 0xC851B1B4u, 0xFF9ECFCEu, 0x2D870E12u, 0x5F6C51C1u, 0x8D75901Du,
+    0x41466C4Cu, 0x935FAD90u, 0xE1B4F243u, 0x33AD339Fu, 0x04624DE5u, 0xD67B8C39u, 0xA490D3EAu, 0x76891236u, 0xCB0E2F1Eu, 0x1917EEC2u, 0x6BFCB111u, 0xB9E570CDu, 0x8E2A0EB7u, 0x5C33CF6Bu, 0x2ED890B8u, 0xFCC15164u,
+    0x5117F75Fu, 0x830E3683u, 0xF1E56950u, 0x23FCA88Cu, 0x1433D6F6u, 0xC62A172Au, 0xB4C148F9u, 0x66D88925u, 0xDB5FB40Du, 0x094675D1u, 0x7BAD2A02u, 0xA9B4EBDEu, 0x9E7B95A4u, 0x4C625478u, 0x3E890BABu, 0xEC90CA77u,
+    0x61E55A6Au, 0xB3FC9BB6u, 0xC117C465u, 0x130E05B9u, 0x24C17BC3u, 0xF6D8BA1Fu, 0x8433E5CCu, 0x562A2410u, 0xEBAD1938u, 0x39B4D8E4u, 0x4B5F8737u, 0x994646EBu, 0xAE893891u, 0x7C90F94Du, 0x0E7BA69Eu, 0xDC626742u,
+    0x71B4C179u, 0xA3AD00A5u, 0xD1465F76u, 0x035F9EAAu, 0x3490E0D0u, 0xE689210Cu, 0x94627EDFu, 0x467BBF03u, 0xFBFC822Bu, 0x29E543F7u, 0x5B0E1C24u, 0x8917DDF8u, 0xBED8A382u, 0x6CC1625Eu, 0x1E2A3D8Du, 0xCC33FC51u,
+    0x828CD898u, 0x50951944u, 0x227E4697u, 0xF067874Bu, 0xC7A8F931u, 0x15B138EDu, 0x675A673Eu, 0xB543A6E2u, 0x08C49BCAu, 0xDADD5A16u, 0xA83605C5u, 0x7A2FC419u, 0x4DE0BA63u, 0x9FF97BBFu, 0xED12246Cu, 0x3F0BE5B0u,
+    0x92DD438Bu, 0x40C48257u, 0x322FDD84u, 0xE0361C58u, 0xD7F96222u, 0x05E0A3FEu, 0x770BFC2Du, 0xA5123DF1u, 0x189500D9u, 0xCA8CC105u, 0xB8679ED6u, 0x6A7E5F0Au, 0x5DB12170u, 0x8FA8E0ACu, 0xFD43BF7Fu, 0x2F5A7EA3u,
+    0xA22FEEBEu, 0x70362F62u, 0x02DD70B1u, 0xD0C4B16Du, 0xE70BCF17u, 0x35120ECBu, 0x47F95118u, 0x95E090C4u, 0x2867ADECu, 0xFA7E6C30u, 0x889533E3u, 0x5A8CF23Fu, 0x6D438C45u, 0xBF5A4D99u, 0xCDB1124Au, 0x1FA8D396u,
+    0xB27E75ADu, 0x6067B471u, 0x128CEBA2u, 0xC0952A7Eu, 0xF75A5404u, 0x254395D8u, 0x57A8CA0Bu, 0x85B10BD7u, 0x383636FFu, 0xEA2FF723u, 0x98C4A8F0u, 0x4ADD692Cu, 0x7D121756u, 0xAF0BD68Au, 0xDDE08959u, 0x0FF94885u,
+    0xC3CAB4D4u, 0x11D37508u, 0x63382ADBu, 0xB121EB07u, 0x86EE957Du, 0x54F754A1u, 0x261C0B72u, 0xF405CAAEu, 0x4982F786u, 0x9B9B365Au, 0xE9706989u, 0x3B69A855u, 0x0CA6D62Fu, 0xDEBF17F3u, 0xAC544820u, 0x7E4D89FCu,
+    0xD39B2FC7u, 0x0182EE1Bu, 0x7369B1C8u, 0xA1707014u, 0x96BF0E6Eu, 0x44A6CFB2u, 0x364D9061u, 0xE45451BDu, 0x59D36C95u, 0x8BCAAD49u, 0xF921F29Au, 0x2B383346u, 0x1CF74D3Cu, 0xCEEE8CE0u, 0xBC05D333u, 0x6E1C12EFu,
+    0xE36982F2u, 0x3170432Eu, 0x439B1CFDu, 0x9182DD21u, 0xA64DA35Bu, 0x74546287u, 0x06BF3D54u, 0xD4A6FC88u, 0x6921C1A0u, 0xBB38007Cu, 0xC9D35FAFu, 0x1BCA9E73u, 0x2C05E009u, 0xFE1C21D5u, 0x8CF77E06u, 0x5EEEBFDAu,
+    0xF33819E1u, 0x2121D83Du, 0x53CA87EEu, 0x81D34632u, 0xB61C3848u, 0x6405F994u, 0x16EEA647u, 0xC4F7679Bu, 0x79705AB3u, 0xAB699B6Fu, 0xD982C4BCu, 0x0B9B0560u, 0x3C547B1Au, 0xEE4DBAC6u, 0x9CA6E515u, 0x4EBF24C9u,
+    0x00000000u, 0x01D8AC87u, 0x03B1590Eu, 0x0269F589u, 0x0762B21Cu, 0x06BA1E9Bu, 0x04D3EB12u, 0x050B4795u, 0x0EC56438u, 0x0F1DC8BFu, 0x0D743D36u, 0x0CAC91B1u, 0x09A7D624u, 0x087F7AA3u, 0x0A168F2Au, 0x0BCE23ADu,
+    0x1D8AC870u, 0x1C5264F7u, 0x1E3B917Eu, 0x1FE33DF9u, 0x1AE87A6Cu, 0x1B30D6EBu, 0x19592362u, 0x18818FE5u, 0x134FAC48u, 0x129700CFu, 0x10FEF546u, 0x112659C1u, 0x142D1E54u, 0x15F5B2D3u, 0x179C475Au, 0x1644EBDDu,
+    0x3B1590E0u, 0x3ACD3C67u, 0x38A4C9EEu, 0x397C6569u, 0x3C7722FCu, 0x3DAF8E7Bu, 0x3FC67BF2u, 0x3E1ED775u, 0x35D0F4D8u, 0x3408585Fu, 0x3661ADD6u, 0x37B90151u, 0x32B246C4u, 0x336AEA43u, 0x31031FCAu, 0x30DBB34Du,
+    0x269F5890u, 0x2747F417u, 0x252E019Eu, 0x24F6AD19u, 0x21FDEA8Cu, 0x2025460Bu, 0x224CB382u, 0x23941F05u, 0x285A3CA8u, 0x2982902Fu, 0x2BEB65A6u, 0x2A33C921u, 0x2F388EB4u, 0x2EE02233u, 0x2C89D7BAu, 0x2D517B3Du,
+    0x762B21C0u, 0x77F38D47u, 0x759A78CEu, 0x7442D449u, 0x714993DCu, 0x70913F5Bu, 0x72F8CAD2u, 0x73206655u, 0x78EE45F8u, 0x7936E97Fu, 0x7B5F1CF6u, 0x7A87B071u, 0x7F8CF7E4u, 0x7E545B63u, 0x7C3DAEEAu, 0x7DE5026Du,
+    0x6BA1E9B0u, 0x6A794537u, 0x6810B0BEu, 0x69C81C39u, 0x6CC35BACu, 0x6D1BF72Bu, 0x6F7202A2u, 0x6EAAAE25u, 0x65648D88u, 0x64BC210Fu, 0x66D5D486u, 0x670D7801u, 0x62063F94u, 0x63DE9313u, 0x61B7669Au, 0x606FCA1Du,
+    0x4D3EB120u, 0x4CE61DA7u, 0x4E8FE82Eu, 0x4F5744A9u, 0x4A5C033Cu, 0x4B84AFBBu, 0x49ED5A32u, 0x4835F6B5u, 0x43FBD518u, 0x4223799Fu, 0x404A8C16u, 0x41922091u, 0x44996704u, 0x4541CB83u, 0x47283E0Au, 0x46F0928Du,
+    0x50B47950u, 0x516CD5D7u, 0x5305205Eu, 0x52DD8CD9u, 0x57D6CB4Cu, 0x560E67CBu, 0x54679242u, 0x55BF3EC5u, 0x5E711D68u, 0x5FA9B1EFu, 0x5DC04466u, 0x5C18E8E1u, 0x5913AF74u, 0x58CB03F3u, 0x5AA2F67Au, 0x5B7A5AFDu,
+    0xEC564380u, 0xED8EEF07u, 0xEFE71A8Eu, 0xEE3FB609u, 0xEB34F19Cu, 0xEAEC5D1Bu, 0xE885A892u, 0xE95D0415u, 0xE29327B8u, 0xE34B8B3Fu, 0xE1227EB6u, 0xE0FAD231u, 0xE5F195A4u, 0xE4293923u, 0xE640CCAAu, 0xE798602Du,
+    0xF1DC8BF0u, 0xF0042777u, 0xF26DD2FEu, 0xF3B57E79u, 0xF6BE39ECu, 0xF766956Bu, 0xF50F60E2u, 0xF4D7CC65u, 0xFF19EFC8u, 0xFEC1434Fu, 0xFCA8B6C6u, 0xFD701A41u, 0xF87B5DD4u, 0xF9A3F153u, 0xFBCA04DAu, 0xFA12A85Du,
+    0xD743D360u, 0xD69B7FE7u, 0xD4F28A6Eu, 0xD52A26E9u, 0xD021617Cu, 0xD1F9CDFBu, 0xD3903872u, 0xD24894F5u, 0xD986B758u, 0xD85E1BDFu, 0xDA37EE56u, 0xDBEF42D1u, 0xDEE40544u, 0xDF3CA9C3u, 0xDD555C4Au, 0xDC8DF0CDu,
+    0xCAC91B10u, 0xCB11B797u, 0xC978421Eu, 0xC8A0EE99u, 0xCDABA90Cu, 0xCC73058Bu, 0xCE1AF002u, 0xCFC25C85u, 0xC40C7F28u, 0xC5D4D3AFu, 0xC7BD2626u, 0xC6658AA1u, 0xC36ECD34u, 0xC2B661B3u, 0xC0DF943Au, 0xC10738BDu,
+    0x9A7D6240u, 0x9BA5CEC7u, 0x99CC3B4Eu, 0x981497C9u, 0x9D1FD05Cu, 0x9CC77CDBu, 0x9EAE8952u, 0x9F7625D5u, 0x94B80678u, 0x9560AAFFu, 0x97095F76u, 0x96D1F3F1u, 0x93DAB464u, 0x920218E3u, 0x906BED6Au, 0x91B341EDu,
+    0x87F7AA30u, 0x862F06B7u, 0x8446F33Eu, 0x859E5FB9u, 0x8095182Cu, 0x814DB4ABu, 0x83244122u, 0x82FCEDA5u, 0x8932CE08u, 0x88EA628Fu, 0x8A839706u, 0x8B5B3B81u, 0x8E507C14u, 0x8F88D093u, 0x8DE1251Au, 0x8C39899Du,
+    0xA168F2A0u, 0xA0B05E27u, 0xA2D9ABAEu, 0xA3010729u, 0xA60A40BCu, 0xA7D2EC3Bu, 0xA5BB19B2u, 0xA463B535u, 0xAFAD9698u, 0xAE753A1Fu, 0xAC1CCF96u, 0xADC46311u, 0xA8CF2484u, 0xA9178803u, 0xAB7E7D8Au, 0xAAA6D10Du,
+    0xBCE23AD0u, 0xBD3A9657u, 0xBF5363DEu, 0xBE8BCF59u, 0xBB8088CCu, 0xBA58244Bu, 0xB831D1C2u, 0xB9E97D45u, 0xB2275EE8u, 0xB3FFF26Fu, 0xB19607E6u, 0xB04EAB61u, 0xB545ECF4u, 0xB49D4073u, 0xB6F4B5FAu, 0xB72C197Du,
+    0x00000000u, 0xDC6D9AB7u, 0xBC1A28D9u, 0x6077B26Eu, 0x7CF54C05u, 0xA098D6B2u, 0xC0EF64DCu, 0x1C82FE6Bu, 0xF9EA980Au, 0x258702BDu, 0x45F0B0D3u, 0x999D2A64u, 0x851FD40Fu, 0x59724EB8u, 0x3905FCD6u, 0xE5686661u,
+    0xF7142DA3u, 0x2B79B714u, 0x4B0E057Au, 0x97639FCDu, 0x8BE161A6u, 0x578CFB11u, 0x37FB497Fu, 0xEB96D3C8u, 0x0EFEB5A9u, 0xD2932F1Eu, 0xB2E49D70u, 0x6E8907C7u, 0x720BF9ACu, 0xAE66631Bu, 0xCE11D175u, 0x127C4BC2u,
+    0xEAE946F1u, 0x3684DC46u, 0x56F36E28u, 0x8A9EF49Fu, 0x961C0AF4u, 0x4A719043u, 0x2A06222Du, 0xF66BB89Au, 0x1303DEFBu, 0xCF6E444Cu, 0xAF19F622u, 0x73746C95u, 0x6FF692FEu, 0xB39B0849u, 0xD3ECBA27u, 0x0F812090u,
+    0x1DFD6B52u, 0xC190F1E5u, 0xA1E7438Bu, 0x7D8AD93Cu, 0x61082757u, 0xBD65BDE0u, 0xDD120F8Eu, 0x017F9539u, 0xE417F358u, 0x387A69EFu, 0x580DDB81u, 0x84604136u, 0x98E2BF5Du, 0x448F25EAu, 0x24F89784u, 0xF8950D33u,
+    0xD1139055u, 0x0D7E0AE2u, 0x6D09B88Cu, 0xB164223Bu, 0xADE6DC50u, 0x718B46E7u, 0x11FCF489u, 0xCD916E3Eu, 0x28F9085Fu, 0xF49492E8u, 0x94E32086u, 0x488EBA31u, 0x540C445Au, 0x8861DEEDu, 0xE8166C83u, 0x347BF634u,
+    0x2607BDF6u, 0xFA6A2741u, 0x9A1D952Fu, 0x46700F98u, 0x5AF2F1F3u, 0x869F6B44u, 0xE6E8D92Au, 0x3A85439Du, 0xDFED25FCu, 0x0380BF4Bu, 0x63F70D25u, 0xBF9A9792u, 0xA31869F9u, 0x7F75F34Eu, 0x1F024120u, 0xC36FDB97u,
+    0x3BFAD6A4u, 0xE7974C13u, 0x87E0FE7Du, 0x5B8D64CAu, 0x470F9AA1u, 0x9B620016u, 0xFB15B278u, 0x277828CFu, 0xC2104EAEu, 0x1E7DD419u, 0x7E0A6677u, 0xA267FCC0u, 0xBEE502ABu, 0x6288981Cu, 0x02FF2A72u, 0xDE92B0C5u,
+    0xCCEEFB07u, 0x108361B0u, 0x70F4D3DEu, 0xAC994969u, 0xB01BB702u, 0x6C762DB5u, 0x0C019FDBu, 0xD06C056Cu, 0x3504630Du, 0xE969F9BAu, 0x891E4BD4u, 0x5573D163u, 0x49F12F08u, 0x959CB5BFu, 0xF5EB07D1u, 0x29869D66u,
+    0xA6E63D1Du, 0x7A8BA7AAu, 0x1AFC15C4u, 0xC6918F73u, 0xDA137118u, 0x067EEBAFu, 0x660959C1u, 0xBA64C376u, 0x5F0CA517u, 0x83613FA0u, 0xE3168DCEu, 0x3F7B1779u, 0x23F9E912u, 0xFF9473A5u, 0x9FE3C1CBu, 0x438E5B7Cu,
+    0x51F210BEu, 0x8D9F8A09u, 0xEDE83867u, 0x3185A2D0u, 0x2D075CBBu, 0xF16AC60Cu, 0x911D7462u, 0x4D70EED5u, 0xA81888B4u, 0x74751203u, 0x1402A06Du, 0xC86F3ADAu, 0xD4EDC4B1u, 0x08805E06u, 0x68F7EC68u, 0xB49A76DFu,
+    0x4C0F7BECu, 0x9062E15Bu, 0xF0155335u, 0x2C78C982u, 0x30FA37E9u, 0xEC97AD5Eu, 0x8CE01F30u, 0x508D8587u, 0xB5E5E3E6u, 0x69887951u, 0x09FFCB3Fu, 0xD5925188u, 0xC910AFE3u, 0x157D3554u, 0x750A873Au, 0xA9671D8Du,
+    0xBB1B564Fu, 0x6776CCF8u, 0x07017E96u, 0xDB6CE421u, 0xC7EE1A4Au, 0x1B8380FDu, 0x7BF43293u, 0xA799A824u, 0x42F1CE45u, 0x9E9C54F2u, 0xFEEBE69Cu, 0x22867C2Bu, 0x3E048240u, 0xE26918F7u, 0x821EAA99u, 0x5E73302Eu,
+    0x77F5AD48u, 0xAB9837FFu, 0xCBEF8591u, 0x17821F26u, 0x0B00E14Du, 0xD76D7BFAu, 0xB71AC994u, 0x6B775323u, 0x8E1F3542u, 0x5272AFF5u, 0x32051D9Bu, 0xEE68872Cu, 0xF2EA7947u, 0x2E87E3F0u, 0x4EF0519Eu, 0x929DCB29u,
+    0x80E180EBu, 0x5C8C1A5Cu, 0x3CFBA832u, 0xE0963285u, 0xFC14CCEEu, 0x20795659u, 0x400EE437u, 0x9C637E80u, 0x790B18E1u, 0xA5668256u, 0xC5113038u, 0x197CAA8Fu, 0x05FE54E4u, 0xD993CE53u, 0xB9E47C3Du, 0x6589E68Au,
+    0x9D1CEBB9u, 0x4171710Eu, 0x2106C360u, 0xFD6B59D7u, 0xE1E9A7BCu, 0x3D843D0Bu, 0x5DF38F65u, 0x819E15D2u, 0x64F673B3u, 0xB89BE904u, 0xD8EC5B6Au, 0x0481C1DDu, 0x18033FB6u, 0xC46EA501u, 0xA419176Fu, 0x78748DD8u,
+    0x6A08C61Au, 0xB6655CADu, 0xD612EEC3u, 0x0A7F7474u, 0x16FD8A1Fu, 0xCA9010A8u, 0xAAE7A2C6u, 0x768A3871u, 0x93E25E10u, 0x4F8FC4A7u, 0x2FF876C9u, 0xF395EC7Eu, 0xEF171215u, 0x337A88A2u, 0x530D3ACCu, 0x8F60A07Bu,
+    0x00000000u, 0x490D678Du, 0x921ACF1Au, 0xDB17A897u, 0x20F48383u, 0x69F9E40Eu, 0xB2EE4C99u, 0xFBE32B14u, 0x41E90706u, 0x08E4608Bu, 0xD3F3C81Cu, 0x9AFEAF91u, 0x611D8485u, 0x2810E308u, 0xF3074B9Fu, 0xBA0A2C12u,
+    0x83D20E0Cu, 0xCADF6981u, 0x11C8C116u, 0x58C5A69Bu, 0xA3268D8Fu, 0xEA2BEA02u, 0x313C4295u, 0x78312518u, 0xC23B090Au, 0x8B366E87u, 0x5021C610u, 0x192CA19Du, 0xE2CF8A89u, 0xABC2ED04u, 0x70D54593u, 0x39D8221Eu,
+    0x036501AFu, 0x4A686622u, 0x917FCEB5u, 0xD872A938u, 0x2391822Cu, 0x6A9CE5A1u, 0xB18B4D36u, 0xF8862ABBu, 0x428C06A9u, 0x0B816124u, 0xD096C9B3u, 0x999BAE3Eu, 0x6278852Au, 0x2B75E2A7u, 0xF0624A30u, 0xB96F2DBDu,
+    0x80B70FA3u, 0xC9BA682Eu, 0x12ADC0B9u, 0x5BA0A734u, 0xA0438C20u, 0xE94EEBADu, 0x3259433Au, 0x7B5424B7u, 0xC15E08A5u, 0x88536F28u, 0x5344C7BFu, 0x1A49A032u, 0xE1AA8B26u, 0xA8A7ECABu, 0x73B0443Cu, 0x3ABD23B1u,
+    0x06CA035Eu, 0x4FC764D3u, 0x94D0CC44u, 0xDDDDABC9u, 0x263E80DDu, 0x6F33E750u, 0xB4244FC7u, 0xFD29284Au, 0x47230458u, 0x0E2E63D5u, 0xD539CB42u, 0x9C34ACCFu, 0x67D787DBu, 0x2EDAE056u, 0xF5CD48C1u, 0xBCC02F4Cu,
+    0x85180D52u, 0xCC156ADFu, 0x1702C248u, 0x5E0FA5C5u, 0xA5EC8ED1u, 0xECE1E95Cu, 0x37F641CBu, 0x7EFB2646u, 0xC4F10A54u, 0x8DFC6DD9u, 0x56EBC54Eu, 0x1FE6A2C3u, 0xE40589D7u, 0xAD08EE5Au, 0x761F46CDu, 0x3F122140u,
+    0x05AF02F1u, 0x4CA2657Cu, 0x97B5CDEBu, 0xDEB8AA66u, 0x255B8172u, 0x6C56E6FFu, 0xB7414E68u, 0xFE4C29E5u, 0x444605F7u, 0x0D4B627Au, 0xD65CCAEDu, 0x9F51AD60u, 0x64B28674u, 0x2DBFE1F9u, 0xF6A8496Eu, 0xBFA52EE3u,
+    0x867D0CFDu, 0xCF706B70u, 0x1467C3E7u, 0x5D6AA46Au, 0xA6898F7Eu, 0xEF84E8F3u, 0x34934064u, 0x7D9E27E9u, 0xC7940BFBu, 0x8E996C76u, 0x558EC4E1u, 0x1C83A36Cu, 0xE7608878u, 0xAE6DEFF5u, 0x757A4762u, 0x3C7720EFu,
+    0x0D9406BCu, 0x44996131u, 0x9F8EC9A6u, 0xD683AE2Bu, 0x2D60853Fu, 0x646DE2B2u, 0xBF7A4A25u, 0xF6772DA8u, 0x4C7D01BAu, 0x05706637u, 0xDE67CEA0u, 0x976AA92Du, 0x6C898239u, 0x2584E5B4u, 0xFE934D23u, 0xB79E2AAEu,
+    0x8E4608B0u, 0xC74B6F3Du, 0x1C5CC7AAu, 0x5551A027u, 0xAEB28B33u, 0xE7BFECBEu, 0x3CA84429u, 0x75A523A4u, 0xCFAF0FB6u, 0x86A2683Bu, 0x5DB5C0ACu, 0x14B8A721u, 0xEF5B8C35u, 0xA656EBB8u, 0x7D41432Fu, 0x344C24A2u,
+    0x0EF10713u, 0x47FC609Eu, 0x9CEBC809u, 0xD5E6AF84u, 0x2E058490u, 0x6708E31Du, 0xBC1F4B8Au, 0xF5122C07u, 0x4F180015u, 0x06156798u, 0xDD02CF0Fu, 0x940FA882u, 0x6FEC8396u, 0x26E1E41Bu, 0xFDF64C8Cu, 0xB4FB2B01u,
+    0x8D23091Fu, 0xC42E6E92u, 0x1F39C605u, 0x5634A188u, 0xADD78A9Cu, 0xE4DAED11u, 0x3FCD4586u, 0x76C0220Bu, 0xCCCA0E19u, 0x85C76994u, 0x5ED0C103u, 0x17DDA68Eu, 0xEC3E8D9Au, 0xA533EA17u, 0x7E244280u, 0x3729250Du,
+    0x0B5E05E2u, 0x4253626Fu, 0x9944CAF8u, 0xD049AD75u, 0x2BAA8661u, 0x62A7E1ECu, 0xB9B0497Bu, 0xF0BD2EF6u, 0x4AB702E4u, 0x03BA6569u, 0xD8ADCDFEu, 0x91A0AA73u, 0x6A438167u, 0x234EE6EAu, 0xF8594E7Du, 0xB15429F0u,
+    0x888C0BEEu, 0xC1816C63u, 0x1A96C4F4u, 0x539BA379u, 0xA878886Du, 0xE175EFE0u, 0x3A624777u, 0x736F20FAu, 0xC9650CE8u, 0x80686B65u, 0x5B7FC3F2u, 0x1272A47Fu, 0xE9918F6Bu, 0xA09CE8E6u, 0x7B8B4071u, 0x328627FCu,
+    0x083B044Du, 0x413663C0u, 0x9A21CB57u, 0xD32CACDAu, 0x28CF87CEu, 0x61C2E043u, 0xBAD548D4u, 0xF3D82F59u, 0x49D2034Bu, 0x00DF64C6u, 0xDBC8CC51u, 0x92C5ABDCu, 0x692680C8u, 0x202BE745u, 0xFB3C4FD2u, 0xB231285Fu,
+    0x8BE90A41u, 0xC2E46DCCu, 0x19F3C55Bu, 0x50FEA2D6u, 0xAB1D89C2u, 0xE210EE4Fu, 0x390746D8u, 0x700A2155u, 0xCA000D47u, 0x830D6ACAu, 0x581AC25Du, 0x1117A5D0u, 0xEAF48EC4u, 0xA3F9E949u, 0x78EE41DEu, 0x31E32653u,
+    0x00000000u, 0x1B280D78u, 0x36501AF0u, 0x2D781788u, 0x6CA035E0u, 0x77883898u, 0x5AF02F10u, 0x41D82268u, 0xD9406BC0u, 0xC26866B8u, 0xEF107130u, 0xF4387C48u, 0xB5E05E20u, 0xAEC85358u, 0x83B044D0u, 0x989849A8u,
+    0xB641CA37u, 0xAD69C74Fu, 0x8011D0C7u, 0x9B39DDBFu, 0xDAE1FFD7u, 0xC1C9F2AFu, 0xECB1E527u, 0xF799E85Fu, 0x6F01A1F7u, 0x7429AC8Fu, 0x5951BB07u, 0x4279B67Fu, 0x03A19417u, 0x1889996Fu, 0x35F18EE7u, 0x2ED9839Fu,
+    0x684289D9u, 0x736A84A1u, 0x5E129329u, 0x453A9E51u, 0x04E2BC39u, 0x1FCAB141u, 0x32B2A6C9u, 0x299AABB1u, 0xB102E219u, 0xAA2AEF61u, 0x8752F8E9u, 0x9C7AF591u, 0xDDA2D7F9u, 0xC68ADA81u, 0xEBF2CD09u, 0xF0DAC071u,
+    0xDE0343EEu, 0xC52B4E96u, 0xE853591Eu, 0xF37B5466u, 0xB2A3760Eu, 0xA98B7B76u, 0x84F36CFEu, 0x9FDB6186u, 0x0743282Eu, 0x1C6B2556u, 0x311332DEu, 0x2A3B3FA6u, 0x6BE31DCEu, 0x70CB10B6u, 0x5DB3073Eu, 0x469B0A46u,
+    0xD08513B2u, 0xCBAD1ECAu, 0xE6D50942u, 0xFDFD043Au, 0xBC252652u, 0xA70D2B2Au, 0x8A753CA2u, 0x915D31DAu, 0x09C57872u, 0x12ED750Au, 0x3F956282u, 0x24BD6FFAu, 0x65654D92u, 0x7E4D40EAu, 0x53355762u, 0x481D5A1Au,
+    0x66C4D985u, 0x7DECD4FDu, 0x5094C375u, 0x4BBCCE0Du, 0x0A64EC65u, 0x114CE11Du, 0x3C34F695u, 0x271CFBEDu, 0xBF84B245u, 0xA4ACBF3Du, 0x89D4A8B5u, 0x92FCA5CDu, 0xD32487A5u, 0xC80C8ADDu, 0xE5749D55u, 0xFE5C902Du,
+    0xB8C79A6Bu, 0xA3EF9713u, 0x8E97809Bu, 0x95BF8DE3u, 0xD467AF8Bu, 0xCF4FA2F3u, 0xE237B57Bu, 0xF91FB803u, 0x6187F1ABu, 0x7AAFFCD3u, 0x57D7EB5Bu, 0x4CFFE623u, 0x0D27C44Bu, 0x160FC933u, 0x3B77DEBBu, 0x205FD3C3u,
+    0x0E86505Cu, 0x15AE5D24u, 0x38D64AACu, 0x23FE47D4u, 0x622665BCu, 0x790E68C4u, 0x54767F4Cu, 0x4F5E7234u, 0xD7C63B9Cu, 0xCCEE36E4u, 0xE196216Cu, 0xFABE2C14u, 0xBB660E7Cu, 0xA04E0304u, 0x8D36148Cu, 0x961E19F4u,
+    0xA5CB3AD3u, 0xBEE337ABu, 0x939B2023u, 0x88B32D5Bu, 0xC96B0F33u, 0xD243024Bu, 0xFF3B15C3u, 0xE41318BBu, 0x7C8B5113u, 0x67A35C6Bu, 0x4ADB4BE3u, 0x51F3469Bu, 0x102B64F3u, 0x0B03698Bu, 0x267B7E03u, 0x3D53737Bu,
+    0x138AF0E4u, 0x08A2FD9Cu, 0x25DAEA14u, 0x3EF2E76Cu, 0x7F2AC504u, 0x6402C87Cu, 0x497ADFF4u, 0x5252D28Cu, 0xCACA9B24u, 0xD1E2965Cu, 0xFC9A81D4u, 0xE7B28CACu, 0xA66AAEC4u, 0xBD42A3BCu, 0x903AB434u, 0x8B12B94Cu,
+    0xCD89B30Au, 0xD6A1BE72u, 0xFBD9A9FAu, 0xE0F1A482u, 0xA12986EAu, 0xBA018B92u, 0x97799C1Au, 0x8C519162u, 0x14C9D8CAu, 0x0FE1D5B2u, 0x2299C23Au, 0x39B1CF42u, 0x7869ED2Au, 0x6341E052u, 0x4E39F7DAu, 0x5511FAA2u,
+    0x7BC8793Du, 0x60E07445u, 0x4D9863CDu, 0x56B06EB5u, 0x17684CDDu, 0x0C4041A5u, 0x2138562Du, 0x3A105B55u, 0xA28812FDu, 0xB9A01F85u, 0x94D8080Du, 0x8FF00575u, 0xCE28271Du, 0xD5002A65u, 0xF8783DEDu, 0xE3503095u,
+    0x754E2961u, 0x6E662419u, 0x431E3391u, 0x58363EE9u, 0x19EE1C81u, 0x02C611F9u, 0x2FBE0671u, 0x34960B09u, 0xAC0E42A1u, 0xB7264FD9u, 0x9A5E5851u, 0x81765529u, 0xC0AE7741u, 0xDB867A39u, 0xF6FE6DB1u, 0xEDD660C9u,
+    0xC30FE356u, 0xD827EE2Eu, 0xF55FF9A6u, 0xEE77F4DEu, 0xAFAFD6B6u, 0xB487DBCEu, 0x99FFCC46u, 0x82D7C13Eu, 0x1A4F8896u, 0x016785EEu, 0x2C1F9266u, 0x37379F1Eu, 0x76EFBD76u, 0x6DC7B00Eu, 0x40BFA786u, 0x5B97AAFEu,
+    0x1D0CA0B8u, 0x0624ADC0u, 0x2B5CBA48u, 0x3074B730u, 0x71AC9558u, 0x6A849820u, 0x47FC8FA8u, 0x5CD482D0u, 0xC44CCB78u, 0xDF64C600u, 0xF21CD188u, 0xE934DCF0u, 0xA8ECFE98u, 0xB3C4F3E0u, 0x9EBCE468u, 0x8594E910u,
+    0xAB4D6A8Fu, 0xB06567F7u, 0x9D1D707Fu, 0x86357D07u, 0xC7ED5F6Fu, 0xDCC55217u, 0xF1BD459Fu, 0xEA9548E7u, 0x720D014Fu, 0x69250C37u, 0x445D1BBFu, 0x5F7516C7u, 0x1EAD34AFu, 0x058539D7u, 0x28FD2E5Fu, 0x33D52327u,
+    0x00000000u, 0x4F576811u, 0x9EAED022u, 0xD1F9B833u, 0x399CBDF3u, 0x76CBD5E2u, 0xA7326DD1u, 0xE86505C0u, 0x73397BE6u, 0x3C6E13F7u, 0xED97ABC4u, 0xA2C0C3D5u, 0x4AA5C615u, 0x05F2AE04u, 0xD40B1637u, 0x9B5C7E26u,
+    0xE672F7CCu, 0xA9259FDDu, 0x78DC27EEu, 0x378B4FFFu, 0xDFEE4A3Fu, 0x90B9222Eu, 0x41409A1Du, 0x0E17F20Cu, 0x954B8C2Au, 0xDA1CE43Bu, 0x0BE55C08u, 0x44B23419u, 0xACD731D9u, 0xE38059C8u, 0x3279E1FBu, 0x7D2E89EAu,
+    0xC824F22Fu, 0x87739A3Eu, 0x568A220Du, 0x19DD4A1Cu, 0xF1B84FDCu, 0xBEEF27CDu, 0x6F169FFEu, 0x2041F7EFu, 0xBB1D89C9u, 0xF44AE1D8u, 0x25B359EBu, 0x6AE431FAu, 0x8281343Au, 0xCDD65C2Bu, 0x1C2FE418u, 0x53788C09u,
+    0x2E5605E3u, 0x61016DF2u, 0xB0F8D5C1u, 0xFFAFBDD0u, 0x17CAB810u, 0x589DD001u, 0x89646832u, 0xC6330023u, 0x5D6F7E05u, 0x12381614u, 0xC3C1AE27u, 0x8C96C636u, 0x64F3C3F6u, 0x2BA4ABE7u, 0xFA5D13D4u, 0xB50A7BC5u,
+    0x9488F9E9u, 0xDBDF91F8u, 0x0A2629CBu, 0x457141DAu, 0xAD14441Au, 0xE2432C0Bu, 0x33BA9438u, 0x7CEDFC29u, 0xE7B1820Fu, 0xA8E6EA1Eu, 0x791F522Du, 0x36483A3Cu, 0xDE2D3FFCu, 0x917A57EDu, 0x4083EFDEu, 0x0FD487CFu,
+    0x72FA0E25u, 0x3DAD6634u, 0xEC54DE07u, 0xA303B616u, 0x4B66B3D6u, 0x0431DBC7u, 0xD5C863F4u, 0x9A9F0BE5u, 0x01C375C3u, 0x4E941DD2u, 0x9F6DA5E1u, 0xD03ACDF0u, 0x385FC830u, 0x7708A021u, 0xA6F11812u, 0xE9A67003u,
+    0x5CAC0BC6u, 0x13FB63D7u, 0xC202DBE4u, 0x8D55B3F5u, 0x6530B635u, 0x2A67DE24u, 0xFB9E6617u, 0xB4C90E06u, 0x2F957020u, 0x60C21831u, 0xB13BA002u, 0xFE6CC813u, 0x1609CDD3u, 0x595EA5C2u, 0x88A71DF1u, 0xC7F075E0u,
+    0xBADEFC0Au, 0xF589941Bu, 0x24702C28u, 0x6B274439u, 0x834241F9u, 0xCC1529E8u, 0x1DEC91DBu, 0x52BBF9CAu, 0xC9E787ECu, 0x86B0EFFDu, 0x574957CEu, 0x181E3FDFu, 0xF07B3A1Fu, 0xBF2C520Eu, 0x6ED5EA3Du, 0x2182822Cu,
+    0x2DD0EE65u, 0x62878674u, 0xB37E3E47u, 0xFC295656u, 0x144C5396u, 0x5B1B3B87u, 0x8AE283B4u, 0xC5B5EBA5u, 0x5EE99583u, 0x11BEFD92u, 0xC04745A1u, 0x8F102DB0u, 0x67752870u, 0x28224061u, 0xF9DBF852u, 0xB68C9043u,
+    0xCBA219A9u, 0x84F571B8u, 0x550CC98Bu, 0x1A5BA19Au, 0xF23EA45Au, 0xBD69CC4Bu, 0x6C907478u, 0x23C71C69u, 0xB89B624Fu, 0xF7CC0A5Eu, 0x2635B26Du, 0x6962DA7Cu, 0x8107DFBCu, 0xCE50B7ADu, 0x1FA90F9Eu, 0x50FE678Fu,
+    0xE5F41C4Au, 0xAAA3745Bu, 0x7B5ACC68u, 0x340DA479u, 0xDC68A1B9u, 0x933FC9A8u, 0x42C6719Bu, 0x0D91198Au, 0x96CD67ACu, 0xD99A0FBDu, 0x0863B78Eu, 0x4734DF9Fu, 0xAF51DA5Fu, 0xE006B24Eu, 0x31FF0A7Du, 0x7EA8626Cu,
+    0x0386EB86u, 0x4CD18397u, 0x9D283BA4u, 0xD27F53B5u, 0x3A1A5675u, 0x754D3E64u, 0xA4B48657u, 0xEBE3EE46u, 0x70BF9060u, 0x3FE8F871u, 0xEE114042u, 0xA1462853u, 0x49232D93u, 0x06744582u, 0xD78DFDB1u, 0x98DA95A0u,
+    0xB958178Cu, 0xF60F7F9Du, 0x27F6C7AEu, 0x68A1AFBFu, 0x80C4AA7Fu, 0xCF93C26Eu, 0x1E6A7A5Du, 0x513D124Cu, 0xCA616C6Au, 0x8536047Bu, 0x54CFBC48u, 0x1B98D459u, 0xF3FDD199u, 0xBCAAB988u, 0x6D5301BBu, 0x220469AAu,
+    0x5F2AE040u, 0x107D8851u, 0xC1843062u, 0x8ED35873u, 0x66B65DB3u, 0x29E135A2u, 0xF8188D91u, 0xB74FE580u, 0x2C139BA6u, 0x6344F3B7u, 0xB2BD4B84u, 0xFDEA2395u, 0x158F2655u, 0x5AD84E44u, 0x8B21F677u, 0xC4769E66u,
+    0x717CE5A3u, 0x3E2B8DB2u, 0xEFD23581u, 0xA0855D90u, 0x48E05850u, 0x07B73041u, 0xD64E8872u, 0x9919E063u, 0x02459E45u, 0x4D12F654u, 0x9CEB4E67u, 0xD3BC2676u, 0x3BD923B6u, 0x748E4BA7u, 0xA577F394u, 0xEA209B85u,
+    0x970E126Fu, 0xD8597A7Eu, 0x09A0C24Du, 0x46F7AA5Cu, 0xAE92AF9Cu, 0xE1C5C78Du, 0x303C7FBEu, 0x7F6B17AFu, 0xE4376989u, 0xAB600198u, 0x7A99B9ABu, 0x35CED1BAu, 0xDDABD47Au, 0x92FCBC6Bu, 0x43050458u, 0x0C526C49u,
+    0x00000000u, 0x5BA1DCCAu, 0xB743B994u, 0xECE2655Eu, 0x6A466E9Fu, 0x31E7B255u, 0xDD05D70Bu, 0x86A40BC1u, 0xD48CDD3Eu, 0x8F2D01F4u, 0x63CF64AAu, 0x386EB860u, 0xBECAB3A1u, 0xE56B6F6Bu, 0x09890A35u, 0x5228D6FFu,
+    0xADD8A7CBu, 0xF6797B01u, 0x1A9B1E5Fu, 0x413AC295u, 0xC79EC954u, 0x9C3F159Eu, 0x70DD70C0u, 0x2B7CAC0Au, 0x79547AF5u, 0x22F5A63Fu, 0xCE17C361u, 0x95B61FABu, 0x1312146Au, 0x48B3C8A0u, 0xA451ADFEu, 0xFFF07134u,
+    0x5F705221u, 0x04D18EEBu, 0xE833EBB5u, 0xB392377Fu, 0x35363CBEu, 0x6E97E074u, 0x8275852Au, 0xD9D459E0u, 0x8BFC8F1Fu, 0xD05D53D5u, 0x3CBF368Bu, 0x671EEA41u, 0xE1BAE180u, 0xBA1B3D4Au, 0x56F95814u, 0x0D5884DEu,
+    0xF2A8F5EAu, 0xA9092920u, 0x45EB4C7Eu, 0x1E4A90B4u, 0x98EE9B75u, 0xC34F47BFu, 0x2FAD22E1u, 0x740CFE2Bu, 0x262428D4u, 0x7D85F41Eu, 0x91679140u, 0xCAC64D8Au, 0x4C62464Bu, 0x17C39A81u, 0xFB21FFDFu, 0xA0802315u,
+    0xBEE0A442u, 0xE5417888u, 0x09A31DD6u, 0x5202C11Cu, 0xD4A6CADDu, 0x8F071617u, 0x63E57349u, 0x3844AF83u, 0x6A6C797Cu, 0x31CDA5B6u, 0xDD2FC0E8u, 0x868E1C22u, 0x002A17E3u, 0x5B8BCB29u, 0xB769AE77u, 0xECC872BDu,
+    0x13380389u, 0x4899DF43u, 0xA47BBA1Du, 0xFFDA66D7u, 0x797E6D16u, 0x22DFB1DCu, 0xCE3DD482u, 0x959C0848u, 0xC7B4DEB7u, 0x9C15027Du, 0x70F76723u, 0x2B56BBE9u, 0xADF2B028u, 0xF6536CE2u, 0x1AB109BCu, 0x4110D576u,
+    0xE190F663u, 0xBA312AA9u, 0x56D34FF7u, 0x0D72933Du, 0x8BD698FCu, 0xD0774436u, 0x3C952168u, 0x6734FDA2u, 0x351C2B5Du, 0x6EBDF797u, 0x825F92C9u, 0xD9FE4E03u, 0x5F5A45C2u, 0x04FB9908u, 0xE819FC56u, 0xB3B8209Cu,
+    0x4C4851A8u, 0x17E98D62u, 0xFB0BE83Cu, 0xA0AA34F6u, 0x260E3F37u, 0x7DAFE3FDu, 0x914D86A3u, 0xCAEC5A69u, 0x98C48C96u, 0xC365505Cu, 0x2F873502u, 0x7426E9C8u, 0xF282E209u, 0xA9233EC3u, 0x45C15B9Du, 0x1E608757u,
+    0x79005533u, 0x22A189F9u, 0xCE43ECA7u, 0x95E2306Du, 0x13463BACu, 0x48E7E766u, 0xA4058238u, 0xFFA45EF2u, 0xAD8C880Du, 0xF62D54C7u, 0x1ACF3199u, 0x416EED53u, 0xC7CAE692u, 0x9C6B3A58u, 0x70895F06u, 0x2B2883CCu,
+    0xD4D8F2F8u, 0x8F792E32u, 0x639B4B6Cu, 0x383A97A6u, 0xBE9E9C67u, 0xE53F40ADu, 0x09DD25F3u, 0x527CF939u, 0x00542FC6u, 0x5BF5F30Cu, 0xB7179652u, 0xECB64A98u, 0x6A124159u, 0x31B39D93u, 0xDD51F8CDu, 0x86F02407u,
+    0x26700712u, 0x7DD1DBD8u, 0x9133BE86u, 0xCA92624Cu, 0x4C36698Du, 0x1797B547u, 0xFB75D019u, 0xA0D40CD3u, 0xF2FCDA2Cu, 0xA95D06E6u, 0x45BF63B8u, 0x1E1EBF72u, 0x98BAB4B3u, 0xC31B6879u, 0x2FF90D27u, 0x7458D1EDu,
+    0x8BA8A0D9u, 0xD0097C13u, 0x3CEB194Du, 0x674AC587u, 0xE1EECE46u, 0xBA4F128Cu, 0x56AD77D2u, 0x0D0CAB18u, 0x5F247DE7u, 0x0485A12Du, 0xE867C473u, 0xB3C618B9u, 0x35621378u, 0x6EC3CFB2u, 0x8221AAECu, 0xD9807626u,
+    0xC7E0F171u, 0x9C412DBBu, 0x70A348E5u, 0x2B02942Fu, 0xADA69FEEu, 0xF6074324u, 0x1AE5267Au, 0x4144FAB0u, 0x136C2C4Fu, 0x48CDF085u, 0xA42F95DBu, 0xFF8E4911u, 0x792A42D0u, 0x228B9E1Au, 0xCE69FB44u, 0x95C8278Eu,
+    0x6A3856BAu, 0x31998A70u, 0xDD7BEF2Eu, 0x86DA33E4u, 0x007E3825u, 0x5BDFE4EFu, 0xB73D81B1u, 0xEC9C5D7Bu, 0xBEB48B84u, 0xE515574Eu, 0x09F73210u, 0x5256EEDAu, 0xD4F2E51Bu, 0x8F5339D1u, 0x63B15C8Fu, 0x38108045u,
+    0x9890A350u, 0xC3317F9Au, 0x2FD31AC4u, 0x7472C60Eu, 0xF2D6CDCFu, 0xA9771105u, 0x4595745Bu, 0x1E34A891u, 0x4C1C7E6Eu, 0x17BDA2A4u, 0xFB5FC7FAu, 0xA0FE1B30u, 0x265A10F1u, 0x7DFBCC3Bu, 0x9119A965u, 0xCAB875AFu,
+    0x3548049Bu, 0x6EE9D851u, 0x820BBD0Fu, 0xD9AA61C5u, 0x5F0E6A04u, 0x04AFB6CEu, 0xE84DD390u, 0xB3EC0F5Au, 0xE1C4D9A5u, 0xBA65056Fu, 0x56876031u, 0x0D26BCFBu, 0x8B82B73Au, 0xD0236BF0u, 0x3CC10EAEu, 0x6760D264u
+};
+#endif
+
 const  CRC_MODEL_32  CRC_ModelCRC32 = {
     0x04C11DB7u,
     0xFFFFFFFFu,
     DEF_NO,
     0xFFFFFFFFu,
-   &CRC_TblCRC32[0]
+   &CRC_TblCRC32[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+   &CRC_TblSliceCRC32[0],
+#else
+    (const CPU_INT32U *)0,
+#endif
+    (CRC_HW_FNCT_32)0
 };
 #endif
 
@@ -279,12 +1246,323 @@ const  CPU_INT32U  CRC_TblCRC32_ref[256] = {
     0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu, 0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u, 0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du
 };
 
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT32U  CRC_TblSliceCRC32_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu, 0xE963A535u, 0x9E6495A3u, 0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u, 0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u,
+    0x1DB71064u, 0x6AB020F2u, 0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u, 0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u, 0xFA0F3D63u, 0x8D080DF5u,
+    0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u, 0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu, 0x35B5A8FAu, 0x42B2986Cu, 0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+    0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u, 0xCFBA9599u, 0xB8BDA50Fu, 0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u, 0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du,
+    0x76DC4190u, 0x01DB7106u, 0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u, 0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du, 0x91646C97u, 0xE6635C01u,
+    0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu, 0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u, 0x65B0D9C6u, 0x12B7E950u, 0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+    0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u, 0xA4D1C46Du, 0xD3D6F4FBu, 0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u, 0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u,
+    0x5005713Cu, 0x270241AAu, 0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu, 0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u, 0xB7BD5C3Bu, 0xC0BA6CADu,
+    0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au, 0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u, 0xE3630B12u, 0x94643B84u, 0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+    0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu, 0x196C3671u, 0x6E6B06E7u, 0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu, 0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u,
+    0xD6D6A3E8u, 0xA1D1937Eu, 0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu, 0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u, 0x316E8EEFu, 0x4669BE79u,
+    0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u, 0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu, 0xC5BA3BBEu, 0xB2BD0B28u, 0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+    0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu, 0x72076785u, 0x05005713u, 0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u, 0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u,
+    0x86D3D2D4u, 0xF1D4E242u, 0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u, 0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u, 0x616BFFD3u, 0x166CCF45u,
+    0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u, 0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu, 0xAED16A4Au, 0xD9D65ADCu, 0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+    0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u, 0x54DE5729u, 0x23D967BFu, 0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u, 0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du,
+    0x00000000u, 0x191B3141u, 0x32366282u, 0x2B2D53C3u, 0x646CC504u, 0x7D77F445u, 0x565AA786u, 0x4F4196C7u, 0xC8D98A08u, 0xD1C2BB49u, 0xFAEFE88Au, 0xE3F4D9CBu, 0xACB54F0Cu, 0xB5AE7E4Du, 0x9E832D8Eu, 0x87981CCFu,
+    0x4AC21251u, 0x53D92310u, 0x78F470D3u, 0x61EF4192u, 0x2EAED755u, 0x37B5E614u, 0x1C98B5D7u, 0x05838496u, 0x821B9859u, 0x9B00A918u, 0xB02DFADBu, 0xA936CB9Au, 0xE6775D5Du, 0xFF6C6C1Cu, 0xD4413FDFu, 0xCD5A0E9Eu,
+    0x958424A2u, 0x8C9F15E3u, 0xA7B24620u, 0xBEA97761u, 0xF1E8E1A6u, 0xE8F3D0E7u, 0xC3DE8324u, 0xDAC5B265u, 0x5D5DAEAAu, 0x44469FEBu, 0x6F6BCC28u, 0x7670FD69u, 0x39316BAEu, 0x202A5AEFu, 0x0B07092Cu, 0x121C386Du,
+    0xDF4636F3u, 0xC65D07B2u, 0xED705471u, 0xF46B6530u, 0xBB2AF3F7u, 0xA231C2B6u, 0x891C9175u, 0x9007A034u, 0x179FBCFBu, 0x0E848DBAu, 0x25A9DE79u, 0x3CB2EF38u, 0x73F379FFu, 0x6AE848BEu, 0x41C51B7Du, 0x58DE2A3Cu,
+    0xF0794F05u, 0xE9627E44u, 0xC24F2D87u, 0xDB541CC6u, 0x94158A01u, 0x8D0EBB40u, 0xA623E883u, 0xBF38D9C2u, 0x38A0C50Du, 0x21BBF44Cu, 0x0A96A78Fu, 0x138D96CEu, 0x5CCC0009u, 0x45D73148u, 0x6EFA628Bu, 0x77E153CAu,
+    0xBABB5D54u, 0xA3A06C15u, 0x888D3FD6u, 0x91960E97u, 0xDED79850u, 0xC7CCA911u, 0xECE1FAD2u, 0xF5FACB93u, 0x7262D75Cu, 0x6B79E61Du, 0x4054B5DEu, 0x594F849Fu, 0x160E1258u, 0x0F152319u, 0x243870DAu, 0x3D23419Bu,
+    0x65FD6BA7u, 0x7CE65AE6u, 0x57CB0925u, 0x4ED03864u, 0x0191AEA3u, 0x188A9FE2u, 0x33A7CC21u, 0x2ABCFD60u, 0xAD24E1AFu, 0xB43FD0EEu, 0x9F12832Du, 0x8609B26Cu, 0xC94824ABu, 0xD05315EAu, 0xFB7E4629u, 0xE2657768u,
+    0x2F3F79F6u, 0x362448B7u, 0x1D091B74u, 0x04122A35u, 0x4B53BCF2u, 0x52488DB3u, 0x7965DE70u, 0x607EEF31u, 0xE7E6F3FEu, 0xFEFDC2BFu, 0xD5D0917Cu, 0xCCCBA03Du, 0x838A36FAu, 0x9A9107BBu, 0xB1BC5478u, 0xA8A76539u,
+    0x3B83984Bu, 0x2298A90Au, 0x09B5FAC9u, 0x10AECB88u, 0x5FEF5D4Fu, 0x46F46C0Eu, 0x6DD93FCDu, 0x74C20E8Cu, 0xF35A1243u, 0xEA412302u, 0xC16C70C1u, 0xD8774180u, 0x9736D747u, 0x8E2DE606u, 0xA500B5C5u, 0xBC1B8484u,
+    0x71418A1Au, 0x685ABB5Bu, 0x4377E898u, 0x5A6CD9D9u, 0x152D4F1Eu, 0x0C367E5Fu, 0x271B2D9Cu, 0x3E001CDDu, 0xB9980012u, 0xA0833153u, 0x8BAE6290u, 0x92B553D1u, 0xDDF4C516u, 0xC4EFF457u, 0xEFC2A794u, 0xF6D996D5u,
+    0xAE07BCE9u, 0xB71C8DA8u, 0x9C31DE6Bu, 0x852AEF2Au, 0xCA6B79EDu, 0xD37048ACu, 0xF85D1B6Fu, 0xE1462A2Eu, 0x66DE36E1u, 0x7FC507A0u, 0x54E85463u, 0x4DF36522u, 0x02B2F3E5u, 0x1BA9C2A4u, 0x30849167u, 0x299FA026u,
+    0xE4C5AEB8u, 0xFDDE9FF9u, 0xD6F3CC3Au, 0xCFE8FD7Bu, 0x80A96BBCu, 0x99B25AFDu, 0xB29F093Eu, 0xAB84387Fu, 0x2C1C24B0u, 0x350715F1u, 0x1E2A4632u, 0x07317773u, 0x4870E1B4u, 0x516BD0F5u, 0x7A468336u, 0x635DB277u,
+    0xCBFAD74Eu, 0xD2E1E60Fu, 0xF9CCB5CCu, 0xE0D7848Du, 0xAF96124Au, 0xB68D230Bu, 0x9DA070C8u, 0x84BB4189u, 0x03235D46u, 0x1A386C07u, 0x31153FC4u, 0x280E0E85u, 0x674F9842u, 0x7E54A903u, 0x5579FAC0u, 0x4C62CB81u,
+    0x8138C51Fu, 0x9823F45Eu, 0xB30EA79Du, 0xAA1596DCu, 0xE554001Bu, 0xFC4F315Au, 0xD7626299u, 0xCE7953D8u, 0x49E14F17u, 0x50FA7E56u, 0x7BD72D95u, 0x62CC1CD4u, 0x2D8D8A13u, 0x3496BB52u, 0x1FBBE891u, 0x06A0D9D0u,
+    0x5E7EF3ECu, 0x4765C2ADu, 0x6C48916Eu, 0x7553A02Fu, 0x3A1236E8u, 0x230907A9u, 0x0824546Au, 0x113F652Bu, 0x96A779E4u, 0x8FBC48A5u, 0xA4911B66u, 0xBD8A2A27u, 0xF2CBBCE0u, 0xEBD08DA1u, 0xC0FDDE62u, 0xD9E6EF23u,
+    0x14BCE1BDu, 0x0DA7D0FCu, 0x268A833Fu, 0x3F91B27Eu, 0x70D024B9u, 0x69CB15F8u, 0x42E6463Bu, 0x5BFD777Au, 0xDC656BB5u, 0xC57E5AF4u, 0xEE530937u, 0xF7483876u, 0xB809AEB1u, 0xA1129FF0u, 0x8A3FCC33u, 0x9324FD72u,
+    0x00000000u, 0x01C26A37u, 0x0384D46Eu, 0x0246BE59u, 0x0709A8DCu, 0x06CBC2EBu, 0x048D7CB2u, 0x054F1685u, 0x0E1351B8u, 0x0FD13B8Fu, 0x0D9785D6u, 0x0C55EFE1u, 0x091AF964u, 0x08D89353u, 0x0A9E2D0Au, 0x0B5C473Du,
+    0x1C26A370u, 0x1DE4C947u, 0x1FA2771Eu, 0x1E601D29u, 0x1B2F0BACu, 0x1AED619Bu, 0x18ABDFC2u, 0x1969B5F5u, 0x1235F2C8u, 0x13F798FFu, 0x11B126A6u, 0x10734C91u, 0x153C5A14u, 0x14FE3023u, 0x16B88E7Au, 0x177AE44Du,
+    0x384D46E0u, 0x398F2CD7u, 0x3BC9928Eu, 0x3A0BF8B9u, 0x3F44EE3Cu, 0x3E86840Bu, 0x3CC03A52u, 0x3D025065u, 0x365E1758u, 0x379C7D6Fu, 0x35DAC336u, 0x3418A901u, 0x3157BF84u, 0x3095D5B3u, 0x32D36BEAu, 0x331101DDu,
+    0x246BE590u, 0x25A98FA7u, 0x27EF31FEu, 0x262D5BC9u, 0x23624D4Cu, 0x22A0277Bu, 0x20E69922u, 0x2124F315u, 0x2A78B428u, 0x2BBADE1Fu, 0x29FC6046u, 0x283E0A71u, 0x2D711CF4u, 0x2CB376C3u, 0x2EF5C89Au, 0x2F37A2ADu,
+    0x709A8DC0u, 0x7158E7F7u, 0x731E59AEu, 0x72DC3399u, 0x7793251Cu, 0x76514F2Bu, 0x7417F172u, 0x75D59B45u, 0x7E89DC78u, 0x7F4BB64Fu, 0x7D0D0816u, 0x7CCF6221u, 0x798074A4u, 0x78421E93u, 0x7A04A0CAu, 0x7BC6CAFDu,
+    0x6CBC2EB0u, 0x6D7E4487u, 0x6F38FADEu, 0x6EFA90E9u, 0x6BB5866Cu, 0x6A77EC5Bu, 0x68315202u, 0x69F33835u, 0x62AF7F08u, 0x636D153Fu, 0x612BAB66u, 0x60E9C151u, 0x65A6D7D4u, 0x6464BDE3u, 0x662203BAu, 0x67E0698Du,
+    0x48D7CB20u, 0x4915A117u, 0x4B531F4Eu, 0x4A917579u, 0x4FDE63FCu, 0x4E1C09CBu, 0x4C5AB792u, 0x4D98DDA5u, 0x46C49A98u, 0x4706F0AFu, 0x45404EF6u, 0x448224C1u, 0x41CD3244u, 0x400F5873u, 0x4249E62Au, 0x438B8C1Du,
+    0x54F16850u, 0x55330267u, 0x5775BC3Eu, 0x56B7D609u, 0x53F8C08Cu, 0x523AAABBu, 0x507C14E2u, 0x51BE7ED5u, 0x5AE239E8u, 0x5B2053DFu, 0x5966ED86u, 0x58A487B1u, 0x5DEB9134u, 0x5C29FB03u, 0x5E6F455Au, 0x5FAD2F6Du,
+    0xE1351B80u, 0xE0F771B7u, 0xE2B1CFEEu, 0xE373A5D9u, 0xE63CB35Cu, 0xE7FED96Bu, 0xE5B86732u, 0xE47A0D05u, 0xEF264A38u, 0xEEE4200Fu, 0xECA29E56u, 0xED60F461u, 0xE82FE2E4u, 0xE9ED88D3u, 0xEBAB368Au, 0xEA695CBDu,
+    0xFD13B8F0u, 0xFCD1D2C7u, 0xFE976C9Eu, 0xFF5506A9u, 0xFA1A102Cu, 0xFBD87A1Bu, 0xF99EC442u, 0xF85CAE75u, 0xF300E948u, 0xF2C2837Fu, 0xF0843D26u, 0xF1465711u, 0xF4094194u, 0xF5CB2BA3u, 0xF78D95FAu, 0xF64FFFCDu,
+    0xD9785D60u, 0xD8BA3757u, 0xDAFC890Eu, 0xDB3EE339u, 0xDE71F5BCu, 0xDFB39F8Bu, 0xDDF521D2u, 0xDC374BE5u, 0xD76B0CD8u, 0xD6A966EFu, 0xD4EFD8B6u, 0xD52DB281u, 0xD062A404u, 0xD1A0CE33u, 0xD3E6706Au, 0xD2241A5Du,
+    0xC55EFE10u, 0xC49C9427u, 0xC6DA2A7Eu, 0xC7184049u, 0xC25756CCu, 0xC3953CFBu, 0xC1D382A2u, 0xC011E895u, 0xCB4DAFA8u, 0xCA8FC59Fu, 0xC8C97BC6u, 0xC90B11F1u, 0xCC440774u, 0xCD866D43u, 0xCFC0D31Au, 0xCE02B92Du,
+    0x91AF9640u, 0x906DFC77u, 0x922B422Eu, 0x93E92819u, 0x96A63E9Cu, 0x976454ABu, 0x9522EAF2u, 0x94E080C5u, 0x9FBCC7F8u, 0x9E7EADCFu, 0x9C381396u, 0x9DFA79A1u, 0x98B56F24u, 0x99770513u, 0x9B31BB4Au, 0x9AF3D17Du,
+    0x8D893530u, 0x8C4B5F07u, 0x8E0DE15Eu, 0x8FCF8B69u, 0x8A809DECu, 0x8B42F7DBu, 0x89044982u, 0x88C623B5u, 0x839A6488u, 0x82580EBFu, 0x801EB0E6u, 0x81DCDAD1u, 0x8493CC54u, 0x8551A663u, 0x8717183Au, 0x86D5720Du,
+    0xA9E2D0A0u, 0xA820BA97u, 0xAA6604CEu, 0xABA46EF9u, 0xAEEB787Cu, 0xAF29124Bu, 0xAD6FAC12u, 0xACADC625u, 0xA7F18118u, 0xA633EB2Fu, 0xA4755576u, 0xA5B73F41u, 0xA0F829C4u, 0xA13A43F3u, 0xA37CFDAAu, 0xA2BE979Du,
+    0xB5C473D0u, 0xB40619E7u, 0xB640A7BEu, 0xB782CD89u, 0xB2CDDB0Cu, 0xB30FB13Bu, 0xB1490F62u, 0xB08B6555u, 0xBBD72268u, 0xBA15485Fu, 0xB853F606u, 0xB9919C31u, 0xBCDE8AB4u, 0xBD1CE083u, 0xBF5A5EDAu, 0xBE9834EDu,
+    0x00000000u, 0xB8BC6765u, 0xAA09C88Bu, 0x12B5AFEEu, 0x8F629757u, 0x37DEF032u, 0x256B5FDCu, 0x9DD738B9u, 0xC5B428EFu, 0x7D084F8Au, 0x6FBDE064u, 0xD7018701u, 0x4AD6BFB8u, 0xF26AD8DDu, 0xE0DF7733u, 0x58631056u,
+    0x5019579Fu, 0xE8A530FAu, 0xFA109F14u, 0x42ACF871u, 0xDF7BC0C8u, 0x67C7A7ADu, 0x75720843u, 0xCDCE6F26u, 0x95AD7F70u, 0x2D111815u, 0x3FA4B7FBu, 0x8718D09Eu, 0x1ACFE827u, 0xA2738F42u, 0xB0C620ACu, 0x087A47C9u,
+    0xA032AF3Eu, 0x188EC85Bu, 0x0A3B67B5u, 0xB28700D0u, 0x2F503869u, 0x97EC5F0Cu, 0x8559F0E2u, 0x3DE59787u, 0x658687D1u, 0xDD3AE0B4u, 0xCF8F4F5Au, 0x7733283Fu, 0xEAE41086u, 0x525877E3u, 0x40EDD80Du, 0xF851BF68u,
+    0xF02BF8A1u, 0x48979FC4u, 0x5A22302Au, 0xE29E574Fu, 0x7F496FF6u, 0xC7F50893u, 0xD540A77Du, 0x6DFCC018u, 0x359FD04Eu, 0x8D23B72Bu, 0x9F9618C5u, 0x272A7FA0u, 0xBAFD4719u, 0x0241207Cu, 0x10F48F92u, 0xA848E8F7u,
+    0x9B14583Du, 0x23A83F58u, 0x311D90B6u, 0x89A1F7D3u, 0x1476CF6Au, 0xACCAA80Fu, 0xBE7F07E1u, 0x06C36084u, 0x5EA070D2u, 0xE61C17B7u, 0xF4A9B859u, 0x4C15DF3Cu, 0xD1C2E785u, 0x697E80E0u, 0x7BCB2F0Eu, 0xC377486Bu,
+    0xCB0D0FA2u, 0x73B168C7u, 0x6104C729u, 0xD9B8A04Cu, 0x446F98F5u, 0xFCD3FF90u, 0xEE66507Eu, 0x56DA371Bu, 0x0EB9274Du, 0xB6054028u, 0xA4B0EFC6u, 0x1C0C88A3u, 0x81DBB01Au, 0x3967D77Fu, 0x2BD27891u, 0x936E1FF4u,
+    0x3B26F703u, 0x839A9066u, 0x912F3F88u, 0x299358EDu, 0xB4446054u, 0x0CF80731u, 0x1E4DA8DFu, 0xA6F1CFBAu, 0xFE92DFECu, 0x462EB889u, 0x549B1767u, 0xEC277002u, 0x71F048BBu, 0xC94C2FDEu, 0xDBF98030u, 0x6345E755u,
+    0x6B3FA09Cu, 0xD383C7F9u, 0xC1366817u, 0x798A0F72u, 0xE45D37CBu, 0x5CE150AEu, 0x4E54FF40u, 0xF6E89825u, 0xAE8B8873u, 0x1637EF16u, 0x048240F8u, 0xBC3E279Du, 0x21E91F24u, 0x99557841u, 0x8BE0D7AFu, 0x335CB0CAu,
+    0xED59B63Bu, 0x55E5D15Eu, 0x47507EB0u, 0xFFEC19D5u, 0x623B216Cu, 0xDA874609u, 0xC832E9E7u, 0x708E8E82u, 0x28ED9ED4u, 0x9051F9B1u, 0x82E4565Fu, 0x3A58313Au, 0xA78F0983u, 0x1F336EE6u, 0x0D86C108u, 0xB53AA66Du,
+    0xBD40E1A4u, 0x05FC86C1u, 0x1749292Fu, 0xAFF54E4Au, 0x322276F3u, 0x8A9E1196u, 0x982BBE78u, 0x2097D91Du, 0x78F4C94Bu, 0xC048AE2Eu, 0xD2FD01C0u, 0x6A4166A5u, 0xF7965E1Cu, 0x4F2A3979u, 0x5D9F9697u, 0xE523F1F2u,
+    0x4D6B1905u, 0xF5D77E60u, 0xE762D18Eu, 0x5FDEB6EBu, 0xC2098E52u, 0x7AB5E937u, 0x680046D9u, 0xD0BC21BCu, 0x88DF31EAu, 0x3063568Fu, 0x22D6F961u, 0x9A6A9E04u, 0x07BDA6BDu, 0xBF01C1D8u, 0xADB46E36u, 0x15080953u,
+    0x1D724E9Au, 0xA5CE29FFu, 0xB77B8611u, 0x0FC7E174u, 0x9210D9CDu, 0x2AACBEA8u, 0x38191146u, 0x80A57623u, 0xD8C66675u, 0x607A0110u, 0x72CFAEFEu, 0xCA73C99Bu, 0x57A4F122u, 0xEF189647u, 0xFDAD39A9u, 0x45115ECCu,
+    0x764DEE06u, 0xCEF18963u, 0xDC44268Du, 0x64F841E8u, 0xF92F7951u, 0x41931E34u, 0x5326B1DAu, 0xEB9AD6BFu, 0xB3F9C6E9u, 0x0B45A18Cu, 0x19F00E62u, 0xA14C6907u, 0x3C9B51BEu, 0x842736DBu, 0x96929935u, 0x2E2EFE50u,
+    0x2654B999u, 0x9EE8DEFCu, 0x8C5D7112u, 0x34E11677u, 0xA9362ECEu, 0x118A49ABu, 0x033FE645u, 0xBB838120u, 0xE3E09176u, 0x5B5CF613u, 0x49E959FDu, 0xF1553E98u, 0x6C820621u, 0xD43E6144u, 0xC68BCEAAu, 0x7E37A9CFu,
+    0xD67F4138u, 0x6EC3265Du, 0x7C7689B3u, 0xC4CAEED6u, 0x591DD66Fu, 0xE1A1B10Au, 0xF3141EE4u, 0x4BA87981u, 0x13CB69D7u, 0xAB770EB2u, 0xB9C2A15Cu, 0x017EC639u, 0x9CA9FE80u, 0x241599E5u, 0x36A0360Bu, 0x8E1C516Eu,
+    0x866616A7u, 0x3EDA71C2u, 0x2C6FDE2Cu, 0x94D3B949u, 0x090481F0u, 0xB1B8E695u, 0xA30D497Bu, 0x1BB12E1Eu, 0x43D23E48u, 0xFB6E592Du, 0xE9DBF6C3u, 0x516791A6u, 0xCCB0A91Fu, 0x740CCE7Au, 0x66B96194u, 0xDE0506F1u,
+    0x00000000u, 0x3D6029B0u, 0x7AC05360u, 0x47A07AD0u, 0xF580A6C0u, 0xC8E08F70u, 0x8F40F5A0u, 0xB220DC10u, 0x30704BC1u, 0x0D106271u, 0x4AB018A1u, 0x77D03111u, 0xC5F0ED01u, 0xF890C4B1u, 0xBF30BE61u, 0x825097D1u,
+    0x60E09782u, 0x5D80BE32u, 0x1A20C4E2u, 0x2740ED52u, 0x95603142u, 0xA80018F2u, 0xEFA06222u, 0xD2C04B92u, 0x5090DC43u, 0x6DF0F5F3u, 0x2A508F23u, 0x1730A693u, 0xA5107A83u, 0x98705333u, 0xDFD029E3u, 0xE2B00053u,
+    0xC1C12F04u, 0xFCA106B4u, 0xBB017C64u, 0x866155D4u, 0x344189C4u, 0x0921A074u, 0x4E81DAA4u, 0x73E1F314u, 0xF1B164C5u, 0xCCD14D75u, 0x8B7137A5u, 0xB6111E15u, 0x0431C205u, 0x3951EBB5u, 0x7EF19165u, 0x4391B8D5u,
+    0xA121B886u, 0x9C419136u, 0xDBE1EBE6u, 0xE681C256u, 0x54A11E46u, 0x69C137F6u, 0x2E614D26u, 0x13016496u, 0x9151F347u, 0xAC31DAF7u, 0xEB91A027u, 0xD6F18997u, 0x64D15587u, 0x59B17C37u, 0x1E1106E7u, 0x23712F57u,
+    0x58F35849u, 0x659371F9u, 0x22330B29u, 0x1F532299u, 0xAD73FE89u, 0x9013D739u, 0xD7B3ADE9u, 0xEAD38459u, 0x68831388u, 0x55E33A38u, 0x124340E8u, 0x2F236958u, 0x9D03B548u, 0xA0639CF8u, 0xE7C3E628u, 0xDAA3CF98u,
+    0x3813CFCBu, 0x0573E67Bu, 0x42D39CABu, 0x7FB3B51Bu, 0xCD93690Bu, 0xF0F340BBu, 0xB7533A6Bu, 0x8A3313DBu, 0x0863840Au, 0x3503ADBAu, 0x72A3D76Au, 0x4FC3FEDAu, 0xFDE322CAu, 0xC0830B7Au, 0x872371AAu, 0xBA43581Au,
+    0x9932774Du, 0xA4525EFDu, 0xE3F2242Du, 0xDE920D9Du, 0x6CB2D18Du, 0x51D2F83Du, 0x167282EDu, 0x2B12AB5Du, 0xA9423C8Cu, 0x9422153Cu, 0xD3826FECu, 0xEEE2465Cu, 0x5CC29A4Cu, 0x61A2B3FCu, 0x2602C92Cu, 0x1B62E09Cu,
+    0xF9D2E0CFu, 0xC4B2C97Fu, 0x8312B3AFu, 0xBE729A1Fu, 0x0C52460Fu, 0x31326FBFu, 0x7692156Fu, 0x4BF23CDFu, 0xC9A2AB0Eu, 0xF4C282BEu, 0xB362F86Eu, 0x8E02D1DEu, 0x3C220DCEu, 0x0142247Eu, 0x46E25EAEu, 0x7B82771Eu,
+    0xB1E6B092u, 0x8C869922u, 0xCB26E3F2u, 0xF646CA42u, 0x44661652u, 0x79063FE2u, 0x3EA64532u, 0x03C66C82u, 0x8196FB53u, 0xBCF6D2E3u, 0xFB56A833u, 0xC6368183u, 0x74165D93u, 0x49767423u, 0x0ED60EF3u, 0x33B62743u,
+    0xD1062710u, 0xEC660EA0u, 0xABC67470u, 0x96A65DC0u, 0x248681D0u, 0x19E6A860u, 0x5E46D2B0u, 0x6326FB00u, 0xE1766CD1u, 0xDC164561u, 0x9BB63FB1u, 0xA6D61601u, 0x14F6CA11u, 0x2996E3A1u, 0x6E369971u, 0x5356B0C1u,
+    0x70279F96u, 0x4D47B626u, 0x0AE7CCF6u, 0x3787E546u, 0x85A73956u, 0xB8C710E6u, 0xFF676A36u, 0xC2074386u, 0x4057D457u, 0x7D37FDE7u, 0x3A978737u, 0x07F7AE87u, 0xB5D77297u, 0x88B75B27u, 0xCF1721F7u, 0xF2770847u,
+    0x10C70814u, 0x2DA721A4u, 0x6A075B74u, 0x576772C4u, 0xE547AED4u, 0xD8278764u, 0x9F87FDB4u, 0xA2E7D404u, 0x20B743D5u, 0x1DD76A65u, 0x5A7710B5u, 0x67173905u, 0xD537E515u, 0xE857CCA5u, 0xAFF7B675u, 0x92979FC5u,
+    0xE915E8DBu, 0xD475C16Bu, 0x93D5BBBBu, 0xAEB5920Bu, 0x1C954E1Bu, 0x21F567ABu, 0x66551D7Bu, 0x5B3534CBu, 0xD965A31Au, 0xE4058AAAu, 0xA3A5F07Au, 0x9EC5D9CAu, 0x2CE505DAu, 0x11852C6Au, 0x562556BAu, 0x6B457F0Au,
+    0x89F57F59u, 0xB49556E9u, 0xF3352C39u, 0xCE550589u, 0x7C75D999u, 0x4115F029u, 0x06B58AF9u, 0x3BD5A349u, 0xB9853498u, 0x84E51D28u, 0xC34567F8u, 0xFE254E48u, 0x4C059258u, 0x7165BBE8u, 0x36C5C138u, 0x0BA5E888u,
+    0x28D4C7DFu, 0x15B4EE6Fu, 0x521494BFu, 0x6F74BD0Fu, 0xDD54611Fu, 0xE03448AFu, 0xA794327Fu, 0x9AF41BCFu, 0x18A48C1Eu, 0x25C4A5AEu, 0x6264DF7Eu, 0x5F04F6CEu, 0xED242ADEu, 0xD044036Eu, 0x97E479BEu, 0xAA84500Eu,
+    0x4834505Du, 0x755479EDu, 0x32F4033Du, 0x0F942A8Du, 0xBDB4F69Du, 0x80D4DF2Du, 0xC774A5FDu, 0xFA148C4Du, 0x78441B9Cu, 0x4524322Cu, 0x028448FCu, 0x3FE4614Cu, 0x8DC4BD5Cu, 0xB0A494ECu, 0xF704EE3Cu, 0xCA64C78Cu,
+    0x00000000u, 0xCB5CD3A5u, 0x4DC8A10Bu, 0x869472AEu, 0x9B914216u, 0x50CD91B3u, 0xD659E31Du, 0x1D0530B8u, 0xEC53826Du, 0x270F51C8u, 0xA19B2366u, 0x6AC7F0C3u, 0x77C2C07Bu, 0xBC9E13DEu, 0x3A0A6170u, 0xF156B2D5u,
+    0x03D6029Bu, 0xC88AD13Eu, 0x4E1EA390u, 0x85427035u, 0x9847408Du, 0x531B9328u, 0xD58FE186u, 0x1ED33223u, 0xEF8580F6u, 0x24D95353u, 0xA24D21FDu, 0x6911F258u, 0x7414C2E0u, 0xBF481145u, 0x39DC63EBu, 0xF280B04Eu,
+    0x07AC0536u, 0xCCF0D693u, 0x4A64A43Du, 0x81387798u, 0x9C3D4720u, 0x57619485u, 0xD1F5E62Bu, 0x1AA9358Eu, 0xEBFF875Bu, 0x20A354FEu, 0xA6372650u, 0x6D6BF5F5u, 0x706EC54Du, 0xBB3216E8u, 0x3DA66446u, 0xF6FAB7E3u,
+    0x047A07ADu, 0xCF26D408u, 0x49B2A6A6u, 0x82EE7503u, 0x9FEB45BBu, 0x54B7961Eu, 0xD223E4B0u, 0x197F3715u, 0xE82985C0u, 0x23755665u, 0xA5E124CBu, 0x6EBDF76Eu, 0x73B8C7D6u, 0xB8E41473u, 0x3E7066DDu, 0xF52CB578u,
+    0x0F580A6Cu, 0xC404D9C9u, 0x4290AB67u, 0x89CC78C2u, 0x94C9487Au, 0x5F959BDFu, 0xD901E971u, 0x125D3AD4u, 0xE30B8801u, 0x28575BA4u, 0xAEC3290Au, 0x659FFAAFu, 0x789ACA17u, 0xB3C619B2u, 0x35526B1Cu, 0xFE0EB8B9u,
+    0x0C8E08F7u, 0xC7D2DB52u, 0x4146A9FCu, 0x8A1A7A59u, 0x971F4AE1u, 0x5C439944u, 0xDAD7EBEAu, 0x118B384Fu, 0xE0DD8A9Au, 0x2B81593Fu, 0xAD152B91u, 0x6649F834u, 0x7B4CC88Cu, 0xB0101B29u, 0x36846987u, 0xFDD8BA22u,
+    0x08F40F5Au, 0xC3A8DCFFu, 0x453CAE51u, 0x8E607DF4u, 0x93654D4Cu, 0x58399EE9u, 0xDEADEC47u, 0x15F13FE2u, 0xE4A78D37u, 0x2FFB5E92u, 0xA96F2C3Cu, 0x6233FF99u, 0x7F36CF21u, 0xB46A1C84u, 0x32FE6E2Au, 0xF9A2BD8Fu,
+    0x0B220DC1u, 0xC07EDE64u, 0x46EAACCAu, 0x8DB67F6Fu, 0x90B34FD7u, 0x5BEF9C72u, 0xDD7BEEDCu, 0x16273D79u, 0xE7718FACu, 0x2C2D5C09u, 0xAAB92EA7u, 0x61E5FD02u, 0x7CE0CDBAu, 0xB7BC1E1Fu, 0x31286CB1u, 0xFA74BF14u,
+    0x1EB014D8u, 0xD5ECC77Du, 0x5378B5D3u, 0x98246676u, 0x852156CEu, 0x4E7D856Bu, 0xC8E9F7C5u, 0x03B52460u, 0xF2E396B5u, 0x39BF4510u, 0xBF2B37BEu, 0x7477E41Bu, 0x6972D4A3u, 0xA22E0706u, 0x24BA75A8u, 0xEFE6A60Du,
+    0x1D661643u, 0xD63AC5E6u, 0x50AEB748u, 0x9BF264EDu, 0x86F75455u, 0x4DAB87F0u, 0xCB3FF55Eu, 0x006326FBu, 0xF135942Eu, 0x3A69478Bu, 0xBCFD3525u, 0x77A1E680u, 0x6AA4D638u, 0xA1F8059Du, 0x276C7733u, 0xEC30A496u,
+    0x191C11EEu, 0xD240C24Bu, 0x54D4B0E5u, 0x9F886340u, 0x828D53F8u, 0x49D1805Du, 0xCF45F2F3u, 0x04192156u, 0xF54F9383u, 0x3E134026u, 0xB8873288u, 0x73DBE12Du, 0x6EDED195u, 0xA5820230u, 0x2316709Eu, 0xE84AA33Bu,
+    0x1ACA1375u, 0xD196C0D0u, 0x5702B27Eu, 0x9C5E61DBu, 0x815B5163u, 0x4A0782C6u, 0xCC93F068u, 0x07CF23CDu, 0xF6999118u, 0x3DC542BDu, 0xBB513013u, 0x700DE3B6u, 0x6D08D30Eu, 0xA65400ABu, 0x20C07205u, 0xEB9CA1A0u,
+    0x11E81EB4u, 0xDAB4CD11u, 0x5C20BFBFu, 0x977C6C1Au, 0x8A795CA2u, 0x41258F07u, 0xC7B1FDA9u, 0x0CED2E0Cu, 0xFDBB9CD9u, 0x36E74F7Cu, 0xB0733DD2u, 0x7B2FEE77u, 0x662ADECFu, 0xAD760D6Au, 0x2BE27FC4u, 0xE0BEAC61u,
+    0x123E1C2Fu, 0xD962CF8Au, 0x5FF6BD24u, 0x94AA6E81u, 0x89AF5E39u, 0x42F38D9Cu, 0xC467FF32u, 0x0F3B2C97u, 0xFE6D9E42u, 0x35314DE7u, 0xB3A53F49u, 0x78F9ECECu, 0x65FCDC54u, 0xAEA00FF1u, 0x28347D5Fu, 0xE368AEFAu,
+    0x16441B82u, 0xDD18C827u, 0x5B8CBA89u, 0x90D0692Cu, 0x8DD55994u, 0x46898A31u, 0xC01DF89Fu, 0x0B412B3Au, 0xFA1799EFu, 0x314B4A4Au, 0xB7DF38E4u, 0x7C83EB41u, 0x6186DBF9u, 0xAADA085Cu, 0x2C4E7AF2u, 0xE712A957u,
+    0x15921919u, 0xDECECABCu, 0x585AB812u, 0x93066BB7u, 0x8E035B0Fu, 0x455F88AAu, 0xC3CBFA04u, 0x089729A1u, 0xF9C19B74u, 0x329D48D1u, 0xB4093A7Fu, 0x7F55E9DAu, 0x6250D962u, 0xA90C0AC7u, 0x2F987869u, 0xE4C4ABCCu,
+    0x00000000u, 0xA6770BB4u, 0x979F1129u, 0x31E81A9Du, 0xF44F2413u, 0x52382FA7u, 0x63D0353Au, 0xC5A73E8Eu, 0x33EF4E67u, 0x959845D3u, 0xA4705F4Eu, 0x020754FAu, 0xC7A06A74u, 0x61D761C0u, 0x503F7B5Du, 0xF64870E9u,
+    0x67DE9CCEu, 0xC1A9977Au, 0xF0418DE7u, 0x56368653u, 0x9391B8DDu, 0x35E6B369u, 0x040EA9F4u, 0xA279A240u, 0x5431D2A9u, 0xF246D91Du, 0xC3AEC380u, 0x65D9C834u, 0xA07EF6BAu, 0x0609FD0Eu, 0x37E1E793u, 0x9196EC27u,
+    0xCFBD399Cu, 0x69CA3228u, 0x582228B5u, 0xFE552301u, 0x3BF21D8Fu, 0x9D85163Bu, 0xAC6D0CA6u, 0x0A1A0712u, 0xFC5277FBu, 0x5A257C4Fu, 0x6BCD66D2u, 0xCDBA6D66u, 0x081D53E8u, 0xAE6A585Cu, 0x9F8242C1u, 0x39F54975u,
+    0xA863A552u, 0x0E14AEE6u, 0x3FFCB47Bu, 0x998BBFCFu, 0x5C2C8141u, 0xFA5B8AF5u, 0xCBB39068u, 0x6DC49BDCu, 0x9B8CEB35u, 0x3DFBE081u, 0x0C13FA1Cu, 0xAA64F1A8u, 0x6FC3CF26u, 0xC9B4C492u, 0xF85CDE0Fu, 0x5E2BD5BBu,
+    0x440B7579u, 0xE27C7ECDu, 0xD3946450u, 0x75E36FE4u, 0xB044516Au, 0x16335ADEu, 0x27DB4043u, 0x81AC4BF7u, 0x77E43B1Eu, 0xD19330AAu, 0xE07B2A37u, 0x460C2183u, 0x83AB1F0Du, 0x25DC14B9u, 0x14340E24u, 0xB2430590u,
+    0x23D5E9B7u, 0x85A2E203u, 0xB44AF89Eu, 0x123DF32Au, 0xD79ACDA4u, 0x71EDC610u, 0x4005DC8Du, 0xE672D739u, 0x103AA7D0u, 0xB64DAC64u, 0x87A5B6F9u, 0x21D2BD4Du, 0xE47583C3u, 0x42028877u, 0x73EA92EAu, 0xD59D995Eu,
+    0x8BB64CE5u, 0x2DC14751u, 0x1C295DCCu, 0xBA5E5678u, 0x7FF968F6u, 0xD98E6342u, 0xE86679DFu, 0x4E11726Bu, 0xB8590282u, 0x1E2E0936u, 0x2FC613ABu, 0x89B1181Fu, 0x4C162691u, 0xEA612D25u, 0xDB8937B8u, 0x7DFE3C0Cu,
+    0xEC68D02Bu, 0x4A1FDB9Fu, 0x7BF7C102u, 0xDD80CAB6u, 0x1827F438u, 0xBE50FF8Cu, 0x8FB8E511u, 0x29CFEEA5u, 0xDF879E4Cu, 0x79F095F8u, 0x48188F65u, 0xEE6F84D1u, 0x2BC8BA5Fu, 0x8DBFB1EBu, 0xBC57AB76u, 0x1A20A0C2u,
+    0x8816EAF2u, 0x2E61E146u, 0x1F89FBDBu, 0xB9FEF06Fu, 0x7C59CEE1u, 0xDA2EC555u, 0xEBC6DFC8u, 0x4DB1D47Cu, 0xBBF9A495u, 0x1D8EAF21u, 0x2C66B5BCu, 0x8A11BE08u, 0x4FB68086u, 0xE9C18B32u, 0xD82991AFu, 0x7E5E9A1Bu,
+    0xEFC8763Cu, 0x49BF7D88u, 0x78576715u, 0xDE206CA1u, 0x1B87522Fu, 0xBDF0599Bu, 0x8C184306u, 0x2A6F48B2u, 0xDC27385Bu, 0x7A5033EFu, 0x4BB82972u, 0xEDCF22C6u, 0x28681C48u, 0x8E1F17FCu, 0xBFF70D61u, 0x198006D5u,
+    0x47ABD36Eu, 0xE1DCD8DAu, 0xD034C247u, 0x7643C9F3u, 0xB3E4F77Du, 0x1593FCC9u, 0x247BE654u, 0x820CEDE0u, 0x74449D09u, 0xD23396BDu, 0xE3DB8C20u, 0x45AC8794u, 0x800BB91Au, 0x267CB2AEu, 0x1794A833u, 0xB1E3A387u,
+    0x20754FA0u, 0x86024414u, 0xB7EA5E89u, 0x119D553Du, 0xD43A6BB3u, 0x724D6007u, 0x43A57A9Au, 0xE5D2712Eu, 0x139A01C7u, 0xB5ED0A73u, 0x840510EEu, 0x22721B5Au, 0xE7D525D4u, 0x41A22E60u, 0x704A34FDu, 0xD63D3F49u,
+    0xCC1D9F8Bu, 0x6A6A943Fu, 0x5B828EA2u, 0xFDF58516u, 0x3852BB98u, 0x9E25B02Cu, 0xAFCDAAB1u, 0x09BAA105u, 0xFFF2D1ECu, 0x5985DA58u, 0x686DC0C5u, 0xCE1ACB71u, 0x0BBDF5FFu, 0xADCAFE4Bu, 0x9C22E4D6u, 0x3A55EF62u,
+    0xABC30345u, 0x0DB408F1u, 0x3C5C126Cu, 0x9A2B19D8u, 0x5F8C2756u, 0xF9FB2CE2u, 0xC813367Fu, 0x6E643DCBu, 0x982C4D22u, 0x3E5B4696u, 0x0FB35C0Bu, 0xA9C457BFu, 0x6C636931u, 0xCA146285u, 0xFBFC7818u, 0x5D8B73ACu,
+    0x03A0A617u, 0xA5D7ADA3u, 0x943FB73Eu, 0x3248BC8Au, 0xF7EF8204u, 0x519889B0u, 0x6070932Du, 0xC6079899u, 0x304FE870u, 0x9638E3C4u, 0xA7D0F959u, 0x01A7F2EDu, 0xC400CC63u, 0x6277C7D7u, 0x539FDD4Au, 0xF5E8D6FEu,
+    0x647E3AD9u, 0xC209316Du, 0xF3E12BF0u, 0x55962044u, 0x90311ECAu, 0x3646157Eu, 0x07AE0FE3u, 0xA1D90457u, 0x579174BEu, 0xF1E67F0Au, 0xC00E6597u, 0x66796E23u, 0xA3DE50ADu, 0x05A95B19u, 0x34414184u, 0x92364A30u,
+    0x00000000u, 0xCCAA009Eu, 0x4225077Du, 0x8E8F07E3u, 0x844A0EFAu, 0x48E00E64u, 0xC66F0987u, 0x0AC50919u, 0xD3E51BB5u, 0x1F4F1B2Bu, 0x91C01CC8u, 0x5D6A1C56u, 0x57AF154Fu, 0x9B0515D1u, 0x158A1232u, 0xD92012ACu,
+    0x7CBB312Bu, 0xB01131B5u, 0x3E9E3656u, 0xF23436C8u, 0xF8F13FD1u, 0x345B3F4Fu, 0xBAD438ACu, 0x767E3832u, 0xAF5E2A9Eu, 0x63F42A00u, 0xED7B2DE3u, 0x21D12D7Du, 0x2B142464u, 0xE7BE24FAu, 0x69312319u, 0xA59B2387u,
+    0xF9766256u, 0x35DC62C8u, 0xBB53652Bu, 0x77F965B5u, 0x7D3C6CACu, 0xB1966C32u, 0x3F196BD1u, 0xF3B36B4Fu, 0x2A9379E3u, 0xE639797Du, 0x68B67E9Eu, 0xA41C7E00u, 0xAED97719u, 0x62737787u, 0xECFC7064u, 0x205670FAu,
+    0x85CD537Du, 0x496753E3u, 0xC7E85400u, 0x0B42549Eu, 0x01875D87u, 0xCD2D5D19u, 0x43A25AFAu, 0x8F085A64u, 0x562848C8u, 0x9A824856u, 0x140D4FB5u, 0xD8A74F2Bu, 0xD2624632u, 0x1EC846ACu, 0x9047414Fu, 0x5CED41D1u,
+    0x299DC2EDu, 0xE537C273u, 0x6BB8C590u, 0xA712C50Eu, 0xADD7CC17u, 0x617DCC89u, 0xEFF2CB6Au, 0x2358CBF4u, 0xFA78D958u, 0x36D2D9C6u, 0xB85DDE25u, 0x74F7DEBBu, 0x7E32D7A2u, 0xB298D73Cu, 0x3C17D0DFu, 0xF0BDD041u,
+    0x5526F3C6u, 0x998CF358u, 0x1703F4BBu, 0xDBA9F425u, 0xD16CFD3Cu, 0x1DC6FDA2u, 0x9349FA41u, 0x5FE3FADFu, 0x86C3E873u, 0x4A69E8EDu, 0xC4E6EF0Eu, 0x084CEF90u, 0x0289E689u, 0xCE23E617u, 0x40ACE1F4u, 0x8C06E16Au,
+    0xD0EBA0BBu, 0x1C41A025u, 0x92CEA7C6u, 0x5E64A758u, 0x54A1AE41u, 0x980BAEDFu, 0x1684A93Cu, 0xDA2EA9A2u, 0x030EBB0Eu, 0xCFA4BB90u, 0x412BBC73u, 0x8D81BCEDu, 0x8744B5F4u, 0x4BEEB56Au, 0xC561B289u, 0x09CBB217u,
+    0xAC509190u, 0x60FA910Eu, 0xEE7596EDu, 0x22DF9673u, 0x281A9F6Au, 0xE4B09FF4u, 0x6A3F9817u, 0xA6959889u, 0x7FB58A25u, 0xB31F8ABBu, 0x3D908D58u, 0xF13A8DC6u, 0xFBFF84DFu, 0x37558441u, 0xB9DA83A2u, 0x7570833Cu,
+    0x533B85DAu, 0x9F918544u, 0x111E82A7u, 0xDDB48239u, 0xD7718B20u, 0x1BDB8BBEu, 0x95548C5Du, 0x59FE8CC3u, 0x80DE9E6Fu, 0x4C749EF1u, 0xC2FB9912u, 0x0E51998Cu, 0x04949095u, 0xC83E900Bu, 0x46B197E8u, 0x8A1B9776u,
+    0x2F80B4F1u, 0xE32AB46Fu, 0x6DA5B38Cu, 0xA10FB312u, 0xABCABA0Bu, 0x6760BA95u, 0xE9EFBD76u, 0x2545BDE8u, 0xFC65AF44u, 0x30CFAFDAu, 0xBE40A839u, 0x72EAA8A7u, 0x782FA1BEu, 0xB485A120u, 0x3A0AA6C3u, 0xF6A0A65Du,
+    0xAA4DE78Cu, 0x66E7E712u, 0xE868E0F1u, 0x24C2E06Fu, 0x2E07E976u, 0xE2ADE9E8u, 0x6C22EE0Bu, 0xA088EE95u, 0x79A8FC39u, 0xB502FCA7u, 0x3B8DFB44u, 0xF727FBDAu, 0xFDE2F2C3u, 0x3148F25Du, 0xBFC7F5BEu, 0x736DF520u,
+    0xD6F6D6A7u, 0x1A5CD639u, 0x94D3D1DAu, 0x5879D144u, 0x52BCD85Du, 0x9E16D8C3u, 0x1099DF20u, 0xDC33DFBEu, 0x0513CD12u, 0xC9B9CD8Cu, 0x4736CA6Fu, 0x8B9CCAF1u, 0x8159C3E8u, 0x4DF3C376u, 0xC37CC495u, 0x0FD6C40Bu,
+    0x7AA64737u, 0xB60C47A9u, 0x3883404Au, 0xF42940D4u, 0xFEEC49CDu, 0x32464953u, 0xBCC94EB0u, 0x70634E2Eu, 0xA9435C82u, 0x65E95C1Cu, 0xEB665BFFu, 0x27CC5B61u, 0x2D095278u, 0xE1A352E6u, 0x6F2C5505u, 0xA386559Bu,
+    0x061D761Cu, 0xCAB77682u, 0x44387161u, 0x889271FFu, 0x825778E6u, 0x4EFD7878u, 0xC0727F9Bu, 0x0CD87F05u, 0xD5F86DA9u, 0x19526D37u, 0x97DD6AD4u, 0x5B776A4Au, 0x51B26353u, 0x9D1863CDu, 0x1397642Eu, 0xDF3D64B0u,
+    0x83D02561u, 0x4F7A25FFu, 0xC1F5221Cu, 0x0D5F2282u, 0x079A2B9Bu, 0xCB302B05u, 0x45BF2CE6u, 0x89152C78u, 0x50353ED4u, 0x9C9F3E4Au, 0x121039A9u, 0xDEBA3937u, 0xD47F302Eu, 0x18D530B0u, 0x965A3753u, 0x5AF037CDu,
+    0xFF6B144Au, 0x33C114D4u, 0xBD4E1337u, 0x71E413A9u, 0x7B211AB0u, 0xB78B1A2Eu, 0x39041DCDu, 0xF5AE1D53u, 0x2C8E0FFFu, 0xE0240F61u, 0x6EAB0882u, 0xA201081Cu, 0xA8C40105u, 0x646E019Bu, 0xEAE10678u, 0x264B06E6u
+};
+#endif
+
 const  CRC_MODEL_32  CRC_ModelCRC32_ref = {
     0x04C11DB7u,
     0xFFFFFFFFu,
     DEF_YES,
     0xFFFFFFFFu,
-   &CRC_TblCRC32_ref[0]
+   &CRC_TblCRC32_ref[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+   &CRC_TblSliceCRC32_ref[0],
+#else
+    (const CPU_INT32U *)0,
+#endif
+    (CRC_HW_FNCT_32)0
+};
+#endif
+
+#if (EDC_CRC_CFG_CRC32C_REF_EN == DEF_ENABLED)
+const  CPU_INT32U  CRC_TblCRC32C_ref[256] = {
+    0x00000000u, 0xF26B8303u, 0xE13B70F7u, 0x1350F3F4u, 0xC79A971Fu, 0x35F1141Cu, 0x26A1E7E8u, 0xD4CA64EBu, 0x8AD958CFu, 0x78B2DBCCu, 0x6BE22838u, 0x9989AB3Bu, 0x4D43CFD0u, 0xBF284CD3u, 0xAC78BF27u, 0x5E133C24u,
+    0x105EC76Fu, 0xE235446Cu, 0xF165B798u, 0x030E349Bu, 0xD7C45070u, 0x25AFD373u, 0x36FF2087u, 0xC494A384u, 0x9A879FA0u, 0x68EC1CA3u, 0x7BBCEF57u, 0x89D76C54u, 0x5D1D08BFu, 0xAF768BBCu, 0xBC267848u, 0x4E4DFB4Bu,
+    0x20BD8EDEu, 0xD2D60DDDu, 0xC186FE29u, 0x33ED7D2Au, 0xE72719C1u, 0x154C9AC2u, 0x061C6936u, 0xF477EA35u, 0xAA64D611u, 0x580F5512u, 0x4B5FA6E6u, 0xB93425E5u, 0x6DFE410Eu, 0x9F95C20Du, 0x8CC531F9u, 0x7EAEB2FAu,
+    0x30E349B1u, 0xC288CAB2u, 0xD1D83946u, 0x23B3BA45u, 0xF779DEAEu, 0x05125DADu, 0x1642AE59u, 0xE4292D5Au, 0xBA3A117Eu, 0x4851927Du, 0x5B016189u, 0xA96AE28Au, 0x7DA08661u, 0x8FCB0562u, 0x9C9BF696u, 0x6EF07595u,
+    0x417B1DBCu, 0xB3109EBFu, 0xA0406D4Bu, 0x522BEE48u, 0x86E18AA3u, 0x748A09A0u, 0x67DAFA54u, 0x95B17957u, 0xCBA24573u, 0x39C9C670u, 0x2A993584u, 0xD8F2B687u, 0x0C38D26Cu, 0xFE53516Fu, 0xED03A29Bu, 0x1F682198u,
+    0x5125DAD3u, 0xA34E59D0u, 0xB01EAA24u, 0x42752927u, 0x96BF4DCCu, 0x64D4CECFu, 0x77843D3Bu, 0x85EFBE38u, 0xDBFC821Cu, 0x2997011Fu, 0x3AC7F2EBu, 0xC8AC71E8u, 0x1C661503u, 0xEE0D9600u, 0xFD5D65F4u, 0x0F36E6F7u,
+    0x61C69362u, 0x93AD1061u, 0x80FDE395u, 0x72966096u, 0xA65C047Du, 0x5437877Eu, 0x4767748Au, 0xB50CF789u, 0xEB1FCBADu, 0x197448AEu, 0x0A24BB5Au, 0xF84F3859u, 0x2C855CB2u, 0xDEEEDFB1u, 0xCDBE2C45u, 0x3FD5AF46u,
+    0x7198540Du, 0x83F3D70Eu, 0x90A324FAu, 0x62C8A7F9u, 0xB602C312u, 0x44694011u, 0x5739B3E5u, 0xA55230E6u, 0xFB410CC2u, 0x092A8FC1u, 0x1A7A7C35u, 0xE811FF36u, 0x3CDB9BDDu, 0xCEB018DEu, 0xDDE0EB2Au, 0x2F8B6829u,
+    0x82F63B78u, 0x709DB87Bu, 0x63CD4B8Fu, 0x91A6C88Cu, 0x456CAC67u, 0xB7072F64u, 0xA457DC90u, 0x563C5F93u, 0x082F63B7u, 0xFA44E0B4u, 0xE9141340u, 0x1B7F9043u, 0xCFB5F4A8u, 0x3DDE77ABu, 0x2E8E845Fu, 0xDCE5075Cu,
+    0x92A8FC17u, 0x60C37F14u, 0x73938CE0u, 0x81F80FE3u, 0x55326B08u, 0xA759E80Bu, 0xB4091BFFu, 0x466298FCu, 0x1871A4D8u, 0xEA1A27DBu, 0xF94AD42Fu, 0x0B21572Cu, 0xDFEB33C7u, 0x2D80B0C4u, 0x3ED04330u, 0xCCBBC033u,
+    0xA24BB5A6u, 0x502036A5u, 0x4370C551u, 0xB11B4652u, 0x65D122B9u, 0x97BAA1BAu, 0x84EA524Eu, 0x7681D14Du, 0x2892ED69u, 0xDAF96E6Au, 0xC9A99D9Eu, 0x3BC21E9Du, 0xEF087A76u, 0x1D63F975u, 0x0E330A81u, 0xFC588982u,
+    0xB21572C9u, 0x407EF1CAu, 0x532E023Eu, 0xA145813Du, 0x758FE5D6u, 0x87E466D5u, 0x94B49521u, 0x66DF1622u, 0x38CC2A06u, 0xCAA7A905u, 0xD9F75AF1u, 0x2B9CD9F2u, 0xFF56BD19u, 0x0D3D3E1Au, 0x1E6DCDEEu, 0xEC064EEDu,
+    0xC38D26C4u, 0x31E6A5C7u, 0x22B65633u, 0xD0DDD530u, 0x0417B1DBu, 0xF67C32D8u, 0xE52CC12Cu, 0x1747422Fu, 0x49547E0Bu, 0xBB3FFD08u, 0xA86F0EFCu, 0x5A048DFFu, 0x8ECEE914u, 0x7CA56A17u, 0x6FF599E3u, 0x9D9E1AE0u,
+    0xD3D3E1ABu, 0x21B862A8u, 0x32E8915Cu, 0xC083125Fu, 0x144976B4u, 0xE622F5B7u, 0xF5720643u, 0x07198540u, 0x590AB964u, 0xAB613A67u, 0xB831C993u, 0x4A5A4A90u, 0x9E902E7Bu, 0x6CFBAD78u, 0x7FAB5E8Cu, 0x8DC0DD8Fu,
+    0xE330A81Au, 0x115B2B19u, 0x020BD8EDu, 0xF0605BEEu, 0x24AA3F05u, 0xD6C1BC06u, 0xC5914FF2u, 0x37FACCF1u, 0x69E9F0D5u, 0x9B8273D6u, 0x88D28022u, 0x7AB90321u, 0xAE7367CAu, 0x5C18E4C9u, 0x4F48173Du, 0xBD23943Eu,
+    0xF36E6F75u, 0x0105EC76u, 0x12551F82u, 0xE03E9C81u, 0x34F4F86Au, 0xC69F7B69u, 0xD5CF889Du, 0x27A40B9Eu, 0x79B737BAu, 0x8BDCB4B9u, 0x988C474Du, 0x6AE7C44Eu, 0xBE2DA0A5u, 0x4C4623A6u, 0x5F16D052u, 0xAD7D5351u
+};
+
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+const  CPU_INT32U  CRC_TblSliceCRC32C_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES] = {
+    0x00000000u, 0xF26B8303u, 0xE13B70F7u, 0x1350F3F4u, 0xC79A971Fu, 0x35F1141Cu, 0x26A1E7E8u, 0xD4CA64EBu, 0x8AD958CFu, 0x78B2DBCCu, 0x6BE22838u, 0x9989AB3Bu, 0x4D43CFD0u, 0xBF284CD3u, 0xAC78BF27u, 0x5E133C24u,
+    0x105EC76Fu, 0xE235446Cu, 0xF165B798u, 0x030E349Bu, 0xD7C45070u, 0x25AFD373u, 0x36FF2087u, 0xC494A384u, 0x9A879FA0u, 0x68EC1CA3u, 0x7BBCEF57u, 0x89D76C54u, 0x5D1D08BFu, 0xAF768BBCu, 0xBC267848u, 0x4E4DFB4Bu,
+    0x20BD8EDEu, 0xD2D60DDDu, 0xC186FE29u, 0x33ED7D2Au, 0xE72719C1u, 0x154C9AC2u, 0x061C6936u, 0xF477EA35u, 0xAA64D611u, 0x580F5512u, 0x4B5FA6E6u, 0xB93425E5u, 0x6DFE410Eu, 0x9F95C20Du, 0x8CC531F9u, 0x7EAEB2FAu,
+    0x30E349B1u, 0xC288CAB2u, 0xD1D83946u, 0x23B3BA45u, 0xF779DEAEu, 0x05125DADu, 0x1642AE59u, 0xE4292D5Au, 0xBA3A117Eu, 0x4851927Du, 0x5B016189u, 0xA96AE28Au, 0x7DA08661u, 0x8FCB0562u, 0x9C9BF696u, 0x6EF07595u,
+    0x417B1DBCu, 0xB3109EBFu, 0xA0406D4Bu, 0x522BEE48u, 0x86E18AA3u, 0x748A09A0u, 0x67DAFA54u, 0x95B17957u, 0xCBA24573u, 0x39C9C670u, 0x2A993584u, 0xD8F2B687u, 0x0C38D26Cu, 0xFE53516Fu, 0xED03A29Bu, 0x1F682198u,
+    0x5125DAD3u, 0xA34E59D0u, 0xB01EAA24u, 0x42752927u, 0x96BF4DCCu, 0x64D4CECFu, 0x77843D3Bu, 0x85EFBE38u, 0xDBFC821Cu, 0x2997011Fu, 0x3AC7F2EBu, 0xC8AC71E8u, 0x1C661503u, 0xEE0D9600u, 0xFD5D65F4u, 0x0F36E6F7u,
+    0x61C69362u, 0x93AD1061u, 0x80FDE395u, 0x72966096u, 0xA65C047Du, 0x5437877Eu, 0x4767748Au, 0xB50CF789u, 0xEB1FCBADu, 0x197448AEu, 0x0A24BB5Au, 0xF84F3859u, 0x2C855CB2u, 0xDEEEDFB1u, 0xCDBE2C45u, 0x3FD5AF46u,
+    0x7198540Du, 0x83F3D70Eu, 0x90A324FAu, 0x62C8A7F9u, 0xB602C312u, 0x44694011u, 0x5739B3E5u, 0xA55230E6u, 0xFB410CC2u, 0x092A8FC1u, 0x1A7A7C35u, 0xE811FF36u, 0x3CDB9BDDu, 0xCEB018DEu, 0xDDE0EB2Au, 0x2F8B6829u,
+    0x82F63B78u, 0x709DB87Bu, 0x63CD4B8Fu, 0x91A6C88Cu, 0x456CAC67u, 0xB7072F64u, 0xA457DC90u, 0x563C5F93u, 0x082F63B7u, 0xFA44E0B4u, 0xE9141340u, 0x1B7F9043u, 0xCFB5F4A8u, 0x3DDE77ABu, 0x2E8E845Fu, 0xDCE5075Cu,
+    0x92A8FC17u, 0x60C37F14u, 0x73938CE0u, 0x81F80FE3u, 0x55326B08u, 0xA759E80Bu, 0xB4091BFFu, 0x466298FCu, 0x1871A4D8u, 0xEA1A27DBu, 0xF94AD42Fu, 0x0B21572Cu, 0xDFEB33C7u, 0x2D80B0C4u, 0x3ED04330u, 0xCCBBC033u,
+    0xA24BB5A6u, 0x502036A5u, 0x4370C551u, 0xB11B4652u, 0x65D122B9u, 0x97BAA1BAu, 0x84EA524Eu, 0x7681D14Du, 0x2892ED69u, 0xDAF96E6Au, 0xC9A99D9Eu, 0x3BC21E9Du, 0xEF087A76u, 0x1D63F975u, 0x0E330A81u, 0xFC588982u,
+    0xB21572C9u, 0x407EF1CAu, 0x532E023Eu, 0xA145813Du, 0x758FE5D6u, 0x87E466D5u, 0x94B49521u, 0x66DF1622u, 0x38CC2A06u, 0xCAA7A905u, 0xD9F75AF1u, 0x2B9CD9F2u, 0xFF56BD19u, 0x0D3D3E1Au, 0x1E6DCDEEu, 0xEC064EEDu,
+    0xC38D26C4u, 0x31E6A5C7u, 0x22B65633u, 0xD0DDD530u, 0x0417B1DBu, 0xF67C32D8u, 0xE52CC12Cu, 0x1747422Fu, 0x49547E0Bu, 0xBB3FFD08u, 0xA86F0EFCu, 0x5A048DFFu, 0x8ECEE914u, 0x7CA56A17u, 0x6FF599E3u, 0x9D9E1AE0u,
+    0xD3D3E1ABu, 0x21B862A8u, 0x32E8915Cu, 0xC083125Fu, 0x144976B4u, 0xE622F5B7u, 0xF5720643u, 0x07198540u, 0x590AB964u, 0xAB613A67u, 0xB831C993u, 0x4A5A4A90u, 0x9E902E7Bu, 0x6CFBAD78u, 0x7FAB5E8Cu, 0x8DC0DD8Fu,
+    0xE330A81Au, 0x115B2B19u, 0x020BD8EDu, 0xF0605BEEu, 0x24AA3F05u, 0xD6C1BC06u, 0xC5914FF2u, 0x37FACCF1u, 0x69E9F0D5u, 0x9B8273D6u, 0x88D28022u, 0x7AB90321u, 0xAE7367CAu, 0x5C18E4C9u, 0x4F48173Du, 0xBD23943Eu,
+    0xF36E6F75u, 0x0105EC76u, 0x12551F82u, 0xE03E9C81u, 0x34F4F86Au, 0xC69F7B69u, 0xD5CF889Du, 0x27A40B9Eu, 0x79B737BAu, 0x8BDCB4B9u, 0x988C474Du, 0x6AE7C44Eu, 0xBE2DA0A5u, 0x4C4623A6u, 0x5F16D052u, 0xAD7D5351u,
+    0x00000000u, 0x13A29877u, 0x274530EEu, 0x34E7A899u, 0x4E8A61DCu, 0x5D28F9ABu, 0x69CF5132u, 0x7A6DC945u, 0x9D14C3B8u, 0x8EB65BCFu, 0xBA51F356u, 0xA9F36B21u, 0xD39EA264u, 0xC03C3A13u, 0xF4DB928Au, 0xE7790AFDu,
+    0x3FC5F181u, 0x2C6769F6u, 0x1880C16Fu, 0x0B225918u, 0x714F905Du, 0x62ED082Au, 0x560AA0B3u, 0x45A838C4u, 0xA2D13239u, 0xB173AA4Eu, 0x859402D7u, 0x96369AA0u, 0xEC5B53E5u, 0xFFF9CB92u, 0xCB1E630Bu, 0xD8BCFB7Cu,
+    0x7F8BE302u, 0x6C297B75u, 0x58CED3ECu, 0x4B6C4B9Bu, 0x310182DEu, 0x22A31AA9u, 0x1644B230u, 0x05E62A47u, 0xE29F20BAu, 0xF13DB8CDu, 0xC5DA1054u, 0xD6788823u, 0xAC154166u, 0xBFB7D911u, 0x8B507188u, 0x98F2E9FFu,
+    0x404E1283u, 0x53EC8AF4u, 0x670B226Du, 0x74A9BA1Au, 0x0EC4735Fu, 0x1D66EB28u, 0x298143B1u, 0x3A23DBC6u, 0xDD5AD13Bu, 0xCEF8494Cu, 0xFA1FE1D5u, 0xE9BD79A2u, 0x93D0B0E7u, 0x80722890u, 0xB4958009u, 0xA737187Eu,
+    0xFF17C604u, 0xECB55E73u, 0xD852F6EAu, 0xCBF06E9Du, 0xB19DA7D8u, 0xA23F3FAFu, 0x96D89736u, 0x857A0F41u, 0x620305BCu, 0x71A19DCBu, 0x45463552u, 0x56E4AD25u, 0x2C896460u, 0x3F2BFC17u, 0x0BCC548Eu, 0x186ECCF9u,
+    0xC0D23785u, 0xD370AFF2u, 0xE797076Bu, 0xF4359F1Cu, 0x8E585659u, 0x9DFACE2Eu, 0xA91D66B7u, 0xBABFFEC0u, 0x5DC6F43Du, 0x4E646C4Au, 0x7A83C4D3u, 0x69215CA4u, 0x134C95E1u, 0x00EE0D96u, 0x3409A50Fu, 0x27AB3D78u,
+    0x809C2506u, 0x933EBD71u, 0xA7D915E8u, 0xB47B8D9Fu, 0xCE1644DAu, 0xDDB4DCADu, 0xE9537434u, 0xFAF1EC43u, 0x1D88E6BEu, 0x0E2A7EC9u, 0x3ACDD650u, 0x296F4E27u, 0x53028762u, 0x40A01F15u, 0x7447B78Cu, 0x67E52FFBu,
+    0xBF59D487u, 0xACFB4CF0u, 0x981CE469u, 0x8BBE7C1Eu, 0xF1D3B55Bu, 0xE2712D2Cu, 0xD69685B5u, 0xC5341DC2u, 0x224D173Fu, 0x31EF8F48u, 0x050827D1u, 0x16AABFA6u, 0x6CC776E3u, 0x7F65EE94u, 0x4B82460Du, 0x5820DE7Au,
+    0xFBC3FAF9u, 0xE861628Eu, 0xDC86CA17u, 0xCF245260u, 0xB5499B25u, 0xA6EB0352u, 0x920CABCBu, 0x81AE33BCu, 0x66D73941u, 0x7575A136u, 0x419209AFu, 0x523091D8u, 0x285D589Du, 0x3BFFC0EAu, 0x0F186873u, 0x1CBAF004u,
+    0xC4060B78u, 0xD7A4930Fu, 0xE3433B96u, 0xF0E1A3E1u, 0x8A8C6AA4u, 0x992EF2D3u, 0xADC95A4Au, 0xBE6BC23Du, 0x5912C8C0u, 0x4AB050B7u, 0x7E57F82Eu, 0x6DF56059u, 0x1798A91Cu, 0x043A316Bu, 0x30DD99F2u, 0x237F0185u,
+    0x844819FBu, 0x97EA818Cu, 0xA30D2915u, 0xB0AFB162u, 0xCAC27827u, 0xD960E050u, 0xED8748C9u, 0xFE25D0BEu, 0x195CDA43u, 0x0AFE4234u, 0x3E19EAADu, 0x2DBB72DAu, 0x57D6BB9Fu, 0x447423E8u, 0x70938B71u, 0x63311306u,
+    0xBB8DE87Au, 0xA82F700Du, 0x9CC8D894u, 0x8F6A40E3u, 0xF50789A6u, 0xE6A511D1u, 0xD242B948u, 0xC1E0213Fu, 0x26992BC2u, 0x353BB3B5u, 0x01DC1B2Cu, 0x127E835Bu, 0x68134A1Eu, 0x7BB1D269u, 0x4F567AF0u, 0x5CF4E287u,
+    0x04D43CFDu, 0x1776A48Au, 0x23910C13u, 0x30339464u, 0x4A5E5D21u, 0x59FCC556u, 0x6D1B6DCFu, 0x7EB9F5B8u, 0x99C0FF45u, 0x8A626732u, 0xBE85CFABu, 0xAD2757DCu, 0xD74A9E99u, 0xC4E806EEu, 0xF00FAE77u, 0xE3AD3600u,
+    0x3B11CD7Cu, 0x28B3550Bu, 0x1C54FD92u, 0x0FF665E5u, 0x759BACA0u, 0x663934D7u, 0x52DE9C4Eu, 0x417C0439u, 0xA6050EC4u, 0xB5A796B3u, 0x81403E2Au, 0x92E2A65Du, 0xE88F6F18u, 0xFB2DF76Fu, 0xCFCA5FF6u, 0xDC68C781u,
+    0x7B5FDFFFu, 0x68FD4788u, 0x5C1AEF11u, 0x4FB87766u, 0x35D5BE23u, 0x26772654u, 0x12908ECDu, 0x013216BAu, 0xE64B1C47u, 0xF5E98430u, 0xC10E2CA9u, 0xD2ACB4DEu, 0xA8C17D9Bu, 0xBB63E5ECu, 0x8F844D75u, 0x9C26D502u,
+    0x449A2E7Eu, 0x5738B609u, 0x63DF1E90u, 0x707D86E7u, 0x0A104FA2u, 0x19B2D7D5u, 0x2D557F4Cu, 0x3EF7E73Bu, 0xD98EEDC6u, 0xCA2C75B1u, 0xFECBDD28u, 0xED69455Fu, 0x97048C1Au, 0x84A6146Du, 0xB041BCF4u, 0xA3E32483u,
+    0x00000000u, 0xA541927Eu, 0x4F6F520Du, 0xEA2EC073u, 0x9EDEA41Au, 0x3B9F3664u, 0xD1B1F617u, 0x74F06469u, 0x38513EC5u, 0x9D10ACBBu, 0x773E6CC8u, 0xD27FFEB6u, 0xA68F9ADFu, 0x03CE08A1u, 0xE9E0C8D2u, 0x4CA15AACu,
+    0x70A27D8Au, 0xD5E3EFF4u, 0x3FCD2F87u, 0x9A8CBDF9u, 0xEE7CD990u, 0x4B3D4BEEu, 0xA1138B9Du, 0x045219E3u, 0x48F3434Fu, 0xEDB2D131u, 0x079C1142u, 0xA2DD833Cu, 0xD62DE755u, 0x736C752Bu, 0x9942B558u, 0x3C032726u,
+    0xE144FB14u, 0x4405696Au, 0xAE2BA919u, 0x0B6A3B67u, 0x7F9A5F0Eu, 0xDADBCD70u, 0x30F50D03u, 0x95B49F7Du, 0xD915C5D1u, 0x7C5457AFu, 0x967A97DCu, 0x333B05A2u, 0x47CB61CBu, 0xE28AF3B5u, 0x08A433C6u, 0xADE5A1B8u,
+    0x91E6869Eu, 0x34A714E0u, 0xDE89D493u, 0x7BC846EDu, 0x0F382284u, 0xAA79B0FAu, 0x40577089u, 0xE516E2F7u, 0xA9B7B85Bu, 0x0CF62A25u, 0xE6D8EA56u, 0x43997828u, 0x37691C41u, 0x92288E3Fu, 0x78064E4Cu, 0xDD47DC32u,
+    0xC76580D9u, 0x622412A7u, 0x880AD2D4u, 0x2D4B40AAu, 0x59BB24C3u, 0xFCFAB6BDu, 0x16D476CEu, 0xB395E4B0u, 0xFF34BE1Cu, 0x5A752C62u, 0xB05BEC11u, 0x151A7E6Fu, 0x61EA1A06u, 0xC4AB8878u, 0x2E85480Bu, 0x8BC4DA75u,
+    0xB7C7FD53u, 0x12866F2Du, 0xF8A8AF5Eu, 0x5DE93D20u, 0x29195949u, 0x8C58CB37u, 0x66760B44u, 0xC337993Au, 0x8F96C396u, 0x2AD751E8u, 0xC0F9919Bu, 0x65B803E5u, 0x1148678Cu, 0xB409F5F2u, 0x5E273581u, 0xFB66A7FFu,
+    0x26217BCDu, 0x8360E9B3u, 0x694E29C0u, 0xCC0FBBBEu, 0xB8FFDFD7u, 0x1DBE4DA9u, 0xF7908DDAu, 0x52D11FA4u, 0x1E704508u, 0xBB31D776u, 0x511F1705u, 0xF45E857Bu, 0x80AEE112u, 0x25EF736Cu, 0xCFC1B31Fu, 0x6A802161u,
+    0x56830647u, 0xF3C29439u, 0x19EC544Au, 0xBCADC634u, 0xC85DA25Du, 0x6D1C3023u, 0x8732F050u, 0x2273622Eu, 0x6ED23882u, 0xCB93AAFCu, 0x21BD6A8Fu, 0x84FCF8F1u, 0xF00C9C98u, 0x554D0EE6u, 0xBF63CE95u, 0x1A225CEBu,
+    0x8B277743u, 0x2E66E53Du, 0xC448254Eu, 0x6109B730u, 0x15F9D359u, 0xB0B84127u, 0x5A968154u, 0xFFD7132Au, 0xB3764986u, 0x1637DBF8u, 0xFC191B8Bu, 0x595889F5u, 0x2DA8ED9Cu, 0x88E97FE2u, 0x62C7BF91u, 0xC7862DEFu,
+    0xFB850AC9u, 0x5EC498B7u, 0xB4EA58C4u, 0x11ABCABAu, 0x655BAED3u, 0xC01A3CADu, 0x2A34FCDEu, 0x8F756EA0u, 0xC3D4340Cu, 0x6695A672u, 0x8CBB6601u, 0x29FAF47Fu, 0x5D0A9016u, 0xF84B0268u, 0x1265C21Bu, 0xB7245065u,
+    0x6A638C57u, 0xCF221E29u, 0x250CDE5Au, 0x804D4C24u, 0xF4BD284Du, 0x51FCBA33u, 0xBBD27A40u, 0x1E93E83Eu, 0x5232B292u, 0xF77320ECu, 0x1D5DE09Fu, 0xB81C72E1u, 0xCCEC1688u, 0x69AD84F6u, 0x83834485u, 0x26C2D6FBu,
+    0x1AC1F1DDu, 0xBF8063A3u, 0x55AEA3D0u, 0xF0EF31AEu, 0x841F55C7u, 0x215EC7B9u, 0xCB7007CAu, 0x6E3195B4u, 0x2290CF18u, 0x87D15D66u, 0x6DFF9D15u, 0xC8BE0F6Bu, 0xBC4E6B02u, 0x190FF97Cu, 0xF321390Fu, 0x5660AB71u,
+    0x4C42F79Au, 0xE90365E4u, 0x032DA597u, 0xA66C37E9u, 0xD29C5380u, 0x77DDC1FEu, 0x9DF3018Du, 0x38B293F3u, 0x7413C95Fu, 0xD1525B21u, 0x3B7C9B52u, 0x9E3D092Cu, 0xEACD6D45u, 0x4F8CFF3Bu, 0xA5A23F48u, 0x00E3AD36u,
+    0x3CE08A10u, 0x99A1186Eu, 0x738FD81Du, 0xD6CE4A63u, 0xA23E2E0Au, 0x077FBC74u, 0xED517C07u, 0x4810EE79u, 0x04B1B4D5u, 0xA1F026ABu, 0x4BDEE6D8u, 0xEE9F74A6u, 0x9A6F10CFu, 0x3F2E82B1u, 0xD50042C2u, 0x7041D0BCu,
+    0xAD060C8Eu, 0x08479EF0u, 0xE2695E83u, 0x4728CCFDu, 0x33D8A894u, 0x96993AEAu, 0x7CB7FA99u, 0xD9F668E7u, 0x9557324Bu, 0x3016A035u, 0xDA386046u, 0x7F79F238u, 0x0B899651u, 0xAEC8042Fu, 0x44E6C45Cu, 0xE1A75622u,
+    0xDDA47104u, 0x78E5E37Au, 0x92CB2309u, 0x378AB177u, 0x437AD51Eu, 0xE63B4760u, 0x0C158713u, 0xA954156Du, 0xE5F54FC1u, 0x40B4DDBFu, 0xAA9A1DCCu, 0x0FDB8FB2u, 0x7B2BEBDBu, 0xDE6A79A5u, 0x3444B9D6u, 0x91052BA8u,
+    0x00000000u, 0xDD45AAB8u, 0xBF672381u, 0x62228939u, 0x7B2231F3u, 0xA6679B4Bu, 0xC4451272u, 0x1900B8CAu, 0xF64463E6u, 0x2B01C95Eu, 0x49234067u, 0x9466EADFu, 0x8D665215u, 0x5023F8ADu, 0x32017194u, 0xEF44DB2Cu,
+    0xE964B13Du, 0x34211B85u, 0x560392BCu, 0x8B463804u, 0x924680CEu, 0x4F032A76u, 0x2D21A34Fu, 0xF06409F7u, 0x1F20D2DBu, 0xC2657863u, 0xA047F15Au, 0x7D025BE2u, 0x6402E328u, 0xB9474990u, 0xDB65C0A9u, 0x06206A11u,
+    0xD725148Bu, 0x0A60BE33u, 0x6842370Au, 0xB5079DB2u, 0xAC072578u, 0x71428FC0u, 0x136006F9u, 0xCE25AC41u, 0x2161776Du, 0xFC24DDD5u, 0x9E0654ECu, 0x4343FE54u, 0x5A43469Eu, 0x8706EC26u, 0xE524651Fu, 0x3861CFA7u,
+    0x3E41A5B6u, 0xE3040F0Eu, 0x81268637u, 0x5C632C8Fu, 0x45639445u, 0x98263EFDu, 0xFA04B7C4u, 0x27411D7Cu, 0xC805C650u, 0x15406CE8u, 0x7762E5D1u, 0xAA274F69u, 0xB327F7A3u, 0x6E625D1Bu, 0x0C40D422u, 0xD1057E9Au,
+    0xABA65FE7u, 0x76E3F55Fu, 0x14C17C66u, 0xC984D6DEu, 0xD0846E14u, 0x0DC1C4ACu, 0x6FE34D95u, 0xB2A6E72Du, 0x5DE23C01u, 0x80A796B9u, 0xE2851F80u, 0x3FC0B538u, 0x26C00DF2u, 0xFB85A74Au, 0x99A72E73u, 0x44E284CBu,
+    0x42C2EEDAu, 0x9F874462u, 0xFDA5CD5Bu, 0x20E067E3u, 0x39E0DF29u, 0xE4A57591u, 0x8687FCA8u, 0x5BC25610u, 0xB4868D3Cu, 0x69C32784u, 0x0BE1AEBDu, 0xD6A40405u, 0xCFA4BCCFu, 0x12E11677u, 0x70C39F4Eu, 0xAD8635F6u,
+    0x7C834B6Cu, 0xA1C6E1D4u, 0xC3E468EDu, 0x1EA1C255u, 0x07A17A9Fu, 0xDAE4D027u, 0xB8C6591Eu, 0x6583F3A6u, 0x8AC7288Au, 0x57828232u, 0x35A00B0Bu, 0xE8E5A1B3u, 0xF1E51979u, 0x2CA0B3C1u, 0x4E823AF8u, 0x93C79040u,
+    0x95E7FA51u, 0x48A250E9u, 0x2A80D9D0u, 0xF7C57368u, 0xEEC5CBA2u, 0x3380611Au, 0x51A2E823u, 0x8CE7429Bu, 0x63A399B7u, 0xBEE6330Fu, 0xDCC4BA36u, 0x0181108Eu, 0x1881A844u, 0xC5C402FCu, 0xA7E68BC5u, 0x7AA3217Du,
+    0x52A0C93Fu, 0x8FE56387u, 0xEDC7EABEu, 0x30824006u, 0x2982F8CCu, 0xF4C75274u, 0x96E5DB4Du, 0x4BA071F5u, 0xA4E4AAD9u, 0x79A10061u, 0x1B838958u, 0xC6C623E0u, 0xDFC69B2Au, 0x02833192u, 0x60A1B8ABu, 0xBDE41213u,
+    0xBBC47802u, 0x6681D2BAu, 0x04A35B83u, 0xD9E6F13Bu, 0xC0E649F1u, 0x1DA3E349u, 0x7F816A70u, 0xA2C4C0C8u, 0x4D801BE4u, 0x90C5B15Cu, 0xF2E73865u, 0x2FA292DDu, 0x36A22A17u, 0xEBE780AFu, 0x89C50996u, 0x5480A32Eu,
+    0x8585DDB4u, 0x58C0770Cu, 0x3AE2FE35u, 0xE7A7548Du, 0xFEA7EC47u, 0x23E246FFu, 0x41C0CFC6u, 0x9C85657Eu, 0x73C1BE52u, 0xAE8414EAu, 0xCCA69DD3u, 0x11E3376Bu, 0x08E38FA1u, 0xD5A62519u, 0xB784AC20u, 0x6AC10698u,
+    0x6CE16C89u, 0xB1A4C631u, 0xD3864F08u, 0x0EC3E5B0u, 0x17C35D7Au, 0xCA86F7C2u, 0xA8A47EFBu, 0x75E1D443u, 0x9AA50F6Fu, 0x47E0A5D7u, 0x25C22CEEu, 0xF8878656u, 0xE1873E9Cu, 0x3CC29424u, 0x5EE01D1Du, 0x83A5B7A5u,
+    0xF90696D8u, 0x24433C60u, 0x4661B559u, 0x9B241FE1u, 0x8224A72Bu, 0x5F610D93u, 0x3D4384AAu, 0xE0062E12u, 0x0F42F53Eu, 0xD2075F86u, 0xB025D6BFu, 0x6D607C07u, 0x7460C4CDu, 0xA9256E75u, 0xCB07E74Cu, 0x16424DF4u,
+    0x106227E5u, 0xCD278D5Du, 0xAF050464u, 0x7240AEDCu, 0x6B401616u, 0xB605BCAEu, 0xD4273597u, 0x09629F2Fu, 0xE6264403u, 0x3B63EEBBu, 0x59416782u, 0x8404CD3Au, 0x9D0475F0u, 0x4041DF48u, 0x22635671u, 0xFF26FCC9u,
+    0x2E238253u, 0xF36628EBu, 0x9144A1D2u, 0x4C010B6Au, 0x5501B3A0u, 0x88441918u, 0xEA669021u, 0x37233A99u, 0xD867E1B5u, 0x05224B0Du, 0x6700C234u, 0xBA45688Cu, 0xA345D046u, 0x7E007AFEu, 0x1C22F3C7u, 0xC167597Fu,
+    0xC747336Eu, 0x1A0299D6u, 0x782010EFu, 0xA565BA57u, 0xBC65029Du, 0x6120A825u, 0x0302211Cu, 0xDE478BA4u, 0x31035088u, 0xEC46FA30u, 0x8E647309u, 0x5321D9B1u, 0x4A21617Bu, 0x9764CBC3u, 0xF54642FAu, 0x2803E842u,
+    0x00000000u, 0x38116FACu, 0x7022DF58u, 0x4833B0F4u, 0xE045BEB0u, 0xD854D11Cu, 0x906761E8u, 0xA8760E44u, 0xC5670B91u, 0xFD76643Du, 0xB545D4C9u, 0x8D54BB65u, 0x2522B521u, 0x1D33DA8Du, 0x55006A79u, 0x6D1105D5u,
+    0x8F2261D3u, 0xB7330E7Fu, 0xFF00BE8Bu, 0xC711D127u, 0x6F67DF63u, 0x5776B0CFu, 0x1F45003Bu, 0x27546F97u, 0x4A456A42u, 0x725405EEu, 0x3A67B51Au, 0x0276DAB6u, 0xAA00D4F2u, 0x9211BB5Eu, 0xDA220BAAu, 0xE2336406u,
+    0x1BA8B557u, 0x23B9DAFBu, 0x6B8A6A0Fu, 0x539B05A3u, 0xFBED0BE7u, 0xC3FC644Bu, 0x8BCFD4BFu, 0xB3DEBB13u, 0xDECFBEC6u, 0xE6DED16Au, 0xAEED619Eu, 0x96FC0E32u, 0x3E8A0076u, 0x069B6FDAu, 0x4EA8DF2Eu, 0x76B9B082u,
+    0x948AD484u, 0xAC9BBB28u, 0xE4A80BDCu, 0xDCB96470u, 0x74CF6A34u, 0x4CDE0598u, 0x04EDB56Cu, 0x3CFCDAC0u, 0x51EDDF15u, 0x69FCB0B9u, 0x21CF004Du, 0x19DE6FE1u, 0xB1A861A5u, 0x89B90E09u, 0xC18ABEFDu, 0xF99BD151u,
+    0x37516AAEu, 0x0F400502u, 0x4773B5F6u, 0x7F62DA5Au, 0xD714D41Eu, 0xEF05BBB2u, 0xA7360B46u, 0x9F2764EAu, 0xF236613Fu, 0xCA270E93u, 0x8214BE67u, 0xBA05D1CBu, 0x1273DF8Fu, 0x2A62B023u, 0x625100D7u, 0x5A406F7Bu,
+    0xB8730B7Du, 0x806264D1u, 0xC851D425u, 0xF040BB89u, 0x5836B5CDu, 0x6027DA61u, 0x28146A95u, 0x10050539u, 0x7D1400ECu, 0x45056F40u, 0x0D36DFB4u, 0x3527B018u, 0x9D51BE5Cu, 0xA540D1F0u, 0xED736104u, 0xD5620EA8u,
+    0x2CF9DFF9u, 0x14E8B055u, 0x5CDB00A1u, 0x64CA6F0Du, 0xCCBC6149u, 0xF4AD0EE5u, 0xBC9EBE11u, 0x848FD1BDu, 0xE99ED468u, 0xD18FBBC4u, 0x99BC0B30u, 0xA1AD649Cu, 0x09DB6AD8u, 0x31CA0574u, 0x79F9B580u, 0x41E8DA2Cu,
+    0xA3DBBE2Au, 0x9BCAD186u, 0xD3F96172u, 0xEBE80EDEu, 0x439E009Au, 0x7B8F6F36u, 0x33BCDFC2u, 0x0BADB06Eu, 0x66BCB5BBu, 0x5EADDA17u, 0x169E6AE3u, 0x2E8F054Fu, 0x86F90B0Bu, 0xBEE864A7u, 0xF6DBD453u, 0xCECABBFFu,
+    0x6EA2D55Cu, 0x56B3BAF0u, 0x1E800A04u, 0x269165A8u, 0x8EE76BECu, 0xB6F60440u, 0xFEC5B4B4u, 0xC6D4DB18u, 0xABC5DECDu, 0x93D4B161u, 0xDBE70195u, 0xE3F66E39u, 0x4B80607Du, 0x73910FD1u, 0x3BA2BF25u, 0x03B3D089u,
+    0xE180B48Fu, 0xD991DB23u, 0x91A26BD7u, 0xA9B3047Bu, 0x01C50A3Fu, 0x39D46593u, 0x71E7D567u, 0x49F6BACBu, 0x24E7BF1Eu, 0x1CF6D0B2u, 0x54C56046u, 0x6CD40FEAu, 0xC4A201AEu, 0xFCB36E02u, 0xB480DEF6u, 0x8C91B15Au,
+    0x750A600Bu, 0x4D1B0FA7u, 0x0528BF53u, 0x3D39D0FFu, 0x954FDEBBu, 0xAD5EB117u, 0xE56D01E3u, 0xDD7C6E4Fu, 0xB06D6B9Au, 0x887C0436u, 0xC04FB4C2u, 0xF85EDB6Eu, 0x5028D52Au, 0x6839BA86u, 0x200A0A72u, 0x181B65DEu,
+    0xFA2801D8u, 0xC2396E74u, 0x8A0ADE80u, 0xB21BB12Cu, 0x1A6DBF68u, 0x227CD0C4u, 0x6A4F6030u, 0x525E0F9Cu, 0x3F4F0A49u, 0x075E65E5u, 0x4F6DD511u, 0x777CBABDu, 0xDF0AB4F9u, 0xE71BDB55u, 0xAF286BA1u, 0x9739040Du,
+    0x59F3BFF2u, 0x61E2D05Eu, 0x29D160AAu, 0x11C00F06u, 0xB9B60142u, 0x81A76EEEu, 0xC994DE1Au, 0xF185B1B6u, 0x9C94B463u, 0xA485DBCFu, 0xECB66B3Bu, 0xD4A70497u, 0x7CD10AD3u, 0x44C0657Fu, 0x0CF3D58Bu, 0x34E2BA27u,
+    0xD6D1DE21u, 0xEEC0B18Du, 0xA6F30179u, 0x9EE26ED5u, 0x36946091u, 0x0E850F3Du, 0x46B6BFC9u, 0x7EA7D065u, 0x13B6D5B0u, 0x2BA7BA1Cu, 0x63940AE8u, 0x5B856544u, 0xF3F36B00u, 0xCBE204ACu, 0x83D1B458u, 0xBBC0DBF4u,
+    0x425B0AA5u, 0x7A4A6509u, 0x3279D5FDu, 0x0A68BA51u, 0xA21EB415u, 0x9A0FDBB9u, 0xD23C6B4Du, 0xEA2D04E1u, 0x873C0134u, 0xBF2D6E98u, 0xF71EDE6Cu, 0xCF0FB1C0u, 0x6779BF84u, 0x5F68D028u, 0x175B60DCu, 0x2F4A0F70u,
+    0xCD796B76u, 0xF56804DAu, 0xBD5BB42Eu, 0x854ADB82u, 0x2D3CD5C6u, 0x152DBA6Au, 0x5D1E0A9Eu, 0x650F6532u, 0x081E60E7u, 0x300F0F4Bu, 0x783CBFBFu, 0x402DD013u, 0xE85BDE57u, 0xD04AB1FBu, 0x9879010Fu, 0xA0686EA3u,
+    0x00000000u, 0xEF306B19u, 0xDB8CA0C3u, 0x34BCCBDAu, 0xB2F53777u, 0x5DC55C6Eu, 0x697997B4u, 0x8649FCADu, 0x6006181Fu, 0x8F367306u, 0xBB8AB8DCu, 0x54BAD3C5u, 0xD2F32F68u, 0x3DC34471u, 0x097F8FABu, 0xE64FE4B2u,
+    0xC00C303Eu, 0x2F3C5B27u, 0x1B8090FDu, 0xF4B0FBE4u, 0x72F90749u, 0x9DC96C50u, 0xA975A78Au, 0x4645CC93u, 0xA00A2821u, 0x4F3A4338u, 0x7B8688E2u, 0x94B6E3FBu, 0x12FF1F56u, 0xFDCF744Fu, 0xC973BF95u, 0x2643D48Cu,
+    0x85F4168Du, 0x6AC47D94u, 0x5E78B64Eu, 0xB148DD57u, 0x370121FAu, 0xD8314AE3u, 0xEC8D8139u, 0x03BDEA20u, 0xE5F20E92u, 0x0AC2658Bu, 0x3E7EAE51u, 0xD14EC548u, 0x570739E5u, 0xB83752FCu, 0x8C8B9926u, 0x63BBF23Fu,
+    0x45F826B3u, 0xAAC84DAAu, 0x9E748670u, 0x7144ED69u, 0xF70D11C4u, 0x183D7ADDu, 0x2C81B107u, 0xC3B1DA1Eu, 0x25FE3EACu, 0xCACE55B5u, 0xFE729E6Fu, 0x1142F576u, 0x970B09DBu, 0x783B62C2u, 0x4C87A918u, 0xA3B7C201u,
+    0x0E045BEBu, 0xE13430F2u, 0xD588FB28u, 0x3AB89031u, 0xBCF16C9Cu, 0x53C10785u, 0x677DCC5Fu, 0x884DA746u, 0x6E0243F4u, 0x813228EDu, 0xB58EE337u, 0x5ABE882Eu, 0xDCF77483u, 0x33C71F9Au, 0x077BD440u, 0xE84BBF59u,
+    0xCE086BD5u, 0x213800CCu, 0x1584CB16u, 0xFAB4A00Fu, 0x7CFD5CA2u, 0x93CD37BBu, 0xA771FC61u, 0x48419778u, 0xAE0E73CAu, 0x413E18D3u, 0x7582D309u, 0x9AB2B810u, 0x1CFB44BDu, 0xF3CB2FA4u, 0xC777E47Eu, 0x28478F67u,
+    0x8BF04D66u, 0x64C0267Fu, 0x507CEDA5u, 0xBF4C86BCu, 0x39057A11u, 0xD6351108u, 0xE289DAD2u, 0x0DB9B1CBu, 0xEBF65579u, 0x04C63E60u, 0x307AF5BAu, 0xDF4A9EA3u, 0x5903620Eu, 0xB6330917u, 0x828FC2CDu, 0x6DBFA9D4u,
+    0x4BFC7D58u, 0xA4CC1641u, 0x9070DD9Bu, 0x7F40B682u, 0xF9094A2Fu, 0x16392136u, 0x2285EAECu, 0xCDB581F5u, 0x2BFA6547u, 0xC4CA0E5Eu, 0xF076C584u, 0x1F46AE9Du, 0x990F5230u, 0x763F3929u, 0x4283F2F3u, 0xADB399EAu,
+    0x1C08B7D6u, 0xF338DCCFu, 0xC7841715u, 0x28B47C0Cu, 0xAEFD80A1u, 0x41CDEBB8u, 0x75712062u, 0x9A414B7Bu, 0x7C0EAFC9u, 0x933EC4D0u, 0xA7820F0Au, 0x48B26413u, 0xCEFB98BEu, 0x21CBF3A7u, 0x1577387Du, 0xFA475364u,
+    0xDC0487E8u, 0x3334ECF1u, 0x0788272Bu, 0xE8B84C32u, 0x6EF1B09Fu, 0x81C1DB86u, 0xB57D105Cu, 0x5A4D7B45u, 0xBC029FF7u, 0x5332F4EEu, 0x678E3F34u, 0x88BE542Du, 0x0EF7A880u, 0xE1C7C399u, 0xD57B0843u, 0x3A4B635Au,
+    0x99FCA15Bu, 0x76CCCA42u, 0x42700198u, 0xAD406A81u, 0x2B09962Cu, 0xC439FD35u, 0xF08536EFu, 0x1FB55DF6u, 0xF9FAB944u, 0x16CAD25Du, 0x22761987u, 0xCD46729Eu, 0x4B0F8E33u, 0xA43FE52Au, 0x90832EF0u, 0x7FB345E9u,
+    0x59F09165u, 0xB6C0FA7Cu, 0x827C31A6u, 0x6D4C5ABFu, 0xEB05A612u, 0x0435CD0Bu, 0x308906D1u, 0xDFB96DC8u, 0x39F6897Au, 0xD6C6E263u, 0xE27A29B9u, 0x0D4A42A0u, 0x8B03BE0Du, 0x6433D514u, 0x508F1ECEu, 0xBFBF75D7u,
+    0x120CEC3Du, 0xFD3C8724u, 0xC9804CFEu, 0x26B027E7u, 0xA0F9DB4Au, 0x4FC9B053u, 0x7B757B89u, 0x94451090u, 0x720AF422u, 0x9D3A9F3Bu, 0xA98654E1u, 0x46B63FF8u, 0xC0FFC355u, 0x2FCFA84Cu, 0x1B736396u, 0xF443088Fu,
+    0xD200DC03u, 0x3D30B71Au, 0x098C7CC0u, 0xE6BC17D9u, 0x60F5EB74u, 0x8FC5806Du, 0xBB794BB7u, 0x544920AEu, 0xB206C41Cu, 0x5D36AF05u, 0x698A64DFu, 0x86BA0FC6u, 0x00F3F36Bu, 0xEFC39872u, 0xDB7F53A8u, 0x344F38B1u,
+    0x97F8FAB0u, 0x78C891A9u, 0x4C745A73u, 0xA344316Au, 0x250DCDC7u, 0xCA3DA6DEu, 0xFE816D04u, 0x11B1061Du, 0xF7FEE2AFu, 0x18CE89B6u, 0x2C72426Cu, 0xC3422975u, 0x450BD5D8u, 0xAA3BBEC1u, 0x9E87751Bu, 0x71B71E02u,
+    0x57F4CA8Eu, 0xB8C4A197u, 0x8C786A4Du, 0x63480154u, 0xE501FDF9u, 0x0A3196E0u, 0x3E8D5D3Au, 0xD1BD3623u, 0x37F2D291u, 0xD8C2B988u, 0xEC7E7252u, 0x034E194Bu, 0x8507E5E6u, 0x6A378EFFu, 0x5E8B4525u, 0xB1BB2E3Cu,
+    0x00000000u, 0x68032CC8u, 0xD0065990u, 0xB8057558u, 0xA5E0C5D1u, 0xCDE3E919u, 0x75E69C41u, 0x1DE5B089u, 0x4E2DFD53u, 0x262ED19Bu, 0x9E2BA4C3u, 0xF628880Bu, 0xEBCD3882u, 0x83CE144Au, 0x3BCB6112u, 0x53C84DDAu,
+    0x9C5BFAA6u, 0xF458D66Eu, 0x4C5DA336u, 0x245E8FFEu, 0x39BB3F77u, 0x51B813BFu, 0xE9BD66E7u, 0x81BE4A2Fu, 0xD27607F5u, 0xBA752B3Du, 0x02705E65u, 0x6A7372ADu, 0x7796C224u, 0x1F95EEECu, 0xA7909BB4u, 0xCF93B77Cu,
+    0x3D5B83BDu, 0x5558AF75u, 0xED5DDA2Du, 0x855EF6E5u, 0x98BB466Cu, 0xF0B86AA4u, 0x48BD1FFCu, 0x20BE3334u, 0x73767EEEu, 0x1B755226u, 0xA370277Eu, 0xCB730BB6u, 0xD696BB3Fu, 0xBE9597F7u, 0x0690E2AFu, 0x6E93CE67u,
+    0xA100791Bu, 0xC90355D3u, 0x7106208Bu, 0x19050C43u, 0x04E0BCCAu, 0x6CE39002u, 0xD4E6E55Au, 0xBCE5C992u, 0xEF2D8448u, 0x872EA880u, 0x3F2BDDD8u, 0x5728F110u, 0x4ACD4199u, 0x22CE6D51u, 0x9ACB1809u, 0xF2C834C1u,
+    0x7AB7077Au, 0x12B42BB2u, 0xAAB15EEAu, 0xC2B27222u, 0xDF57C2ABu, 0xB754EE63u, 0x0F519B3Bu, 0x6752B7F3u, 0x349AFA29u, 0x5C99D6E1u, 0xE49CA3B9u, 0x8C9F8F71u, 0x917A3FF8u, 0xF9791330u, 0x417C6668u, 0x297F4AA0u,
+    0xE6ECFDDCu, 0x8EEFD114u, 0x36EAA44Cu, 0x5EE98884u, 0x430C380Du, 0x2B0F14C5u, 0x930A619Du, 0xFB094D55u, 0xA8C1008Fu, 0xC0C22C47u, 0x78C7591Fu, 0x10C475D7u, 0x0D21C55Eu, 0x6522E996u, 0xDD279CCEu, 0xB524B006u,
+    0x47EC84C7u, 0x2FEFA80Fu, 0x97EADD57u, 0xFFE9F19Fu, 0xE20C4116u, 0x8A0F6DDEu, 0x320A1886u, 0x5A09344Eu, 0x09C17994u, 0x61C2555Cu, 0xD9C72004u, 0xB1C40CCCu, 0xAC21BC45u, 0xC422908Du, 0x7C27E5D5u, 0x1424C91Du,
+    0xDBB77E61u, 0xB3B452A9u, 0x0BB127F1u, 0x63B20B39u, 0x7E57BBB0u, 0x16549778u, 0xAE51E220u, 0xC652CEE8u, 0x959A8332u, 0xFD99AFFAu, 0x459CDAA2u, 0x2D9FF66Au, 0x307A46E3u, 0x58796A2Bu, 0xE07C1F73u, 0x887F33BBu,
+    0xF56E0EF4u, 0x9D6D223Cu, 0x25685764u, 0x4D6B7BACu, 0x508ECB25u, 0x388DE7EDu, 0x808892B5u, 0xE88BBE7Du, 0xBB43F3A7u, 0xD340DF6Fu, 0x6B45AA37u, 0x034686FFu, 0x1EA33676u, 0x76A01ABEu, 0xCEA56FE6u, 0xA6A6432Eu,
+    0x6935F452u, 0x0136D89Au, 0xB933ADC2u, 0xD130810Au, 0xCCD53183u, 0xA4D61D4Bu, 0x1CD36813u, 0x74D044DBu, 0x27180901u, 0x4F1B25C9u, 0xF71E5091u, 0x9F1D7C59u, 0x82F8CCD0u, 0xEAFBE018u, 0x52FE9540u, 0x3AFDB988u,
+    0xC8358D49u, 0xA036A181u, 0x1833D4D9u, 0x7030F811u, 0x6DD54898u, 0x05D66450u, 0xBDD31108u, 0xD5D03DC0u, 0x8618701Au, 0xEE1B5CD2u, 0x561E298Au, 0x3E1D0542u, 0x23F8B5CBu, 0x4BFB9903u, 0xF3FEEC5Bu, 0x9BFDC093u,
+    0x546E77EFu, 0x3C6D5B27u, 0x84682E7Fu, 0xEC6B02B7u, 0xF18EB23Eu, 0x998D9EF6u, 0x2188EBAEu, 0x498BC766u, 0x1A438ABCu, 0x7240A674u, 0xCA45D32Cu, 0xA246FFE4u, 0xBFA34F6Du, 0xD7A063A5u, 0x6FA516FDu, 0x07A63A35u,
+    0x8FD9098Eu, 0xE7DA2546u, 0x5FDF501Eu, 0x37DC7CD6u, 0x2A39CC5Fu, 0x423AE097u, 0xFA3F95CFu, 0x923CB907u, 0xC1F4F4DDu, 0xA9F7D815u, 0x11F2AD4Du, 0x79F18185u, 0x6414310Cu, 0x0C171DC4u, 0xB412689Cu, 0xDC114454u,
+    0x1382F328u, 0x7B81DFE0u, 0xC384AAB8u, 0xAB878670u, 0xB66236F9u, 0xDE611A31u, 0x66646F69u, 0x0E6743A1u, 0x5DAF0E7Bu, 0x35AC22B3u, 0x8DA957EBu, 0xE5AA7B23u, 0xF84FCBAAu, 0x904CE762u, 0x2849923Au, 0x404ABEF2u,
+    0xB2828A33u, 0xDA81A6FBu, 0x6284D3A3u, 0x0A87FF6Bu, 0x17624FE2u, 0x7F61632Au, 0xC7641672u, 0xAF673ABAu, 0xFCAF7760u, 0x94AC5BA8u, 0x2CA92EF0u, 0x44AA0238u, 0x594FB2B1u, 0x314C9E79u, 0x8949EB21u, 0xE14AC7E9u,
+    0x2ED97095u, 0x46DA5C5Du, 0xFEDF2905u, 0x96DC05CDu, 0x8B39B544u, 0xE33A998Cu, 0x5B3FECD4u, 0x333CC01Cu, 0x60F48DC6u, 0x08F7A10Eu, 0xB0F2D456u, 0xD8F1F89Eu, 0xC5144817u, 0xAD1764DFu, 0x15121187u, 0x7D113D4Fu,
+    0x00000000u, 0x493C7D27u, 0x9278FA4Eu, 0xDB448769u, 0x211D826Du, 0x6821FF4Au, 0xB3657823u, 0xFA590504u, 0x423B04DAu, 0x0B0779FDu, 0xD043FE94u, 0x997F83B3u, 0x632686B7u, 0x2A1AFB90u, 0xF15E7CF9u, 0xB86201DEu,
+    0x847609B4u, 0xCD4A7493u, 0x160EF3FAu, 0x5F328EDDu, 0xA56B8BD9u, 0xEC57F6FEu, 0x37137197u, 0x7E2F0CB0u, 0xC64D0D6Eu, 0x8F717049u, 0x5435F720u, 0x1D098A07u, 0xE7508F03u, 0xAE6CF224u, 0x7528754Du, 0x3C14086Au,
+    0x0D006599u, 0x443C18BEu, 0x9F789FD7u, 0xD644E2F0u, 0x2C1DE7F4u, 0x65219AD3u, 0xBE651DBAu, 0xF759609Du, 0x4F3B6143u, 0x06071C64u, 0xDD439B0Du, 0x947FE62Au, 0x6E26E32Eu, 0x271A9E09u, 0xFC5E1960u, 0xB5626447u,
+    0x89766C2Du, 0xC04A110Au, 0x1B0E9663u, 0x5232EB44u, 0xA86BEE40u, 0xE1579367u, 0x3A13140Eu, 0x732F6929u, 0xCB4D68F7u, 0x827115D0u, 0x593592B9u, 0x1009EF9Eu, 0xEA50EA9Au, 0xA36C97BDu, 0x782810D4u, 0x31146DF3u,
+    0x1A00CB32u, 0x533CB615u, 0x8878317Cu, 0xC1444C5Bu, 0x3B1D495Fu, 0x72213478u, 0xA965B311u, 0xE059CE36u, 0x583BCFE8u, 0x1107B2CFu, 0xCA4335A6u, 0x837F4881u, 0x79264D85u, 0x301A30A2u, 0xEB5EB7CBu, 0xA262CAECu,
+    0x9E76C286u, 0xD74ABFA1u, 0x0C0E38C8u, 0x453245EFu, 0xBF6B40EBu, 0xF6573DCCu, 0x2D13BAA5u, 0x642FC782u, 0xDC4DC65Cu, 0x9571BB7Bu, 0x4E353C12u, 0x07094135u, 0xFD504431u, 0xB46C3916u, 0x6F28BE7Fu, 0x2614C358u,
+    0x1700AEABu, 0x5E3CD38Cu, 0x857854E5u, 0xCC4429C2u, 0x361D2CC6u, 0x7F2151E1u, 0xA465D688u, 0xED59ABAFu, 0x553BAA71u, 0x1C07D756u, 0xC743503Fu, 0x8E7F2D18u, 0x7426281Cu, 0x3D1A553Bu, 0xE65ED252u, 0xAF62AF75u,
+    0x9376A71Fu, 0xDA4ADA38u, 0x010E5D51u, 0x48322076u, 0xB26B2572u, 0xFB575855u, 0x2013DF3Cu, 0x692FA21Bu, 0xD14DA3C5u, 0x9871DEE2u, 0x4335598Bu, 0x0A0924ACu, 0xF05021A8u, 0xB96C5C8Fu, 0x6228DBE6u, 0x2B14A6C1u,
+    0x34019664u, 0x7D3DEB43u, 0xA6796C2Au, 0xEF45110Du, 0x151C1409u, 0x5C20692Eu, 0x8764EE47u, 0xCE589360u, 0x763A92BEu, 0x3F06EF99u, 0xE44268F0u, 0xAD7E15D7u, 0x572710D3u, 0x1E1B6DF4u, 0xC55FEA9Du, 0x8C6397BAu,
+    0xB0779FD0u, 0xF94BE2F7u, 0x220F659Eu, 0x6B3318B9u, 0x916A1DBDu, 0xD856609Au, 0x0312E7F3u, 0x4A2E9AD4u, 0xF24C9B0Au, 0xBB70E62Du, 0x60346144u, 0x29081C63u, 0xD3511967u, 0x9A6D6440u, 0x4129E329u, 0x08159E0Eu,
+    0x3901F3FDu, 0x703D8EDAu, 0xAB7909B3u, 0xE2457494u, 0x181C7190u, 0x51200CB7u, 0x8A648BDEu, 0xC358F6F9u, 0x7B3AF727u, 0x32068A00u, 0xE9420D69u, 0xA07E704Eu, 0x5A27754Au, 0x131B086Du, 0xC85F8F04u, 0x8163F223u,
+    0xBD77FA49u, 0xF44B876Eu, 0x2F0F0007u, 0x66337D20u, 0x9C6A7824u, 0xD5560503u, 0x0E12826Au, 0x472EFF4Du, 0xFF4CFE93u, 0xB67083B4u, 0x6D3404DDu, 0x240879FAu, 0xDE517CFEu, 0x976D01D9u, 0x4C2986B0u, 0x0515FB97u,
+    0x2E015D56u, 0x673D2071u, 0xBC79A718u, 0xF545DA3Fu, 0x0F1CDF3Bu, 0x4620A21Cu, 0x9D642575u, 0xD4585852u, 0x6C3A598Cu, 0x250624ABu, 0xFE42A3C2u, 0xB77EDEE5u, 0x4D27DBE1u, 0x041BA6C6u, 0xDF5F21AFu, 0x96635C88u,
+    0xAA7754E2u, 0xE34B29C5u, 0x380FAEACu, 0x7133D38Bu, 0x8B6AD68Fu, 0xC256ABA8u, 0x19122CC1u, 0x502E51E6u, 0xE84C5038u, 0xA1702D1Fu, 0x7A34AA76u, 0x3308D751u, 0xC951D255u, 0x806DAF72u, 0x5B29281Bu, 0x1215553Cu,
+    0x230138CFu, 0x6A3D45E8u, 0xB179C281u, 0xF845BFA6u, 0x021CBAA2u, 0x4B20C785u, 0x906440ECu, 0xD9583DCBu, 0x613A3C15u, 0x28064132u, 0xF342C65Bu, 0xBA7EBB7Cu, 0x4027BE78u, 0x091BC35Fu, 0xD25F4436u, 0x9B633911u,
+    0xA777317Bu, 0xEE4B4C5Cu, 0x350FCB35u, 0x7C33B612u, 0x866AB316u, 0xCF56CE31u, 0x14124958u, 0x5D2E347Fu, 0xE54C35A1u, 0xAC704886u, 0x7734CFEFu, 0x3E08B2C8u, 0xC451B7CCu, 0x8D6DCAEBu, 0x56294D82u, 0x1F1530A5u
+};
+#endif
+
+const  CRC_MODEL_32  CRC_ModelCRC32C_ref = {
+    0x1EDC6F41u,
+    0xFFFFFFFFu,
+    DEF_YES,
+    0xFFFFFFFFu,
+   &CRC_TblCRC32C_ref[0],
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+   &CRC_TblSliceCRC32C_ref[0],
+#else
+    (const CPU_INT32U *)0,
+#endif
+#if (EDC_CRC_CFG_OPTIMIZE_HW_EN == DEF_ENABLED)
+    CRC_ChkSumCalcHW_CRC32C_ref                                 /* See 'edc_crc.h  CRC MODEL DATA TYPES  Note #2'.      */
+#else
+    (CRC_HW_FNCT_32)0
+#endif
 };
 #endif
 
@@ -357,6 +1635,36 @@ static  CPU_INT32U  CRC_ChkSumCalcTbl_32Bit_ref  (CPU_INT32U          init_val,
                                                   CPU_SIZE_T          size);
 #endif
 
+static  CPU_INT16U  CRC_ChkSumCalcTblModel_16Bit (const  CRC_MODEL_16  *p_model,
+                                                  CPU_INT16U          init_val,
+                                                  CPU_INT08U         *p_data,
+                                                  CPU_SIZE_T          size);
+
+static  CPU_INT32U  CRC_ChkSumCalcTblModel_32Bit (const  CRC_MODEL_32  *p_model,
+                                                  CPU_INT32U          init_val,
+                                                  CPU_INT08U         *p_data,
+                                                  CPU_SIZE_T          size);
+
+static  CPU_INT16U  CRC_ChkSumCalcTblSlice_16Bit    (CPU_INT16U          init_val,
+                                                     const  CPU_INT16U  *p_tbl_slice,
+                                                     CPU_INT08U         *p_data,
+                                                     CPU_SIZE_T          size);
+
+static  CPU_INT16U  CRC_ChkSumCalcTblSlice_16Bit_ref(CPU_INT16U          init_val,
+                                                     const  CPU_INT16U  *p_tbl_slice,
+                                                     CPU_INT08U         *p_data,
+                                                     CPU_SIZE_T          size);
+
+static  CPU_INT32U  CRC_ChkSumCalcTblSlice_32Bit    (CPU_INT32U          init_val,
+                                                     const  CPU_INT32U  *p_tbl_slice,
+                                                     CPU_INT08U         *p_data,
+                                                     CPU_SIZE_T          size);
+
+static  CPU_INT32U  CRC_ChkSumCalcTblSlice_32Bit_ref(CPU_INT32U          init_val,
+                                                     const  CPU_INT32U  *p_tbl_slice,
+                                                     CPU_INT08U         *p_data,
+                                                     CPU_SIZE_T          size);
+
 static  CPU_INT16U  CRC_ChkSumCalcNoTbl_16Bit    (CPU_INT16U          init_val,
                                                   CPU_INT16U          poly,
                                                   CPU_INT08U         *p_data,
@@ -453,7 +1761,8 @@ void  CRC_Open_16Bit (CRC_MODEL_16  *p_model,
     p_model_calc->InitVal =  p_model->InitVal;
     p_model_calc->Reflect =  p_model->Reflect;
     p_model_calc->XorOut  =  p_model->XorOut;
-    p_model_calc->TblPtr  =  p_model->TblPtr;
+    p_model_calc->TblPtr      =  p_model->TblPtr;
+    p_model_calc->TblSlicePtr =  p_model->TblSlicePtr;
 
     if (p_model->Reflect == DEF_YES) {
         p_calc->CRC_Curr = CRC_Reflect_16Bit(p_model->InitVal);
@@ -482,6 +1791,8 @@ void  CRC_Open_16Bit (CRC_MODEL_16  *p_model,
 * Caller(s)   : Application.
 *
 * Note(s)     : (1) See 'CRC_Open_16Bit()  Note #1'.
+*
+*               (2) See 'CRC_ChkSumCalc_16Bit()  Note #3'.
 *********************************************************************************************************
 */
 
@@ -489,25 +1800,16 @@ void  CRC_WrBlock_16Bit (CRC_CALC_16  *p_calc,
                          void         *p_data,
                          CPU_SIZE_T    size)
 {
-    CPU_INT08U   *p_data_08;
-    CPU_INT16U    crc;
-    CPU_BOOLEAN   reflect;
+    CPU_INT08U  *p_data_08;
+    CPU_INT16U   crc;
 
 
-    reflect   = (p_calc->Model).Reflect;
     p_data_08 = (CPU_INT08U *)p_data;
 
-    if (reflect == DEF_YES) {
-        crc = CRC_ChkSumCalcTbl_16Bit_ref( p_calc->CRC_Curr,
-                                          (p_calc->Model).TblPtr,
-                                           p_data_08,
-                                           size);
-    } else {
-        crc = CRC_ChkSumCalcTbl_16Bit( p_calc->CRC_Curr,
-                                      (p_calc->Model).TblPtr,
-                                       p_data_08,
-                                       size);
-    }
+    crc = CRC_ChkSumCalcTblModel_16Bit(&p_calc->Model,
+                                        p_calc->CRC_Curr,
+                                        p_data_08,
+                                        size);
 
     p_calc->CRC_Curr = crc;
 }
@@ -652,7 +1954,9 @@ void  CRC_Open_32Bit (CRC_MODEL_32  *p_model,
     p_model_calc->InitVal =  p_model->InitVal;
     p_model_calc->Reflect =  p_model->Reflect;
     p_model_calc->XorOut  =  p_model->XorOut;
-    p_model_calc->TblPtr  =  p_model->TblPtr;
+    p_model_calc->TblPtr      =  p_model->TblPtr;
+    p_model_calc->TblSlicePtr =  p_model->TblSlicePtr;
+    p_model_calc->HW_Fnct     =  p_model->HW_Fnct;
 
     if (p_model->Reflect == DEF_YES) {
         p_calc->CRC_Curr = CRC_Reflect_32Bit(p_model->InitVal);
@@ -681,6 +1985,8 @@ void  CRC_Open_32Bit (CRC_MODEL_32  *p_model,
 * Caller(s)   : Application.
 *
 * Note(s)     : (1) See 'CRC_Open_32Bit()  Note #1'.
+*
+*               (2) See 'CRC_ChkSumCalc_32Bit()  Note #3'.
 *********************************************************************************************************
 */
 
@@ -688,25 +1994,16 @@ void  CRC_WrBlock_32Bit (CRC_CALC_32  *p_calc,
                          void         *p_data,
                          CPU_SIZE_T    size)
 {
-    CPU_INT08U   *p_data_08;
-    CPU_INT32U    crc;
-    CPU_BOOLEAN   reflect;
+    CPU_INT08U  *p_data_08;
+    CPU_INT32U   crc;
 
 
-    reflect   = (p_calc->Model).Reflect;
     p_data_08 = (CPU_INT08U *)p_data;
 
-    if (reflect == DEF_YES) {
-        crc = CRC_ChkSumCalcTbl_32Bit_ref( p_calc->CRC_Curr,
-                                          (p_calc->Model).TblPtr,
-                                           p_data_08,
-                                           size);
-    } else {
-        crc = CRC_ChkSumCalcTbl_32Bit( p_calc->CRC_Curr,
-                                      (p_calc->Model).TblPtr,
-                                       p_data_08,
-                                       size);
-    }
+    crc = CRC_ChkSumCalcTblModel_32Bit(&p_calc->Model,
+                                        p_calc->CRC_Curr,
+                                        p_data_08,
+                                        size);
 
     p_calc->CRC_Curr = crc;
 }
@@ -810,6 +2107,9 @@ CPU_INT32U  CRC_Close_32Bit (CRC_CALC_32  *p_calc)
 *
 *               (2) If you have not pre-computed a table (using 'CRC_TblMake_16Bit()') or are not using
 *                   one of the provided tables, then be certain that 'p_model->TblPtr' is a NULL pointer.
+*
+*               (3) If the model also provides a slicing-by-8 table, it is used
+*                   instead of 'p_model->TblPtr' (see 'edc_crc.h  CRC MODEL DATA TYPES').
 *********************************************************************************************************
 */
 
@@ -860,18 +2160,11 @@ CPU_INT16U  CRC_ChkSumCalc_16Bit (CRC_MODEL_16  *p_model,
                                             p_data_08,
                                             size);
         }
-    } else {
-        if (p_model->Reflect == DEF_YES) {
-            crc = CRC_ChkSumCalcTbl_16Bit_ref(init_val,
-                                              p_model->TblPtr,
-                                              p_data_08,
-                                              size);
-        } else {
-            crc = CRC_ChkSumCalcTbl_16Bit(init_val,
-                                          p_model->TblPtr,
-                                          p_data_08,
-                                          size);
-        }
+    } else {                                                    /* See Note #3.                                         */
+        crc = CRC_ChkSumCalcTblModel_16Bit(p_model,
+                                            init_val,
+                                            p_data_08,
+                                            size);
     }
 
     crc  ^= p_model->XorOut;
@@ -907,6 +2200,9 @@ CPU_INT16U  CRC_ChkSumCalc_16Bit (CRC_MODEL_16  *p_model,
 *
 *               (2) If you have not pre-computed a table (using 'CRC_TblMake_32Bit()') or are not using
 *                   one of the provided tables, then be certain that 'p_model->TblPtr' is a NULL pointer.
+*
+*               (3) If the model also provides a slicing-by-8 table or a CPU CRC function, it is used
+*                   instead of 'p_model->TblPtr' (see 'edc_crc.h  CRC MODEL DATA TYPES').
 *********************************************************************************************************
 */
 
@@ -957,18 +2253,11 @@ CPU_INT32U  CRC_ChkSumCalc_32Bit (CRC_MODEL_32  *p_model,
                                             p_data_08,
                                             size);
         }
-    } else {
-        if (p_model->Reflect == DEF_YES) {
-            crc = CRC_ChkSumCalcTbl_32Bit_ref(init_val,
-                                              p_model->TblPtr,
-                                              p_data_08,
-                                              size);
-        } else {
-            crc = CRC_ChkSumCalcTbl_32Bit(init_val,
-                                          p_model->TblPtr,
-                                          p_data_08,
-                                          size);
-        }
+    } else {                                                    /* See Note #3.                                         */
+        crc = CRC_ChkSumCalcTblModel_32Bit(p_model,
+                                            init_val,
+                                            p_data_08,
+                                            size);
     }
 
     crc  ^= p_model->XorOut;
@@ -978,6 +2267,120 @@ CPU_INT32U  CRC_ChkSumCalc_32Bit (CRC_MODEL_32  *p_model,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      CRC_TblSliceMake_16Bit()
+*
+* Description : Make a 16-bit CRC slicing-by-8 table from a model's table.
+*
+* Argument(s) : p_tbl           Pre-computed CRC table of the model.
+*
+*               reflect         Reflection of the model :
+*
+*                                   DEF_NO      Data NOT reflected.
+*                                   DEF_YES     Data     reflected.
+*
+*               p_tbl_slice     Pointer to slicing-by-8 table to make, of EDC_CRC_TBL_SLICE_NBR_ENTRIES
+*                                   entries (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The first 256 entries are a copy of the model's table.  Each following 256-entry
+*                   table advances the previous one by one more zero octet :
+*
+*                       T[k][i] = (T[k-1][i] << 8) ^ T[0][T[k-1][i] >> 8]       non-reflected
+*                       T[k][i] = (T[k-1][i] >> 8) ^ T[0][T[k-1][i] & 0xFF]     reflected
+*
+*               (2) Once made, set the model's 'TblSlicePtr' to the table (see 'edc_crc.h  CRC MODEL
+*                   DATA TYPES  Note #1').
+*
+*               (3) The provided models already use a constant table if EDC_CRC_CFG_TBL_SLICE_EN is
+*                   DEF_ENABLED (see 'edc_crc.h  CONSTANTS  Note #3').
+*********************************************************************************************************
+*/
+
+void  CRC_TblSliceMake_16Bit (const  CPU_INT16U   *p_tbl,
+                                     CPU_BOOLEAN   reflect,
+                                     CPU_INT16U   *p_tbl_slice)
+{
+    CPU_INT16U  crc;
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < 256u; ix++) {
+        p_tbl_slice[ix] = p_tbl[ix];
+    }
+
+    for (ix = 256u; ix < EDC_CRC_TBL_SLICE_NBR_ENTRIES; ix++) { /* See Note #1.                                         */
+        crc = p_tbl_slice[ix - 256u];
+        if (reflect == DEF_YES) {
+            p_tbl_slice[ix] = (CPU_INT16U)(crc >> 8) ^ p_tbl[crc & 0xFFu];
+        } else {
+            p_tbl_slice[ix] = (CPU_INT16U)(crc << 8) ^ p_tbl[crc >> 8];
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      CRC_TblSliceMake_32Bit()
+*
+* Description : Make a 32-bit CRC slicing-by-8 table from a model's table.
+*
+* Argument(s) : p_tbl           Pre-computed CRC table of the model.
+*
+*               reflect         Reflection of the model :
+*
+*                                   DEF_NO      Data NOT reflected.
+*                                   DEF_YES     Data     reflected.
+*
+*               p_tbl_slice     Pointer to slicing-by-8 table to make, of EDC_CRC_TBL_SLICE_NBR_ENTRIES
+*                                   entries (see Note #1).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The first 256 entries are a copy of the model's table.  Each following 256-entry
+*                   table advances the previous one by one more zero octet :
+*
+*                       T[k][i] = (T[k-1][i] << 8) ^ T[0][T[k-1][i] >> 24]      non-reflected
+*                       T[k][i] = (T[k-1][i] >> 8) ^ T[0][T[k-1][i] & 0xFF]     reflected
+*
+*               (2) Once made, set the model's 'TblSlicePtr' to the table (see 'edc_crc.h  CRC MODEL
+*                   DATA TYPES  Note #1').
+*
+*               (3) The provided models already use a constant table if EDC_CRC_CFG_TBL_SLICE_EN is
+*                   DEF_ENABLED (see 'edc_crc.h  CONSTANTS  Note #3').
+*********************************************************************************************************
+*/
+
+void  CRC_TblSliceMake_32Bit (const  CPU_INT32U   *p_tbl,
+                                     CPU_BOOLEAN   reflect,
+                                     CPU_INT32U   *p_tbl_slice)
+{
+    CPU_INT32U  crc;
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < 256u; ix++) {
+        p_tbl_slice[ix] = p_tbl[ix];
+    }
+
+    for (ix = 256u; ix < EDC_CRC_TBL_SLICE_NBR_ENTRIES; ix++) { /* See Note #1.                                         */
+        crc = p_tbl_slice[ix - 256u];
+        if (reflect == DEF_YES) {
+            p_tbl_slice[ix] = (crc >> 8) ^ p_tbl[crc & 0xFFu];
+        } else {
+            p_tbl_slice[ix] = (crc << 8) ^ p_tbl[crc >> 24];
+        }
+    }
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1112,6 +2515,284 @@ static  CPU_INT32U  CRC_ChkSumCalcTbl_32Bit_ref (CPU_INT32U          init_val,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                   CRC_ChkSumCalcTblModel_16Bit() / CRC_ChkSumCalcTblModel_32Bit()
+*
+* Description : Calculate a CRC with the fastest method provided by a model with a table.
+*
+* Argument(s) : p_model     Pointer to model to use in calculation.
+*
+*               init_val    Initial CRC value.
+*
+*               p_data      Pointer to data buffer.
+*
+*               size        Size of buffer, in octets.
+*
+* Return(s)   : CRC.
+*
+* Caller(s)   : CRC_WrBlock_16Bit(), CRC_ChkSumCalc_16Bit(),
+*               CRC_WrBlock_32Bit(), CRC_ChkSumCalc_32Bit().
+*
+* Note(s)     : (1) Methods are selected in this order (see 'edc_crc.h  CRC MODEL DATA TYPES') :
+*
+*                   (a) CPU CRC function, for reflected 32-bit models ONLY.
+*                   (b) Slicing-by-8 table.
+*                   (c) Table.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  CRC_ChkSumCalcTblModel_16Bit (const  CRC_MODEL_16  *p_model,
+                                                  CPU_INT16U          init_val,
+                                                  CPU_INT08U         *p_data,
+                                                  CPU_SIZE_T          size)
+{
+    CPU_INT16U  crc;
+
+
+    if (p_model->TblSlicePtr != (const CPU_INT16U *)0) {       /* See Note #1b.                                        */
+        if (p_model->Reflect == DEF_YES) {
+            crc = CRC_ChkSumCalcTblSlice_16Bit_ref(init_val, p_model->TblSlicePtr, p_data, size);
+        } else {
+            crc = CRC_ChkSumCalcTblSlice_16Bit    (init_val, p_model->TblSlicePtr, p_data, size);
+        }
+    } else {                                                    /* See Note #1c.                                        */
+        if (p_model->Reflect == DEF_YES) {
+            crc = CRC_ChkSumCalcTbl_16Bit_ref(init_val, p_model->TblPtr, p_data, size);
+        } else {
+            crc = CRC_ChkSumCalcTbl_16Bit    (init_val, p_model->TblPtr, p_data, size);
+        }
+    }
+
+    return (crc);
+}
+
+static  CPU_INT32U  CRC_ChkSumCalcTblModel_32Bit (const  CRC_MODEL_32  *p_model,
+                                                  CPU_INT32U          init_val,
+                                                  CPU_INT08U         *p_data,
+                                                  CPU_SIZE_T          size)
+{
+    CPU_INT32U  crc;
+
+
+    if ((p_model->HW_Fnct != (CRC_HW_FNCT_32)0) &&              /* See Note #1a.                                        */
+        (p_model->Reflect == DEF_YES)) {
+        crc = p_model->HW_Fnct(init_val, p_data, size);
+
+    } else if (p_model->TblSlicePtr != (const CPU_INT32U *)0) { /* See Note #1b.                                        */
+        if (p_model->Reflect == DEF_YES) {
+            crc = CRC_ChkSumCalcTblSlice_32Bit_ref(init_val, p_model->TblSlicePtr, p_data, size);
+        } else {
+            crc = CRC_ChkSumCalcTblSlice_32Bit    (init_val, p_model->TblSlicePtr, p_data, size);
+        }
+
+    } else {                                                    /* See Note #1c.                                        */
+        if (p_model->Reflect == DEF_YES) {
+            crc = CRC_ChkSumCalcTbl_32Bit_ref(init_val, p_model->TblPtr, p_data, size);
+        } else {
+            crc = CRC_ChkSumCalcTbl_32Bit    (init_val, p_model->TblPtr, p_data, size);
+        }
+    }
+
+    return (crc);
+}
+
+
+/*
+*********************************************************************************************************
+*                 CRC_ChkSumCalcTblSlice_16Bit() / CRC_ChkSumCalcTblSlice_16Bit_ref()
+*
+* Description : Calculate a 16-bit CRC using a slicing-by-8 table with or without reflection.
+*
+* Argument(s) : init_val        Initial CRC value.
+*
+*               p_tbl_slice     Slicing-by-8 table to use in calculation (see 'CRC_TblSliceMake_16Bit()').
+*
+*               p_data          Pointer to data buffer.
+*
+*               size            Size of buffer, in octets.
+*
+* Return(s)   : 16-bit CRC.
+*
+* Caller(s)   : CRC_ChkSumCalcTblModel_16Bit().
+*
+* Note(s)     : (1) Eight octets are processed per iteration : the CRC is combined with the first two
+*                   octets & each octet indexes the table advanced by the number of octets following it.
+*                   Octets are read one at a time, so the data buffer does NOT need to be aligned.
+*
+*               (2) Remaining octets are processed with the first 256 entries, i.e. the model's table.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  CRC_ChkSumCalcTblSlice_16Bit (CPU_INT16U          init_val,
+                                                  const  CPU_INT16U  *p_tbl_slice,
+                                                  CPU_INT08U         *p_data,
+                                                  CPU_SIZE_T          size)
+{
+    CPU_INT16U  crc;
+    CPU_INT08U  ix;
+
+
+    crc = init_val;
+    while (size >= EDC_CRC_TBL_SLICE_NBR) {                     /* See Note #1.                                         */
+        crc    ^= (CPU_INT16U)(((CPU_INT16U)p_data[0] << 8) | p_data[1]);
+        crc     = p_tbl_slice[(7u * 256u) + (crc >> 8)]      ^
+                  p_tbl_slice[(6u * 256u) + (crc &  0xFFu)]  ^
+                  p_tbl_slice[(5u * 256u) +  p_data[2]]      ^
+                  p_tbl_slice[(4u * 256u) +  p_data[3]]      ^
+                  p_tbl_slice[(3u * 256u) +  p_data[4]]      ^
+                  p_tbl_slice[(2u * 256u) +  p_data[5]]      ^
+                  p_tbl_slice[(1u * 256u) +  p_data[6]]      ^
+                  p_tbl_slice[                p_data[7]];
+        p_data += EDC_CRC_TBL_SLICE_NBR;
+        size   -= EDC_CRC_TBL_SLICE_NBR;
+    }
+
+    while (size > 0u) {                                         /* See Note #2.                                         */
+        ix      = (CPU_INT08U)((CPU_INT08U)(crc >> 8) ^ *p_data) & 0xFFu;
+        crc     = p_tbl_slice[ix] ^ (CPU_INT16U)(crc << 8);
+        p_data += sizeof(CPU_INT08U);
+        size   -= sizeof(CPU_INT08U);
+    }
+    return (crc);
+}
+
+static  CPU_INT16U  CRC_ChkSumCalcTblSlice_16Bit_ref (CPU_INT16U          init_val,
+                                                      const  CPU_INT16U  *p_tbl_slice,
+                                                      CPU_INT08U         *p_data,
+                                                      CPU_SIZE_T          size)
+{
+    CPU_INT16U  crc;
+    CPU_INT08U  ix;
+
+
+    crc = init_val;
+    while (size >= EDC_CRC_TBL_SLICE_NBR) {                     /* See Note #1.                                         */
+        crc    ^= (CPU_INT16U)(((CPU_INT16U)p_data[1] << 8) | p_data[0]);
+        crc     = p_tbl_slice[(7u * 256u) + (crc &  0xFFu)]  ^
+                  p_tbl_slice[(6u * 256u) + (crc >> 8)]      ^
+                  p_tbl_slice[(5u * 256u) +  p_data[2]]      ^
+                  p_tbl_slice[(4u * 256u) +  p_data[3]]      ^
+                  p_tbl_slice[(3u * 256u) +  p_data[4]]      ^
+                  p_tbl_slice[(2u * 256u) +  p_data[5]]      ^
+                  p_tbl_slice[(1u * 256u) +  p_data[6]]      ^
+                  p_tbl_slice[                p_data[7]];
+        p_data += EDC_CRC_TBL_SLICE_NBR;
+        size   -= EDC_CRC_TBL_SLICE_NBR;
+    }
+
+    while (size > 0u) {                                         /* See Note #2.                                         */
+        ix      = (CPU_INT08U)(crc ^ *p_data) & 0xFFu;
+        crc     = p_tbl_slice[ix] ^ (CPU_INT08U)(crc >> 8);
+        p_data += sizeof(CPU_INT08U);
+        size   -= sizeof(CPU_INT08U);
+    }
+    return (crc);
+}
+
+
+/*
+*********************************************************************************************************
+*                 CRC_ChkSumCalcTblSlice_32Bit() / CRC_ChkSumCalcTblSlice_32Bit_ref()
+*
+* Description : Calculate a 32-bit CRC using a slicing-by-8 table with or without reflection.
+*
+* Argument(s) : init_val        Initial CRC value.
+*
+*               p_tbl_slice     Slicing-by-8 table to use in calculation (see 'CRC_TblSliceMake_32Bit()').
+*
+*               p_data          Pointer to data buffer.
+*
+*               size            Size of buffer, in octets.
+*
+* Return(s)   : 32-bit CRC.
+*
+* Caller(s)   : CRC_ChkSumCalcTblModel_32Bit().
+*
+* Note(s)     : (1) Eight octets are processed per iteration : the CRC is combined with the first four
+*                   octets & each octet indexes the table advanced by the number of octets following it.
+*                   Octets are read one at a time, so the data buffer does NOT need to be aligned & the
+*                   result does NOT depend on the CPU endianness.
+*
+*               (2) Remaining octets are processed with the first 256 entries, i.e. the model's table.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  CRC_ChkSumCalcTblSlice_32Bit (CPU_INT32U          init_val,
+                                                  const  CPU_INT32U  *p_tbl_slice,
+                                                  CPU_INT08U         *p_data,
+                                                  CPU_SIZE_T          size)
+{
+    CPU_INT32U  crc;
+    CPU_INT32U  data_hi;
+    CPU_INT08U  ix;
+
+
+    crc = init_val;
+    while (size >= EDC_CRC_TBL_SLICE_NBR) {                     /* See Note #1.                                         */
+        crc    ^= ((CPU_INT32U)p_data[0] << 24) | ((CPU_INT32U)p_data[1] << 16) |
+                  ((CPU_INT32U)p_data[2] <<  8) |  (CPU_INT32U)p_data[3];
+        data_hi =  ((CPU_INT32U)p_data[4] << 24) | ((CPU_INT32U)p_data[5] << 16) |
+                   ((CPU_INT32U)p_data[6] <<  8) |  (CPU_INT32U)p_data[7];
+        crc     = p_tbl_slice[(7u * 256u) + ( crc     >> 24)]          ^
+                  p_tbl_slice[(6u * 256u) + ((crc     >> 16) & 0xFFu)] ^
+                  p_tbl_slice[(5u * 256u) + ((crc     >>  8) & 0xFFu)] ^
+                  p_tbl_slice[(4u * 256u) + ( crc            & 0xFFu)] ^
+                  p_tbl_slice[(3u * 256u) + ( data_hi >> 24)]          ^
+                  p_tbl_slice[(2u * 256u) + ((data_hi >> 16) & 0xFFu)] ^
+                  p_tbl_slice[(1u * 256u) + ((data_hi >>  8) & 0xFFu)] ^
+                  p_tbl_slice[               ( data_hi        & 0xFFu)];
+        p_data += EDC_CRC_TBL_SLICE_NBR;
+        size   -= EDC_CRC_TBL_SLICE_NBR;
+    }
+
+    while (size > 0u) {                                         /* See Note #2.                                         */
+        ix      = (CPU_INT08U)(((crc >> 24) ^ *p_data) & 0xFFu);
+        crc     = p_tbl_slice[ix] ^ (crc << 8);
+        p_data += sizeof(CPU_INT08U);
+        size   -= sizeof(CPU_INT08U);
+    }
+    return (crc);
+}
+
+static  CPU_INT32U  CRC_ChkSumCalcTblSlice_32Bit_ref (CPU_INT32U          init_val,
+                                                      const  CPU_INT32U  *p_tbl_slice,
+                                                      CPU_INT08U         *p_data,
+                                                      CPU_SIZE_T          size)
+{
+    CPU_INT32U  crc;
+    CPU_INT32U  data_hi;
+    CPU_INT08U  ix;
+
+
+    crc = init_val;
+    while (size >= EDC_CRC_TBL_SLICE_NBR) {                     /* See Note #1.                                         */
+        crc    ^=  (CPU_INT32U)p_data[0]        | ((CPU_INT32U)p_data[1] <<  8) |
+                  ((CPU_INT32U)p_data[2] << 16) | ((CPU_INT32U)p_data[3] << 24);
+        data_hi =  (CPU_INT32U)p_data[4]        | ((CPU_INT32U)p_data[5] <<  8) |
+                  ((CPU_INT32U)p_data[6] << 16) | ((CPU_INT32U)p_data[7] << 24);
+        crc     = p_tbl_slice[(7u * 256u) + ( crc             & 0xFFu)] ^
+                  p_tbl_slice[(6u * 256u) + ((crc     >>  8) & 0xFFu)] ^
+                  p_tbl_slice[(5u * 256u) + ((crc     >> 16) & 0xFFu)] ^
+                  p_tbl_slice[(4u * 256u) + ( crc     >> 24)]          ^
+                  p_tbl_slice[(3u * 256u) + ( data_hi         & 0xFFu)] ^
+                  p_tbl_slice[(2u * 256u) + ((data_hi >>  8) & 0xFFu)] ^
+                  p_tbl_slice[(1u * 256u) + ((data_hi >> 16) & 0xFFu)] ^
+                  p_tbl_slice[               ( data_hi >> 24)];
+        p_data += EDC_CRC_TBL_SLICE_NBR;
+        size   -= EDC_CRC_TBL_SLICE_NBR;
+    }
+
+    while (size > 0u) {                                         /* See Note #2.                                         */
+        ix      = (CPU_INT08U)(crc ^ *p_data) & 0xFFu;
+        crc     = p_tbl_slice[ix] ^ (crc >> 8);
+        p_data += sizeof(CPU_INT08U);
+        size   -= sizeof(CPU_INT08U);
+    }
+    return (crc);
+}
+
+
 /*
 *********************************************************************************************************
 *                    CRC_ChkSumCalcNoTbl_16Bit() / CRC_ChkSumCalcNoTbl_16Bit_ref()
@@ -139,6 +139,18 @@
 #define  EDC_CRC_CFG_CRC32_REF_EN               DEF_DISABLED
 #endif
 
+#ifndef  EDC_CRC_CFG_CRC32C_REF_EN
+#define  EDC_CRC_CFG_CRC32C_REF_EN              DEF_DISABLED
+#endif
+
+#ifndef  EDC_CRC_CFG_OPTIMIZE_HW_EN
+#define  EDC_CRC_CFG_OPTIMIZE_HW_EN             DEF_DISABLED
+#endif
+
+#ifndef  EDC_CRC_CFG_TBL_SLICE_EN
+#define  EDC_CRC_CFG_TBL_SLICE_EN               DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -146,6 +158,21 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                        SLICING-BY-8 DEFINES
+*
+* Note(s) : (1) A slicing-by-8 table is made of 8 consecutive 256-entry tables, built by
+*               'CRC_TblSliceMake_16Bit()'/'CRC_TblSliceMake_32Bit()' from a model's table.
+*
+*           (2) Constant slicing-by-8 tables are supplied for the provided models if
+*               EDC_CRC_CFG_TBL_SLICE_EN is DEF_ENABLED (see 'CONSTANTS  Note #3').
+*********************************************************************************************************
+*/
+
+#define  EDC_CRC_TBL_SLICE_NBR                             8u
+#define  EDC_CRC_TBL_SLICE_NBR_ENTRIES                  (EDC_CRC_TBL_SLICE_NBR * 256u)
+
 /*
 *********************************************************************************************************
 *                                            CRC ERROR CODES
@@ -165,20 +192,48 @@ typedef enum edc_err {
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                           CRC MODEL DATA TYPES
+*
+* Note(s) : (1) 'TblSlicePtr' optionally points to a slicing-by-8 table (see 'SLICING-BY-8 DEFINES'),
+*               used instead of 'TblPtr' to process 8 octets per iteration.  MUST be built from the
+*               model's table & reflection; set to a NULL pointer to process 1 octet per iteration.
+*               The provided models point to their constant slicing-by-8 table if
+*               EDC_CRC_CFG_TBL_SLICE_EN is DEF_ENABLED.
+*
+*           (2) 'HW_Fnct' optionally points to a function that calculates the CRC with the CPU's CRC
+*               instructions (see 'FUNCTION PROTOTYPES  defined in edc_crc_hw.c').  Used instead of the
+*               tables ONLY for reflected models; the function MUST implement the model's polynomial.
+*               Set to a NULL pointer to calculate the CRC in software.
+*
+*               (a) 'CRC_ModelCRC32C_ref' uses CRC_ChkSumCalcHW_CRC32C_ref() if EDC_CRC_CFG_OPTIMIZE_HW_EN
+*                   is DEF_ENABLED.  Other models MUST be copied & their 'HW_Fnct' set by the application
+*                   (e.g. to CRC_ChkSumCalcHW_CRC32_ref() on ports that implement it).
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT32U  (*CRC_HW_FNCT_32)(CPU_INT32U    init_val,
+                                       CPU_INT08U   *p_data,
+                                       CPU_SIZE_T    size);
+
 typedef  struct  crc_model_16 {
-           CPU_INT16U    Poly;
-           CPU_INT16U    InitVal;
-           CPU_BOOLEAN   Reflect;
-           CPU_INT16U    XorOut;
-    const  CPU_INT16U   *TblPtr;
+           CPU_INT16U       Poly;
+           CPU_INT16U       InitVal;
+           CPU_BOOLEAN      Reflect;
+           CPU_INT16U       XorOut;
+    const  CPU_INT16U      *TblPtr;
+    const  CPU_INT16U      *TblSlicePtr;                        /* See Note #1.                                         */
 } CRC_MODEL_16;
 
 typedef  struct  crc_model_32 {
-           CPU_INT32U    Poly;
-           CPU_INT32U    InitVal;
-           CPU_BOOLEAN   Reflect;
-           CPU_INT32U    XorOut;
-    const  CPU_INT32U   *TblPtr;
+           CPU_INT32U       Poly;
+           CPU_INT32U       InitVal;
+           CPU_BOOLEAN      Reflect;
+           CPU_INT32U       XorOut;
+    const  CPU_INT32U      *TblPtr;
+    const  CPU_INT32U      *TblSlicePtr;                        /* See Note #1.                                         */
+           CRC_HW_FNCT_32   HW_Fnct;                            /* See Note #2.                                         */
 } CRC_MODEL_32;
 
 typedef  struct  crc_calc_16 {
@@ -247,6 +302,8 @@ typedef  struct  crc_calc_32 {
 *                       | 0x04C11DB7 |     YES    | 0xFFFFFFFF |     NO     | 0x340BC6D9 |
 *                       | 0x04C11DB7 |     YES    | 0xFFFFFFFF |     YES    | 0xCBF43926 |
 *                       -------------+------------+------------+------------+-------------
+*                       | 0x1EDC6F41 |     YES    | 0xFFFFFFFF |     YES    | 0xE3069283 |
+*                       -------------+------------+------------+------------+-------------
 *
 *               (a) The column 'COMP. OUT?' (short for 'COMPLEMENT OUTPUT?') indicates whether the output
 *                   XOR value would be either 0xFFFF (for a CRC16) or 0xFFFFFFFF (for a CRC32).
@@ -271,49 +328,86 @@ typedef  struct  crc_calc_32 {
 *               do not matter.  Consequently, the provided tables may be used with user-defined models
 *               that differ only in initial value &/or XOR for the output with the models provided
 *               here.
+*
+*           (3) If EDC_CRC_CFG_TBL_SLICE_EN is DEF_ENABLED, a constant slicing-by-8 table (of
+*               EDC_CRC_TBL_SLICE_NBR_ENTRIES entries) is also supplied for each provided model & set
+*               as the model's 'TblSlicePtr'.  Each is identical to the table 'CRC_TblSliceMake_16Bit()'/
+*               'CRC_TblSliceMake_32Bit()' would make from the model's table; see also Note #2.
 *********************************************************************************************************
 */
 
 #if (EDC_CRC_CFG_CRC16_1021_EN == DEF_ENABLED)
 extern  const  CPU_INT16U    CRC_TblCRC16_1021[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT16U    CRC_TblSliceCRC16_1021[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_16  CRC_ModelCRC16_1021;
 #endif
 
 #if (EDC_CRC_CFG_CRC16_1021_REF_EN == DEF_ENABLED)
 extern  const  CPU_INT16U    CRC_TblCRC16_1021_ref[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT16U    CRC_TblSliceCRC16_1021_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_16  CRC_ModelCRC16_1021_ref;
 #endif
 
 #if (EDC_CRC_CFG_CRC16_8005_EN == DEF_ENABLED)
 extern  const  CPU_INT16U    CRC_TblCRC16_8005[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT16U    CRC_TblSliceCRC16_8005[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_16  CRC_ModelCRC16_8005;
 #endif
 
 #if (EDC_CRC_CFG_CRC16_8005_REF_EN == DEF_ENABLED)
 extern  const  CPU_INT16U    CRC_TblCRC16_8005_ref[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT16U    CRC_TblSliceCRC16_8005_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_16  CRC_ModelCRC16_8005_ref;
 #endif
 
 #if (EDC_CRC_CFG_CRC16_8048_EN == DEF_ENABLED)
 extern  const  CPU_INT16U    CRC_TblCRC16_8048[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT16U    CRC_TblSliceCRC16_8048[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_16  CRC_ModelCRC16_8048;
 #endif
 
 #if (EDC_CRC_CFG_CRC16_8048_REF_EN == DEF_ENABLED)
 extern  const  CPU_INT16U    CRC_TblCRC16_8048_ref[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT16U    CRC_TblSliceCRC16_8048_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_16  CRC_ModelCRC16_8048_ref;
 #endif
 
 #if (EDC_CRC_CFG_CRC32_EN == DEF_ENABLED)
 extern  const  CPU_INT32U    CRC_TblCRC32[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT32U    CRC_TblSliceCRC32[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_32  CRC_ModelCRC32;
 #endif
 
 #if (EDC_CRC_CFG_CRC32_REF_EN == DEF_ENABLED)
 extern  const  CPU_INT32U    CRC_TblCRC32_ref[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT32U    CRC_TblSliceCRC32_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
 extern  const  CRC_MODEL_32  CRC_ModelCRC32_ref;
 #endif
 
+#if (EDC_CRC_CFG_CRC32C_REF_EN == DEF_ENABLED)
+extern  const  CPU_INT32U    CRC_TblCRC32C_ref[256];
+#if (EDC_CRC_CFG_TBL_SLICE_EN == DEF_ENABLED)
+extern  const  CPU_INT32U    CRC_TblSliceCRC32C_ref[EDC_CRC_TBL_SLICE_NBR_ENTRIES];
+#endif
+extern  const  CRC_MODEL_32  CRC_ModelCRC32C_ref;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -383,6 +477,37 @@ CPU_INT32U  CRC_ChkSumCalc_32Bit       (CRC_MODEL_32       *p_model,
                                         EDC_ERR            *p_err);
 
 
+                                                                /* ---------------- SLICING-BY-8 TABLES --------------- */
+void        CRC_TblSliceMake_16Bit     (const  CPU_INT16U  *p_tbl,
+                                        CPU_BOOLEAN         reflect,
+                                        CPU_INT16U         *p_tbl_slice);
+
+void        CRC_TblSliceMake_32Bit     (const  CPU_INT32U  *p_tbl,
+                                        CPU_BOOLEAN         reflect,
+                                        CPU_INT32U         *p_tbl_slice);
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*                                       defined in edc_crc_hw.c
+*
+* Note(s) : (1) CPU-specific CRC functions are implemented in '\<CRC>\Ports\<cpu>\<compiler>\edc_crc_hw.c'.
+*               A port MAY implement only the functions its CPU's CRC instructions support.
+*********************************************************************************************************
+*/
+
+#if (EDC_CRC_CFG_OPTIMIZE_HW_EN == DEF_ENABLED)
+CPU_INT32U  CRC_ChkSumCalcHW_CRC32_ref (CPU_INT32U          init_val,
+                                        CPU_INT08U         *p_data,
+                                        CPU_SIZE_T          size);
+
+CPU_INT32U  CRC_ChkSumCalcHW_CRC32C_ref(CPU_INT32U          init_val,
+                                        CPU_INT08U         *p_data,
+                                        CPU_SIZE_T          size);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -547,6 +672,44 @@ CPU_INT32U  CRC_ChkSumCalcTbl_32Bit_ref(CPU_INT32U          init_val,
 #endif
 
 
+#ifndef  EDC_CRC_CFG_CRC32C_REF_EN
+#error  "EDC_CRC_CFG_CRC32C_REF_EN              not #define'd in 'app_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#elif  ((EDC_CRC_CFG_CRC32C_REF_EN != DEF_ENABLED ) && \
+        (EDC_CRC_CFG_CRC32C_REF_EN != DEF_DISABLED))
+#error  "EDC_CRC_CFG_CRC32C_REF_EN        illegally #define'd in 'app_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#endif
+
+
+
+#ifndef  EDC_CRC_CFG_OPTIMIZE_HW_EN
+#error  "EDC_CRC_CFG_OPTIMIZE_HW_EN             not #define'd in 'app_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#elif  ((EDC_CRC_CFG_OPTIMIZE_HW_EN != DEF_ENABLED ) && \
+        (EDC_CRC_CFG_OPTIMIZE_HW_EN != DEF_DISABLED))
+#error  "EDC_CRC_CFG_OPTIMIZE_HW_EN       illegally #define'd in 'app_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#endif
+
+
+
+#ifndef  EDC_CRC_CFG_TBL_SLICE_EN
+#error  "EDC_CRC_CFG_TBL_SLICE_EN               not #define'd in 'app_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#elif  ((EDC_CRC_CFG_TBL_SLICE_EN != DEF_ENABLED ) && \
+        (EDC_CRC_CFG_TBL_SLICE_EN != DEF_DISABLED))
+#error  "EDC_CRC_CFG_TBL_SLICE_EN         illegally #define'd in 'app_cfg.h'"
+#error  "                                 [MUST be DEF_ENABLED ]            "
+#error  "                                 [     || DEF_DISABLED]            "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
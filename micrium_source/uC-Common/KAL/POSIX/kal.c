@@ -44,6 +44,7 @@
 
 #include  <pthread.h>
 #include  <semaphore.h>
+#include  <errno.h>
 
 
 /*
@@ -579,15 +580,24 @@ void  KAL_LockAcquire (KAL_LOCK_HANDLE   lock_handle,
         return;
     }
 
-    if (opt != 0u) {                                            /* Chk for invalid opt flag.                            */
-       *p_err = KAL_ERR_INVALID_ARG;
+    if (DEF_BIT_IS_SET_ANY(opt, ~(KAL_OPT_PEND_NONE | KAL_OPT_PEND_NON_BLOCKING)) == DEF_YES) {
+       *p_err = KAL_ERR_INVALID_ARG;                            /* Chk for invalid opt flag.                            */
         return;
     }
 #endif
 
     p_lock_data = (KAL_LOCK *)lock_handle.LockObjPtr;
 
-    if (timeout == 0u) {
+    if (DEF_BIT_IS_SET(opt, KAL_OPT_PEND_NON_BLOCKING) == DEF_YES) {
+        pthread_err = pthread_mutex_trylock(&p_lock_data->Mutex);
+        if (pthread_err == EBUSY) {                             /* Lock owned by another thread.                        */
+           *p_err = KAL_ERR_WOULD_BLOCK;
+            return;
+        } else if (pthread_err != 0) {
+           *p_err = KAL_ERR_OS;
+            return;
+        }
+    } else if (timeout == 0u) {
         pthread_err = pthread_mutex_lock(&p_lock_data->Mutex);
         if (pthread_err != 0) {
            *p_err = KAL_ERR_OS;
@@ -78,6 +78,23 @@
 #define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_DISABLED
 
 
+/*
+*********************************************************************************************************
+*                           MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_OPTIMIZE_SIMD_EN to enable/disable SIMD-optimized Mem_Set(), Mem_Copy()
+*               & Mem_Cmp() for large buffers. Requires the port's 'lib_mem_simd.c' to be built.
+*
+*               See also 'lib_mem.h  MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION'.
+*********************************************************************************************************
+*/
+
+                                                                /* SIMD-optimized function(s).                          */
+                                                                /* Enable/disable SIMD-optimized memory ...             */
+                                                                /* ... function(s). [see Note #1]                       */
+#define  LIB_MEM_CFG_OPTIMIZE_SIMD_EN   DEF_DISABLED
+
+
 /*
 *********************************************************************************************************
 *                                   MEMORY ALLOCATION CONFIGURATION
@@ -120,6 +137,32 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  DYNAMIC MEMORY POOL CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN to enable/disable the lock-free free list of
+*               dynamic memory pools. Falls back to critical sections if the CPU/compiler does NOT provide
+*               a lock-free double-word compare-and-swap. 64-bit address CPUs require the port to #define
+*               CPU_CFG_DCAS_PRESENT & provide CPU_DCAS().
+*
+*               See also 'lib_mem.h  DYNAMIC MEMORY POOL LOCK-FREE SUPPORT'.
+*
+*           (2) Configure LIB_MEM_CFG_DYN_POOL_CACHE_EN to enable/disable the per-task dynamic memory pool
+*               caches (Mem_DynPoolCache...() functions).
+*********************************************************************************************************
+*/
+
+                                                                /* Lock-free dynamic memory pool free list.             */
+                                                                /* Enable/disable lock-free free list (see Note #1).    */
+#define  LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN  DEF_DISABLED
+
+
+                                                                /* Per-task dynamic memory pool caches.                 */
+                                                                /* Enable/disable dyn mem pool caches (see Note #2).    */
+#define  LIB_MEM_CFG_DYN_POOL_CACHE_EN      DEF_DISABLED
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
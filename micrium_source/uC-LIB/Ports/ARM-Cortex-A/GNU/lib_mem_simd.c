@@ -0,0 +1,246 @@
+/*
+*********************************************************************************************************
+*                                               uC/LIB
+*                                       Custom Library Modules
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                   SIMD-OPTIMIZED MEMORY OPERATIONS
+*
+*                                     ARM-Cortex-A (ARMv7-A/ARMv8-A)
+*                                             GNU Compiler
+*
+* Filename : lib_mem_simd.c
+* Version  : V1.39.01
+*********************************************************************************************************
+* Note(s)  : (1) NEON kernels are written with the ACLE intrinsics ('arm_neon.h') so that the same file
+*                builds for both AArch32 (-mfpu=neon) & AArch64 targets.
+*
+*            (2) Kernels are ONLY called by Mem_Set(), Mem_Copy() & Mem_Cmp() with a size that is a non-
+*                zero multiple of LIB_MEM_SIMD_BLK_SIZE; remaining octets are processed by the callers.
+*
+*            (3) NEON loads & stores do NOT require aligned addresses on ARMv7-A/ARMv8-A normal memory.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <lib_mem.h>
+
+
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+
+#ifndef  __ARM_NEON
+#error  "LIB_MEM_CFG_OPTIMIZE_SIMD_EN  requires NEON [see 'lib_mem_simd.c  Note #1']"
+#endif
+
+#include  <arm_neon.h>
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL CONSTANTS
+*********************************************************************************************************
+*/
+
+#define  MEM_SIMD_UNROLL_SIZE                   (4u * LIB_MEM_SIMD_BLK_SIZE)
+
+
+/*
+*********************************************************************************************************
+*                                            Mem_SetSIMD()
+*
+* Description : Fill a memory buffer with a data value, using NEON stores.
+*
+* Argument(s) : pmem        Pointer to memory buffer to fill with specified data octet.
+*
+*               data_val    Data fill octet value.
+*
+*               size        Number of octets to fill (see 'lib_mem_simd.c  Note #2').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Set().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  Mem_SetSIMD (void        *pmem,
+                   CPU_INT08U   data_val,
+                   CPU_SIZE_T   size)
+{
+    CPU_INT08U  *pmem_08;
+    uint8x16_t   data_vec;
+
+
+    pmem_08  = (CPU_INT08U *)pmem;
+    data_vec =  vdupq_n_u8(data_val);
+
+    while (size >= MEM_SIMD_UNROLL_SIZE) {                      /* Fill 4 vectors per iteration.                        */
+        vst1q_u8(pmem_08,       data_vec);
+        vst1q_u8(pmem_08 + 16u, data_vec);
+        vst1q_u8(pmem_08 + 32u, data_vec);
+        vst1q_u8(pmem_08 + 48u, data_vec);
+        pmem_08 += MEM_SIMD_UNROLL_SIZE;
+        size    -= MEM_SIMD_UNROLL_SIZE;
+    }
+
+    while (size >= LIB_MEM_SIMD_BLK_SIZE) {                     /* Fill remaining vectors.                              */
+        vst1q_u8(pmem_08, data_vec);
+        pmem_08 += LIB_MEM_SIMD_BLK_SIZE;
+        size    -= LIB_MEM_SIMD_BLK_SIZE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_CopySIMD()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer, using NEON loads & stores.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy (see 'lib_mem_simd.c  Note #2').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Copy().
+*
+* Note(s)     : (1) Memory buffers MAY overlap ONLY if the source buffer is located at least
+*                   LIB_MEM_SIMD_BLK_SIZE octets past the destination buffer, since each vector is
+*                   loaded before being stored.
+*********************************************************************************************************
+*/
+
+void  Mem_CopySIMD (       void        *pdest,
+                    const  void        *psrc,
+                           CPU_SIZE_T   size)
+{
+          CPU_INT08U  *pmem_08_dest;
+    const CPU_INT08U  *pmem_08_src;
+          uint8x16_t   data_vec_0;
+          uint8x16_t   data_vec_1;
+          uint8x16_t   data_vec_2;
+          uint8x16_t   data_vec_3;
+
+
+    pmem_08_dest = (      CPU_INT08U *)pdest;
+    pmem_08_src  = (const CPU_INT08U *)psrc;
+
+    while (size >= MEM_SIMD_UNROLL_SIZE) {                      /* Copy 4 vectors per iteration.                        */
+        data_vec_0 = vld1q_u8(pmem_08_src);
+        data_vec_1 = vld1q_u8(pmem_08_src + 16u);
+        data_vec_2 = vld1q_u8(pmem_08_src + 32u);
+        data_vec_3 = vld1q_u8(pmem_08_src + 48u);
+        vst1q_u8(pmem_08_dest,       data_vec_0);
+        vst1q_u8(pmem_08_dest + 16u, data_vec_1);
+        vst1q_u8(pmem_08_dest + 32u, data_vec_2);
+        vst1q_u8(pmem_08_dest + 48u, data_vec_3);
+        pmem_08_dest += MEM_SIMD_UNROLL_SIZE;
+        pmem_08_src  += MEM_SIMD_UNROLL_SIZE;
+        size         -= MEM_SIMD_UNROLL_SIZE;
+    }
+
+    while (size >= LIB_MEM_SIMD_BLK_SIZE) {                     /* Copy remaining vectors.                              */
+        vst1q_u8(pmem_08_dest, vld1q_u8(pmem_08_src));
+        pmem_08_dest += LIB_MEM_SIMD_BLK_SIZE;
+        pmem_08_src  += LIB_MEM_SIMD_BLK_SIZE;
+        size         -= LIB_MEM_SIMD_BLK_SIZE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Mem_CmpSIMD()
+*
+* Description : Verify that ALL data octets in two memory buffers are identical in sequence, using NEON
+*               loads & compares.
+*
+* Argument(s) : p1_mem      Pointer to first  memory buffer.
+*
+*               p2_mem      Pointer to second memory buffer.
+*
+*               size        Number of octets to compare (see 'lib_mem_simd.c  Note #2').
+*
+* Return(s)   : DEF_YES, if 'size' number of data octets are identical in both memory buffers.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Mem_Cmp().
+*
+* Note(s)     : (1) Differences are accumulated with XOR/OR over each unrolled iteration & reduced to a
+*                   single scalar test per iteration.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  Mem_CmpSIMD (const  void        *p1_mem,
+                          const  void        *p2_mem,
+                                 CPU_SIZE_T   size)
+{
+    const CPU_INT08U  *p1_mem_08;
+    const CPU_INT08U  *p2_mem_08;
+          uint8x16_t   diff_vec;
+          uint64x1_t   diff_64;
+
+
+    p1_mem_08 = (const CPU_INT08U *)p1_mem;
+    p2_mem_08 = (const CPU_INT08U *)p2_mem;
+
+    while (size >= MEM_SIMD_UNROLL_SIZE) {                      /* Cmp 4 vectors per iteration (see Note #1).           */
+        diff_vec = veorq_u8(vld1q_u8(p1_mem_08),       vld1q_u8(p2_mem_08));
+        diff_vec = vorrq_u8(diff_vec,
+                            veorq_u8(vld1q_u8(p1_mem_08 + 16u), vld1q_u8(p2_mem_08 + 16u)));
+        diff_vec = vorrq_u8(diff_vec,
+                            veorq_u8(vld1q_u8(p1_mem_08 + 32u), vld1q_u8(p2_mem_08 + 32u)));
+        diff_vec = vorrq_u8(diff_vec,
+                            veorq_u8(vld1q_u8(p1_mem_08 + 48u), vld1q_u8(p2_mem_08 + 48u)));
+        diff_64  = vorr_u64(vget_low_u64(vreinterpretq_u64_u8(diff_vec)),
+                            vget_high_u64(vreinterpretq_u64_u8(diff_vec)));
+        if (vget_lane_u64(diff_64, 0) != 0u) {
+            return (DEF_NO);
+        }
+        p1_mem_08 += MEM_SIMD_UNROLL_SIZE;
+        p2_mem_08 += MEM_SIMD_UNROLL_SIZE;
+        size      -= MEM_SIMD_UNROLL_SIZE;
+    }
+
+    while (size >= LIB_MEM_SIMD_BLK_SIZE) {                     /* Cmp remaining vectors.                               */
+        diff_vec = veorq_u8(vld1q_u8(p1_mem_08), vld1q_u8(p2_mem_08));
+        diff_64  = vorr_u64(vget_low_u64(vreinterpretq_u64_u8(diff_vec)),
+                            vget_high_u64(vreinterpretq_u64_u8(diff_vec)));
+        if (vget_lane_u64(diff_64, 0) != 0u) {
+            return (DEF_NO);
+        }
+        p1_mem_08 += LIB_MEM_SIMD_BLK_SIZE;
+        p2_mem_08 += LIB_MEM_SIMD_BLK_SIZE;
+        size      -= LIB_MEM_SIMD_BLK_SIZE;
+    }
+
+    return (DEF_YES);
+}
+
+#endif                                                          /* End of LIB_MEM_CFG_OPTIMIZE_SIMD_EN.                 */
@@ -0,0 +1,225 @@
+/*
+*********************************************************************************************************
+*                                               uC/LIB
+*                                       Custom Library Modules
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                   SIMD-OPTIMIZED MEMORY OPERATIONS
+*
+*                                          POSIX (x86/x86-64)
+*                                             GNU Compiler
+*
+* Filename : lib_mem_simd.c
+* Version  : V1.39.01
+*********************************************************************************************************
+* Note(s)  : (1) Kernels use AVX2 when the compiler targets it (e.g. -mavx2), SSE2 otherwise.
+*
+*            (2) Kernels are ONLY called by Mem_Set(), Mem_Copy() & Mem_Cmp() with a size that is a non-
+*                zero multiple of LIB_MEM_SIMD_BLK_SIZE; remaining octets are processed by the callers.
+*
+*            (3) Unaligned loads & stores are used; buffers do NOT need to be aligned.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <lib_mem.h>
+
+
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+
+#if   defined(__AVX2__)
+#include  <immintrin.h>
+#elif defined(__SSE2__)
+#include  <emmintrin.h>
+#else
+#error  "LIB_MEM_CFG_OPTIMIZE_SIMD_EN  requires SSE2 or AVX2 [see 'lib_mem_simd.c  Note #1']"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            Mem_SetSIMD()
+*
+* Description : Fill a memory buffer with a data value, using vector stores.
+*
+* Argument(s) : pmem        Pointer to memory buffer to fill with specified data octet.
+*
+*               data_val    Data fill octet value.
+*
+*               size        Number of octets to fill (see 'lib_mem_simd.c  Note #2').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Set().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  Mem_SetSIMD (void        *pmem,
+                   CPU_INT08U   data_val,
+                   CPU_SIZE_T   size)
+{
+    CPU_INT08U  *pmem_08;
+    __m128i      data_vec;
+#ifdef  __AVX2__
+    __m256i      data_vec_256;
+#endif
+
+
+    pmem_08  = (CPU_INT08U *)pmem;
+    data_vec = _mm_set1_epi8((char)data_val);
+
+#ifdef  __AVX2__
+    data_vec_256 = _mm256_set1_epi8((char)data_val);
+    while (size >= (2u * LIB_MEM_SIMD_BLK_SIZE)) {              /* Fill 32-octet vectors.                               */
+        _mm256_storeu_si256((__m256i *)pmem_08, data_vec_256);
+        pmem_08 += 2u * LIB_MEM_SIMD_BLK_SIZE;
+        size    -= 2u * LIB_MEM_SIMD_BLK_SIZE;
+    }
+#endif
+
+    while (size >= LIB_MEM_SIMD_BLK_SIZE) {                     /* Fill 16-octet vectors.                               */
+        _mm_storeu_si128((__m128i *)pmem_08, data_vec);
+        pmem_08 += LIB_MEM_SIMD_BLK_SIZE;
+        size    -= LIB_MEM_SIMD_BLK_SIZE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_CopySIMD()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer, using vector loads &
+*               stores.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy (see 'lib_mem_simd.c  Note #2').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Copy().
+*
+* Note(s)     : (1) Memory buffers MAY overlap ONLY if the source buffer is located past the destination
+*                   buffer, since each vector is loaded before being stored.
+*********************************************************************************************************
+*/
+
+void  Mem_CopySIMD (       void        *pdest,
+                    const  void        *psrc,
+                           CPU_SIZE_T   size)
+{
+          CPU_INT08U  *pmem_08_dest;
+    const CPU_INT08U  *pmem_08_src;
+
+
+    pmem_08_dest = (      CPU_INT08U *)pdest;
+    pmem_08_src  = (const CPU_INT08U *)psrc;
+
+#ifdef  __AVX2__
+    while (size >= (2u * LIB_MEM_SIMD_BLK_SIZE)) {              /* Copy 32-octet vectors.                               */
+        _mm256_storeu_si256((      __m256i *)pmem_08_dest,
+        _mm256_loadu_si256 ((const __m256i *)pmem_08_src));
+        pmem_08_dest += 2u * LIB_MEM_SIMD_BLK_SIZE;
+        pmem_08_src  += 2u * LIB_MEM_SIMD_BLK_SIZE;
+        size         -= 2u * LIB_MEM_SIMD_BLK_SIZE;
+    }
+#endif
+
+    while (size >= LIB_MEM_SIMD_BLK_SIZE) {                     /* Copy 16-octet vectors.                               */
+        _mm_storeu_si128((      __m128i *)pmem_08_dest,
+        _mm_loadu_si128 ((const __m128i *)pmem_08_src));
+        pmem_08_dest += LIB_MEM_SIMD_BLK_SIZE;
+        pmem_08_src  += LIB_MEM_SIMD_BLK_SIZE;
+        size         -= LIB_MEM_SIMD_BLK_SIZE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Mem_CmpSIMD()
+*
+* Description : Verify that ALL data octets in two memory buffers are identical in sequence, using vector
+*               loads & compares.
+*
+* Argument(s) : p1_mem      Pointer to first  memory buffer.
+*
+*               p2_mem      Pointer to second memory buffer.
+*
+*               size        Number of octets to compare (see 'lib_mem_simd.c  Note #2').
+*
+* Return(s)   : DEF_YES, if 'size' number of data octets are identical in both memory buffers.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Mem_Cmp().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  Mem_CmpSIMD (const  void        *p1_mem,
+                          const  void        *p2_mem,
+                                 CPU_SIZE_T   size)
+{
+    const CPU_INT08U  *p1_mem_08;
+    const CPU_INT08U  *p2_mem_08;
+          __m128i      cmp_vec;
+
+
+    p1_mem_08 = (const CPU_INT08U *)p1_mem;
+    p2_mem_08 = (const CPU_INT08U *)p2_mem;
+
+#ifdef  __AVX2__
+    while (size >= (2u * LIB_MEM_SIMD_BLK_SIZE)) {              /* Cmp 32-octet vectors.                                */
+        if ((CPU_INT32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p1_mem_08),
+                                                               _mm256_loadu_si256((const __m256i *)p2_mem_08))) != 0xFFFFFFFFu) {
+            return (DEF_NO);
+        }
+        p1_mem_08 += 2u * LIB_MEM_SIMD_BLK_SIZE;
+        p2_mem_08 += 2u * LIB_MEM_SIMD_BLK_SIZE;
+        size      -= 2u * LIB_MEM_SIMD_BLK_SIZE;
+    }
+#endif
+
+    while (size >= LIB_MEM_SIMD_BLK_SIZE) {                     /* Cmp 16-octet vectors.                                */
+        cmp_vec = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p1_mem_08),
+                                 _mm_loadu_si128((const __m128i *)p2_mem_08));
+        if (_mm_movemask_epi8(cmp_vec) != 0xFFFF) {
+            return (DEF_NO);
+        }
+        p1_mem_08 += LIB_MEM_SIMD_BLK_SIZE;
+        p2_mem_08 += LIB_MEM_SIMD_BLK_SIZE;
+        size      -= LIB_MEM_SIMD_BLK_SIZE;
+    }
+
+    return (DEF_YES);
+}
+
+#endif                                                          /* End of LIB_MEM_CFG_OPTIMIZE_SIMD_EN.                 */
@@ -58,6 +58,58 @@
 *********************************************************************************************************
 */
 
+                                                                /* --------------- SHIFT-MERGE MACROS ----------------- */
+#if (CPU_CFG_ENDIAN_TYPE == CPU_ENDIAN_TYPE_BIG)
+#define  MEM_ALIGN_OCTET_SHIFT(ix)                  ((sizeof(CPU_ALIGN) - 1u - (ix)) * DEF_OCTET_NBR_BITS)
+#define  MEM_ALIGN_MERGE(lo, hi, shift_lo, shift_hi)    (((lo) << (shift_lo)) | ((hi) >> (shift_hi)))
+#else
+#define  MEM_ALIGN_OCTET_SHIFT(ix)                  ((ix) * DEF_OCTET_NBR_BITS)
+#define  MEM_ALIGN_MERGE(lo, hi, shift_lo, shift_hi)    (((lo) >> (shift_lo)) | ((hi) << (shift_hi)))
+#endif
+
+                                                                /* ------------- DYN MEM POOL STAT MACROS ------------- */
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+#define  MEM_DYN_POOL_STAT_ADD(p_ctr, val)          (void)__atomic_fetch_add((p_ctr), (val), __ATOMIC_RELAXED)
+#else
+#define  MEM_DYN_POOL_STAT_ADD(p_ctr, val)          do {                            \
+                                                        CPU_SR_ALLOC();             \
+                                                                                    \
+                                                        CPU_CRITICAL_ENTER();       \
+                                                       *(p_ctr) += (val);           \
+                                                        CPU_CRITICAL_EXIT();        \
+                                                    } while (0)
+#endif
+#else
+#define  MEM_DYN_POOL_STAT_ADD(p_ctr, val)
+#endif
+
+                                                                /* ---------- DYN MEM POOL FREE LIST MACROS ----------- */
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)                 /* See 'lib_mem.h  DYNAMIC MEMORY POOL LOCK-FREE ...'.  */
+#define  MEM_DYN_POOL_FREE_PTR(p_pool)                      ((p_pool)->BlkFreeList.BlkPtr)
+
+#if (LIB_MEM_DYN_POOL_DCAS_PORT == DEF_ENABLED)
+#define  MEM_DYN_POOL_FREE_LIST_LOCK_FREE                   DEF_YES
+#define  MEM_DYN_POOL_FREE_LIST_RD(p_list, p_head)  do {                                              \
+                                                        (p_head)->BlkPtr = DEF_NULL;                  \
+                                                        (p_head)->Tag    = 0u;                        \
+                                                        (void)CPU_DCAS((p_list), (p_head), (p_head)); \
+                                                    } while (0)
+#define  MEM_DYN_POOL_FREE_LIST_CAS(p_list, p_cur, p_new)   CPU_DCAS((p_list), (p_cur), (p_new))
+#else
+#define  MEM_DYN_POOL_FREE_LIST_LOCK_FREE                   __atomic_always_lock_free(sizeof(MEM_DYN_POOL_FREE_LIST), 0)
+#define  MEM_DYN_POOL_FREE_LIST_RD(p_list, p_head)          __atomic_load((p_list), (p_head), __ATOMIC_ACQUIRE)
+#define  MEM_DYN_POOL_FREE_LIST_CAS(p_list, p_cur, p_new)   __atomic_compare_exchange((p_list),          \
+                                                                                      (p_cur),           \
+                                                                                      (p_new),           \
+                                                                                       DEF_NO,           \
+                                                                                       __ATOMIC_ACQ_REL, \
+                                                                                       __ATOMIC_ACQUIRE)
+#endif
+#else
+#define  MEM_DYN_POOL_FREE_PTR(p_pool)                      ((p_pool)->BlkFreePtr)
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -97,6 +149,10 @@ MEM_SEG      Mem_SegHeap;                                       /* Heap mem seg.
 
 MEM_SEG     *Mem_SegHeadPtr;                                    /* Ptr to head of seg list.                             */
 
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+MEM_DYN_POOL  *Mem_DynPoolHeadPtr;                              /* Ptr to head of dyn mem pool list.                    */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -141,6 +197,30 @@ static  void          Mem_DynPoolCreateInternal(const  CPU_CHAR      *p_name,
                                                        CPU_SIZE_T     blk_qty_max,
                                                        LIB_ERR       *p_err);
 
+static  CPU_SIZE_T    Mem_DynPoolBlkCntReserve (       MEM_DYN_POOL  *p_pool,
+                                                       CPU_SIZE_T     qty);
+
+static  CPU_BOOLEAN   Mem_DynPoolBlkCntRelease (       MEM_DYN_POOL  *p_pool,
+                                                       CPU_SIZE_T     qty);
+
+static  CPU_SIZE_T    Mem_DynPoolFreeListPop   (       MEM_DYN_POOL  *p_pool,
+                                                       CPU_SIZE_T     qty,
+                                                       void         **pp_blk_head);
+
+static  void          Mem_DynPoolFreeListPush  (       MEM_DYN_POOL  *p_pool,
+                                                       void          *p_blk_head,
+                                                       void          *p_blk_tail);
+
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+static  void         *Mem_DynPoolSegAllocBatch (       MEM_DYN_POOL  *p_pool,
+                                                       CPU_SIZE_T     qty,
+                                                       void          *p_blk_next,
+                                                       LIB_ERR       *p_err);
+
+static  void          Mem_DynPoolCacheDrain    (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                       CPU_SIZE_T           qty);
+#endif
+
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
 static  void          Mem_SegAllocTrackCritical(const  CPU_CHAR      *p_name,
                                                        MEM_SEG       *p_seg,
@@ -198,6 +278,10 @@ void  Mem_Init (void)
                                                                 /* ------------------ INIT SEG LIST ------------------- */
     Mem_SegHeadPtr = DEF_NULL;
 
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    Mem_DynPoolHeadPtr = DEF_NULL;                              /* Init dyn mem pool list.                              */
+#endif
+
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
     {
         LIB_ERR   err;
@@ -285,6 +369,10 @@ void  Mem_Clr (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (4) If LIB_MEM_CFG_OPTIMIZE_SIMD_EN is enabled, buffers of at least LIB_MEM_SIMD_SIZE_MIN
+*                   octets are filled by the port's SIMD kernel, by multiples of LIB_MEM_SIMD_BLK_SIZE
+*                   octets. Remaining octets are filled as described in Note #2.
 *********************************************************************************************************
 */
 
@@ -298,6 +386,9 @@ void  Mem_Set (void        *pmem,
     CPU_INT08U  *pmem_08;
     CPU_DATA     mem_align_mod;
     CPU_DATA     i;
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+    CPU_SIZE_T   size_simd;
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -309,6 +400,15 @@ void  Mem_Set (void        *pmem,
     }
 #endif
 
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+    if (size >= LIB_MEM_SIMD_SIZE_MIN) {                        /* Fill large bufs with SIMD kernel (see Note #4).      */
+        size_simd = size & ~((CPU_SIZE_T)LIB_MEM_SIMD_BLK_SIZE - 1u);
+        Mem_SetSIMD(pmem, data_val, size_simd);
+        pmem      = (CPU_INT08U *)pmem + size_simd;
+        size     -=  size_simd;
+    }
+#endif
+
 
     data_align = 0u;
     for (i = 0u; i < sizeof(CPU_ALIGN); i++) {                  /* Fill each data_align octet with data val.            */
@@ -392,6 +492,20 @@ void  Mem_Set (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) When the memory buffers' alignment offsets differ, the copy is still performed with
+*                   'CPU_ALIGN'-sized words (e.g. network payloads at offsets 14, 34 or 54) :
+*
+*                   (a) Leading octets are copied until the destination buffer is 'CPU_ALIGN'd.
+*
+*                   (b) Each destination word is then merged from the two 'CPU_ALIGN'd source words it
+*                       straddles, shifted according to the source alignment offset & the CPU endianness.
+*                       The first source word is assembled from its octets located within the source
+*                       buffer & no source word located past the end of the source buffer is read.
+*
+*               (6) If LIB_MEM_CFG_OPTIMIZE_SIMD_EN is enabled, buffers of at least LIB_MEM_SIMD_SIZE_MIN
+*                   octets are copied by the port's SIMD kernel, by multiples of LIB_MEM_SIMD_BLK_SIZE
+*                   octets. Remaining octets are copied as described in Notes #3 & #5.
 *********************************************************************************************************
 */
 
@@ -409,7 +523,14 @@ void  Mem_Copy (       void        *pdest,
            CPU_DATA      i;
            CPU_DATA      mem_align_mod_dest;
            CPU_DATA      mem_align_mod_src;
+           CPU_DATA      shift_lo;
+           CPU_DATA      shift_hi;
+           CPU_ALIGN     data_lo;
+           CPU_ALIGN     data_hi;
            CPU_BOOLEAN   mem_aligned;
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+           CPU_SIZE_T    size_simd;
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -434,6 +555,15 @@ void  Mem_Copy (       void        *pdest,
 
 
     if (mem_gap_octets >= sizeof(CPU_ALIGN)) {                  /* Avoid bufs overlap.                                  */
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+        if (size_rem >= LIB_MEM_SIMD_SIZE_MIN) {                /* Copy large bufs with SIMD kernel (see Note #6).      */
+            size_simd     = size_rem & ~((CPU_SIZE_T)LIB_MEM_SIMD_BLK_SIZE - 1u);
+            Mem_CopySIMD(pmem_08_dest, pmem_08_src, size_simd);
+            pmem_08_dest += size_simd;
+            pmem_08_src  += size_simd;
+            size_rem     -= size_simd;
+        }
+#endif
                                                                 /* See Note #4.                                         */
         mem_align_mod_dest = (CPU_INT08U)((CPU_ADDR)pmem_08_dest % sizeof(CPU_ALIGN));
         mem_align_mod_src  = (CPU_INT08U)((CPU_ADDR)pmem_08_src  % sizeof(CPU_ALIGN));
@@ -461,6 +591,39 @@ void  Mem_Copy (       void        *pdest,
 
             pmem_08_dest = (      CPU_INT08U *)pmem_align_dest;
             pmem_08_src  = (const CPU_INT08U *)pmem_align_src;
+
+        } else if (size_rem >= (2u * sizeof(CPU_ALIGN))) {      /* Else if enough octets, shift-merge copy ...          */
+                                                                /* ... (see Note #5).                                   */
+            if (mem_align_mod_dest != 0u) {                     /* Copy leading octets until dest is CPU_ALIGN'd ...    */
+                i = mem_align_mod_dest;                         /* ... (see Note #5a).                                  */
+                while (i < sizeof(CPU_ALIGN)) {
+                   *pmem_08_dest++ = *pmem_08_src++;
+                    size_rem      -=  sizeof(CPU_INT08U);
+                    i++;
+                }
+                mem_align_mod_src = (CPU_INT08U)((CPU_ADDR)pmem_08_src % sizeof(CPU_ALIGN));
+            }
+
+            shift_lo       =  mem_align_mod_src                       * DEF_OCTET_NBR_BITS;
+            shift_hi       = (sizeof(CPU_ALIGN) - mem_align_mod_src) * DEF_OCTET_NBR_BITS;
+
+            data_lo        =  0u;                               /* Assemble first src word (see Note #5b).              */
+            for (i = mem_align_mod_src; i < sizeof(CPU_ALIGN); i++) {
+                data_lo   |= (CPU_ALIGN)pmem_08_src[i - mem_align_mod_src] << MEM_ALIGN_OCTET_SHIFT(i);
+            }
+
+            pmem_align_dest = (      CPU_ALIGN *)pmem_08_dest;
+            pmem_align_src  = (const CPU_ALIGN *)(pmem_08_src - mem_align_mod_src) + 1;
+                                                                /* While next src word within src buf, ...              */
+            while (size_rem >= ((2u * sizeof(CPU_ALIGN)) - mem_align_mod_src)) {
+                data_hi            = *pmem_align_src++;         /* ... merge src words into dest word.                  */
+               *pmem_align_dest++  =  MEM_ALIGN_MERGE(data_lo, data_hi, shift_lo, shift_hi);
+                data_lo            =  data_hi;
+                size_rem          -=  sizeof(CPU_ALIGN);
+            }
+
+            pmem_08_dest = (      CPU_INT08U *)pmem_align_dest;
+            pmem_08_src  = (const CPU_INT08U *)(pmem_align_src - 1) + mem_align_mod_src;
         }
     }
 
@@ -628,6 +791,19 @@ void  Mem_Move (       void        *pdest,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) When the memory buffers' alignment offsets differ, the comparison is still performed
+*                   with 'CPU_ALIGN'-sized words, from the end of the memory buffers :
+*
+*                   (a) Trailing octets are compared until the end of the first buffer is 'CPU_ALIGN'd.
+*
+*                   (b) Each word of the first buffer is then compared to the word merged from the two
+*                       'CPU_ALIGN'd words of the second buffer it straddles. See also 'Mem_Copy()
+*                       Note #5b'.
+*
+*               (6) If LIB_MEM_CFG_OPTIMIZE_SIMD_EN is enabled, buffers of at least LIB_MEM_SIMD_SIZE_MIN
+*                   octets are compared by the port's SIMD kernel, by multiples of LIB_MEM_SIMD_BLK_SIZE
+*                   octets, once the remaining trailing octets are found identical (see Note #2).
 *********************************************************************************************************
 */
 
@@ -643,8 +819,15 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
            CPU_DATA      i;
            CPU_DATA      mem_align_mod_1;
            CPU_DATA      mem_align_mod_2;
+           CPU_DATA      shift_lo;
+           CPU_DATA      shift_hi;
+           CPU_ALIGN     data_lo;
+           CPU_ALIGN     data_hi;
            CPU_BOOLEAN   mem_aligned;
            CPU_BOOLEAN   mem_cmp;
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+           CPU_SIZE_T    size_simd;
+#endif
 
 
     if (size < 1) {                                             /* See Note #1.                                         */
@@ -657,6 +840,19 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
         return (DEF_NO);
     }
 
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)
+    if (size >= LIB_MEM_SIMD_SIZE_MIN) {                        /* Cmp large bufs with SIMD kernel (see Note #6).       */
+        size_simd = size & ~((CPU_SIZE_T)LIB_MEM_SIMD_BLK_SIZE - 1u);
+        mem_cmp   = Mem_Cmp((const CPU_INT08U *)p1_mem + size_simd,
+                            (const CPU_INT08U *)p2_mem + size_simd,
+                             size - size_simd);
+        if (mem_cmp == DEF_YES) {
+            mem_cmp = Mem_CmpSIMD(p1_mem, p2_mem, size_simd);
+        }
+        return (mem_cmp);
+    }
+#endif
+
 
     mem_cmp         =  DEF_YES;                                 /* Assume mem bufs are identical until cmp fails.       */
     size_rem        =  size;
@@ -703,6 +899,49 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
             p1_mem_08 = (CPU_INT08U *)p1_mem_align;
             p2_mem_08 = (CPU_INT08U *)p2_mem_align;
         }
+
+    } else if (size_rem >= (2u * sizeof(CPU_ALIGN))) {          /* Else if enough octets, shift-merge cmp ...           */
+                                                                /* ... (see Note #5).                                   */
+        i = mem_align_mod_1;
+        while ((mem_cmp == DEF_YES) &&                          /* Cmp trailing octets until end of first buf is ...    */
+               (i        > 0)) {                                /* ... CPU_ALIGN'd (see Note #5a).                      */
+            p1_mem_08--;
+            p2_mem_08--;
+            if (*p1_mem_08 != *p2_mem_08) {
+                 mem_cmp = DEF_NO;
+            }
+            size_rem -= sizeof(CPU_INT08U);
+            i--;
+        }
+
+        if (mem_cmp == DEF_YES) {
+            mem_align_mod_2 = (CPU_INT08U)((CPU_ADDR)p2_mem_08 % sizeof(CPU_ALIGN));
+            shift_lo        =  mem_align_mod_2                       * DEF_OCTET_NBR_BITS;
+            shift_hi        = (sizeof(CPU_ALIGN) - mem_align_mod_2) * DEF_OCTET_NBR_BITS;
+
+            data_hi         =  0u;                              /* Assemble last word of second buf.                    */
+            for (i = 0u; i < mem_align_mod_2; i++) {
+                data_hi    |= (CPU_ALIGN)(p2_mem_08 - mem_align_mod_2)[i] << MEM_ALIGN_OCTET_SHIFT(i);
+            }
+
+            p1_mem_align = (CPU_ALIGN *)p1_mem_08;
+            p2_mem_align = (CPU_ALIGN *)(p2_mem_08 - mem_align_mod_2);
+                                                                /* While prev word within second buf, ...               */
+            while ((mem_cmp  == DEF_YES) &&
+                   (size_rem >= (sizeof(CPU_ALIGN) + mem_align_mod_2))) {
+                p1_mem_align--;
+                p2_mem_align--;
+                data_lo = *p2_mem_align;                        /* ... cmp first buf word to merged word (see Note #5b).*/
+                if (*p1_mem_align != MEM_ALIGN_MERGE(data_lo, data_hi, shift_lo, shift_hi)) {
+                     mem_cmp = DEF_NO;
+                }
+                data_hi   = data_lo;
+                size_rem -= sizeof(CPU_ALIGN);
+            }
+
+            p1_mem_08 = (CPU_INT08U *)p1_mem_align;
+            p2_mem_08 = (CPU_INT08U *)p2_mem_align + mem_align_mod_2;
+        }
     }
 
     while ((mem_cmp == DEF_YES) &&                              /* Cmp mem bufs while identical ...                     */
@@ -1971,7 +2210,8 @@ void  Mem_DynPoolCreateHW (const  CPU_CHAR      *p_name,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) The free list is accessed without disabling interrupts when the lock-free free list is
+*                   available (see 'lib_mem.h  DYNAMIC MEMORY POOL LOCK-FREE SUPPORT').
 *********************************************************************************************************
 */
 
@@ -1980,7 +2220,6 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
 {
            void      *p_blk;
     const  CPU_CHAR  *p_pool_name;
-    CPU_SR_ALLOC();
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -1995,31 +2234,18 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
 #endif
 
                                                                 /* Ensure pool is not empty if qty is limited.          */
-    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-        CPU_CRITICAL_ENTER();
-        if (p_pool->BlkAllocCnt >= p_pool->BlkQtyMax) {
-            CPU_CRITICAL_EXIT();
-
-           *p_err = LIB_MEM_ERR_POOL_EMPTY;
-            return (DEF_NULL);
-        }
-
-        p_pool->BlkAllocCnt++;
-        CPU_CRITICAL_EXIT();
+    if (Mem_DynPoolBlkCntReserve(p_pool, 1u) == 0u) {
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+        return (DEF_NULL);
     }
 
                                                                 /* --------------- ALLOC FROM FREE LIST --------------- */
-    CPU_CRITICAL_ENTER();
-    if (p_pool->BlkFreePtr != DEF_NULL) {
-        p_blk              = p_pool->BlkFreePtr;
-        p_pool->BlkFreePtr = *((void **)p_blk);
-        CPU_CRITICAL_EXIT();
-
+    (void)Mem_DynPoolFreeListPop(p_pool, 1u, &p_blk);
+    if (p_blk != DEF_NULL) {
        *p_err = LIB_MEM_ERR_NONE;
 
         return (p_blk);
     }
-    CPU_CRITICAL_EXIT();
 
                                                                 /* ------------------ ALLOC NEW BLK ------------------- */
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
@@ -2035,9 +2261,7 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
                                  DEF_NULL,
                                  p_err);
     if (*p_err != LIB_MEM_ERR_NONE) {
-        if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-            p_pool->BlkAllocCnt--;
-        }
+        (void)Mem_DynPoolBlkCntRelease(p_pool, 1u);
         return (DEF_NULL);
     }
 
@@ -2073,9 +2297,6 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
                           void          *p_blk,
                           LIB_ERR       *p_err)
 {
-    CPU_SR_ALLOC();
-
-
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
         CPU_SW_EXCEPTION(;);
@@ -2092,23 +2313,12 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
     }
 #endif
 
-    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {       /* Ensure pool is not full.                             */
-        CPU_CRITICAL_ENTER();
-        if (p_pool->BlkAllocCnt == 0u) {
-            CPU_CRITICAL_EXIT();
-
-           *p_err = LIB_MEM_ERR_POOL_FULL;
-            return;
-        }
-
-        p_pool->BlkAllocCnt--;
-        CPU_CRITICAL_EXIT();
+    if (Mem_DynPoolBlkCntRelease(p_pool, 1u) != DEF_OK) {       /* Ensure pool is not full.                             */
+       *p_err = LIB_MEM_ERR_POOL_FULL;
+        return;
     }
 
-    CPU_CRITICAL_ENTER();
-   *((void **)p_blk)   = p_pool->BlkFreePtr;
-    p_pool->BlkFreePtr = p_blk;
-    CPU_CRITICAL_EXIT();
+    Mem_DynPoolFreeListPush(p_pool, p_blk, p_blk);
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -2174,157 +2384,500 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 
 /*
 *********************************************************************************************************
-*                                           Mem_OutputUsage()
+*                                        Mem_DynPoolCacheInit()
 *
-* Description : Outputs memory usage report through 'out_fnct'.
+* Description : Initializes a per-task cache in front of a dynamic memory pool.
 *
-* Argument(s) : out_fnct        Pointer to output function.
+* Argument(s) : p_cache         Pointer to cache data. Must be allocated by caller.
 *
-*               print_details   DEF_YES, if the size of each allocation should be printed.
-*                               DEF_NO,  otherwise.
+*               p_pool          Pointer to dynamic memory pool backing the cache.
+*
+*               blk_cnt_max     Maximum number of free blocks kept in the cache. Blocks are moved between
+*                               the cache & the pool by batches of half this quantity (see Note #1).
 *
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
 *                                   LIB_MEM_ERR_NONE                Operation was successful.
-*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
-*
-*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
-*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*                                   LIB_MEM_ERR_NULL_PTR            'p_cache'/'p_pool' pointer passed is NULL.
+*                                   LIB_MEM_ERR_INVALID_BLK_NBR     Invalid maximum number of cached blocks.
 *
 * Return(s)   : None.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) See 'lib_mem.h  DYNAMIC MEMORY POOL CACHE DATA TYPE'.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
-                      LIB_ERR   *p_err)
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+void  Mem_DynPoolCacheInit (MEM_DYN_POOL_CACHE  *p_cache,
+                            MEM_DYN_POOL        *p_pool,
+                            CPU_SIZE_T           blk_cnt_max,
+                            LIB_ERR             *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
-    MEM_SEG   *p_seg;
-    CPU_SR_ALLOC();
-
-
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
         CPU_SW_EXCEPTION(;);
     }
 
-    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+    if ((p_cache == DEF_NULL) ||                                /* Chk for NULL cache/pool data ptr.                    */
+        (p_pool  == DEF_NULL)) {
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
+
+    if (blk_cnt_max < 1u) {                                     /* Chk for inv blk cnt.                                 */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;
+        return;
+    }
 #endif
 
-    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
-    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
-    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
+    p_cache->PoolPtr    =  p_pool;
+    p_cache->BlkFreePtr =  DEF_NULL;
+    p_cache->BlkCnt     =  0u;
+    p_cache->BlkCntMax  =  blk_cnt_max;
+    p_cache->RefillQty  = (blk_cnt_max + 1u) / 2u;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_cache->StatHitCtr =  0u;
+#endif
 
-    CPU_CRITICAL_ENTER();
-    p_seg = Mem_SegHeadPtr;
-    while (p_seg != DEF_NULL) {
-        CPU_SIZE_T       rem_size;
-        MEM_SEG_INFO     seg_info;
-        MEM_ALLOC_INFO  *p_alloc;
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
 
 
-        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
-        if (*p_err != LIB_MEM_ERR_NONE) {
-            return;
-        }
+/*
+*********************************************************************************************************
+*                                       Mem_DynPoolCacheBlkGet()
+*
+* Description : Gets a memory block from a dynamic memory pool cache, refilling the cache from the pool if
+*               it is empty.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                    Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR                Cache data pointer NULL.
+*                               LIB_MEM_ERR_POOL_EMPTY              Pool is empty.
+*
+*                               -------------------RETURNED BY Mem_DynPoolSegAllocBatch()-------------------
+*                               LIB_MEM_ERR_INVALID_MEM_ALIGN       Invalid memory block alignment requested.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE        Invalid memory block size specified.
+*                               LIB_MEM_ERR_SEG_OVF                 Allocation would overflow memory segment.
+*                               LIB_MEM_ERR_ADDR_OVF                Memory allocation exceeds address space.
+*
+* Return(s)   : Pointer to memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The cache is refilled with up to 'RefillQty' blocks at once. Blocks are first taken from
+*                   the pool's free list; the remaining ones are carved from the pool's segment in a single
+*                   allocation.
+*
+*               (2) If the segment cannot provide the remaining blocks, the blocks already taken from the
+*                   free list are still used to serve the request.
+*********************************************************************************************************
+*/
 
-        out_fnct((CPU_CHAR *)"| Section | ");
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+void  *Mem_DynPoolCacheBlkGet (MEM_DYN_POOL_CACHE  *p_cache,
+                               LIB_ERR             *p_err)
+{
+    MEM_DYN_POOL  *p_pool;
+    void          *p_blk;
+    void          *p_blk_seg;
+    CPU_SIZE_T     qty_reqd;
+    CPU_SIZE_T     qty_got;
 
-        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
 
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
 
-        (void)Str_FmtNbr_Int32U(rem_size,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
 
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
-        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
-        out_fnct((CPU_CHAR *)"\r\n");
+                                                                /* ------------------ ALLOC FROM CACHE ---------------- */
+    p_blk = p_cache->BlkFreePtr;
+    if (p_blk != DEF_NULL) {
+        p_cache->BlkFreePtr = *((void **)p_blk);
+        p_cache->BlkCnt--;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+        p_cache->StatHitCtr++;
+#endif
 
-        p_alloc = p_seg->AllocInfoHeadPtr;
-        while (p_alloc != DEF_NULL) {
-            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+       *p_err = LIB_MEM_ERR_NONE;
 
-            (void)Str_FmtNbr_Int32U(p_alloc->Size,
-                                    10u,
-                                    DEF_NBR_BASE_DEC,
-                                    ' ',
-                                    DEF_NO,
-                                    DEF_YES,
-                                   &str[0u]);
+        return (p_blk);
+    }
 
-            out_fnct(str);
-            out_fnct((CPU_CHAR *)" |            | ");
+                                                                /* ------------------- REFILL CACHE ------------------- */
+    p_pool = p_cache->PoolPtr;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    MEM_DYN_POOL_STAT_ADD(&p_pool->StatCacheHitCtr, p_cache->StatHitCtr);
+    MEM_DYN_POOL_STAT_ADD(&p_pool->StatCacheMissCtr, 1u);
+    p_cache->StatHitCtr = 0u;
+#endif
 
-            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
-            out_fnct((CPU_CHAR *)"\r\n");
+    qty_reqd = Mem_DynPoolBlkCntReserve(p_pool, p_cache->RefillQty);
+    if (qty_reqd == 0u) {
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+        return (DEF_NULL);
+    }
 
-            p_alloc = p_alloc->NextPtr;
+    qty_got = Mem_DynPoolFreeListPop(p_pool, qty_reqd, &p_blk);
+    if (qty_got < qty_reqd) {                                   /* Carve missing blks from seg (see Note #1).           */
+        p_blk_seg = Mem_DynPoolSegAllocBatch(p_pool,
+                                             qty_reqd - qty_got,
+                                             p_blk,
+                                             p_err);
+        if (*p_err == LIB_MEM_ERR_NONE) {
+            p_blk   = p_blk_seg;
+            qty_got = qty_reqd;
+        } else {                                                /* Release unused reservation (see Note #2).            */
+            (void)Mem_DynPoolBlkCntRelease(p_pool, qty_reqd - qty_got);
+            if (qty_got == 0u) {
+                return (DEF_NULL);
+            }
         }
-
-        p_seg = p_seg->NextPtr;
     }
-    CPU_CRITICAL_EXIT();
+
+    p_cache->BlkFreePtr = *((void **)p_blk);                    /* Keep all but first blk in cache.                     */
+    p_cache->BlkCnt     =  qty_got - 1u;
 
    *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                       Mem_SegCreateCritical()
-*
-* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*                                       Mem_DynPoolCacheBlkFree()
 *
-* Argument(s) : p_name          Pointer to segment name.
+* Description : Frees memory block to a dynamic memory pool cache, draining part of the cache to the pool if
+*               it is full.
 *
-*               p_seg           Pointer to segment data. Must be allocated by caller.
-*               -----           Argument validated by caller.
+* Argument(s) : p_cache     Pointer to cache data.
 *
-*               seg_base_addr   Segment's first byte address.
+*               p_blk       Pointer to first byte of memory block.
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
-*                               from this memory segment. MUST be a power of 2.
-*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
-*               -------------   Argument validated by caller.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*               size            Total size of segment, in bytes.
-*               ----            Argument validated by caller.
+*                               LIB_MEM_ERR_NONE        Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR    'p_cache' or 'p_blk' pointer passed is NULL.
 *
-* Return(s)   : Pointer to segment data, if successful.
+* Return(s)   : none.
 *
-*               DEF_NULL, otherwise.
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The memory block MUST have been obtained from the pool backing the cache, either directly
+*                   or through any cache of that pool.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+void  Mem_DynPoolCacheBlkFree (MEM_DYN_POOL_CACHE  *p_cache,
+                               void                *p_blk,
+                               LIB_ERR             *p_err)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_cache == DEF_NULL) ||                                /* Chk for NULL cache data ptr.                         */
+        (p_blk   == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+   *((void **)p_blk)    = p_cache->BlkFreePtr;                  /* Insert blk in cache.                                 */
+    p_cache->BlkFreePtr = p_blk;
+    p_cache->BlkCnt++;
+
+    if (p_cache->BlkCnt > p_cache->BlkCntMax) {                 /* Drain cache to pool if full.                         */
+        Mem_DynPoolCacheDrain(p_cache, p_cache->RefillQty);
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolCacheFlush()
+*
+* Description : Returns all blocks held by a dynamic memory pool cache to its pool.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE        Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR    'p_cache' pointer passed is NULL.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+void  Mem_DynPoolCacheFlush (MEM_DYN_POOL_CACHE  *p_cache,
+                             LIB_ERR             *p_err)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (p_cache->BlkCnt > 0u) {
+        Mem_DynPoolCacheDrain(p_cache, p_cache->BlkCnt);
+    }
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    MEM_DYN_POOL_STAT_ADD(&p_cache->PoolPtr->StatCacheHitCtr, p_cache->StatHitCtr);
+    p_cache->StatHitCtr = 0u;
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_OutputUsage()
+*
+* Description : Outputs memory usage report through 'out_fnct'.
+*
+* Argument(s) : out_fnct        Pointer to output function.
+*
+*               print_details   DEF_YES, if the size of each allocation should be printed.
+*                               DEF_NO,  otherwise.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The report also lists every dynamic memory pool with its contention & cache statistics
+*                   (see 'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #4').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
+                      LIB_ERR   *p_err)
+{
+    CPU_CHAR       str[DEF_INT_32U_NBR_DIG_MAX];
+    MEM_SEG       *p_seg;
+    MEM_DYN_POOL  *p_pool;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
+    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
+    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_seg = Mem_SegHeadPtr;
+    while (p_seg != DEF_NULL) {
+        CPU_SIZE_T       rem_size;
+        MEM_SEG_INFO     seg_info;
+        MEM_ALLOC_INFO  *p_alloc;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct((CPU_CHAR *)"| Section | ");
+
+        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(rem_size,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        p_alloc = p_seg->AllocInfoHeadPtr;
+        while (p_alloc != DEF_NULL) {
+            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+
+            (void)Str_FmtNbr_Int32U(p_alloc->Size,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" |            | ");
+
+            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct((CPU_CHAR *)"\r\n");
+
+            p_alloc = p_alloc->NextPtr;
+        }
+
+        p_seg = p_seg->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+    out_fnct((CPU_CHAR *)"------------------ Dynamic pool info ------------------\r\n");
+    out_fnct((CPU_CHAR *)"| Blk size   | Contention | Cache hit  | Cache miss | Name\r\n");
+    out_fnct((CPU_CHAR *)"|------------|------------|------------|------------|-------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_pool = Mem_DynPoolHeadPtr;
+    while (p_pool != DEF_NULL) {
+        out_fnct((CPU_CHAR *)"| ");
+
+        (void)Str_FmtNbr_Int32U(p_pool->BlkSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(p_pool->StatContentionCtr,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(p_pool->StatCacheHitCtr,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(p_pool->StatCacheMissCtr,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_pool->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_pool->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        p_pool = p_pool->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegCreateCritical()
+*
+* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*
+* Argument(s) : p_name          Pointer to segment name.
+*
+*               p_seg           Pointer to segment data. Must be allocated by caller.
+*               -----           Argument validated by caller.
+*
+*               seg_base_addr   Segment's first byte address.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
+*                               from this memory segment. MUST be a power of 2.
+*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
+*               -------------   Argument validated by caller.
+*
+*               size            Total size of segment, in bytes.
+*               ----            Argument validated by caller.
+*
+* Return(s)   : Pointer to segment data, if successful.
+*
+*               DEF_NULL, otherwise.
 *
 * Caller(s)   : Mem_PoolCreate(),
 *               Mem_SegCreate().
@@ -2728,6 +3281,7 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
                                                 LIB_ERR       *p_err)
 {
     CPU_INT08U  *p_blks          = DEF_NULL;
+    void        *p_blk_free      = DEF_NULL;
     CPU_SIZE_T   seg_size;
     CPU_SIZE_T   blk_size_align;
     CPU_SIZE_T   blk_align_worst = DEF_MAX(blk_align, blk_padding_align);
@@ -2791,16 +3345,21 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
 
                                                                 /* ----------------- CREATE POOL DATA ----------------- */
                                                                 /* Init free list.                                      */
-        p_pool->BlkFreePtr = (void *)p_blks;
+        p_blk_free = (void *)p_blks;
         for (i = 0u; i < blk_qty_init - 1u; i++) {
            *((void **)p_blks)  = p_blks + blk_size_align;
             p_blks            += blk_size_align;
         }
        *((void **)p_blks) = DEF_NULL;
-    } else {
-        p_pool->BlkFreePtr = DEF_NULL;
     }
 
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    p_pool->BlkFreeList.BlkPtr = p_blk_free;
+    p_pool->BlkFreeList.Tag    = 0u;
+#else
+    p_pool->BlkFreePtr         = p_blk_free;
+#endif
+
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
     p_pool->PoolSegPtr      = ((p_seg != DEF_NULL) ? p_seg : &Mem_SegHeap);
 #else
@@ -2813,13 +3372,461 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     p_pool->BlkAllocCnt     =   0u;
 
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_pool->NamePtr = p_name;
+    p_pool->NamePtr           = p_name;
+    p_pool->StatContentionCtr = 0u;
+    p_pool->StatCacheHitCtr   = 0u;
+    p_pool->StatCacheMissCtr  = 0u;
+
+    {
+        CPU_SR_ALLOC();
+
+
+        CPU_CRITICAL_ENTER();                                   /* Add pool to dyn mem pool list.                       */
+        p_pool->NextPtr    = Mem_DynPoolHeadPtr;
+        Mem_DynPoolHeadPtr = p_pool;
+        CPU_CRITICAL_EXIT();
+    }
 #endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
 
 
+/*
+*********************************************************************************************************
+*                                      Mem_DynPoolBlkCntReserve()
+*
+* Description : Reserves blocks in a dynamic memory pool's allocated block count.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*               ------      Argument validated by caller.
+*
+*               qty         Number of blocks to reserve.
+*
+* Return(s)   : Number of blocks reserved, lower than 'qty' if the pool does not have enough blocks left.
+*
+* Caller(s)   : Mem_DynPoolBlkGet(),
+*               Mem_DynPoolCacheBlkGet().
+*
+* Note(s)     : (1) The allocated block count is only maintained for pools with a limited quantity of blocks.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Mem_DynPoolBlkCntReserve (MEM_DYN_POOL  *p_pool,
+                                              CPU_SIZE_T     qty)
+{
+    CPU_SIZE_T   cnt;
+    CPU_SIZE_T   qty_avail;
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    CPU_SIZE_T   qty_reserved;
+    CPU_BOOLEAN  done;
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+    if (p_pool->BlkQtyMax == LIB_MEM_BLK_QTY_UNLIMITED) {       /* See Note #1.                                         */
+        return (qty);
+    }
+
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    cnt = __atomic_load_n(&p_pool->BlkAllocCnt, __ATOMIC_RELAXED);
+    do {
+        if (cnt >= p_pool->BlkQtyMax) {
+            return (0u);
+        }
+        qty_avail    = p_pool->BlkQtyMax - cnt;
+        qty_reserved = DEF_MIN(qty, qty_avail);
+        done         = __atomic_compare_exchange_n(&p_pool->BlkAllocCnt,
+                                                   &cnt,
+                                                    cnt + qty_reserved,
+                                                    DEF_NO,
+                                                    __ATOMIC_RELAXED,
+                                                    __ATOMIC_RELAXED);
+        if (done == DEF_NO) {
+            MEM_DYN_POOL_STAT_ADD(&p_pool->StatContentionCtr, 1u);
+        }
+    } while (done == DEF_NO);
+
+    return (qty_reserved);
+#else
+    CPU_CRITICAL_ENTER();
+    cnt = p_pool->BlkAllocCnt;
+    if (cnt >= p_pool->BlkQtyMax) {
+        CPU_CRITICAL_EXIT();
+        return (0u);
+    }
+    qty_avail           = p_pool->BlkQtyMax - cnt;
+    qty                 = DEF_MIN(qty, qty_avail);
+    p_pool->BlkAllocCnt = cnt + qty;
+    CPU_CRITICAL_EXIT();
+
+    return (qty);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_DynPoolBlkCntRelease()
+*
+* Description : Releases blocks from a dynamic memory pool's allocated block count.
+*
+* Argument(s) : p_pool      Pointer to pool data.
+*               ------      Argument validated by caller.
+*
+*               qty         Number of blocks to release.
+*
+* Return(s)   : DEF_OK,   if blocks successfully released.
+*
+*               DEF_FAIL, if the pool does not have that many blocks allocated.
+*
+* Caller(s)   : Mem_DynPoolBlkFree(),
+*               Mem_DynPoolBlkGet(),
+*               Mem_DynPoolCacheBlkGet(),
+*               Mem_DynPoolCacheDrain().
+*
+* Note(s)     : (1) See 'Mem_DynPoolBlkCntReserve()  Note #1'.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  Mem_DynPoolBlkCntRelease (MEM_DYN_POOL  *p_pool,
+                                               CPU_SIZE_T     qty)
+{
+    CPU_SIZE_T   cnt;
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    CPU_BOOLEAN  done;
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+    if (p_pool->BlkQtyMax == LIB_MEM_BLK_QTY_UNLIMITED) {       /* See Note #1.                                         */
+        return (DEF_OK);
+    }
+
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    cnt = __atomic_load_n(&p_pool->BlkAllocCnt, __ATOMIC_RELAXED);
+    do {
+        if (cnt < qty) {
+            return (DEF_FAIL);
+        }
+        done = __atomic_compare_exchange_n(&p_pool->BlkAllocCnt,
+                                           &cnt,
+                                            cnt - qty,
+                                            DEF_NO,
+                                            __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED);
+        if (done == DEF_NO) {
+            MEM_DYN_POOL_STAT_ADD(&p_pool->StatContentionCtr, 1u);
+        }
+    } while (done == DEF_NO);
+#else
+    CPU_CRITICAL_ENTER();
+    cnt = p_pool->BlkAllocCnt;
+    if (cnt < qty) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_FAIL);
+    }
+    p_pool->BlkAllocCnt = cnt - qty;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_DynPoolFreeListPop()
+*
+* Description : Removes up to 'qty' blocks from a dynamic memory pool's free list.
+*
+* Argument(s) : p_pool          Pointer to pool data.
+*               ------          Argument validated by caller.
+*
+*               qty             Maximum number of blocks to remove.
+*
+*               pp_blk_head     Pointer to variable that will receive the pointer to the first removed block,
+*                               or DEF_NULL if the free list is empty. Removed blocks are linked together
+*                               & the last one is linked to DEF_NULL.
+*
+* Return(s)   : Number of blocks removed.
+*
+* Caller(s)   : Mem_DynPoolBlkGet(),
+*               Mem_DynPoolCacheBlkGet().
+*
+* Note(s)     : (1) The lock-free free list is used only if its double-word compare-and-swap is lock-free (see
+*                   'lib_mem.h  DYNAMIC MEMORY POOL LOCK-FREE SUPPORT  Note #2'). '__atomic_always_lock_free()'
+*                   is a compile-time constant, so the unused path is discarded by the compiler.
+*
+*                   (a) The generation tag is incremented on every removal so that the compare-and-swap
+*                       fails if the head was removed & re-inserted in the meantime.
+*
+*                   (b) Reading the next pointer of a block that was just removed by another context is safe
+*                       since pool memory is never returned to its segment; the stale value is discarded when
+*                       the compare-and-swap fails.
+*
+*               (2) Otherwise, the blocks are unlinked within a single critical section.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Mem_DynPoolFreeListPop (MEM_DYN_POOL   *p_pool,
+                                            CPU_SIZE_T      qty,
+                                            void          **pp_blk_head)
+{
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    MEM_DYN_POOL_FREE_LIST   head_cur;
+    MEM_DYN_POOL_FREE_LIST   head_new;
+    CPU_BOOLEAN              done;
+#endif
+    void                    *p_blk_head;
+    void                    *p_blk_tail;
+    CPU_SIZE_T               nbr;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    if (MEM_DYN_POOL_FREE_LIST_LOCK_FREE != DEF_NO) {           /* See Note #1.                                         */
+        p_blk_head = DEF_NULL;
+        nbr        = 0u;
+
+        MEM_DYN_POOL_FREE_LIST_RD(&p_pool->BlkFreeList, &head_cur);
+        while ((nbr             <  qty) &&
+               (head_cur.BlkPtr != DEF_NULL)) {
+            head_new.BlkPtr = *((void **)head_cur.BlkPtr);      /* See Note #1b.                                        */
+            head_new.Tag    =   head_cur.Tag + 1u;
+
+            done = MEM_DYN_POOL_FREE_LIST_CAS(&p_pool->BlkFreeList, &head_cur, &head_new);
+            if (done != DEF_NO) {                               /* Link removed blk in caller's list.                   */
+               *((void **)head_cur.BlkPtr) = p_blk_head;
+                p_blk_head                 = head_cur.BlkPtr;
+                nbr++;
+
+                head_cur = head_new;
+            } else {                                            /* 'head_cur' updated by failed compare-and-swap.       */
+                MEM_DYN_POOL_STAT_ADD(&p_pool->StatContentionCtr, 1u);
+            }
+        }
+
+       *pp_blk_head = p_blk_head;
+
+        return (nbr);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    p_blk_head = MEM_DYN_POOL_FREE_PTR(p_pool);
+    if (p_blk_head == DEF_NULL) {
+        CPU_CRITICAL_EXIT();
+
+       *pp_blk_head = DEF_NULL;
+        return (0u);
+    }
+
+    p_blk_tail = p_blk_head;
+    nbr        = 1u;
+    while ((nbr                 <  qty) &&
+           (*((void **)p_blk_tail) != DEF_NULL)) {
+        p_blk_tail = *((void **)p_blk_tail);
+        nbr++;
+    }
+
+    MEM_DYN_POOL_FREE_PTR(p_pool) = *((void **)p_blk_tail);
+   *((void **)p_blk_tail)         =   DEF_NULL;
+    CPU_CRITICAL_EXIT();
+
+   *pp_blk_head = p_blk_head;
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_DynPoolFreeListPush()
+*
+* Description : Inserts a list of blocks at the head of a dynamic memory pool's free list.
+*
+* Argument(s) : p_pool          Pointer to pool data.
+*               ------          Argument validated by caller.
+*
+*               p_blk_head      Pointer to first block of the list to insert.
+*               ----------      Argument validated by caller.
+*
+*               p_blk_tail      Pointer to last  block of the list to insert. Blocks from 'p_blk_head' to
+*               ----------      'p_blk_tail' MUST already be linked together. Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolBlkFree(),
+*               Mem_DynPoolCacheDrain().
+*
+* Note(s)     : (1) Insertion is not subject to the ABA problem; the generation tag is left unchanged.
+*********************************************************************************************************
+*/
+
+static  void  Mem_DynPoolFreeListPush (MEM_DYN_POOL  *p_pool,
+                                       void          *p_blk_head,
+                                       void          *p_blk_tail)
+{
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    MEM_DYN_POOL_FREE_LIST  head_cur;
+    MEM_DYN_POOL_FREE_LIST  head_new;
+    CPU_BOOLEAN             done;
+#endif
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+    if (MEM_DYN_POOL_FREE_LIST_LOCK_FREE != DEF_NO) {           /* See 'Mem_DynPoolFreeListPop()  Note #1'.             */
+        MEM_DYN_POOL_FREE_LIST_RD(&p_pool->BlkFreeList, &head_cur);
+        do {
+           *((void **)p_blk_tail) = head_cur.BlkPtr;
+            head_new.BlkPtr       = p_blk_head;
+            head_new.Tag          = head_cur.Tag;               /* See Note #1.                                         */
+
+            done = MEM_DYN_POOL_FREE_LIST_CAS(&p_pool->BlkFreeList, &head_cur, &head_new);
+            if (done == DEF_NO) {
+                MEM_DYN_POOL_STAT_ADD(&p_pool->StatContentionCtr, 1u);
+            }
+        } while (done == DEF_NO);
+
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+   *((void **)p_blk_tail)         = MEM_DYN_POOL_FREE_PTR(p_pool);
+    MEM_DYN_POOL_FREE_PTR(p_pool) = p_blk_head;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_DynPoolSegAllocBatch()
+*
+* Description : Carves several blocks of a dynamic memory pool from its segment in a single allocation.
+*
+* Argument(s) : p_pool          Pointer to pool data.
+*               ------          Argument validated by caller.
+*
+*               qty             Number of blocks to allocate. MUST be greater than 0.
+*
+*               p_blk_next      Pointer to block to which the last allocated block will be linked.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_ADDR_OVF            Memory allocation exceeds address space.
+*
+*                                   ------------------RETURNED BY Mem_SegAllocInternal()-------------------
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to first allocated block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_DynPoolCacheBlkGet().
+*
+* Note(s)     : (1) Blocks are laid out the same way as the initial blocks allocated by
+*                   Mem_DynPoolCreateInternal().
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+static  void  *Mem_DynPoolSegAllocBatch (MEM_DYN_POOL  *p_pool,
+                                         CPU_SIZE_T     qty,
+                                         void          *p_blk_next,
+                                         LIB_ERR       *p_err)
+{
+           CPU_INT08U  *p_blks;
+           CPU_SIZE_T   blk_size_align;
+           CPU_SIZE_T   i;
+    const  CPU_CHAR    *p_pool_name;
+
+
+    blk_size_align = MATH_ROUND_INC_UP_PWR2(DEF_MAX(p_pool->BlkSize, sizeof(void *)), p_pool->BlkAlign);
+    if (blk_size_align > (DEF_INT_CPU_U_MAX_VAL / qty)) {       /* Detect integer overflow in the size calculation.     */
+       *p_err = LIB_MEM_ERR_ADDR_OVF;
+        return (DEF_NULL);
+    }
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_pool_name = p_pool->NamePtr;
+#else
+    p_pool_name = DEF_NULL;
+#endif
+    p_blks = (CPU_INT08U *)Mem_SegAllocInternal(p_pool_name,
+                                                p_pool->PoolSegPtr,
+                                                blk_size_align * qty,
+                                                DEF_MAX(p_pool->BlkAlign, sizeof(void *)),
+                                                LIB_MEM_PADDING_ALIGN_NONE,
+                                                DEF_NULL,
+                                                p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+    for (i = 0u; i < qty - 1u; i++) {                           /* Link blks together.                                  */
+       *((void **)(p_blks + (i * blk_size_align))) = p_blks + ((i + 1u) * blk_size_align);
+    }
+   *((void **)(p_blks + (i * blk_size_align))) = p_blk_next;
+
+    return ((void *)p_blks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_DynPoolCacheDrain()
+*
+* Description : Returns blocks from a dynamic memory pool cache to its pool.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*               -------     Argument validated by caller.
+*
+*               qty         Number of blocks to return. MUST be greater than 0 & lower than or equal to the
+*                           number of cached blocks.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolCacheBlkFree(),
+*               Mem_DynPoolCacheFlush().
+*
+* Note(s)     : (1) The blocks are inserted in the pool's free list with a single operation.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+static  void  Mem_DynPoolCacheDrain (MEM_DYN_POOL_CACHE  *p_cache,
+                                     CPU_SIZE_T           qty)
+{
+    void        *p_blk_head;
+    void        *p_blk_tail;
+    CPU_SIZE_T   i;
+
+
+    p_blk_head = p_cache->BlkFreePtr;
+    p_blk_tail = p_blk_head;
+    for (i = 1u; i < qty; i++) {
+        p_blk_tail = *((void **)p_blk_tail);
+    }
+
+    p_cache->BlkFreePtr  = *((void **)p_blk_tail);
+    p_cache->BlkCnt     -=   qty;
+
+    Mem_DynPoolFreeListPush(p_cache->PoolPtr, p_blk_head, p_blk_tail);
+    (void)Mem_DynPoolBlkCntRelease(p_cache->PoolPtr, qty);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      Mem_PoolBlkIsValidAddr()
@@ -124,6 +124,10 @@
 
 #define  LIB_MEM_BLK_QTY_UNLIMITED                        0u
 
+                                                                /* ---------------- SIMD KERNEL DEFINES --------------- */
+#define  LIB_MEM_SIMD_BLK_SIZE                           16u    /* Size multiple handled by SIMD kernels (in octets).   */
+#define  LIB_MEM_SIMD_SIZE_MIN                           64u    /* Min size for which SIMD kernels are used.            */
+
 
 /*
 *********************************************************************************************************
@@ -171,6 +175,25 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                           MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_OPTIMIZE_SIMD_EN to enable/disable the SIMD-optimized memory kernels
+*               used by Mem_Set(), Mem_Copy() & Mem_Cmp() for large buffers.
+*
+*               (a) The kernels are implemented in '\<Custom Library Directory>\Ports\<cpu>\<compiler>\
+*                   lib_mem_simd.c', which MUST be added to the build when enabled.
+*
+*               (b) Mem_Copy() uses the SIMD kernel ONLY if LIB_MEM_CFG_OPTIMIZE_ASM_EN is DISABLED.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_OPTIMIZE_SIMD_EN
+#define  LIB_MEM_CFG_OPTIMIZE_SIMD_EN   DEF_DISABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                          MEMORY ALLOCATION DEBUG INFORMATION CONFIGURATION
@@ -199,6 +222,72 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  DYNAMIC MEMORY POOL CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN to enable/disable the lock-free dynamic memory
+*               pool free list.
+*
+*               (a) The lock-free free list requires a double-word compare-and-swap (see 'DYNAMIC MEMORY
+*                   POOL LOCK-FREE SUPPORT  Note #2'). If the port/compiler does NOT provide one, dynamic
+*                   memory pools silently fall back to critical sections.
+*
+*           (2) Configure LIB_MEM_CFG_DYN_POOL_CACHE_EN to enable/disable the per-task dynamic memory pool
+*               block caches (see 'DYNAMIC MEMORY POOL CACHE DATA TYPE').
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN
+#define  LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN  DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_DYN_POOL_CACHE_EN
+#define  LIB_MEM_CFG_DYN_POOL_CACHE_EN      DEF_DISABLED
+#endif
+
+
+/*
+*********************************************************************************************************
+*                              DYNAMIC MEMORY POOL LOCK-FREE SUPPORT
+*
+* Note(s) : (1) The lock-free free list pairs the head pointer with a generation tag that is incremented on
+*               every removal, so that a block freed & re-inserted between the read & the swap of the head
+*               (ABA problem) is detected. Both words MUST be swapped atomically, WITHOUT any lock.
+*
+*           (2) The double-word compare-and-swap is provided by :
+*
+*               (a) The port, if CPU_CFG_DCAS_PRESENT is #define'd in 'cpu.h'/'cpu_cfg.h' (see 'cpu_core.h
+*                   CPU_DCAS()'). This is REQUIRED on 64-bit address CPUs (e.g. ARMv8 CASP/LDXP/STXP, x86-64
+*                   CMPXCHG16B) : the GNU-compatible compilers implement the 16-octet '__atomic' built-ins
+*                   through libatomic calls that are NOT guaranteed to be lock-free.
+*
+*               (b) The compiler's '__atomic' built-ins on 32-bit address CPUs that advertise an inline
+*                   64-bit compare-and-swap through '__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8' (e.g. ARMv7
+*                   LDREXD/STREXD). As '__atomic_always_lock_free()' is NOT usable by the preprocessor, it
+*                   is checked by the free list functions (see 'lib_mem.c  Mem_DynPoolFreeListPop()  Note #1').
+*
+*               Otherwise, the free list falls back to critical sections.
+*********************************************************************************************************
+*/
+
+#if    ((LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED) && \
+        (defined(__GNUC__))                                && \
+        (defined(CPU_CFG_DCAS_PRESENT)))
+#define  LIB_MEM_DYN_POOL_LOCK_FREE         DEF_ENABLED         /* See Note #2a.                                        */
+#define  LIB_MEM_DYN_POOL_DCAS_PORT         DEF_ENABLED
+#elif  ((LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN == DEF_ENABLED) && \
+        (defined(__GNUC__))                                && \
+        (CPU_CFG_ADDR_SIZE == CPU_WORD_SIZE_32)            && \
+        (defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)))
+#define  LIB_MEM_DYN_POOL_LOCK_FREE         DEF_ENABLED         /* See Note #2b.                                        */
+#define  LIB_MEM_DYN_POOL_DCAS_PORT         DEF_DISABLED
+#else
+#define  LIB_MEM_DYN_POOL_LOCK_FREE         DEF_DISABLED
+#define  LIB_MEM_DYN_POOL_DCAS_PORT         DEF_DISABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -339,23 +428,86 @@ typedef  struct  mem_pool {
 *                    |          |      |          |       |          |   |          |
 *                    \----------/      \----------/       \----------/   \----------/
 *
+*           (3) When the lock-free free list is used, the head pointer is held in 'BlkFreeList' along with
+*               its generation tag (see 'DYNAMIC MEMORY POOL LOCK-FREE SUPPORT  Note #1').
+*
+*           (4) Statistics counters are only maintained when LIB_MEM_CFG_DBG_INFO_EN is enabled & are
+*               reported through Mem_OutputUsage() :
+*
+*               (a) 'StatContentionCtr' counts the free list updates that had to be retried because
+*                    another context modified the list concurrently (lock-free free list only).
+*
+*               (b) 'StatCacheHitCtr' & 'StatCacheMissCtr' count the block requests served by a pool
+*                    cache without/with accessing the pool's free list (see 'DYNAMIC MEMORY POOL CACHE
+*                    DATA TYPE').
 *********************************************************************************************************
 */
 
-typedef  struct  mem_dyn_pool {                                 /* ---------------- DYN MEM POOL DATA ----------------- */
-           MEM_SEG     *PoolSegPtr;                             /* Mem pool from which blks are alloc'd.                */
-           CPU_SIZE_T   BlkSize;                                /* Size of pool blks, in octets.                        */
-           CPU_SIZE_T   BlkAlign;                               /* Align req'd for blks, in octets.                     */
-           CPU_SIZE_T   BlkPaddingAlign;                        /* Padding alignment in bytes for this mem seg.         */
-           void        *BlkFreePtr;                             /* Ptr to first free blk.                               */
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+typedef  struct  mem_dyn_pool_free_list {                       /* ------------ DYN MEM POOL FREE LIST HEAD ----------- */
+    void      *BlkPtr;                                          /* Ptr to first free blk.                               */
+    CPU_ADDR   Tag;                                             /* Generation tag (see Note #3).                        */
+} __attribute__((aligned(2u * sizeof(CPU_ADDR)))) MEM_DYN_POOL_FREE_LIST;
+#endif
 
-           CPU_SIZE_T   BlkQtyMax;                              /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
-           CPU_SIZE_T   BlkAllocCnt;                            /* Cnt of alloc blk.                                    */
 
+typedef  struct  mem_dyn_pool  MEM_DYN_POOL;
+
+struct  mem_dyn_pool {                                          /* ---------------- DYN MEM POOL DATA ----------------- */
+           MEM_SEG                 *PoolSegPtr;                 /* Mem pool from which blks are alloc'd.                */
+           CPU_SIZE_T               BlkSize;                    /* Size of pool blks, in octets.                        */
+           CPU_SIZE_T               BlkAlign;                   /* Align req'd for blks, in octets.                     */
+           CPU_SIZE_T               BlkPaddingAlign;            /* Padding alignment in bytes for this mem seg.         */
+#if (LIB_MEM_DYN_POOL_LOCK_FREE == DEF_ENABLED)
+           MEM_DYN_POOL_FREE_LIST   BlkFreeList;                /* Free list head & tag (see Note #3).                  */
+#else
+           void                    *BlkFreePtr;                 /* Ptr to first free blk.                               */
+#endif
+
+           CPU_SIZE_T               BlkQtyMax;                  /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
+           CPU_SIZE_T               BlkAllocCnt;                /* Cnt of alloc blk.                                    */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR                *NamePtr;                    /* Ptr to mem pool name.                                */
+           MEM_DYN_POOL            *NextPtr;                    /* Ptr to next dyn mem pool.                            */
+
+           CPU_INT32U               StatContentionCtr;          /* Nbr of contended free list updates (see Note #4a).   */
+           CPU_INT32U               StatCacheHitCtr;            /* Nbr of cache hits   (see Note #4b).                  */
+           CPU_INT32U               StatCacheMissCtr;           /* Nbr of cache misses (see Note #4b).                  */
+#endif
+};
+
+
+/*
+*********************************************************************************************************
+*                                  DYNAMIC MEMORY POOL CACHE DATA TYPE
+*
+* Note(s) : (1) A dynamic memory pool cache keeps a small private list of free blocks in front of a dynamic
+*               memory pool. Blocks are got from & freed to the cache without any lock; the pool's free list
+*               is only accessed to refill an empty cache or to drain a full one, 'RefillQty' blocks at a
+*               time. When the pool's free list cannot provide enough blocks, the missing ones are carved
+*               from the pool's memory segment in a single allocation.
+*
+*           (2) A cache MUST be owned by a single task (e.g. allocated on its stack or in its task-local
+*               storage) & MUST NOT be accessed from an ISR or from any other task.
+*
+*           (3) Cached blocks are accounted as allocated in the pool's 'BlkAllocCnt'. Mem_DynPoolCacheFlush()
+*               SHOULD be called before a cache is discarded so that its blocks return to the pool.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+typedef  struct  mem_dyn_pool_cache {                           /* --------------- DYN MEM POOL CACHE ----------------- */
+    MEM_DYN_POOL  *PoolPtr;                                     /* Ptr to backing dyn mem pool.                         */
+    void          *BlkFreePtr;                                  /* Ptr to first cached blk.                             */
+    CPU_SIZE_T     BlkCnt;                                      /* Nbr of cached blks.                                  */
+    CPU_SIZE_T     BlkCntMax;                                   /* Max nbr of cached blks.                              */
+    CPU_SIZE_T     RefillQty;                                   /* Nbr of blks moved per refill/drain (see Note #1).    */
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    const  CPU_CHAR    *NamePtr;                                /* Ptr to mem pool name.                                */
+    CPU_INT32U     StatHitCtr;                                  /* Nbr of hits not yet reported to pool.                */
+#endif
+} MEM_DYN_POOL_CACHE;
 #endif
-} MEM_DYN_POOL;
 
 
 /*
@@ -1305,6 +1457,20 @@ CPU_BOOLEAN        Mem_Cmp                  (const  void              *p1_mem,
                                                     CPU_SIZE_T         size);
 
 
+#if (LIB_MEM_CFG_OPTIMIZE_SIMD_EN == DEF_ENABLED)             /* ----------------- MEM SIMD KERNELS ----------------- */
+void               Mem_SetSIMD              (       void              *pmem,
+                                                    CPU_INT08U         data_val,
+                                                    CPU_SIZE_T         size);
+
+void               Mem_CopySIMD             (       void              *pdest,
+                                             const  void              *psrc,
+                                                    CPU_SIZE_T         size);
+
+CPU_BOOLEAN        Mem_CmpSIMD              (const  void              *p1_mem,
+                                             const  void              *p2_mem,
+                                                    CPU_SIZE_T         size);
+#endif
+
                                                                 /* ----------- MEM HEAP FNCTS (DEPRECATED) ------------ */
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
 void              *Mem_HeapAlloc            (       CPU_SIZE_T         size,
@@ -1409,6 +1575,23 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+#if (LIB_MEM_CFG_DYN_POOL_CACHE_EN == DEF_ENABLED)
+void               Mem_DynPoolCacheInit     (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    MEM_DYN_POOL        *p_pool,
+                                                    CPU_SIZE_T           blk_cnt_max,
+                                                    LIB_ERR             *p_err);
+
+void              *Mem_DynPoolCacheBlkGet   (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    LIB_ERR             *p_err);
+
+void               Mem_DynPoolCacheBlkFree  (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    void                *p_blk,
+                                                    LIB_ERR             *p_err);
+
+void               Mem_DynPoolCacheFlush    (       MEM_DYN_POOL_CACHE  *p_cache,
+                                                    LIB_ERR             *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1443,6 +1626,14 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_OPTIMIZE_SIMD_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_OPTIMIZE_SIMD_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_OPTIMIZE_SIMD_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+#endif
+
+
 #ifndef  LIB_MEM_CFG_HEAP_SIZE
 #error  "LIB_MEM_CFG_HEAP_SIZE              not #define'd in 'lib_cfg.h'"
 #error  "                                   [MUST be  >= 0]             "
@@ -1470,6 +1661,22 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]           "
+#error  "                                  [     ||  DEF_ENABLED ]           "
+#endif
+
+
+#if    ((LIB_MEM_CFG_DYN_POOL_CACHE_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_DYN_POOL_CACHE_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_DYN_POOL_CACHE_EN     illegally #define'd in 'lib_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]           "
+#error  "                                  [     ||  DEF_ENABLED ]           "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    LIBRARY CONFIGURATION ERRORS
@@ -128,6 +128,25 @@ static  const  CPU_INT32U  Str_MultOvfThTbl_Int32U[] = {
    (CPU_INT32U)(DEF_INT_32U_MAX_VAL / 36u)          /* 32-bit mult ovf th for base 36.  */
 };
 
+static  const  CPU_INT32U  Str_PowTbl_Dec_Int32U[] = {
+    10u,                                            /* Min val with  2 dec digs.        */
+    100u,                                           /* Min val with  3 dec digs.        */
+    1000u,                                          /* Min val with  4 dec digs.        */
+    10000u,                                         /* Min val with  5 dec digs.        */
+    100000u,                                        /* Min val with  6 dec digs.        */
+    1000000u,                                       /* Min val with  7 dec digs.        */
+    10000000u,                                      /* Min val with  8 dec digs.        */
+    100000000u,                                     /* Min val with  9 dec digs.        */
+    1000000000u                                     /* Min val with 10 dec digs.        */
+};
+
+static  const  CPU_CHAR    Str_DigPairTbl_Dec[] =   /* Dec dig pairs "00" to "99".      */
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 
 /*
 *********************************************************************************************************
@@ -157,6 +176,16 @@ static  CPU_INT32U   Str_ParseNbr_Int32(const  CPU_CHAR      *pstr,
                                                CPU_BOOLEAN    nbr_signed,
                                                CPU_BOOLEAN   *pnbr_neg);
 
+static  void         Str_SrchShiftTblInit(     CPU_INT08U    *pshift_tbl,
+                                         const CPU_CHAR      *pstr_srch,
+                                               CPU_SIZE_T     srch_len);
+
+static  CPU_CHAR    *Str_SrchHorspool  (const  CPU_CHAR      *pstr,
+                                               CPU_SIZE_T     str_len,
+                                        const  CPU_CHAR      *pstr_srch,
+                                               CPU_SIZE_T     srch_len,
+                                        const  CPU_INT08U    *pshift_tbl);
+
 
 /*
 *********************************************************************************************************
@@ -1829,11 +1858,15 @@ CPU_CHAR  *Str_Str (const  CPU_CHAR  *pstr,
 *
 *                   (f) Search string found.
 *                       (1) Return pointer to first occurrence of search string in string (see Note #2b1A).
-*                       (2) Search string found via Str_Cmp_N().
+*                       (2) Search string found via Boyer-Moore-Horspool search or via first character
+*                           scan & Str_Cmp_N() (see 'lib_str.h  STRING SEARCH DEFINES  Note #2').
 *
 *                   (g) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include terminating NULL character
 *                           (see Note #2a2).
+*
+*               (4) Searching repeatedly for the same search string SHOULD use Str_SrchPatInit() &
+*                   Str_Str_Pat_N() instead.
 *********************************************************************************************************
 */
 
@@ -1846,10 +1879,10 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
            CPU_SIZE_T    len_max_srch;
            CPU_SIZE_T    srch_len;
            CPU_SIZE_T    srch_ix;
-           CPU_BOOLEAN   srch_done;
            CPU_INT16S    srch_cmp;
+           CPU_CHAR      srch_char;
     const  CPU_CHAR     *pstr_str;
-    const  CPU_CHAR     *pstr_srch_ix;
+           CPU_INT08U    shift_tbl[STR_SRCH_SHIFT_TBL_SIZE];
 
                                                                 /* Rtn NULL if str ptr(s) NULL (see Note #3a).          */
     if (pstr == (const CPU_CHAR *)0) {
@@ -1887,21 +1920,150 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
     }
 
     srch_len  = str_len - str_len_srch;                         /* Calc srch len (see Note #3e2).                       */
-    srch_ix   = 0u;
 
-    do {
-        pstr_srch_ix = (const CPU_CHAR *)(pstr + srch_ix);
-        srch_cmp     =  Str_Cmp_N(pstr_srch_ix, pstr_srch, str_len_srch);
-        srch_done    = (srch_cmp == 0) ? DEF_YES : DEF_NO;
-        srch_ix++;
-    } while ((srch_done == DEF_NO) && (srch_ix <= srch_len));
+    if ((str_len_srch >= STR_SRCH_HORSPOOL_SRCH_LEN_MIN) &&     /* If srch str & str long enough, ...                   */
+        (srch_len     >= STR_SRCH_HORSPOOL_STR_LEN_MIN )) {     /* ... srch with shift tbl (see Note #3f2).             */
+        Str_SrchShiftTblInit(shift_tbl, pstr_srch, str_len_srch);
+        pstr_str = Str_SrchHorspool(pstr,      str_len,
+                                    pstr_srch, str_len_srch,
+                                    shift_tbl);
+        return ((CPU_CHAR *)pstr_str);
+    }
+
+    srch_char = pstr_srch[0];
+    for (srch_ix = 0u; srch_ix <= srch_len; srch_ix++) {        /* Else scan str for first srch char, ...               */
+        if (pstr[srch_ix] == srch_char) {
+            srch_cmp = Str_Cmp_N(pstr      + srch_ix + 1u,      /* ... & cmp rem srch str chars.                        */
+                                 pstr_srch + 1u,
+                                 str_len_srch - 1u);
+            if (srch_cmp == 0) {                                /* Rtn ptr to found srch str (see Note #3f1).           */
+                return ((CPU_CHAR *)(pstr + srch_ix));
+            }
+        }
+    }
+
+    return ((CPU_CHAR *)0);                                     /* Rtn NULL if srch str NOT found (see Note #3e2).      */
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Str_SrchPatInit()
+*
+* Description : Initialize a search pattern to search repeatedly for the same search string.
+*
+* Argument(s) : p_pat           Pointer to search pattern to initialize.
+*
+*               pstr_srch       Pointer to search string (see Note #1).
+*
+*               len_max         Maximum number of search string characters.
+*
+* Return(s)   : DEF_OK,   if search pattern successfully initialized.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The search string is NOT copied & MUST remain valid & unmodified while the search
+*                   pattern is used (see 'lib_str.h  STRING SEARCH PATTERN DATA TYPE  Note #2').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  Str_SrchPatInit (       STR_SRCH_PAT  *p_pat,
+                              const  CPU_CHAR      *pstr_srch,
+                                     CPU_SIZE_T     len_max)
+{
+    CPU_SIZE_T  str_len_srch;
+
+
+    if (p_pat == (STR_SRCH_PAT *)0) {
+        return (DEF_FAIL);
+    }
+    if (pstr_srch == (const CPU_CHAR *)0) {
+        return (DEF_FAIL);
+    }
+
+    str_len_srch  = Str_Len_N(pstr_srch, len_max);
+
+    p_pat->StrPtr = pstr_srch;
+    p_pat->StrLen = str_len_srch;
+    if (str_len_srch > 0u) {
+        Str_SrchShiftTblInit(p_pat->ShiftTbl, pstr_srch, str_len_srch);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Str_Str_Pat_N()
+*
+* Description : Search string for first occurence of a precompiled search pattern, up to a maximum number
+*                   of characters.
+*
+* Argument(s) : pstr            Pointer to string (see Note #1).
+*
+*               p_pat           Pointer to search pattern, initialized by Str_SrchPatInit().
+*
+*               len_max         Maximum number of characters to search.
+*
+* Return(s)   : Pointer to first occurrence of search string in string, if any.
+*
+*               Pointer to string,                                      if NULL search string.
+*
+*               Pointer to NULL,                                        otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) String buffer NOT modified.
+*
+*               (2) Str_Str_Pat_N() returns the same results as Str_Str_N() called with the pattern's
+*                   search string (see 'Str_Str_N()  Note #3').
+*********************************************************************************************************
+*/
 
+CPU_CHAR  *Str_Str_Pat_N (const  CPU_CHAR      *pstr,
+                          const  STR_SRCH_PAT  *p_pat,
+                                 CPU_SIZE_T     len_max)
+{
+           CPU_SIZE_T   str_len;
+    const  CPU_CHAR    *pstr_str;
 
-    if (srch_cmp != 0) {                                        /* Rtn NULL if srch str NOT found (see Note #3e2).      */
+                                                                /* Rtn NULL if ptr(s) NULL.                             */
+    if (pstr == (const CPU_CHAR *)0) {
+        return ((CPU_CHAR *)0);
+    }
+    if (p_pat == (const STR_SRCH_PAT *)0) {
+        return ((CPU_CHAR *)0);
+    }
+    if (p_pat->StrPtr == (const CPU_CHAR *)0) {
         return ((CPU_CHAR *)0);
     }
 
-    return ((CPU_CHAR *)pstr_srch_ix);                          /* Else rtn ptr to found srch str (see Note #3f1).      */
+    if (len_max < 1) {                                          /* Rtn NULL if srch len = 0.                            */
+        return ((CPU_CHAR *)0);
+    }
+
+    if (p_pat->StrLen < 1) {                                    /* Rtn ptr to str if srch str len = 0.                  */
+        return ((CPU_CHAR *)pstr);
+    }
+
+    str_len = Str_Len_N(pstr, len_max);
+    if (p_pat->StrLen > str_len) {                              /* Rtn NULL if srch str len > str len.                  */
+        return ((CPU_CHAR *)0);
+    }
+
+    pstr_str = pstr + str_len;                                  /* Rtn NULL if NULL ptr found.                          */
+    if (pstr_str == (const CPU_CHAR *)0) {
+        return ((CPU_CHAR *)0);
+    }
+
+    pstr_str = Str_SrchHorspool(pstr,          str_len,
+                                p_pat->StrPtr, p_pat->StrLen,
+                                p_pat->ShiftTbl);
+
+    return ((CPU_CHAR *)pstr_str);
 }
 
 
@@ -3431,6 +3593,12 @@ CPU_INT32S  Str_ParseNbr_Int32S (const  CPU_CHAR     *pstr,
 *                          number of     =  {
 *                       question marks      {  (b)  'nbr_dig'         ,  if 'nbr_dig' > 0
 *
+*               (8) Decimal numbers are formatted with tables, rather than one division per digit :
+*
+*                   (a) The number of significant digits is found by comparison with powers of ten.
+*
+*                   (b) Digits are formatted two at a time from a table of the decimal digit pairs.
+*
 *********************************************************************************************************
 */
 
@@ -3453,6 +3621,7 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     CPU_INT08U    nbr_neg_sign;
     CPU_INT08U    nbr_lead_char;
     CPU_INT08U    dig_val;
+    CPU_INT08U    dig_pair_ix;
     CPU_INT08U    lead_char_delta_0;
     CPU_INT08U    lead_char_delta_a;
     CPU_BOOLEAN   lead_char_dig;
@@ -3510,9 +3679,17 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
         nbr_fmt     = nbr;
         nbr_log     = nbr;
         nbr_dig_max = 1u;
-        while (nbr_log >= nbr_base) {                           /* While nbr base digs avail, ...                       */
-            nbr_dig_max++;                                      /* ... calc max nbr digs.                               */
-            nbr_log /= nbr_base;
+        if (nbr_base == DEF_NBR_BASE_DEC) {                     /* If dec nbr, calc max nbr digs from tbl ...           */
+                                                                /* ... (see Note #8a).                                  */
+            while ((nbr_dig_max <= (sizeof(Str_PowTbl_Dec_Int32U) / sizeof(Str_PowTbl_Dec_Int32U[0]))) &&
+                   (nbr_log     >=  Str_PowTbl_Dec_Int32U[nbr_dig_max - 1u])) {
+                nbr_dig_max++;
+            }
+        } else {
+            while (nbr_log >= nbr_base) {                       /* While nbr base digs avail, ...                       */
+                nbr_dig_max++;                                  /* ... calc max nbr digs.                               */
+                nbr_log /= nbr_base;
+            }
         }
 
         nbr_neg_sign = (nbr_neg == DEF_YES) ? 1u : 0u;
@@ -3555,8 +3732,16 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
 
     for (i = 0u; i < nbr_dig_fmtd; i++) {                       /* Fmt str for desired nbr digs :                       */
         if (fmt_valid == DEF_YES) {
-            if ((nbr_fmt > 0) ||                                /* If fmt nbr > 0                               ...     */
-                (i == 0u)) {                                    /* ... OR on one's  dig to fmt (see Note #3c1), ...     */
+            if ((nbr_base == DEF_NBR_BASE_DEC) &&               /* If at least two dec digs rem,                ...     */
+                (nbr_fmt  >= 10u)) {                            /* ... fmt two digs from tbl   (see Note #8b).  ...     */
+                dig_pair_ix  = (CPU_INT08U)((nbr_fmt % 100u) * 2u);
+               *pstr_fmt--   =  Str_DigPairTbl_Dec[dig_pair_ix + 1u];
+               *pstr_fmt--   =  Str_DigPairTbl_Dec[dig_pair_ix];
+                nbr_fmt     /=  100u;
+                i++;
+
+            } else if ((nbr_fmt > 0) ||                         /* ... else if fmt nbr > 0                      ...     */
+                       (i == 0u)) {                             /* ... OR on one's  dig to fmt (see Note #3c1), ...     */
                                                                 /* ... calc & fmt dig val;                      ...     */
                 dig_val = (CPU_INT08U)(nbr_fmt % nbr_base);
                 if (dig_val < 10u) {
@@ -4028,3 +4213,114 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
 
     return (nbr);
 }
+
+
+/*
+*********************************************************************************************************
+*                                       Str_SrchShiftTblInit()
+*
+* Description : Initialize the Boyer-Moore-Horspool bad-character shift table of a search string.
+*
+* Argument(s) : pshift_tbl      Pointer to shift table, of STR_SRCH_SHIFT_TBL_SIZE entries.
+*
+*               pstr_srch       Pointer to search string.
+*
+*               srch_len        Length of search string (MUST be non-zero).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Str_Str_N(),
+*               Str_SrchPatInit().
+*
+* Note(s)     : (1) Each character's shift is the distance from its last occurrence in the search string,
+*                   excluding the last character, to the end of the search string.  Characters NOT in the
+*                   search string shift by the full search string length.
+*
+*               (2) Shifts are saturated to STR_SRCH_SHIFT_MAX (see 'lib_str.h  STRING SEARCH DEFINES
+*                   Note #1').
+*********************************************************************************************************
+*/
+
+static  void  Str_SrchShiftTblInit (       CPU_INT08U  *pshift_tbl,
+                                    const  CPU_CHAR    *pstr_srch,
+                                           CPU_SIZE_T   srch_len)
+{
+    CPU_SIZE_T  shift;
+    CPU_SIZE_T  i;
+
+
+    shift = DEF_MIN(srch_len, STR_SRCH_SHIFT_MAX);              /* See Note #2.                                         */
+    for (i = 0u; i < STR_SRCH_SHIFT_TBL_SIZE; i++) {
+        pshift_tbl[i] = (CPU_INT08U)shift;
+    }
+
+    for (i = 0u; i < (srch_len - 1u); i++) {                    /* See Note #1.                                         */
+        shift = DEF_MIN(srch_len - 1u - i, STR_SRCH_SHIFT_MAX);
+        pshift_tbl[(CPU_INT08U)pstr_srch[i]] = (CPU_INT08U)shift;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Str_SrchHorspool()
+*
+* Description : Search string for first occurence of a search string, using a Boyer-Moore-Horspool
+*                   bad-character shift table.
+*
+* Argument(s) : pstr            Pointer to string.
+*
+*               str_len         Length of string.
+*
+*               pstr_srch       Pointer to search string.
+*
+*               srch_len        Length of search string (MUST be non-zero & NOT greater than 'str_len').
+*
+*               pshift_tbl      Pointer to search string's shift table (see 'Str_SrchShiftTblInit()').
+*
+* Return(s)   : Pointer to first occurrence of search string in string, if any.
+*
+*               Pointer to NULL,                                        otherwise.
+*
+* Caller(s)   : Str_Str_N(),
+*               Str_Str_Pat_N().
+*
+* Note(s)     : (1) Each candidate position is first checked with the character aligned with the last
+*                   search string character; remaining characters are compared only if it matches.
+*********************************************************************************************************
+*/
+
+static  CPU_CHAR  *Str_SrchHorspool (const  CPU_CHAR    *pstr,
+                                            CPU_SIZE_T   str_len,
+                                     const  CPU_CHAR    *pstr_srch,
+                                            CPU_SIZE_T   srch_len,
+                                     const  CPU_INT08U  *pshift_tbl)
+{
+    CPU_SIZE_T  srch_ix;
+    CPU_SIZE_T  srch_ix_max;
+    CPU_SIZE_T  i;
+    CPU_CHAR    char_last;
+    CPU_CHAR    char_cur;
+
+
+    char_last   = pstr_srch[srch_len - 1u];
+    srch_ix_max = str_len - srch_len;
+    srch_ix     = 0u;
+
+    while (srch_ix <= srch_ix_max) {
+        char_cur = pstr[srch_ix + srch_len - 1u];
+        if (char_cur == char_last) {                            /* If last char matches (see Note #1), ...              */
+            i = srch_len - 1u;
+            while ((i > 0u) &&                                  /* ... cmp rem chars.                                   */
+                   (pstr[srch_ix + i - 1u] == pstr_srch[i - 1u])) {
+                i--;
+            }
+            if (i == 0u) {
+                return ((CPU_CHAR *)(pstr + srch_ix));
+            }
+        }
+        srch_ix += pshift_tbl[(CPU_INT08U)char_cur];
+    }
+
+    return ((CPU_CHAR *)0);
+}
@@ -217,12 +217,53 @@
 #define  STR_PARENT_PATH_LEN           (sizeof(STR_PARENT_PATH) - 1)
 
 
+/*
+*********************************************************************************************************
+*                                       STRING SEARCH DEFINES
+*
+* Note(s) : (1) Str_Str_N() & Str_Str_Pat_N() search with the Boyer-Moore-Horspool algorithm, using a bad-
+*               character shift table of one octet per character value.  Shifts are saturated to
+*               STR_SRCH_SHIFT_MAX, which only shortens the shifts of search strings longer than
+*               STR_SRCH_SHIFT_MAX characters.
+*
+*           (2) Str_Str_N() builds its shift table on the stack, ONLY if the search string is at least
+*               STR_SRCH_HORSPOOL_SRCH_LEN_MIN characters long & the string to search is at least
+*               STR_SRCH_HORSPOOL_STR_LEN_MIN characters longer than the search string.  Otherwise, a
+*               simple first-character scan is cheaper than building the shift table.
+*********************************************************************************************************
+*/
+
+#define  STR_SRCH_SHIFT_TBL_SIZE                         256u
+#define  STR_SRCH_SHIFT_MAX                              DEF_INT_08U_MAX_VAL
+
+#define  STR_SRCH_HORSPOOL_SRCH_LEN_MIN                    4u   /* See Note #2.                                         */
+#define  STR_SRCH_HORSPOOL_STR_LEN_MIN                    64u
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                   STRING SEARCH PATTERN DATA TYPE
+*
+* Note(s) : (1) A search pattern precompiles the shift table of a search string to search for repeatedly
+*               (e.g. multipart boundary markers).  See also 'STRING SEARCH DEFINES  Note #1'.
+*
+*           (2) The search string is NOT copied; it MUST remain valid & unmodified while the pattern is
+*               used.
+*********************************************************************************************************
+*/
+
+typedef  struct  str_srch_pat {
+    const  CPU_CHAR    *StrPtr;                                 /* Ptr to search str (see Note #2).                     */
+           CPU_SIZE_T   StrLen;                                 /* Len of search str.                                   */
+           CPU_INT08U   ShiftTbl[STR_SRCH_SHIFT_TBL_SIZE];      /* Bad-char shift tbl.                                  */
+} STR_SRCH_PAT;
+
 
 /*
 *********************************************************************************************************
@@ -332,6 +373,14 @@ CPU_CHAR    *Str_Str_N          (const  CPU_CHAR      *pstr,
                                  const  CPU_CHAR      *pstr_srch,
                                         CPU_SIZE_T     len_max);
 
+CPU_BOOLEAN  Str_SrchPatInit    (       STR_SRCH_PAT  *p_pat,
+                                 const  CPU_CHAR      *pstr_srch,
+                                        CPU_SIZE_T     len_max);
+
+CPU_CHAR    *Str_Str_Pat_N      (const  CPU_CHAR      *pstr,
+                                 const  STR_SRCH_PAT  *p_pat,
+                                        CPU_SIZE_T     len_max);
+
 
                                                                        /* ------------------ STR FMT  FNCTS ------------------ */
 CPU_CHAR    *Str_FmtNbr_Int32U  (       CPU_INT32U     nbr,
@@ -195,6 +195,9 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 * Note(s) : (1) Configure NET_CTR_CFG_STAT_EN to enable/disable network protocol suite statistics counters.
 *
 *           (2) Configure NET_CTR_CFG_ERR_EN  to enable/disable network protocol suite error      counters.
+*
+*           (3) Configure NET_CTR_CFG_LOCK_STAT_EN to enable/disable global network lock contention
+*               statistics (see 'net.c  Net_GlobalLockStatGet()').
 *********************************************************************************************************
 *********************************************************************************************************
 */
@@ -209,6 +212,11 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
                                                                 /*   DEF_DISABLED     Error counters DISABLED           */
                                                                 /*   DEF_ENABLED      Error counters ENABLED            */
 
+                                                                /* Configure lock stat  feature (see Note #3) :         */
+#define  NET_CTR_CFG_LOCK_STAT_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED     Lock  stats    DISABLED           */
+                                                                /*   DEF_ENABLED      Lock  stats    ENABLED            */
+
 
 
 /*
@@ -233,12 +241,48 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *
 *               See also 'net_tmr.h  NETWORK TIMER TASK TIME DEFINES  Notes #1 & #2'
 *                      & 'net_tmr.c  NetTmr_Task()  Notes #1 & #2'.
+*
+*           (3) Configure NET_TMR_CFG_WHEEL_SIZE with the number of slots of the network timer wheel;
+*               MUST be a power of 2.  Only the timers of one slot are handled per timer task tick.
+*
+*               See also 'net_tmr.h  NETWORK TIMER WHEEL DEFAULT CONFIGURATION'.
+*
+*           (4) Configure NET_TMR_CFG_HI_RES_EN to enable/disable millisecond network timers, expired between
+*               timer task ticks; used by TCP retransmission, delayed acknowledgement & persist timers.
+*
+*               See also 'net_tmr.h  NETWORK TIMER HIGH-RESOLUTION DEFAULT CONFIGURATION'.
 *********************************************************************************************************
 *********************************************************************************************************
 */
 
 #define  NET_TMR_CFG_NBR_TMR                    100u            /* Configure total number of TIMERs (see Note #1).      */
 #define  NET_TMR_CFG_TASK_FREQ                  10u             /* Configure Timer Task frequency   (see Note #2).      */
+#define  NET_TMR_CFG_WHEEL_SIZE                256u             /* Configure Timer Wheel size       (see Note #3).      */
+#define  NET_TMR_CFG_HI_RES_EN                  DEF_DISABLED    /* Configure hi-res (ms) timers     (see Note #4).      */
+
+
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                               NETWORK BUFFER MANAGEMENT CONFIGURATION
+*
+* Note(s) : (1) Configure NET_BUF_CFG_CACHE_EN to enable/disable the per-interface caches of network buffer
+*               headers & transmit buffer data areas, which let most buffer gets & frees bypass the memory
+*               pools' critical sections.
+*
+*           (2) Configure NET_BUF_CFG_CACHE_SIZE with the number of blocks held by each cache; the caches
+*               are refilled from & returned to the pools by half this number of blocks at a time.
+*
+*               See also 'net_buf.h  NETWORK BUFFER CACHE DEFAULT CONFIGURATION'
+*                      & 'net_buf.c  NetBuf_PoolBlkGet()  Note #1'.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  NET_BUF_CFG_CACHE_EN                   DEF_DISABLED    /* Configure network buffer caches  (see Note #1).      */
+#define  NET_BUF_CFG_CACHE_SIZE                 8u              /* Configure network buffer cache size (see Note #2).   */
 
 
 
@@ -264,6 +308,18 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 #define  NET_IF_CFG_TX_SUSPEND_TIMEOUT_MS       1u              /* Configure interface transmit suspend timeout in ms.  */
 
+#define  NET_IF_CFG_RX_BATCH_MAX                8u              /* Configure max nbr of rx pkts handled per net lock.   */
+
+#define  NET_IF_CFG_RX_GRO_EN                   DEF_DISABLED    /* Configure rx TCP seg coalescing (GRO) :              */
+                                                                /*   DEF_DISABLED  Rx segs NOT coalesced                */
+                                                                /*   DEF_ENABLED   Rx segs     coalesced per rx batch   */
+#define  NET_IF_CFG_RX_GRO_SEG_MAX              8u              /* Configure max nbr of rx segs coalesced per chain.    */
+
+#define  NET_IF_CFG_TX_TSO_EN                   DEF_DISABLED    /* Configure tx TCP seg hdr replication (TSO) :         */
+                                                                /*   DEF_DISABLED  Tx segs' hdrs built per seg          */
+                                                                /*   DEF_ENABLED   Tx segs' hdrs replicated from tmpl   */
+#define  NET_IF_CFG_TX_TSO_SEG_MAX              16u             /* Configure max nbr of tx segs replicated per tmpl.    */
+
 
 
 /*
@@ -272,11 +328,15 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *                           ADDRESS RESOLUTION PROTOCOL LAYER CONFIGURATION
 *
 * Note(s) : (1) Address resolution protocol ONLY required for IPv4.
+*
+*           (2) Configure NET_ARP_CFG_CACHE_HASH_TBL_SIZE with the number of ARP cache hash table buckets;
+*               MUST be a power of 2.  Set to 0u to search the entire ARP cache list instead.
 *********************************************************************************************************
 *********************************************************************************************************
 */
 
 #define  NET_ARP_CFG_CACHE_NBR                  3u              /* Configure ARP cache size.                            */
+#define  NET_ARP_CFG_CACHE_HASH_TBL_SIZE        4u              /* Configure ARP cache hash tbl size (see Note #2).     */
 
 
 /*
@@ -285,11 +345,15 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *                           NEIGHBOR DISCOVERY PROTOCOL LAYER CONFIGURATION
 *
 * Note(s) : (1) Neighbor Discovery Protocol ONLY required for IPv6.
+*
+*           (2) Configure NET_NDP_CFG_CACHE_HASH_TBL_SIZE with the number of NDP Neighbor cache hash table
+*               buckets; MUST be a power of 2.  Set to 0u to search the entire NDP cache list instead.
 *********************************************************************************************************
 *********************************************************************************************************
 */
 
 #define  NET_NDP_CFG_CACHE_NBR                  5u              /* Configures number of NDP Neighbor cache entries.     */
+#define  NET_NDP_CFG_CACHE_HASH_TBL_SIZE        4u              /* Configures NDP cache hash tbl size (see Note #2).    */
 #define  NET_NDP_CFG_DEST_NBR                   5u              /* Configures number of NDP Destination cache entries.  */
 #define  NET_NDP_CFG_PREFIX_NBR                 5u              /* Configures number of NDP Prefix entries.             */
 #define  NET_NDP_CFG_ROUTER_NBR                 1u              /* Configures number of NDP Router entries.             */
@@ -317,6 +381,8 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 #define  NET_IPv4_CFG_IF_MAX_NBR_ADDR           1u              /* Configure maximum number of addresses per interface. */
 
+#define  NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX   65535u          /* Configure max frag'd octets in reasm per src addr.   */
+
 /*
 *********************************************************************************************************
 *                                                IPv6
@@ -401,6 +467,14 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *
 *                       RX window size per socket = (14600 / 2)           =  7300 bytes
 *                       TX window size per socket = (8760  / 2)           =  4380 bytes
+*
+*           (3) Received packets are demultiplexed to their connection through two hash tables, one for
+*               connected sockets & one for listening/unconnected sockets. The number of buckets in each
+*               table MUST be a power of 2; a value close to the number of connections keeps lookups
+*               constant time. Configure to 0 to search the connection lists instead.
+*
+*           (4) Socket event sets are signaled by the socket select events; NET_SOCK_CFG_SEL_EN MUST be
+*               enabled to enable NET_SOCK_CFG_EVENT_SET_EN.
 *********************************************************************************************************
 *********************************************************************************************************
 */
@@ -413,6 +487,16 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
                                                                 /*   DEF_DISABLED  Socket select  DISABLED              */
                                                                 /*   DEF_ENABLED   Socket select  ENABLED               */
 
+                                                                /* Configure socket event set API (see Note #4) :       */
+#define  NET_SOCK_CFG_EVENT_SET_EN              DEF_DISABLED
+                                                                /*   DEF_DISABLED  Socket event sets DISABLED           */
+                                                                /*   DEF_ENABLED   Socket event sets ENABLED            */
+
+                                                                /* Configure socket zero-copy rx/tx API :               */
+#define  NET_SOCK_CFG_ZERO_COPY_EN              DEF_DISABLED
+                                                                /*   DEF_DISABLED  Socket zero-copy API DISABLED        */
+                                                                /*   DEF_ENABLED   Socket zero-copy API ENABLED         */
+
                                                                 /* Configure stream-type sockets' accept queue          */
 #define  NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX    2u              /* maximum size. (See Note # 1)                         */
 
@@ -422,6 +506,9 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 #define  NET_SOCK_CFG_RX_Q_SIZE_OCTET           4096u           /* Configure socket receive  queue buffer size.         */
 #define  NET_SOCK_CFG_TX_Q_SIZE_OCTET           4096u           /* Configure socket transmit queue buffer size.         */
 
+                                                                /* Configure number of connection hash table buckets    */
+#define  NET_CONN_CFG_HASH_TBL_SIZE             16u             /* (see Note #3).                                       */
+
 
 /* ==================================  ADVANCED SOCKET CONFIGURATION: DEFAULT VALUES ================================== */
 /* By default sockets are set to block. Add the following define to set all sockets as non-blocking. Note that it's     */
@@ -471,6 +558,41 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
                                                                 /*   DEF_DISABLED  TCP layer  DISABLED                  */
                                                                 /*   DEF_ENABLED   TCP layer  ENABLED                   */
 
+                                                                /* Configure TCP Selective Acknowledgement (SACK) :     */
+#define  NET_TCP_CFG_SACK_EN                    DEF_DISABLED
+                                                                /*   DEF_DISABLED  SACK option DISABLED                 */
+                                                                /*   DEF_ENABLED   SACK option ENABLED (RFC #2018/2883) */
+
+                                                                /* Configure TCP Window Scale option :                  */
+#define  NET_TCP_CFG_WIN_SCALE_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED  Window Scale DISABLED                */
+                                                                /*   DEF_ENABLED   Window Scale ENABLED  (RFC #7323)    */
+
+                                                                /* Configure TCP Timestamps option & PAWS :             */
+#define  NET_TCP_CFG_TS_EN                      DEF_DISABLED
+                                                                /*   DEF_DISABLED  Timestamps DISABLED                  */
+                                                                /*   DEF_ENABLED   Timestamps ENABLED    (RFC #7323)    */
+
+                                                                /* Configure TCP CUBIC congestion control :             */
+#define  NET_TCP_CFG_CONG_CTRL_CUBIC_EN         DEF_DISABLED
+                                                                /*   DEF_DISABLED  CUBIC DISABLED                       */
+                                                                /*   DEF_ENABLED   CUBIC ENABLED         (RFC #8312)    */
+
+                                                                /* Configure TCP dflt congestion control algorithm :    */
+#define  NET_TCP_CFG_CONG_CTRL_DFLT             NET_TCP_CONG_CTRL_ALGO_NEW_RENO
+                                                                /*   NET_TCP_CONG_CTRL_ALGO_NEW_RENO  (RFC #6582)       */
+                                                                /*   NET_TCP_CONG_CTRL_ALGO_CUBIC     (RFC #8312)       */
+
+                                                                /* Configure TCP per-connection telemetry :             */
+#define  NET_TCP_CFG_TELEMETRY_EN               DEF_DISABLED
+                                                                /*   DEF_DISABLED  Telemetry DISABLED                   */
+                                                                /*   DEF_ENABLED   Telemetry ENABLED                    */
+
+                                                                /* Configure TCP app tx data copy w/o net lock :        */
+#define  NET_TCP_CFG_TX_COPY_UNLOCK_EN          DEF_DISABLED
+                                                                /*   DEF_DISABLED  Copy app data while net lock held    */
+                                                                /*   DEF_ENABLED   Copy app data w/   net lock released */
+
 /* ========================================= ADVANCED TCP LAYER CONFIGURATION ========================================= */
 /* By default TCP RX and TX windows are set to equal the socket RX and TX queue sizes. Default values can be changed by */
 /* redefining the following defines. TCP windows must be properly configured to optimize performance (see note about    */
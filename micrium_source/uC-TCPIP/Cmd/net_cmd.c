@@ -61,6 +61,8 @@
 #include  "../Source/net_app.h"
 #include  "../Source/net_ascii.h"
 #include  "../Source/net_icmp.h"
+#include  "../Source/net_tcp.h"
+#include  "../Source/net_util.h"
 #include  "../Source/net_err.h"
 #include  "../Source/net.h"
 
@@ -111,6 +113,8 @@
 #define  NET_CMD_ARG_SOCK_SEL_ERR           ASCII_CHAR_LATIN_LOWER_E
 #define  NET_CMD_ARG_SOCK_SEL_TIMEOUT       ASCII_CHAR_LATIN_LOWER_T
 
+#define  NET_CMD_TCP_STAT_EXPORT_BUF_LEN    1472u
+
 
 
 
@@ -320,6 +324,10 @@ static  SHELL_CMD NetCmdTbl[] =
     {"net_sock_tx",            NetCmd_Sock_Tx},
     /*{"net_sock_sel",     NetCmd_Sock_Sel},*/
     {"net_sock_opt_set_child", NetCmd_SockOptSetChild},
+
+#if (defined(NET_TCP_MODULE_EN) && (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED))
+    {"net_tcp_stat",           NetCmd_TCP_Stat},
+#endif
     {0, 0 }
 };
 
@@ -506,6 +514,14 @@ static  CPU_INT32U                   NetCmd_DictionaryGet          (const  NET_C
                                                                            CPU_INT32U                    str_len);
 #endif
 
+#if (defined(NET_TCP_MODULE_EN) && (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED))
+static  CPU_INT16S                   NetCmd_TCP_StatAddrOutput     (       NET_IP_ADDR_FAMILY            addr_family,
+                                                                           CPU_INT08U                   *p_addr,
+                                                                           NET_PORT_NBR                  port_nbr,
+                                                                           SHELL_OUT_FNCT                out_fnct,
+                                                                           SHELL_CMD_PARAM              *p_cmd_param);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -3503,6 +3519,174 @@ exit:
 }
 
 
+/*
+*********************************************************************************************************
+*                                          NetCmd_TCP_Stat()
+*
+* Description : Command function to display the telemetry of every TCP connection in use.
+*
+* Argument(s) : argc            is a count of the arguments supplied.
+*
+*               p_argv          an array of pointers to the strings which are those arguments.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : The number of positive data octets transmitted, if NO errors
+*
+*               SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+*
+*               SHELL_OUT_ERR,                                  otherwise
+*
+* Caller(s)   : Shell.
+*
+* Note(s)     : (1) Usage : net_tcp_stat [-f s|h]
+*
+*                   (a) By default, or with '-f s', one block is displayed per TCP connection.
+*
+*                   (b) With '-f h', the binary telemetry export is dumped in hexadecimal. The export
+*                       is truncated to NET_CMD_TCP_STAT_EXPORT_BUF_LEN octets & flagged accordingly;
+*                       see 'net_tcp.h  TCP CONNECTION TELEMETRY DEFINES  Note #2'.
+*
+*               (2) Each TCP connection is sampled under its own network lock acquisition, so the
+*                   displayed connections do NOT form a single snapshot.  Use '-f h' for a consistent
+*                   snapshot of all connections.
+*********************************************************************************************************
+*/
+#if (defined(NET_TCP_MODULE_EN) && (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED))
+CPU_INT16S  NetCmd_TCP_Stat (CPU_INT16U        argc,
+                             CPU_CHAR         *p_argv[],
+                             SHELL_OUT_FNCT    out_fnct,
+                             SHELL_CMD_PARAM  *p_cmd_param)
+{
+    NET_TCP_CONN_ID          conn_id_tcp;
+    NET_TCP_CONN_TELEMETRY   telemetry;
+    NET_CMD_OUTPUT_FMT       out_fmt;
+    CPU_CHAR                *p_fmt;
+    CPU_INT08U               export_buf[NET_CMD_TCP_STAT_EXPORT_BUF_LEN];
+    CPU_SIZE_T               export_len;
+    CPU_BOOLEAN              found;
+    CPU_INT16S               ret_val = 0;
+    NET_CMD_ERR              err;
+    NET_ERR                  err_net;
+
+
+    NetCmd_OutputBeginning(out_fnct, p_cmd_param);
+
+    out_fmt = NET_CMD_OUTPUT_FMT_STRING;                        /* See Note #1.                                         */
+    switch (argc) {
+        case 1:
+             break;
+
+        case 3:
+             if ((*p_argv[1]       != NET_CMD_ARG_BEGIN) ||
+                 (*(p_argv[1] + 1) != NET_CMD_ARG_FMT)) {
+                 ret_val = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+                 goto exit;
+             }
+
+             (void)NetCmd_ArgsParserParseFmt(&p_argv[1], &p_fmt, &err);
+             if (err != NET_CMD_ERR_NONE) {
+                 ret_val = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+                 goto exit;
+             }
+
+             out_fmt = NetCmd_ArgsParserTranslateFmt(p_fmt, &err);
+             if (err != NET_CMD_ERR_NONE) {
+                 ret_val = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+                 goto exit;
+             }
+             break;
+
+        default:
+             ret_val = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+             goto exit;
+    }
+
+
+    if (out_fmt == NET_CMD_OUTPUT_FMT_HEX) {                    /* See Note #1b.                                        */
+        export_len = NetTCP_ConnTelemetryExport(export_buf, sizeof(export_buf), &err_net);
+        if (err_net != NET_TCP_ERR_NONE) {
+            ret_val += NetCmd_OutputErrorNetNbr(err_net, out_fnct, p_cmd_param);
+            goto exit;
+        }
+
+        ret_val += NetCmd_OutputData(export_buf, (CPU_INT16U)export_len, out_fmt, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputSuccess(out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+
+    conn_id_tcp = NET_TCP_CONN_ID_NONE;                         /* See Note #1a.                                        */
+    found       = NetTCP_ConnTelemetryGetNext(&conn_id_tcp, &telemetry, &err_net);
+    while ((found   == DEF_YES) &&
+           (err_net == NET_TCP_ERR_NONE)) {
+        ret_val += NetCmd_OutputMsg("TCP Conn ID  : ", DEF_YES, DEF_NO,  DEF_NO,  out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.ConnID, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("State        : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.ConnState, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Local        : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_TCP_StatAddrOutput(telemetry.AddrFamily,
+                                             telemetry.AddrLocal,
+                                             telemetry.PortLocal,
+                                             out_fnct,
+                                             p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Remote       : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_TCP_StatAddrOutput(telemetry.AddrFamily,
+                                             telemetry.AddrRemote,
+                                             telemetry.PortRemote,
+                                             out_fnct,
+                                             p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Rx seg/octet : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.RxSegCtr, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputMsg(" / ", DEF_NO, DEF_NO,  DEF_NO,  out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.RxOctetCtr, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Tx seg/octet : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.TxSegCtr, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputMsg(" / ", DEF_NO, DEF_NO,  DEF_NO,  out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.TxOctetCtr, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Re-Tx seg    : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.ReTxSegCtr, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("RTT/RTO (ms) : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.RTT_Avg_ms, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputMsg(" / ", DEF_NO, DEF_NO,  DEF_NO,  out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.RTO_ms, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Cong win     : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.CongWin, out_fnct, p_cmd_param);
+
+        ret_val += NetCmd_OutputMsg("Q Rx/Tx/ReTx : ", DEF_YES, DEF_NO,  DEF_YES, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.RxQ_Octets, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputMsg(" / ", DEF_NO, DEF_NO,  DEF_NO,  out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.TxQ_Octets, out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputMsg(" / ", DEF_NO, DEF_NO,  DEF_NO,  out_fnct, p_cmd_param);
+        ret_val += NetCmd_OutputInt32U(telemetry.ReTxQ_Octets, out_fnct, p_cmd_param);
+
+        found = NetTCP_ConnTelemetryGetNext(&conn_id_tcp, &telemetry, &err_net);
+    }
+
+    if (err_net != NET_TCP_ERR_NONE) {
+        ret_val += NetCmd_OutputErrorNetNbr(err_net, out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+    ret_val += NetCmd_OutputSuccess(out_fnct, p_cmd_param);
+
+exit:
+    NetCmd_OutputEnd(out_fnct, p_cmd_param);
+    return (ret_val);
+}
+#endif
+
+
 
 /*
 *********************************************************************************************************
@@ -5661,3 +5845,74 @@ static CPU_INT32U  NetCmd_DictionaryGet  (const  NET_CMD_DICTIONARY *p_dictionar
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*                                     NetCmd_TCP_StatAddrOutput()
+*
+* Description : Output a TCP connection address & port number, as 'addr:port'.
+*
+* Argument(s) : addr_family     Address family of the connection.
+*
+*               p_addr          Pointer to the address, in network-order.
+*
+*               port_nbr        Port number, in host-order.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : The number of positive data octets transmitted, if NO errors
+*
+*               SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+*
+*               SHELL_OUT_ERR,                                  otherwise
+*
+* Caller(s)   : NetCmd_TCP_Stat().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+#if (defined(NET_TCP_MODULE_EN) && (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED))
+static  CPU_INT16S  NetCmd_TCP_StatAddrOutput (NET_IP_ADDR_FAMILY   addr_family,
+                                               CPU_INT08U          *p_addr,
+                                               NET_PORT_NBR         port_nbr,
+                                               SHELL_OUT_FNCT       out_fnct,
+                                               SHELL_CMD_PARAM     *p_cmd_param)
+{
+#ifdef  NET_IPv4_MODULE_EN
+    NET_IPv4_ADDR  addr_ipv4;
+#endif
+    CPU_CHAR       addr_ip_str[NET_ASCII_LEN_MAX_ADDR_IP];
+    CPU_INT16S     ret_val;
+    NET_ERR        err_net;
+
+
+    Str_Copy(addr_ip_str, "?");
+
+    switch (addr_family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_IP_ADDR_FAMILY_IPv4:
+             NET_UTIL_VAL_COPY_GET_NET_32(&addr_ipv4, p_addr);
+             NetASCII_IPv4_to_Str(addr_ipv4, addr_ip_str, DEF_NO, &err_net);
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_IP_ADDR_FAMILY_IPv6:
+             NetASCII_IPv6_to_Str((NET_IPv6_ADDR *)p_addr, addr_ip_str, DEF_NO, DEF_NO, &err_net);
+             break;
+#endif
+
+        default:
+             break;
+    }
+
+    ret_val  = NetCmd_OutputMsg(addr_ip_str, DEF_NO, DEF_NO, DEF_NO, out_fnct, p_cmd_param);
+    ret_val += NetCmd_OutputMsg(":",         DEF_NO, DEF_NO, DEF_NO, out_fnct, p_cmd_param);
+    ret_val += NetCmd_OutputInt32U(port_nbr, out_fnct, p_cmd_param);
+
+    return (ret_val);
+}
+#endif
+
@@ -435,6 +435,13 @@ CPU_INT16S            NetCmd_SockOptSetChild      (CPU_INT16U             argc,
                                                    SHELL_OUT_FNCT         out_fnct,
                                                    SHELL_CMD_PARAM       *p_cmd_param);
 
+#if (defined(NET_TCP_MODULE_EN) && (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED))
+CPU_INT16S            NetCmd_TCP_Stat             (CPU_INT16U             argc,
+                                                   CPU_CHAR              *p_argv[],
+                                                   SHELL_OUT_FNCT         out_fnct,
+                                                   SHELL_CMD_PARAM       *p_cmd_param);
+#endif
+
 NET_CMD_PING_CMD_ARG  NetCmd_PingCmdArgParse      (CPU_INT16U             argc,
                                                    CPU_CHAR              *p_argv[],
                                                    NET_CMD_ERR           *p_err);
@@ -0,0 +1,1105 @@
+/*
+*********************************************************************************************************
+*                                              uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                        NETWORK DEVICE DRIVER
+*
+*                                            Linux TAP
+*
+* Filename : net_dev_tap.c
+* Version  : V3.06.01
+*********************************************************************************************************
+* Note(s)  : (1) Driver for the POSIX port; Ethernet frames are exchanged with the host kernel through
+*                a Linux TAP interface ('/dev/net/tun' opened with IFF_TAP | IFF_NO_PI).
+*
+*            (2) The TAP interface number is configured in the device configuration's 'BaseAddr' field :
+*
+*                (a) 'BaseAddr' = N             Attach to TAP interface "tapN".
+*                (b) 'BaseAddr' = 0xFFFFFFFF    Let the kernel allocate the next free "tapN" interface.
+*
+*                The TAP interface SHOULD be created beforehand so that the application does NOT require
+*                the CAP_NET_ADMIN capability, e.g. :
+*
+*                    ip tuntap add dev tap0 mode tap user <user>
+*                    ip addr   add 192.168.100.1/24 dev tap0
+*                    ip link   set tap0 up
+*
+*            (3) Receive is implemented like a DMA controller :
+*
+*                (a) Each of the 'RxDescNbr' receive descriptors owns a network buffer data area.
+*
+*                (b) The receive task polls the non-blocking TAP file descriptor & reads up to
+*                    NET_DEV_TAP_RX_BATCH_MAX frames, directly into the free descriptors' data areas, per
+*                    wake-up.  NetIF_RxTaskSignal() is called for each frame read.
+*
+*                (c) NetDev_Rx() returns the next filled descriptor's data area to the stack & replaces it
+*                    with a new data area, so that frames are never copied.
+*
+*                (d) When no frame is available, the receive task sleeps NET_DEV_TAP_RX_POLL_DLY_MS
+*                    milliseconds; when no descriptor is free, it pends until NetDev_Rx() frees one.
+*
+*                (e) The receive task stands in for the device's receive interrupt; NET_RX_TASK_PRIO SHOULD
+*                    be configured higher than the Network Interface Receive Task priority so that frames
+*                    read per wake-up are batched (see 'net_if.h  NETWORK INTERFACE RECEIVE BATCH DEFAULT
+*                    CONFIGURATION  Note #1c').
+*
+*                The receive task is a KAL task & NOT a raw POSIX thread, since the network interface &
+*                kernel services MUST only be called from the simulated CPU's tasks.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+                                                                /* Host hdrs MUST precede net hdrs, which re-#define ... */
+                                                                /* ... the host's BSD socket constants.                 */
+#include  <errno.h>
+#include  <fcntl.h>
+#include  <stdio.h>
+#include  <string.h>
+#include  <unistd.h>
+#include  <sys/ioctl.h>
+#include  <net/if.h>
+#include  <linux/if_tun.h>
+
+#define    MICRIUM_SOURCE
+#define    NET_DEV_TAP_MODULE
+#include  <Source/net_cfg_net.h>
+
+#ifdef  NET_IF_ETHER_MODULE_EN
+#include  <Source/net.h>
+#include  <IF/net_if.h>
+#include  "net_dev_tap.h"
+#include  <IF/net_if_802x.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef  NET_RX_TASK_PRIO
+#define  NET_RX_TASK_PRIO       31
+#endif
+
+#define  NET_RX_TASK_STK_SIZE   1024
+
+#ifndef  NET_DEV_TAP_RX_BATCH_MAX                               /* Max nbr of frames rd per rx task wake-up.            */
+#define  NET_DEV_TAP_RX_BATCH_MAX                         16u
+#endif
+
+#ifndef  NET_DEV_TAP_RX_POLL_DLY_MS                             /* Rx task dly when no frame is avail (in ms).          */
+#define  NET_DEV_TAP_RX_POLL_DLY_MS                        1u
+#endif
+
+#define  NET_DEV_TAP_DEV_NAME                   "/dev/net/tun"
+#define  NET_DEV_TAP_IF_NAME_PREFIX             "tap"
+#define  NET_DEV_TAP_IF_NBR_AUTO                 0xFFFFFFFFu
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+                                                                /* ------------------ RX DESCRIPTOR ------------------- */
+typedef  struct  net_dev_rx_desc {
+    CPU_INT08U       *DataPtr;                                  /* Ptr to desc's net buf data area.                     */
+    CPU_INT16U        Len;                                      /* Len of frame rx'd in data area.                      */
+} NET_DEV_RX_DESC;
+
+                                                                /* --------------- DEVICE INSTANCE DATA --------------- */
+typedef  struct  net_dev_data_tap {
+    KAL_TASK_HANDLE   RxTaskHandle;
+    KAL_SEM_HANDLE    RxDescFreeSignal;                         /* Cnt of desc's avail to rx task (see Note #3d).       */
+    CPU_INT32S        Fd;                                       /* TAP file descriptor.                                 */
+    NET_DEV_RX_DESC  *RxDescTbl;
+    CPU_INT16U        RxDescNbr;
+    NET_BUF_SIZE      RxBufSize;                                /* Size of rx bufs (see 'NetDev_RxTask()  Note #2').    */
+    CPU_INT16U        RxDescIxHead;                             /* Ix of next desc to fill  by rx task.                 */
+    CPU_INT16U        RxDescIxTail;                             /* Ix of next desc to rtn   by NetDev_Rx().             */
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
+    NET_CTR           StatRxPktCtr;
+    NET_CTR           StatRxBatchCtr;                           /* Nbr of rx task wake-ups that rd at least one frame.  */
+    NET_CTR           StatRxPktDiscardedCtr;
+#endif
+} NET_DEV_DATA;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*
+* Note(s) : (1) Device driver functions may be arbitrarily named.  However, it is recommended that device
+*               driver functions be named using the names provided below.  All driver function prototypes
+*               should be located within the driver C source file ('net_dev_&&&.c') & be declared as
+*               static functions to prevent name clashes with other network protocol suite device drivers.
+*********************************************************************************************************
+*/
+
+                                                                        /* -------- FNCT'S COMMON TO ALL DEV'S -------- */
+static  void  NetDev_Init                  (NET_IF             *p_if,
+                                            NET_ERR            *p_err);
+
+static  void  NetDev_Start                 (NET_IF             *p_if,
+                                            NET_ERR            *p_err);
+
+static  void  NetDev_Stop                  (NET_IF             *p_if,
+                                            NET_ERR            *p_err);
+
+
+static  void  NetDev_Rx                    (NET_IF             *p_if,
+                                            CPU_INT08U        **p_data,
+                                            CPU_INT16U         *size,
+                                            NET_ERR            *p_err);
+
+static  void  NetDev_Tx                    (NET_IF             *p_if,
+                                            CPU_INT08U         *p_data,
+                                            CPU_INT16U          size,
+                                            NET_ERR            *p_err);
+
+static  void  NetDev_AddrMulticastAdd      (NET_IF             *p_if,
+                                            CPU_INT08U         *p_addr_hw,
+                                            CPU_INT08U          addr_hw_len,
+                                            NET_ERR            *p_err);
+
+static  void  NetDev_AddrMulticastRemove   (NET_IF             *p_if,
+                                            CPU_INT08U         *p_addr_hw,
+                                            CPU_INT08U          addr_hw_len,
+                                            NET_ERR            *p_err);
+
+
+static  void  NetDev_IO_Ctrl               (NET_IF             *p_if,
+                                            CPU_INT08U          opt,
+                                            void               *p_data,
+                                            NET_ERR            *p_err);
+
+                                                                        /* ---------- FNCT'S SPECIFIC TO TAP ---------- */
+static  void  NetDev_RxTask                (void               *p_data);
+
+static  void  NetDev_RxDescInit            (NET_IF             *p_if,
+                                            NET_ERR            *p_err);
+
+static  void  NetDev_RxDescFreeAll         (NET_IF             *p_if);
+
+static  void  NetDev_TAP_Open              (NET_DEV_DATA       *p_dev_data,
+                                            CPU_ADDR            tap_if_nbr,
+                                            NET_ERR            *p_err);
+
+
+/*
+*********************************************************************************************************
+*                                      NETWORK DEVICE DRIVER API
+*
+* Note(s) : (1) Device driver API structures are used by applications during calls to NetIF_Add().  This
+*               API structure allows higher layers to call specific device driver functions via function
+*               pointer instead of by name.  This enables the network protocol suite to compile & operate
+*               with multiple device drivers.
+*
+*           (2) In most cases, the API structure provided below SHOULD suffice for most device drivers
+*               exactly as is with the exception that the API structure's name which MUST be unique &
+*               SHOULD clearly identify the device being implemented.  For example, the Cirrus Logic
+*               CS8900A Ethernet controller's API structure should be named NetDev_API_CS8900A[].
+*
+*               The API structure MUST also be externally declared in the device driver header file
+*               ('net_dev_&&&.h') with the exact same name & type.
+*********************************************************************************************************
+*/
+                                                                                    /* TAP dev API fnct ptrs :          */
+const  NET_DEV_API_ETHER  NetDev_API_TAP = { NetDev_Init,                           /*   Init/add                       */
+                                             NetDev_Start,                          /*   Start                          */
+                                             NetDev_Stop,                           /*   Stop                           */
+                                             NetDev_Rx,                             /*   Rx                             */
+                                             NetDev_Tx,                             /*   Tx                             */
+                                             NetDev_AddrMulticastAdd,               /*   Multicast addr add             */
+                                             NetDev_AddrMulticastRemove,            /*   Multicast addr remove          */
+                                             DEF_NULL,                              /*   ISR handler                    */
+                                             NetDev_IO_Ctrl,                        /*   I/O ctrl                       */
+                                             DEF_NULL,                              /*   Phy reg rd                     */
+                                             DEF_NULL                               /*   Phy reg wr                     */
+                                           };
+
+
+/*
+*********************************************************************************************************
+*                                            NetDev_Init()
+*
+* Description : (1) Initialize Network Driver Layer :
+*
+*                   (a) Validate device configuration
+*                   (b) Allocate device data area & receive descriptors
+*                   (c) Create receive task & signal
+*                   (d) Open TAP interface
+*
+*
+* Argument(s) : p_if    Pointer to the interface requiring service.
+*
+*               p_err   Pointer to return error code.
+*                           NET_DEV_ERR_NONE            No Error.
+*                           NET_DEV_ERR_INVALID_CFG     Invalid device configuration.
+*                           NET_DEV_ERR_MEM_ALLOC       Memory allocation failed.
+*                           NET_DEV_ERR_FAULT           Receive task or signal creation failed.
+*                           NET_DEV_ERR_INIT            TAP interface could NOT be opened.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IF_Add() via 'pdev_api->Init()'.
+*
+* Note(s)     : (1) Each receive descriptor holds a large receive buffer for as long as the interface is
+*                   started; 'RxBufLargeNbr' MUST be greater than 'RxDescNbr' so that the stack still has
+*                   buffers to replace the descriptors' ones (see 'net_dev_tap.c  Note #3c').
+*********************************************************************************************************
+*/
+
+static  void  NetDev_Init (NET_IF   *p_if,
+                           NET_ERR  *p_err)
+{
+    NET_DEV_DATA       *p_dev_data;
+    NET_DEV_CFG_ETHER  *p_dev_cfg = (NET_DEV_CFG_ETHER *)p_if->Dev_Cfg;
+    NET_BUF_SIZE        buf_size_max;
+    CPU_SIZE_T          reqd_octets;
+    LIB_ERR             lib_err;
+    KAL_ERR             kal_err;
+
+
+                                                                /* --------------- VALIDATE DEVICE CFG ---------------- */
+                                                                /* Validate Rx buf ix offset.                           */
+    if (p_dev_cfg->RxBufIxOffset != 0u) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+                                                                /* Validate Rx buf size.                                */
+    buf_size_max = NetBuf_GetMaxSize(p_if->Nbr,
+                                     NET_TRANSACTION_RX,
+                                     0,
+                                     NET_IF_IX_RX);
+    if (buf_size_max < NET_IF_ETHER_FRAME_MAX_SIZE) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+                                                                /* Validate nbr of Rx desc's (see Note #1).             */
+    if ((p_dev_cfg->RxDescNbr <  1u) ||
+        (p_dev_cfg->RxDescNbr >= p_dev_cfg->RxBufLargeNbr)) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+                                                                /* Validate Tx buf ix offset.                           */
+    if (p_dev_cfg->TxBufIxOffset != 0u) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+
+
+                                                                /* -------------- ALLOCATE DEV DATA AREA -------------- */
+    p_dev_data = (NET_DEV_DATA *)Mem_HeapAlloc(sizeof(NET_DEV_DATA),
+                                               sizeof(CPU_ALIGN),
+                                              &reqd_octets,
+                                              &lib_err);
+    if (p_dev_data == DEF_NULL) {
+       *p_err = NET_DEV_ERR_MEM_ALLOC;
+        return;
+    }
+    Mem_Clr(p_dev_data, sizeof(NET_DEV_DATA));
+
+    p_dev_data->Fd        = -1;
+    p_dev_data->RxDescNbr =  p_dev_cfg->RxDescNbr;
+    p_dev_data->RxBufSize =  buf_size_max;
+    p_dev_data->RxDescTbl = (NET_DEV_RX_DESC *)Mem_HeapAlloc(sizeof(NET_DEV_RX_DESC) * p_dev_data->RxDescNbr,
+                                                             sizeof(CPU_ALIGN),
+                                                            &reqd_octets,
+                                                            &lib_err);
+    if (p_dev_data->RxDescTbl == DEF_NULL) {
+       *p_err = NET_DEV_ERR_MEM_ALLOC;
+        return;
+    }
+    Mem_Clr(p_dev_data->RxDescTbl, sizeof(NET_DEV_RX_DESC) * p_dev_data->RxDescNbr);
+
+    p_if->Dev_Data = p_dev_data;
+
+
+                                                                /* ------------- CREATE RX TASK & SIGNAL -------------- */
+    p_dev_data->RxDescFreeSignal = KAL_SemCreate("TAP Rx desc free signal", DEF_NULL, &kal_err);
+    if (kal_err != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_FAULT;
+        return;
+    }
+
+    p_dev_data->RxTaskHandle = KAL_TaskAlloc("TAP Rx task", DEF_NULL, NET_RX_TASK_STK_SIZE, DEF_NULL, &kal_err);
+    if (kal_err != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_FAULT;
+        return;
+    }
+
+
+                                                                /* ----------------- OPEN TAP INTERFACE --------------- */
+    NetDev_TAP_Open(p_dev_data, p_dev_cfg->BaseAddr, p_err);
+    if (*p_err != NET_DEV_ERR_NONE) {
+         return;
+    }
+
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NetDev_Start()
+*
+* Description : Start network interface hardware.
+*
+* Argument(s) : p_if        Pointer to a network interface.
+*               ----        Argument validated in NetIF_Start().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Ethernet device successfully started.
+*                               NET_DEV_ERR_FAULT               Receive task could NOT be created.
+*
+*                                                               - RETURNED BY NetIF_AddrHW_SetHandler() : --
+*                               NET_ERR_FAULT_NULL_PTR          Argument(s) passed a NULL pointer.
+*                               NET_ERR_FAULT_NULL_FNCT         Invalid NULL function pointer.
+*                               NET_IF_ERR_INVALID_CFG          Invalid/NULL API configuration.
+*                               NET_IF_ERR_INVALID_STATE        Invalid network interface state.
+*                               NET_IF_ERR_INVALID_ADDR         Invalid hardware address.
+*                               NET_IF_ERR_INVALID_ADDR_LEN     Invalid hardware address length.
+*
+*                                                               ------- RETURNED BY NetBuf_GetDataPtr() : --
+*                               NET_BUF_ERR_NONE_AVAIL          NO available buffers to allocate.
+*
+*                                                               -- RETURNED BY NetIF_DevCfgTxRdySignal() : -
+*                               NET_IF_ERR_INVALID_IF           Invalid network interface number.
+*                               NET_OS_ERR_INIT_DEV_TX_RDY_VAL  Invalid device transmit ready signal.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IF_Start() via 'pdev_api->Start()'.
+*
+* Note(s)     : (1) The HW address is set from one of the data sources below, in order of precedence :
+*
+*                   (a) Device configuration structure's 'HW_AddrStr'.
+*                   (b) NetIF_Ether_HW_AddrSet().
+*                   (c) Hard-coded address; a TAP interface has NO HW address of its own to auto-load.
+*
+*                   The TAP interface accepts every frame bridged/routed to it by the host, so NO HW
+*                   address filter needs to be configured.
+*
+*               (2) TAP frames are written synchronously by NetDev_Tx(); one transmit descriptor suffices
+*                   but a larger 'TxDescNbr' is harmless.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_Start (NET_IF   *p_if,
+                            NET_ERR  *p_err)
+{
+    NET_DEV_DATA       *p_dev_data = (NET_DEV_DATA      *)p_if->Dev_Data;
+    NET_DEV_CFG_ETHER  *p_dev_cfg  = (NET_DEV_CFG_ETHER *)p_if->Dev_Cfg;
+    CPU_INT08U          hw_addr[NET_IF_ETHER_ADDR_SIZE];
+    CPU_INT08U          hw_addr_len;
+    CPU_BOOLEAN         hw_addr_cfg;
+    NET_ERR             err;
+    KAL_ERR             kal_err;
+
+
+
+                                                                /* ------------------- CFG HW ADDR -------------------- */
+    hw_addr_cfg = DEF_NO;
+
+    NetASCII_Str_to_MAC(p_dev_cfg->HW_AddrStr,                  /* Get configured HW MAC address string, if any ...     */
+                       &hw_addr[0],                             /* ... (see Note #1a).                                  */
+                       &err);
+    if (err == NET_ASCII_ERR_NONE) {
+        NetIF_AddrHW_SetHandler(p_if->Nbr,
+                               &hw_addr[0],
+                                sizeof(hw_addr),
+                               &err);
+    }
+
+    if (err == NET_IF_ERR_NONE) {
+        hw_addr_cfg = DEF_YES;
+
+    } else {                                                    /* Else get  app-configured IF layer HW MAC address, ...*/
+                                                                /* ... if any (see Note #1b).                           */
+        hw_addr_len = sizeof(hw_addr);
+        NetIF_AddrHW_GetHandler(p_if->Nbr, &hw_addr[0], &hw_addr_len, &err);
+        if (err == NET_IF_ERR_NONE) {
+            hw_addr_cfg = NetIF_AddrHW_IsValidHandler(p_if->Nbr, &hw_addr[0], &err);
+        } else {
+            hw_addr_cfg = DEF_NO;
+        }
+
+        if (hw_addr_cfg != DEF_YES) {                           /* Else use hard-coded addr (see Note #1c).             */
+            hw_addr[0] = 0x02;                                  /* Locally administered unicast addr.                   */
+            hw_addr[1] = 0x50;
+            hw_addr[2] = 0xC2;
+            hw_addr[3] = 0x25;
+            hw_addr[4] = 0x60;
+            hw_addr[5] = 0x02;
+
+            NetIF_AddrHW_SetHandler(p_if->Nbr,
+                                   &hw_addr[0],
+                                    sizeof(hw_addr),
+                                    p_err);
+            if (*p_err != NET_IF_ERR_NONE) {                    /* No valid HW MAC address configured, return error.    */
+                 return;
+            }
+        }
+    }
+
+
+                                                                /* ------------------- INIT RX DESC ------------------- */
+    NetDev_RxDescInit(p_if, p_err);
+    if (*p_err != NET_DEV_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------------ START RX TASK ------------------- */
+    KAL_TaskCreate(p_dev_data->RxTaskHandle, NetDev_RxTask, p_if, NET_RX_TASK_PRIO, DEF_NULL, &kal_err);
+    if (kal_err != KAL_ERR_NONE) {
+        NetDev_RxDescFreeAll(p_if);
+       *p_err = NET_DEV_ERR_FAULT;
+        return;
+    }
+
+                                                                /* ---------------- CFG TX RDY SIGNAL ----------------- */
+    NetIF_DevCfgTxRdySignal(p_if,                               /* See Note #2.                                         */
+                            p_dev_cfg->TxDescNbr,
+                            p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+        return;
+    }
+
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NetDev_Stop()
+*
+* Description : Shutdown network interface hardware :
+*
+*                   (a) Stop the receive task
+*                   (b) Free the receive descriptors' buffers
+*
+*
+* Argument(s) : p_if    Pointer to the interface requiring service.
+*
+*               p_err   Pointer to return error code.
+*                           NET_DEV_ERR_NONE    No Error
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IF_Stop() via 'pdev_api->Stop()'.
+*
+* Note(s)     : (1) The TAP file descriptor is kept open so that the interface can be restarted; frames
+*                   queued by the host while the interface is stopped are discarded on the next start.
+*
+*               (2) Transmitted frames are released by NetDev_Tx() itself, NO transmit buffer remains to
+*                   be posted to the network interface transmit deallocation queue.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_Stop (NET_IF   *p_if,
+                           NET_ERR  *p_err)
+{
+    NET_DEV_DATA  *p_dev_data = (NET_DEV_DATA *)p_if->Dev_Data;
+    KAL_ERR        kal_err;
+
+
+    KAL_TaskDel(p_dev_data->RxTaskHandle, &kal_err);
+    KAL_SemSet(p_dev_data->RxDescFreeSignal, 0u, &kal_err);
+   (void)&kal_err;
+
+    NetDev_RxDescFreeAll(p_if);
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NetDev_Rx()
+*
+* Description : Returns a pointer to the received data to the caller.
+*                   (1) Get the next filled receive descriptor.
+*                   (2) Obtain a pointer to a Network Buffer Data Area to replace the descriptor's one.
+*                   (3) Pass a pointer to the received data area back to the caller via p_data.
+*                   (4) Give the descriptor back to the receive task.
+*
+* Argument(s) : p_if    Pointer to the interface requiring service.
+*
+*               p_data  Pointer to pointer to received data area. The received data area address
+*                       should be returned to the stack by dereferencing p_data as
+*                       *p_data = (address of receive data area).
+*
+*               size    Pointer to size. The number of bytes received should be returned
+*                       to the stack by dereferencing size as *size = (number of bytes).
+*
+*               p_err   Pointer to return error code.
+*                           NET_DEV_ERR_NONE            No Error
+*                           NET_DEV_ERR_RX              Interface stopped, NO frame available.
+*                           NET_BUF error codes         Potential NET_BUF error codes
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_RxPkt() via 'pdev_api->Rx()'.
+*
+* Note(s)     : (1) If NO buffer is available to replace the descriptor's one, the frame is discarded &
+*                   the descriptor keeps its buffer.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_Rx (NET_IF       *p_if,
+                         CPU_INT08U  **p_data,
+                         CPU_INT16U   *size,
+                         NET_ERR      *p_err)
+{
+    NET_DEV_DATA     *p_dev_data = (NET_DEV_DATA *)p_if->Dev_Data;
+    NET_DEV_RX_DESC  *p_desc;
+    CPU_INT08U       *p_buf;
+    CPU_INT16U        len;
+    KAL_ERR           kal_err;
+
+
+    p_desc = &p_dev_data->RxDescTbl[p_dev_data->RxDescIxTail];
+    if (p_desc->DataPtr == DEF_NULL) {                          /* Frame signaled before dev was stopped.               */
+       *size   = 0u;
+       *p_data = DEF_NULL;
+       *p_err  = NET_DEV_ERR_RX;
+        return;
+    }
+
+                                                                /* Request a buffer to replace desc's one.              */
+    p_buf = NetBuf_GetDataPtr(p_if,
+                              NET_TRANSACTION_RX,
+                              NET_IF_ETHER_FRAME_MAX_SIZE,
+                              NET_IF_IX_RX,
+                              DEF_NULL,
+                              DEF_NULL,
+                              DEF_NULL,
+                              p_err);
+    if (*p_err != NET_BUF_ERR_NONE) {                           /* If unable to get a buffer, discard the frame ...     */
+       *size   = 0u;                                            /* ... (see Note #1).                                   */
+       *p_data = DEF_NULL;
+        NET_CTR_STAT_INC(p_dev_data->StatRxPktDiscardedCtr);
+
+    } else {
+        len = p_desc->Len;
+        if (len < NET_IF_ETHER_FRAME_MIN_SIZE) {                /* Pad runt frames; data area is large enough.          */
+            Mem_Clr(&p_desc->DataPtr[len], NET_IF_ETHER_FRAME_MIN_SIZE - len);
+            len = NET_IF_ETHER_FRAME_MIN_SIZE;
+        }
+
+       *p_data          = p_desc->DataPtr;
+       *size            = len;
+        p_desc->DataPtr = p_buf;
+       *p_err           = NET_DEV_ERR_NONE;
+    }
+
+    p_dev_data->RxDescIxTail++;
+    if (p_dev_data->RxDescIxTail >= p_dev_data->RxDescNbr) {
+        p_dev_data->RxDescIxTail = 0u;
+    }
+                                                                /* Give desc back to rx task.                           */
+    KAL_SemPost(p_dev_data->RxDescFreeSignal, KAL_OPT_POST_NONE, &kal_err);
+   (void)&kal_err;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NetDev_Tx()
+*
+* Description : Transmit the specified data.
+*
+* Argument(s) : p_if    Pointer to the interface requiring service.
+*
+*               p_data  Pointer to data to transmit.
+*
+*               size    Size    of data to transmit.
+*
+*               p_err   Pointer to return error code.
+*                           NET_DEV_ERR_NONE        No Error
+*                           NET_DEV_ERR_TX_BUSY     Host TAP transmit queue full.
+*                           NET_ERR_TX              Frame could NOT be written to the TAP interface.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_TxPkt() via 'pdev_api->Tx()'.
+*
+* Note(s)     : (1) On error, NetIF_TxPkt() discards the transmit buffer; ONLY the transmit ready signal
+*                   consumed for this frame is returned.
+*
+*               (2) (a) The frame is written before NetDev_Tx() returns, so the transmit descriptor is
+*                       released even if the transmit buffer could NOT be posted for deallocation.  With
+*                       a single transmit descriptor (see 'NetDev_Start()  Note #2'), a lost transmit
+*                       ready signal would time out ALL further transmits.
+*
+*                   (b) A transmit buffer NOT posted for deallocation is NOT freed.  Thus the transmit
+*                       deallocation queue SHOULD hold ALL transmit buffers (see 'net_cfg.h  TASKS Q
+*                       CONFIGURATION  Note #2'); for uC/OS-III, 'OS_CFG_MSG_POOL_SIZE' SHOULD be
+*                       configured at least as large, since kernel queues share its message pool.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_Tx (NET_IF      *p_if,
+                         CPU_INT08U  *p_data,
+                         CPU_INT16U   size,
+                         NET_ERR     *p_err)
+{
+    NET_DEV_DATA  *p_dev_data = (NET_DEV_DATA *)p_if->Dev_Data;
+    ssize_t        tx_len;
+    NET_ERR        err;
+
+
+    tx_len = write(p_dev_data->Fd, p_data, size);
+    if (tx_len != (ssize_t)size) {
+        if ((tx_len < 0) &&
+           ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+           *p_err = NET_DEV_ERR_TX_BUSY;
+        } else {
+           *p_err = NET_ERR_TX;
+        }
+        NetIF_DevTxRdySignal(p_if);                             /* See Note #1.                                         */
+        return;
+    }
+
+    NetIF_TxDeallocTaskPost(p_data, &err);
+   (void)&err;                                                  /* Ignore possible dealloc err (see Note #2b).          */
+    NetIF_DevTxRdySignal(p_if);                                 /* Signal Net IF that Tx resources are available ...    */
+                                                                /* ... even on dealloc err (see Note #2a).              */
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetDev_AddrMulticastAdd()
+*
+* Description : Configure hardware address filtering to accept specified hardware address.
+*
+* Argument(s) : p_if        Pointer to an Ethernet network interface.
+*               ----        Argument validated in NetIF_AddrHW_SetHandler().
+*
+*               p_addr_hw   Pointer to hardware address.
+*               ---------   Argument checked   in NetIF_AddrHW_SetHandler().
+*
+*               addr_hw_len Length  of hardware address.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Hardware address successfully configured.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_AddrMulticastAdd() via 'pdev_api->AddrMulticastAdd()'.
+*
+* Note(s)     : (1) The TAP interface does NOT filter frames (see 'NetDev_Start()  Note #1'); multicast
+*                   frames are filtered by the stack.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_AddrMulticastAdd (NET_IF      *p_if,
+                                       CPU_INT08U  *p_addr_hw,
+                                       CPU_INT08U   addr_hw_len,
+                                       NET_ERR     *p_err)
+{
+   (void)&p_if;                                                 /* Prevent 'variable unused' compiler warnings.         */
+   (void)&p_addr_hw;
+   (void)&addr_hw_len;
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetDev_AddrMulticastRemove()
+*
+* Description : Configure hardware address filtering to reject specified hardware address.
+*
+* Argument(s) : p_if        Pointer to an Ethernet network interface.
+*               ----        Argument validated in NetIF_AddrHW_SetHandler().
+*
+*               p_addr_hw   Pointer to hardware address.
+*               ---------   Argument checked   in NetIF_AddrHW_SetHandler().
+*
+*               addr_hw_len Length  of hardware address.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Hardware address successfully removed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_AddrMulticastRemove() via 'pdev_api->AddrMulticastRemove()'.
+*
+* Note(s)     : (1) See 'NetDev_AddrMulticastAdd()  Note #1'.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_AddrMulticastRemove (NET_IF      *p_if,
+                                          CPU_INT08U  *p_addr_hw,
+                                          CPU_INT08U   addr_hw_len,
+                                          NET_ERR     *p_err)
+{
+   (void)&p_if;                                                 /* Prevent 'variable unused' compiler warnings.         */
+   (void)&p_addr_hw;
+   (void)&addr_hw_len;
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NetDev_IO_Ctrl()
+*
+* Description : Implement various hardware functions.
+*
+* Argument(s) : p_if    Pointer to interface requiring service.
+*
+*               opt     Option code representing desired function to perform. The Network Protocol Suite
+*                       specifies the option codes below. Additional option codes may be defined by the
+*                       driver developer in the driver's header file.
+*                           NET_IF_IO_CTRL_LINK_STATE_GET_INFO
+*                           NET_IF_IO_CTRL_LINK_STATE_UPDATE
+*
+*               p_data  Pointer to optional data for either sending or receiving additional function
+*                       arguments or return data.
+*
+*               p_err   Pointer to return error code.
+*                           NET_DEV_ERR_NONE                    IO Ctrl operation completed successfully.
+*                           NET_DEV_ERR_NULL_PTR                Null argument pointer passed.
+*                           NET_IF_ERR_INVALID_IO_CTRL_OPT      Invalid option number specified.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IO_CtrlHandler() via 'pdev_api->IO_Ctrl()',
+*               NetPhy_LinkStateGet()        via 'pdev_api->IO_Ctrl()'.
+*
+* Note(s)     : (1) A TAP interface has NO physical link; it is reported as always up, full-duplex.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_IO_Ctrl (NET_IF      *p_if,
+                              CPU_INT08U   opt,
+                              void        *p_data,
+                              NET_ERR     *p_err)
+{
+    NET_DEV_LINK_ETHER  *p_link_state;
+
+
+   (void)&p_if;                                                 /* Prevent 'variable unused' compiler warning.          */
+
+    switch (opt) {
+        case NET_IF_IO_CTRL_LINK_STATE_GET_INFO:
+             p_link_state = (NET_DEV_LINK_ETHER *)p_data;
+             if (p_link_state == (NET_DEV_LINK_ETHER *)0) {
+                *p_err = NET_DEV_ERR_NULL_PTR;
+                 return;
+             }
+             p_link_state->Duplex = NET_PHY_DUPLEX_FULL;        /* See Note #1.                                         */
+             p_link_state->Spd    = NET_PHY_SPD_1000;
+            *p_err = NET_DEV_ERR_NONE;
+             break;
+
+
+        case NET_IF_IO_CTRL_LINK_STATE_UPDATE:
+            *p_err = NET_DEV_ERR_NONE;
+             break;
+
+
+        default:
+            *p_err = NET_IF_ERR_INVALID_IO_CTRL_OPT;
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetDev_RxTask()
+*
+* Description : Poll the TAP interface & fill the receive descriptors (see 'net_dev_tap.c  Note #3').
+*
+* Argument(s) : p_data      Pointer to the network interface.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_Start() via KAL_TaskCreate().
+*
+* Note(s)     : (1) The receive task holds one free descriptor at a time; further descriptors for the same
+*                   batch are taken without blocking.
+*
+*               (2) Frames larger than NET_IF_ETHER_FRAME_MAX_SIZE, or truncated by read() to the receive
+*                   buffer size, are discarded; the descriptor is re-used.  Discarded frames still count
+*                   toward NET_DEV_TAP_RX_BATCH_MAX (see Note #4).
+*
+*               (3) If the network interface receive queue is full, the frame is discarded & the
+*                   descriptor is re-used.
+*
+*               (4) The receive task gives up the CPU whenever the TAP queue is drained or a full batch
+*                   has been read.  Since discarded frames do NOT consume a descriptor, a flood of
+*                   oversized frames would otherwise keep the receive task from ever yielding.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_RxTask (void  *p_data)
+{
+    NET_IF           *p_if;
+    NET_DEV_DATA     *p_dev_data;
+    NET_DEV_RX_DESC  *p_desc;
+    CPU_BOOLEAN       desc_rdy;
+    CPU_INT16U        nbr_rx;
+    ssize_t           rx_len;
+    NET_ERR           net_err;
+    KAL_ERR           kal_err;
+
+
+    p_if       = (NET_IF       *)p_data;
+    p_dev_data = (NET_DEV_DATA *)p_if->Dev_Data;
+    desc_rdy   =  DEF_NO;
+
+    while (DEF_TRUE) {
+        if (desc_rdy == DEF_NO) {                               /* Wait for a free desc (see Note #1).                  */
+            KAL_SemPend(p_dev_data->RxDescFreeSignal, KAL_OPT_PEND_BLOCKING, 0u, &kal_err);
+            if (kal_err != KAL_ERR_NONE) {
+                continue;
+            }
+            desc_rdy = DEF_YES;
+        }
+
+        nbr_rx = 0u;
+        while ((desc_rdy == DEF_YES) &&                         /* Rd a batch of frames.                                */
+               (nbr_rx   <  NET_DEV_TAP_RX_BATCH_MAX)) {
+            p_desc = &p_dev_data->RxDescTbl[p_dev_data->RxDescIxHead];
+            rx_len =  read(p_dev_data->Fd, p_desc->DataPtr, p_dev_data->RxBufSize);
+            if (rx_len <= 0) {                                  /* No more frames avail.                                */
+                break;
+            }
+            if ((rx_len >= (ssize_t)p_dev_data->RxBufSize) ||   /* See Note #2.                                         */
+                (rx_len >  (ssize_t)NET_IF_ETHER_FRAME_MAX_SIZE)) {
+                NET_CTR_STAT_INC(p_dev_data->StatRxPktDiscardedCtr);
+                nbr_rx++;                                       /* Discarded frames count toward batch lim.             */
+                continue;
+            }
+
+            p_desc->Len = (CPU_INT16U)rx_len;
+                                                                /* Give desc to NetDev_Rx() ...                         */
+            p_dev_data->RxDescIxHead++;
+            if (p_dev_data->RxDescIxHead >= p_dev_data->RxDescNbr) {
+                p_dev_data->RxDescIxHead = 0u;
+            }
+            NetIF_RxTaskSignal(p_if->Nbr, &net_err);            /* ... & signal Net IF RxQ Task of new frame.           */
+            if (net_err != NET_IF_ERR_NONE) {                   /* See Note #3.                                         */
+                if (p_dev_data->RxDescIxHead == 0u) {
+                    p_dev_data->RxDescIxHead = p_dev_data->RxDescNbr;
+                }
+                p_dev_data->RxDescIxHead--;
+                NET_CTR_STAT_INC(p_dev_data->StatRxPktDiscardedCtr);
+                break;
+            }
+            NET_CTR_STAT_INC(p_dev_data->StatRxPktCtr);
+            nbr_rx++;
+                                                                /* Take next free desc, if any.                         */
+            KAL_SemPend(p_dev_data->RxDescFreeSignal, KAL_OPT_PEND_NON_BLOCKING, 0u, &kal_err);
+            desc_rdy = (kal_err == KAL_ERR_NONE) ? DEF_YES : DEF_NO;
+        }
+
+        if (nbr_rx > 0u) {
+            NET_CTR_STAT_INC(p_dev_data->StatRxBatchCtr);
+        }
+
+        if ((desc_rdy == DEF_YES) ||                            /* If TAP queue drained or batch full, give up CPU ...  */
+            (nbr_rx   >= NET_DEV_TAP_RX_BATCH_MAX)) {           /* ... (see Note #4).                                   */
+            KAL_Dly(NET_DEV_TAP_RX_POLL_DLY_MS);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetDev_RxDescInit()
+*
+* Description : Allocate a receive buffer to each receive descriptor & reset the descriptor ring.
+*
+* Argument(s) : p_if        Pointer to the interface requiring service.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE        Receive descriptors successfully initialized.
+*
+*                                                       ------- RETURNED BY NetBuf_GetDataPtr() : -------
+*                               NET_BUF_ERR_NONE_AVAIL  NO available buffers to allocate.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_Start().
+*
+* Note(s)     : (1) Frames queued by the host since the interface was stopped are discarded.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_RxDescInit (NET_IF   *p_if,
+                                 NET_ERR  *p_err)
+{
+    NET_DEV_DATA     *p_dev_data = (NET_DEV_DATA *)p_if->Dev_Data;
+    NET_DEV_RX_DESC  *p_desc;
+    CPU_INT16U        ix;
+    KAL_ERR           kal_err;
+
+
+    for (ix = 0u; ix < p_dev_data->RxDescNbr; ix++) {
+        p_desc          = &p_dev_data->RxDescTbl[ix];
+        p_desc->Len     =  0u;
+        p_desc->DataPtr =  NetBuf_GetDataPtr(p_if,
+                                             NET_TRANSACTION_RX,
+                                             NET_IF_ETHER_FRAME_MAX_SIZE,
+                                             NET_IF_IX_RX,
+                                             DEF_NULL,
+                                             DEF_NULL,
+                                             DEF_NULL,
+                                             p_err);
+        if (*p_err != NET_BUF_ERR_NONE) {
+            NetDev_RxDescFreeAll(p_if);
+            return;
+        }
+    }
+
+    p_dev_data->RxDescIxHead = 0u;
+    p_dev_data->RxDescIxTail = 0u;
+    KAL_SemSet(p_dev_data->RxDescFreeSignal, p_dev_data->RxDescNbr, &kal_err);
+   (void)&kal_err;
+
+    if (p_dev_data->RxDescNbr > 0u) {                           /* Flush stale frames (see Note #1).                    */
+        while (read(p_dev_data->Fd, p_dev_data->RxDescTbl[0].DataPtr, p_dev_data->RxBufSize) > 0) {
+            ;
+        }
+    }
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetDev_RxDescFreeAll()
+*
+* Description : Free the receive descriptors' buffers.
+*
+* Argument(s) : p_if        Pointer to the interface requiring service.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_Start(),
+*               NetDev_Stop(),
+*               NetDev_RxDescInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_RxDescFreeAll (NET_IF  *p_if)
+{
+    NET_DEV_DATA     *p_dev_data = (NET_DEV_DATA *)p_if->Dev_Data;
+    NET_DEV_RX_DESC  *p_desc;
+    CPU_INT16U        ix;
+
+
+    for (ix = 0u; ix < p_dev_data->RxDescNbr; ix++) {
+        p_desc = &p_dev_data->RxDescTbl[ix];
+        if (p_desc->DataPtr != DEF_NULL) {
+            NetBuf_FreeBufDataAreaRx(p_if->Nbr, p_desc->DataPtr);
+            p_desc->DataPtr = DEF_NULL;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetDev_TAP_Open()
+*
+* Description : Open & attach to the TAP interface (see 'net_dev_tap.c  Note #2').
+*
+* Argument(s) : p_dev_data  Pointer to device data area.
+*
+*               tap_if_nbr  TAP interface number, or NET_DEV_TAP_IF_NBR_AUTO.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE        TAP interface successfully opened.
+*                               NET_DEV_ERR_INIT        TAP interface could NOT be opened.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_Init().
+*
+* Note(s)     : (1) The file descriptor is non-blocking; see 'net_dev_tap.c  Note #3b'.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_TAP_Open (NET_DEV_DATA  *p_dev_data,
+                               CPU_ADDR       tap_if_nbr,
+                               NET_ERR       *p_err)
+{
+    struct  ifreq  ifr;
+            int    fd;
+
+
+    fd = open(NET_DEV_TAP_DEV_NAME, O_RDWR | O_NONBLOCK);       /* See Note #1.                                         */
+    if (fd < 0) {
+        printf("\nUnable to open %s: %s\n", NET_DEV_TAP_DEV_NAME, strerror(errno));
+       *p_err = NET_DEV_ERR_INIT;
+        return;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;                        /* Raw Ethernet frames, no pkt info hdr.                */
+    if (tap_if_nbr == NET_DEV_TAP_IF_NBR_AUTO) {
+        snprintf(ifr.ifr_name, IFNAMSIZ, "%s%%d", NET_DEV_TAP_IF_NAME_PREFIX);
+    } else {
+        snprintf(ifr.ifr_name, IFNAMSIZ, "%s%u",  NET_DEV_TAP_IF_NAME_PREFIX, (unsigned int)tap_if_nbr);
+    }
+
+    if (ioctl(fd, TUNSETIFF, &ifr) < 0) {
+        printf("\nUnable to attach to TAP interface %s: %s\n", ifr.ifr_name, strerror(errno));
+        close(fd);
+       *p_err = NET_DEV_ERR_INIT;
+        return;
+    }
+
+    printf("\nUsing TAP interface %s.\n", ifr.ifr_name);
+
+    p_dev_data->Fd = fd;
+   *p_err          = NET_DEV_ERR_NONE;
+}
+
+
+#endif  /* NET_IF_ETHER_MODULE_EN */
+
@@ -0,0 +1,97 @@
+#*
+#********************************************************************************************************
+#                                            EXAMPLE CODE
+#
+#               This file is provided as an example on how to use Micrium products.
+#
+#               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+#               your application products.  Example code may be used as is, in whole or in
+#               part, or may be used as a reference only. This file can be modified as
+#               required to meet the end-product requirements.
+#
+#********************************************************************************************************
+#*
+
+
+ #!/usr/bin/env python
+
+import argparse
+import socket
+import threading
+import time
+
+# Oversized frame flood for the Linux TAP device driver (see 'net_dev_tap.c  NetDev_RxTask()').
+#
+# Floods the TAP interface with Ethernet frames larger than the target's receive buffers while
+# probing the target with TCP connection requests to a closed port.  The target answers each
+# probe with a reset as long as its receive task keeps yielding to the rest of the stack.
+#
+# Must be run as root; the TAP interface MTU must exceed the flood frame size, e.g. :
+#
+#     ip link set tap0 mtu 9000
+
+parser = argparse.ArgumentParser()
+parser.add_argument('--if',    dest='ifname', default='tap0')
+parser.add_argument('--mac',   default='00:17:4a:b0:00:65')
+parser.add_argument('--ip',    default='192.168.100.2')
+parser.add_argument('--port',  type=int,   default=9)
+parser.add_argument('--size',  type=int,   default=4000)
+parser.add_argument('--dur',   type=float, default=10.0)
+parser.add_argument('--probe', type=float, default=0.1)
+args = parser.parse_args()
+
+done  = threading.Event()
+sent  = [0]
+
+def flood():
+    sock  = socket.socket(socket.AF_PACKET, socket.SOCK_RAW)
+    sock.bind((args.ifname, 0))
+    dst   = bytes.fromhex(args.mac.replace(':', ''))
+    src   = sock.getsockname()[4]
+    frame = dst + src + b'\x08\x00' + bytes(args.size - 14)
+    while not done.is_set():
+        try:
+            sock.send(frame)
+            sent[0] += 1
+        except OSError:
+            time.sleep(0.001)
+
+
+def probe():
+    ts = time.time()
+    s  = socket.socket()
+    s.settimeout(1.0)
+    try:
+        s.connect((args.ip, args.port))
+    except ConnectionRefusedError:
+        return time.time() - ts
+    except OSError:
+        return None
+    finally:
+        s.close()
+    return time.time() - ts
+
+
+thread   = threading.Thread(target=flood)
+thread.start()
+
+rtt      = []
+lost     = 0
+ts_start = time.time()
+while (time.time() - ts_start) < args.dur:
+    r = probe()
+    if r is None:
+        lost += 1
+    else:
+        rtt.append(r)
+    time.sleep(args.probe)
+
+done.set()
+thread.join()
+dur = time.time() - ts_start
+
+print('{} frames of {} octets in {:.1f} s ({:.0f} frames/s)'.format(sent[0], args.size, dur, sent[0] / dur))
+print('probes: {} answered, {} lost'.format(len(rtt), lost))
+if rtt:
+    rtt.sort()
+    print('probe rtt: median {:.2f} ms, max {:.2f} ms'.format(rtt[len(rtt) // 2] * 1000, rtt[-1] * 1000))
@@ -0,0 +1,59 @@
+#*
+#********************************************************************************************************
+#                                            EXAMPLE CODE
+#
+#               This file is provided as an example on how to use Micrium products.
+#
+#               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+#               your application products.  Example code may be used as is, in whole or in
+#               part, or may be used as a reference only. This file can be modified as
+#               required to meet the end-product requirements.
+#
+#********************************************************************************************************
+#*
+
+
+ #!/usr/bin/env python
+
+import asyncio
+import time
+
+# TCP sink for the multi-connection throughput benchmark (see 'tcp_bench.c').
+class SinkServerProtocol(asyncio.Protocol):
+    def connection_made(self, transport):
+        self.transport = transport
+        self.peername  = transport.get_extra_info('peername')
+        self.octets    = 0
+        self.ts_start  = time.time()
+        print('Connection from {}'.format(self.peername))
+
+
+    def data_received(self, data):
+        self.octets += len(data)
+
+
+    def connection_lost(self, exc):
+        dur = time.time() - self.ts_start
+        if dur > 0:
+            kbps = (self.octets * 8) / (dur * 1000)
+        else:
+            kbps = 0
+        print('{}: {} octets in {:.3f} s ({:.0f} kbit/s)'.format(self.peername, self.octets, dur, kbps))
+
+
+loop = asyncio.get_event_loop()
+# Each client connection will create a new protocol instance
+coro = loop.create_server(SinkServerProtocol, '0.0.0.0', 10002)
+server = loop.run_until_complete(coro)
+
+# Serve requests until CTRL+c is pressed
+print('Serving on {}'.format(server.sockets[0].getsockname()))
+try:
+    loop.run_forever()
+except KeyboardInterrupt:
+    pass
+
+# Close the server
+server.close()
+loop.run_until_complete(server.wait_closed())
+loop.close()
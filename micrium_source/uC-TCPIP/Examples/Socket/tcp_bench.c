@@ -0,0 +1,377 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                               EXAMPLE
+*
+*                                 MULTI-CONNECTION TCP THROUGHPUT BENCHMARK
+*
+* Filename : tcp_bench.c
+* Version  : V3.06.01
+*********************************************************************************************************
+* Note(s)  : (1) This example streams data on several TCP connections concurrently, one task per
+*                connection, to a host sink (see 'Script/tcp_sink.py') & reports the aggregate
+*                throughput.
+*
+*            (2) Contention on the global network lock is reported if NET_CTR_CFG_LOCK_STAT_EN is
+*                enabled.  Run the benchmark with NET_TCP_CFG_TX_COPY_UNLOCK_EN disabled & enabled
+*                to compare the time the lock is held during application data transmits.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <Source/net_cfg_net.h>
+#include  <Source/net.h>
+#include  <Source/net_sock.h>
+#include  <Source/net_app.h>
+#include  <Source/net_util.h>
+#include  <Source/net_ascii.h>
+#include  <KAL/kal.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  TCP_BENCH_SERVER_PORT                10002
+#define  TCP_BENCH_CONN_NBR_MAX                   8u
+#define  TCP_BENCH_TX_BUF_SIZE                 1460u
+#define  TCP_BENCH_TASK_STK_SIZE               2048u
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  app_tcp_bench_result {
+    CPU_INT32U      ConnNbr;                                    /* Nbr of conns that completed the benchmark.           */
+    CPU_INT32U      Dur_ms;                                     /* Benchmark duration (in ms).                          */
+    CPU_INT64U      OctetsTot;                                  /* Aggregate nbr of octets tx'd on all conns.           */
+    CPU_INT32U      Throughput_kbps;                            /* Aggregate throughput (in kbit/s).                    */
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+    NET_LOCK_STAT   LockStat;                                   /* Global net lock stats during benchmark.              */
+#endif
+} APP_TCP_BENCH_RESULT;
+
+
+typedef  struct  app_tcp_bench_conn {
+    NET_SOCK_ADDR             ServerSockAddr;                   /* Sink server sock addr.                               */
+    NET_SOCK_PROTOCOL_FAMILY  ProtocolFamily;                   /* Sock protocol family.                                */
+    NET_TS_MS                 Dur_ms;                           /* Streaming duration (in ms).                          */
+    CPU_INT32U                Octets;                           /* Nbr of octets tx'd on conn.                          */
+    CPU_BOOLEAN               Ok;                               /* Indicate conn streamed w/o err.                      */
+    KAL_SEM_HANDLE            DoneSem;                          /* Signal benchmark when streaming done.                */
+} APP_TCP_BENCH_CONN;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  APP_TCP_BENCH_CONN  App_TCP_BenchConnTbl[TCP_BENCH_CONN_NBR_MAX];
+static  CPU_INT08U          App_TCP_BenchTxBuf[TCP_BENCH_TX_BUF_SIZE];
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  App_TCP_BenchTask (void  *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                           App_TCP_Bench()
+*
+* Description : Multi-connection TCP throughput benchmark :
+*
+*                   (a) Convert the server's IP address.
+*                   (b) Create one transmit task per connection.
+*                   (c) Wait until every task has streamed data for the requested duration.
+*                   (d) Report the aggregate throughput & global network lock statistics.
+*
+* Argument(s) : p_ip_addr   Pointer to a string that contains the IP address of the sink server.
+*
+*               conn_nbr    Number of concurrent TCP connections (see 'TCP_BENCH_CONN_NBR_MAX').
+*
+*               dur_ms      Duration of the benchmark (in milliseconds).
+*
+*               prio        Priority of the transmit tasks.
+*
+*               p_result    Pointer to variable that will receive the benchmark results.
+*
+* Return(s)   : DEF_OK,   Benchmark completed on all connections.
+*
+*               DEF_FAIL, Otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Transmit tasks are allocated from the KAL heap & are NOT deleted; each task idles once
+*                   its connection is closed.  The benchmark is intended to be run once per boot.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  App_TCP_Bench (CPU_CHAR              *p_ip_addr,
+                            CPU_INT32U             conn_nbr,
+                            CPU_INT32U             dur_ms,
+                            CPU_INT08U             prio,
+                            APP_TCP_BENCH_RESULT  *p_result)
+{
+#if   defined(NET_IPv6_MODULE_EN)
+    NET_IPv6_ADDR             server_addr;
+#elif defined(NET_IPv4_MODULE_EN)
+    NET_IPv4_ADDR             server_addr;
+#endif
+    NET_IP_ADDR_FAMILY        ip_family;
+    NET_SOCK_PROTOCOL_FAMILY  protocol_family;
+    NET_SOCK_ADDR_FAMILY      sock_addr_family;
+    NET_IP_ADDR_LEN           ip_addr_len;
+    APP_TCP_BENCH_CONN       *p_conn;
+    KAL_SEM_HANDLE            done_sem;
+    KAL_TASK_HANDLE           task_handle;
+    NET_TS_MS                 ts_start;
+    NET_TS_MS                 ts_end;
+    CPU_INT32U                ix;
+    CPU_INT32U                task_nbr;
+    CPU_BOOLEAN               ok;
+    RTOS_ERR                  kal_err;
+    NET_ERR                   err;
+
+
+    if ((conn_nbr < 1u)                     ||
+        (conn_nbr > TCP_BENCH_CONN_NBR_MAX) ||
+        (p_result == DEF_NULL)) {
+        return (DEF_FAIL);
+    }
+
+                                                                /* ---------------- CONVERT IP ADDRESS ---------------- */
+    ip_family = NetASCII_Str_to_IP(p_ip_addr,
+                                  &server_addr,
+                                   sizeof(server_addr),
+                                  &err);
+    if (err != NET_ASCII_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    switch (ip_family) {
+        case NET_IP_ADDR_FAMILY_IPv4:
+             sock_addr_family = NET_SOCK_ADDR_FAMILY_IP_V4;
+             protocol_family  = NET_SOCK_PROTOCOL_FAMILY_IP_V4;
+             ip_addr_len      = NET_IPv4_ADDR_SIZE;
+             break;
+
+        case NET_IP_ADDR_FAMILY_IPv6:
+             sock_addr_family = NET_SOCK_ADDR_FAMILY_IP_V6;
+             protocol_family  = NET_SOCK_PROTOCOL_FAMILY_IP_V6;
+             ip_addr_len      = NET_IPv6_ADDR_SIZE;
+             break;
+
+        case NET_IP_ADDR_FAMILY_UNKNOWN:
+        default:
+             return (DEF_FAIL);
+    }
+
+    done_sem = KAL_SemCreate("TCP Bench Done", DEF_NULL, &kal_err);
+    if (kal_err != KAL_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    Mem_Set(App_TCP_BenchTxBuf, 0xA5u, sizeof(App_TCP_BenchTxBuf));
+
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+    Net_GlobalLockStatReset(&err);
+#endif
+
+                                                                /* -------------- CREATE TX TASK PER CONN ------------- */
+    ts_start = NetUtil_TS_Get_ms();
+    task_nbr = 0u;
+    for (ix = 0u; ix < conn_nbr; ix++) {
+        p_conn                 = &App_TCP_BenchConnTbl[ix];
+        p_conn->ProtocolFamily =  protocol_family;
+        p_conn->Dur_ms         =  dur_ms;
+        p_conn->Octets         =  0u;
+        p_conn->Ok             =  DEF_NO;
+        p_conn->DoneSem        =  done_sem;
+
+        NetApp_SetSockAddr(        &p_conn->ServerSockAddr,
+                                    sock_addr_family,
+                                    TCP_BENCH_SERVER_PORT,
+                           (void *)&server_addr,
+                                    ip_addr_len,
+                                   &err);
+        if (err != NET_APP_ERR_NONE) {
+            break;
+        }
+
+        task_handle = KAL_TaskAlloc("TCP Bench Tx", DEF_NULL, TCP_BENCH_TASK_STK_SIZE, DEF_NULL, &kal_err);
+        if (kal_err != KAL_ERR_NONE) {
+            break;
+        }
+
+        KAL_TaskCreate(task_handle, App_TCP_BenchTask, (void *)p_conn, prio, DEF_NULL, &kal_err);
+        if (kal_err != KAL_ERR_NONE) {
+            break;
+        }
+
+        task_nbr++;
+    }
+
+                                                                /* -------------- WAIT ON ALL TX TASKS ---------------- */
+    for (ix = 0u; ix < task_nbr; ix++) {
+        KAL_SemPend(done_sem, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &kal_err);
+    }
+    ts_end = NetUtil_TS_Get_ms();
+
+
+                                                                /* ------------------ REPORT RESULTS ------------------ */
+    ok                   = (task_nbr == conn_nbr) ? DEF_OK : DEF_FAIL;
+    p_result->ConnNbr    = 0u;
+    p_result->OctetsTot  = 0u;
+    p_result->Dur_ms     = (CPU_INT32U)(ts_end - ts_start);
+    for (ix = 0u; ix < task_nbr; ix++) {
+        p_conn = &App_TCP_BenchConnTbl[ix];
+        if (p_conn->Ok == DEF_YES) {
+            p_result->ConnNbr++;
+        } else {
+            ok = DEF_FAIL;
+        }
+        p_result->OctetsTot += p_conn->Octets;
+    }
+
+    if (p_result->Dur_ms > 0u) {
+        p_result->Throughput_kbps = (CPU_INT32U)((p_result->OctetsTot * DEF_OCTET_NBR_BITS) / p_result->Dur_ms);
+    } else {
+        p_result->Throughput_kbps = 0u;
+    }
+
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+    Net_GlobalLockStatGet(&p_result->LockStat, &err);
+#endif
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_TCP_BenchTask()
+*
+* Description : Stream data on one TCP connection for the benchmark duration :
+*
+*                   (a) Open & connect a socket.
+*                   (b) Transmit data to the sink server until the duration elapses.
+*                   (c) Close socket & signal the benchmark.
+*
+* Argument(s) : p_arg       Pointer to the benchmark connection (see 'APP_TCP_BENCH_CONN').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_TCP_Bench().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_TCP_BenchTask (void  *p_arg)
+{
+    APP_TCP_BENCH_CONN  *p_conn;
+    NET_SOCK_ID          sock;
+    NET_SOCK_RTN_CODE    tx_size;
+    NET_TS_MS            ts_start;
+    CPU_BOOLEAN          done;
+    RTOS_ERR             kal_err;
+    NET_ERR              err;
+
+
+    p_conn = (APP_TCP_BENCH_CONN *)p_arg;
+
+                                                                /* ------------ OPEN & CONNECT SOCKET ----------------- */
+    sock = NetSock_Open(p_conn->ProtocolFamily,
+                        NET_SOCK_TYPE_STREAM,
+                        NET_SOCK_PROTOCOL_TCP,
+                       &err);
+    if (err == NET_SOCK_ERR_NONE) {
+        NetSock_Conn(sock, &p_conn->ServerSockAddr, sizeof(p_conn->ServerSockAddr), &err);
+        if (err != NET_SOCK_ERR_NONE) {
+            NetSock_Close(sock, &err);
+            err = NET_SOCK_ERR_CONN_FAIL;
+        }
+    }
+
+                                                                /* ------------------ STREAM DATA --------------------- */
+    if (err == NET_SOCK_ERR_NONE) {
+        ts_start   = NetUtil_TS_Get_ms();
+        p_conn->Ok = DEF_YES;
+        done       = DEF_NO;
+        while (done == DEF_NO) {
+            tx_size = NetSock_TxData(sock,
+                                     App_TCP_BenchTxBuf,
+                                     sizeof(App_TCP_BenchTxBuf),
+                                     NET_SOCK_FLAG_NONE,
+                                    &err);
+            switch (err) {
+                case NET_SOCK_ERR_NONE:
+                     p_conn->Octets += (CPU_INT32U)tx_size;
+                     break;
+
+                case NET_ERR_FAULT_LOCK_ACQUIRE:
+                case NET_ERR_TX:
+                     NetApp_TimeDly_ms(1, &err);
+                     break;
+
+                default:
+                     p_conn->Ok = DEF_NO;
+                     done       = DEF_YES;
+                     break;
+            }
+
+            if ((NetUtil_TS_Get_ms() - ts_start) >= p_conn->Dur_ms) {
+                done = DEF_YES;
+            }
+        }
+
+        NetSock_Close(sock, &err);
+    }
+
+    KAL_SemPost(p_conn->DoneSem, KAL_OPT_POST_NONE, &kal_err);
+
+    while (DEF_ON) {                                            /* Idle (see 'App_TCP_Bench()  Note #1').               */
+        NetApp_TimeDly_ms(1000, &err);
+    }
+}
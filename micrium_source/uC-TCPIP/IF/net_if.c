@@ -120,6 +120,18 @@
 #define  NET_IF_TX_SUSPEND_TIMEOUT_MAX_MS                100
 
 
+#ifdef  NET_IF_RX_GRO_MODULE_EN                                 /* ---------------- RX SEG COALESCING ----------------- */
+#define  NET_IF_RX_GRO_FRAME_TYPE_IX                      12u   /* Ix of Ether frame type.                              */
+#define  NET_IF_RX_GRO_FRAME_TYPE_IPv4               0x0800u
+#define  NET_IF_RX_GRO_ADDR_HW_GRP_BIT                 0x01u   /* Ether dest addr multicast/broadcast bit.             */
+#define  NET_IF_RX_GRO_IPv4_VER_HDR_LEN                0x45u   /* IPv4 ver 4 & hdr len w/o opts.                       */
+
+#define  NET_IF_RX_GRO_IP_HDR_IX                         NET_IF_HDR_SIZE_ETHER
+#define  NET_IF_RX_GRO_TCP_HDR_IX                       (NET_IF_HDR_SIZE_ETHER + NET_IPv4_HDR_SIZE_MIN)
+#define  NET_IF_RX_GRO_FRAME_SIZE_MIN                   (NET_IF_RX_GRO_TCP_HDR_IX + NET_TCP_HDR_SIZE_MIN)
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -137,6 +149,28 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                            NETWORK INTERFACE RECEIVE SEGMENT DATA TYPE
+*
+* Note(s) : (1) Describes a received Ethernet frame's IPv4/TCP segment for coalescing (see 'NetIF_RxGRO()').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+typedef  struct  net_if_rx_gro_seg {
+    CPU_INT08U    *FramePtr;                                    /* Ptr to rx'd frame.                                   */
+    NET_IPv4_HDR  *IP_HdrPtr;                                   /* Ptr to rx'd IPv4 hdr.                                */
+    NET_TCP_HDR   *TCP_HdrPtr;                                  /* Ptr to rx'd TCP  hdr.                                */
+    CPU_INT16U     TCP_HdrIx;                                   /* TCP seg hdr  ix  (in DATA area).                     */
+    CPU_INT16U     TCP_HdrLen;                                  /* TCP seg hdr  len (in octets   ).                     */
+    CPU_INT16U     TCP_TotLen;                                  /* TCP seg tot  len (in octets   ).                     */
+    CPU_INT16U     DataLen;                                     /* TCP seg data len (in octets   ).                     */
+    CPU_INT32U     SeqNbr;                                      /* TCP seg seq  nbr.                                    */
+    CPU_BOOLEAN    Push;                                        /* Indicates TCP seg PSH flag set.                      */
+} NET_IF_RX_GRO_SEG;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -220,7 +254,8 @@ static  void           NetIF_RxTask                     (       void
 
 static  void           NetIF_RxTaskHandler              (       void);
 
-static  NET_IF_NBR     NetIF_RxTaskWait                 (       NET_ERR            *p_err);
+static  NET_IF_NBR     NetIF_RxTaskWait                 (       CPU_BOOLEAN         wait,
+                                                                 NET_ERR            *p_err);
 
 static  void           NetIF_RxHandler                  (       NET_IF_NBR          if_nbr);
 
@@ -232,6 +267,24 @@ static  void           NetIF_RxHandlerLoadBal           (       NET_IF
 static  NET_BUF_SIZE   NetIF_RxPkt                      (       NET_IF             *p_if,
                                                                 NET_ERR            *p_err);
 
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+static  CPU_BOOLEAN    NetIF_RxGRO                      (       NET_IF             *p_if,
+                                                                NET_BUF            *p_buf);
+
+static  void           NetIF_RxGRO_Flush                (       NET_IF             *p_if);
+
+static  void           NetIF_RxGRO_FlushAll             (       void);
+
+static  CPU_BOOLEAN    NetIF_RxGRO_SegParse             (       NET_BUF            *p_buf,
+                                                                NET_IF_RX_GRO_SEG  *p_seg);
+
+static  CPU_BOOLEAN    NetIF_RxGRO_SegMatch             (       NET_IF             *p_if,
+                                                                NET_IF_RX_GRO_SEG  *p_seg);
+
+static  CPU_BOOLEAN    NetIF_RxGRO_SegChkSumVerify      (       NET_BUF            *p_buf,
+                                                                NET_IF_RX_GRO_SEG  *p_seg);
+#endif
+
 #ifdef  NET_LOAD_BAL_MODULE_EN
 static  void           NetIF_RxPktDec                   (       NET_IF             *p_if);
 #endif
@@ -467,6 +520,19 @@ void  NetIF_Init (const  NET_TASK_CFG  *p_rx_task_cfg,
         }
 #endif
 
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+        p_if->RxGRO_BufHeadPtr  = DEF_NULL;
+        p_if->RxGRO_BufTailPtr  = DEF_NULL;
+        p_if->RxGRO_SeqNbrNext  = 0u;
+        p_if->RxGRO_TCP_TotLen  = 0u;
+        p_if->RxGRO_SegCnt      = 0u;
+        p_if->RxGRO_ChkSumValid = DEF_NO;
+#endif
+
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+        p_if->TxTSO_HW          = DEF_NO;
+#endif
+
         p_if++;
     }
                                                                         /* Init base/next IF nbrs (see Note #3).        */
@@ -1224,6 +1290,10 @@ exit_release:
 *
 *                   (a) Specific network interface that do not require link state MUST set the network
 *                       interface's link state to 'UP'.
+*
+*               (5) Each started Ethernet device is queried whether it calculates the IPv4 & TCP checksums of
+*                   transmitted segments (see 'NetIF_TxSeg()  Note #3').  Devices that do NOT support the
+*                   NET_IF_IO_CTRL_TX_TSO_GET I/O control option are assumed NOT to.
 *********************************************************************************************************
 */
 
@@ -1235,6 +1305,10 @@ void  NetIF_Start (NET_IF_NBR   if_nbr,
 #ifdef  NET_MLDP_MODULE_EN
     NET_IPv6_ADDR  addr_allnode_mcast;
 #endif
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+    CPU_BOOLEAN      tso_hw;
+    NET_ERR          err;
+#endif
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -1295,6 +1369,17 @@ void  NetIF_Start (NET_IF_NBR   if_nbr,
 
     p_if->En = DEF_ENABLED;                                     /* En IF AFTER IF/dev start.                            */
 
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+    p_if->TxTSO_HW = DEF_NO;
+    if (p_if->Type == NET_IF_TYPE_ETHER) {                      /* Get dev tx seg chk sum support (see Note #5).        */
+        tso_hw = DEF_NO;
+        NetIF_IO_CtrlHandler(if_nbr, NET_IF_IO_CTRL_TX_TSO_GET, &tso_hw, &err);
+        if (err == NET_IF_ERR_NONE) {
+            p_if->TxTSO_HW = (tso_hw == DEF_YES) ? DEF_YES : DEF_NO;
+        }
+    }
+#endif
+
 #ifdef   NET_MLDP_MODULE_EN
     if (p_if->Type != NET_IF_TYPE_LOOPBACK) {
         NetIPv6_AddrMcastAllNodesSet(&addr_allnode_mcast,       /* Create all-node mcast addr.                          */
@@ -5238,6 +5323,248 @@ void  NetIF_Tx (NET_BUF  *p_buf_list,
 }
 
 
+/*
+*********************************************************************************************************
+*                                            NetIF_TxSeg()
+*
+* Description : (1) Transmit a TCP data segment by replicating the headers of a previously transmitted segment
+*                   of the same connection :
+*
+*                   (a) Validate header template                                    See Note #2
+*                   (b) Replicate template's Ethernet, IPv4 & TCP headers
+*                   (c) Update   segment's IPv4 total length, identification & checksum
+*                   (d) Update   segment's TCP  sequence number, flags & checksum
+*                   (e) Transmit segment via network device driver
+*                   (f) Update   transmit statistics
+*
+*
+* Argument(s) : p_buf_tmpl  Pointer to network buffer of the previously transmitted segment (see Note #2).
+*               ----------  Argument validated in NetTCP_TxConnTxQ().
+*
+*               p_buf       Pointer to network buffer of the segment to transmit.
+*               -----       Argument validated in NetTCP_TxConnTxQ().
+*
+*               seq_nbr     Segment's TCP sequence number.
+*
+*               flags_tcp   Segment's TCP header flags.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IF_ERR_NONE                 Segment successfully transmitted.
+*                               NET_IF_ERR_TX_SEG_TMPL          Header template NOT available; segment NOT
+*                                                                   transmitted & NOT freed (see Note #2b).
+*                               NET_ERR_TX                      Network interface/device transmit error;
+*                                                                   segment discarded.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnTxQ().
+*
+*               This function is a network protocol suite to network interface (IF) function & SHOULD be
+*               called only by appropriate network interface function(s).
+*
+* Note(s)     : (1) Consecutive data segments transmitted from a TCP connection's transmit queue differ ONLY
+*                   in their IPv4 total length, identification & checksum and in their TCP sequence number,
+*                   flags & checksum.  Thus the per-segment TCP & IPv4 header preparation, IPv4 route
+*                   selection & interface hardware address resolution are performed ONCE for the first
+*                   segment & its headers replicated for the following segments.
+*
+*               (2) (a) The header template MUST have been transmitted by the network device & its buffer
+*                       still referenced by the TCP connection; i.e. its headers still valid (see 'NetIF_TxPkt()
+*                       Note #5').
+*
+*                   (b) If the header template is NOT valid, or the segment requires Ethernet padding or a
+*                       different header layout, the segment is NOT modified so that it may be transmitted
+*                       via the TCP/IPv4 transmit handlers.
+*
+*               (3) If the network device calculates the IPv4 & TCP checksums of transmitted segments (see
+*                   'NetIF_Start()  Note #5'), the replicated segments' checksum fields are cleared.  The
+*                   TCP checksum otherwise re-uses the segment's cached data checksum (see 'net_buf.c
+*                   NetBuf_DataWrSumV()').
+*
+*               (4) On ANY error(s) after the segment is modified, the segment is discarded; the TCP connection
+*                   retransmits the segment with fully prepared headers.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+void  NetIF_TxSeg (NET_BUF     *p_buf_tmpl,
+                   NET_BUF     *p_buf,
+                   CPU_INT32U   seq_nbr,
+                   CPU_INT16U   flags_tcp,
+                   NET_ERR     *p_err)
+{
+    NET_BUF_HDR         *p_buf_hdr_tmpl;
+    NET_BUF_HDR         *p_buf_hdr;
+    NET_IF              *p_if;
+    NET_DEV_API         *p_dev_api;
+    NET_IPv4_HDR        *p_ip_hdr;
+    NET_TCP_HDR         *p_tcp_hdr;
+    CPU_INT08U          *p_data;
+    NET_BUF_SIZE         hdr_len;
+    NET_BUF_SIZE         size;
+    CPU_INT16U           ip_id;
+    CPU_INT16U           tcp_hdr_len_flags;
+    NET_CHK_SUM          chk_sum;
+#ifndef  NET_TCP_CHK_SUM_OFFLOAD_TX
+    NET_TCP_PSEUDO_HDR   tcp_pseudo_hdr;
+#endif
+    NET_ERR              err;
+
+
+    p_buf_hdr_tmpl = &p_buf_tmpl->Hdr;
+    p_buf_hdr      = &p_buf->Hdr;
+
+                                                                /* ---------------- VALIDATE HDR TMPL ----------------- */
+    if (DEF_BIT_IS_CLR(p_buf_hdr_tmpl->Flags, NET_BUF_FLAG_TX_HDR_VALID)) {
+       *p_err = NET_IF_ERR_TX_SEG_TMPL;                         /* See Note #2a.                                        */
+        return;
+    }
+
+    if (p_buf_hdr->DataIx != p_buf_hdr_tmpl->DataIx) {          /* Chk seg hdr layout (see Note #2b).                   */
+       *p_err = NET_IF_ERR_TX_SEG_TMPL;
+        return;
+    }
+
+    hdr_len = (NET_BUF_SIZE)(p_buf_hdr_tmpl->DataIx - p_buf_hdr_tmpl->IF_HdrIx);
+    size    =  hdr_len + p_buf_hdr->DataLen;
+    if (size < NET_IF_802x_FRAME_MIN_SIZE) {                    /* Chk seg frame padding (see Note #2b).                */
+       *p_err = NET_IF_ERR_TX_SEG_TMPL;
+        return;
+    }
+
+    p_if = NetIF_Get(p_buf_hdr_tmpl->IF_NbrTx, &err);
+    if (err != NET_IF_ERR_NONE) {
+       *p_err = NET_IF_ERR_TX_SEG_TMPL;
+        return;
+    }
+    if ((p_if->Type != NET_IF_TYPE_ETHER) ||                    /* Tx via Ether IF ...                                  */
+        (p_if->Link != NET_IF_LINK_UP)) {                       /* ... with link up ONLY.                               */
+       *p_err = NET_IF_ERR_TX_SEG_TMPL;
+        return;
+    }
+
+
+                                                                /* ------------------ REPLICATE HDRS ------------------ */
+    Mem_Copy(&p_buf->DataPtr[p_buf_hdr_tmpl->IF_HdrIx],
+             &p_buf_tmpl->DataPtr[p_buf_hdr_tmpl->IF_HdrIx],
+              hdr_len);
+
+    p_buf_hdr->IF_NbrTx                 =  p_buf_hdr_tmpl->IF_NbrTx;
+    p_buf_hdr->IF_HdrIx                 =  p_buf_hdr_tmpl->IF_HdrIx;
+    p_buf_hdr->IF_HdrLen                =  p_buf_hdr_tmpl->IF_HdrLen;
+    p_buf_hdr->IP_HdrIx                 =  p_buf_hdr_tmpl->IP_HdrIx;
+    p_buf_hdr->IP_HdrLen                =  p_buf_hdr_tmpl->IP_HdrLen;
+    p_buf_hdr->TransportHdrIx           =  p_buf_hdr_tmpl->TransportHdrIx;
+    p_buf_hdr->TransportHdrLen          =  p_buf_hdr_tmpl->TransportHdrLen;
+
+    p_buf_hdr->TransportDataLen         = (CPU_INT16U  ) p_buf_hdr->DataLen;
+    p_buf_hdr->TransportTotLen          = (CPU_INT16U  )(p_buf_hdr->TransportHdrLen + p_buf_hdr->DataLen);
+    p_buf_hdr->IP_TotLen                = (CPU_INT16U  )(p_buf_hdr->IP_HdrLen       + p_buf_hdr->TransportTotLen);
+    p_buf_hdr->IP_DataLen               =  p_buf_hdr->IP_TotLen;
+    p_buf_hdr->IP_DatagramLen           =  p_buf_hdr->IP_TotLen;
+    p_buf_hdr->TotLen                   =  size;
+
+
+                                                                /* ------------------ UPDATE IPv4 HDR ----------------- */
+    p_ip_hdr = (NET_IPv4_HDR *)&p_buf->DataPtr[p_buf_hdr->IP_HdrIx];
+    NET_UTIL_VAL_COPY_SET_NET_16(&p_ip_hdr->TotLen, &p_buf_hdr->IP_TotLen);
+    ip_id    =  NetIPv4_TxID_Get();
+    NET_UTIL_VAL_COPY_SET_NET_16(&p_ip_hdr->ID, &ip_id);
+
+    NET_UTIL_VAL_SET_NET_16(&p_ip_hdr->ChkSum, 0x0000u);
+    chk_sum = 0u;
+#ifndef  NET_IPV4_CHK_SUM_OFFLOAD_TX
+    if (p_if->TxTSO_HW != DEF_YES) {                            /* See Note #3.                                         */
+        chk_sum = NetUtil_16BitOnesCplChkSumHdrCalc((void     *)p_ip_hdr,
+                                                    (CPU_INT16U)p_buf_hdr->IP_HdrLen,
+                                                    (NET_ERR  *)&err);
+        if (err != NET_UTIL_ERR_NONE) {
+            NetIF_TxPktDiscard(p_buf, DEF_YES, &err);           /* See Note #4.                                         */
+           *p_err = NET_ERR_TX;
+            return;
+        }
+    }
+#endif
+    NET_UTIL_VAL_COPY_16(&p_ip_hdr->ChkSum, &chk_sum);
+
+
+                                                                /* ------------------ UPDATE TCP HDR ------------------ */
+    p_tcp_hdr = (NET_TCP_HDR *)&p_buf->DataPtr[p_buf_hdr->TransportHdrIx];
+    NET_UTIL_VAL_COPY_SET_NET_32(&p_tcp_hdr->SeqNbr, &seq_nbr);
+
+    tcp_hdr_len_flags  = NET_UTIL_VAL_GET_NET_16(&p_tcp_hdr->HdrLen_Flags);
+    tcp_hdr_len_flags &= NET_TCP_HDR_LEN_MASK;
+    tcp_hdr_len_flags |= flags_tcp & NET_TCP_HDR_FLAG_MASK;
+    NET_UTIL_VAL_COPY_SET_NET_16(&p_tcp_hdr->HdrLen_Flags, &tcp_hdr_len_flags);
+
+    NET_UTIL_VAL_SET_NET_16(&p_tcp_hdr->ChkSum, 0x0000u);
+    chk_sum = 0u;
+#ifndef  NET_TCP_CHK_SUM_OFFLOAD_TX
+    if (p_if->TxTSO_HW != DEF_YES) {                            /* See Note #3.                                         */
+        tcp_pseudo_hdr.AddrSrc     = (NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(p_buf_hdr->IP_AddrSrc);
+        tcp_pseudo_hdr.AddrDest    = (NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(p_buf_hdr->IP_AddrDest);
+        tcp_pseudo_hdr.Zero        =  0x00u;
+        tcp_pseudo_hdr.Protocol    =  NET_IP_HDR_PROTOCOL_TCP;
+        tcp_pseudo_hdr.TotLen      =  NET_UTIL_HOST_TO_NET_16(p_buf_hdr->TransportTotLen);
+
+        p_buf_hdr->ProtocolHdrType =  NET_PROTOCOL_TYPE_TCP_V4;
+        chk_sum                    =  NetUtil_16BitOnesCplChkSumDataCalc((void *) p_buf,
+                                                                         (void *)&tcp_pseudo_hdr,
+                                                                                  NET_TCP_PSEUDO_HDR_SIZE,
+                                                                                 &err);
+        if (err != NET_UTIL_ERR_NONE) {
+            NetIF_TxPktDiscard(p_buf, DEF_YES, &err);           /* See Note #4.                                         */
+           *p_err = NET_ERR_TX;
+            return;
+        }
+    }
+#endif
+    NET_UTIL_VAL_COPY_16(&p_tcp_hdr->ChkSum, &chk_sum);
+
+    p_buf_hdr->ProtocolHdrType          =  p_buf_hdr_tmpl->ProtocolHdrType;
+    p_buf_hdr->ProtocolHdrTypeIF        =  p_buf_hdr_tmpl->ProtocolHdrTypeIF;
+    p_buf_hdr->ProtocolHdrTypeNet       =  p_buf_hdr_tmpl->ProtocolHdrTypeNet;
+    p_buf_hdr->ProtocolHdrTypeTransport =  p_buf_hdr_tmpl->ProtocolHdrTypeTransport;
+
+
+                                                                /* ------------- WAIT FOR DEV TX RDY SIGNAL ----------- */
+    NetIF_DevTxRdyWait(p_if, &err);
+    if (err != NET_IF_ERR_NONE) {
+        NetIF_TxPktDiscard(p_buf, DEF_YES, &err);               /* See Note #4.                                         */
+       *p_err = NET_ERR_TX;
+        return;
+    }
+
+                                                                /* ------------------ TX SEG VIA DEV ------------------ */
+    p_data = &p_buf->DataPtr[p_buf_hdr->IF_HdrIx];
+    DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_TX_LOCK);        /* Protect tx pkt buf from concurrent access by dev hw. */
+    NetIF_TxPktListInsert(p_buf);
+
+    p_dev_api = (NET_DEV_API *)p_if->Dev_API;
+    p_dev_api->Tx(p_if, p_data, size, &err);
+    if (err != NET_DEV_ERR_NONE) {
+        NetIF_TxPktListRemove(p_buf);
+        NetIF_TxPktDiscard(p_buf, DEF_YES, &err);               /* See Note #4.                                         */
+       *p_err = NET_ERR_TX;
+        return;
+    }
+
+    DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_TX_HDR_VALID);
+
+
+                                                                /* ----------------- UPDATE TX STATS ------------------ */
+    NET_CTR_STAT_INC(Net_StatCtrs.IFs.TxPktCtr);
+    NET_CTR_STAT_INC(Net_StatCtrs.IFs.IF[p_buf_hdr->IF_Nbr].TxNbrPktCtr);
+    NET_CTR_STAT_INC(Net_StatCtrs.IFs.IF[p_buf_hdr->IF_Nbr].TxNbrPktCtrProcessed);
+    NET_CTR_STAT_INC(Net_StatCtrs.IFs.IF[p_buf_hdr->IF_Nbr].TxTSO_SegCtr);
+    NET_CTR_STAT_ADD(Net_StatCtrs.IFs.IF[p_buf_hdr->IF_Nbr].TxNbrOctets, size);
+
+   *p_err = NET_IF_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          NetIF_TxIxDataGet()
@@ -6200,7 +6527,7 @@ static  void  NetIF_RxTask (void  *p_data)
 *
 *                   (a) Wait for packet receive signal from network interface(s)/device(s)
 *                   (b) Acquire  network  lock                                              See Note #3
-*                   (c) Handle   received packet
+*                   (c) Handle   received packet(s)                                         See Note #4
 *                   (d) Release  network  lock
 *
 *
@@ -6217,12 +6544,27 @@ static  void  NetIF_RxTask (void  *p_data)
 *
 *               (3) NetIF_RxTaskHandler() blocks ALL other network protocol tasks by pending on & acquiring
 *                   the global network lock (see 'net.h  Note #3').
+*
+*               (4) (a) To amortize the cost of acquiring & releasing the global network lock, up to
+*                       NET_IF_CFG_RX_BATCH_MAX received packets are handled per lock acquisition.  Any
+*                       packets queued after the first are retrieved WITHOUT waiting on the receive queue;
+*                       the batch ends early when the receive queue is empty.
+*
+*                   (b) The global network lock is released after every batch, even if more packets are
+*                       queued.  Thus, tasks waiting on the global network lock (e.g. application socket
+*                       calls) are delayed by at most NET_IF_CFG_RX_BATCH_MAX received packets.
+*
+*                   See also 'net_if.h  NETWORK INTERFACE RECEIVE BATCH DEFAULT CONFIGURATION  Note #1'.
+*
+*               (5) Received TCP segments held for coalescing are handled before the global network lock
+*                   is released; i.e. segments are coalesced ONLY within a batch (see 'NetIF_RxGRO()').
 *********************************************************************************************************
 */
 
 static  void  NetIF_RxTaskHandler (void)
 {
     NET_IF_NBR  if_nbr;
+    CPU_INT16U  rx_batch_cnt;
     NET_ERR     err;
 
 
@@ -6237,7 +6579,7 @@ static  void  NetIF_RxTaskHandler (void)
     while (DEF_ON) {
                                                                 /* ------------------ WAIT FOR RX PKT ----------------- */
         do {
-            if_nbr = NetIF_RxTaskWait(&err);
+            if_nbr = NetIF_RxTaskWait(DEF_YES, &err);
         } while (err != NET_IF_ERR_NONE);
 
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
@@ -6247,8 +6589,21 @@ static  void  NetIF_RxTaskHandler (void)
             continue;
         }
 
-                                                                /* ------------------ HANDLE RX PKT ------------------- */
-        NetIF_RxHandler(if_nbr);
+                                                                /* ------------------ HANDLE RX PKTS ------------------ */
+        NET_CTR_STAT_INC(Net_StatCtrs.IFs.RxBatchCtr);
+        rx_batch_cnt = 0u;
+        do {
+            NetIF_RxHandler(if_nbr);
+            rx_batch_cnt++;
+            if (rx_batch_cnt >= NET_IF_CFG_RX_BATCH_MAX) {      /* Limit batch size (see Note #4b).                     */
+                break;
+            }
+            if_nbr = NetIF_RxTaskWait(DEF_NO, &err);            /* Get next queued rx pkt, if any (see Note #4a).       */
+        } while (err == NET_IF_ERR_NONE);
+
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+        NetIF_RxGRO_FlushAll();                                 /* Handle held rx'd segs (see Note #5).                 */
+#endif
 
                                                                 /* ----------------- RELEASE NET LOCK ----------------- */
         Net_GlobalLockRelease();
@@ -6262,7 +6617,14 @@ static  void  NetIF_RxTaskHandler (void)
 *
 * Description : Wait on network interface receive queue for receive signal.
 *
-* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+* Argument(s) : wait        Indicate whether to wait on an empty receive queue :
+*
+*                               DEF_YES                         Wait on receive queue until signaled
+*                                                                   (see Note #1a).
+*                               DEF_NO                          Return immediately if receive queue empty
+*                                                                   (see Note #1c).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_IF_ERR_NONE                 Network interface receive queue signal
 *                                                                   successfully  received.
@@ -6285,22 +6647,29 @@ static  void  NetIF_RxTaskHandler (void)
 *                   (b) If timeout      desired, return NET_IF_ERR_RX_Q_EMPTY error on receive queue
 *                       timeout.  Implement timeout with OS-dependent functionality.
 *
+*                   (c) If NOT waiting, return NET_IF_ERR_RX_Q_EMPTY error if receive queue empty (see
+*                       'NetIF_RxTaskHandler()  Note #4a').
+*
 *               (2) Encoding/decoding the network interface number does NOT require any message size.
 *
 *                   See also 'NetIF_RxTaskSignal()  Note #2'.
 *********************************************************************************************************
 */
 
-static  NET_IF_NBR  NetIF_RxTaskWait (NET_ERR  *p_err)
+static  NET_IF_NBR  NetIF_RxTaskWait (CPU_BOOLEAN   wait,
+                                      NET_ERR      *p_err)
 {
     void         *p_rx_q;
     CPU_ADDR      if_nbr_msg;
     NET_IF_NBR    if_nbr;
+    KAL_OPT       opt;
     KAL_ERR       err_kal;
 
+
+    opt = (wait == DEF_YES) ? KAL_OPT_PEND_NONE : KAL_OPT_PEND_NON_BLOCKING;
                                                                 /* Wait on network interface receive task queue ...     */
                                                                 /* ... preferably without timeout (see Note #1a).       */
-    p_rx_q = KAL_QPend(NetIF_RxQ_Handle, KAL_OPT_PEND_NONE, 0, &err_kal);
+    p_rx_q = KAL_QPend(NetIF_RxQ_Handle, opt, 0, &err_kal);
     switch (err_kal) {
         case KAL_ERR_NONE:
              if_nbr_msg = (CPU_ADDR  )p_rx_q;
@@ -6310,14 +6679,14 @@ static  NET_IF_NBR  NetIF_RxTaskWait (NET_ERR  *p_err)
 
 
         case KAL_ERR_TIMEOUT:
+        case KAL_ERR_WOULD_BLOCK:
              if_nbr = NET_IF_NBR_NONE;
-            *p_err   = NET_IF_ERR_RX_Q_EMPTY;                    /* See Note #1b.                                        */
+            *p_err   = NET_IF_ERR_RX_Q_EMPTY;                    /* See Notes #1b & #1c.                                 */
              break;
 
 
         case KAL_ERR_ISR:
         case KAL_ERR_ABORT:
-        case KAL_ERR_WOULD_BLOCK:
         case KAL_ERR_OS:
         default:
              if_nbr = NET_IF_NBR_NONE;
@@ -6557,6 +6926,9 @@ static  void  NetIF_RxHandlerLoadBal (NET_IF  *p_if)
 *                   reference to the buffer.
 *
 *               (4) Network buffer already freed by higher layer.
+*
+*               (5) Received TCP segments MAY be held for coalescing & demultiplexed later in the receive
+*                   batch (see 'NetIF_RxGRO()  Note #4').
 *********************************************************************************************************
 */
 
@@ -6571,6 +6943,9 @@ static  NET_BUF_SIZE  NetIF_RxPkt (NET_IF   *p_if,
     NET_BUF_SIZE   size;
     NET_BUF_SIZE   ix_rx;
     NET_BUF_SIZE   ix_offset;
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+    CPU_BOOLEAN    held;
+#endif
     NET_ERR        err;
 
                                                                     /* --------------- RX PKT FROM DEV ---------------- */
@@ -6640,6 +7015,16 @@ static  NET_BUF_SIZE  NetIF_RxPkt (NET_IF   *p_if,
     }
 #endif
 
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+    if (p_if->Type == NET_IF_TYPE_ETHER) {                          /* Coalesce rx'd TCP segs (see Note #5).            */
+        held = NetIF_RxGRO(p_if, p_buf);
+        if (held == DEF_YES) {
+           *p_err = NET_IF_ERR_NONE;
+            return (size);
+        }
+    }
+#endif
+
 
     p_if_api->Rx(p_if, p_buf, p_err);                                   /* Demux rx pkt to appropriate net IF rx handler.   */
     if (*p_err != NET_IF_ERR_NONE) {
@@ -6655,6 +7040,534 @@ static  NET_BUF_SIZE  NetIF_RxPkt (NET_IF   *p_if,
 }
 
 
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+/*
+*********************************************************************************************************
+*                                            NetIF_RxGRO()
+*
+* Description : Coalesce received TCP segment with previously received, held TCP segments.
+*
+* Argument(s) : p_if        Pointer to network interface that received the packet.
+*               ----        Argument validated in NetIF_RxPkt().
+*
+*               p_buf       Pointer to network buffer that received the packet.
+*               -----       Argument checked   in NetIF_RxPkt().
+*
+* Return(s)   : DEF_YES, if packet held for coalescing (see Note #4).
+*
+*               DEF_NO,  otherwise; packet MUST be demultiplexed by caller.
+*
+* Caller(s)   : NetIF_RxPkt().
+*
+* Note(s)     : (1) Consecutive, in-order IPv4/TCP data segments of the same connection received on an
+*                   Ethernet interface are linked into a single network buffer chain & demultiplexed as
+*                   a single, larger TCP segment.  Thus, the IPv4 & TCP receive paths, connection lookup,
+*                   & acknowledgement processing are executed once per chain instead of once per segment.
+*
+*                   (a) The coalesced chain re-uses the representation of reassembled IP fragments : the
+*                       head buffer holds the complete frame of the first segment; each subsequent buffer
+*                       indexes ONLY its TCP segment data.
+*
+*                   (b) ONLY segments with NO IP options & ONLY the ACK &/or PSH TCP flags set are
+*                       coalesced; any other segment flushes held segments before it is demultiplexed.
+*
+*               (2) Segments are coalesced ONLY if ALL of the following fields match those of the held
+*                   segments :
+*
+*                   (a) Ethernet header;
+*                   (b) IPv4 TOS, TTL, source & destination addresses;
+*                   (c) TCP ports, acknowledgement number, window size, header length & options.
+*
+*                   Further, the segment's sequence number MUST immediately follow the held segments' data.
+*
+*               (3) Each segment's IPv4 header & TCP segment checksums are validated BEFORE the segment is
+*                   coalesced; a segment with an invalid checksum is NOT coalesced but flushes held segments
+*                   & is demultiplexed normally so that checksum errors are counted by the IPv4 & TCP layers.
+*
+*                   The head segment's checksums are validated ONLY once a subsequent segment matches it.
+*
+*               (4) Held segments are demultiplexed when :
+*
+*                   (a) A segment with the PSH flag set is coalesced;
+*                   (b) NET_IF_CFG_RX_GRO_SEG_MAX segments are coalesced;
+*                   (c) A received packet does NOT match the held segments; or
+*                   (d) The current receive batch ends (see 'NetIF_RxTaskHandler()  Note #5').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetIF_RxGRO (NET_IF   *p_if,
+                                  NET_BUF  *p_buf)
+{
+    NET_IF_RX_GRO_SEG   seg;
+    NET_BUF            *p_buf_head;
+    NET_BUF_HDR        *p_buf_hdr;
+    NET_BUF_HDR        *p_buf_tail_hdr;
+    CPU_BOOLEAN         valid;
+    CPU_BOOLEAN         match;
+
+
+    valid      = NetIF_RxGRO_SegParse(p_buf, &seg);
+    p_buf_head = p_if->RxGRO_BufHeadPtr;
+
+    if ((valid      == DEF_YES) &&                              /* If seg valid & segs held, ...                        */
+        (p_buf_head != DEF_NULL)) {
+        match = NetIF_RxGRO_SegMatch(p_if, &seg);               /* ... chk seg matches held segs (see Note #2).         */
+
+        if ((match                   == DEF_YES) &&             /* Validate held head seg's chk sums (see Note #3).     */
+            (p_if->RxGRO_ChkSumValid == DEF_NO)) {
+            match = NetIF_RxGRO_SegChkSumVerify(p_buf_head, DEF_NULL);
+            if (match == DEF_YES) {
+                p_if->RxGRO_ChkSumValid = DEF_YES;
+            }
+        }
+
+        if (match == DEF_YES) {                                 /* Validate seg's chk sums.                             */
+            match = NetIF_RxGRO_SegChkSumVerify(p_buf, &seg);
+        }
+
+        if (match == DEF_YES) {                                 /* ----------- COALESCE SEG (see Note #1) ------------ */
+            p_buf_hdr                   = &p_buf->Hdr;
+            p_buf_hdr->TransportHdrIx   = seg.TCP_HdrIx + seg.TCP_HdrLen;
+            p_buf_hdr->TransportHdrLen  = 0u;
+            p_buf_hdr->DataLen          = (NET_BUF_SIZE)seg.DataLen;
+            p_buf_hdr->ProtocolHdrType  = NET_PROTOCOL_TYPE_TCP_V4;
+
+            p_buf_tail_hdr              = &p_if->RxGRO_BufTailPtr->Hdr;
+            p_buf_tail_hdr->NextBufPtr  = p_buf;
+            p_buf_hdr->PrevBufPtr       = p_if->RxGRO_BufTailPtr;
+
+            p_if->RxGRO_BufTailPtr      = p_buf;
+            p_if->RxGRO_SeqNbrNext     += seg.DataLen;
+            p_if->RxGRO_TCP_TotLen     += seg.DataLen;
+            p_if->RxGRO_SegCnt++;
+
+            if ((seg.Push          == DEF_YES) ||               /* Flush coalesced segs (see Note #4).                  */
+                (p_if->RxGRO_SegCnt >= NET_IF_CFG_RX_GRO_SEG_MAX)) {
+                NetIF_RxGRO_Flush(p_if);
+            }
+
+            return (DEF_YES);
+        }
+    }
+
+    if (p_buf_head != DEF_NULL) {                               /* Flush held segs (see Note #4c).                      */
+        NetIF_RxGRO_Flush(p_if);
+    }
+
+    if ((valid    != DEF_YES) ||                                /* If seg NOT valid or PSH set, demux seg.              */
+        (seg.Push == DEF_YES)) {
+        return (DEF_NO);
+    }
+
+                                                                /* ---------------- HOLD SEG AS NEW HEAD -------------- */
+    p_if->RxGRO_BufHeadPtr  = p_buf;
+    p_if->RxGRO_BufTailPtr  = p_buf;
+    p_if->RxGRO_SeqNbrNext  = seg.SeqNbr + seg.DataLen;
+    p_if->RxGRO_TCP_TotLen  = seg.TCP_TotLen;
+    p_if->RxGRO_SegCnt      = 1u;
+    p_if->RxGRO_ChkSumValid = DEF_NO;
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetIF_RxGRO_Flush()
+*
+* Description : Demultiplex a network interface's held, coalesced TCP segments.
+*
+* Argument(s) : p_if        Pointer to network interface.
+*               ----        Argument validated in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_RxGRO(),
+*               NetIF_RxGRO_FlushAll().
+*
+* Note(s)     : (1) If more than one segment is coalesced, the coalesced TCP segments' total length is
+*                   stored as the head buffer's total IP fragment size & the buffer is flagged as coalesced
+*                   so that the IPv4 layer sets the datagram length accordingly (see 'net_ipv4.c
+*                   NetIPv4_Rx()  Note #4c').
+*
+*               (2) Network buffer(s) already freed by higher layer(s) on any error(s).
+*********************************************************************************************************
+*/
+
+static  void  NetIF_RxGRO_Flush (NET_IF  *p_if)
+{
+    NET_IF_API   *p_if_api;
+    NET_BUF      *p_buf;
+    NET_BUF_HDR  *p_buf_hdr;
+    NET_ERR       err;
+
+
+    p_buf = p_if->RxGRO_BufHeadPtr;
+    if (p_buf == DEF_NULL) {
+        return;
+    }
+
+    if (p_if->RxGRO_SegCnt > 1u) {                              /* If segs coalesced, set coalesced len (see Note #1).  */
+        p_buf_hdr                 = &p_buf->Hdr;
+        p_buf_hdr->IP_FragSizeTot =  p_if->RxGRO_TCP_TotLen;
+        DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_RX_GRO);
+
+        NET_CTR_STAT_INC(Net_StatCtrs.IFs.IF[p_if->Nbr].RxGRO_PktCtr);
+        NET_CTR_STAT_ADD(Net_StatCtrs.IFs.IF[p_if->Nbr].RxGRO_SegCtr, p_if->RxGRO_SegCnt);
+    }
+
+    p_if->RxGRO_BufHeadPtr  = DEF_NULL;
+    p_if->RxGRO_BufTailPtr  = DEF_NULL;
+    p_if->RxGRO_SeqNbrNext  = 0u;
+    p_if->RxGRO_TCP_TotLen  = 0u;
+    p_if->RxGRO_SegCnt      = 0u;
+    p_if->RxGRO_ChkSumValid = DEF_NO;
+
+    p_if_api = (NET_IF_API *)p_if->IF_API;
+    p_if_api->Rx(p_if, p_buf, &err);                            /* Demux coalesced segs (see Note #2).                  */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIF_RxGRO_FlushAll()
+*
+* Description : Demultiplex ALL network interfaces' held, coalesced TCP segments.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_RxTaskHandler().
+*
+* Note(s)     : (1) Global network lock MUST be acquired by caller.
+*********************************************************************************************************
+*/
+
+static  void  NetIF_RxGRO_FlushAll (void)
+{
+    NET_IF      *p_if;
+    NET_IF_NBR   if_nbr;
+
+
+    for (if_nbr = NetIF_NbrBase; if_nbr < NetIF_NbrNext; if_nbr++) {
+        p_if = &NetIF_Tbl[if_nbr];
+        if (p_if->RxGRO_BufHeadPtr != DEF_NULL) {
+            NetIF_RxGRO_Flush(p_if);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIF_RxGRO_SegParse()
+*
+* Description : Parse a received Ethernet frame's IPv4/TCP segment for coalescing.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received the packet.
+*               -----       Argument checked   in NetIF_RxPkt().
+*
+*               p_seg       Pointer to variable that will receive the parsed segment.
+*               -----       Argument validated in NetIF_RxGRO().
+*
+* Return(s)   : DEF_YES, if received packet is a TCP data segment that may be coalesced (see Note #1).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIF_RxGRO().
+*
+* Note(s)     : (1) ONLY unicast, unfragmented IPv4 packets with NO IP options, carrying a TCP segment
+*                   with data & with ONLY the ACK &/or PSH flags set may be coalesced (see 'NetIF_RxGRO()
+*                   Note #1b').  Packets are NOT otherwise validated; any invalid packet is NOT coalesced
+*                   & is validated by the Ethernet, IPv4, & TCP layers.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetIF_RxGRO_SegParse (NET_BUF            *p_buf,
+                                           NET_IF_RX_GRO_SEG  *p_seg)
+{
+    NET_BUF_HDR   *p_buf_hdr;
+    CPU_INT08U    *p_frame;
+    NET_IPv4_HDR  *p_ip_hdr;
+    NET_TCP_HDR   *p_tcp_hdr;
+    CPU_INT16U     frame_type;
+    CPU_INT16U     ip_tot_len;
+    CPU_INT16U     ip_flags;
+    CPU_INT16U     tcp_hdr_len_flags;
+    CPU_INT16U     tcp_hdr_len;
+    CPU_INT16U     tcp_flags;
+
+
+    p_seg->Push = DEF_NO;
+    p_buf_hdr   = &p_buf->Hdr;
+    if (p_buf_hdr->DataLen < NET_IF_RX_GRO_FRAME_SIZE_MIN) {
+        return (DEF_NO);
+    }
+
+    p_frame = &p_buf->DataPtr[p_buf_hdr->IF_HdrIx];
+                                                                /* ----------------- PARSE ETHER HDR ------------------ */
+    if (DEF_BIT_IS_SET(p_frame[0], NET_IF_RX_GRO_ADDR_HW_GRP_BIT) == DEF_YES) {
+        return (DEF_NO);                                        /* Multicast/broadcast frames NOT coalesced.            */
+    }
+    frame_type = NET_UTIL_VAL_GET_NET_16(&p_frame[NET_IF_RX_GRO_FRAME_TYPE_IX]);
+    if (frame_type != NET_IF_RX_GRO_FRAME_TYPE_IPv4) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------ PARSE IPv4 HDR ------------------ */
+    p_ip_hdr = (NET_IPv4_HDR *)&p_frame[NET_IF_RX_GRO_IP_HDR_IX];
+    if (p_ip_hdr->Ver_HdrLen != NET_IF_RX_GRO_IPv4_VER_HDR_LEN) {
+        return (DEF_NO);                                        /* IP opts NOT coalesced (see Note #1).                 */
+    }
+    if (p_ip_hdr->Protocol != NET_IP_HDR_PROTOCOL_TCP) {
+        return (DEF_NO);
+    }
+    ip_flags = NET_UTIL_VAL_GET_NET_16(&p_ip_hdr->Flags_FragOffset);
+    if ((ip_flags & (NET_IPv4_HDR_FLAG_FRAG_MORE | NET_IPv4_HDR_FRAG_OFFSET_MASK)) != 0u) {
+        return (DEF_NO);                                        /* Frags NOT coalesced.                                 */
+    }
+    ip_tot_len = NET_UTIL_VAL_GET_NET_16(&p_ip_hdr->TotLen);
+    if ((ip_tot_len < (NET_IPv4_HDR_SIZE_MIN + NET_TCP_HDR_SIZE_MIN)) ||
+        (ip_tot_len > (p_buf_hdr->DataLen - NET_IF_HDR_SIZE_ETHER))) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------ PARSE TCP HDR ------------------- */
+    p_tcp_hdr         = (NET_TCP_HDR *)&p_frame[NET_IF_RX_GRO_TCP_HDR_IX];
+    tcp_hdr_len_flags =  NET_UTIL_VAL_GET_NET_16(&p_tcp_hdr->HdrLen_Flags);
+    tcp_hdr_len       = (tcp_hdr_len_flags & NET_TCP_HDR_LEN_MASK) >> NET_TCP_HDR_LEN_SHIFT;
+    tcp_hdr_len      *=  NET_TCP_HDR_LEN_WORD_SIZE;
+    tcp_flags         =  tcp_hdr_len_flags & NET_TCP_HDR_FLAG_MASK;
+
+    if ((tcp_hdr_len <  NET_TCP_HDR_SIZE_MIN) ||                /* Segs w/o data NOT coalesced.                         */
+        (tcp_hdr_len >= (ip_tot_len - NET_IPv4_HDR_SIZE_MIN))) {
+        return (DEF_NO);
+    }
+    if ((tcp_flags != NET_TCP_HDR_FLAG_ACK) &&                  /* Segs w/ flags other than ACK/PSH NOT coalesced.      */
+        (tcp_flags != (NET_TCP_HDR_FLAG_ACK | NET_TCP_HDR_FLAG_PUSH))) {
+        return (DEF_NO);
+    }
+
+    p_seg->FramePtr   =  p_frame;
+    p_seg->IP_HdrPtr  =  p_ip_hdr;
+    p_seg->TCP_HdrPtr =  p_tcp_hdr;
+    p_seg->TCP_HdrIx  = (CPU_INT16U)(p_buf_hdr->IF_HdrIx + NET_IF_RX_GRO_TCP_HDR_IX);
+    p_seg->TCP_HdrLen =  tcp_hdr_len;
+    p_seg->TCP_TotLen =  ip_tot_len - NET_IPv4_HDR_SIZE_MIN;
+    p_seg->DataLen    =  p_seg->TCP_TotLen - tcp_hdr_len;
+    p_seg->SeqNbr     =  NET_UTIL_VAL_GET_NET_32(&p_tcp_hdr->SeqNbr);
+    p_seg->Push       =  DEF_BIT_IS_SET(tcp_flags, NET_TCP_HDR_FLAG_PUSH);
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIF_RxGRO_SegMatch()
+*
+* Description : Check whether a received TCP segment may be coalesced with held TCP segments.
+*
+* Argument(s) : p_if        Pointer to network interface.
+*               ----        Argument validated in NetIF_RxPkt().
+*
+*               p_seg       Pointer to parsed segment.
+*               -----       Argument validated in NetIF_RxGRO().
+*
+* Return(s)   : DEF_YES, if segment matches held segments (see 'NetIF_RxGRO()  Note #2').
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIF_RxGRO().
+*
+* Note(s)     : (1) ONLY the last coalesced segment may have the PSH flag set (see 'NetIF_RxGRO()  Note #4a').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetIF_RxGRO_SegMatch (NET_IF             *p_if,
+                                           NET_IF_RX_GRO_SEG  *p_seg)
+{
+    NET_BUF        *p_buf_head;
+    CPU_INT08U     *p_frame_head;
+    NET_IPv4_HDR   *p_ip_hdr_head;
+    NET_TCP_HDR    *p_tcp_hdr_head;
+    CPU_INT32U      tot_len;
+    CPU_INT16U      hdr_len_flags;
+    CPU_INT16U      hdr_len_flags_head;
+    CPU_BOOLEAN     match;
+
+
+    if (p_if->RxGRO_SegCnt >= NET_IF_CFG_RX_GRO_SEG_MAX) {
+        return (DEF_NO);
+    }
+    if (p_seg->SeqNbr != p_if->RxGRO_SeqNbrNext) {              /* Out-of-order segs NOT coalesced.                     */
+        return (DEF_NO);
+    }
+    tot_len = (CPU_INT32U)p_if->RxGRO_TCP_TotLen + (CPU_INT32U)p_seg->DataLen;
+    if (tot_len > NET_TCP_TOT_LEN_MAX) {
+        return (DEF_NO);
+    }
+
+    p_buf_head     =  p_if->RxGRO_BufHeadPtr;
+    p_frame_head   = &p_buf_head->DataPtr[p_buf_head->Hdr.IF_HdrIx];
+    p_ip_hdr_head  = (NET_IPv4_HDR *)&p_frame_head[NET_IF_RX_GRO_IP_HDR_IX];
+    p_tcp_hdr_head = (NET_TCP_HDR  *)&p_frame_head[NET_IF_RX_GRO_TCP_HDR_IX];
+
+                                                                /* ------------------ CMP ETHER HDRS ------------------ */
+    match = Mem_Cmp(p_seg->FramePtr, p_frame_head, NET_IF_HDR_SIZE_ETHER);
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------ CMP IPv4 HDRS ------------------- */
+    if ((p_seg->IP_HdrPtr->TOS != p_ip_hdr_head->TOS) ||
+        (p_seg->IP_HdrPtr->TTL != p_ip_hdr_head->TTL)) {
+        return (DEF_NO);
+    }
+    match = Mem_Cmp(&p_seg->IP_HdrPtr->AddrSrc,
+                    &p_ip_hdr_head->AddrSrc,
+                     sizeof(NET_IPv4_ADDR) * 2u);               /* Cmp src & dest addrs.                                */
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------- CMP TCP HDRS ------------------- */
+    match = Mem_Cmp(&p_seg->TCP_HdrPtr->PortSrc,                /* Cmp ports.                                           */
+                    &p_tcp_hdr_head->PortSrc,
+                     sizeof(NET_TCP_PORT_NBR) * 2u);
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+    match = Mem_Cmp(&p_seg->TCP_HdrPtr->AckNbr,                 /* Cmp ack nbr.                                         */
+                    &p_tcp_hdr_head->AckNbr,
+                     sizeof(NET_TCP_SEQ_NBR));
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+    match = Mem_Cmp(&p_seg->TCP_HdrPtr->WinSize,                /* Cmp win size.                                        */
+                    &p_tcp_hdr_head->WinSize,
+                     sizeof(CPU_INT16U));
+    if (match != DEF_YES) {
+        return (DEF_NO);
+    }
+                                                                /* Cmp hdr len & flags, except PSH (see Note #1).       */
+    hdr_len_flags      = NET_UTIL_VAL_GET_NET_16(&p_seg->TCP_HdrPtr->HdrLen_Flags);
+    hdr_len_flags_head = NET_UTIL_VAL_GET_NET_16(&p_tcp_hdr_head->HdrLen_Flags);
+    DEF_BIT_CLR(hdr_len_flags,      (CPU_INT16U)NET_TCP_HDR_FLAG_PUSH);
+    DEF_BIT_CLR(hdr_len_flags_head, (CPU_INT16U)NET_TCP_HDR_FLAG_PUSH);
+    if (hdr_len_flags != hdr_len_flags_head) {
+        return (DEF_NO);
+    }
+    if (p_seg->TCP_HdrLen > NET_TCP_HDR_SIZE_MIN) {             /* Cmp opts.                                            */
+        match = Mem_Cmp(&p_seg->TCP_HdrPtr->Opts[0],
+                        &p_tcp_hdr_head->Opts[0],
+                        (CPU_SIZE_T)(p_seg->TCP_HdrLen - NET_TCP_HDR_SIZE_MIN));
+        if (match != DEF_YES) {
+            return (DEF_NO);
+        }
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetIF_RxGRO_SegChkSumVerify()
+*
+* Description : Validate a received TCP segment's IPv4 header & TCP segment checksums.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received the segment.
+*               -----       Argument checked   in NetIF_RxPkt().
+*
+*               p_seg       Pointer to parsed segment, if available;
+*                           DEF_NULL, to parse the segment (see Note #2).
+*
+* Return(s)   : DEF_YES, if checksums valid.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetIF_RxGRO().
+*
+* Note(s)     : (1) The network buffer's protocol index & lengths are temporarily configured for the TCP
+*                   segment checksum calculation (see 'net_util.c  NetUtil_16BitOnesCplSumDataCalc()
+*                   Note #3a') & restored after validation.
+*
+*               (2) Held head segments are re-parsed since ONLY each segment's buffer is held.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetIF_RxGRO_SegChkSumVerify (NET_BUF            *p_buf,
+                                                  NET_IF_RX_GRO_SEG  *p_seg)
+{
+    NET_IF_RX_GRO_SEG    seg;
+    CPU_BOOLEAN          valid;
+#ifndef  NET_TCP_CHK_SUM_OFFLOAD_RX
+    NET_BUF_HDR         *p_buf_hdr;
+    NET_BUF_SIZE         data_len;
+    NET_TCP_PSEUDO_HDR   tcp_pseudo_hdr;
+#endif
+#if    (!defined(NET_IPV4_CHK_SUM_OFFLOAD_RX) || \
+        !defined(NET_TCP_CHK_SUM_OFFLOAD_RX))
+    NET_ERR              err;
+#endif
+
+
+    if (p_seg == DEF_NULL) {                                    /* Re-parse held seg (see Note #2).                     */
+        valid = NetIF_RxGRO_SegParse(p_buf, &seg);
+        if (valid != DEF_YES) {
+            return (DEF_NO);
+        }
+        p_seg = &seg;
+    }
+
+                                                                /* --------------- VALIDATE IPv4 CHK SUM -------------- */
+#ifdef  NET_IPV4_CHK_SUM_OFFLOAD_RX
+    valid = DEF_OK;
+#else
+    valid = NetUtil_16BitOnesCplChkSumHdrVerify((void     *)p_seg->IP_HdrPtr,
+                                                (CPU_INT16U)NET_IPv4_HDR_SIZE_MIN,
+                                                (NET_ERR  *)&err);
+#endif
+    if (valid != DEF_OK) {
+        return (DEF_NO);
+    }
+
+                                                                /* --------------- VALIDATE TCP CHK SUM --------------- */
+#ifndef  NET_TCP_CHK_SUM_OFFLOAD_RX
+    NET_UTIL_VAL_COPY_32(&tcp_pseudo_hdr.AddrSrc,  &p_seg->IP_HdrPtr->AddrSrc);
+    NET_UTIL_VAL_COPY_32(&tcp_pseudo_hdr.AddrDest, &p_seg->IP_HdrPtr->AddrDest);
+    tcp_pseudo_hdr.Zero     = 0x00u;
+    tcp_pseudo_hdr.Protocol = NET_IP_HDR_PROTOCOL_TCP;
+    tcp_pseudo_hdr.TotLen   = NET_UTIL_HOST_TO_NET_16(p_seg->TCP_TotLen);
+
+    p_buf_hdr                  = &p_buf->Hdr;                   /* Cfg buf for TCP chk sum (see Note #1).               */
+    data_len                   =  p_buf_hdr->DataLen;
+    p_buf_hdr->ProtocolHdrType =  NET_PROTOCOL_TYPE_TCP_V4;
+    p_buf_hdr->TransportHdrIx  =  p_seg->TCP_HdrIx;
+    p_buf_hdr->TransportHdrLen =  p_seg->TCP_HdrLen;
+    p_buf_hdr->DataLen         = (NET_BUF_SIZE)p_seg->DataLen;
+
+    valid = NetUtil_16BitOnesCplChkSumDataVerify((void     *) p_buf,
+                                                 (void     *)&tcp_pseudo_hdr,
+                                                 (CPU_INT16U) NET_TCP_PSEUDO_HDR_SIZE,
+                                                 (NET_ERR  *)&err);
+
+    p_buf_hdr->ProtocolHdrType =  NET_PROTOCOL_TYPE_IF;         /* Restore buf (see Note #1).                           */
+    p_buf_hdr->TransportHdrIx  =  NET_BUF_IX_NONE;
+    p_buf_hdr->TransportHdrLen =  0u;
+    p_buf_hdr->DataLen         =  data_len;
+    if (valid != DEF_OK) {
+        return (DEF_NO);
+    }
+#endif
+
+    return (DEF_YES);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           NetIF_RxPktDec()
@@ -7246,6 +8159,10 @@ static  void  NetIF_TxHandler (NET_BUF  *p_buf,
 *               (3) Network buffer already freed by lower layer.
 *
 *               (4) Error codes from network interface/device driver handler functions returned as is.
+*
+*               (5) A packet's headers are marked valid for replication ONLY after the packet is transmitted
+*                   by the network device; packets queued pending hardware address resolution are NOT
+*                   marked (see 'NetIF_TxSeg()  Note #2a').
 *********************************************************************************************************
 */
 
@@ -7264,6 +8181,9 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
 
                                                                 /* ---------------- VALIDATE IF TX PKT ---------------- */
     p_buf_hdr = &p_buf->Hdr;
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+    DEF_BIT_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_TX_HDR_VALID);   /* See Note #5.                                         */
+#endif
 #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
     NetIF_TxPktValidate(p_if,
@@ -7341,6 +8261,10 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
          return (0u);
     }
 
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+    DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_TX_HDR_VALID);   /* See Note #5.                                         */
+#endif
+
 
                                                                 /* ---------------- RTN TX'D DATA SIZE ---------------- */
    *p_err =  NET_IF_ERR_NONE;
@@ -8624,6 +9548,8 @@ exit:
 *                               NET_IF_IO_CTRL_LINK_STATE_GET_INFO  Get    device's detailed physical link state
 *                                                                       information.
 *                               NET_IF_IO_CTRL_LINK_STATE_UPDATE    Update device's current  physical link state.
+*                               NET_IF_IO_CTRL_TX_TSO_GET           Get    device's transmit segment checksum
+*                                                                       support.
 *
 *               p_data      Pointer to variable that will receive possible I/O control data (see Note #3).
 *
@@ -8646,7 +9572,8 @@ exit:
 * Return(s)   : none.
 *
 * Caller(s)   : NetIF_IO_Ctrl(),
-*               NetIF_PhyLinkStateHandler().
+*               NetIF_PhyLinkStateHandler(),
+*               NetIF_Start().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #1].
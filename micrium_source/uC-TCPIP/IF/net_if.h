@@ -87,6 +87,115 @@
 #define  NET_IF_PERF_MON_TIME_MAX_MS                   60000
 #define  NET_IF_PERF_MON_TIME_DFLT_MS                    250
 
+#define  NET_IF_RX_BATCH_MAX_MIN                           1u
+#define  NET_IF_RX_BATCH_MAX_MAX             DEF_INT_16U_MAX_VAL
+
+#define  NET_IF_RX_GRO_SEG_MAX_MIN                         2u
+#define  NET_IF_RX_GRO_SEG_MAX_MAX                        64u
+
+#define  NET_IF_TX_TSO_SEG_MAX_MIN                         2u
+#define  NET_IF_TX_TSO_SEG_MAX_MAX                        64u
+
+
+/*
+*********************************************************************************************************
+*                        NETWORK INTERFACE RECEIVE BATCH DEFAULT CONFIGURATION
+*
+* Note(s) : (1) NET_IF_CFG_RX_BATCH_MAX configures the maximum number of received packets handled by the
+*               Network Interface Receive Task per acquisition of the global network lock.
+*
+*               (a) Defaults to 1, i.e. the global network lock is released after every received packet.
+*
+*               (b) See also 'net_if.c  NetIF_RxTaskHandler()  Note #4'.
+*
+*               (c) Packets are ONLY batched if more than one packet is queued when the Network Interface
+*                   Receive Task runs.  Thus, if a device driver signals received packets from a task of
+*                   lower priority than the Network Interface Receive Task, each signal pre-empts the
+*                   driver task & every batch holds a single packet.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_IF_CFG_RX_BATCH_MAX
+#define  NET_IF_CFG_RX_BATCH_MAX                           1u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                  NETWORK INTERFACE RECEIVE SEGMENT COALESCING (GRO) DEFAULT CONFIGURATION
+*
+* Note(s) : (1) NET_IF_CFG_RX_GRO_EN enables/disables coalescing consecutive in-order TCP segments of the
+*               same connection, received on the same Ethernet interface within one receive batch, into a
+*               single network buffer chain before IPv4 processing (see 'net_if.c  NetIF_RxGRO()  Note #1').
+*
+*               (a) Defaults to DISABLED.
+*
+*               (b) Segments are ONLY coalesced within a receive batch; thus NET_IF_CFG_RX_BATCH_MAX SHOULD
+*                   be configured greater than 1 (see 'NETWORK INTERFACE RECEIVE BATCH DEFAULT
+*                   CONFIGURATION  Note #1').
+*
+*               (c) TCP acknowledges each coalesced chain as a single segment.  Fewer acknowledgements delay
+*                   the peer's window updates; thus connections limited by the receive window MAY lose
+*                   throughput unless the socket receive queue size is increased.
+*
+*           (2) NET_IF_CFG_RX_GRO_SEG_MAX configures the maximum number of TCP segments coalesced into a
+*               single network buffer chain.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_IF_CFG_RX_GRO_EN
+#define  NET_IF_CFG_RX_GRO_EN                   DEF_DISABLED
+#endif
+
+#ifndef  NET_IF_CFG_RX_GRO_SEG_MAX
+#define  NET_IF_CFG_RX_GRO_SEG_MAX                         8u
+#endif
+
+
+#if    ((NET_IF_CFG_RX_GRO_EN == DEF_ENABLED) && \
+        (defined(NET_IF_ETHER_MODULE_EN))    && \
+        (defined(NET_IPv4_MODULE_EN))        && \
+        (defined(NET_TCP_MODULE_EN)))
+#define  NET_IF_RX_GRO_MODULE_EN
+#endif
+
+
+/*
+*********************************************************************************************************
+*                 NETWORK INTERFACE TRANSMIT SEGMENT REPLICATION (TSO) DEFAULT CONFIGURATION
+*
+* Note(s) : (1) NET_IF_CFG_TX_TSO_EN enables/disables replicating the Ethernet, IPv4 & TCP headers of a
+*               transmitted TCP data segment onto the consecutive data segments that follow it on the same
+*               connection, bypassing the per-segment TCP, IPv4 & interface transmit preparation (see
+*               'net_if.c  NetIF_TxSeg()  Note #1').
+*
+*               (a) Defaults to DISABLED.
+*
+*               (b) A network device MAY indicate that it calculates transmit segments' IPv4 & TCP checksums
+*                   via the NET_IF_IO_CTRL_TX_TSO_GET I/O control option (see 'net_if.c  NetIF_Start()
+*                   Note #5').
+*
+*           (2) NET_IF_CFG_TX_TSO_SEG_MAX configures the maximum number of TCP segments transmitted from a
+*               single header template.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_IF_CFG_TX_TSO_EN
+#define  NET_IF_CFG_TX_TSO_EN                   DEF_DISABLED
+#endif
+
+#ifndef  NET_IF_CFG_TX_TSO_SEG_MAX
+#define  NET_IF_CFG_TX_TSO_SEG_MAX                        16u
+#endif
+
+
+#if    ((NET_IF_CFG_TX_TSO_EN == DEF_ENABLED) && \
+        (defined(NET_IF_ETHER_MODULE_EN))    && \
+        (defined(NET_IPv4_MODULE_EN))        && \
+        (defined(NET_TCP_MODULE_EN)))
+#define  NET_IF_TX_TSO_MODULE_EN
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -98,6 +207,7 @@
 #define  NET_IF_IO_CTRL_LINK_STATE_GET                    10u   /* Get        link state.                               */
 #define  NET_IF_IO_CTRL_LINK_STATE_GET_INFO               11u   /* Get        link state info.                          */
 #define  NET_IF_IO_CTRL_LINK_STATE_UPDATE                 12u   /* Update dev link state regs.                          */
+#define  NET_IF_IO_CTRL_TX_TSO_GET                        20u   /* Get        dev tx seg chk sum support.               */
 
 
 
@@ -336,6 +446,19 @@ struct  net_if {
     NET_STAT_CTR                 TxSuspendCtr;          /* Indicates nbr of tx conn's for  IF currently suspended.      */
 #endif
 
+#ifdef  NET_IF_RX_GRO_MODULE_EN
+    NET_BUF                     *RxGRO_BufHeadPtr;      /* Ptr to head of rx'd segs held for coalescing.                */
+    NET_BUF                     *RxGRO_BufTailPtr;      /* Ptr to tail of rx'd segs held for coalescing.                */
+    CPU_INT32U                   RxGRO_SeqNbrNext;      /* Next in-order seq nbr to coalesce.                           */
+    CPU_INT16U                   RxGRO_TCP_TotLen;      /* Coalesced TCP seg tot len.                                   */
+    CPU_INT16U                   RxGRO_SegCnt;          /* Nbr of rx'd segs held for coalescing.                        */
+    CPU_BOOLEAN                  RxGRO_ChkSumValid;     /* Indicates held head seg's TCP chk sum verified.              */
+#endif
+
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+    CPU_BOOLEAN                  TxTSO_HW;              /* Indicates dev calcs tx'd segs' IPv4 & TCP chk sums.          */
+#endif
+
     KAL_SEM_HANDLE               DevTxRdySignalObj;
 };
 
@@ -858,6 +981,14 @@ CPU_BOOLEAN        NetIF_RxPktIsAvail               (       NET_IF_NBR
 void               NetIF_Tx                         (       NET_BUF                      *p_buf_list,
                                                             NET_ERR                      *p_err);
 
+#ifdef  NET_IF_TX_TSO_MODULE_EN
+void               NetIF_TxSeg                      (       NET_BUF                      *p_buf_tmpl,
+                                                            NET_BUF                      *p_buf,
+                                                            CPU_INT32U                    seq_nbr,
+                                                            CPU_INT16U                    flags_tcp,
+                                                            NET_ERR                      *p_err);
+#endif
+
 void               NetIF_TxSuspend                  (       NET_IF_NBR                    if_nbr);
 
 void               NetIF_TxIxDataGet                (       NET_IF_NBR                    if_nbr,
@@ -906,6 +1037,49 @@ void               NetIF_LinkStateUnSubscribeHandler(       NET_IF_NBR
 #endif
 
 
+#if     (DEF_CHK_VAL(NET_IF_CFG_RX_BATCH_MAX,     \
+                     NET_IF_RX_BATCH_MAX_MIN,     \
+                     NET_IF_RX_BATCH_MAX_MAX) != DEF_OK)
+#error  "NET_IF_CFG_RX_BATCH_MAX           illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  >= NET_IF_RX_BATCH_MAX_MIN]"
+#error  "                                  [     &&  <= NET_IF_RX_BATCH_MAX_MAX]"
+#endif
+
+
+#if     ((NET_IF_CFG_RX_GRO_EN != DEF_ENABLED ) && \
+         (NET_IF_CFG_RX_GRO_EN != DEF_DISABLED))
+#error  "NET_IF_CFG_RX_GRO_EN              illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]           "
+#error  "                                  [     ||  DEF_ENABLED ]           "
+
+#elif   (NET_IF_CFG_RX_GRO_EN == DEF_ENABLED)
+#if     (DEF_CHK_VAL(NET_IF_CFG_RX_GRO_SEG_MAX,     \
+                     NET_IF_RX_GRO_SEG_MAX_MIN,     \
+                     NET_IF_RX_GRO_SEG_MAX_MAX) != DEF_OK)
+#error  "NET_IF_CFG_RX_GRO_SEG_MAX         illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  >= NET_IF_RX_GRO_SEG_MAX_MIN]"
+#error  "                                  [     &&  <= NET_IF_RX_GRO_SEG_MAX_MAX]"
+#endif
+#endif
+
+
+#if     ((NET_IF_CFG_TX_TSO_EN != DEF_ENABLED ) && \
+         (NET_IF_CFG_TX_TSO_EN != DEF_DISABLED))
+#error  "NET_IF_CFG_TX_TSO_EN              illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]           "
+#error  "                                  [     ||  DEF_ENABLED ]           "
+
+#elif   (NET_IF_CFG_TX_TSO_EN == DEF_ENABLED)
+#if     (DEF_CHK_VAL(NET_IF_CFG_TX_TSO_SEG_MAX,     \
+                     NET_IF_TX_TSO_SEG_MAX_MIN,     \
+                     NET_IF_TX_TSO_SEG_MAX_MAX) != DEF_OK)
+#error  "NET_IF_CFG_TX_TSO_SEG_MAX         illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  >= NET_IF_TX_TSO_SEG_MAX_MIN]"
+#error  "                                  [     &&  <= NET_IF_TX_TSO_SEG_MAX_MAX]"
+#endif
+#endif
+
+
                                                             /* Correctly configured in 'net_cfg_net.h'; DO NOT MODIFY.  */
 #ifndef  NET_IF_NBR_IF_TOT
 #error  "NET_IF_NBR_IF_TOT                       not #define'd in 'net_cfg_net.h'"
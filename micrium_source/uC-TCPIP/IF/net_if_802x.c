@@ -2400,7 +2400,7 @@ static  void  NetIF_802x_RxPktDiscard (NET_BUF               *p_buf,
    (void)&p_ctrs_err;                                           /* Prevent possible 'variable unused' warnings.         */
 #endif
 
-   (void)NetBuf_FreeBuf(p_buf, p_ctr);
+   (void)NetBuf_FreeBufList(p_buf, p_ctr);
 
    *p_err = NET_ERR_RX;
 }
@@ -360,7 +360,7 @@ static  void  NetIF_Ether_RxPktDiscard (NET_BUF  *p_buf,
 #else
     p_ctr = (NET_CTR *) 0;
 #endif
-   (void)NetBuf_FreeBuf(p_buf, p_ctr);
+   (void)NetBuf_FreeBufList(p_buf, p_ctr);
 
    *p_err = NET_ERR_RX;
 }
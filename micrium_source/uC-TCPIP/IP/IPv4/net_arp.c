@@ -373,6 +373,11 @@ void  NetARP_Init (NET_ERR  *p_err)
     NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP] = (NET_CACHE_ADDR *)0;
     NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_ARP] = (NET_CACHE_ADDR *)0;
 
+#ifdef  NET_CACHE_HASH_ARP_EN                                   /* --------------- INIT ARP CACHE HASH TBL ------------ */
+    Mem_Clr((void     *)&NetCache_AddrARP_HashTbl[0],
+            (CPU_SIZE_T) sizeof(NetCache_AddrARP_HashTbl));
+#endif
+
    *p_err = NET_ARP_ERR_NONE;
 }
 
@@ -534,6 +539,9 @@ CPU_BOOLEAN  NetARP_CfgCacheTxQ_MaxTh (NET_BUF_QTY  nbr_buf_max)
 *               & MAY be called by application function(s).
 *
 * Note(s)     : (1) 'NetARP_CacheAccessedTh_nbr' MUST ALWAYS be accessed exclusively in critical sections.
+*
+*               (2) ARP caches are promoted on EVERY access (see 'net_cache.c  NetCache_AddrSrch()  Note #4');
+*                   the configured threshold is retained for backwards compatibility ONLY.
 *********************************************************************************************************
 */
 
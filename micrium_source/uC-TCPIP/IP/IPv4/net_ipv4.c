@@ -313,6 +313,21 @@ typedef  struct  net_ipv4_opt_ts_route {
 } NET_IPv4_OPT_TS_ROUTE;
 
 
+/*
+*********************************************************************************************************
+*                             IPv4 FRAGMENT REASSEMBLY SOURCE DATA TYPE
+*
+* Note(s) : (1) An entry is free when NO fragment data octets are held for its source address (see
+*               'NetIPv4_RxPktFragReasm()  Note #2c').
+*********************************************************************************************************
+*/
+
+typedef  struct  net_ipv4_frag_reasm_src {
+    NET_IPv4_ADDR       Addr;                                   /* Src IPv4 addr.                                       */
+    CPU_INT32U          Size;                                   /* Frag'd octets held in reasm for src (see Note #1).   */
+} NET_IPv4_FRAG_REASM_SRC;
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -330,8 +345,11 @@ typedef  struct  net_ipv4_opt_ts_route {
 *********************************************************************************************************
 */
 
-static  NET_BUF          *NetIPv4_FragReasmListsHead;     /* Ptr to head of frag reasm lists.                     */
-static  NET_BUF          *NetIPv4_FragReasmListsTail;     /* Ptr to tail of frag reasm lists.                     */
+                                                          /* Ptrs to head/tail of frag reasm lists per bucket.    */
+static  NET_BUF          *NetIPv4_FragReasmListsHead[NET_IPv4_FRAG_REASM_HASH_TBL_SIZE];
+static  NET_BUF          *NetIPv4_FragReasmListsTail[NET_IPv4_FRAG_REASM_HASH_TBL_SIZE];
+                                                          /* Frag'd octets held in reasm per src.                 */
+static  NET_IPv4_FRAG_REASM_SRC  NetIPv4_FragReasmSrcTbl[NET_IPv4_FRAG_REASM_SRC_TBL_SIZE];
 
 static  CPU_INT08U        NetIPv4_FragReasmTimeout_sec;   /* IPv4 frag reasm timeout (in secs ).                  */
 static  NET_TMR_TICK      NetIPv4_FragReasmTimeout_tick;  /* IPv4 frag reasm timeout (in ticks).                  */
@@ -413,6 +431,7 @@ static  NET_BUF       *NetIPv4_RxPktFragListAdd          (NET_BUF        *p_buf,
                                                           CPU_INT16U      frag_ip_flags,
                                                           CPU_INT16U      frag_offset,
                                                           CPU_INT16U      frag_size,
+                                                          CPU_INT16U      hash_ix,
                                                           NET_ERR        *p_err);
 
 static  NET_BUF       *NetIPv4_RxPktFragListInsert       (NET_BUF        *p_buf,
@@ -426,6 +445,11 @@ static  NET_BUF       *NetIPv4_RxPktFragListInsert       (NET_BUF        *p_buf,
 static  void           NetIPv4_RxPktFragListRemove       (NET_BUF        *p_frag_list,
                                                           CPU_BOOLEAN     tmr_free);
 
+static  CPU_INT16U     NetIPv4_RxPktFragListHash         (NET_BUF        *p_buf);
+
+static  NET_IPv4_FRAG_REASM_SRC  *NetIPv4_RxPktFragSrcGet (NET_IPv4_ADDR   addr_src,
+                                                          CPU_BOOLEAN     alloc);
+
 static  void           NetIPv4_RxPktFragListDiscard      (NET_BUF        *p_frag_list,
                                                           CPU_BOOLEAN     tmr_free,
                                                           NET_ERR        *p_err);
@@ -580,7 +604,7 @@ static  CPU_BOOLEAN      NetIPv4_IsAddrHostCfgdHandler   (NET_IPv4_ADDR   addr);
 * Description : (1) Initialize Internet Protocol Layer :
 *
 *                   (a) Initialize ALL interfaces' configurable IPv4 addresses
-*                   (b) Initialize IPv4 fragmentation list pointers
+*                   (b) Initialize IPv4 fragmentation list hash table & per-source sizes
 *                   (c) Initialize IPv4 identification (ID) counter
 *
 *
@@ -615,6 +639,7 @@ void  NetIPv4_Init (void)
     NET_IPv4_ADDRS    *p_ip_addrs;
     NET_IP_ADDRS_QTY   addr_ix;
     NET_IF_NBR         if_nbr;
+    CPU_INT16U         hash_ix;
 
 
                                                                     /* --------------- INIT IPv4 ADDRS ---------------- */
@@ -638,8 +663,14 @@ void  NetIPv4_Init (void)
 
 
                                                                     /* ------------- INIT IPv4 FRAG LISTS ------------- */
-    NetIPv4_FragReasmListsHead = (NET_BUF *)0;
-    NetIPv4_FragReasmListsTail = (NET_BUF *)0;
+    for (hash_ix = 0u; hash_ix < NET_IPv4_FRAG_REASM_HASH_TBL_SIZE; hash_ix++) {
+        NetIPv4_FragReasmListsHead[hash_ix]  = (NET_BUF *)0;
+        NetIPv4_FragReasmListsTail[hash_ix]  = (NET_BUF *)0;
+    }
+    for (hash_ix = 0u; hash_ix < NET_IPv4_FRAG_REASM_SRC_TBL_SIZE; hash_ix++) {
+        NetIPv4_FragReasmSrcTbl[hash_ix].Addr = NET_IPv4_ADDR_NONE;
+        NetIPv4_FragReasmSrcTbl[hash_ix].Size = 0u;
+    }
 
                                                                     /* --------------- INIT IPv4 ID CTR --------------- */
     NetIPv4_TxID_Ctr           =  NET_IPv4_ID_INIT;
@@ -3910,6 +3941,10 @@ CPU_BOOLEAN  NetIPv4_IsValidFlags (NET_IPv4_FLAGS  flags)
 *                       (1) IP datagram length is stored ONLY in the first packet buffer of any
 *                           fragmented packet buffers.
 *
+*                   (c) For multiple packet buffer, coalesced TCP segments, the datagram length is equal
+*                       to the coalesced TCP segments' total length, stored by the network interface layer
+*                       as the total fragment size (see 'net_if.c  NetIF_RxGRO_Flush()  Note #1').
+*
 *               (5) Network buffer already freed by higher layer; only increment error counter.
 *********************************************************************************************************
 */
@@ -3919,6 +3954,7 @@ void  NetIPv4_Rx (NET_BUF  *p_buf,
 {
     NET_BUF_HDR    *p_buf_hdr;
     NET_IPv4_HDR   *p_ip_hdr;
+    CPU_BOOLEAN     gro;
 
 
 
@@ -3994,7 +4030,11 @@ void  NetIPv4_Rx (NET_BUF  *p_buf,
         case NET_IPv4_ERR_RX_FRAG_NONE:
         case NET_IPv4_ERR_RX_FRAG_COMPLETE:
              p_buf_hdr = &p_buf->Hdr;                                       /* Reload buf hdr ptr (see Note #3).        */
-             if (*p_err == NET_IPv4_ERR_RX_FRAG_NONE) {                     /* If pkt NOT frag'd, ...                   */
+             gro       =  DEF_BIT_IS_SET(p_buf_hdr->Flags, NET_BUF_FLAG_RX_GRO);
+             if (gro == DEF_YES) {                                          /* If TCP segs coalesced, ...               */
+                  p_buf_hdr->IP_DatagramLen = (CPU_INT16U)                  /* ... set coalesced tot len as ...         */
+                                               p_buf_hdr->IP_FragSizeTot;   /* ... datagram len (see Note #4c).         */
+             } else if (*p_err == NET_IPv4_ERR_RX_FRAG_NONE) {              /* If pkt NOT frag'd, ...                   */
                   p_buf_hdr->IP_DatagramLen = p_buf_hdr->IP_TotLen          /* ... calc buf datagram len (see Note #4a).*/
                                            - p_buf_hdr->IP_HdrLen;
              } else {                                                       /* Else set tot frag size ...               */
@@ -6364,17 +6404,22 @@ static  CPU_BOOLEAN  NetIPv4_RxPktValidateOptTS (NET_BUF_HDR  *p_buf_hdr,
 *
 *                       See also Note #3a.
 *
-*                   (b) Fragment lists are linked to form a list of Fragment Lists/Fragmented Datagrams.
+*                   (b) Fragment lists are hashed by the IPv4 header fields in Note #2a into one of
+*                       NET_IPv4_FRAG_REASM_HASH_TBL_SIZE hash buckets (see 'NetIPv4_RxPktFragListHash()').
+*                       Each hash bucket's fragment lists are linked to form a list of Fragment Lists/
+*                       Fragmented Datagrams.
 *
 *                       (1) In the diagram below, ... :
 *
-*                           (A) The top horizontal row  represents the list of fragment lists.
+*                           (A) The top horizontal row  represents one hash bucket's list of fragment lists.
 *
 *                           (B) Each    vertical column represents the fragments in the same fragment list/
 *                               Fragmented Datagram.
 *
-*                           (C) (1) 'NetIPv4_FragReasmListsHead' points to the head of the Fragment Lists;
-*                               (2) 'NetIPv4_FragReasmListsTail' points to the tail of the Fragment Lists.
+*                           (C) (1) 'NetIPv4_FragReasmListsHead[]' points to the head of each bucket's
+*                                   Fragment Lists;
+*                               (2) 'NetIPv4_FragReasmListsTail[]' points to the tail of each bucket's
+*                                   Fragment Lists.
 *
 *                           (D) Fragment buffers' 'PrevPrimListPtr' & 'NextPrimListPtr' doubly-link each fragment
 *                               list's head buffer to form the list of Fragment Lists.
@@ -6382,13 +6427,22 @@ static  CPU_BOOLEAN  NetIPv4_RxPktValidateOptTS (NET_BUF_HDR  *p_buf_hdr,
 *                           (E) Fragment buffer's 'PrevBufPtr'      & 'NextBufPtr'      doubly-link each fragment
 *                               in a fragment list.
 *
-*                       (2) (A) For each received fragment, all fragment lists are searched in order to insert the
-*                               fragment into the appropriate fragment list--i.e. the fragment list with identical
-*                               fragment list IPv4 header field values (see Note #2a).
+*                           (F) Each fragment list's head buffer's 'IP_FragTailPtr' points to the fragment list's
+*                               last fragment; thus in-order fragments are appended without searching the fragment
+*                               list (see 'NetIPv4_RxPktFragListInsert()  Note #1c').
+*
+*                           (G) Each fragment list's head buffer's 'IP_FragSizeCur' & 'IP_FragSizeTot' track the
+*                               received & total fragment data octets; thus fragment list completion is checked
+*                               without searching the fragment list (see 'NetIPv4_RxPktFragListChkComplete()').
+*
+*                       (2) (A) For each received fragment, ONLY the fragment lists in the fragment's hash bucket
+*                               are searched in order to insert the fragment into the appropriate fragment list--
+*                               i.e. the fragment list with identical fragment list IPv4 header field values (see
+*                               Note #2a).
 *
 *                           (B) If a received fragment is the first fragment with its specific fragment list IPv4
 *                               header field values, the received fragment starts a new fragment list which is
-*                               added at the tail of the Fragment Lists.
+*                               added at the tail of its hash bucket's Fragment Lists.
 *
 *                               See also Note #3b2.
 *
@@ -6405,6 +6459,21 @@ static  CPU_BOOLEAN  NetIPv4_RxPktValidateOptTS (NET_BUF_HDR  *p_buf_hdr,
 *                           i.e. the procedure functions correctly regardless of the buffer sizes used for any &
 *                           all received fragments.
 *
+*                   (c) (1) Fragment data octets held in reassembly are accounted per source address in
+*                           'NetIPv4_FragReasmSrcTbl[]'.  Each entry stores its source address; sources that
+*                           hash to the same entry are probed to the next entries so that NO two sources ever
+*                           share the same limit (see 'NetIPv4_RxPktFragSrcGet()').
+*
+*                       (2) A received fragment that would exceed NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX is
+*                           discarded; & since its Fragmented Datagram can NO longer complete, the datagram's
+*                           fragment list is also discarded.
+*
+*                       (3) If every source table entry is held by other sources, a fragment from a new
+*                           source is discarded until an entry is released by a reassembled, discarded or
+*                           timed out fragment list.  Sources already in reassembly are NOT affected.
+*
+*                       See also 'net_ipv4.h  IPv4 FRAGMENTATION DEFINES  Note #1d'.
+*
 *
 *
 *                                        |                   List of                     |
@@ -6525,16 +6594,19 @@ static  NET_BUF  *NetIPv4_RxPktFragReasm (NET_BUF        *p_buf,
                                           NET_IPv4_HDR   *p_ip_hdr,
                                           NET_ERR        *p_err)
 {
-    CPU_BOOLEAN     frag;
-    CPU_BOOLEAN     frag_done;
-    CPU_BOOLEAN     ip_flag_frags_more;
-    CPU_INT16U      ip_flags;
-    CPU_INT16U      frag_offset;
-    CPU_INT16U      frag_size;
-    NET_BUF        *p_frag;
-    NET_BUF        *p_frag_list;
-    NET_BUF_HDR    *p_frag_list_buf_hdr;
-    NET_IPv4_HDR   *p_frag_list_ip_hdr;
+    CPU_BOOLEAN               frag;
+    CPU_BOOLEAN               frag_done;
+    CPU_BOOLEAN               ip_flag_frags_more;
+    CPU_INT16U                ip_flags;
+    CPU_INT16U                frag_offset;
+    CPU_INT16U                frag_size;
+    CPU_INT16U                hash_ix;
+    NET_IPv4_FRAG_REASM_SRC  *p_src;
+    NET_BUF                  *p_frag;
+    NET_BUF                  *p_frag_list;
+    NET_BUF_HDR              *p_frag_list_buf_hdr;
+    NET_IPv4_HDR             *p_frag_list_ip_hdr;
+    NET_ERR                   err;
 
 
                                                                 /* -------------- CHK FRAG REASM REQUIRED ------------- */
@@ -6561,13 +6633,14 @@ static  NET_BUF  *NetIPv4_RxPktFragReasm (NET_BUF        *p_buf,
 
 
                                                                 /* ------------------- REASM FRAGS -------------------- */
-    frag_size  = p_buf_hdr->IP_TotLen - p_buf_hdr->IP_HdrLen;
-    p_frag_list = NetIPv4_FragReasmListsHead;
-    frag_done  = DEF_NO;
+    frag_size   = p_buf_hdr->IP_TotLen - p_buf_hdr->IP_HdrLen;
+    hash_ix     = NetIPv4_RxPktFragListHash(p_buf);
+    p_frag_list = NetIPv4_FragReasmListsHead[hash_ix];
+    frag_done   = DEF_NO;
 
     while (frag_done == DEF_NO) {                               /* Insert frag into a frag list.                        */
 
-        if (p_frag_list != (NET_BUF *)0) {                      /* Srch ALL existing frag lists first (see Note #2b2A). */
+        if (p_frag_list != (NET_BUF *)0) {                      /* Srch bucket's frag lists first (see Note #2b2A).     */
             p_frag_list_buf_hdr =                 &p_frag_list->Hdr;
             p_frag_list_ip_hdr  = (NET_IPv4_HDR *)&p_frag_list->DataPtr[p_frag_list_buf_hdr->IP_HdrIx];
 
@@ -6577,14 +6650,7 @@ static  NET_BUF  *NetIPv4_RxPktFragReasm (NET_BUF        *p_buf,
                     if (p_buf_hdr->IP_ID     == p_frag_list_buf_hdr->IP_ID) {     /* ... ID        (see Note #2a3) ...  */
                         if (p_ip_hdr->Protocol == p_frag_list_ip_hdr->Protocol) { /* ... protocol  (see Note #2a4) ...  */
                                                                                   /* ... fields identical,         ...  */
-                            p_frag     = NetIPv4_RxPktFragListInsert(p_buf,       /* ... insert frag into frag list.    */
-                                                                    p_buf_hdr,
-                                                                    ip_flags,
-                                                                    frag_offset,
-                                                                    frag_size,
-                                                                    p_frag_list,
-                                                                    p_err);
-                            frag_done = DEF_YES;
+                            frag_done = DEF_YES;                                  /* ... frag list found.               */
                         }
                     }
                 }
@@ -6594,17 +6660,49 @@ static  NET_BUF  *NetIPv4_RxPktFragReasm (NET_BUF        *p_buf,
                 p_frag_list = p_frag_list_buf_hdr->NextPrimListPtr;
             }
 
-        } else {                                                /* Else add new frag list (see Note #2b2B).             */
-            p_frag     = NetIPv4_RxPktFragListAdd(p_buf,
-                                                 p_buf_hdr,
-                                                 ip_flags,
-                                                 frag_offset,
-                                                 frag_size,
-                                                 p_err);
+        } else {                                                /* Else NO frag list found.                             */
             frag_done = DEF_YES;
         }
     }
 
+                                                                /* ------------ CHK PER-SRC REASM SIZE MAX ------------ */
+    p_src = NetIPv4_RxPktFragSrcGet(p_buf_hdr->IP_AddrSrc, DEF_YES);
+    if (p_src == (NET_IPv4_FRAG_REASM_SRC *)0) {                /* If src tbl full, discard frag (see Note #2c3).       */
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxFragSrcTblFullCtr);
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxFragDisCtr);
+       *p_err = NET_IPv4_ERR_RX_FRAG_DISCARD;
+        return (p_buf);
+    }
+
+    if ((p_src->Size + frag_size) > NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX) {
+        if (p_frag_list != (NET_BUF *)0) {                      /* Discard frag's datagram (see Note #2c2).             */
+            NetIPv4_RxPktFragListDiscard(p_frag_list, DEF_YES, &err);
+        }
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxFragSrcSizeMaxCtr);
+        NET_CTR_ERR_INC(Net_ErrCtrs.IPv4.RxFragDisCtr);
+       *p_err = NET_IPv4_ERR_RX_FRAG_DISCARD;
+        return (p_buf);
+    }
+
+
+    if (p_frag_list != (NET_BUF *)0) {                          /* If frag list found, insert frag into frag list.      */
+        p_frag = NetIPv4_RxPktFragListInsert(p_buf,
+                                             p_buf_hdr,
+                                             ip_flags,
+                                             frag_offset,
+                                             frag_size,
+                                             p_frag_list,
+                                             p_err);
+    } else {                                                    /* Else add new frag list (see Note #2b2B).             */
+        p_frag = NetIPv4_RxPktFragListAdd(p_buf,
+                                          p_buf_hdr,
+                                          ip_flags,
+                                          frag_offset,
+                                          frag_size,
+                                          hash_ix,
+                                          p_err);
+    }
+
     return (p_frag);
 }
 
@@ -6613,7 +6711,7 @@ static  NET_BUF  *NetIPv4_RxPktFragReasm (NET_BUF        *p_buf,
 *********************************************************************************************************
 *                                      NetIPv4_RxPktFragListAdd()
 *
-* Description : (1) Add fragment as new fragment list at end of Fragment Lists :
+* Description : (1) Add fragment as new fragment list at end of its hash bucket's Fragment Lists :
 *
 *                   (a) Get    fragment reassembly timer
 *                   (b) Insert fragment into Fragment Lists
@@ -6633,6 +6731,9 @@ static  NET_BUF  *NetIPv4_RxPktFragReasm (NET_BUF        *p_buf,
 *
 *               frag_size       Fragment size (in octets).
 *
+*               hash_ix         Fragment's Fragment Lists hash bucket index.
+*               -------         Argument validated in NetIPv4_RxPktFragReasm().
+*
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
 * Return(s)   : Pointer to NULL,            if fragment added as new fragment list.
@@ -6668,6 +6769,7 @@ static  NET_BUF  *NetIPv4_RxPktFragListAdd (NET_BUF           *p_buf,
                                           NET_IPv4_HDR_FLAGS   frag_ip_flags,
                                           CPU_INT16U           frag_offset,
                                           CPU_INT16U           frag_size,
+                                          CPU_INT16U           hash_ix,
                                           NET_ERR             *p_err)
 {
     CPU_BOOLEAN    ip_flag_frags_more;
@@ -6719,18 +6821,20 @@ static  NET_BUF  *NetIPv4_RxPktFragListAdd (NET_BUF           *p_buf,
 
 
                                                                 /* ------------ INSERT FRAG INTO FRAG LISTS ----------- */
-    if (NetIPv4_FragReasmListsTail != (NET_BUF *)0) {           /* If frag lists NOT empty, insert @ tail.              */
-        p_buf_hdr->PrevPrimListPtr                = (NET_BUF     *) NetIPv4_FragReasmListsTail;
-        p_frag_list_tail_buf_hdr                  = (NET_BUF_HDR *)&NetIPv4_FragReasmListsTail->Hdr;
+    if (NetIPv4_FragReasmListsTail[hash_ix] != (NET_BUF *)0) {  /* If frag lists NOT empty, insert @ tail.              */
+        p_buf_hdr->PrevPrimListPtr                = (NET_BUF     *) NetIPv4_FragReasmListsTail[hash_ix];
+        p_frag_list_tail_buf_hdr                  = (NET_BUF_HDR *)&NetIPv4_FragReasmListsTail[hash_ix]->Hdr;
         p_frag_list_tail_buf_hdr->NextPrimListPtr = (NET_BUF     *) p_buf;
-        NetIPv4_FragReasmListsTail                = (NET_BUF     *) p_buf;
+        NetIPv4_FragReasmListsTail[hash_ix]       = (NET_BUF     *) p_buf;
 
     } else {                                                    /* Else add frag as first frag list.                    */
-        NetIPv4_FragReasmListsHead                = (NET_BUF     *) p_buf;
-        NetIPv4_FragReasmListsTail                = (NET_BUF     *) p_buf;
+        NetIPv4_FragReasmListsHead[hash_ix]       = (NET_BUF     *) p_buf;
+        NetIPv4_FragReasmListsTail[hash_ix]       = (NET_BUF     *) p_buf;
         p_buf_hdr->PrevPrimListPtr                = (NET_BUF     *) 0;
     }
 
+    p_buf_hdr->IP_FragTailPtr                     = (NET_BUF     *) p_buf;
+
 #if 0                                                           /* Init'd in NetBuf_Get() [see Note #3].                */
     p_buf_hdr->NextPrimListPtr = (NET_BUF *)0;
     p_buf_hdr->PrevBufPtr      = (NET_BUF *)0;
@@ -6792,6 +6896,11 @@ static  NET_BUF  *NetIPv4_RxPktFragListAdd (NET_BUF           *p_buf,
 *
 *                       See also 'net_tcp.c  NetTCP_RxPktConnHandlerRxQ_Conn()  Note #2a3'.
 *
+*                   (c) Since fragments are most likely received in order, a fragment with a fragment offset
+*                       greater than the fragment list's last fragment (see 'NetIPv4_RxPktFragReasm()
+*                       Note #2b1F') is appended directly after the last fragment; otherwise, the fragment
+*                       list is searched from its head.
+*
 *
 * Argument(s) : p_buf           Pointer to network buffer that received fragment.
 *               ----            Argument checked   in NetIPv4_Rx().
@@ -6903,6 +7012,7 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
     NET_BUF_HDR  *p_frag_list_prev_list_buf_hdr;
     NET_BUF_HDR  *p_frag_list_next_list_buf_hdr;
     NET_TMR      *p_tmr;
+    CPU_INT16U    hash_ix;
     NET_ERR       err;
 
 
@@ -6934,8 +7044,14 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
                                                                         /* ------- INSERT FRAG INTO FRAG LISTS -------- */
     frag_insert_done       =  DEF_NO;
 
-    p_frag_list_cur_buf     =  p_frag_list;
+    p_frag_list_buf_hdr     = &p_frag_list->Hdr;
+    p_frag_list_cur_buf     =  p_frag_list_buf_hdr->IP_FragTailPtr;     /* Start @ last frag in list, ...               */
     p_frag_list_cur_buf_hdr = &p_frag_list_cur_buf->Hdr;
+    frag_list_cur_frag_offset = (CPU_INT16U)(p_frag_list_cur_buf_hdr->IP_Flags_FragOffset & NET_IPv4_HDR_FRAG_OFFSET_MASK);
+    if (frag_offset <= frag_list_cur_frag_offset) {                     /* ... unless frag NOT in order ...             */
+        p_frag_list_cur_buf     =  p_frag_list;                         /* ... (see Note #1c).                          */
+        p_frag_list_cur_buf_hdr = &p_frag_list_cur_buf->Hdr;
+    }
 
     while (frag_insert_done == DEF_NO) {
 
@@ -6967,6 +7083,8 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
 
 
                     p_frag_list_buf_hdr = &p_frag_list->Hdr;
+                                                                        /* Update frag list's last frag.                */
+                    p_frag_list_buf_hdr->IP_FragTailPtr = (NET_BUF *)p_buf;
                     NetIPv4_RxPktFragListUpdate(p_frag_list,             /* Update frag list reasm calcs.                */
                                                 p_frag_list_buf_hdr,
                                                 frag_ip_flags,
@@ -7048,6 +7166,7 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
                     p_buf_hdr->TmrPtr                        =  p_frag_list_cur_buf_hdr->TmrPtr;
                     p_buf_hdr->IP_FragSizeTot                =  p_frag_list_cur_buf_hdr->IP_FragSizeTot;
                     p_buf_hdr->IP_FragSizeCur                =  p_frag_list_cur_buf_hdr->IP_FragSizeCur;
+                    p_buf_hdr->IP_FragTailPtr                =  p_frag_list_cur_buf_hdr->IP_FragTailPtr;
 
                     p_frag_list_cur_buf_hdr->PrevBufPtr      = (NET_BUF *)p_buf;
                     p_frag_list_cur_buf_hdr->PrevPrimListPtr = (NET_BUF *)0;
@@ -7055,18 +7174,20 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
                     p_frag_list_cur_buf_hdr->TmrPtr          = (NET_TMR *)0;
                     p_frag_list_cur_buf_hdr->IP_FragSizeTot  =  NET_IPv4_FRAG_SIZE_NONE;
                     p_frag_list_cur_buf_hdr->IP_FragSizeCur  =  0u;
+                    p_frag_list_cur_buf_hdr->IP_FragTailPtr  = (NET_BUF *)0;
 
                                                                         /* Point tmr            to new frag list head.  */
                     p_tmr                                    = (NET_TMR *)p_buf_hdr->TmrPtr;
                     p_tmr->Obj                               = (void    *)p_buf;
 
+                    hash_ix = NetIPv4_RxPktFragListHash(p_buf);
                                                                         /* Point prev frag list to new frag list head.  */
                     p_frag_list_prev_list = p_buf_hdr->PrevPrimListPtr;
                     if (p_frag_list_prev_list != (NET_BUF *)0) {
                         p_frag_list_prev_list_buf_hdr                  = &p_frag_list_prev_list->Hdr;
                         p_frag_list_prev_list_buf_hdr->NextPrimListPtr =  p_buf;
                     } else {
-                        NetIPv4_FragReasmListsHead                    =  p_buf;
+                        NetIPv4_FragReasmListsHead[hash_ix]           =  p_buf;
                     }
 
                                                                         /* Point next frag list to new frag list head.  */
@@ -7075,7 +7196,7 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
                         p_frag_list_next_list_buf_hdr                  = &p_frag_list_next_list->Hdr;
                         p_frag_list_next_list_buf_hdr->PrevPrimListPtr =  p_buf;
                     } else {
-                        NetIPv4_FragReasmListsTail                    =  p_buf;
+                        NetIPv4_FragReasmListsTail[hash_ix]           =  p_buf;
                     }
                 }
 
@@ -7130,7 +7251,8 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
 *
 *                   (a) Free   fragment reassembly timer
 *                   (b) Remove fragment list from Fragment Lists
-*                   (c) Clear  buffer's fragment pointers
+*                   (c) Update fragment list source's reassembly size
+*                   (d) Clear  buffer's fragment pointers
 *
 *
 * Argument(s) : p_frag_list     Pointer to fragment list head buffer.
@@ -7156,12 +7278,14 @@ static  NET_BUF  *NetIPv4_RxPktFragListInsert (NET_BUF             *p_buf,
 static  void  NetIPv4_RxPktFragListRemove (NET_BUF      *p_frag_list,
                                            CPU_BOOLEAN   tmr_free)
 {
-    NET_BUF      *p_frag_list_prev_list;
-    NET_BUF      *p_frag_list_next_list;
-    NET_BUF_HDR  *p_frag_list_prev_list_buf_hdr;
-    NET_BUF_HDR  *p_frag_list_next_list_buf_hdr;
-    NET_BUF_HDR  *p_frag_list_buf_hdr;
-    NET_TMR      *p_tmr;
+    NET_BUF                  *p_frag_list_prev_list;
+    NET_BUF                  *p_frag_list_next_list;
+    NET_BUF_HDR              *p_frag_list_prev_list_buf_hdr;
+    NET_BUF_HDR              *p_frag_list_next_list_buf_hdr;
+    NET_BUF_HDR              *p_frag_list_buf_hdr;
+    NET_TMR                  *p_tmr;
+    CPU_INT16U                hash_ix;
+    NET_IPv4_FRAG_REASM_SRC  *p_src;
 
 
     p_frag_list_buf_hdr = &p_frag_list->Hdr;
@@ -7175,6 +7299,7 @@ static  void  NetIPv4_RxPktFragListRemove (NET_BUF      *p_frag_list,
     }
 
                                                                 /* --------- REMOVE FRAG LIST FROM FRAG LISTS --------- */
+    hash_ix               = NetIPv4_RxPktFragListHash(p_frag_list);
     p_frag_list_prev_list = p_frag_list_buf_hdr->PrevPrimListPtr;
     p_frag_list_next_list = p_frag_list_buf_hdr->NextPrimListPtr;
 
@@ -7183,7 +7308,7 @@ static  void  NetIPv4_RxPktFragListRemove (NET_BUF      *p_frag_list,
         p_frag_list_prev_list_buf_hdr                  = &p_frag_list_prev_list->Hdr;
         p_frag_list_prev_list_buf_hdr->NextPrimListPtr =  p_frag_list_next_list;
     } else {
-        NetIPv4_FragReasmListsHead                    =  p_frag_list_next_list;
+        NetIPv4_FragReasmListsHead[hash_ix]           =  p_frag_list_next_list;
     }
 
                                                                 /* Point next frag list to prev frag list.              */
@@ -7191,13 +7316,150 @@ static  void  NetIPv4_RxPktFragListRemove (NET_BUF      *p_frag_list,
         p_frag_list_next_list_buf_hdr                  = &p_frag_list_next_list->Hdr;
         p_frag_list_next_list_buf_hdr->PrevPrimListPtr =  p_frag_list_prev_list;
     } else {
-        NetIPv4_FragReasmListsTail                    =  p_frag_list_prev_list;
+        NetIPv4_FragReasmListsTail[hash_ix]           =  p_frag_list_prev_list;
+    }
+
+                                                                /* --------------- UPDATE SRC REASM SIZE -------------- */
+    p_src = NetIPv4_RxPktFragSrcGet(p_frag_list_buf_hdr->IP_AddrSrc, DEF_NO);
+    if (p_src != (NET_IPv4_FRAG_REASM_SRC *)0) {
+        if (p_src->Size > p_frag_list_buf_hdr->IP_FragSizeCur) {
+            p_src->Size -= p_frag_list_buf_hdr->IP_FragSizeCur;
+        } else {
+            p_src->Size  = 0u;                                  /* Free src entry (see 'NET_IPv4_FRAG_REASM_SRC').      */
+        }
     }
 
                                                                 /* ---------------- CLR BUF FRAG PTRS ----------------- */
     p_frag_list_buf_hdr->PrevPrimListPtr = (NET_BUF *)0;
     p_frag_list_buf_hdr->NextPrimListPtr = (NET_BUF *)0;
     p_frag_list_buf_hdr->TmrPtr          = (NET_TMR *)0;
+    p_frag_list_buf_hdr->IP_FragTailPtr  = (NET_BUF *)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetIPv4_RxPktFragListHash()
+*
+* Description : Calculate fragment's Fragment Lists hash bucket index.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received fragment.
+*               -----       Argument validated in NetIPv4_RxPktFragReasm(),
+*                                                 NetIPv4_RxPktFragListInsert(),
+*                                                 NetIPv4_RxPktFragListRemove().
+*
+* Return(s)   : Fragment's hash bucket index.
+*
+* Caller(s)   : NetIPv4_RxPktFragReasm(),
+*               NetIPv4_RxPktFragListInsert(),
+*               NetIPv4_RxPktFragListRemove().
+*
+* Note(s)     : (1) The hash combines ALL the IPv4 header fields that identify a fragment's Fragmented
+*                   Datagram (see 'NetIPv4_RxPktFragReasm()  Note #2a'); fragments of the same datagram
+*                   thus ALWAYS hash to the same bucket.
+*
+*               (2) NET_IPv4_FRAG_REASM_HASH_TBL_SIZE MUST be a power of 2 (see 'net_ipv4.h  IPv4
+*                   FRAGMENTATION DEFINES  Note #1c').
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetIPv4_RxPktFragListHash (NET_BUF  *p_buf)
+{
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_IPv4_HDR  *p_ip_hdr;
+    CPU_INT32U     hash;
+    CPU_INT16U     hash_ix;
+
+
+    p_buf_hdr =                 &p_buf->Hdr;
+    p_ip_hdr  = (NET_IPv4_HDR *)&p_buf->DataPtr[p_buf_hdr->IP_HdrIx];
+
+                                                                /* Fold ALL datagram id fields (see Note #1).           */
+    hash      = (CPU_INT32U)p_buf_hdr->IP_AddrSrc
+              ^ (CPU_INT32U)p_buf_hdr->IP_AddrDest;
+    hash     ^=  hash >> 16u;
+    hash     ^= (CPU_INT32U)p_buf_hdr->IP_ID;
+    hash     ^= (CPU_INT32U)p_ip_hdr->Protocol;
+    hash     ^=  hash >>  8u;
+
+                                                                /* Mask to bucket ix (see Note #2).                     */
+    hash_ix   = (CPU_INT16U)(hash & (NET_IPv4_FRAG_REASM_HASH_TBL_SIZE - 1u));
+
+    return (hash_ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIPv4_RxPktFragSrcGet()
+*
+* Description : Get fragment source address's reassembly source table entry.
+*
+* Argument(s) : addr_src    Fragment's source IPv4 address.
+*
+*               alloc       Indicate whether to allocate a free entry if NO entry holds the source address :
+*
+*                               DEF_YES         Allocate a free entry, if any.
+*                               DEF_NO   Do NOT allocate an entry.
+*
+* Return(s)   : Pointer to source address's reassembly source table entry, if found or allocated.
+*
+*               Pointer to NULL,                                           otherwise.
+*
+* Caller(s)   : NetIPv4_RxPktFragReasm(),
+*               NetIPv4_RxPktFragListRemove(),
+*               NetIPv4_RxPktFragListUpdate().
+*
+* Note(s)     : (1) The source table is searched by linear probing starting at the entry indexed by a hash
+*                   of the source address.  Since entries are freed in place, ALL entries are probed before
+*                   a source address is known NOT to be held; the first free entry probed is allocated.
+*
+*               (2) An allocated entry is ONLY held once fragment data octets are accounted for its source
+*                   address; until then, it is still free (see 'NET_IPv4_FRAG_REASM_SRC  Note #1').
+*
+*               (3) NET_IPv4_FRAG_REASM_SRC_TBL_SIZE MUST be a power of 2 (see 'net_ipv4.h  IPv4
+*                   FRAGMENTATION DEFINES  Note #1d2B').
+*********************************************************************************************************
+*/
+
+static  NET_IPv4_FRAG_REASM_SRC  *NetIPv4_RxPktFragSrcGet (NET_IPv4_ADDR  addr_src,
+                                                           CPU_BOOLEAN    alloc)
+{
+    NET_IPv4_FRAG_REASM_SRC  *p_src;
+    NET_IPv4_FRAG_REASM_SRC  *p_src_free;
+    CPU_INT32U                hash;
+    CPU_INT16U                src_ix;
+    CPU_INT16U                probe_nbr;
+
+
+    hash       = (CPU_INT32U)addr_src;
+    hash      ^=  hash >> 16u;
+    hash      ^=  hash >>  8u;
+    src_ix     = (CPU_INT16U)(hash & (NET_IPv4_FRAG_REASM_SRC_TBL_SIZE - 1u));  /* See Note #3.                    */
+    p_src_free = (NET_IPv4_FRAG_REASM_SRC *)0;
+
+    for (probe_nbr = 0u; probe_nbr < NET_IPv4_FRAG_REASM_SRC_TBL_SIZE; probe_nbr++) {
+        p_src = &NetIPv4_FragReasmSrcTbl[src_ix];
+        if (p_src->Size > 0u) {                                 /* If entry held ...                                    */
+            if (p_src->Addr == addr_src) {                      /* ... by src addr, rtn entry.                          */
+                return (p_src);
+            }
+        } else if (p_src_free == (NET_IPv4_FRAG_REASM_SRC *)0) {
+            p_src_free = p_src;                                 /* Save first free entry (see Note #1).                 */
+        } else {
+                                                                /* Empty Else Statement                                 */
+        }
+        src_ix = (src_ix + 1u) & (NET_IPv4_FRAG_REASM_SRC_TBL_SIZE - 1u);
+    }
+
+    if ((alloc      == DEF_YES) &&
+        (p_src_free != (NET_IPv4_FRAG_REASM_SRC *)0)) {
+        p_src_free->Addr = addr_src;                            /* Alloc free entry (see Note #2).                      */
+    } else {
+        p_src_free = (NET_IPv4_FRAG_REASM_SRC *)0;
+    }
+
+    return (p_src_free);
 }
 
 
@@ -7300,6 +7562,10 @@ static  void  NetIPv4_RxPktFragListDiscard (NET_BUF      *p_frag_list,
 *               (2) To avoid possible integer arithmetic overflow, the fragmentation arithmetic result MUST
 *                   be declared as an integer data type with a greater resolution -- i.e. greater number of
 *                   bits -- than the fragmentation arithmetic operands' data type(s).
+*
+*               (3) Fragment list source's reassembly size is updated with the fragment list's current size
+*                   so that NetIPv4_RxPktFragListRemove() releases the same number of octets (see
+*                   'NetIPv4_RxPktFragReasm()  Note #2c1').
 *********************************************************************************************************
 */
 
@@ -7310,12 +7576,17 @@ static  void  NetIPv4_RxPktFragListUpdate (NET_BUF             *p_frag_list,
                                            CPU_INT16U           frag_size,
                                            NET_ERR             *p_err)
 {
-    CPU_INT32U   frag_size_tot;                                     /* See Note #2.                                     */
-    CPU_BOOLEAN  ip_flag_frags_more;
-    NET_ERR      err;
+    CPU_INT32U                frag_size_tot;                        /* See Note #2.                                     */
+    CPU_BOOLEAN               ip_flag_frags_more;
+    NET_IPv4_FRAG_REASM_SRC  *p_src;
+    NET_ERR                   err;
 
 
     p_frag_list_buf_hdr->IP_FragSizeCur += frag_size;
+    p_src                                = NetIPv4_RxPktFragSrcGet(p_frag_list_buf_hdr->IP_AddrSrc, DEF_YES);
+    if (p_src != (NET_IPv4_FRAG_REASM_SRC *)0) {
+        p_src->Size                     += frag_size;               /* Acct frag in src's reasm size (see Note #3).     */
+    }
     ip_flag_frags_more                  = DEF_BIT_IS_SET(frag_ip_flags, NET_IPv4_HDR_FLAG_FRAG_MORE);
     if (ip_flag_frags_more != DEF_YES) {                            /* If 'More Frags' NOT set (see Note #1b1A), ...    */
                                                                     /* ... calc frag tot size  (see Note #1b2).         */
@@ -8808,6 +9079,37 @@ void  NetIPv4_TxIxDataGet (NET_IF_NBR   if_nbr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          NetIPv4_TxID_Get()
+*
+* Description : Get a new IPv4 identification number for a transmit datagram.
+*
+* Argument(s) : none.
+*
+* Return(s)   : IPv4 identification number, in host-order.
+*
+* Caller(s)   : NetIF_TxSeg().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Datagrams whose IPv4 header is replicated from a previously transmitted datagram MUST
+*                   still be assigned a new identification number (see 'NET_IPv4_TX_GET_ID()  Note #1').
+*********************************************************************************************************
+*/
+
+CPU_INT16U  NetIPv4_TxID_Get (void)
+{
+    CPU_INT16U  ip_id;
+
+
+    NET_IPv4_TX_GET_ID(ip_id);
+
+    return (ip_id);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetIPv4_TxPktPrepareOpt()
@@ -278,6 +278,25 @@ typedef  CPU_INT32U  NET_IPv4_OPT_SIZE;                         /* IPv4 opt size
 *               (b) RFC #791, Section 3.2 'Fragmentation and Reassembly : An Example Reassembly Procedure'
 *                   states that "the current recommendation for the [IP fragmentation reassembly] timer
 *                   setting is 15 seconds ... [but] this may be changed ... with ... experience".
+*
+*               (c) Fragment lists are hashed by source address, destination address, identification &
+*                   protocol into NET_IPv4_FRAG_REASM_HASH_TBL_SIZE buckets (see 'net_ipv4.c
+*                   NetIPv4_RxPktFragReasm()  Note #2b').  The table size MUST be a power of 2.
+*
+*               (d) (1) RFC #791, Section 3.2 'Fragmentation and Reassembly' states that "every internet
+*                       destination must be able to receive a datagram of 576 octets either in one piece
+*                       or in fragments to be reassembled".
+*
+*                   (2) NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX configures the maximum number of fragment data
+*                       octets held in reassembly for any one source address; thus a single source CANNOT
+*                       exhaust the receive buffers with incomplete datagrams.
+*
+*                       (A) Defaults to a single maximum-size datagram.
+*
+*                       (B) Each source address is accounted in its own source table entry; at most
+*                           NET_IPv4_FRAG_REASM_SRC_TBL_SIZE source addresses may hold fragments in
+*                           reassembly at once (see 'net_ipv4.c  NetIPv4_RxPktFragReasm()  Note #2c').
+*                           The table size MUST be a power of 2.
 *********************************************************************************************************
 */
 
@@ -300,6 +319,17 @@ typedef  CPU_INT32U  NET_IPv4_OPT_SIZE;                         /* IPv4 opt size
 #define  NET_IPv4_FRAG_REASM_TIMEOUT_MAX_SEC              15    /* IPv4 frag reasm timeout max  = 15 seconds            */
 #define  NET_IPv4_FRAG_REASM_TIMEOUT_DFLT_SEC              5    /* IPv4 frag reasm timeout dflt =  5 seconds            */
 
+#define  NET_IPv4_FRAG_REASM_HASH_TBL_SIZE                16u   /* Nbr of frag list hash buckets    (see Note #1c).     */
+
+#define  NET_IPv4_FRAG_REASM_SRC_TBL_SIZE                 32u   /* Nbr of srcs  held in reasm       (see Note #1d2B).   */
+
+#define  NET_IPv4_FRAG_REASM_SRC_SIZE_MIN                576u   /* Min frag'd octets held  per src  (see Note #1d1).    */
+#define  NET_IPv4_FRAG_REASM_SRC_SIZE_MAX      NET_IPv4_TOT_LEN_MAX
+
+#ifndef  NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX                   /* Max frag'd octets held  per src  (see Note #1d2).    */
+#define  NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX  NET_IPv4_TOT_LEN_MAX
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1058,6 +1088,8 @@ void           NetIPv4_TxIxDataGet             (NET_IF_NBR           if_nbr,
                                                 CPU_INT16U          *p_ix,
                                                 NET_ERR             *p_err);
 
+CPU_INT16U     NetIPv4_TxID_Get                (void);
+
 void           NetIPv4_ReTx                    (NET_BUF             *p_buf,     /* Prepare & re-tx IPv4 pkts.               */
                                                 NET_ERR             *p_err);
 
@@ -1109,6 +1141,14 @@ void           NetIPv4_ChkAddrProtocolConflict (NET_IF_NBR           if_nbr,
 *********************************************************************************************************
 */
 
+#if     (DEF_CHK_VAL(NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX, \
+                     NET_IPv4_FRAG_REASM_SRC_SIZE_MIN,     \
+                     NET_IPv4_FRAG_REASM_SRC_SIZE_MAX) != DEF_OK)
+#error  "NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX  illegally #define'd in 'net_cfg.h'"
+#error  "                                      [MUST be  >= NET_IPv4_FRAG_REASM_SRC_SIZE_MIN]"
+#error  "                                      [     &&  <= NET_IPv4_FRAG_REASM_SRC_SIZE_MAX]"
+#endif
+
 
 
 /*
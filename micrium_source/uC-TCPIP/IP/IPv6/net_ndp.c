@@ -500,6 +500,11 @@ void  NetNDP_Init (NET_ERR  *p_err)
     NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP] = DEF_NULL;
     NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_NDP] = DEF_NULL;
 
+#ifdef  NET_CACHE_HASH_NDP_EN                                   /* --------------- INIT NDP CACHE HASH TBL ------------ */
+    Mem_Clr((void     *)&NetCache_AddrNDP_HashTbl[0],
+            (CPU_SIZE_T) sizeof(NetCache_AddrNDP_HashTbl));
+#endif
+
 
                                                                 /* ------------ INIT NDP ROUTER POOL/STATS ------------- */
     NetStat_PoolInit(&NetNDP_RouterPoolStat,
@@ -4842,7 +4847,7 @@ static  CPU_BOOLEAN  NetNDP_RxPrefixAddrsUpdate (NET_IF_NBR      if_nbr,
 
                 if (p_tmr_valid != DEF_NULL) {
 
-                    remain_tick  = p_tmr_valid->TmrVal;
+                    remain_tick  = NetTmr_TimeRemainGet(p_tmr_valid);
 
                     timeout_tick = (NET_TMR_TICK)lifetime_valid * NET_TMR_TIME_TICK_PER_SEC;
 
@@ -0,0 +1,145 @@
+/*
+*********************************************************************************************************
+*                                              uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       NETWORK UTILITY LIBRARY
+*
+*                                     ARM Cortex-A (ARMv7-A/ARMv8-A)
+*                                            GNU Compiler
+*
+* Filename : net_util_a.c
+* Version  : V3.06.01
+*********************************************************************************************************
+* Note(s)  : (1) Assumes ARM CPU configured for Little Endian.
+*
+*            (2) Requires the Advanced SIMD (NEON) extension :
+*
+*                (a) ARMv7-A : compile with '-mfpu=neon' (or equivalent).
+*                (b) ARMv8-A : always available in AArch64 state.
+*
+*            (3) Intrinsics are used instead of assembly so that the same file serves both the AArch32 &
+*                AArch64 instruction sets.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <arm_neon.h>
+#include  <cpu.h>
+#include  <Source/net_util.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         CONFIGURATION ERRORS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  __ARM_NEON
+#error  "net_util_a.c  REQUIRES the Advanced SIMD (NEON) extension [see 'net_util_a.c  Note #2']."
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 NetUtil_16BitSumDataCalcAlign_32()
+*
+* Description : Calculate 16-bit sum on 32-bit word-aligned data.
+*
+* Argument(s) : pdata_32    Pointer to 32-bit word-aligned data.
+*
+*               size        Size of data (multiple of 32-bit words).
+*
+* Return(s)   : 16-bit sum (see Notes #1 & #3).
+*
+* Caller(s)   : NetUtil_16BitSumDataCalc().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Computes the sum of consecutive 16-bit values.
+*
+*               (2) (a) Each 32-octet block is loaded into two 128-bit vectors of eight 16-bit values each;
+*                       'VPADAL' pairwise adds & accumulates adjacent 16-bit values into four 32-bit lanes
+*                       per accumulator.
+*
+*                   (b) Each 32-bit lane accumulates at most two 16-bit values per block.  Since the data
+*                       size is limited to 16 bits (see 'net_util.c  NetUtil_16BitSumDataCalc()'), no lane
+*                       can overflow.
+*
+*                   (c) Remaining 32-bit words are summed into a 64-bit accumulator, which is congruent,
+*                       modulo 0xFFFF, to the sum of their 16-bit values.
+*
+*               (3) The 16-bit sum MUST be returned in Big Endian/Network order.  Since the sum of 16-bit
+*                   values can be computed in either byte order, the sum is calculated in Little Endian
+*                   order & only the folded 16-bit sum is swapped.
+*
+*                   See also 'net_util.c  NetUtil_16BitSumDataCalc()  Note #6b'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  NetUtil_16BitSumDataCalcAlign_32 (void        *pdata_32,
+                                              CPU_INT32U   size)
+{
+    const  CPU_INT08U  *p_data;
+    const  CPU_INT32U  *p_data_32;
+    uint32x4_t          acc_0;
+    uint32x4_t          acc_1;
+    uint64x2_t          acc_64;
+    CPU_INT64U          sum_64;
+    CPU_INT16U          sum_16;
+
+
+    p_data = (const CPU_INT08U *)pdata_32;
+    acc_0  =  vdupq_n_u32(0u);
+    acc_1  =  vdupq_n_u32(0u);
+
+    while (size >= 32u) {                                       /* Calc sum of sixteen 16-bit values (see Note #2a).    */
+        acc_0   = vpadalq_u16(acc_0, vld1q_u16((const uint16_t *)&p_data[0]));
+        acc_1   = vpadalq_u16(acc_1, vld1q_u16((const uint16_t *)&p_data[16]));
+        p_data += 32u;
+        size   -= 32u;
+    }
+
+    acc_64 = vpaddlq_u32(vaddq_u32(acc_0, acc_1));              /* Combine lanes (see Note #2b).                        */
+    sum_64 = (CPU_INT64U)vgetq_lane_u64(acc_64, 0) +
+             (CPU_INT64U)vgetq_lane_u64(acc_64, 1);
+
+    p_data_32 = (const CPU_INT32U *)p_data;
+    while (size >= sizeof(CPU_INT32U)) {                        /* Calc sum of rem'ing 32-bit words (see Note #2c).     */
+        sum_64 += (CPU_INT64U)*p_data_32++;
+        size   -=  sizeof(CPU_INT32U);
+    }
+
+    while ((sum_64 >> 16u) != 0u) {                             /* Fold sum into 16 bits.                               */
+        sum_64 = (sum_64 & 0x0000FFFFu) + (sum_64 >> 16u);
+    }
+    sum_16 = (CPU_INT16U)sum_64;
+    sum_16 = (CPU_INT16U)((sum_16 << 8u) | (sum_16 >> 8u));     /* Swap to net-order (see Note #3).                     */
+
+    return ((CPU_INT32U)sum_16);
+}
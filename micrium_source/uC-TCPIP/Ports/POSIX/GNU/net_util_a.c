@@ -0,0 +1,159 @@
+/*
+*********************************************************************************************************
+*                                              uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       NETWORK UTILITY LIBRARY
+*
+*                                            POSIX (x86)
+*                                            GNU Compiler
+*
+* Filename : net_util_a.c
+* Version  : V3.06.01
+*********************************************************************************************************
+* Note(s)  : (1) Assumes x86 (IA-32 or x86-64) host CPU; thus Little Endian.
+*
+*            (2) The widest SIMD extension enabled by the compiler is used :
+*
+*                (a) AVX2   : compile with '-mavx2'   (or '-march=<cpu>' for a CPU supporting AVX2).
+*                (b) SSE2   : always available on x86-64; compile with '-msse2' on IA-32.
+*                (c) Otherwise, a scalar 64-bit accumulator implementation is used.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#if     defined(__AVX2__) || defined(__SSE2__)
+#include  <immintrin.h>
+#endif
+#include  <cpu.h>
+#include  <Source/net_util.h>
+
+
+/*
+*********************************************************************************************************
+*                                 NetUtil_16BitSumDataCalcAlign_32()
+*
+* Description : Calculate 16-bit sum on 32-bit word-aligned data.
+*
+* Argument(s) : pdata_32    Pointer to 32-bit word-aligned data.
+*
+*               size        Size of data (multiple of 32-bit words).
+*
+* Return(s)   : 16-bit sum (see Notes #1 & #3).
+*
+* Caller(s)   : NetUtil_16BitSumDataCalc().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Computes the sum of consecutive 16-bit values.
+*
+*               (2) (a) Each vector of 16-bit values is zero-extended into two vectors of 32-bit lanes
+*                       which are added into 32-bit lane accumulators.  The order in which the 16-bit
+*                       values are summed does NOT affect the sum.
+*
+*                   (b) Each 32-bit lane accumulates at most two 16-bit values per vector.  Since the data
+*                       size is limited to 16 bits (see 'net_util.c  NetUtil_16BitSumDataCalc()'), no lane
+*                       can overflow.
+*
+*                   (c) Remaining 32-bit words are summed into a 64-bit accumulator, which is congruent,
+*                       modulo 0xFFFF, to the sum of their 16-bit values.
+*
+*               (3) The 16-bit sum MUST be returned in Big Endian/Network order.  Since the sum of 16-bit
+*                   values can be computed in either byte order, the sum is calculated in Little Endian
+*                   order & only the folded 16-bit sum is swapped.
+*
+*                   See also 'net_util.c  NetUtil_16BitSumDataCalc()  Note #6b'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  NetUtil_16BitSumDataCalcAlign_32 (void        *pdata_32,
+                                              CPU_INT32U   size)
+{
+    const  CPU_INT08U  *p_data;
+    const  CPU_INT32U  *p_data_32;
+#if   defined(__AVX2__)
+    __m256i             zero_256;
+    __m256i             acc_256;
+    __m256i             data_256;
+#endif
+#if   defined(__AVX2__) || defined(__SSE2__)
+    __m128i             zero_128;
+    __m128i             acc_128;
+    __m128i             data_128;
+    CPU_INT32U          lanes[4];
+#endif
+    CPU_INT64U          sum_64;
+    CPU_INT16U          sum_16;
+
+
+    p_data = (const CPU_INT08U *)pdata_32;
+    sum_64 =  0u;
+
+#if   defined(__AVX2__) || defined(__SSE2__)
+    zero_128 = _mm_setzero_si128();
+    acc_128  = _mm_setzero_si128();
+
+#if   defined(__AVX2__)
+    zero_256 = _mm256_setzero_si256();
+    acc_256  = _mm256_setzero_si256();
+    while (size >= 32u) {                                       /* Calc sum of sixteen 16-bit values (see Note #2a).    */
+        data_256 = _mm256_loadu_si256((const __m256i *)p_data);
+        acc_256  = _mm256_add_epi32(acc_256, _mm256_unpacklo_epi16(data_256, zero_256));
+        acc_256  = _mm256_add_epi32(acc_256, _mm256_unpackhi_epi16(data_256, zero_256));
+        p_data  += 32u;
+        size    -= 32u;
+    }
+    acc_128 = _mm_add_epi32(_mm256_castsi256_si128(acc_256),    /* Combine 128-bit halves (see Note #2b).               */
+                            _mm256_extracti128_si256(acc_256, 1));
+#endif
+
+    while (size >= 16u) {                                       /* Calc sum of eight 16-bit values (see Note #2a).      */
+        data_128 = _mm_loadu_si128((const __m128i *)p_data);
+        acc_128  = _mm_add_epi32(acc_128, _mm_unpacklo_epi16(data_128, zero_128));
+        acc_128  = _mm_add_epi32(acc_128, _mm_unpackhi_epi16(data_128, zero_128));
+        p_data  += 16u;
+        size    -= 16u;
+    }
+
+    _mm_storeu_si128((__m128i *)&lanes[0], acc_128);            /* Combine lanes.                                       */
+    sum_64 = (CPU_INT64U)lanes[0] + (CPU_INT64U)lanes[1] +
+             (CPU_INT64U)lanes[2] + (CPU_INT64U)lanes[3];
+#endif
+
+    p_data_32 = (const CPU_INT32U *)p_data;
+    while (size >= sizeof(CPU_INT32U)) {                        /* Calc sum of rem'ing 32-bit words (see Note #2c).     */
+        sum_64 += (CPU_INT64U)*p_data_32++;
+        size   -=  sizeof(CPU_INT32U);
+    }
+
+    while ((sum_64 >> 16u) != 0u) {                             /* Fold sum into 16 bits.                               */
+        sum_64 = (sum_64 & 0x0000FFFFu) + (sum_64 >> 16u);
+    }
+    sum_16 = (CPU_INT16U)sum_64;
+    sum_16 = (CPU_INT16U)((sum_16 << 8u) | (sum_16 >> 8u));     /* Swap to net-order (see Note #3).                     */
+
+    return ((CPU_INT32U)sum_16);
+}
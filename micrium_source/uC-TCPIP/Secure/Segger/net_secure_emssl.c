@@ -722,10 +722,13 @@ static  int  NetSecure_emSSL_Rx (int    sock_id,
     ret_err = NetSock_RxDataHandlerStream( sock_id,
                                            p_sock,
                                            p_data_buf,
+                                           DEF_NULL,
+                                           0u,
                                            data_buf_len,
                                            flags,
                                            0u,
                                            0u,
+                                           DEF_NULL,
                                           &net_err);
     if (!block) {
         DEF_BIT_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_NO_BLOCK);
@@ -789,8 +792,11 @@ static  int  NetSecure_emSSL_Tx (       int    sock_id,
     result = NetSock_TxDataHandlerStream(        sock_id,
                                                  p_sock,
                                          (void *)p_data_buf,
+                                                 DEF_NULL,
+                                                 0u,
                                                  data_buf_len,
                                                  flags,
+                                                 DEF_NULL,
                                                 &net_err);
 
     return (result);
@@ -2004,10 +2010,13 @@ NET_SOCK_RTN_CODE  NetSecure_SockRxDataHandler (NET_SOCK    *p_sock,
         result = NetSock_RxDataHandlerStream( sock_id,
                                               p_sock,
                                               p_data_buf,
+                                              DEF_NULL,
+                                              0u,
                                               data_buf_len,
                                               NET_SOCK_FLAG_NONE,
                                               0u,
                                               0u,
+                                              DEF_NULL,
                                              &net_err);
         if (!block) {
             DEF_BIT_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_NO_BLOCK);
@@ -2136,8 +2145,11 @@ NET_SOCK_RTN_CODE  NetSecure_SockTxDataHandler (NET_SOCK    *p_sock,
         result = NetSock_TxDataHandlerStream( sock_id,
                                               p_sock,
                                               p_data_buf,
+                                              DEF_NULL,
+                                              0u,
                                               data_buf_len,
                                               NET_SOCK_FLAG_NONE,
+                                              DEF_NULL,
                                              &net_err);
     }
 
@@ -87,6 +87,14 @@ static  KAL_LOCK_HANDLE    Net_GlobalLock;
 
 static  void              *Net_GlobaLockFcntPtr;
 
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+static  NET_LOCK_STAT      Net_GlobalLockStat;                  /* Lock stats, times in CPU TS units ...                */
+                                                                /* ... (see 'Net_GlobalLockStatGet()  Note #2').        */
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+static  CPU_TS32           Net_GlobalLockTS_Acquired;           /* CPU TS of last lock acquisition.                     */
+#endif
+#endif
+
         CPU_INT32U         Net_Version = NET_VERSION;
 
 
@@ -100,6 +108,12 @@ static  void              *Net_GlobaLockFcntPtr;
 
 static void  Net_KAL_Init (NET_ERR  *p_err);
 
+#if ((NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED) && \
+     (CPU_CFG_TS_32_EN         == DEF_ENABLED))
+static  CPU_INT64U  Net_GlobalLockStatTS_to_us (CPU_INT64U       ts,
+                                                CPU_TS_TMR_FREQ  ts_tmr_freq);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -396,6 +410,9 @@ static void  Net_KAL_Init (NET_ERR  *p_err)
                                                                 /* Create network lock signal (see Note #1c).           */
     Net_GlobaLockFcntPtr = DEF_NULL;
    (void)&Net_GlobaLockFcntPtr;
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+    Mem_Clr(&Net_GlobalLockStat, sizeof(Net_GlobalLockStat));
+#endif
     Net_GlobalLock       = KAL_LockCreate((const CPU_CHAR *)NET_LOCK_GLOBAL_NAME,
                                                             DEF_NULL,
                                                            &err_kal);
@@ -544,20 +561,66 @@ void  Net_InitCompSignal (NET_ERR  *p_err)
 *                           from functioning.
 *
 *                   (b) Network access MUST be acquired exclusively by only a single task at any one time.
+*
+*               (2) If lock statistics are enabled (see 'net_cfg.h  NETWORK COUNTER MANAGEMENT
+*                   CONFIGURATION  Note #3') :
+*
+*                   (a) The lock is first tried without waiting; an acquisition is counted as contended if
+*                       the lock is already owned & must be waited on.
+*
+*                   (b) Lock statistics are updated ONLY while the lock is owned & are thus protected by
+*                       the lock itself.
 *********************************************************************************************************
 */
 
 void  Net_GlobalLockAcquire (void     *p_fcnt,
                              NET_ERR  *p_err)
 {
-    KAL_ERR  err_kal;
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+    CPU_BOOLEAN  contend;
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+    CPU_TS32     ts_wait_start;
+    CPU_TS32     ts_wait;
+#endif
+#endif
+    KAL_ERR      err_kal;
 
+
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+    ts_wait_start = CPU_TS_Get32();
+#endif
+    contend       = DEF_NO;
+                                                                /* Try lock without waiting (see Note #2a).             */
+    KAL_LockAcquire(Net_GlobalLock, KAL_OPT_PEND_NON_BLOCKING, KAL_TIMEOUT_INFINITE, &err_kal);
+    if (err_kal != KAL_ERR_NONE) {                              /* If lock owned (or try NOT supported by OS), ...      */
+        contend = (err_kal == KAL_ERR_WOULD_BLOCK) ? DEF_YES : DEF_NO;
+                                                                /* Acquire exclusive network access (see Note #1b) ...  */
+                                                                /* ... without timeout              (see Note #1a) ...  */
+        KAL_LockAcquire(Net_GlobalLock, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &err_kal);
+    }
+#else
                                                                 /* Acquire exclusive network access (see Note #1b) ...  */
                                                                 /* ... without timeout              (see Note #1a) ...  */
     KAL_LockAcquire(Net_GlobalLock, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &err_kal);
+#endif
     switch (err_kal) {
         case KAL_ERR_NONE:
              Net_GlobaLockFcntPtr = p_fcnt;
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)                   /* Update lock stats (see Note #2b).                    */
+             Net_GlobalLockStat.AcquireCtr++;
+             if (contend == DEF_YES) {
+                 Net_GlobalLockStat.ContendCtr++;
+             }
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+             Net_GlobalLockTS_Acquired          = CPU_TS_Get32();
+             ts_wait                            = Net_GlobalLockTS_Acquired - ts_wait_start;
+             Net_GlobalLockStat.WaitTimeTot_us += ts_wait;
+             if (Net_GlobalLockStat.WaitTimeMax_us < ts_wait) {
+                 Net_GlobalLockStat.WaitTimeMax_us = ts_wait;
+             }
+#endif
+#endif
             *p_err = NET_ERR_NONE;
              break;
 
@@ -605,9 +668,24 @@ void  Net_GlobalLockAcquire (void     *p_fcnt,
 
 void  Net_GlobalLockRelease (void)
 {
-    KAL_ERR  err_kal;
+#if ((NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED) && \
+     (CPU_CFG_TS_32_EN         == DEF_ENABLED))
+    CPU_TS32  ts_hold;
+#endif
+    KAL_ERR   err_kal;
 
 
+#if ((NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED) && \
+     (CPU_CFG_TS_32_EN         == DEF_ENABLED))
+                                                                /* Update lock hold stats while lock owned.             */
+    ts_hold                            = CPU_TS_Get32() - Net_GlobalLockTS_Acquired;
+    Net_GlobalLockStat.HoldTimeTot_us += ts_hold;
+    if (Net_GlobalLockStat.HoldTimeMax_us < ts_hold) {
+        Net_GlobalLockStat.HoldTimeMax_us     = ts_hold;
+        Net_GlobalLockStat.HoldTimeMaxFnctPtr = Net_GlobaLockFcntPtr;
+    }
+#endif
+
     Net_GlobaLockFcntPtr = DEF_NULL;
     KAL_LockRelease(Net_GlobalLock,  &err_kal);                 /* Release exclusive network access.                    */
 
@@ -616,6 +694,170 @@ void  Net_GlobalLockRelease (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                        Net_GlobalLockStatGet()
+*
+* Description : Get global network lock statistics.
+*
+* Argument(s) : p_stat  Pointer to variable that will receive the global network lock statistics.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           NET_ERR_NONE                  Lock statistics successfully returned.
+*                           NET_ERR_FAULT_NULL_PTR        Argument 'p_stat' passed a NULL pointer.
+*
+*                                                         -- RETURNED BY Net_GlobalLockAcquire() : --
+*                           NET_ERR_FAULT_LOCK_ACQUIRE    Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) Lock statistics include this function's own lock acquisition.
+*
+*               (2) (a) Lock wait & hold times are accumulated in CPU timestamp timer units & converted to
+*                       microseconds ONLY when returned.
+*
+*                   (b) Lock wait & hold times are returned as zero if the CPU timestamp timer frequency
+*                       is unknown.
+*
+*               (3) The lock owner which held the lock for the maximum hold time ('HoldTimeMaxFnctPtr') is
+*                   the function pointer passed to Net_GlobalLockAcquire() by the lock owner.
+*********************************************************************************************************
+*/
+
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+void  Net_GlobalLockStatGet (NET_LOCK_STAT  *p_stat,
+                             NET_ERR        *p_err)
+{
+    NET_LOCK_STAT    stat;
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+    CPU_TS_TMR_FREQ  ts_tmr_freq;
+    CPU_ERR          err_cpu;
+#endif
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_stat == DEF_NULL) {
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+#endif
+
+    Net_GlobalLockAcquire((void *)&Net_GlobalLockStatGet, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         return;
+    }
+
+    stat = Net_GlobalLockStat;
+
+    Net_GlobalLockRelease();
+
+                                                                /* Conv times to us (see Note #2).                      */
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+    ts_tmr_freq = CPU_TS_TmrFreqGet(&err_cpu);
+    if (err_cpu != CPU_ERR_NONE) {
+        ts_tmr_freq = 0u;
+    }
+
+    stat.WaitTimeTot_us =             Net_GlobalLockStatTS_to_us(stat.WaitTimeTot_us, ts_tmr_freq);
+    stat.WaitTimeMax_us = (CPU_INT32U)Net_GlobalLockStatTS_to_us(stat.WaitTimeMax_us, ts_tmr_freq);
+    stat.HoldTimeTot_us =             Net_GlobalLockStatTS_to_us(stat.HoldTimeTot_us, ts_tmr_freq);
+    stat.HoldTimeMax_us = (CPU_INT32U)Net_GlobalLockStatTS_to_us(stat.HoldTimeMax_us, ts_tmr_freq);
+#endif
+
+   *p_stat = stat;
+   *p_err  = NET_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Net_GlobalLockStatReset()
+*
+* Description : Reset global network lock statistics.
+*
+* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           NET_ERR_NONE                  Lock statistics successfully reset.
+*
+*                                                         -- RETURNED BY Net_GlobalLockAcquire() : --
+*                           NET_ERR_FAULT_LOCK_ACQUIRE    Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) This function's own lock hold time is accumulated after the reset.
+*********************************************************************************************************
+*/
+
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+void  Net_GlobalLockStatReset (NET_ERR  *p_err)
+{
+    Net_GlobalLockAcquire((void *)&Net_GlobalLockStatReset, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         return;
+    }
+
+    Mem_Clr(&Net_GlobalLockStat, sizeof(Net_GlobalLockStat));
+
+    Net_GlobalLockRelease();
+
+   *p_err = NET_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Net_GlobalLockStatTS_to_us()
+*
+* Description : Convert CPU timestamp timer units to microseconds.
+*
+* Argument(s) : ts              Time, in CPU timestamp timer units.
+*
+*               ts_tmr_freq     CPU timestamp timer frequency (in Hz).
+*
+* Return(s)   : Time, in microseconds, if CPU timestamp timer frequency known.
+*
+*               0,                     otherwise.
+*
+* Caller(s)   : Net_GlobalLockStatGet().
+*
+* Note(s)     : (1) Quotient & remainder are converted separately to avoid overflowing the multiplication by
+*                   DEF_TIME_NBR_uS_PER_SEC for large accumulated times.
+*********************************************************************************************************
+*/
+
+#if ((NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED) && \
+     (CPU_CFG_TS_32_EN         == DEF_ENABLED))
+static  CPU_INT64U  Net_GlobalLockStatTS_to_us (CPU_INT64U       ts,
+                                                CPU_TS_TMR_FREQ  ts_tmr_freq)
+{
+    CPU_INT64U  time_us;
+
+
+    if (ts_tmr_freq == 0u) {
+        return (0u);
+    }
+
+    time_us = ((ts / ts_tmr_freq) *  DEF_TIME_NBR_uS_PER_SEC)
+            + ((ts % ts_tmr_freq) *  DEF_TIME_NBR_uS_PER_SEC) / ts_tmr_freq;
+
+    return (time_us);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           Net_InitDflt()
@@ -65,6 +65,14 @@
 *                    task level, critical sections are NOT required to prevent task-level concurrency
 *                    in the network protocol suite.
 *
+*                (c) Contention on the global lock may be measured with Net_GlobalLockStatGet(), if
+*                    NET_CTR_CFG_LOCK_STAT_EN is enabled.
+*
+*                (d) The global lock is NOT split into per-interface, per-connection or buffer pool locks.
+*                    The ONLY application call section run with the global lock released is the copy of
+*                    TCP transmit data, if NET_TCP_CFG_TX_COPY_UNLOCK_EN is enabled (see 'net_tcp.c
+*                    NetTCP_TxConnAppData()  Note #13').
+*
 *            (4) To help debugging modules some value can be defined for internal usage:
 *
 *                (a) To configure the initial value of sequence numbers the following define should be
@@ -216,6 +224,7 @@
 #include  "net_cfg_net.h"
 #include  "net_err.h"
 #include  "net_type.h"
+#include  "net_ctr.h"
 
 
 
@@ -255,6 +264,38 @@
                                                          NET_TASK_NBR_TMR)
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  NETWORK LOCK STATISTICS DATA TYPE
+*
+* Note(s) : (1) Lock wait & hold times are in microseconds & require CPU timestamps (CPU_CFG_TS_32_EN);
+*               otherwise, ONLY the lock counters are updated.
+*********************************************************************************************************
+*/
+
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+typedef  struct  net_lock_stat {
+    NET_CTR      AcquireCtr;                                    /* Nbr of lock acquisitions.                            */
+    NET_CTR      ContendCtr;                                    /* Nbr of lock acquisitions that waited on lock owner.  */
+
+    CPU_INT64U   WaitTimeTot_us;                                /* Tot time waited on lock      (in us; see Note #1).   */
+    CPU_INT32U   WaitTimeMax_us;                                /* Max time waited on lock      (in us; see Note #1).   */
+
+    CPU_INT64U   HoldTimeTot_us;                                /* Tot time lock held           (in us; see Note #1).   */
+    CPU_INT32U   HoldTimeMax_us;                                /* Max time lock held           (in us; see Note #1).   */
+    void        *HoldTimeMaxFnctPtr;                            /* Lock owner that held lock for max hold time.         */
+} NET_LOCK_STAT;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -308,6 +349,13 @@ void        Net_TimeDly   (       CPU_INT32U     time_dly_sec,  /* Time delay of
 
 void        Net_InitDflt         (void);                        /* Initialize default values for configurable parameters.*/
 
+#if (NET_CTR_CFG_LOCK_STAT_EN == DEF_ENABLED)
+void        Net_GlobalLockStatGet  (NET_LOCK_STAT  *p_stat,     /* Get   global network lock statistics.                */
+                                    NET_ERR        *p_err);
+
+void        Net_GlobalLockStatReset(NET_ERR        *p_err);     /* Reset global network lock statistics.                */
+#endif
+
 
 /*
 *********************************************************************************************************
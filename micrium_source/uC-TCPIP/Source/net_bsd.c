@@ -250,6 +250,10 @@ static          CPU_BOOLEAN  NetBSD_AddrInfoSet    (struct  addrinfo
 static          void         NetBSD_AddrCfgValidate(        CPU_BOOLEAN           *p_ipv4_cfgd,
                                                             CPU_BOOLEAN           *p_ipv6_cfgd);
 
+static          CPU_BOOLEAN  NetBSD_IO_VecGet      (const  struct  iovec          *p_iov_bsd,
+                                                            int                    iov_cnt,
+                                                            NET_SOCK_IO_VEC       *p_iov);
+
 
 /*
 *********************************************************************************************************
@@ -957,6 +961,229 @@ ssize_t  recv (int      sock_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                              recvmsg()
+*
+* Description : Receive data from a socket, scattered into several application data buffers.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
+*
+*               p_msg           Pointer to a message header :
+*
+*                                   msg_name        Pointer to an address buffer that will receive the socket
+*                                                       address structure with the received data's remote
+*                                                       address, if NO error(s); NULL pointer, if NOT required.
+*                                   msg_namelen     Size of the address buffer; returns the actual size of the
+*                                                       remote address.
+*                                   msg_iov         Array of application data buffers (see Note #1).
+*                                   msg_iovlen      Number of application data buffers in array.
+*                                   msg_control     Ignored (see Note #2).
+*
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_PEEK                    Receive socket data without consuming
+*                                                                   the socket data.
+*                                   MSG_DONTWAIT                Receive socket data without blocking.
+*
+* Return(s)   : Number of positive data octets received, if NO error(s).
+*
+*                0,                                      if socket connection closed.
+*
+*               -1,                                      otherwise.
+*
+* Caller(s)   : recvmmsg(),
+*               Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) The received data is copied directly from the socket's receive buffer(s) into each
+*                   application data buffer in turn; the buffers receive the same data that one contiguous
+*                   buffer of their total size would receive via recvfrom().
+*
+*                   See also 'recvfrom()  Note #1'
+*                          & 'net_sock.c  NetSock_RxDataV()  Note #2'.
+*
+*               (2) Ancillary data is NOT supported; 'msg_controllen' & 'msg_flags' are always returned
+*                   cleared (see 'net_bsd.h  BSD 4.x SOCKET DATA TYPES  Note #6bA').
+*********************************************************************************************************
+*/
+
+ssize_t  recvmsg (        int      sock_id,
+                  struct  msghdr  *p_msg,
+                          int      flags)
+{
+    NET_SOCK_IO_VEC    iov[IOV_MAX];
+    CPU_BOOLEAN        valid;
+    ssize_t            rtn_code;
+    NET_SOCK_ADDR_LEN  addr_len;
+    NET_ERR            err;
+
+
+    if (p_msg == (struct msghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    valid = NetBSD_IO_VecGet(p_msg->msg_iov, p_msg->msg_iovlen, &iov[0]);
+    if (valid != DEF_OK) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    addr_len = 0;
+    if (p_msg->msg_name != (void *)0) {
+        addr_len = (NET_SOCK_ADDR_LEN)p_msg->msg_namelen;
+    }
+
+    rtn_code = (ssize_t)NetSock_RxDataV((NET_SOCK_ID        ) sock_id,
+                                        (NET_SOCK_IO_VEC   *)&iov[0],
+                                        (CPU_INT16U         ) p_msg->msg_iovlen,
+                                        (NET_SOCK_API_FLAGS ) flags,
+                                        (NET_SOCK_ADDR     *) p_msg->msg_name,
+                                        (NET_SOCK_ADDR_LEN *)&addr_len,
+                                        (NET_ERR           *)&err);
+
+    if (p_msg->msg_name != (void *)0) {
+        p_msg->msg_namelen = (socklen_t)addr_len;
+    }
+    p_msg->msg_controllen = 0;                                  /* See Note #2.                                         */
+    p_msg->msg_flags      = 0;
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             recvmmsg()
+*
+* Description : Receive several messages from a socket in a single call.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
+*
+*               p_msg_vec       Pointer to an array of message headers; each message's 'msg_len' returns the
+*                                   number of data octets received into that message (see 'recvmsg()').
+*
+*               msg_vec_len     Number of message headers in array.
+*
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_PEEK                    Receive socket data without consuming
+*                                                                   the socket data.
+*                                   MSG_DONTWAIT                Receive socket data without blocking.
+*
+* Return(s)   : Number of messages received, if NO error(s) [see Note #1].
+*
+*                0,                    if socket connection closed before any message received.
+*
+*               -1,                    otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) (a) Only the first message's receive blocks (unless MSG_DONTWAIT is requested); the
+*                       remaining messages are received without blocking so that the call returns as soon
+*                       as the socket's receive queue is drained.
+*
+*                   (b) Reception stops at the first message that fails; the number of messages received
+*                       so far is returned & the failed message is left for the next call to report.
+*
+*               (2) The receive timeout argument of common implementations is NOT supported; the socket's
+*                   configured receive timeout applies to the first message.
+*
+*               (3) Each message is received by its own call to recvmsg(), which acquires the global network
+*                   lock once per message (see 'sendmmsg()  Note #2').
+*********************************************************************************************************
+*/
+
+int  recvmmsg (                  int       sock_id,
+               struct  mmsghdr           *p_msg_vec,
+                       unsigned  int      msg_vec_len,
+                                 int      flags)
+{
+    unsigned  int  i;
+    ssize_t        rtn_code;
+
+
+    if (p_msg_vec == (struct mmsghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    for (i = 0u; i < msg_vec_len; i++) {
+        rtn_code = recvmsg(sock_id, &p_msg_vec[i].msg_hdr, flags);
+        if (rtn_code <= 0) {                                    /* Stop on first err (see Note #1b).                    */
+            if (i < 1u) {
+                return ((int)rtn_code);
+            }
+            break;
+        }
+        p_msg_vec[i].msg_len = (unsigned int)rtn_code;
+        flags               |=  MSG_DONTWAIT;                   /* Rx rem'ing msgs without blocking (see Note #1a).     */
+    }
+
+    return ((int)i);
+}
+
+
+/*
+*********************************************************************************************************
+*                                               readv()
+*
+* Description : Receive data from a socket, scattered into several application data buffers.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
+*
+*               p_iov           Pointer to an array of application data buffers.
+*
+*               iov_cnt         Number of application data buffers in array.
+*
+* Return(s)   : Number of positive data octets received, if NO error(s).
+*
+*                0,                                      if socket connection closed.
+*
+*               -1,                                      otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) readv() is equivalent to recvmsg() with no flags & no remote address (see 'recvmsg()
+*                   Note #1').
+*********************************************************************************************************
+*/
+
+ssize_t  readv (               int     sock_id,
+                const  struct  iovec  *p_iov,
+                               int     iov_cnt)
+{
+    NET_SOCK_IO_VEC  iov[IOV_MAX];
+    CPU_BOOLEAN      valid;
+    ssize_t          rtn_code;
+    NET_ERR          err;
+
+
+    valid = NetBSD_IO_VecGet(p_iov, iov_cnt, &iov[0]);
+    if (valid != DEF_OK) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    rtn_code = (ssize_t)NetSock_RxDataV((NET_SOCK_ID        ) sock_id,
+                                        (NET_SOCK_IO_VEC   *)&iov[0],
+                                        (CPU_INT16U         ) iov_cnt,
+                                        (NET_SOCK_API_FLAGS ) NET_SOCK_FLAG_NONE,
+                                        (NET_SOCK_ADDR     *) 0,
+                                        (NET_SOCK_ADDR_LEN *) 0,
+                                        (NET_ERR           *)&err);
+
+    return (rtn_code);
+}
+
+
 /*
 *********************************************************************************************************
 *                                              sendto()
@@ -1202,6 +1429,205 @@ ssize_t  send (int      sock_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                              sendmsg()
+*
+* Description : Send data through a socket, gathered from several application data buffers.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to send data.
+*
+*               p_msg           Pointer to a message header :
+*
+*                                   msg_name        Pointer to destination address buffer; required for
+*                                                       datagram sockets, optional for stream sockets.
+*                                   msg_namelen     Length of destination address buffer (in octets).
+*                                   msg_iov         Array of application data buffers (see Note #1).
+*                                   msg_iovlen      Number of application data buffers in array.
+*                                   msg_control     Ignored (see Note #2).
+*
+*               flags           Flags to select send options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_DONTWAIT                Send socket data without blocking.
+*
+* Return(s)   : Number of positive data octets sent, if NO error(s).
+*
+*                0,                                  if socket connection closed.
+*
+*               -1,                                  otherwise.
+*
+* Caller(s)   : sendmmsg(),
+*               Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) The application data buffers are copied in turn directly into the socket's transmit
+*                   buffer(s) & sent exactly as one contiguous buffer of the same data would be sent via
+*                   sendto() :
+*
+*                   (a) Datagram-type sockets send all buffers as a single, complete datagram.
+*                   (b) Stream-type   sockets coalesce the buffers into the same segment(s).
+*
+*                   See also 'sendto()  Note #1'
+*                          & 'net_sock.c  NetSock_TxDataV()  Note #2'.
+*
+*               (2) Ancillary data is NOT supported (see 'net_bsd.h  BSD 4.x SOCKET DATA TYPES  Note #6bA').
+*********************************************************************************************************
+*/
+
+ssize_t  sendmsg (               int      sock_id,
+                  const  struct  msghdr  *p_msg,
+                                 int      flags)
+{
+    NET_SOCK_IO_VEC  iov[IOV_MAX];
+    CPU_BOOLEAN      valid;
+    ssize_t          rtn_code;
+    NET_ERR          err;
+
+
+    if (p_msg == (const struct msghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    valid = NetBSD_IO_VecGet(p_msg->msg_iov, p_msg->msg_iovlen, &iov[0]);
+    if (valid != DEF_OK) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    rtn_code = (ssize_t)NetSock_TxDataV((NET_SOCK_ID       ) sock_id,
+                                        (NET_SOCK_IO_VEC  *)&iov[0],
+                                        (CPU_INT16U        ) p_msg->msg_iovlen,
+                                        (NET_SOCK_API_FLAGS) flags,
+                                        (NET_SOCK_ADDR    *) p_msg->msg_name,
+                                        (NET_SOCK_ADDR_LEN ) p_msg->msg_namelen,
+                                        (NET_ERR          *)&err);
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             sendmmsg()
+*
+* Description : Send several messages through a socket in a single call.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to send data.
+*
+*               p_msg_vec       Pointer to an array of message headers; each message's 'msg_len' returns the
+*                                   number of data octets sent from that message (see 'sendmsg()').
+*
+*               msg_vec_len     Number of message headers in array.
+*
+*               flags           Flags to select send options; bit-field flags logically OR'd :
+*
+*                                   0                           No socket flags selected.
+*                                   MSG_DONTWAIT                Send socket data without blocking.
+*
+* Return(s)   : Number of messages sent, if NO error(s) [see Note #1].
+*
+*                0,                 if socket connection closed before any message sent.
+*
+*               -1,                 otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) Transmission stops at the first message that fails; the number of messages sent so far
+*                   is returned & the failed message is left for the next call to report.
+*
+*               (2) Each message is sent by its own call to sendmsg(), which acquires the global network
+*                   lock once per message.  Thus sendmmsg() saves ONLY the application's per-message call.
+*********************************************************************************************************
+*/
+
+int  sendmmsg (                  int       sock_id,
+               struct  mmsghdr           *p_msg_vec,
+                       unsigned  int      msg_vec_len,
+                                 int      flags)
+{
+    unsigned  int  i;
+    ssize_t        rtn_code;
+
+
+    if (p_msg_vec == (struct mmsghdr *)0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    for (i = 0u; i < msg_vec_len; i++) {
+        rtn_code = sendmsg(sock_id, &p_msg_vec[i].msg_hdr, flags);
+        if (rtn_code <= 0) {                                    /* Stop on first err (see Note #1).                     */
+            if (i < 1u) {
+                return ((int)rtn_code);
+            }
+            break;
+        }
+        p_msg_vec[i].msg_len = (unsigned int)rtn_code;
+    }
+
+    return ((int)i);
+}
+
+
+/*
+*********************************************************************************************************
+*                                              writev()
+*
+* Description : Send data through a socket, gathered from several application data buffers.
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to send data.
+*
+*               p_iov           Pointer to an array of application data buffers.
+*
+*               iov_cnt         Number of application data buffers in array.
+*
+* Return(s)   : Number of positive data octets sent, if NO error(s).
+*
+*                0,                                  if socket connection closed.
+*
+*               -1,                                  otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) writev() is equivalent to sendmsg() with no flags & no destination address (see
+*                   'sendmsg()  Note #1').
+*********************************************************************************************************
+*/
+
+ssize_t  writev (               int     sock_id,
+                 const  struct  iovec  *p_iov,
+                                int     iov_cnt)
+{
+    NET_SOCK_IO_VEC  iov[IOV_MAX];
+    CPU_BOOLEAN      valid;
+    ssize_t          rtn_code;
+    NET_ERR          err;
+
+
+    valid = NetBSD_IO_VecGet(p_iov, iov_cnt, &iov[0]);
+    if (valid != DEF_OK) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+    rtn_code = (ssize_t)NetSock_TxDataV((NET_SOCK_ID       ) sock_id,
+                                        (NET_SOCK_IO_VEC  *)&iov[0],
+                                        (CPU_INT16U        ) iov_cnt,
+                                        (NET_SOCK_API_FLAGS) NET_SOCK_FLAG_NONE,
+                                        (NET_SOCK_ADDR    *) 0,
+                                        (NET_SOCK_ADDR_LEN ) 0,
+                                        (NET_ERR          *)&err);
+
+    return (rtn_code);
+}
+
+
 /*
 *********************************************************************************************************
 *                                              select()
@@ -1533,6 +1959,196 @@ int  select (        int       desc_nbr_max,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                               poll()
+*
+* Description : Check an array of file descriptors for available resources &/or operations.
+*
+* Argument(s) : p_fds           Pointer to an array of 'pollfd' structures, each holding a file descriptor,
+*                                   the events requested for it & the events returned for it (see Note #1a).
+*
+*               nfds            Number of 'pollfd' structures in the array.
+*
+*               timeout_ms      Timeout, in milliseconds (see Note #1b) :
+*
+*                                   -1      Block until at least one requested event occurs.
+*                                    0      Return immediately (i.e. poll).
+*                                   >0      Block until an event occurs or the timeout expires.
+*
+* Return(s)   : Number of 'pollfd' structures with a non-zero 'revents' member, if any (see Note #1c1).
+*
+*                0,                                                  on timeout (see Note #1c1).
+*
+*               -1,                                                  otherwise  (see Note #1c2).
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) (a) IEEE Std 1003.1, 2004 Edition, Section 'poll() : DESCRIPTION' states that :
+*
+*                       (1) "The 'fd' member of each 'pollfd' structure ... is an open file descriptor.
+*                            The 'events' member is a bitmask constructed by OR'ing a combination of" the
+*                            poll flags.  "The 'revents' member is a bitmask" of the events that occurred.
+*
+*                       (2) "POLLHUP, POLLERR, and POLLNVAL shall always be set in 'revents' if the event
+*                            they indicate is true, even if it was not specified in 'events'."
+*
+*                       (3) "If the value of 'fd' is less than 0, 'events' shall be ignored, and 'revents'
+*                            shall be set to 0."
+*
+*                   (b) "If the value of 'timeout' is 0, poll() shall return immediately.  If the value of
+*                        'timeout' is -1, poll() shall block until a requested event occurs."
+*
+*                   (c) (1) "Upon successful completion, poll() shall return a non-negative value ...
+*                            indicating the number of 'pollfd' structures ... with a non-zero 'revents'
+*                            member."  "A value of 0 indicates that the call timed out."
+*
+*                       (2) "Otherwise, -1 shall be returned."  'errno' NOT currently supported
+*                           (see 'net_bsd.c  Note #1b').
+*
+*               (2) (a) poll() is implemented on top of NetSock_Sel() : requested events are translated
+*                       into socket descriptor sets & the sets returned by NetSock_Sel() are translated
+*                       back into each structure's 'revents' member.
+*
+*                   (b) Since NetSock_Sel() does NOT distinguish a hang-up from any other socket error,
+*                       a closed or failed connection is returned as POLLERR, along with POLLIN &/or
+*                       POLLOUT if requested.  POLLHUP is never returned.
+*
+*                   (c) A file descriptor beyond the socket descriptor range is returned as POLLNVAL.
+*                       A file descriptor in range that is NOT an open socket fails the whole call, as
+*                       for select().
+*
+*                   See also 'net_sock.c  NetSock_Sel()  Note #3'.
+*********************************************************************************************************
+*/
+
+#if    (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+int  poll (struct  pollfd  *p_fds,
+                   nfds_t   nfds,
+                   int      timeout_ms)
+{
+    struct  fd_set     desc_rd;
+    struct  fd_set     desc_wr;
+    struct  fd_set     desc_err;
+    struct  timeval    timeout;
+    struct  timeval   *p_timeout;
+    struct  pollfd    *p_fd;
+            nfds_t     ix;
+            int        desc_nbr_max;
+            int        nbr_rdy;
+            int        rtn_code;
+            short      revents;
+
+
+    if ((p_fds == DEF_NULL) &&
+        (nfds  >  0u)) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+                                                                /* ---------- CONV REQ'D EVENTS TO DESC SETS ---------- */
+    FD_ZERO(&desc_rd);
+    FD_ZERO(&desc_wr);
+    FD_ZERO(&desc_err);
+
+    desc_nbr_max = 0;
+    nbr_rdy      = 0;
+    p_fd         = p_fds;
+
+    for (ix = 0u; ix < nfds; ix++) {
+        p_fd->revents = 0;
+
+        if (p_fd->fd < 0) {                                     /* Ignore neg fd's (see Note #1a3).                     */
+            p_fd++;
+            continue;
+        }
+
+        if (p_fd->fd > FD_MAX) {                                /* Rtn invalid fd's as POLLNVAL (see Note #2c).         */
+            p_fd->revents = POLLNVAL;
+            nbr_rdy++;
+            p_fd++;
+            continue;
+        }
+
+        if ((p_fd->events & (POLLIN | POLLRDNORM)) != 0) {
+            FD_SET(p_fd->fd, &desc_rd);
+        }
+        if ((p_fd->events &  POLLOUT             ) != 0) {
+            FD_SET(p_fd->fd, &desc_wr);
+        }
+        FD_SET(p_fd->fd, &desc_err);                            /* Errs always chk'd (see Note #1a2).                   */
+
+        desc_nbr_max = DEF_MAX(desc_nbr_max, p_fd->fd + 1);
+        p_fd++;
+    }
+
+                                                                /* -------------------- CONV TIMEOUT ------------------ */
+    if ((timeout_ms == 0) ||
+        (nbr_rdy     > 0)) {                                    /* If any fd already rdy, do NOT block.                 */
+        timeout.tv_sec  = 0;
+        timeout.tv_usec = 0;
+        p_timeout       = &timeout;
+
+    } else if (timeout_ms < 0) {                                /* Block until evt (see Note #1b).                      */
+        p_timeout       = DEF_NULL;
+
+    } else {
+        timeout.tv_sec  = (_time_t   )( (CPU_INT32U)timeout_ms / DEF_TIME_NBR_mS_PER_SEC);
+        timeout.tv_usec = (suseconds_t)(((CPU_INT32U)timeout_ms % DEF_TIME_NBR_mS_PER_SEC) *
+                                        (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC));
+        p_timeout       = &timeout;
+    }
+
+    if (desc_nbr_max == 0) {                                    /* If NO valid fd's, ...                                */
+        if ((nbr_rdy    >  0) ||                                /* ... & any invalid fd or NO blocking, rtn.            */
+            (timeout_ms == 0)) {
+            return (nbr_rdy);
+        }
+    }
+
+    rtn_code = select(desc_nbr_max,
+                     &desc_rd,
+                     &desc_wr,
+                     &desc_err,
+                      p_timeout);
+    if (rtn_code < 0) {
+        return (NET_BSD_ERR_DFLT);
+    }
+
+                                                                /* ---------- CONV RDY DESC SETS TO RTN EVENTS -------- */
+    p_fd = p_fds;
+    for (ix = 0u; ix < nfds; ix++) {
+        if ((p_fd->fd <  0) ||
+            (p_fd->fd >  FD_MAX)) {
+            p_fd++;
+            continue;
+        }
+
+        revents = 0;
+        if (FD_ISSET(p_fd->fd, &desc_rd)) {
+            revents |= (p_fd->events & (POLLIN | POLLRDNORM));
+        }
+        if (FD_ISSET(p_fd->fd, &desc_wr)) {
+            revents |=  POLLOUT;
+        }
+        if (FD_ISSET(p_fd->fd, &desc_err)) {
+            revents |=  POLLERR;                                /* See Note #2b.                                        */
+        }
+
+        p_fd->revents = revents;
+        if (revents != 0) {
+            nbr_rdy++;
+        }
+        p_fd++;
+    }
+
+    return (nbr_rdy);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             inet_addr()
@@ -3747,4 +4363,55 @@ static  void  NetBSD_AddrCfgValidate (CPU_BOOLEAN  *p_ipv4_cfgd,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetBSD_IO_VecGet()
+*
+* Description : Convert an array of BSD 'iovec' structures to network socket I/O vectors.
+*
+* Argument(s) : p_iov_bsd       Pointer to an array of BSD 'iovec' structures.
+*
+*               iov_cnt         Number of 'iovec' structures in array.
+*
+*               p_iov           Pointer to an array of at least IOV_MAX network socket I/O vectors that will
+*                                   receive the converted I/O vectors.
+*
+* Return(s)   : DEF_OK,   if I/O vectors successfully converted.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : recvmsg(),
+*               readv(),
+*               sendmsg(),
+*               writev().
+*
+* Note(s)     : (1) IEEE Std 1003.1, 2004 Edition, Section 'readv() : ERRORS' states to fail when "the
+*                   'iovcnt' argument was less than or equal to 0, or greater than {IOV_MAX}".
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetBSD_IO_VecGet (const  struct  iovec            *p_iov_bsd,
+                                                      int               iov_cnt,
+                                                      NET_SOCK_IO_VEC  *p_iov)
+{
+    int  i;
+
+
+    if (p_iov_bsd == (const struct iovec *)0) {
+        return (DEF_FAIL);
+    }
+    if ((iov_cnt < 1) ||                                        /* See Note #1.                                         */
+        (iov_cnt > IOV_MAX)) {
+        return (DEF_FAIL);
+    }
+
+    for (i = 0; i < iov_cnt; i++) {
+        p_iov[i].DataPtr = (void     *)p_iov_bsd[i].iov_base;
+        p_iov[i].DataLen = (CPU_SIZE_T)p_iov_bsd[i].iov_len;
+    }
+
+    return (DEF_OK);
+}
+
+
 #endif  /* NET_SOCK_BSD_EN */
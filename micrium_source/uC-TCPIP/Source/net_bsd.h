@@ -116,10 +116,14 @@
 #define  NI_MAXHOST                              1025u
 #define  NI_MAXSERV                                32u
 
+                                                                /* ------------------ SCATTER/GATHER ------------------ */
+#undef   IOV_MAX
+#define  IOV_MAX                                   16           /* See Note #6d in "BSD 4.x SOCKET DATA TYPES" sect.    */
+
                                                                 /* ------------------ FILE DESC SETS ------------------ */
 #define  FD_SETSIZE                NET_SOCK_NBR_SOCK            /* See Note #5a2A in "BSD 4.x SOCKET DATA TYPES" sect.  */
 #define  FD_MIN                                 0               /* See Note #5a2B in "BSD 4.x SOCKET DATA TYPES" sect.  */
-#define  FD_MAX                   (FD_SETSIZE - 1)
+#define  FD_MAX            ((int)(FD_SETSIZE) - 1)            /* See Note #5a2C in "BSD 4.x SOCKET DATA TYPES" sect.  */
 #define  FD_ARRAY_SIZE          (((FD_SETSIZE - 1) / (sizeof(CPU_DATA) * DEF_OCTET_NBR_BITS)) + 1)
 
 
@@ -273,6 +277,30 @@
 #define  NI_DGRAM                 DEF_BIT_04
 #define  NET_BSD_NI_MAX_FLAG     (NI_NOFQDN | NI_NUMERICHOST | NI_NAMEREQD |NI_NUMERICSERV | NI_DGRAM)
 
+
+/*
+*********************************************************************************************************
+*                                        BSD 4.x POLL DEFINES
+*
+* Note(s) : (1) IEEE Std 1003.1, 2004 Edition, Section 'poll.h : DESCRIPTION' states that "the following
+*               symbolic constants shall be defined, zero or more of which may be OR'ed together to form
+*               the 'events' or 'revents' members in the 'pollfd' structure".
+*
+*           (2) POLLPRI, POLLRDBAND & POLLWRBAND are NOT currently supported & are never returned.
+*********************************************************************************************************
+*/
+
+#define  POLLIN                   DEF_BIT_00                    /* Data other than high-priority data may be rd.        */
+#define  POLLRDNORM               DEF_BIT_01                    /* Normal data may be rd.                               */
+#define  POLLRDBAND               DEF_BIT_02                    /* Priority data may be rd       (see Note #2).         */
+#define  POLLPRI                  DEF_BIT_03                    /* High-priority data may be rd  (see Note #2).         */
+#define  POLLOUT                  DEF_BIT_04                    /* Normal data may be wr.                               */
+#define  POLLWRNORM               POLLOUT                       /* Equivalent to POLLOUT.                               */
+#define  POLLWRBAND               DEF_BIT_05                    /* Priority data may be wr       (see Note #2).         */
+#define  POLLERR                  DEF_BIT_06                    /* An err has occurred           (rtn'd only).          */
+#define  POLLHUP                  DEF_BIT_07                    /* Device has been disconnected  (rtn'd only).          */
+#define  POLLNVAL                 DEF_BIT_08                    /* Invalid fd member             (rtn'd only).          */
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -409,6 +437,9 @@
 *                       (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
 *                           6th Printing, Section 6.3, Page 163 states that "descriptors start at 0".
 *
+*                       (C) Since file descriptors are signed integers, FD_MAX is defined as a signed
+*                           integer so that descriptors are NOT compared against an unsigned maximum.
+*
 *               (b) Ideally, the BSD 4.x Layer's 'fd_set' data type would be the basis for the Network
 *                   Socket Layer's 'NET_SOCK_DESC' data type definition.  However, since the BSD 4.x
 *                   Layer application programming interface (API) is NOT guaranteed to be present in the
@@ -420,6 +451,37 @@
 *                   of these data types MUST be appropriately synchronized.
 *
 *               See also 'net_sock.h  NETWORK SOCKET (IDENTIFICATION) DESCRIPTOR SET DATA TYPE  Note #1'.
+*
+*           (6) (a) IEEE Std 1003.1, 2004 Edition, Section 'sys/uio.h : DESCRIPTION' states that "the
+*                   'iovec' structure ... includes at least the following members" :
+*
+*                   (1) void     *iov_base    Base address of a memory region for input or output
+*                   (2) size_t    iov_len     The size of the memory pointed to by iov_base
+*
+*               (b) IEEE Std 1003.1, 2004 Edition, Section 'sys/socket.h : DESCRIPTION' states that "the
+*                   'msghdr' structure ... includes at least the following members" :
+*
+*                   (1) void          *msg_name        Optional address
+*                   (2) socklen_t      msg_namelen     Size of address
+*                   (3) struct iovec  *msg_iov         Scatter/gather array
+*                   (4) int            msg_iovlen      Members in msg_iov
+*                   (5) void          *msg_control     Ancillary data
+*                   (6) socklen_t      msg_controllen  Ancillary data buffer len
+*                   (7) int            msg_flags       Flags on received message
+*
+*                   (A) Ancillary data is NOT currently supported; 'msg_control' is ignored on send & no
+*                       ancillary data is ever returned on receive.
+*
+*               (c) The 'mmsghdr' structure is NOT defined by IEEE Std 1003.1 but follows the de-facto
+*                   definition used by sendmmsg() & recvmmsg() to batch several messages into one call.
+*
+*               (d) IEEE Std 1003.1, 2004 Edition, Section 'limits.h : DESCRIPTION' states that IOV_MAX
+*                   is the "maximum number of 'iovec' structures that one process has available for use
+*                   with readv() or writev()".
+*
+*                   (1) Each call converts its 'iovec' array to a local array of network socket I/O vectors
+*                       (see 'net_sock.h  NETWORK SOCKET I/O VECTOR DATA TYPE'); thus IOV_MAX SHOULD be
+*                       kept small to bound each calling task's stack usage.
 *********************************************************************************************************
 */
 
@@ -493,6 +555,35 @@ struct  fd_set {                                                        /* See N
     CPU_DATA              fds_bits[FD_ARRAY_SIZE];
 };
 
+
+typedef  CPU_INT32U       nfds_t;                                       /* Nbr of poll fd's type.                       */
+
+struct  pollfd {                                                        /* See 'BSD 4.x POLL DEFINES  Note #1'.         */
+    int                   fd;                                           /* Sock desc to poll.                           */
+    short                 events;                                       /* Req'd     events.                            */
+    short                 revents;                                      /* Rtn'd     events.                            */
+};
+
+struct  iovec {                                                         /* See Note #6a.                                */
+    void                 *iov_base;                                     /* Base addr of data buf.                       */
+   _size_t                iov_len;                                      /* Size      of data buf (in octets).           */
+};
+
+struct  msghdr {                                                        /* See Note #6b.                                */
+    void                 *msg_name;                                     /* Opt'l sock addr.                             */
+    socklen_t             msg_namelen;                                  /* Size of sock addr.                           */
+    struct  iovec        *msg_iov;                                      /* Scatter/gather array.                        */
+    int                   msg_iovlen;                                   /* Nbr of elements in 'msg_iov'.                */
+    void                 *msg_control;                                  /* Ancillary data (see Note #6bA).              */
+    socklen_t             msg_controllen;                               /* Ancillary data buf len.                      */
+    int                   msg_flags;                                    /* Flags on rx'd msg.                           */
+};
+
+struct  mmsghdr {                                                       /* See Note #6c.                                */
+    struct  msghdr        msg_hdr;                                      /* Msg hdr.                                     */
+    unsigned  int         msg_len;                                      /* Nbr of octets rx'd/tx'd for msg.             */
+};
+
 struct  addrinfo {                                                      /* Structure and type definitions for addrinfo. */
             int           ai_flags;                                     /* Flags: AI_PASSIVE, AI_AI_NUMERICHOST, etc.   */
             int           ai_family;                                    /* Address family: AF_xxx.                      */
@@ -797,6 +888,19 @@ extern "C" {
                                                 _size_t      data_buf_len,
                                                  int         flags);
 
+       ssize_t       recvmsg     (               int         sock_id,
+                                         struct  msghdr     *p_msg,
+                                                 int         flags);
+
+       int           recvmmsg    (               int         sock_id,
+                                         struct  mmsghdr    *p_msg_vec,
+                                        unsigned int         msg_vec_len,
+                                                 int         flags);
+
+       ssize_t       readv       (               int         sock_id,
+                                  const  struct  iovec      *p_iov,
+                                                 int         iov_cnt);
+
 
                                                                         /* ----------------- TX FNCTS ----------------- */
        ssize_t       sendto      (               int         sock_id,
@@ -811,6 +915,19 @@ extern "C" {
                                                 _size_t      data_len,
                                                  int         flags);
 
+       ssize_t       sendmsg     (               int         sock_id,
+                                  const  struct  msghdr     *p_msg,
+                                                 int         flags);
+
+       int           sendmmsg    (               int         sock_id,
+                                         struct  mmsghdr    *p_msg_vec,
+                                        unsigned int         msg_vec_len,
+                                                 int         flags);
+
+       ssize_t       writev      (               int         sock_id,
+                                  const  struct  iovec      *p_iov,
+                                                 int         iov_cnt);
+
 
                                                                         /* ------------ MULTIPLEX I/O FNCTS ----------- */
        int           select      (               int         desc_nbr_max,
@@ -819,6 +936,10 @@ extern "C" {
                                          struct  fd_set     *p_desc_err,
                                          struct  timeval    *p_timeout);
 
+       int           poll        (       struct  pollfd     *p_fds,
+                                                 nfds_t      nfds,
+                                                 int         timeout_ms);
+
 
                                                                         /* ---------------- CONV FCNTS ---------------- */
        in_addr_t     inet_addr   (               char       *p_addr);
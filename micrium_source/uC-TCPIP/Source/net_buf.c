@@ -91,6 +91,33 @@ static  void  NetBuf_Discard    (NET_IF_NBR      if_nbr,
                                  void           *p_buf,
                                  NET_STAT_POOL  *pstat_pool);
 
+static  void *NetBuf_PoolBlkGet (NET_BUF_POOLS  *ppool,
+                                 NET_BUF_TYPE    type,
+                                 MEM_POOL       *pmem_pool,
+                                 CPU_SIZE_T      size,
+                                 LIB_ERR        *p_err);
+
+static  void  NetBuf_PoolBlkFree(NET_BUF_POOLS  *ppool,
+                                 NET_BUF_TYPE    type,
+                                 MEM_POOL       *pmem_pool,
+                                 void           *p_blk,
+                                 LIB_ERR        *p_err);
+
+#ifdef  NET_BUF_CACHE_MODULE_EN
+static  NET_BUF_CACHE  *NetBuf_CacheGet(NET_BUF_POOLS  *ppool,
+                                        NET_BUF_TYPE    type);
+#endif
+
+static  void  NetBuf_DataV      (NET_BUF        *p_buf,
+                                 NET_BUF_SIZE    ix,
+                                 NET_BUF_SIZE    len,
+                                 NET_BUF_IO_VEC *p_iov,
+                                 CPU_INT16U      iov_cnt,
+                                 CPU_SIZE_T      iov_offset,
+                                 CPU_BOOLEAN     wr,
+                                 CPU_BOOLEAN     sum,
+                                 NET_ERR        *p_err);
+
 
 /*
 *********************************************************************************************************
@@ -99,7 +126,8 @@ static  void  NetBuf_Discard    (NET_IF_NBR      if_nbr,
 * Description : (1) Initialize Network Buffer Management Module :
 *
 *                   (a) Initialize network buffer pools
-*                   (b) Initialize network buffer ID counter
+*                   (b) Initialize network buffer caches
+*                   (c) Initialize network buffer ID counter
 *
 *
 * Argument(s) : none.
@@ -136,6 +164,11 @@ void  NetBuf_Init (void)
         NetStat_PoolClr(&ppool->RxBufLargeStatPool, &err_stat);
         NetStat_PoolClr(&ppool->TxBufLargeStatPool, &err_stat);
         NetStat_PoolClr(&ppool->TxBufSmallStatPool, &err_stat);
+#ifdef  NET_BUF_CACHE_MODULE_EN                                 /* Clr net buf caches.                                  */
+        Mem_Clr(&ppool->NetBufCache,     sizeof(NET_BUF_CACHE));
+        Mem_Clr(&ppool->TxBufLargeCache, sizeof(NET_BUF_CACHE));
+        Mem_Clr(&ppool->TxBufSmallCache, sizeof(NET_BUF_CACHE));
+#endif
         ppool++;
     }
 
@@ -580,9 +613,11 @@ NET_BUF  *NetBuf_Get (NET_IF_NBR        if_nbr,
     ppool      = (NET_BUF_POOLS *)&NetBuf_PoolsTbl[if_nbr];
     pmem_pool  = (MEM_POOL      *)&ppool->NetBufPool;
     pstat_pool = (NET_STAT_POOL *)&ppool->NetBufStatPool;
-    p_buf      = (NET_BUF       *) Mem_PoolBlkGet((MEM_POOL *) pmem_pool,
-                                                  (CPU_SIZE_T) sizeof(NET_BUF),
-                                                  (LIB_ERR  *)&err_lib);
+    p_buf      = (NET_BUF       *) NetBuf_PoolBlkGet((NET_BUF_POOLS *) ppool,
+                                                     (NET_BUF_TYPE   ) NET_BUF_TYPE_BUF,
+                                                     (MEM_POOL      *) pmem_pool,
+                                                     (CPU_SIZE_T     ) sizeof(NET_BUF),
+                                                     (LIB_ERR       *)&err_lib);
     if (err_lib != LIB_MEM_ERR_NONE) {
         NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NoneAvailCtr);
        *p_err =   NET_BUF_ERR_NONE_AVAIL;
@@ -623,9 +658,11 @@ NET_BUF  *NetBuf_Get (NET_IF_NBR        if_nbr,
                                                &type,
                                                 p_err);
              if (*p_err != NET_BUF_ERR_NONE) {
-                  Mem_PoolBlkFree(pmem_pool,
-                                  p_buf,
-                                 &err_lib);
+                  NetBuf_PoolBlkFree(ppool,
+                                     NET_BUF_TYPE_BUF,
+                                     pmem_pool,
+                                     p_buf,
+                                    &err_lib);
                   if (err_lib == LIB_MEM_ERR_NONE) {
                       NetStat_PoolEntryUsedDec(pstat_pool, &err_stat);
                   } else {
@@ -643,9 +680,11 @@ NET_BUF  *NetBuf_Get (NET_IF_NBR        if_nbr,
 
         case NET_TRANSACTION_NONE:
         default:
-             Mem_PoolBlkFree((MEM_POOL *) pmem_pool,
-                             (void     *) p_buf,
-                             (LIB_ERR  *)&err_lib);
+             NetBuf_PoolBlkFree((NET_BUF_POOLS *) ppool,
+                                (NET_BUF_TYPE   ) NET_BUF_TYPE_BUF,
+                                (MEM_POOL      *) pmem_pool,
+                                (void          *) p_buf,
+                                (LIB_ERR       *)&err_lib);
              if (err_lib == LIB_MEM_ERR_NONE) {
                  NetStat_PoolEntryUsedDec(pstat_pool, &err_stat);
              } else {
@@ -767,6 +806,11 @@ NET_BUF  *NetBuf_Get (NET_IF_NBR        if_nbr,
 *               (8) Buffer memory cleared in NetBuf_GetDataPtr() instead of in NetBuf_Free() handlers so
 *                   that the data in any freed buffer data area may be inspected until that buffer data
 *                   area is next allocated.
+*
+*               (9) Transmit buffer data areas are ONLY allocated by the network protocol suite, with the
+*                   global network lock acquired, & may thus be allocated from the interface's network
+*                   buffer caches.  Receive buffer data areas are ALWAYS allocated from the shared pool
+*                   (see 'NetBuf_PoolBlkGet()  Note #1c').
 *********************************************************************************************************
 */
 
@@ -903,10 +947,12 @@ CPU_INT08U  *NetBuf_GetDataPtr (NET_IF           *pif,
                   type       =  NET_BUF_TYPE_TX_SMALL;
                   pmem_pool  = &ppool->TxBufSmallPool;
                   pstat_pool = &ppool->TxBufSmallStatPool;
-                                                                /* .. get a small tx buf data area.                     */
-                  p_data     = (CPU_INT08U *)Mem_PoolBlkGet((MEM_POOL *) pmem_pool,
-                                                            (CPU_SIZE_T) size_len,
-                                                            (LIB_ERR  *)&err_lib);
+                                                                /* .. get a small tx buf data area (see Note #9).       */
+                  p_data     = (CPU_INT08U *)NetBuf_PoolBlkGet((NET_BUF_POOLS *) ppool,
+                                                               (NET_BUF_TYPE   ) type,
+                                                               (MEM_POOL      *) pmem_pool,
+                                                               (CPU_SIZE_T     ) size_len,
+                                                               (LIB_ERR       *)&err_lib);
              }
 
              if ((p_data == (CPU_INT08U *)0)     &&             /* If small tx bufs NOT avail     (see Note #6b1); OR ..*/
@@ -916,10 +962,12 @@ CPU_INT08U  *NetBuf_GetDataPtr (NET_IF           *pif,
                   type       =  NET_BUF_TYPE_TX_LARGE;
                   pmem_pool  = &ppool->TxBufLargePool;
                   pstat_pool = &ppool->TxBufLargeStatPool;
-                                                                /* .. get a large tx buf data area.                     */
-                  p_data     = (CPU_INT08U *)Mem_PoolBlkGet((MEM_POOL *) pmem_pool,
-                                                            (CPU_SIZE_T) size_len,
-                                                            (LIB_ERR  *)&err_lib);
+                                                                /* .. get a large tx buf data area (see Note #9).       */
+                  p_data     = (CPU_INT08U *)NetBuf_PoolBlkGet((NET_BUF_POOLS *) ppool,
+                                                               (NET_BUF_TYPE   ) type,
+                                                               (MEM_POOL      *) pmem_pool,
+                                                               (CPU_SIZE_T     ) size_len,
+                                                               (LIB_ERR       *)&err_lib);
              }
 
              if (size_len > size_data) {                        /* If tot req'd size > avail buf size, ...              */
@@ -1939,6 +1987,173 @@ void  NetBuf_DataWr (NET_BUF       *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          NetBuf_DataRdV()
+*
+* Description : Read data from network buffer's DATA area, scattered into an array of I/O vectors.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to read.
+*
+*               p_iov       Pointer to array of I/O vectors to read data into (see Note #1).
+*
+*               iov_cnt     Number of I/O vectors in array.
+*
+*               iov_offset  Offset into the I/O vectors' data, in octets, at which to start reading into.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Read from network buffer DATA area successful.
+*
+*                                                               - RETURNED BY NetBuf_DataV() : -
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_iov' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area or
+*                                                                   beyond the I/O vectors' data).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) I/O vectors' data area sizes NOT validated; buffer overruns MUST be prevented by caller.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataRdV (NET_BUF         *p_buf,
+                      NET_BUF_SIZE     ix,
+                      NET_BUF_SIZE     len,
+                      NET_BUF_IO_VEC  *p_iov,
+                      CPU_INT16U       iov_cnt,
+                      CPU_SIZE_T       iov_offset,
+                      NET_ERR         *p_err)
+{
+    NetBuf_DataV(p_buf, ix, len, p_iov, iov_cnt, iov_offset, DEF_NO, DEF_NO, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBuf_DataWrV()
+*
+* Description : Write data into network buffer's DATA area, gathered from an array of I/O vectors.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to write.
+*
+*               p_iov       Pointer to array of I/O vectors to write data from.
+*
+*               iov_cnt     Number of I/O vectors in array.
+*
+*               iov_offset  Offset into the I/O vectors' data, in octets, at which to start writing from.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Write to network buffer DATA area successful.
+*
+*                                                               - RETURNED BY NetBuf_DataV() : -
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_iov' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area or
+*                                                                   beyond the I/O vectors' data).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppData(),
+*               NetUDP_TxAppDataHandlerIPv4(),
+*               NetUDP_TxAppDataHandlerIPv6().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataWrV (NET_BUF         *p_buf,
+                      NET_BUF_SIZE     ix,
+                      NET_BUF_SIZE     len,
+                      NET_BUF_IO_VEC  *p_iov,
+                      CPU_INT16U       iov_cnt,
+                      CPU_SIZE_T       iov_offset,
+                      NET_ERR         *p_err)
+{
+    NetBuf_DataV(p_buf, ix, len, p_iov, iov_cnt, iov_offset, DEF_YES, DEF_NO, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBuf_DataWrSumV()
+*
+* Description : Write data into network buffer's DATA area, gathered from an array of I/O vectors, &
+*                   calculate the written data's 16-bit one's-complement sum while copying it.
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to write.
+*
+*               p_iov       Pointer to array of I/O vectors to write data from.
+*
+*               iov_cnt     Number of I/O vectors in array.
+*
+*               iov_offset  Offset into the I/O vectors' data, in octets, at which to start writing from.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Write to network buffer DATA area successful.
+*
+*                                                               - RETURNED BY NetBuf_DataV() : -
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_iov' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area or
+*                                                                   beyond the I/O vectors' data).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppData(),
+*               NetUDP_TxAppDataHandlerIPv4(),
+*               NetUDP_TxAppDataHandlerIPv6().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The data's sum is cached in the buffer header's 'DataChkSum' & covers the 'DataChkSumLen'
+*                   octets at 'DataChkSumIx'.  NetUtil_16BitOnesCplSumDataCalc() adds the cached sum instead
+*                   of re-reading the application data ONLY while the cached area still matches the buffer's
+*                   application data area (see 'net_util.c  NetUtil_16BitOnesCplSumDataCalc()  Note #7').
+*
+*               (2) Data written at the index immediately following the cached area is added to the cached
+*                   sum; data written at any other index restarts the cached sum.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataWrSumV (NET_BUF         *p_buf,
+                         NET_BUF_SIZE     ix,
+                         NET_BUF_SIZE     len,
+                         NET_BUF_IO_VEC  *p_iov,
+                         CPU_INT16U       iov_cnt,
+                         CPU_SIZE_T       iov_offset,
+                         NET_ERR         *p_err)
+{
+    NetBuf_DataV(p_buf, ix, len, p_iov, iov_cnt, iov_offset, DEF_YES, DEF_YES, p_err);
+}
+
+
 /*
 *********************************************************************************************************
 *                                          NetBuf_DataCopy()
@@ -2801,6 +3016,7 @@ static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
     NET_BUF_POOLS  *ppool;
     NET_STAT_POOL  *pstat_pool;
     MEM_POOL       *pmem_pool;
+    NET_BUF_TYPE    type;
     NET_BUF_FNCT    unlink_fnct;
     NET_ERR         err;
     LIB_ERR         err_lib;
@@ -2826,7 +3042,8 @@ static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
 
                                                                 /* ------------------- CFG BUF FREE ------------------- */
     ppool = &NetBuf_PoolsTbl[if_nbr];
-    switch (p_buf_hdr->Type) {
+    type  =  p_buf_hdr->Type;
+    switch (type) {
         case NET_BUF_TYPE_RX_LARGE:
              pmem_pool  = &ppool->RxBufLargePool;
              pstat_pool = &ppool->RxBufLargeStatPool;
@@ -2871,9 +3088,11 @@ static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
 
 
                                                                 /* -------------- FREE NET BUF DATA AREA -------------- */
-    Mem_PoolBlkFree((MEM_POOL *) pmem_pool,
-                    (void     *) p_buf->DataPtr,
-                    (LIB_ERR  *)&err_lib);
+    NetBuf_PoolBlkFree((NET_BUF_POOLS *) ppool,
+                       (NET_BUF_TYPE   ) type,
+                       (MEM_POOL      *) pmem_pool,
+                       (void          *) p_buf->DataPtr,
+                       (LIB_ERR       *)&err_lib);
 
     if (err_lib == LIB_MEM_ERR_NONE) {                          /* If buf data area freed to pool, ...                  */
         NetStat_PoolEntryUsedDec(pstat_pool, &err);             /* ... update buf pool stats;      ...                  */
@@ -2884,9 +3103,11 @@ static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
     }
 
                                                                 /* ------------------- FREE NET BUF ------------------- */
-    Mem_PoolBlkFree((MEM_POOL *)&ppool->NetBufPool,
-                    (void     *) p_buf,
-                    (LIB_ERR  *)&err_lib);
+    NetBuf_PoolBlkFree((NET_BUF_POOLS *) ppool,
+                       (NET_BUF_TYPE   ) NET_BUF_TYPE_BUF,
+                       (MEM_POOL      *)&ppool->NetBufPool,
+                       (void          *) p_buf,
+                       (LIB_ERR       *)&err_lib);
 
     if (err_lib == LIB_MEM_ERR_NONE) {                          /* If buf freed to pool,      ...                       */
         NetStat_PoolEntryUsedDec(&ppool->NetBufStatPool, &err); /* ... update buf pool stats; ...                       */
@@ -2973,6 +3194,9 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->DataIx                   =  NET_BUF_IX_NONE;
     p_buf_hdr->DataLen                  =  0u;
     p_buf_hdr->TotLen                   =  0u;
+    p_buf_hdr->DataChkSumIx             =  NET_BUF_IX_NONE;
+    p_buf_hdr->DataChkSumLen            =  0u;
+    p_buf_hdr->DataChkSum               =  0u;
 
 #ifdef  NET_ARP_MODULE_EN
     p_buf_hdr->ARP_AddrHW_Ptr           = (CPU_INT08U *)0;
@@ -2993,6 +3217,7 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->IP_AddrNextRoute         = (NET_IPv4_ADDR)NET_IPv4_ADDR_NONE;
     p_buf_hdr->IP_AddrNextRouteNetOrder = (NET_IPv4_ADDR)NET_UTIL_HOST_TO_NET_32(NET_IPv4_ADDR_NONE);
     p_buf_hdr->IP_OptPtr                = (NET_BUF   *)0;
+    p_buf_hdr->IP_FragTailPtr           = (NET_BUF   *)0;
 #endif
 #ifdef  NET_IPv6_MODULE_EN
     p_buf_hdr->IPv6_Flags_FragOffset    = NET_IPv6_FRAG_NONE;
@@ -3040,8 +3265,25 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->TCP_MaxSegSize           =  NET_TCP_MAX_SEG_SIZE_NONE;
     p_buf_hdr->TCP_WinSize              =  NET_TCP_WIN_SIZE_NONE;
     p_buf_hdr->TCP_WinSizeLast          =  NET_TCP_WIN_SIZE_NONE;
-    p_buf_hdr->TCP_RTT_TS_Rxd_ms        =  NET_TCP_TX_RTT_TS_NONE;
-    p_buf_hdr->TCP_RTT_TS_Txd_ms        =  NET_TCP_TX_RTT_TS_NONE;
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    p_buf_hdr->TCP_OptSackPermit        =  DEF_NO;
+    p_buf_hdr->TCP_OptSackPtr           =  DEF_NULL;
+    p_buf_hdr->TCP_SegSackd             =  DEF_NO;
+#endif
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+    p_buf_hdr->TCP_OptWinScaleRxd       =  DEF_NO;
+    p_buf_hdr->TCP_OptWinScale          =  NET_TCP_WIN_SCALE_NONE;
+#endif
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+    p_buf_hdr->TCP_OptTS_Rxd            =  DEF_NO;
+    p_buf_hdr->TCP_OptTS_Val            =  0u;
+    p_buf_hdr->TCP_OptTS_Echo           =  0u;
+#endif
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+    p_buf_hdr->TCP_ZeroCopyGen          =  0u;
+#endif
+    p_buf_hdr->TCP_RTT_TS_Rxd           =  NET_TCP_TX_RTT_TS_NONE;
+    p_buf_hdr->TCP_RTT_TS_Txd           =  NET_TCP_TX_RTT_TS_NONE;
     p_buf_hdr->TCP_Flags                =  NET_TCP_FLAG_NONE;
 #endif
 
@@ -3054,6 +3296,211 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
 }
 
 
+/*
+*********************************************************************************************************
+*                                           NetBuf_DataV()
+*
+* Description : (1) Copy data between a network buffer's DATA area & an array of I/O vectors :
+*
+*                   (a) Validate data index & size
+*                   (b) Skip     I/O vectors' data preceding offset
+*                   (c) Copy     data to/from each remaining I/O vector, in order
+*
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to copy (see Note #2).
+*
+*               p_iov       Pointer to array of I/O vectors.
+*
+*               iov_cnt     Number of I/O vectors in array.
+*
+*               iov_offset  Offset into the I/O vectors' data, in octets (see Note #3).
+*
+*               wr          Indicate whether to write into the network buffer :
+*
+*                               DEF_YES                         Copy from I/O vectors  into network buffer.
+*                               DEF_NO                          Copy from network buffer into I/O vectors.
+*
+*               sum         Indicate whether to sum the data written into the network buffer (see Note #5) :
+*
+*                               DEF_YES                         Sum   written data.
+*                               DEF_NO                          Do NOT sum data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Copy successful.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_iov' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area or
+*                                                                   beyond the I/O vectors' data).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBuf_DataRdV(),
+*               NetBuf_DataWrV(),
+*               NetBuf_DataWrSumV().
+*
+* Note(s)     : (2) Data copy of 0 octets allowed.
+*
+*               (3) The I/O vector offset allows callers that split application data across several network
+*                   buffers to resume at the next application data octet without tracking the current I/O
+*                   vector themselves; the preceding I/O vectors are skipped on each call.
+*
+*               (4) I/O vectors with a NULL data pointer are treated as zero-length.
+*
+*               (5) Written data is summed while copied & the sum cached in the buffer header (see
+*                   'NetBuf_DataWrSumV()  Note #1').  The cached sum is invalidated on any error.
+*
+*               (6) Buffer 'Size' is NOT re-validated; validated in NetBuf_Get().
+*********************************************************************************************************
+*/
+
+static  void  NetBuf_DataV (NET_BUF         *p_buf,
+                            NET_BUF_SIZE     ix,
+                            NET_BUF_SIZE     len,
+                            NET_BUF_IO_VEC  *p_iov,
+                            CPU_INT16U       iov_cnt,
+                            CPU_SIZE_T       iov_offset,
+                            CPU_BOOLEAN      wr,
+                            CPU_BOOLEAN      sum,
+                            NET_ERR         *p_err)
+{
+    NET_BUF_HDR   *p_buf_hdr;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    NET_BUF_SIZE   len_data;
+#endif
+    CPU_INT08U    *p_data;
+    CPU_INT08U    *p_data_iov;
+    CPU_SIZE_T     len_iov;
+    NET_BUF_SIZE   len_copy;
+    NET_BUF_SIZE   len_rem;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE BUF PTR ------------------ */
+    if (p_buf == (NET_BUF *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+    p_buf_hdr = &p_buf->Hdr;
+                                                                /* ---------------- VALIDATE BUF TYPE ----------------- */
+    switch (p_buf_hdr->Type) {
+        case NET_BUF_TYPE_RX_LARGE:
+        case NET_BUF_TYPE_TX_LARGE:
+        case NET_BUF_TYPE_TX_SMALL:
+             break;
+
+
+        case NET_BUF_TYPE_NONE:
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.Buf.InvTypeCtr);
+            *p_err = NET_BUF_ERR_INVALID_TYPE;
+             return;
+    }
+
+                                                                /* ----------------- VALIDATE IOV PTR ----------------- */
+    if (p_iov == (NET_BUF_IO_VEC *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+#else
+    p_buf_hdr = &p_buf->Hdr;
+#endif
+
+                                                                /* ----------------- VALIDATE IX/SIZE ----------------- */
+    if (len < 1) {                                              /* If req'd len = 0,    rtn null copy (see Note #2).    */
+       *p_err = NET_BUF_ERR_NONE;
+        return;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    if (ix >= p_buf_hdr->Size) {                                /* If req'd ix  > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.IxCtr);
+       *p_err = NET_BUF_ERR_INVALID_IX;
+        return;
+    }
+
+    len_data = ix + len;
+    if (len_data > p_buf_hdr->Size) {                           /* If req'd len > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+       *p_err = NET_BUF_ERR_INVALID_LEN;
+        return;
+    }
+#endif
+
+                                                                /* ------------------ COPY BUF DATA ------------------- */
+    p_data  = &p_buf->DataPtr[ix];
+    len_rem =  len;
+
+    if (sum == DEF_YES) {                                       /* If data NOT contiguous with sum'd data, ...          */
+        if ((p_buf_hdr->DataChkSumLen < 1u) ||
+            (ix != (NET_BUF_SIZE)(p_buf_hdr->DataChkSumIx + p_buf_hdr->DataChkSumLen))) {
+            p_buf_hdr->DataChkSumIx  = (CPU_INT16U)ix;          /* ... restart sum.                                     */
+            p_buf_hdr->DataChkSumLen =  0u;
+            p_buf_hdr->DataChkSum    =  0u;
+        }
+    }
+
+    while ((len_rem >  0u) &&
+           (iov_cnt >  0u)) {
+        len_iov = p_iov->DataLen;
+        if (p_iov->DataPtr == (void *)0) {                      /* See Note #4.                                         */
+            len_iov = 0u;
+        }
+        if (iov_offset >= len_iov) {                            /* Skip iov data preceding offset (see Note #3).        */
+            iov_offset -= len_iov;
+
+        } else {
+            p_data_iov  = (CPU_INT08U *)p_iov->DataPtr + iov_offset;
+            len_iov    -=  iov_offset;
+            len_copy    = (len_iov < len_rem) ? (NET_BUF_SIZE)len_iov : len_rem;
+
+            if (sum == DEF_YES) {                               /* Copy & sum data (see Note #5).                       */
+                p_buf_hdr->DataChkSum     = NetUtil_16BitOnesCplSumDataCopy((void     *)p_data,
+                                                                            (void     *)p_data_iov,
+                                                                            (CPU_INT16U)len_copy,
+                                                                            p_buf_hdr->DataChkSum,
+                                                                            (CPU_INT32U)p_buf_hdr->DataChkSumLen);
+                p_buf_hdr->DataChkSumLen += len_copy;
+
+            } else if (wr == DEF_YES) {
+                Mem_Copy((void     *)p_data,
+                         (void     *)p_data_iov,
+                         (CPU_SIZE_T)len_copy);
+            } else {
+                Mem_Copy((void     *)p_data_iov,
+                         (void     *)p_data,
+                         (CPU_SIZE_T)len_copy);
+            }
+
+            p_data     += len_copy;
+            len_rem    -= len_copy;
+            iov_offset  = 0u;
+        }
+
+        p_iov++;
+        iov_cnt--;
+    }
+
+    if (len_rem > 0u) {                                         /* If req'd len > iov data, rtn err.                    */
+        if (sum == DEF_YES) {
+            p_buf_hdr->DataChkSumLen = 0u;                      /* Invalidate sum (see Note #5).                        */
+        }
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+       *p_err = NET_BUF_ERR_INVALID_LEN;
+        return;
+    }
+
+   *p_err = NET_BUF_ERR_NONE;
+}
+
+
 /*
 *********************************************************************************************************
 *                                          NetBuf_Discard()
@@ -3111,4 +3558,251 @@ static  void  NetBuf_Discard (NET_IF_NBR      if_nbr,
     NET_CTR_ERR_INC(Net_ErrCtrs.IFs.IF[if_nbr].BufLostCtr);
 }
 
+
+/*
+*********************************************************************************************************
+*                                         NetBuf_PoolBlkGet()
+*
+* Description : Get a network buffer or network buffer data area block from an interface's buffer cache
+*                   or memory pool.
+*
+* Argument(s) : ppool       Pointer to the interface's network buffer pools.
+*
+*               type        Type of block to get :
+*
+*                               NET_BUF_TYPE_BUF            Network buffer header.
+*                               NET_BUF_TYPE_RX_LARGE       Large receive  buffer data area.
+*                               NET_BUF_TYPE_TX_LARGE       Large transmit buffer data area.
+*                               NET_BUF_TYPE_TX_SMALL       Small transmit buffer data area.
+*
+*               pmem_pool   Pointer to the memory pool that backs the block type.
+*
+*               size        Size of the block to get (in octets).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Block successfully returned.
+*
+*                                                           - RETURNED BY Mem_PoolBlkGet() : -
+*                               LIB_MEM_ERR_POOL_EMPTY      NO memory blocks available in memory pool.
+*                               LIB_MEM_ERR_INVALID_BLK_SIZE Invalid memory pool block size specified.
+*
+* Return(s)   : Pointer to block, if NO error(s).
+*
+*               Pointer to NULL,  otherwise.
+*
+* Caller(s)   : NetBuf_Get(),
+*               NetBuf_GetDataPtr().
+*
+* Note(s)     : (1) (a) Each interface's network buffer headers & transmit buffer data areas are cached in
+*                       a small per-pool cache so that most buffer gets & frees do NOT have to enter the
+*                       memory pool's critical section.  Since the network receive task & all application
+*                       transmit tasks access network buffers ONLY with the global network lock acquired
+*                       (see 'net.h  Note #3'), a single cache per pool serves every network context.
+*
+*                   (b) The cache is refilled from, & returned to, the memory pool in batches of
+*                       NET_BUF_CACHE_BATCH blocks; the number of memory pool accesses is reported by
+*                       each cache's 'PoolRefillCtr' & 'PoolReturnCtr' versus its 'BlkGetCtr'.
+*
+*                   (c) Receive buffer data areas are NOT cached since network device drivers may get &
+*                       free them from an ISR, without the global network lock acquired (see also
+*                       'net_buf.h  NET_BUF_POOLS  Note #2').
+*
+*               (2) Cached blocks remain accounted as free in the interface's buffer statistics pools
+*                   since these pools are updated per network buffer get/free by the callers.
+*********************************************************************************************************
+*/
+
+static  void  *NetBuf_PoolBlkGet (NET_BUF_POOLS  *ppool,
+                                  NET_BUF_TYPE    type,
+                                  MEM_POOL       *pmem_pool,
+                                  CPU_SIZE_T      size,
+                                  LIB_ERR        *p_err)
+{
+#ifdef  NET_BUF_CACHE_MODULE_EN
+    NET_BUF_CACHE  *pcache;
+    void           *p_blk;
+    CPU_INT16U      nbr;
+
+
+    pcache = NetBuf_CacheGet(ppool, type);
+    if (pcache == (NET_BUF_CACHE *)0) {                         /* Rx data areas NOT cached (see Note #1c).             */
+        p_blk = Mem_PoolBlkGet(pmem_pool, size, p_err);
+        return (p_blk);
+    }
+
+    if (pcache->BlkNbr < 1) {                                   /* If cache empty, refill from pool (see Note #1b).     */
+        for (nbr = 0u; nbr < NET_BUF_CACHE_BATCH; nbr++) {
+            p_blk = Mem_PoolBlkGet(pmem_pool, size, p_err);
+            if (*p_err != LIB_MEM_ERR_NONE) {
+                 break;
+            }
+            pcache->BlkTbl[pcache->BlkNbr] = p_blk;
+            pcache->BlkNbr++;
+        }
+        pcache->PoolRefillCtr++;
+
+        if (pcache->BlkNbr < 1) {                               /* If pool also empty, rtn pool err.                    */
+            return ((void *)0);
+        }
+    }
+
+    pcache->BlkNbr--;
+    p_blk = pcache->BlkTbl[pcache->BlkNbr];
+    pcache->BlkGetCtr++;
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
+
+#else
+    void  *p_blk;
+
+
+   (void)&ppool;                                                /* Prevent 'variable unused' compiler warnings.         */
+   (void)&type;
+
+    p_blk = Mem_PoolBlkGet(pmem_pool, size, p_err);
+
+    return (p_blk);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBuf_PoolBlkFree()
+*
+* Description : Free a network buffer or network buffer data area block to an interface's buffer cache
+*                   or memory pool.
+*
+* Argument(s) : ppool       Pointer to the interface's network buffer pools.
+*
+*               type        Type of block to free (see 'NetBuf_PoolBlkGet()  Argument(s)').
+*
+*               pmem_pool   Pointer to the memory pool that backs the block type.
+*
+*               p_blk       Pointer to block to free.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Block successfully freed.
+*
+*                                                           - RETURNED BY Mem_PoolBlkFree() : -
+*                               LIB_MEM_ERR_POOL_FULL       ALL memory blocks already available in memory pool.
+*                               LIB_MEM_ERR_INVALID_BLK_ADDR Invalid memory block address.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBuf_Get(),
+*               NetBuf_FreeHandler().
+*
+* Note(s)     : (1) See 'NetBuf_PoolBlkGet()  Note #1'.
+*
+*               (2) If a full cache can NOT be returned to the memory pool, the memory pool's error is
+*                   returned so that the caller discards the block.
+*********************************************************************************************************
+*/
+
+static  void  NetBuf_PoolBlkFree (NET_BUF_POOLS  *ppool,
+                                  NET_BUF_TYPE    type,
+                                  MEM_POOL       *pmem_pool,
+                                  void           *p_blk,
+                                  LIB_ERR        *p_err)
+{
+#ifdef  NET_BUF_CACHE_MODULE_EN
+    NET_BUF_CACHE  *pcache;
+    CPU_INT16U      nbr;
+
+
+    pcache = NetBuf_CacheGet(ppool, type);
+    if (pcache == (NET_BUF_CACHE *)0) {                         /* Rx data areas NOT cached.                            */
+        Mem_PoolBlkFree(pmem_pool, p_blk, p_err);
+        return;
+    }
+
+    if (pcache->BlkNbr >= NET_BUF_CFG_CACHE_SIZE) {             /* If cache full, rtn blks to pool.                     */
+        for (nbr = 0u; nbr < NET_BUF_CACHE_BATCH; nbr++) {
+            Mem_PoolBlkFree(pmem_pool, pcache->BlkTbl[pcache->BlkNbr - 1u], p_err);
+            if (*p_err != LIB_MEM_ERR_NONE) {
+                 break;
+            }
+            pcache->BlkNbr--;
+        }
+        pcache->PoolReturnCtr++;
+
+        if (pcache->BlkNbr >= NET_BUF_CFG_CACHE_SIZE) {         /* If NO blks rtn'd, rtn pool err (see Note #2).        */
+            return;
+        }
+    }
+
+    pcache->BlkTbl[pcache->BlkNbr] = p_blk;
+    pcache->BlkNbr++;
+    pcache->BlkFreeCtr++;
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+#else
+   (void)&ppool;                                                /* Prevent 'variable unused' compiler warnings.         */
+   (void)&type;
+
+    Mem_PoolBlkFree(pmem_pool, p_blk, p_err);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBuf_CacheGet()
+*
+* Description : Get an interface's network buffer cache for a block type.
+*
+* Argument(s) : ppool       Pointer to the interface's network buffer pools.
+*
+*               type        Type of block (see 'NetBuf_PoolBlkGet()  Argument(s)').
+*
+* Return(s)   : Pointer to network buffer cache, if block type cached.
+*
+*               Pointer to NULL,                 otherwise (see 'NetBuf_PoolBlkGet()  Note #1c').
+*
+* Caller(s)   : NetBuf_PoolBlkGet(),
+*               NetBuf_PoolBlkFree().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_BUF_CACHE_MODULE_EN
+static  NET_BUF_CACHE  *NetBuf_CacheGet (NET_BUF_POOLS  *ppool,
+                                         NET_BUF_TYPE    type)
+{
+    NET_BUF_CACHE  *pcache;
+
+
+    switch (type) {
+        case NET_BUF_TYPE_BUF:
+             pcache = &ppool->NetBufCache;
+             break;
+
+
+        case NET_BUF_TYPE_TX_LARGE:
+             pcache = &ppool->TxBufLargeCache;
+             break;
+
+
+        case NET_BUF_TYPE_TX_SMALL:
+             pcache = &ppool->TxBufSmallCache;
+             break;
+
+
+        case NET_BUF_TYPE_RX_LARGE:
+        default:
+             pcache = (NET_BUF_CACHE *)0;
+             break;
+    }
+
+    return (pcache);
+}
+#endif
+
 #endif  /* NET_BUF_MODULE_EN */
@@ -78,6 +78,9 @@
 #define  NET_BUF_FLAG_RX_MULTICAST                DEF_BIT_05    /* Indicates pkts rx'd via  multicast.                  */
 #define  NET_BUF_FLAG_RX_REMOTE                   DEF_BIT_06    /* Indicates pkts rx'd from remote host.                */
 #define  NET_BUF_FLAG_RX_UDP_CHK_SUM_VALID        DEF_BIT_07    /* Indicates UDP  rx chk sum valid.                     */
+#define  NET_BUF_FLAG_RX_GRO                      DEF_BIT_08    /* Indicates TCP  rx segs coalesced & chk sums valid.   */
+
+#define  NET_BUF_FLAG_TX_HDR_VALID                DEF_BIT_09    /* Indicates tx'd pkt hdrs valid for replication.       */
 
 #define  NET_BUF_FLAG_TX_BROADCAST                DEF_BIT_12    /* Indicates pkts to tx via broadcast.                  */
 #define  NET_BUF_FLAG_TX_MULTICAST                DEF_BIT_13    /* Indicates pkts to tx via multicast.                  */
@@ -216,6 +219,43 @@
 #define  NET_BUF_DATA_PROTOCOL_HDR_SIZE          NET_BUF_DATA_IX
 
 
+/*
+*********************************************************************************************************
+*                               NETWORK BUFFER CACHE DEFAULT CONFIGURATION
+*
+* Note(s) : (1) NET_BUF_CFG_CACHE_EN enables/disables each interface's network buffer caches, which hold free
+*               network buffers & transmit buffer data areas so that NetBuf_Get() & NetBuf_Free() do NOT
+*               access the shared memory pools, nor disable interrupts, for every packet (see 'net_buf.c
+*               NetBuf_PoolBlkGet()  Note #1').
+*
+*               (a) Defaults to DISABLED.
+*
+*           (2) NET_BUF_CFG_CACHE_SIZE configures the maximum number of free blocks held in each cache.
+*               Caches are refilled from, & returned to, the shared memory pools NET_BUF_CACHE_BATCH blocks
+*               at a time.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_BUF_CFG_CACHE_EN
+#define  NET_BUF_CFG_CACHE_EN                   DEF_DISABLED
+#endif
+
+#ifndef  NET_BUF_CFG_CACHE_SIZE
+#define  NET_BUF_CFG_CACHE_SIZE                            8u
+#endif
+
+
+#define  NET_BUF_CACHE_SIZE_MIN                            2u
+#define  NET_BUF_CACHE_SIZE_MAX                           64u
+
+#define  NET_BUF_CACHE_BATCH                    (NET_BUF_CFG_CACHE_SIZE / 2u)
+
+
+#if     (NET_BUF_CFG_CACHE_EN == DEF_ENABLED)
+#define  NET_BUF_CACHE_MODULE_EN
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -470,6 +510,10 @@ typedef  struct  net_buf_hdr {
 
     NET_BUF_SIZE           TotLen;                      /* ALL                  DATA len (in octets   ).                */
 
+    CPU_INT16U             DataChkSumIx;                /* App DATA chk sum     ix  (in DATA area).                     */
+    NET_BUF_SIZE           DataChkSumLen;               /* App DATA chk sum     len (in octets   ).                     */
+    CPU_INT16U             DataChkSum;                  /* App DATA 16-bit sum  (see 'net_buf.c  NetBuf_DataWrSumV()'). */
+
 
 
 #ifdef  NET_ARP_MODULE_EN
@@ -489,6 +533,7 @@ typedef  struct  net_buf_hdr {
     NET_IPv4_ADDR          IP_AddrNextRoute;            /* IP tx 'Next-Route' addr.                                     */
     NET_IPv4_ADDR          IP_AddrNextRouteNetOrder;    /* IP tx 'Next-Route' addr in net-order.                        */
     NET_BUF               *IP_OptPtr;                   /* Ptr to IP rx opts.                                           */
+    NET_BUF               *IP_FragTailPtr;              /* Ptr to last IP rx frag in frag list (head buf ONLY).         */
 #endif
 
 #ifdef  NET_IPv6_MODULE_EN
@@ -547,8 +592,27 @@ typedef  struct  net_buf_hdr {
     NET_TCP_WIN_SIZE       TCP_WinSize;                 /* TCP       win size.                                          */
     NET_TCP_WIN_SIZE       TCP_WinSizeLast;             /* TCP last  win size.                                          */
 
-    NET_TCP_TX_RTT_TS_MS   TCP_RTT_TS_Rxd_ms;           /* TCP RTT TS @ seg rx'd (in ms).                               */
-    NET_TCP_TX_RTT_TS_MS   TCP_RTT_TS_Txd_ms;           /* TCP RTT TS @ seg tx'd (in ms).                               */
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    CPU_BOOLEAN            TCP_OptSackPermit;           /* Indicates TCP SACK permitted opt rx'd.                       */
+    CPU_INT08U            *TCP_OptSackPtr;              /* Ptr to rx'd TCP SACK opt (in DATA area).                     */
+    CPU_BOOLEAN            TCP_SegSackd;                /* Indicates TCP seg SACK'd by remote host.                     */
+#endif
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+    CPU_BOOLEAN            TCP_OptWinScaleRxd;          /* Indicates TCP win scale opt rx'd.                            */
+    CPU_INT08U             TCP_OptWinScale;             /* TCP win scale shift cnt rx'd.                                */
+#endif
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+    CPU_BOOLEAN            TCP_OptTS_Rxd;               /* Indicates TCP TS opt rx'd.                                   */
+    CPU_INT32U             TCP_OptTS_Val;               /* TCP TS val  rx'd (TSval).                                    */
+    CPU_INT32U             TCP_OptTS_Echo;              /* TCP TS echo rx'd (TSecr).                                    */
+#endif
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+    CPU_INT32U             TCP_ZeroCopyGen;             /* TCP conn gen of buf lent to app.                             */
+#endif
+
+    NET_TCP_TX_RTT_TS      TCP_RTT_TS_Rxd;              /* TCP RTT TS @ seg rx'd (in NET_TCP_TX_RTT_TS_GET() units).    */
+    NET_TCP_TX_RTT_TS      TCP_RTT_TS_Txd;              /* TCP RTT TS @ seg tx'd (in NET_TCP_TX_RTT_TS_GET() units).    */
 
     NET_TCP_FLAGS          TCP_Flags;                   /* TCP tx flags.                                                */
 #endif
@@ -598,11 +662,61 @@ struct  net_buf {
 };
 
 
+/*
+*********************************************************************************************************
+*                                 NETWORK BUFFER I/O VECTOR DATA TYPE
+*
+* Note(s) : (1) A network buffer I/O vector describes one contiguous application data area; an array of
+*               I/O vectors describes a scattered application data area that is gathered into or scattered
+*               from network buffers' DATA areas by NetBuf_DataWrV() & NetBuf_DataRdV().
+*********************************************************************************************************
+*/
+
+                                                                /* ------------------ NET BUF IO VEC ------------------ */
+struct  net_buf_io_vec {
+    void          *DataPtr;                                     /* Ptr to app data area.                                */
+    CPU_SIZE_T     DataLen;                                     /* Len of app data area (in octets).                    */
+};
+
+
+/*
+*********************************************************************************************************
+*                                   NETWORK BUFFER CACHE DATA TYPE
+*
+* Note(s) : (1) (a) A network buffer cache holds free blocks of a single network buffer memory pool, most
+*                   recently freed first.
+*
+*               (b) Network buffer caches are ONLY accessed with the global network lock acquired; thus
+*                   cache controls & counters are NOT protected by critical sections (see 'net_buf.c
+*                   NetBuf_PoolBlkGet()  Note #1b').
+*
+*           (2) Cached blocks are NOT in use & are NOT counted as used in the network buffer pool statistics
+*               (see 'net_buf.c  NetBuf_PoolBlkGet()  Note #2').
+*********************************************************************************************************
+*/
+
+#ifdef  NET_BUF_CACHE_MODULE_EN
+                                                                /* ------------------ NET BUF CACHE ------------------- */
+typedef  struct  net_buf_cache {
+    void          *BlkTbl[NET_BUF_CFG_CACHE_SIZE];              /* Cached free blks.                                    */
+    CPU_INT16U     BlkNbr;                                      /* Nbr of cached free blks.                             */
+
+    NET_CTR        BlkGetCtr;                                   /* Nbr of blks got   from cache.                        */
+    NET_CTR        BlkFreeCtr;                                  /* Nbr of blks freed to  cache.                         */
+    NET_CTR        PoolRefillCtr;                               /* Nbr of batched refills from shared pool.             */
+    NET_CTR        PoolReturnCtr;                               /* Nbr of batched returns to   shared pool.             */
+} NET_BUF_CACHE;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   NETWORK BUFFER POOLS DATA TYPE
 *
 * Note(s) : (1) Each network interface & device configures & maintains its own network buffer pools.
+*
+*           (2) Receive buffer data areas are NOT cached since device drivers may get & free them from
+*               interrupt context (see 'net_buf.c  NetBuf_PoolBlkGet()  Note #1c').
 *********************************************************************************************************
 */
 
@@ -617,6 +731,12 @@ typedef  struct  net_buf_pools {
     NET_STAT_POOL  RxBufLargeStatPool;                          /* Net buf rx large data area stat pool.                */
     NET_STAT_POOL  TxBufLargeStatPool;                          /* Net buf tx large data area stat pool.                */
     NET_STAT_POOL  TxBufSmallStatPool;                          /* Net buf tx small data area stat pool.                */
+
+#ifdef  NET_BUF_CACHE_MODULE_EN                                 /* See Note #2.                                         */
+    NET_BUF_CACHE  NetBufCache;                                 /* Net buf                    cache.                    */
+    NET_BUF_CACHE  TxBufLargeCache;                             /* Net buf tx large data area cache.                    */
+    NET_BUF_CACHE  TxBufSmallCache;                             /* Net buf tx small data area cache.                    */
+#endif
 } NET_BUF_POOLS;
 
 
@@ -783,6 +903,30 @@ void           NetBuf_DataWr                     (NET_BUF          *p_buf,
                                                   CPU_INT08U       *p_src,
                                                   NET_ERR          *p_err);
 
+void           NetBuf_DataRdV                    (NET_BUF          *p_buf,
+                                                  NET_BUF_SIZE      ix,
+                                                  NET_BUF_SIZE      len,
+                                                  NET_BUF_IO_VEC   *p_iov,
+                                                  CPU_INT16U        iov_cnt,
+                                                  CPU_SIZE_T        iov_offset,
+                                                  NET_ERR          *p_err);
+
+void           NetBuf_DataWrV                    (NET_BUF          *p_buf,
+                                                  NET_BUF_SIZE      ix,
+                                                  NET_BUF_SIZE      len,
+                                                  NET_BUF_IO_VEC   *p_iov,
+                                                  CPU_INT16U        iov_cnt,
+                                                  CPU_SIZE_T        iov_offset,
+                                                  NET_ERR          *p_err);
+
+void           NetBuf_DataWrSumV                 (NET_BUF          *p_buf,
+                                                  NET_BUF_SIZE      ix,
+                                                  NET_BUF_SIZE      len,
+                                                  NET_BUF_IO_VEC   *p_iov,
+                                                  CPU_INT16U        iov_cnt,
+                                                  CPU_SIZE_T        iov_offset,
+                                                  NET_ERR          *p_err);
+
 void           NetBuf_DataCopy                   (NET_BUF          *p_buf_dest,
                                                   NET_BUF          *p_buf_src,
                                                   NET_BUF_SIZE      ix_dest,
@@ -804,6 +948,31 @@ CPU_BOOLEAN    NetBuf_IsUsed                     (NET_BUF          *p_buf);
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if     ((NET_BUF_CFG_CACHE_EN != DEF_ENABLED ) && \
+         (NET_BUF_CFG_CACHE_EN != DEF_DISABLED))
+#error  "NET_BUF_CFG_CACHE_EN              illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]           "
+#error  "                                  [     ||  DEF_ENABLED ]           "
+
+#elif   (NET_BUF_CFG_CACHE_EN == DEF_ENABLED)
+#if     (DEF_CHK_VAL(NET_BUF_CFG_CACHE_SIZE,        \
+                     NET_BUF_CACHE_SIZE_MIN,        \
+                     NET_BUF_CACHE_SIZE_MAX) != DEF_OK)
+#error  "NET_BUF_CFG_CACHE_SIZE            illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  >= NET_BUF_CACHE_SIZE_MIN]"
+#error  "                                  [     &&  <= NET_BUF_CACHE_SIZE_MAX]"
+#endif
+#endif
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -98,6 +98,18 @@ static  void             NetCache_Unlink   (NET_CACHE_ADDR  *pcache);
 
 static  void             NetCache_Clr      (NET_CACHE_ADDR  *pcache);
 
+#if (defined(NET_CACHE_HASH_ARP_EN) || \
+     defined(NET_CACHE_HASH_NDP_EN))
+static  NET_CACHE_ADDR **NetCache_HashBucketGet(NET_CACHE_TYPE    cache_type,
+                                                CPU_INT08U       *paddr_protocol);
+
+static  void             NetCache_HashInsert   (NET_CACHE_ADDR  **pbucket,
+                                                NET_CACHE_ADDR   *pcache);
+
+static  void             NetCache_HashUnlink   (NET_CACHE_ADDR  **pbucket,
+                                                NET_CACHE_ADDR   *pcache);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -227,6 +239,9 @@ void  NetCache_Init (NET_CACHE_ADDR  *pcache_parent,
 *
 * Note(s)     : (1) 'NetARP_CacheAccessedTh_nbr' & 'NetNDP_CacheAccessedTh_nbr'  MUST ALWAYS be accessed
 *                    exclusively in critical sections.
+*
+*               (2) Caches are promoted on EVERY successful search (see 'NetCache_AddrSrch()  Note #4');
+*                   the configured threshold is retained for backwards compatibility ONLY.
 *********************************************************************************************************
 */
 
@@ -755,6 +770,17 @@ void  *NetCache_GetParent (NET_CACHE_ADDR  *pcache)
 *
 *               (3) The hardware address is returned in network-order; i.e. the pointer to the hardware
 *                   address points to the highest-order octet.
+*
+*               (4) (a) A cache found by a search is promoted to the head of its Cache List.  The Cache
+*                       List is thus kept in most-recently-used to least-recently-used order.
+*
+*                   (b) When no free cache remains, NetCache_AddrGet() reclaims the least-recently-used
+*                       resolved cache from the Cache List tail.  Pending caches are never reclaimed, so
+*                       buffers queued on a cache pending resolution are preserved.
+*
+*               (5) If the cache type's hash table is enabled (see 'net_cache.h  NETWORK CACHE HASH TABLE
+*                   DEFINES  Note #1'), ONLY the protocol address's hash bucket is searched, instead of
+*                   the entire Cache List.
 *********************************************************************************************************
 */
 
@@ -769,13 +795,15 @@ NET_CACHE_ADDR  *NetCache_AddrSrch (NET_CACHE_TYPE       cache_type,
 #endif
 #ifdef  NET_NDP_MODULE_EN
     NET_CACHE_ADDR_NDP  *pcache_addr_ndp;
+#endif
+#if (defined(NET_CACHE_HASH_ARP_EN) || \
+     defined(NET_CACHE_HASH_NDP_EN))
+    NET_CACHE_ADDR     **pbucket;
 #endif
     NET_CACHE_ADDR      *pcache;
     NET_CACHE_ADDR      *pcache_next;
     CPU_INT08U          *pcache_addr;
-    CPU_INT16U           th;
     CPU_BOOLEAN          found;
-    CPU_SR_ALLOC();
 
 
     (void)&addr_protocol_len;                                   /* Prevent 'variable unused' compiler warning.          */
@@ -814,11 +842,20 @@ NET_CACHE_ADDR  *NetCache_AddrSrch (NET_CACHE_TYPE       cache_type,
     switch (cache_type) {
 #ifdef  NET_ARP_MODULE_EN
         case NET_CACHE_TYPE_ARP:
+#ifdef  NET_CACHE_HASH_ARP_EN                                               /* Srch ARP hash bucket (see Note #5) ...   */
+             pbucket         =  NetCache_HashBucketGet(NET_CACHE_TYPE_ARP, paddr_protocol);
+             pcache_addr_arp = (NET_CACHE_ADDR_ARP *)*pbucket;
+#else                                                                       /* ... or entire ARP Cache List.            */
              pcache_addr_arp = (NET_CACHE_ADDR_ARP *)NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP];
+#endif
              while ((pcache_addr_arp != (NET_CACHE_ADDR_ARP *)0) &&         /* Srch    ARP Cache List ...               */
                     (found  ==  DEF_NO)) {                                  /* ... until cache found.                   */
 
+#ifdef  NET_CACHE_HASH_ARP_EN
+                 pcache_next     = (NET_CACHE_ADDR *) pcache_addr_arp->HashNextPtr;
+#else
                  pcache_next     = (NET_CACHE_ADDR *) pcache_addr_arp->NextPtr;
+#endif
                  pcache_addr     = (CPU_INT08U     *)&pcache_addr_arp->AddrProtocol[0];
 
                                                                             /* Cmp ARP cache protocol addr.             */
@@ -838,16 +875,10 @@ NET_CACHE_ADDR  *NetCache_AddrSrch (NET_CACHE_TYPE       cache_type,
                      }
 
                      pcache_addr_arp->AccessedCtr++;
-                     CPU_CRITICAL_ENTER();
-                     th = NetARP_CacheAccessedTh_nbr;
-                     CPU_CRITICAL_EXIT();
-                     if (pcache->AccessedCtr > th) {                        /* If ARP cache accessed > th, & ..         */
-                         pcache->AccessedCtr = 0u;
-                                                                            /* .. ARP cache NOT @ list head, ..         */
-                         if (pcache != NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP]) {
-                             NetCache_Unlink(pcache);
-                             NetCache_Insert(pcache);                       /* .. promote ARP cache to list head.       */
-                         }
+                                                                            /* If ARP cache NOT @ list head, ..         */
+                     if (pcache != NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP]) {
+                         NetCache_Unlink(pcache);
+                         NetCache_Insert(pcache);                           /* .. promote to list head (see Note #4).   */
                      }
                  }
              }
@@ -856,11 +887,25 @@ NET_CACHE_ADDR  *NetCache_AddrSrch (NET_CACHE_TYPE       cache_type,
 
 #ifdef  NET_NDP_MODULE_EN
         case NET_CACHE_TYPE_NDP:
+             if (paddr_protocol == (CPU_INT08U *)0) {
+                *p_err = NET_CACHE_ERR_NOT_FOUND;
+                 return (pcache);
+             }
+
+#ifdef  NET_CACHE_HASH_NDP_EN                                               /* Srch NDP hash bucket (see Note #5) ...   */
+             pbucket         =  NetCache_HashBucketGet(NET_CACHE_TYPE_NDP, paddr_protocol);
+             pcache_addr_ndp = (NET_CACHE_ADDR_NDP *)*pbucket;
+#else                                                                       /* ... or entire NDP Cache List.            */
              pcache_addr_ndp = (NET_CACHE_ADDR_NDP *)NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP];
+#endif
              while ((pcache_addr_ndp != (NET_CACHE_ADDR_NDP *)0) &&         /* Srch    NDP Cache List ...               */
                     (found           ==  DEF_NO)) {                         /* ... until cache found.                   */
 
+#ifdef  NET_CACHE_HASH_NDP_EN
+                 pcache_next     = (NET_CACHE_ADDR *) pcache_addr_ndp->HashNextPtr;
+#else
                  pcache_next     = (NET_CACHE_ADDR *) pcache_addr_ndp->NextPtr;
+#endif
                  pcache_addr     = (CPU_INT08U     *)&pcache_addr_ndp->AddrProtocol[0];
 
 
@@ -869,15 +914,10 @@ NET_CACHE_ADDR  *NetCache_AddrSrch (NET_CACHE_TYPE       cache_type,
                      continue;
                  }
                                                                             /* Cmp NDP cache protocol addr.             */
-                 if (paddr_protocol != (CPU_INT08U *)0){
-                     if (pcache_addr_ndp->IF_Nbr == if_nbr){
-                         found =  Mem_Cmp((void     *)paddr_protocol,
-                                          (void     *)pcache_addr,
-                                          (CPU_SIZE_T)NET_IPv6_ADDR_SIZE);
-                     }
-                 } else {
-                    *p_err   =  NET_CACHE_ERR_NOT_FOUND;
-                     return (pcache);
+                 if (pcache_addr_ndp->IF_Nbr == if_nbr){
+                     found =  Mem_Cmp((void     *)paddr_protocol,
+                                      (void     *)pcache_addr,
+                                      (CPU_SIZE_T)NET_IPv6_ADDR_SIZE);
                  }
 
                  if (found != DEF_YES) {                                    /* If NOT found, ..                         */
@@ -892,16 +932,10 @@ NET_CACHE_ADDR  *NetCache_AddrSrch (NET_CACHE_TYPE       cache_type,
                      }
 
                      pcache_addr_ndp->AccessedCtr++;
-                     CPU_CRITICAL_ENTER();
-                     th = NetNDP_CacheAccessedTh_nbr;
-                     CPU_CRITICAL_EXIT();
-                     if (pcache->AccessedCtr > th) {                        /* If NDP cache accessed > th, & ..         */
-                         pcache->AccessedCtr = 0u;
-                                                                            /* .. NDP cache NOT @ list head, ..         */
-                         if (pcache != NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP]) {
-                             NetCache_Unlink(pcache);
-                             NetCache_Insert(pcache);                       /* .. promote NDP cache to list head.       */
-                         }
+                                                                            /* If NDP cache NOT @ list head, ..         */
+                     if (pcache != NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP]) {
+                         NetCache_Unlink(pcache);
+                         NetCache_Insert(pcache);                           /* .. promote to list head (see Note #4).   */
                      }
                  }
              }
@@ -1115,6 +1149,12 @@ void  NetCache_Insert (NET_CACHE_ADDR  *pcache)
              }
                                                                 /* Insert ARP cache @ list head.                        */
              NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP] = pcache;
+
+#ifdef  NET_CACHE_HASH_ARP_EN                                   /* ------- INSERT ARP CACHE INTO ARP HASH TBL -------- */
+             NetCache_HashInsert(NetCache_HashBucketGet(NET_CACHE_TYPE_ARP,
+                                                       &((NET_CACHE_ADDR_ARP *)pcache)->AddrProtocol[0]),
+                                 pcache);
+#endif
              break;
 #endif
 
@@ -1132,6 +1172,12 @@ void  NetCache_Insert (NET_CACHE_ADDR  *pcache)
              }
                                                                 /* Insert NDP cache @ list head.                        */
              NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP]     = pcache;
+
+#ifdef  NET_CACHE_HASH_NDP_EN                                   /* ------- INSERT NDP CACHE INTO NDP HASH TBL -------- */
+             NetCache_HashInsert(NetCache_HashBucketGet(NET_CACHE_TYPE_NDP,
+                                                       &((NET_CACHE_ADDR_NDP *)pcache)->AddrProtocol[0]),
+                                 pcache);
+#endif
              break;
 #endif
 
@@ -1508,7 +1554,7 @@ static  NET_CACHE_ADDR  *NetCache_AddrGet(NET_CACHE_TYPE   cache_type,
                  NetCache_AddrARP_PoolPtr  = (NET_CACHE_ADDR_ARP *)pcache_addr_arp->NextPtr;
 
              } else {                                                   /* If ARP Cache List NOT empty, ...              */
-                                                                        /* ... get ARP cache from list tail.             */
+                                                                        /* ... reclaim LRU cache from list tail.         */
                  NET_CACHE_ADDR  *p_entry = NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_ARP];
 
 
@@ -1566,7 +1612,7 @@ static  NET_CACHE_ADDR  *NetCache_AddrGet(NET_CACHE_TYPE   cache_type,
                  NetCache_AddrNDP_PoolPtr  = (NET_CACHE_ADDR_NDP *)pcache_addr_ndp->NextPtr;
 
              } else {                                                   /* If ARP Cache List NOT empty, ...              */
-                                                                        /* ... get ARP cache from list tail.             */
+                                                                        /* ... reclaim LRU cache from list tail.         */
                  NET_CACHE_ADDR  *p_entry = NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_NDP];
 
 
@@ -1854,6 +1900,12 @@ static  void  NetCache_Unlink (NET_CACHE_ADDR  *pcache)
              pcache->PrevPtr = (NET_CACHE_ADDR *)0;
              pcache->NextPtr = (NET_CACHE_ADDR *)0;
 #endif
+
+#ifdef  NET_CACHE_HASH_ARP_EN                                   /* ------- UNLINK ARP CACHE FROM ARP HASH TBL -------- */
+             NetCache_HashUnlink(NetCache_HashBucketGet(NET_CACHE_TYPE_ARP,
+                                                       &((NET_CACHE_ADDR_ARP *)pcache)->AddrProtocol[0]),
+                                 pcache);
+#endif
              break;
 #endif
 
@@ -1876,6 +1928,12 @@ static  void  NetCache_Unlink (NET_CACHE_ADDR  *pcache)
              pcache->PrevPtr = (NET_CACHE_ADDR *)0;
              pcache->NextPtr = (NET_CACHE_ADDR *)0;
 #endif
+
+#ifdef  NET_CACHE_HASH_NDP_EN                                   /* ------- UNLINK NDP CACHE FROM NDP HASH TBL -------- */
+             NetCache_HashUnlink(NetCache_HashBucketGet(NET_CACHE_TYPE_NDP,
+                                                       &((NET_CACHE_ADDR_NDP *)pcache)->AddrProtocol[0]),
+                                 pcache);
+#endif
              break;
 #endif
 
@@ -2026,6 +2084,8 @@ static  void  NetCache_Clr (NET_CACHE_ADDR  *pcache)
 
     pcache->PrevPtr                 = (NET_CACHE_ADDR *)0;
     pcache->NextPtr                 = (NET_CACHE_ADDR *)0;
+    pcache->HashPrevPtr             = (NET_CACHE_ADDR *)0;
+    pcache->HashNextPtr             = (NET_CACHE_ADDR *)0;
     pcache->TxQ_Head                = (NET_BUF *)0;
     pcache->TxQ_Tail                = (NET_BUF *)0;
     pcache->TxQ_Nbr                 =  0;
@@ -2071,6 +2131,161 @@ static  void  NetCache_Clr (NET_CACHE_ADDR  *pcache)
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetCache_HashBucketGet()
+*
+* Description : Get the hash table bucket of a protocol address.
+*
+* Argument(s) : cache_type      Cache type:
+*
+*                                   NET_CACHE_TYPE_ARP     ARP cache type
+*                                   NET_CACHE_TYPE_NDP     NDP neighbor cache type
+*
+*               paddr_protocol  Pointer to protocol address.
+*
+* Return(s)   : Pointer to hash bucket head, if cache type's hash table enabled.
+*
+*               Pointer to NULL,             otherwise.
+*
+* Caller(s)   : NetCache_AddrSrch(),
+*               NetCache_Insert(),
+*               NetCache_Unlink().
+*
+* Note(s)     : (1) Protocol address hashed with 32-bit FNV-1a; upper bits folded into lower bits
+*                   before masking to the hash table size (see 'net_cache.h  NETWORK CACHE HASH TABLE
+*                   DEFINES  Note #2').
+*********************************************************************************************************
+*/
+
+#if (defined(NET_CACHE_HASH_ARP_EN) || \
+     defined(NET_CACHE_HASH_NDP_EN))
+static  NET_CACHE_ADDR  **NetCache_HashBucketGet (NET_CACHE_TYPE   cache_type,
+                                                  CPU_INT08U      *paddr_protocol)
+{
+    NET_CACHE_ADDR  **pbucket_tbl;
+    CPU_SIZE_T        addr_len;
+    CPU_INT32U        hash;
+    CPU_INT32U        hash_mask;
+    CPU_SIZE_T        i;
+
+
+    switch (cache_type) {
+#ifdef  NET_CACHE_HASH_ARP_EN
+        case NET_CACHE_TYPE_ARP:
+             pbucket_tbl = (NET_CACHE_ADDR **)&NetCache_AddrARP_HashTbl[0];
+             hash_mask   =  NET_ARP_CFG_CACHE_HASH_TBL_SIZE - 1u;
+             addr_len    =  NET_IPv4_ADDR_SIZE;
+             break;
+#endif
+
+#ifdef  NET_CACHE_HASH_NDP_EN
+        case NET_CACHE_TYPE_NDP:
+             pbucket_tbl = (NET_CACHE_ADDR **)&NetCache_AddrNDP_HashTbl[0];
+             hash_mask   =  NET_NDP_CFG_CACHE_HASH_TBL_SIZE - 1u;
+             addr_len    =  NET_IPv6_ADDR_SIZE;
+             break;
+#endif
+
+        default:
+             return ((NET_CACHE_ADDR **)0);
+    }
+
+    hash = NET_CACHE_HASH_FNV_OFFSET;                           /* Hash protocol addr (see Note #1).                    */
+    for (i = 0u; i < addr_len; i++) {
+        hash ^= (CPU_INT32U)paddr_protocol[i];
+        hash *=  NET_CACHE_HASH_FNV_PRIME;
+    }
+    hash ^= (hash >> 16u);
+
+    return (&pbucket_tbl[hash & hash_mask]);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetCache_HashInsert()
+*
+* Description : Insert a cache into a hash table bucket.
+*
+* Argument(s) : pbucket     Pointer to hash bucket head.
+*
+*               pcache      Pointer to a cache.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetCache_Insert().
+*
+* Note(s)     : (1) Cache inserted at bucket head.
+*********************************************************************************************************
+*/
+
+#if (defined(NET_CACHE_HASH_ARP_EN) || \
+     defined(NET_CACHE_HASH_NDP_EN))
+static  void  NetCache_HashInsert (NET_CACHE_ADDR  **pbucket,
+                                   NET_CACHE_ADDR   *pcache)
+{
+    pcache->HashPrevPtr = (NET_CACHE_ADDR *)0;                  /* Insert cache at bucket head (see Note #1).           */
+    pcache->HashNextPtr = *pbucket;
+
+    if (*pbucket != (NET_CACHE_ADDR *)0) {
+      (*pbucket)->HashPrevPtr = pcache;
+    }
+
+   *pbucket = pcache;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetCache_HashUnlink()
+*
+* Description : Unlink a cache from a hash table bucket.
+*
+* Argument(s) : pbucket     Pointer to hash bucket head.
+*
+*               pcache      Pointer to a cache.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetCache_Unlink().
+*
+* Note(s)     : (1) Bucket head updated ONLY if cache is the bucket head, so that unlinking a cache that
+*                   was never inserted does NOT corrupt the bucket.
+*********************************************************************************************************
+*/
+
+#if (defined(NET_CACHE_HASH_ARP_EN) || \
+     defined(NET_CACHE_HASH_NDP_EN))
+static  void  NetCache_HashUnlink (NET_CACHE_ADDR  **pbucket,
+                                   NET_CACHE_ADDR   *pcache)
+{
+    NET_CACHE_ADDR  *pcache_prev;
+    NET_CACHE_ADDR  *pcache_next;
+
+
+    pcache_prev = pcache->HashPrevPtr;
+    pcache_next = pcache->HashNextPtr;
+
+    if (pcache_prev != (NET_CACHE_ADDR *)0) {                   /* If cache is NOT the bucket head, ...                 */
+        pcache_prev->HashNextPtr = pcache_next;                 /* ... point prev cache to next cache.                  */
+    } else if (*pbucket == pcache) {                            /* Else set next cache as bucket head (see Note #1).    */
+       *pbucket                  = pcache_next;
+    } else {
+        return;
+    }
+
+    if (pcache_next != (NET_CACHE_ADDR *)0) {                   /* If cache is NOT the bucket tail, ...                 */
+        pcache_next->HashPrevPtr = pcache_prev;                 /* ... point next cache to prev cache.                  */
+    }
+
+    pcache->HashPrevPtr = (NET_CACHE_ADDR *)0;
+    pcache->HashNextPtr = (NET_CACHE_ADDR *)0;
+}
+#endif
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -114,6 +114,45 @@
 #define  NET_CACHE_ADDR_LIST_IX_MAX                        2u
 
 
+/*
+*********************************************************************************************************
+*                                  NETWORK CACHE HASH TABLE DEFINES
+*
+* Note(s) : (1) NET_ARP_CFG_CACHE_HASH_TBL_SIZE & NET_NDP_CFG_CACHE_HASH_TBL_SIZE configure the number of
+*               buckets in the ARP & NDP cache hash tables :
+*
+*               (a) 0u disables the hash table; caches are searched through the Cache List.
+*
+*               (b) Otherwise, MUST be a power of 2 so that hash values are reduced to a bucket index
+*                   with a mask.
+*
+*           (2) Cache hash values are computed with the 32-bit FNV-1a hash function on the protocol
+*               address.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_ARP_CFG_CACHE_HASH_TBL_SIZE
+#define  NET_ARP_CFG_CACHE_HASH_TBL_SIZE                   0u   /* See Note #1a.                                        */
+#endif
+
+#ifndef  NET_NDP_CFG_CACHE_HASH_TBL_SIZE
+#define  NET_NDP_CFG_CACHE_HASH_TBL_SIZE                   0u   /* See Note #1a.                                        */
+#endif
+
+#if     (defined(NET_ARP_MODULE_EN) && (NET_ARP_CFG_CACHE_HASH_TBL_SIZE > 0u))
+#define  NET_CACHE_HASH_ARP_EN
+#endif
+
+#if     (defined(NET_NDP_MODULE_EN) && (NET_NDP_CFG_CACHE_HASH_TBL_SIZE > 0u))
+#define  NET_CACHE_HASH_NDP_EN
+#endif
+
+#define  NET_CACHE_HASH_TBL_SIZE_MAX                    1024u
+
+#define  NET_CACHE_HASH_FNV_OFFSET                2166136261u   /* See Note #2.                                         */
+#define  NET_CACHE_HASH_FNV_PRIME                   16777619u
+
+
 /*
 *********************************************************************************************************
 *                                     NETWORK CACHE FLAG DEFINES
@@ -177,6 +216,8 @@ struct  net_cache_addr {
 
     NET_CACHE_ADDR       *PrevPtr;                                      /* Ptr to PREV   addr cache.                    */
     NET_CACHE_ADDR       *NextPtr;                                      /* Ptr to NEXT   addr cache.                    */
+    NET_CACHE_ADDR       *HashPrevPtr;                                  /* Ptr to PREV   addr cache in hash bucket.     */
+    NET_CACHE_ADDR       *HashNextPtr;                                  /* Ptr to NEXT   addr cache in hash bucket.     */
     void                 *ParentPtr;                                    /* Ptr to parent addr cache.                    */
 
     NET_BUF              *TxQ_Head;                                     /* Ptr to head of cache's buf Q.                */
@@ -210,6 +251,8 @@ struct  net_cache_addr_arp {
 
     NET_CACHE_ADDR_ARP   *PrevPtr;                                      /* Ptr to PREV       ARP addr  cache.           */
     NET_CACHE_ADDR_ARP   *NextPtr;                                      /* Ptr to NEXT       ARP addr  cache.           */
+    NET_CACHE_ADDR_ARP   *HashPrevPtr;                                  /* Ptr to PREV       ARP addr  cache in bucket. */
+    NET_CACHE_ADDR_ARP   *HashNextPtr;                                  /* Ptr to NEXT       ARP addr  cache in bucket. */
     void                 *ParentPtr;                                    /* Ptr to the parent ARP       cache.           */
 
     NET_BUF              *TxQ_Head;                                     /* Ptr to head of cache's buf Q.                */
@@ -252,6 +295,8 @@ struct  net_cache_addr_ndp {
 
     NET_CACHE_ADDR_NDP  *PrevPtr;                                       /* Ptr to PREV       NDP addr  cache.           */
     NET_CACHE_ADDR_NDP  *NextPtr;                                       /* Ptr to NEXT       NDP addr  cache.           */
+    NET_CACHE_ADDR_NDP  *HashPrevPtr;                                   /* Ptr to PREV       NDP addr  cache in bucket. */
+    NET_CACHE_ADDR_NDP  *HashNextPtr;                                   /* Ptr to NEXT       NDP addr  cache in bucket. */
     void                *ParentPtr;                                     /* Ptr to the parent NDP       cache.           */
 
     NET_BUF             *TxQ_Head;                                      /* Ptr to head of cache's buf Q.                */
@@ -301,12 +346,18 @@ struct  net_cache_addr_ndp {
 NET_CACHE_EXT  NET_CACHE_ADDR_ARP   NetCache_AddrARP_Tbl[NET_ARP_CFG_CACHE_NBR];
 NET_CACHE_EXT  NET_CACHE_ADDR_ARP  *NetCache_AddrARP_PoolPtr;           /* Ptr to pool of free ARP caches.              */
 NET_CACHE_EXT  NET_STAT_POOL        NetCache_AddrARP_PoolStat;
+#ifdef  NET_CACHE_HASH_ARP_EN
+NET_CACHE_EXT  NET_CACHE_ADDR      *NetCache_AddrARP_HashTbl[NET_ARP_CFG_CACHE_HASH_TBL_SIZE];
+#endif
 #endif
 
 #ifdef  NET_NDP_MODULE_EN
 NET_CACHE_EXT  NET_CACHE_ADDR_NDP   NetCache_AddrNDP_Tbl[NET_NDP_CFG_CACHE_NBR];
 NET_CACHE_EXT  NET_CACHE_ADDR_NDP  *NetCache_AddrNDP_PoolPtr;           /* Ptr to pool of free NDP caches.              */
 NET_CACHE_EXT  NET_STAT_POOL        NetCache_AddrNDP_PoolStat;
+#ifdef  NET_CACHE_HASH_NDP_EN
+NET_CACHE_EXT  NET_CACHE_ADDR      *NetCache_AddrNDP_HashTbl[NET_NDP_CFG_CACHE_HASH_TBL_SIZE];
+#endif
 #endif
 
 NET_CACHE_EXT  NET_CACHE_ADDR      *NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_MAX];
@@ -400,6 +451,30 @@ void                NetCache_TxPktHandler (NET_PROTOCOL_TYPE    proto_type,
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if    ((NET_ARP_CFG_CACHE_HASH_TBL_SIZE  > NET_CACHE_HASH_TBL_SIZE_MAX) || \
+        ((NET_ARP_CFG_CACHE_HASH_TBL_SIZE & (NET_ARP_CFG_CACHE_HASH_TBL_SIZE - 1u)) != 0u))
+#error  "NET_ARP_CFG_CACHE_HASH_TBL_SIZE   illegally #define'd in 'net_cfg.h'  "
+#error  "                                  [MUST be  0 (disabled) or a power of 2]"
+#error  "                                  [     &&  <= NET_CACHE_HASH_TBL_SIZE_MAX]"
+#endif
+
+#if    ((NET_NDP_CFG_CACHE_HASH_TBL_SIZE  > NET_CACHE_HASH_TBL_SIZE_MAX) || \
+        ((NET_NDP_CFG_CACHE_HASH_TBL_SIZE & (NET_NDP_CFG_CACHE_HASH_TBL_SIZE - 1u)) != 0u))
+#error  "NET_NDP_CFG_CACHE_HASH_TBL_SIZE   illegally #define'd in 'net_cfg.h'  "
+#error  "                                  [MUST be  0 (disabled) or a power of 2]"
+#error  "                                  [     &&  <= NET_CACHE_HASH_TBL_SIZE_MAX]"
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
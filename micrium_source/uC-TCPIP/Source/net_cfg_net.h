@@ -310,6 +310,34 @@
         #define  NET_TCP_CFG_CHK_SUM_OFFLOAD_TX_EN              DEF_DISABLED
     #endif
 
+    #ifndef  NET_TCP_CFG_SACK_EN
+        #define  NET_TCP_CFG_SACK_EN                            DEF_DISABLED
+    #endif
+
+    #ifndef  NET_TCP_CFG_WIN_SCALE_EN
+        #define  NET_TCP_CFG_WIN_SCALE_EN                       DEF_DISABLED
+    #endif
+
+    #ifndef  NET_TCP_CFG_TS_EN
+        #define  NET_TCP_CFG_TS_EN                              DEF_DISABLED
+    #endif
+
+    #ifndef  NET_TCP_CFG_CONG_CTRL_CUBIC_EN
+        #define  NET_TCP_CFG_CONG_CTRL_CUBIC_EN                 DEF_DISABLED
+    #endif
+
+    #ifndef  NET_TCP_CFG_CONG_CTRL_DFLT
+        #define  NET_TCP_CFG_CONG_CTRL_DFLT                     NET_TCP_CONG_CTRL_ALGO_NEW_RENO
+    #endif
+
+    #ifndef  NET_TCP_CFG_TELEMETRY_EN
+        #define  NET_TCP_CFG_TELEMETRY_EN                       DEF_DISABLED
+    #endif
+
+    #ifndef  NET_TCP_CFG_TX_COPY_UNLOCK_EN
+        #define  NET_TCP_CFG_TX_COPY_UNLOCK_EN                  DEF_DISABLED
+    #endif
+
     #if (NET_TCP_CFG_CHK_SUM_OFFLOAD_RX_EN == DEF_ENABLED)
         #define  NET_TCP_CHK_SUM_OFFLOAD_RX
     #endif
@@ -398,6 +426,16 @@
     #endif
 #endif
 
+                                                                /* ------------- CFG SOCK EVENT SET API --------------- */
+#ifndef  NET_SOCK_CFG_EVENT_SET_EN
+    #define  NET_SOCK_CFG_EVENT_SET_EN                          DEF_DISABLED
+#endif
+
+                                                                /* ------------ CFG SOCK ZERO-COPY API ---------------- */
+#ifndef  NET_SOCK_CFG_ZERO_COPY_EN
+    #define  NET_SOCK_CFG_ZERO_COPY_EN                          DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
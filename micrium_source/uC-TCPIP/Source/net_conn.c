@@ -66,12 +66,14 @@ static  NET_CONN  *NetConn_ListSrch              (NET_CONN_FAMILY        family,
                                                   CPU_INT08U            *p_addr_local);
 
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE == 0u)
 static  NET_CONN  *NetConn_ChainSrch             (NET_CONN             **p_conn_list,
                                                   NET_CONN              *p_conn_chain,
                                                   CPU_INT08U            *p_addr_local,
                                                   CPU_INT08U            *p_addr_wildcard,
                                                   CPU_INT08U            *p_addr_remote,
                                                   NET_ERR               *p_err);
+#endif
 
 
 static  void       NetConn_ChainInsert           (NET_CONN             **p_conn_list,
@@ -88,6 +90,30 @@ static  void       NetConn_Add                   (NET_CONN             **p_conn_
 static  void       NetConn_Unlink                (NET_CONN              *p_conn);
 
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+static  NET_CONN  *NetConn_HashSrch              (NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                  CPU_INT08U            *p_addr_local,
+                                                  CPU_INT08U            *p_addr_wildcard,
+                                                  CPU_INT08U            *p_addr_remote,
+                                                  CPU_SIZE_T             addr_len,
+                                                  NET_ERR               *p_err);
+
+static  NET_CONN  *NetConn_HashSrchFull          (NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                  CPU_INT08U            *p_addr_local,
+                                                  CPU_INT08U            *p_addr_remote,
+                                                  CPU_SIZE_T             addr_len);
+
+static  CPU_INT32U  NetConn_HashCalc             (NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                  CPU_INT08U            *p_addr_local,
+                                                  CPU_INT08U            *p_addr_remote,
+                                                  CPU_SIZE_T             addr_len);
+
+static  void       NetConn_HashAdd               (NET_CONN              *p_conn);
+
+static  void       NetConn_HashUnlink            (NET_CONN              *p_conn);
+#endif
+
+
 
 static  void       NetConn_Close                 (NET_CONN              *p_conn);
 
@@ -124,7 +150,8 @@ static  void       NetConn_Clr                   (NET_CONN              *p_conn)
 *                   (a) Initialize network connection pool
 *                   (b) Initialize network connection table
 *                   (c) Initialize network connection lists
-*                   (d) Initialize network connection wildcard address(s)
+*                   (d) Initialize network connection hash tables
+*                   (e) Initialize network connection wildcard address(s)
 *
 *
 * Argument(s) : none.
@@ -198,6 +225,14 @@ void  NetConn_Init (void)
     NetConn_ConnListNextConnPtr  = (NET_CONN *)0;
 
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)                           /* ------------- INIT NET CONN HASH TBLS -------------- */
+    for (i = 0u; i < NET_CONN_CFG_HASH_TBL_SIZE; i++) {
+        NetConn_HashTbl[i]       = DEF_NULL;
+        NetConn_HashListenTbl[i] = DEF_NULL;
+    }
+#endif
+
+
                                                                 /* ----------- INIT NET CONN WILDCARD ADDRS ----------- */
                                                                 /* See Note #3.                                         */
 #ifdef  NET_IPv4_MODULE_EN
@@ -1724,6 +1759,13 @@ void  NetConn_AddrLocalSet (NET_CONN_ID         conn_id,
     p_conn->AddrLocalValid = DEF_YES;
     p_conn->IF_Nbr         = if_nbr;                            /* Set IF nbr.                                          */
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    if (p_conn->HashList != DEF_NULL) {                         /* If net conn hashed, re-hash with new local addr.     */
+        NetConn_HashUnlink(p_conn);
+        NetConn_HashAdd(p_conn);
+    }
+#endif
+
 
    *p_err = NET_CONN_ERR_NONE;
 }
@@ -1938,6 +1980,13 @@ void  NetConn_AddrRemoteSet (NET_CONN_ID         conn_id,
 
     p_conn->AddrRemoteValid = DEF_YES;
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    if (p_conn->HashList != DEF_NULL) {                         /* If net conn hashed, re-hash with new remote addr.    */
+        NetConn_HashUnlink(p_conn);
+        NetConn_HashAdd(p_conn);
+    }
+#endif
+
 
    *p_err = NET_CONN_ERR_NONE;
 }
@@ -3329,6 +3378,30 @@ exit_release:
 *
 *                           See also 'NetConn_Add()  Note #1'.
 *
+*                   (c) (1) If network connection hash tables are enabled (see 'net_conn.h  NETWORK CONNECTION
+*                           HASH TABLE DEFINES  Note #1'), connection searches do NOT walk the connection
+*                           lists.  Instead, each connection in a connection list is also linked into one
+*                           of two hash tables :
+*
+*                           (A) Full connections, whose local & remote addresses are both valid, are hashed
+*                               by protocol index, local address & remote address into 'NetConn_HashTbl[]'.
+*
+*                           (B) Half connections, whose remote address is NOT valid (e.g. listening or
+*                               unconnected sockets), are hashed by protocol index & local port number ONLY
+*                               into 'NetConn_HashListenTbl[]'.  Thus connections bound to a specific local
+*                               address & connections bound to the wildcard address share a hash bucket.
+*
+*                       (2) Network connection searches are resolved in the same order as Note #2b2, with
+*                           each step requiring a single hash bucket search :
+*
+*                           (A) Full connection hash table searched with local          & remote addresses.
+*                           (B) Full connection hash table searched with local wildcard & remote addresses.
+*                           (C) Half connection hash table searched with local port number for a connection
+*                               with the local address, or else with the local wildcard address.
+*
+*                       (3) The connection lists are still maintained for connection list additions &
+*                           for closing all connections.
+*
 *
 *                                            |                                                             |
 *                                            |<---------------- List of Connection Chains ---------------->|
@@ -3441,8 +3514,12 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
     NET_CONN_ADDR_LEN   addr_len_chk_size;
 #endif
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    CPU_SIZE_T          addr_len_family;
+#else
     NET_CONN          **p_conn_list;
     NET_CONN           *p_conn_chain;
+#endif
     NET_CONN           *p_conn;
     NET_CONN_ID         conn_id;
     CPU_INT08U          addr_wildcard[NET_CONN_ADDR_LEN_MAX];
@@ -3458,6 +3535,8 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
        *p_conn_id_app  =  NET_CONN_ID_NONE;
     }
 
+    p_addr_wildcard = DEF_NULL;                                 /* Wildcard addr NOT avail until cfg'd.                 */
+
 
                                                                 /* --------------- VALIDATE LOCAL ADDR ---------------- */
     if (p_addr_local == DEF_NULL) {
@@ -3542,6 +3621,8 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
                      Mem_Copy((void     *)&addr_wildcard[NET_CONN_ADDR_IP_V4_IX_ADDR],
                               (void     *)&NetConn_AddrWildCardv4[0],
                               (CPU_SIZE_T) NET_CONN_ADDR_IP_V4_LEN_ADDR);
+
+                     p_addr_wildcard = &addr_wildcard[0];
                  }
 #endif
             }
@@ -3559,12 +3640,11 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
                      Mem_Copy((void     *)&addr_wildcard[NET_CONN_ADDR_IP_V6_IX_ADDR],
                               (void     *)&NetConn_AddrWildCardv6[0],
                               (CPU_SIZE_T) NET_CONN_ADDR_IP_V6_LEN_ADDR);
+
+                     p_addr_wildcard = &addr_wildcard[0];
                  }
 #endif
              }
-
-             p_addr_wildcard = &addr_wildcard[0];
-
              break;
 #endif
 
@@ -3584,6 +3664,28 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
 #endif
 
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)                           /* ------------- SRCH NET CONN HASH TBLS -------------- */
+                                                                /* See Note #2c.                                        */
+#ifdef  NET_IPv6_MODULE_EN
+    if (family == NET_CONN_FAMILY_IP_V6_SOCK) {
+        addr_len_family = NET_SOCK_ADDR_LEN_IP_V6;
+    } else
+#endif
+    {
+        addr_len_family = NET_SOCK_ADDR_LEN_IP_V4;
+    }
+
+    p_conn = NetConn_HashSrch(protocol_ix,
+                              p_addr_local,
+                              p_addr_wildcard,
+                              p_addr_remote,
+                              addr_len_family,
+                              p_err);
+    if (p_conn == DEF_NULL) {                                   /* NO net conn       found.                             */
+        return (NET_CONN_ID_NONE);                              /* Rtn err from NetConn_HashSrch().                     */
+    }
+
+#else
                                                                 /* ---------------- SRCH NET CONN LIST ---------------- */
     p_conn_list  = &NetConn_ConnListHead[protocol_ix];
     p_conn_chain =  NetConn_ListSrch(family,
@@ -3605,6 +3707,7 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
     if (p_conn == DEF_NULL) {                                   /* NO net conn       found.                             */
         return (NET_CONN_ID_NONE);                              /* Rtn err from NetConn_ChainSrch().                    */
     }
+#endif
 
 
                                                                 /* If net conn       found, rtn conn id's.              */
@@ -3983,6 +4086,7 @@ static  NET_CONN  *NetConn_ListSrch (NET_CONN_FAMILY    family,
 *********************************************************************************************************
 */
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE == 0u)
 static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
                                       NET_CONN     *p_conn_chain,
                                       CPU_INT08U   *p_addr_local,
@@ -4033,9 +4137,12 @@ static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
                                                                 /* ... compiler warning.                                */
     }
 
-    addr_local_wildcard =  Mem_Cmp((void     *)p_addr_local,
-                                   (void     *)p_addr_wildcard,
-                                               addr_len);
+    addr_local_wildcard = DEF_NO;
+    if (p_addr_wildcard != DEF_NULL) {                          /* If wildcard addr avail, cmp to local addr.           */
+        addr_local_wildcard = Mem_Cmp((void     *)p_addr_local,
+                                      (void     *)p_addr_wildcard,
+                                                  addr_len);
+    }
 
     while ((p_conn != DEF_NULL) &&                              /* Srch ALL net conns in chain ..                       */
            (found  ==  DEF_NO)) {                               /* .. until net conn found.                             */
@@ -4138,6 +4245,7 @@ static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
 
     return (p_conn);
 }
+#endif
 
 
 /*
@@ -4281,7 +4389,8 @@ static  void  NetConn_ChainUnlink (NET_CONN  **p_conn_list,
 * Caller(s)   : NetConn_ListAdd(),
 *               NetConn_ChainSrch().
 *
-* Note(s)     : none.
+* Note(s)     : (2) If network connection hash tables enabled, network connection is also added into the
+*                   appropriate hash table (see 'NetConn_HashAdd()  Note #1').
 *********************************************************************************************************
 */
 
@@ -4333,6 +4442,10 @@ static  void  NetConn_Add (NET_CONN  **p_conn_list,
     }
 
     p_conn->ConnList = p_conn_list;                                 /* Mark conn's conn list ownership.                 */
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    NetConn_HashAdd(p_conn);                                        /* Add conn into hash tbl (see Note #2).            */
+#endif
 }
 
 
@@ -4424,6 +4537,10 @@ static  void  NetConn_Unlink (NET_CONN  *p_conn)
 
     p_conn->ConnList     = (NET_CONN **)0;                              /* Clr net conn's conn list ownership.          */
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    NetConn_HashUnlink(p_conn);                                         /* Unlink net conn from hash tbl.               */
+#endif
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)                             /* Clr net conn's chain/conn ptrs (see Note #1).*/
     p_conn->PrevChainPtr = (NET_CONN  *)0;
     p_conn->NextChainPtr = (NET_CONN  *)0;
@@ -4433,6 +4550,416 @@ static  void  NetConn_Unlink (NET_CONN  *p_conn)
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetConn_HashSrch()
+*
+* Description : Search network connection hash tables for network connection with specific local &/or
+*               remote addresses.
+*
+* Argument(s) : protocol_ix         Network connection protocol index.
+*               -----------         Argument checked   in NetConn_Srch().
+*
+*               p_addr_local        Pointer to local          address.
+*               -----------         Argument checked   in NetConn_Srch().
+*
+*               p_addr_wildcard     Pointer to local wildcard address, if available.
+*
+*               p_addr_remote       Pointer to remote         address, if available.
+*
+*               addr_len            Length of network connection family addresses (in octets).
+*               --------            Argument validated in NetConn_Srch().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_CONN_ERR_CONN_NONE              NO   network connection found.
+*                               NET_CONN_ERR_CONN_HALF              Half network connection found --
+*                                                                       local            addresses match.
+*                               NET_CONN_ERR_CONN_HALF_WILDCARD     Half network connection found --
+*                                                                       local & wildcard addresses match.
+*                               NET_CONN_ERR_CONN_FULL              Full network connection found --
+*                                                                       local & remote   addresses match.
+*                               NET_CONN_ERR_CONN_FULL_WILDCARD     Full network connection found --
+*                                                                       local & wildcard addresses match
+*                                                                             & remote   addresses match.
+*
+* Return(s)   : Pointer to connection with specific local & remote address, if found.
+*
+*               Pointer to NULL,                                            otherwise.
+*
+* Caller(s)   : NetConn_Srch().
+*
+* Note(s)     : (1) Network connection addresses maintained in network-order.
+*
+*               (2) See 'NetConn_Srch()  Note #2c2'.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+static  NET_CONN  *NetConn_HashSrch (NET_CONN_PROTOCOL_IX   protocol_ix,
+                                     CPU_INT08U            *p_addr_local,
+                                     CPU_INT08U            *p_addr_wildcard,
+                                     CPU_INT08U            *p_addr_remote,
+                                     CPU_SIZE_T             addr_len,
+                                     NET_ERR               *p_err)
+{
+    NET_CONN     *p_conn;
+    NET_CONN     *p_conn_half_wildcard;
+    CPU_INT32U    hash_ix;
+    CPU_BOOLEAN   addr_local_wildcard;
+    CPU_BOOLEAN   found;
+
+
+    addr_local_wildcard = DEF_YES;                              /* Srch wildcard addr only if local addr NOT wildcard.  */
+    if (p_addr_wildcard != DEF_NULL) {
+        addr_local_wildcard = Mem_Cmp((void     *)p_addr_local,
+                                      (void     *)p_addr_wildcard,
+                                                  addr_len);
+    }
+
+                                                                /* ------------- SRCH FULL CONN HASH TBL -------------- */
+    if (p_addr_remote != DEF_NULL) {
+        p_conn = NetConn_HashSrchFull(protocol_ix,              /* Srch local & remote addrs (see Note #2) ...          */
+                                      p_addr_local,
+                                      p_addr_remote,
+                                      addr_len);
+        if (p_conn != DEF_NULL) {
+           *p_err = NET_CONN_ERR_CONN_FULL;
+            return (p_conn);
+        }
+
+        if (addr_local_wildcard == DEF_NO) {                    /* ... then local wildcard & remote addrs.              */
+            p_conn = NetConn_HashSrchFull(protocol_ix,
+                                          p_addr_wildcard,
+                                          p_addr_remote,
+                                          addr_len);
+            if (p_conn != DEF_NULL) {
+               *p_err = NET_CONN_ERR_CONN_FULL_WILDCARD;
+                return (p_conn);
+            }
+        }
+    }
+
+                                                                /* ------------ SRCH LISTEN CONN HASH TBL ------------- */
+    hash_ix              = NetConn_HashCalc(protocol_ix,
+                                            p_addr_local,
+                                            DEF_NULL,
+                                            addr_len);
+    p_conn               = NetConn_HashListenTbl[hash_ix];
+    p_conn_half_wildcard = DEF_NULL;
+
+    while (p_conn != DEF_NULL) {
+        if (p_conn->ProtocolIx == protocol_ix) {
+            found = Mem_Cmp((void     *) p_addr_local,
+                            (void     *)&p_conn->AddrLocal[0],
+                                         addr_len);
+            if (found == DEF_YES) {                             /* If local addrs match, rtn half conn.                 */
+               *p_err = NET_CONN_ERR_CONN_HALF;
+                return (p_conn);
+            }
+
+            if ((addr_local_wildcard  == DEF_NO) &&             /* If local wildcard addrs match, save half conn.       */
+                (p_conn_half_wildcard == DEF_NULL)) {
+                found = Mem_Cmp((void     *) p_addr_wildcard,
+                                (void     *)&p_conn->AddrLocal[0],
+                                             addr_len);
+                if (found == DEF_YES) {
+                    p_conn_half_wildcard = p_conn;
+                }
+            }
+        }
+
+        p_conn = p_conn->NextHashPtr;
+    }
+
+
+    if (p_conn_half_wildcard != DEF_NULL) {                     /* Half conn found with wildcard addr.                  */
+       *p_err = NET_CONN_ERR_CONN_HALF_WILDCARD;
+    } else {                                                    /* NO   conn found.                                     */
+       *p_err = NET_CONN_ERR_CONN_NONE;
+    }
+
+    return (p_conn_half_wildcard);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetConn_HashSrchFull()
+*
+* Description : Search full network connection hash table for network connection with specific local &
+*               remote addresses.
+*
+* Argument(s) : protocol_ix     Network connection protocol index.
+*               -----------     Argument checked   in NetConn_Srch().
+*
+*               p_addr_local    Pointer to local  address.
+*               ------------    Argument checked   in NetConn_Srch().
+*
+*               p_addr_remote   Pointer to remote address.
+*               -------------   Argument checked   in NetConn_HashSrch().
+*
+*               addr_len        Length of network connection family addresses (in octets).
+*               --------        Argument validated in NetConn_Srch().
+*
+* Return(s)   : Pointer to connection with specific local & remote address, if found.
+*
+*               Pointer to NULL,                                            otherwise.
+*
+* Caller(s)   : NetConn_HashSrch().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+static  NET_CONN  *NetConn_HashSrchFull (NET_CONN_PROTOCOL_IX   protocol_ix,
+                                         CPU_INT08U            *p_addr_local,
+                                         CPU_INT08U            *p_addr_remote,
+                                         CPU_SIZE_T             addr_len)
+{
+    NET_CONN     *p_conn;
+    CPU_INT32U    hash_ix;
+    CPU_BOOLEAN   found;
+
+
+    hash_ix = NetConn_HashCalc(protocol_ix,
+                               p_addr_local,
+                               p_addr_remote,
+                               addr_len);
+    p_conn  = NetConn_HashTbl[hash_ix];
+
+    while (p_conn != DEF_NULL) {                                /* Srch hash bucket for conn with same addrs.           */
+        if (p_conn->ProtocolIx == protocol_ix) {
+            found = Mem_Cmp((void     *) p_addr_remote,
+                            (void     *)&p_conn->AddrRemote[0],
+                                         addr_len);
+            if (found == DEF_YES) {
+                found = Mem_Cmp((void     *) p_addr_local,
+                                (void     *)&p_conn->AddrLocal[0],
+                                             addr_len);
+                if (found == DEF_YES) {
+                    return (p_conn);
+                }
+            }
+        }
+
+        p_conn = p_conn->NextHashPtr;
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         NetConn_HashCalc()
+*
+* Description : Calculate network connection hash table index.
+*
+* Argument(s) : protocol_ix     Network connection protocol index.
+*
+*               p_addr_local    Pointer to local  address.
+*
+*               p_addr_remote   Pointer to remote address, for full connection hash table index;
+*                               NULL,                      for half connection hash table index
+*                                                              (see Note #1b).
+*
+*               addr_len        Length of network connection family addresses (in octets).
+*
+* Return(s)   : Hash table index.
+*
+* Caller(s)   : NetConn_HashSrch(),
+*               NetConn_HashSrchFull(),
+*               NetConn_HashAdd().
+*
+* Note(s)     : (1) (a) Full connections are hashed by protocol index, local address & remote address.
+*
+*                   (b) Half connections are hashed by protocol index & local port number ONLY, so that
+*                       connections bound to any local address & to the wildcard address share a bucket.
+*
+*                   See also 'NetConn_Srch()  Note #2c1'.
+*
+*               (2) Upper hash bits folded into lower hash bits since the hash table index is masked
+*                   from the lower bits (see 'net_conn.h  NETWORK CONNECTION HASH TABLE DEFINES').
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+static  CPU_INT32U  NetConn_HashCalc (NET_CONN_PROTOCOL_IX   protocol_ix,
+                                      CPU_INT08U            *p_addr_local,
+                                      CPU_INT08U            *p_addr_remote,
+                                      CPU_SIZE_T             addr_len)
+{
+    CPU_INT08U  *p_addr;
+    CPU_SIZE_T   len;
+    CPU_SIZE_T   i;
+    CPU_INT32U   hash;
+
+
+    hash  =  NET_CONN_HASH_FNV_OFFSET ^ (CPU_INT32U)protocol_ix;
+    hash *=  NET_CONN_HASH_FNV_PRIME;
+
+    if (p_addr_remote == DEF_NULL) {                            /* Hash local port nbr only (see Note #1b).             */
+        p_addr = p_addr_local + NET_CONN_ADDR_IP_IX_PORT;
+        len    =                NET_CONN_ADDR_IP_LEN_PORT;
+    } else {
+        p_addr = p_addr_local;
+        len    = addr_len;
+    }
+
+    for (i = 0u; i < len; i++) {                                /* Hash local addr.                                     */
+        hash ^= (CPU_INT32U)p_addr[i];
+        hash *=  NET_CONN_HASH_FNV_PRIME;
+    }
+
+    if (p_addr_remote != DEF_NULL) {                            /* Hash remote addr (see Note #1a).                     */
+        for (i = 0u; i < addr_len; i++) {
+            hash ^= (CPU_INT32U)p_addr_remote[i];
+            hash *=  NET_CONN_HASH_FNV_PRIME;
+        }
+    }
+
+    hash ^= (hash >> 16u);                                      /* Fold upper bits (see Note #2).                       */
+
+    return (hash & (NET_CONN_CFG_HASH_TBL_SIZE - 1u));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          NetConn_HashAdd()
+*
+* Description : Add a network connection into a network connection hash table.
+*
+* Argument(s) : p_conn      Pointer to a network connection.
+*               ------      Argument validated in NetConn_ListAdd(),
+*                                                 NetConn_AddrLocalSet(),
+*                                                 NetConn_AddrRemoteSet().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetConn_Add(),
+*               NetConn_AddrLocalSet(),
+*               NetConn_AddrRemoteSet().
+*
+* Note(s)     : (1) (a) Network connections with a valid remote address are added into the full
+*                       connection hash table.
+*
+*                   (b) All other network connections are added into the half connection hash table.
+*
+*                   See also 'NetConn_Srch()  Note #2c1'.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+static  void  NetConn_HashAdd (NET_CONN  *p_conn)
+{
+    NET_CONN   **p_hash_list;
+    CPU_SIZE_T   addr_len;
+    CPU_INT32U   hash_ix;
+
+
+    switch (p_conn->Family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_CONN_FAMILY_IP_V4_SOCK:
+             addr_len = NET_SOCK_ADDR_LEN_IP_V4;
+             break;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_CONN_FAMILY_IP_V6_SOCK:
+             addr_len = NET_SOCK_ADDR_LEN_IP_V6;
+             break;
+#endif
+
+        case NET_CONN_FAMILY_NONE:
+        default:
+             return;
+    }
+
+    if (p_conn->AddrRemoteValid == DEF_YES) {                   /* Get full conn hash bucket (see Note #1a) ...         */
+        hash_ix     =  NetConn_HashCalc(p_conn->ProtocolIx,
+                                       &p_conn->AddrLocal[0],
+                                       &p_conn->AddrRemote[0],
+                                        addr_len);
+        p_hash_list = &NetConn_HashTbl[hash_ix];
+
+    } else {                                                    /* ... or half conn hash bucket (see Note #1b).         */
+        hash_ix     =  NetConn_HashCalc(p_conn->ProtocolIx,
+                                       &p_conn->AddrLocal[0],
+                                        DEF_NULL,
+                                        addr_len);
+        p_hash_list = &NetConn_HashListenTbl[hash_ix];
+    }
+
+                                                                /* Insert conn at hash bucket head.                     */
+    p_conn->PrevHashPtr = DEF_NULL;
+    p_conn->NextHashPtr = *p_hash_list;
+    if (*p_hash_list != DEF_NULL) {
+       (*p_hash_list)->PrevHashPtr = p_conn;
+    }
+   *p_hash_list      = p_conn;
+
+    p_conn->HashList = p_hash_list;                             /* Mark conn's hash bucket ownership.                   */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetConn_HashUnlink()
+*
+* Description : Unlink a network connection from its network connection hash table.
+*
+* Argument(s) : p_conn      Pointer to a network connection.
+*               ------      Argument validated in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetConn_Unlink(),
+*               NetConn_AddrLocalSet(),
+*               NetConn_AddrRemoteSet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+static  void  NetConn_HashUnlink (NET_CONN  *p_conn)
+{
+    NET_CONN  **p_hash_list;
+    NET_CONN   *p_conn_prev;
+    NET_CONN   *p_conn_next;
+
+
+    p_hash_list = p_conn->HashList;
+    if (p_hash_list == DEF_NULL) {                              /* If net conn NOT in hash tbl, ...                     */
+        return;                                                 /* ... exit unlink.                                     */
+    }
+
+    p_conn_prev = p_conn->PrevHashPtr;
+    p_conn_next = p_conn->NextHashPtr;
+
+    if (p_conn_prev != DEF_NULL) {                              /* Unlink conn from middle of hash bucket ...           */
+        p_conn_prev->NextHashPtr = p_conn_next;
+    } else {                                                    /* ... or from hash bucket head.                        */
+       *p_hash_list              = p_conn_next;
+    }
+
+    if (p_conn_next != DEF_NULL) {
+        p_conn_next->PrevHashPtr = p_conn_prev;
+    }
+
+    p_conn->PrevHashPtr = DEF_NULL;
+    p_conn->NextHashPtr = DEF_NULL;
+    p_conn->HashList    = DEF_NULL;                             /* Clr net conn's hash bucket ownership.                */
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           NetConn_Close()
@@ -4888,6 +5415,11 @@ static  void  NetConn_Clr (NET_CONN  *p_conn)
     p_conn->PrevConnPtr           = (NET_CONN  *)0;
     p_conn->NextConnPtr           = (NET_CONN  *)0;
     p_conn->ConnList              = (NET_CONN **)0;
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    p_conn->PrevHashPtr           = (NET_CONN  *)0;
+    p_conn->NextHashPtr           = (NET_CONN  *)0;
+    p_conn->HashList              = (NET_CONN **)0;
+#endif
     p_conn->ID_App                =  NET_CONN_ID_NONE;
     p_conn->ID_AppClone           =  NET_CONN_ID_NONE;
     p_conn->ID_Transport          =  NET_CONN_ID_NONE;
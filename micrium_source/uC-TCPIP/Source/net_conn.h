@@ -122,6 +122,33 @@
 #define  NET_CONN_ACCESSED_TH_DFLT                       100
 
 
+/*
+*********************************************************************************************************
+*                                NETWORK CONNECTION HASH TABLE DEFINES
+*
+* Note(s) : (1) NET_CONN_CFG_HASH_TBL_SIZE configures the number of buckets in each network connection
+*               hash table :
+*
+*               (a) 0u disables the hash tables; connections are demultiplexed by searching the
+*                   connection lists (see 'net_conn.c  NetConn_Srch()  Note #2b').
+*
+*               (b) Otherwise, MUST be a power of 2 so that hash values are reduced to a bucket index
+*                   with a mask.
+*
+*           (2) Network connection hash values are computed with the 32-bit FNV-1a hash function.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_CONN_CFG_HASH_TBL_SIZE
+#define  NET_CONN_CFG_HASH_TBL_SIZE                        0u   /* See Note #1a.                                        */
+#endif
+
+#define  NET_CONN_HASH_TBL_SIZE_MAX                     4096u
+
+#define  NET_CONN_HASH_FNV_OFFSET                 2166136261u   /* See Note #2.                                         */
+#define  NET_CONN_HASH_FNV_PRIME                    16777619u
+
+
 /*
 *********************************************************************************************************
 *                              NETWORK CONNECTION PROTOCOL INDEX DEFINES
@@ -466,6 +493,13 @@ struct  net_conn {
 
     NET_CONN               **ConnList;                          /* Conn list.                                           */
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+    NET_CONN                *PrevHashPtr;                       /* Ptr to PREV conn in hash bucket.                     */
+    NET_CONN                *NextHashPtr;                       /* Ptr to NEXT conn in hash bucket.                     */
+
+    NET_CONN               **HashList;                          /* Conn hash bucket.                                    */
+#endif
+
 
     NET_CONN_ID              ID;                                /* Net             conn id.                             */
     NET_CONN_ID              ID_App;                            /* App       layer conn id.                             */
@@ -529,6 +563,13 @@ NET_CONN_EXT  NET_CONN         *NetConn_ConnListConnPtr;            /* Ptr to cu
 NET_CONN_EXT  NET_CONN         *NetConn_ConnListNextChainPtr;       /* Ptr to next conn list chain to update.           */
 NET_CONN_EXT  NET_CONN         *NetConn_ConnListNextConnPtr;        /* Ptr to next conn list conn  to update.           */
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+                                                                    /* Hash tbl of full conns (local & remote addrs).   */
+NET_CONN_EXT  NET_CONN         *NetConn_HashTbl[NET_CONN_CFG_HASH_TBL_SIZE];
+                                                                    /* Hash tbl of half conns (local port).             */
+NET_CONN_EXT  NET_CONN         *NetConn_HashListenTbl[NET_CONN_CFG_HASH_TBL_SIZE];
+#endif
+
 
 NET_CONN_EXT  CPU_INT16U        NetConn_AccessedTh_nbr;             /* Nbr successful srch's to promote net conns.      */
 
@@ -804,6 +845,14 @@ void              NetConn_ListUnlink                (NET_CONN_ID              co
 #endif
 
 
+#if    ((NET_CONN_CFG_HASH_TBL_SIZE  > NET_CONN_HASH_TBL_SIZE_MAX) || \
+        ((NET_CONN_CFG_HASH_TBL_SIZE & (NET_CONN_CFG_HASH_TBL_SIZE - 1u)) != 0u))
+#error  "NET_CONN_CFG_HASH_TBL_SIZE        illegally #define'd in 'net_cfg.h'"
+#error  "                                  [MUST be  0 (disabled) or a power of 2]"
+#error  "                                  [     &&  <= NET_CONN_HASH_TBL_SIZE_MAX]"
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
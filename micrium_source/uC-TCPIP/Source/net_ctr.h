@@ -73,6 +73,19 @@
 
 
 
+#ifndef  NET_CTR_CFG_LOCK_STAT_EN                               /* Lock stats dflt DISABLED.                            */
+#define  NET_CTR_CFG_LOCK_STAT_EN       DEF_DISABLED
+#endif
+
+#if    ((NET_CTR_CFG_LOCK_STAT_EN != DEF_DISABLED) && \
+        (NET_CTR_CFG_LOCK_STAT_EN != DEF_ENABLED ))
+#error  "NET_CTR_CFG_LOCK_STAT_EN  illegally #define'd in 'net_cfg.h'"
+#error  "                          [MUST be  DEF_DISABLED]           "
+#error  "                          [     ||  DEF_ENABLED ]           "
+#endif
+
+
+
 #ifndef  NET_CTR_CFG_ERR_EN
 #error  "NET_CTR_CFG_ERR_EN         not #define'd in 'net_cfg.h'"
 #error  "                     [MUST be  DEF_DISABLED]           "
@@ -194,6 +207,8 @@ typedef  struct  net_ctr_if_stats {
     NET_CTR  RxNbrPktCtrPerSecMax;                          /* Nbr rx'd pkts   per  sec max   for a specific IF.        */
     NET_CTR  RxNbrPktCtrProcessed;                          /* Nbr rx'd pkts        processed for a specific IF.        */
     NET_CTR  RxNbrPktCtrProcessedPrev;                      /* Nbr rx'd pkts   prev processed for a specific IF.        */
+    NET_CTR  RxGRO_PktCtr;                                  /* Nbr rx'd coalesced pkts (GRO)  for a specific IF.        */
+    NET_CTR  RxGRO_SegCtr;                                  /* Nbr rx'd segs   coalesced      for a specific IF.        */
 
     NET_CTR  TxNbrOctets;                                   /* Nbr      octets      tx'd      for a specific IF.        */
     NET_CTR  TxNbrOctetsPrev;                               /* Nbr      octets prev tx'd      for a specific IF.        */
@@ -204,6 +219,7 @@ typedef  struct  net_ctr_if_stats {
     NET_CTR  TxNbrPktCtrPerSecMax;                          /* Nbr tx'd pkts   per  sec max   for a specific IF.        */
     NET_CTR  TxNbrPktCtrProcessed;                          /* Nbr tx'd pkts        processed for a specific IF.        */
     NET_CTR  TxNbrPktCtrProcessedPrev;                      /* Nbr tx'd pkts   prev processed for a specific IF.        */
+    NET_CTR  TxTSO_SegCtr;                                  /* Nbr tx'd segs   replicated     for a specific IF.        */
 } NET_CTR_IF_STATS;
 
 
@@ -261,6 +277,7 @@ typedef  struct  net_ctr_ifs_stats {
         NET_CTR_IF_STATS           IF[NET_IF_NBR_IF_TOT];   /* IF stat ctrs.                                            */
 
         NET_CTR                    RxPktCtr;                /* Nbr rx'd IF pkts.                                        */
+        NET_CTR                    RxBatchCtr;              /* Nbr rx'd IF pkt batches (i.e. net lock acquisitions).    */
 
         NET_CTR                    TxPktCtr;                /* Nbr tx'd IF pkts.                                        */
         NET_CTR                    TxPktDeallocCtr;         /* Nbr tx'd IF pkts successfully dealloc'd.                 */
@@ -927,6 +944,8 @@ typedef  struct  net_ctr_ipv4_errs {
         NET_CTR  RxFragDisCtr;                              /* Nbr rx'd IPv4 frags            discarded.                */
         NET_CTR  RxFragDgramDisCtr;                         /* Nbr rx'd IPv4 frag'd datagrams discarded.                */
         NET_CTR  RxFragDgramTimeoutCtr;                     /* Nbr rx'd IPv4 frag'd datagrams timed out.                */
+        NET_CTR  RxFragSrcSizeMaxCtr;                       /* Nbr rx'd IPv4 frags discarded over per-src max size.     */
+        NET_CTR  RxFragSrcTblFullCtr;                       /* Nbr rx'd IPv4 frags discarded w/ per-src tbl full.       */
     #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
         NET_CTR  RxInvBufIxCtr;                             /* Nbr rx   IPv4 pkts  with invalid buf ix.                 */
         NET_CTR  RxInvBufTypeCtr;
@@ -1201,6 +1220,7 @@ typedef  struct net_ctr_tcp_errs {
         NET_CTR  RxHdrFlagsCtr;                                 /* Nbr rx'd TCP segs with invalid flags.                */
         NET_CTR  RxHdrChkSumCtr;                                /* Nbr rx'd TCP segs with invalid chk sum.              */
         NET_CTR  RxHdrOptsCtr;                                  /* Nbr rx'd TCP segs with unknown/invalid opts.         */
+        NET_CTR  RxSegPAWS_Ctr;                                 /* Nbr rx'd TCP segs rejected by PAWS.                  */
         NET_CTR  RxDestCtr;                                     /* Nbr rx'd TCP segs for  unavail dest.                 */
         NET_CTR  RxPktDiscardedCtr;                             /* Nbr rx'd TCP pkts discarded.                         */
 
@@ -581,6 +581,11 @@
 #endif
 #define  TCP_KEEPCNT                                  0x100C    /*  = NET_SOCK_OPT_TCP_KEEP_CNT                         */
 
+#ifdef   TCP_CONGESTION
+#undef   TCP_CONGESTION
+#endif
+#define  TCP_CONGESTION                               0x100D    /*  = NET_SOCK_OPT_TCP_CONG_CTRL                        */
+
 
                                                                 /* ---------------------------------------------------- */
                                                                 /*                       IP LEVEL                       */
@@ -431,6 +431,7 @@ typedef enum net_err {
     NET_IF_ERR_TX_DEALLC_Q_SIGNAL               =   6308u,      /* Tx dealloc Q signal failed.                          */
     NET_IF_ERR_TX_DEALLC_Q_SIGNAL_TIMEOUT       =   6309u,      /* Tx dealloc Q signal timeout.                         */
     NET_IF_ERR_TX_DEALLC_Q_SIGNAL_FAULT         =   6310u,      /* Tx dealloc Q signal fault.                           */
+    NET_IF_ERR_TX_SEG_TMPL                      =   6311u,      /* Tx seg hdr tmpl NOT avail.                           */
 
 
 /*
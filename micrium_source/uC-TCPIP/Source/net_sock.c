@@ -133,6 +133,11 @@ static  MEM_DYN_POOL           NetSock_AcceptQ_ObjPool;
 static  MEM_DYN_POOL           NetSock_SelObjPool;
 #endif
 
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+static  MEM_DYN_POOL           NetSock_EventSetPool;
+static  MEM_DYN_POOL           NetSock_EventRegPool;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -270,6 +275,8 @@ static  CPU_BOOLEAN             NetSock_ConnAcceptQ_ConnID_Remove    (NET_SOCK
 
 static  NET_SOCK_RTN_CODE       NetSock_RxDataHandler                (NET_SOCK_ID                sock_id,
                                                                       void                      *p_data_buf,
+                                                                      NET_SOCK_IO_VEC           *p_iov,
+                                                                      CPU_INT16U                 iov_cnt,
                                                                       CPU_INT16U                 data_buf_len,
                                                                       NET_SOCK_API_FLAGS         flags,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
@@ -277,12 +284,15 @@ static  NET_SOCK_RTN_CODE       NetSock_RxDataHandler                (NET_SOCK_I
                                                                       void                      *p_ip_opts_buf,
                                                                       CPU_INT08U                 ip_opts_buf_len,
                                                                       CPU_INT08U                *p_ip_opts_len,
+                                                                      NET_BUF                  **p_buf_zero_copy,
                                                                       NET_ERR                   *p_err);
 
 
 static  NET_SOCK_RTN_CODE       NetSock_RxDataHandlerDatagram        (NET_SOCK_ID                sock_id,
                                                                       NET_SOCK                  *p_sock,
                                                                       void                      *p_data_buf,
+                                                                      NET_SOCK_IO_VEC           *p_iov,
+                                                                      CPU_INT16U                 iov_cnt,
                                                                       CPU_INT16U                 data_buf_len,
                                                                       NET_SOCK_API_FLAGS         flags,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
@@ -290,24 +300,31 @@ static  NET_SOCK_RTN_CODE       NetSock_RxDataHandlerDatagram        (NET_SOCK_I
                                                                       void                      *p_ip_opts_buf,
                                                                       CPU_INT08U                 ip_opts_buf_len,
                                                                       CPU_INT08U                *p_ip_opts_len,
+                                                                      NET_BUF                  **p_buf_zero_copy,
                                                                       NET_ERR                   *p_err);
 
 
 static  NET_SOCK_RTN_CODE       NetSock_TxDataHandler                (NET_SOCK_ID                sock_id,
                                                                       void                      *p_data,
+                                                                      NET_SOCK_IO_VEC           *p_iov,
+                                                                      CPU_INT16U                 iov_cnt,
                                                                       CPU_INT16U                 data_len,
                                                                       NET_SOCK_API_FLAGS         flags,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
                                                                       NET_SOCK_ADDR_LEN          addr_len,
+                                                                      NET_BUF                  **p_buf_zero_copy,
                                                                       NET_ERR                   *p_err);
 
 
 static  NET_SOCK_RTN_CODE       NetSock_TxDataHandlerDatagram        (NET_SOCK_ID                sock_id,
                                                                       NET_SOCK                  *p_sock,
                                                                       void                      *p_data,
+                                                                      NET_SOCK_IO_VEC           *p_iov,
+                                                                      CPU_INT16U                 iov_cnt,
                                                                       CPU_INT16U                 data_len,
                                                                       NET_SOCK_API_FLAGS         flags,
                                                                       NET_SOCK_ADDR             *p_addr_remote,
+                                                                      NET_BUF                  **p_buf_zero_copy,
                                                                       NET_ERR                   *p_err);
 
 
@@ -322,6 +339,20 @@ static  void                    NetSock_AppPostTx                    (NET_CONN_I
 static  CPU_BOOLEAN             NetSock_SelPost                      (NET_SOCK                  *p_sock,
                                                                       NET_SOCK_EVENT_TYPE        event);
 
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+static  void                    NetSock_EventSetPost                 (NET_SOCK                  *p_sock,
+                                                                      NET_SOCK_SEL_EVENT_FLAG    flags_mask);
+
+static  void                    NetSock_EventSetRdyInsert            (NET_SOCK_EVENT_REG        *p_reg);
+
+static  NET_SOCK_QTY            NetSock_EventSetRdyHandler           (NET_SOCK_EVENT_SET        *p_set,
+                                                                      NET_SOCK_EVENT            *p_events,
+                                                                      NET_SOCK_QTY               events_max);
+
+static  void                    NetSock_EventSetRegFree              (NET_SOCK                  *p_sock,
+                                                                      NET_SOCK_EVENT_REG        *p_reg);
+#endif
+
 static  NET_SOCK_QTY            NetSock_SelDescHandler               (NET_SOCK_QTY               sock_nbr_max,
                                                                       NET_SOCK_DESC             *p_sock_desc_rd,
                                                                       NET_SOCK_DESC             *p_sock_desc_wr,
@@ -440,6 +471,9 @@ static  void                    NetSock_Copy                         (NET_SOCK
 
 static  void                    NetSock_Discard                      (NET_SOCK                  *p_sock);
 
+static  CPU_INT16U              NetSock_IO_VecLenGet                 (NET_SOCK_IO_VEC           *p_iov,
+                                                                      CPU_INT16U                 iov_cnt);
+
 
 
                                                                                     /* ----- RANDOM PORT Q FNCTS ------ */
@@ -580,6 +614,34 @@ void  NetSock_Init (NET_ERR  *p_err)
     }
 #endif
 
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+    Mem_DynPoolCreate("Event set pool",
+                      &NetSock_EventSetPool,
+                       DEF_NULL,
+                       sizeof(NET_SOCK_EVENT_SET),
+                       sizeof(CPU_ALIGN),
+                       0u,
+                       LIB_MEM_BLK_QTY_UNLIMITED,
+                      &err_lib);
+    if (err_lib != LIB_MEM_ERR_NONE) {
+       *p_err  = NET_SOCK_ERR_INIT_MEM_ALLOC;
+        return;
+    }
+
+    Mem_DynPoolCreate("Event set registration pool",
+                      &NetSock_EventRegPool,
+                       DEF_NULL,
+                       sizeof(NET_SOCK_EVENT_REG),
+                       sizeof(CPU_ALIGN),
+                       0u,
+                       LIB_MEM_BLK_QTY_UNLIMITED,
+                      &err_lib);
+    if (err_lib != LIB_MEM_ERR_NONE) {
+       *p_err  = NET_SOCK_ERR_INIT_MEM_ALLOC;
+        return;
+    }
+#endif
+
                                                                 /* -------------- INIT RANDOM PORT NBR Q -------------- */
 #ifndef NET_SOCK_CFG_PORT_RANDOM_START
     NetSock_RandomPortNbrCur = (NET_PORT_NBR)NetUtil_RandomRangeGet(NET_SOCK_PORT_NBR_RANDOM_MIN,
@@ -743,6 +805,9 @@ static  void  NetSock_InitObj (NET_SOCK  *p_sock,
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
     p_sock->SelObjTailPtr = DEF_NULL;                           /* Init Select Task Signal to NULL.                     */
 #endif
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+    p_sock->EventRegListPtr = DEF_NULL;                         /* Init event set reg list to NULL.                     */
+#endif
 
 
    *p_err = NET_SOCK_ERR_NONE;
@@ -5146,6 +5211,8 @@ NET_SOCK_RTN_CODE  NetSock_RxDataFrom (NET_SOCK_ID          sock_id,
                                                                 /* -------------- VALIDATE/RX SOCK DATA --------------- */
    rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
                                     (void              *)p_data_buf,
+                                    (NET_SOCK_IO_VEC   *)0,
+                                    (CPU_INT16U         )0u,
                                     (CPU_INT16U         )data_buf_len,
                                     (NET_SOCK_API_FLAGS )flags,
                                     (NET_SOCK_ADDR     *)p_addr_remote,
@@ -5153,6 +5220,7 @@ NET_SOCK_RTN_CODE  NetSock_RxDataFrom (NET_SOCK_ID          sock_id,
                                     (void              *)p_ip_opts_buf,
                                     (CPU_INT08U         )ip_opts_buf_len,
                                     (CPU_INT08U        *)p_ip_opts_len,
+                                    (NET_BUF          **)0,
                                     (NET_ERR           *)p_err);
 
    goto exit_release;
@@ -5339,6 +5407,8 @@ NET_SOCK_RTN_CODE  NetSock_RxData (NET_SOCK_ID          sock_id,
                                                                 /* -------------- VALIDATE/RX SOCK DATA --------------- */
     rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
                                      (void              *)p_data_buf,
+                                     (NET_SOCK_IO_VEC   *)0,
+                                     (CPU_INT16U         )0u,
                                      (CPU_INT16U         )data_buf_len,
                                      (NET_SOCK_API_FLAGS )flags,
                                      (NET_SOCK_ADDR     *)0,
@@ -5346,6 +5416,7 @@ NET_SOCK_RTN_CODE  NetSock_RxData (NET_SOCK_ID          sock_id,
                                      (void              *)0,
                                      (CPU_INT08U         )0u,
                                      (CPU_INT08U        *)0,
+                                     (NET_BUF          **)0,
                                      (NET_ERR           *)p_err);
 
     Net_GlobalLockRelease();
@@ -5548,10 +5619,13 @@ NET_SOCK_RTN_CODE  NetSock_TxDataTo (NET_SOCK_ID          sock_id,
                                                                 /* --------------- VALIDATE/TX APP DATA --------------- */
     rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
                                      (void             *)p_data,
+                                     (NET_SOCK_IO_VEC  *)0,
+                                     (CPU_INT16U        )0u,
                                      (CPU_INT16U        )data_len,
                                      (NET_SOCK_API_FLAGS)flags,
                                      (NET_SOCK_ADDR    *)p_addr_remote,
                                      (NET_SOCK_ADDR_LEN )addr_len,
+                                     (NET_BUF         **)0,
                                      (NET_ERR          *)p_err);
 
     return (rtn_code);
@@ -5735,10 +5809,13 @@ NET_SOCK_RTN_CODE  NetSock_TxData (NET_SOCK_ID          sock_id,
                                                                 /* --------------- VALIDATE/TX APP DATA --------------- */
     rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
                                      (void             *)p_data,
+                                     (NET_SOCK_IO_VEC  *)0,
+                                     (CPU_INT16U        )0u,
                                      (CPU_INT16U        )data_len,
                                      (NET_SOCK_API_FLAGS)flags,
                                      (NET_SOCK_ADDR    *)0,
                                      (NET_SOCK_ADDR_LEN )0,
+                                     (NET_BUF         **)0,
                                      (NET_ERR          *)p_err);
 
     return (rtn_code);
@@ -5747,566 +5824,1553 @@ NET_SOCK_RTN_CODE  NetSock_TxData (NET_SOCK_ID          sock_id,
 
 /*
 *********************************************************************************************************
-*                                           NetSock_Sel()
-*
-* Description : (1) Check multiple sockets for available resources &/or operations :
-*
-*                   (a) Acquire network lock
-*                   (b) Check sockets for available resources &/or operations :
-*                       (1) Validate socket descriptors' sockets
-*                       (2) Check    sockets for available resources &/or operations        See Note #3b2
-*                       (3) Prepare  sockets for wait on appropriate socket events
-*
-*                   (c) Handle timeout :                                                    See Note #3b3
-*                       (1) Prepare timeout
-*                       (2) Handle  time delay, if any
-*
-*                   (d) Wait on socket descriptor events :
-*                       (1) Demultiplex ready socket event(s) to appropriate socket descriptor(s)
-*
-*                   (e) Release network lock
+*                                          NetSock_RxDataV()
 *
+* Description : (1) Receive data from a socket, scattered into an array of application data buffers :
 *
-* Argument(s) : sock_nbr_max        Maximum number of socket descriptors/handle identifiers in the socket
-*                                       descriptor sets (see Note #3b1).
-*
-*               p_sock_desc_rd       Pointer to a set of socket descriptors/handle identifiers to :
+*                   (a) Validate I/O vectors
+*                   (b) Acquire  network lock
+*                   (c) Validate & receive socket data
+*                   (d) Release  network lock
 *
-*                                       (a) Check for available read  operation(s) [see Note #3b2A1].
+*                   See also 'NetSock_RxDataHandler()  Note #1'.
 *
-*                                       (b) (1) Return the actual socket descriptors/handle identifiers
-*                                                   ready for available read  operation(s), if NO error(s)
-*                                                   [see Note #3b2B1a1];
-*                                           (2) Return the initial, non-modified set of socket descriptors/
-*                                                   handle identifiers, on any error(s) [see Note #3c2A];
-*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
-*                                                   if any timeout expires (see Note #3c2B).
 *
-*               p_sock_desc_wr       Pointer to a set of socket descriptors/handle identifiers to :
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
 *
-*                                       (a) Check for available write operation(s) [see Note #3b2A2].
+*               p_iov           Pointer to an array of I/O vectors that will receive the socket's received data.
 *
-*                                       (b) (1) Return the actual socket descriptors/handle identifiers
-*                                                   ready for available write operation(s), if NO error(s)
-*                                                   [see Note #3b2B1a1];
-*                                           (2) Return the initial, non-modified set of socket descriptors/
-*                                                   handle identifiers, on any error(s) [see Note #3c2A];
-*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
-*                                                   if any timeout expires (see Note #3c2B).
+*               iov_cnt         Number of I/O vectors in array.
 *
-*               p_sock_desc_err      Pointer to a set of socket descriptors/handle identifiers to :
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
 *
-*                                       (a) Check for any error(s) &/or exception(s) [see Note #3b2A3].
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_RX_DATA_PEEK      Receive socket data without consuming
+*                                                                       the socket data; i.e. socket data
+*                                                                       NOT removed from application receive
+*                                                                       queue(s).
+*                                   NET_SOCK_FLAG_RX_NO_BLOCK       Receive socket data without blocking.
 *
-*                                       (b) (1) Return the actual socket descriptors/handle identifiers
-*                                                   flagged with any error(s) &/or exception(s), if NO
-*                                                   non-descriptor-related error(s) [see Note #3b2B1a1];
-*                                           (2) Return the initial, non-modified set of socket descriptors/
-*                                                   handle identifiers, on any error(s) [see Note #3c2A];
-*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
-*                                                   if any timeout expires (see Note #3c2B).
+*               p_addr_remote   Pointer to an address buffer that will receive the socket address structure
+*                                   with the received data's remote address, if available; NULL pointer,
+*                                   otherwise.
 *
-*               p_timeout           Pointer to a timeout (see Note #3b3).
+*               p_addr_len      Pointer to a variable to ... :
 *
-*               p_err        Pointer to variable that will receive the return error code from this function :
+*                                   (a) Pass the size of the address buffer pointed to by 'p_addr_remote'.
+*                                   (b) (1) Return the actual size of socket address structure with the
+*                                               received data's remote address, if NO error(s);
+*                                       (2) Return 0,                           otherwise.
 *
-*                               NET_SOCK_ERR_NONE               Socket descriptors successfully checked for
-*                                                                   available resources &/or operations;
-*                                                                   check return value for the number of
-*                                                                   ready socket descriptors with available
-*                                                                   resources &/or operations.
+*                               Required ONLY if 'p_addr_remote' is available.
 *
-*                               NET_SOCK_ERR_TIMEOUT            Socket descriptors NOT ready within timeout
-*                                                                   (see Note #3b3A1a2).
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
-*                               NET_SOCK_ERR_INVALID_DESC       Invalid socket descriptor/number.
-*                               NET_SOCK_ERR_INVALID_TIMEOUT    Invalid timeout.
+*                               NET_ERR_FAULT_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Argument 'iov_cnt' passed an invalid size.
+*                               NET_SOCK_ERR_INVALID_ADDR_LEN       Invalid socket address structure length.
 *
-*                                                               - RETURNED BY NetSock_SelDescHandlerRd() : --
-*                                                               - RETURNED BY NetSock_SelDescHandlerWr() : --
-*                                                               - RETURNED BY NetSock_SelDescHandlerErr() : -
-*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
-*                               NET_SOCK_ERR_INVALID_TYPE       Invalid socket type.
-*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*                                                                   ----- RETURNED BY NetSock_RxDataHandler() : ------
+*                               NET_SOCK_ERR_NONE                   Socket data successfully received; check return
+*                                                                       value for number of data octets received.
+*                               NET_SOCK_ERR_RX_Q_EMPTY             Socket receive queue empty.
+*                               NET_SOCK_ERR_RX_Q_CLOSED            Socket receive queue closed.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Socket data receive buffers insufficient size;
+*                                                                       some, but not all, socket data deframed
+*                                                                       into receive buffers.
+*                               NET_SOCK_ERR_INVALID_FLAG           Invalid socket flags.
 *
-*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
-*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
 *
-* Return(s)   : Number of socket descriptors with available resources &/or operations, if any     (see Note #3c1A1).
+* Return(s)   : Number of positive data octets received, if NO error(s).
 *
-*               NET_SOCK_BSD_RTN_CODE_TIMEOUT,                                         on timeout (see Note #3c1B).
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,       if socket connection closed.
 *
-*               NET_SOCK_BSD_ERR_SEL,                                                  otherwise  (see Note #3c1A2a).
+*               NET_SOCK_BSD_ERR_RX,                     otherwise.
 *
-* Caller(s)   : select().
+* Caller(s)   : readv(),
+*               recvmsg(),
+*               recvmmsg(),
+*               Application.
 *
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s).
 *
-* Note(s)     : (2) NetSock_Sel() blocked until network initialization completes.
+* Note(s)     : (2) (a) The received data is copied directly from the socket's receive packet buffer(s) into
+*                       each I/O vector in turn, as if the I/O vectors formed one contiguous receive buffer :
 *
-*               (3) (a) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*                       (1) Datagram-type sockets receive one complete datagram per receive.
+*                       (2) Stream-type   sockets receive as much queued data as fits in the I/O vectors.
 *
-*                       (1) (A) "select() ... shall support" the following file descriptor types :
+*                   (b) The total size of the I/O vectors is limited to the maximum socket receive length.
 *
-*                               (1) "regular files,"                        ...
-*                               (2) "terminal and pseudo-terminal devices," ...
-*                               (3) "STREAMS-based files,"                  ...
-*                               (4) "FIFOs,"                                ...
-*                               (5) "pipes,"                                ...
-*                               (6) "sockets."
+*                   See also 'NetSock_RxDataHandler()  Note #12'.
+*********************************************************************************************************
+*/
+
+NET_SOCK_RTN_CODE  NetSock_RxDataV (NET_SOCK_ID          sock_id,
+                                    NET_SOCK_IO_VEC     *p_iov,
+                                    CPU_INT16U           iov_cnt,
+                                    NET_SOCK_API_FLAGS   flags,
+                                    NET_SOCK_ADDR       *p_addr_remote,
+                                    NET_SOCK_ADDR_LEN   *p_addr_len,
+                                    NET_ERR             *p_err)
+{
+    NET_SOCK_RTN_CODE  rtn_code = NET_SOCK_BSD_ERR_RX;
+    CPU_INT16U         data_buf_len;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+                                                                /* ---------------- VALIDATE IO VECS ------------------ */
+    if (p_iov == (NET_SOCK_IO_VEC *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+#endif
+
+    if (p_addr_remote != (NET_SOCK_ADDR *)0) {                  /* ------------- VALIDATE REMOTE ADDR BUF ------------- */
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+        if (p_addr_len == (NET_SOCK_ADDR_LEN *)0) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+           *p_err = NET_ERR_FAULT_NULL_PTR;
+            return (NET_SOCK_BSD_ERR_RX);
+        }
+        if (*p_addr_len < (NET_SOCK_ADDR_LEN)NET_SOCK_ADDR_LEN_MAX) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidAddrLenCtr);
+           *p_err = NET_SOCK_ERR_INVALID_ADDR_LEN;
+            return (NET_SOCK_BSD_ERR_RX);
+        }
+#endif
+       *p_addr_len = 0;                                         /* Cfg dflt addr len for err.                           */
+    }
+
+    data_buf_len = NetSock_IO_VecLenGet(p_iov, iov_cnt);        /* Get tot iov len (see Note #2b).                      */
+    if (data_buf_len < 1u) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullSizeCtr);
+       *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+
+
+    Net_GlobalLockAcquire((void *)&NetSock_RxDataV, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+                                                                /* -------------- VALIDATE/RX SOCK DATA --------------- */
+    rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
+                                     (void              *)0,
+                                     (NET_SOCK_IO_VEC   *)p_iov,
+                                     (CPU_INT16U         )iov_cnt,
+                                     (CPU_INT16U         )data_buf_len,
+                                     (NET_SOCK_API_FLAGS )flags,
+                                     (NET_SOCK_ADDR     *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN *)p_addr_len,
+                                     (void              *)0,
+                                     (CPU_INT08U         )0u,
+                                     (CPU_INT08U        *)0,
+                                     (NET_BUF          **)0,
+                                     (NET_ERR           *)p_err);
+
+    Net_GlobalLockRelease();
+
+exit_lock_fault:
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_TxDataV()
 *
-*                           (B) "The behavior of ... select() on ... other types of ... file descriptors
-*                                ... is unspecified."
+* Description : (1) Transmit data through a socket, gathered from an array of application data buffers :
 *
-*                       (2) Network Socket Layer supports BSD 4.x select() functionality with the following
-*                           restrictions/constraints :
+*                   (a) Validate I/O vectors
+*                   (b) Validate & transmit application data
 *
-*                           (A) ONLY supports the following file descriptor types :
-*                               (1) Sockets
+*                   See also 'NetSock_TxDataHandler()  Note #1'.
 *
 *
-*                   (b) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to transmit data.
 *
-*                       (1) (A) "The 'nfds' argument ('sock_nbr_max') specifies the range of descriptors to be
-*                                tested.  The first 'nfds' descriptors shall be checked in each set; that is,
-*                                the [following] descriptors ... in the descriptor sets shall be examined" :
+*               p_iov           Pointer to an array of I/O vectors with the application data to transmit.
 *
-*                               (1) "from zero" ...
-*                               (2) "through nfds-1."
+*               iov_cnt         Number of I/O vectors in array.
 *
-*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                               6th Printing, Section 6.3, Page 163 states that :
+*               flags           Flags to select transmit options; bit-field flags logically OR'd :
 *
-*                               (1) ... since "descriptors start at 0" ...
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
 *
-*                               (2) "the ['nfds'] argument" specifies :
-*                                   (a) "the number of descriptors," ...
-*                                   (b) "not the largest value."
+*               p_addr_remote   Pointer to destination address buffer, if available; NULL pointer, otherwise
+*                                   (see 'NetSock_TxDataTo()  Note #5').
 *
-*                       (2) "The select() function shall ... examine the file descriptor sets whose addresses
-*                            are passed in the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
-*                            'errorfds' ('p_sock_desc_err') parameters to see whether some of their descriptors
-*                            are ready for reading, are ready for writing, or have an exceptional condition
-*                            pending, respectively."
+*               addr_len        Length of  destination address buffer (in octets).
 *
-*                           (A) (1) (a) "If the 'readfds'  argument ('p_sock_desc_rd')  is not a null pointer,
-*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
-*                                        input specifies the file descriptors to be checked for being ready
-*                                        to read,  and on output indicates which file descriptors are ready
-*                                        to read."
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-*                                   (b) "A descriptor shall be considered ready for reading when a call to
-*                                        an input function ... would not block, whether or not the function
-*                                        would transfer data successfully.  (The function might return data,
-*                                        an end-of-file indication, or an error other than one indicating
-*                                        that it is blocked, and in each of these cases the descriptor shall
-*                                        be considered ready for reading.)" :
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_iov' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Argument 'iov_cnt' passed an invalid size.
 *
-*                                       (1) "If the socket is currently listening, then it shall be marked
-*                                            as readable if an incoming connection request has been received,
-*                                            and a call to the accept() function shall complete without
-*                                            blocking."
+*                                                                   ----- RETURNED BY NetSock_TxDataHandler() : ------
+*                               NET_SOCK_ERR_NONE                   Socket data successfully transmitted; check return
+*                                                                       value for number of data octets transmitted.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid data size.
+*                               NET_SOCK_ERR_INVALID_FLAG           Invalid socket flags.
+*                               NET_SOCK_ERR_TX_Q_CLOSED            Socket transmit queue closed.
 *
-*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Pages 164-165 states that "a socket is ready
-*                                       for reading if any of the following ... conditions is true" :
+*                               See 'NetSock_TxDataHandler()' for additional return error codes.
 *
-*                                       (1) "A read operation on the socket will not block and will return a
-*                                            value greater than 0 (i.e., the data that is ready to be read)."
+* Return(s)   : Number of positive data octets transmitted, if NO error(s).
 *
-*                                       (2) "The read half of the connection is closed (i.e., a TCP connection
-*                                            that has received a FIN).  A read operation ... will not block and
-*                                            will return 0 (i.e., EOF)."
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,          if socket connection closed.
 *
-*                                       (3) "The socket is a listening socket and the number of completed
-*                                            connections is nonzero.  An accept() on the listening socket
-*                                            will ... not block."
+*               NET_SOCK_BSD_ERR_TX,                        otherwise.
 *
-*                                       (4) "A socket error is pending.  A read operation on the socket will
-*                                            not block and will return an error (-1) with 'errno' set to the
-*                                            specific error condition."
+* Caller(s)   : writev(),
+*               sendmsg(),
+*               sendmmsg(),
+*               Application.
 *
-*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
-*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
-*                                               when an error occurs on a socket, it is [also] marked as both
-*                                               readable and writeable by select()".
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                                               See also Notes #3b2A2c4A & #3b2A3d.
+* Note(s)     : (2) (a) The application data is copied directly from each I/O vector in turn into the
+*                       transport layer's transmit buffer(s) :
 *
-*                               (2) (a) "If the 'writefds' argument ('p_sock_desc_wr')  is not a null pointer,
-*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
-*                                        input specifies the file descriptors to be checked for being ready
-*                                        to write, and on output indicates which file descriptors are ready
-*                                        to write."
+*                       (1) Datagram-type sockets transmit all I/O vectors as one complete datagram.
 *
-*                                   (b) "A descriptor shall be considered ready for writing when a call to
-*                                        an output function ... would not block, whether or not the function
-*                                        would transfer data successfully" :
-*
-*                                       (1) "If a non-blocking call to the connect() function has been made
-*                                            for a socket, and the connection attempt has either succeeded
-*                                            or failed leaving a pending error, the socket shall be marked
-*                                            as writable."
-*
-*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Page 165 states that "a socket is ready for
-*                                       writing if any of the following ... conditions is true" :
-*
-*                                       (1) "A write operation will not block and will return a positive value
-*                                            (e.g., the number of bytes accepted by the transport layer)."
-*
-*                                       (2) "The write half of the connection is closed."
-*
-*                                       (3) "A socket using a non-blocking connect() has completed the
-*                                            connection, or the connect() has failed."
-*
-*                                       (4) "A socket error is pending.  A write operation on the socket will
-*                                            not block and will return an error (-1) with 'errno' set to the
-*                                            specific error condition."
-*
-*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
-*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
-*                                               when an error occurs on a socket, it is [also] marked as both
-*                                               readable and writeable by select()".
-*
-*                                               See also Notes #3b2A1c4A & #3b2A3d.
-*
-*                               (3) (a) "If the 'errorfds' argument ('p_sock_desc_err') is not a null pointer,
-*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
-*                                        input specifies the file descriptors to be checked for error
-*                                        conditions pending, and on output indicates which file descriptors
-*                                        have error conditions pending."
+*                       (2) Stream-type   sockets queue the I/O vectors' data exactly as one contiguous
+*                           transmit of the same data would be queued.  Thus a protocol header & its payload
+*                           transmitted from separate I/O vectors are coalesced into the same TCP segment(s)
+*                           instead of being transmitted as separate, small segments.
 *
-*                                   (b) "A file descriptor ... shall be considered to have an exceptional
-*                                        condition pending ... as noted below" :
-*
-*                                       (1) (A) "A socket ... receive operation ... [that] would return
-*                                                out-of-band data without blocking."
-*                                           (B) "A socket ... [with] out-of-band data ... present in the
-*                                                receive queue."
+*                   (b) The total length of the I/O vectors is limited to the maximum socket transmit
+*                       length.  Datagram-type sockets reject any longer datagram (see 'NetSock_TxDataHandler()
+*                       Note #2a1B2'); stream-type sockets transmit only the leading data octets.
 *
-*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+*                   See also 'NetSock_TxDataHandler()  Note #8'.
+*********************************************************************************************************
+*/
+
+NET_SOCK_RTN_CODE  NetSock_TxDataV (NET_SOCK_ID          sock_id,
+                                    NET_SOCK_IO_VEC     *p_iov,
+                                    CPU_INT16U           iov_cnt,
+                                    NET_SOCK_API_FLAGS   flags,
+                                    NET_SOCK_ADDR       *p_addr_remote,
+                                    NET_SOCK_ADDR_LEN    addr_len,
+                                    NET_ERR             *p_err)
+{
+    NET_SOCK_RTN_CODE  rtn_code;
+    CPU_INT16U         data_len;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+                                                                /* ---------------- VALIDATE IO VECS ------------------ */
+    if (p_iov == (NET_SOCK_IO_VEC *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+#endif
+
+    data_len = NetSock_IO_VecLenGet(p_iov, iov_cnt);            /* Get tot iov len (see Note #2b).                      */
+    if (data_len < 1u) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullSizeCtr);
+       *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+                                                                /* --------------- VALIDATE/TX APP DATA --------------- */
+    rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
+                                     (void             *)0,
+                                     (NET_SOCK_IO_VEC  *)p_iov,
+                                     (CPU_INT16U        )iov_cnt,
+                                     (CPU_INT16U        )data_len,
+                                     (NET_SOCK_API_FLAGS)flags,
+                                     (NET_SOCK_ADDR    *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN )addr_len,
+                                     (NET_BUF         **)0,
+                                     (NET_ERR          *)p_err);
+
+    return (rtn_code);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetSock_RxDataZeroCopy()
 *
-*                                       (2) "If a socket has a pending error."
+* Description : (1) Receive data from a socket WITHOUT copying the data into an application buffer :
 *
-*                                       (3) "Other circumstances under which a socket may be considered to
-*                                            have an exceptional condition pending are protocol-specific
-*                                            and implementation-defined."
+*                   (a) Validate & receive socket packet buffer(s)
 *
-*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Page 165 states that "a socket has an
-*                                       exception condition pending if ... any of the following ... conditions
-*                                       is true" :
+*                   See also 'NetSock_RxDataHandler()  Note #11'.
 *
-*                                       (1) (A) "Out-of-band data for the socket" is currently available; ...
-*                                           (B) "Or the socket is still at the out-of-band mark."
 *
-*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to receive data.
 *
-*                                   (d) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                                       6th Printing, Section 6.3, Page 165 states "that when an error occurs on
-*                                       a socket, it is [also] marked as both readable and writeable by select()".
+*               p_buf           Pointer to a variable that will receive a pointer to the received network
+*                                   buffer(s), if NO error(s); NULL pointer, otherwise (see Note #2).
 *
-*                                       See also Notes #3b2A1c4A & #3b2A2c4A.
+*               flags           Flags to select receive options; bit-field flags logically OR'd :
 *
-*                           (B) (1) (a) "Upon successful completion, ... select() ... shall" :
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_RX_NO_BLOCK       Receive socket data without blocking.
 *
-*                                       (1) "modify the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
-*                                            'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err')
-*                                            arguments to indicate which file descriptors are ready for
-*                                            reading, ready for writing, or have an error condition pending,
-*                                            respectively," ...
+*               p_addr_remote   Pointer to an address buffer that will receive the socket address structure
+*                                   with the received data's remote address, if available; NULL pointer,
+*                                   otherwise.
 *
-*                                       (2) "and shall return the total number of ready descriptors in all
-*                                            the output sets."
+*               p_addr_len      Pointer to a variable to ... :
 *
-*                                            See also Note #3c1A1.
+*                                   (a) Pass the size of the address buffer pointed to by 'p_addr_remote'.
+*                                   (b) (1) Return the actual size of socket address structure with the
+*                                               received data's remote address, if NO error(s);
+*                                       (2) Return 0,                           otherwise.
 *
-*                                   (b) (1) "For each file descriptor less than nfds ('sock_nbr_max'), the
-*                                            corresponding bit shall be set on successful completion" :
+*                               Required ONLY if 'p_addr_remote' is available.
 *
-*                                           (A) "if it was set on input" ...
-*                                           (B) "and the associated condition is true for that file descriptor."
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-*                                       (2) Conversely, "for each file descriptor ... the corresponding bit
-*                                           shall be ... [clear] ... on ... completion" :
+*                               NET_ERR_FAULT_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_ADDR_LEN       Invalid socket address structure length.
 *
-*                                           (A) If it was clear on input;                                         ...
-*                                           (B) If the associated condition is NOT true for that file descriptor; ...
-*                                           (C) Or it was set on input, but any timeout occurs (see Note #3c2B).
+*                                                                   ----- RETURNED BY NetSock_RxDataHandler() : ------
+*                               NET_SOCK_ERR_NONE                   Socket data successfully received; check return
+*                                                                       value for number of data octets received.
+*                               NET_SOCK_ERR_RX_Q_EMPTY             Socket receive queue empty.
+*                               NET_SOCK_ERR_RX_Q_CLOSED            Socket receive queue closed.
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #3).
+*                               NET_SOCK_ERR_INVALID_FLAG           Invalid socket flags.
 *
-*                               (2) select() can NOT absolutely guarantee that descriptors returned as ready
-*                                   will still be ready during subsequent operations since any higher priority
-*                                   tasks or processes may asynchronously consume the descriptors' operations
-*                                   &/or resources.  This can occur since select() functionality & subsequent
-*                                   operations are NOT atomic operations protected by network, file system,
-*                                   or operating system mechanisms.
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
 *
-*                                   However, as long as no higher priority tasks or processes access any of
-*                                   the same descriptors, then a single task or process can assume that all
-*                                   descriptors returned as ready by select() will still be ready during
-*                                   subsequent operations.
+* Return(s)   : Number of positive data octets received, if NO error(s).
 *
-*                       (3) (A) "The 'timeout' parameter ('ptimeout') controls how long ... select() ... shall
-*                                take before timing out."
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,       if socket connection closed.
 *
-*                               (1) (a) "If the 'timeout' parameter ('ptimeout') is not a null pointer, it
-*                                        specifies a maximum interval to wait for the selection to complete."
+*               NET_SOCK_BSD_ERR_RX,                     otherwise.
 *
-*                                       (1) "If none of the selected descriptors are ready for the requested
-*                                            operation, ... select() ... shall block until at least one of the
-*                                            requested operations becomes ready ... or ... until the timeout
-*                                            occurs."
+* Caller(s)   : Application.
 *
-*                                       (2) "If the specified time interval expires without any requested
-*                                            operation becoming ready, the function shall return."
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                                       (3) "To effect a poll, the 'timeout' parameter ('ptimeout') should not be
-*                                            a null pointer, and should point to a zero-valued timespec structure
-*                                            ('NET_SOCK_TIMEOUT')."
+* Note(s)     : (2) (a) The received network buffer(s) are lent to the application :
 *
-*                                   (b) (1) (A) "If the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'),
-*                                                and 'errorfds' ('p_sock_desc_err') arguments are"                ...
-*                                               (1) "all null pointers"                                          ...
-*                                               (2) [or all null-valued (i.e. no file descriptors set)]          ...
-*                                           (B) "and the 'timeout' argument ('ptimeout') is not a null pointer," ...
+*                       (1) Datagram-type sockets return one complete datagram per receive.
+*                       (2) Stream-type   sockets return one received TCP segment  per receive.
 *
-*                                       (2) ... then "select() ... shall block for the time specified".
+*                   (b) The received data may span several chained network buffers; each buffer's data is
+*                       obtained via NetSock_ZeroCopyBufDataGet().
 *
-*                               (2) "If the 'timeout' parameter ('ptimeout') is a null pointer, then the call to
-*                                    ... select() shall block indefinitely until at least one descriptor meets the
-*                                    specified criteria."
+*                   (c) The application MUST release the network buffer(s) via NetSock_RxDataZeroCopyFree()
+*                       as soon as possible since lent buffers are NOT available to receive more packets.
+*                       For stream-type sockets, the TCP receive window is NOT re-opened until released.
 *
-*                                   (a) (1) Although IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION'
-*                                           states that select() may "block indefinitely until ... one of the
-*                                           requested operations becomes ready ... or until interrupted by a signal",
-*                                           it does NOT explicity specify how to handle the case where the descriptor
-*                                           arguments & the timeout parameter argument are all NULL pointers.
+*               (3) Zero-copy receive is NOT supported on secure sockets since received data MUST first be
+*                   decrypted into an application buffer.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_SOCK_RTN_CODE  NetSock_RxDataZeroCopy (NET_SOCK_ID          sock_id,
+                                           NET_BUF            **p_buf,
+                                           NET_SOCK_API_FLAGS   flags,
+                                           NET_SOCK_ADDR       *p_addr_remote,
+                                           NET_SOCK_ADDR_LEN   *p_addr_len,
+                                           NET_ERR             *p_err)
+{
+    NET_SOCK_RTN_CODE  rtn_code = NET_SOCK_BSD_ERR_RX;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+                                                                /* ---------------- VALIDATE BUF PTR ------------------ */
+    if (p_buf == (NET_BUF **)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+#endif
+
+   *p_buf = (NET_BUF *)0;                                       /* Cfg dflt buf ptr for err.                            */
+
+    if (p_addr_remote != (NET_SOCK_ADDR *)0) {                  /* ------------- VALIDATE REMOTE ADDR BUF ------------- */
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+        if (p_addr_len == (NET_SOCK_ADDR_LEN *)0) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+           *p_err = NET_ERR_FAULT_NULL_PTR;
+            return (NET_SOCK_BSD_ERR_RX);
+        }
+        if (*p_addr_len < (NET_SOCK_ADDR_LEN)NET_SOCK_ADDR_LEN_MAX) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidAddrLenCtr);
+           *p_err = NET_SOCK_ERR_INVALID_ADDR_LEN;
+            return (NET_SOCK_BSD_ERR_RX);
+        }
+#endif
+       *p_addr_len = 0;                                         /* Cfg dflt addr len for err.                           */
+    }
+
+
+    Net_GlobalLockAcquire((void *)&NetSock_RxDataZeroCopy, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+                                                                /* -------------- VALIDATE/RX SOCK DATA --------------- */
+    rtn_code = NetSock_RxDataHandler((NET_SOCK_ID        )sock_id,
+                                     (void              *)0,
+                                     (NET_SOCK_IO_VEC   *)0,
+                                     (CPU_INT16U         )0u,
+                                     (CPU_INT16U         )0u,
+                                     (NET_SOCK_API_FLAGS )flags,
+                                     (NET_SOCK_ADDR     *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN *)p_addr_len,
+                                     (void              *)0,
+                                     (CPU_INT08U         )0u,
+                                     (CPU_INT08U        *)0,
+                                     (NET_BUF          **)p_buf,
+                                     (NET_ERR           *)p_err);
+
+    Net_GlobalLockRelease();
+
+exit_lock_fault:
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetSock_RxDataZeroCopyFree()
 *
-*                                           Therefore, it seems reasonable that select() should "block indefinitely
-*                                           ... until interrupted by a signal" if the descriptor arguments & the
-*                                           timeout parameter argument are all NULL pointers.
+* Description : Release network buffer(s) received by NetSock_RxDataZeroCopy().
 *
-*                                       (2) However, since inter-process signals are NOT currently supported, it
-*                                           does NOT seem reasonable to block a task or process indefinitely (i.e.
-*                                           forever) if the descriptor arguments & the timeout parameter argument
-*                                           are all NULL pointers.  Instead, an 'invalid timeout interval' error
-*                                           should be returned.
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket that received the network buffer(s).
 *
-*                                           See also Note #3d2B.
+*               p_buf       Pointer to received network buffer(s).
 *
-*                           (B) (1) "For the select() function, the timeout period is given ... in an argument
-*                                   ('ptimeout') of type struct 'timeval' ('NET_SOCK_TIMEOUT')" ... :
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                                   (a) "in seconds" ...
-*                                   (b) "and microseconds."
+*                               NET_SOCK_ERR_NONE                   Network buffer(s) successfully released.
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_buf' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_SOCK           Invalid socket number.
 *
-*                               (2) (a) (1) "Implementations may place limitations on the maximum timeout interval
-*                                            supported" :
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
 *
-*                                           (A) "All implementations shall support a maximum timeout interval of
-*                                                at least 31 days."
+* Return(s)   : none.
 *
-*                                               (1) However, since maximum timeout interval values are dependent
-*                                                   on the specific OS implementation; a maximum timeout interval
-*                                                   can NOT be guaranteed.
+* Caller(s)   : Application.
 *
-*                                           (B) "If the 'timeout' argument ('ptimeout') specifies a timeout interval
-*                                                greater than the implementation-defined maximum value, the maximum
-*                                                value shall be used as the actual timeout value."
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                                       (2) "Implementations may also place limitations on the granularity of
-*                                            timeout intervals" :
+* Note(s)     : (1) The network buffer(s) are ALWAYS freed, even if the socket has since been closed.
 *
-*                                           (A) "If the requested 'timeout' interval requires a finer granularity
-*                                                than the implementation supports, the actual timeout interval
-*                                                shall be rounded up to the next supported value."
+*               (2) For stream-type sockets, releasing a received TCP segment re-opens the TCP connection's
+*                   receive window by the released amount.  Therefore, network buffer(s) SHOULD be released
+*                   BEFORE the socket is closed.
 *
-*                                   (b) Operating systems may have different minimum/maximum ranges & resolutions
-*                                       for timeouts while pending or waiting on an operating system resource to
-*                                       become available (see Note #3b3A1a) versus time delays for suspending a
-*                                       task or process that is NOT pending or waiting for an operating system
-*                                       resource (see Note #3b3A1b).
+*                   If the socket was closed & its handle re-used by another connection before the network
+*                   buffer(s) are released, the new connection's receive window is NOT updated.
 *
-*                   (c) (1) (A) IEEE Std 1003.1, 2004 Edition, Section 'select() : RETURN VALUE' states that :
+*                   See also 'net_tcp.c  NetTCP_RxAppDataZeroCopyFree()  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+void  NetSock_RxDataZeroCopyFree (NET_SOCK_ID   sock_id,
+                                  NET_BUF      *p_buf,
+                                  NET_ERR      *p_err)
+{
+#if (defined(NET_SOCK_TYPE_STREAM_MODULE_EN) && \
+     defined(NET_TCP_MODULE_EN))
+    NET_SOCK     *p_sock;
+    NET_CONN_ID   conn_id_transport;
+    NET_ERR       err;
+#endif
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+    if (p_buf == (NET_BUF *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+    if ((sock_id < NET_SOCK_ID_MIN) ||
+        (sock_id > (NET_SOCK_ID)NET_SOCK_ID_MAX)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidSockCtr);
+       *p_err = NET_SOCK_ERR_INVALID_SOCK;
+        return;
+    }
+
+
+    Net_GlobalLockAcquire((void *)&NetSock_RxDataZeroCopyFree, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return;
+    }
+
+#if (defined(NET_SOCK_TYPE_STREAM_MODULE_EN) && \
+     defined(NET_TCP_MODULE_EN))
+    p_sock = &NetSock_Tbl[sock_id];
+    if ((p_sock->SockType == NET_SOCK_TYPE_STREAM ) &&          /* If TCP sock, rel seg & update rx win (see Note #2).  */
+        (p_sock->Protocol == NET_SOCK_PROTOCOL_TCP) &&
+        (p_sock->ID_Conn  != NET_CONN_ID_NONE     )) {
+        conn_id_transport = NetConn_ID_TransportGet(p_sock->ID_Conn, &err);
+        if (err != NET_CONN_ERR_NONE) {
+            conn_id_transport = NET_CONN_ID_NONE;
+        }
+        if (conn_id_transport != NET_CONN_ID_NONE) {
+            NetTCP_RxAppDataZeroCopyFree((NET_TCP_CONN_ID)conn_id_transport, p_buf, &err);
+            goto exit_release;
+        }
+    }
+#endif
+
+   (void)NetBuf_FreeBufList(p_buf, (NET_CTR *)0);               /* Else free buf(s) (see Note #1).                      */
+
+#if (defined(NET_SOCK_TYPE_STREAM_MODULE_EN) && \
+     defined(NET_TCP_MODULE_EN))
+exit_release:
+#endif
+    Net_GlobalLockRelease();
+
+   *p_err = NET_SOCK_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetSock_ZeroCopyBufDataGet()
 *
-*                               (1) "Upon successful completion, ... select() ... shall return the total
-*                                    number of bits set in the bit masks."
+* Description : Get the data area of a zero-copy network buffer.
 *
-*                               (2) (a) "Otherwise, -1 shall be returned," ...
-*                                   (b) "and 'errno' shall be set to indicate the error."
-*                                       'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+* Argument(s) : p_buf       Pointer to a network buffer returned by NetSock_RxDataZeroCopy() (or to any network
+*                               buffer chained to it).
 *
-*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
-*                               6th Printing, Section 6.3, Page 161 states that BSD select() function
-*                               "returns ... 0 on timeout".
+*               p_data      Pointer to a variable that will receive a pointer to the buffer's data.
 *
-*                       (2) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*               p_data_len  Pointer to a variable that will receive the length of the buffer's data (in octets).
 *
-*                           (A) "On failure, the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
-*                                'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err') arguments
-*                                shall not be modified."
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               (1) Since 'p_sock_desc_rd', 'p_sock_desc_wr', & 'p_sock_desc_err' arguments
-*                                   are both input & output arguments; their input values, prior to use,
-*                                   MUST be copied to return their initial input values PRIOR to all other
-*                                   validation or function handling in case of any error(s).
+*                               NET_SOCK_ERR_NONE                   Buffer data successfully returned.
+*                               NET_ERR_FAULT_NULL_PTR              Argument(s) passed a NULL pointer.
 *
-*                           (B) "If the 'timeout' interval expires without the specified condition being
-*                                true for any of the specified file descriptors, the objects pointed to
-*                                by the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
-*                                'errorfds' ('p_sock_desc_err') arguments shall have all bits set to 0."
+* Return(s)   : Pointer to the next chained network buffer, if any.
 *
-*                   (d) IEEE Std 1003.1, 2004 Edition, Section 'select() : ERRORS' states that "under the
-*                       following conditions, ... select() shall fail and set 'errno' to" :
+*               Pointer to NULL,                            otherwise.
 *
-*                       (1) "[EBADF] - One or more of the file descriptor sets specified a file descriptor
-*                            that is not a valid open file descriptor."
+* Caller(s)   : Application.
 *
-*                       (2) "[EINVAL]" -
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
 *
-*                           (A) "The 'nfds' argument ('sock_nbr_max') is" :
-*                               (1) "less than 0 or" ...
-*                               (2) "greater than FD_SETSIZE."
+* Note(s)     : (1) Received data may span several chained network buffers; the application walks the
+*                   chain, scatter/gather-style, until a NULL pointer is returned :
 *
-*                               See also Note #3b1.
+*                       p_buf_next = p_buf;
+*                       while (p_buf_next != DEF_NULL) {
+*                           p_buf_next = NetSock_ZeroCopyBufDataGet(p_buf_next, &p_data, &data_len, &err);
+*                           ...
+*                       }
 *
-*                           (B) "An invalid timeout interval was specified."
+*               (2) A network buffer may return a data length of zero.
 *
-*                               See also Note #3b3.
+*               (3) The network buffer(s) MUST NOT be accessed once released.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_BUF  *NetSock_ZeroCopyBufDataGet (NET_BUF      *p_buf,
+                                      CPU_INT08U  **p_data,
+                                      CPU_INT16U   *p_data_len,
+                                      NET_ERR      *p_err)
+{
+    NET_BUF_HDR  *p_buf_hdr;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_BUF *)0);
+    }
+                                                                /* ------------------ VALIDATE PTRS ------------------- */
+    if ((p_buf      == (NET_BUF     *)0) ||
+        (p_data     == (CPU_INT08U **)0) ||
+        (p_data_len == (CPU_INT16U  *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return ((NET_BUF *)0);
+    }
+#endif
+
+    p_buf_hdr   = &p_buf->Hdr;
+   *p_data      = &p_buf->DataPtr[p_buf_hdr->DataIx];
+   *p_data_len  = (CPU_INT16U)p_buf_hdr->DataLen;
+
+   *p_err       =  NET_SOCK_ERR_NONE;
+
+    return (p_buf_hdr->NextBufPtr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   NetSock_TxDataZeroCopyBufGet()
 *
-*                           'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+* Description : Get a network buffer for the application to fill with socket transmit data in place.
 *
-*               (4) A socket events table lists requested socket or connection ID numbers/handle identifiers
-*                   & their respective socket event operations.
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to transmit data.
 *
-*                   (a) Socket event tables are terminated with NULL table entry values.
+*               p_data_len  Pointer to variable that :
 *
-*                   (b) (1) NET_SOCK_CFG_SEL_NBR_EVENTS_MAX configures socket event tables' maximum number
-*                           of socket events/operations.
+*                               (a) Passes the requested application data length (in octets); ...
+*                               (b) Returns   the granted   application data length (see Note #2).
 *
-*                       (2) This value is used to declare the size of the socket events tables.  Note that
-*                           one additional table entry is added for a terminating NULL table entry at a
-*                           maximum table index 'NET_SOCK_CFG_SEL_NBR_EVENTS_MAX' (see Note #4a).
+*               p_data      Pointer to variable that will receive a pointer to the buffer's data area.
 *
-*               (5) Since datagram-type sockets typically never wait on transmit operations, no socket
-*                   event should wait on datagram-type socket transmit operations or transmit errors.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                   See also 'NetSock_IsRdyTxDatagram()            Note #3'
-*                          & 'NetSock_SelDescHandlerErrDatagram()  Note #4'.
+*                               NET_SOCK_ERR_NONE                   Transmit buffer successfully allocated.
+*                               NET_ERR_FAULT_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_PROTOCOL       Invalid socket protocol.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid requested data length.
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #4).
+*                               NET_SOCK_ERR_FAULT                  Socket fault.
+*                               NET_BUF_ERR_NONE_AVAIL              NO available transmit buffers.
+*                               NET_ERR_TX                          Transmit error.
+*
+*                                                                   ---------- RETURNED BY NetSock_IsUsed() : ----------
+*                               NET_SOCK_ERR_INVALID_SOCK           Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED               Socket NOT currently used.
+*
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+* Return(s)   : Pointer to transmit network buffer, if NO error(s).
+*
+*               Pointer to NULL,                    otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) The application writes its data starting at the returned data pointer & then transmits
+*                   the buffer via NetSock_TxDataZeroCopy(); or releases it via NetSock_TxDataZeroCopyBufFree().
+*
+*               (2) The granted data length is limited so that the buffer is ALWAYS transmitted as a single
+*                   datagram or TCP segment :
+*
+*                   (a) Datagram-type sockets limit the length to the interface's UDP MTU.
+*                   (b) Stream-type   sockets limit the length to the TCP connection's maximum segment size
+*                                           & configured transmit window size.
+*
+*               (3) Datagram-type socket buffers are allocated on the socket's bound interface, if any; or
+*                   on the default interface, otherwise.
+*
+*               (4) Zero-copy transmit is NOT supported on secure sockets.
 *********************************************************************************************************
 */
-#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-NET_SOCK_RTN_CODE  NetSock_Sel (NET_SOCK_QTY       sock_nbr_max,
-                                NET_SOCK_DESC     *p_sock_desc_rd,
-                                NET_SOCK_DESC     *p_sock_desc_wr,
-                                NET_SOCK_DESC     *p_sock_desc_err,
-                                NET_SOCK_TIMEOUT  *p_timeout,
-                                NET_ERR           *p_err)
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_BUF  *NetSock_TxDataZeroCopyBufGet (NET_SOCK_ID    sock_id,
+                                        CPU_INT16U    *p_data_len,
+                                        CPU_INT08U   **p_data,
+                                        NET_ERR       *p_err)
 {
-    NET_SOCK_SEL_OBJ   *p_sel_obj = DEF_NULL;
-    KAL_SEM_HANDLE      task_sem;
     NET_SOCK           *p_sock;
-    NET_SOCK_ID         sock_id;
-    NET_SOCK_ID         cnt_sock_id;                            /* Used for modification purposes within for loop       */
-    NET_SOCK_QTY        sock_nbr_max_actual;
-    NET_SOCK_RTN_CODE   sock_nbr_rdy;
-    NET_SOCK_DESC       sock_desc_rtn_rd;
-    NET_SOCK_DESC       sock_desc_rtn_wr;
-    NET_SOCK_DESC       sock_desc_rtn_err;
-    CPU_BOOLEAN         sock_desc_used_rd;
-    CPU_BOOLEAN         sock_desc_used_wr;
-    CPU_BOOLEAN         sock_desc_used_err;
-    NET_SOCK_SEL_OBJ   *p_sel_obj_cur  = DEF_NULL;
-    NET_SOCK_SEL_OBJ   *p_sel_obj_next = DEF_NULL;
-    CPU_INT32U          timeout_sec;
-    CPU_INT32U          timeout_us;
-    CPU_INT32U          timeout_ms;
-    LIB_ERR             lib_err;
-    KAL_ERR             err_kal;
-    KAL_ERR             err_kal_del;
+    NET_BUF            *p_buf;
+#ifdef  NET_IP_MODULE_EN
+    NET_IF_NBR          if_nbr;
+    NET_PROTOCOL_TYPE   protocol;
+#endif
+#if (defined(NET_SOCK_TYPE_STREAM_MODULE_EN) && \
+     defined(NET_TCP_MODULE_EN))
+    NET_CONN_ID         conn_id_transport;
+#endif
     NET_ERR             err;
 
 
-
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
                                                                 /* --------------- VALIDATE RTN ERR PTR --------------- */
-    if (p_err == DEF_NULL) {
-        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_BUF *)0);
     }
-                                                                /* -------------- VALIDATE MAX SOCK DESC -------------- */
-#if (NET_SOCK_DESC_NBR_MIN_DESC > DEF_INT_16U_MIN_VAL)
-    if (sock_nbr_max < NET_SOCK_DESC_NBR_MIN_DESC) {            /* If max nbr sock desc < min, ...                      */
-       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A1).                       */
-        goto exit_lock_fault;
+                                                                /* ------------------ VALIDATE PTRS ------------------- */
+    if ((p_data_len == (CPU_INT16U  *)0) ||
+        (p_data     == (CPU_INT08U **)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return ((NET_BUF *)0);
     }
 #endif
-    if (sock_nbr_max > NET_SOCK_DESC_NBR_MAX_DESC) {            /* If max nbr sock desc > max (see Note #3b1B2a),       */
-       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A2).                       */
-        goto exit_lock_fault;
-    }
 
-                                                                /* ----------------- VALIDATE TIMEOUT ----------------- */
-    if (p_timeout != DEF_NULL) {
-        if (p_timeout->timeout_sec < 0) {
-           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
-            goto exit_lock_fault;
-        }
-        if (p_timeout->timeout_us  < 0) {
-           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
-            goto exit_lock_fault;
-        }
+
+    Net_GlobalLockAcquire((void *)&NetSock_TxDataZeroCopyBufGet, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return ((NET_BUF *)0);
     }
-#endif
 
+    p_buf = (NET_BUF *)0;
 
-                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
-    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
-    if (*p_err != NET_ERR_NONE) {
-         goto exit_lock_fault;
+   (void)NetSock_IsUsed(sock_id, p_err);                        /* ---------------- VALIDATE SOCK USED ---------------- */
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        goto exit_release;
     }
 
-#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit (see Note #2).            */
-       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
-        goto exit_err_sel;
+    p_sock = &NetSock_Tbl[sock_id];
+
+#ifdef  NET_SECURE_MODULE_EN                                    /* See Note #4.                                         */
+    if (DEF_BIT_IS_SET(p_sock->Flags, NET_SOCK_FLAG_SOCK_SECURE) == DEF_YES) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidOpCtr);
+       *p_err = NET_SOCK_ERR_INVALID_OP;
+        goto exit_release;
     }
 #endif
 
+                                                                /* ------------------- GET TX BUF --------------------- */
+    switch (p_sock->Protocol) {
+#ifdef  NET_IP_MODULE_EN
+        case NET_SOCK_PROTOCOL_UDP:
+             if_nbr = p_sock->IF_Nbr;                           /* See Note #3.                                         */
+             if (if_nbr == NET_IF_NBR_NONE) {
+                 if_nbr  = NetIF_GetDflt();
+             }
+             protocol = (p_sock->ProtocolFamily == NET_SOCK_PROTOCOL_FAMILY_IP_V6) ? NET_PROTOCOL_TYPE_UDP_V6
+                                                                                   : NET_PROTOCOL_TYPE_UDP_V4;
+             p_buf    =  NetUDP_TxAppBufGet(if_nbr, protocol, p_data_len, p_data, &err);
+             switch (err) {
+                 case NET_UDP_ERR_NONE:
+                     *p_err = NET_SOCK_ERR_NONE;
+                      break;
 
 
-                                                                /* ---- VALIDATE / CHK / CFG SOCK DESC(S) FOR RDY ----- */
-    sock_nbr_max_actual = DEF_MIN(sock_nbr_max, NET_SOCK_DESC_NBR_MAX_DESC);
-
-    if (sock_nbr_max_actual > 0) {
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_COPY(&sock_desc_rtn_rd,  p_sock_desc_rd);
-        } else {
-            NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
-        }
+                 case NET_UDP_ERR_INVALID_DATA_SIZE:
+                     *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                      break;
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_COPY(&sock_desc_rtn_wr,  p_sock_desc_wr);
-        } else {
-            NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
-        }
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_COPY(&sock_desc_rtn_err,  p_sock_desc_err);
-        } else {
-            NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
-        }
+                 case NET_BUF_ERR_NONE_AVAIL:
+                     *p_err = NET_BUF_ERR_NONE_AVAIL;
+                      break;
 
-        sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
-                                             &sock_desc_rtn_rd,
-                                             &sock_desc_rtn_wr,
-                                             &sock_desc_rtn_err,
-                                              p_err);
 
-        switch (*p_err) {
-            case NET_INIT_ERR_NOT_COMPLETED:
+                 default:
+                     *p_err = NET_ERR_TX;
+                      break;
+             }
+             break;
+
+
+#if (defined(NET_SOCK_TYPE_STREAM_MODULE_EN) && \
+     defined(NET_TCP_MODULE_EN))
+        case NET_SOCK_PROTOCOL_TCP:
+             conn_id_transport = NetConn_ID_TransportGet(p_sock->ID_Conn, &err);
+             if ((err               != NET_CONN_ERR_NONE) ||
+                 (conn_id_transport == NET_CONN_ID_NONE )) {
+                *p_err = NET_SOCK_ERR_FAULT;
+                 goto exit_release;
+             }
+
+             p_buf = NetTCP_TxConnAppBufGet((NET_TCP_CONN_ID)conn_id_transport, p_data_len, p_data, &err);
+             switch (err) {
+                 case NET_TCP_ERR_NONE:
+                     *p_err = NET_SOCK_ERR_NONE;
+                      break;
+
+
+                 case NET_TCP_ERR_INVALID_DATA_SIZE:
+                     *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                      break;
+
+
+                 case NET_TCP_ERR_NONE_AVAIL:
+                     *p_err = NET_BUF_ERR_NONE_AVAIL;
+                      break;
+
+
+                 case NET_TCP_ERR_CONN_NOT_USED:
+                 case NET_TCP_ERR_CONN_FAULT:
+                 case NET_TCP_ERR_INVALID_CONN:
+                 case NET_TCP_ERR_INVALID_CONN_STATE:
+                     *p_err = NET_SOCK_ERR_FAULT;
+                      break;
+
+
+                 default:
+                     *p_err = NET_ERR_TX;
+                      break;
+             }
+             break;
+#endif
+#endif
+
+        case NET_SOCK_PROTOCOL_NONE:
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidProtocolCtr);
+            *p_err = NET_SOCK_ERR_INVALID_PROTOCOL;
+             break;
+    }
+
+
+exit_release:
+    Net_GlobalLockRelease();
+
+   (void)&err;
+
+    return (p_buf);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetSock_TxDataZeroCopy()
+*
+* Description : (1) Transmit an application-filled network buffer through a socket WITHOUT copying :
+*
+*                   (a) Validate & transmit network buffer
+*
+*                   See also 'NetSock_TxDataHandler()  Note #7'.
+*
+*
+* Argument(s) : sock_id         Socket descriptor/handle identifier of socket to transmit data.
+*
+*               p_buf           Pointer to a variable holding a network buffer obtained by
+*                                   NetSock_TxDataZeroCopyBufGet() (see Note #2).
+*
+*               data_len        Length of application data written in the network buffer (in octets).
+*
+*               flags           Flags to select transmit options; bit-field flags logically OR'd :
+*
+*                                   NET_SOCK_FLAG_NONE              No socket flags selected.
+*                                   NET_SOCK_FLAG_TX_NO_BLOCK       Transmit socket data without blocking.
+*
+*               p_addr_remote   Pointer to destination address buffer; required for unconnected datagram
+*                                   sockets, NULL pointer otherwise.
+*
+*               addr_len        Length of  destination address buffer (in octets).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_buf' passed a NULL pointer.
+*
+*                                                                   ----- RETURNED BY NetSock_TxDataHandler() : ------
+*                               NET_SOCK_ERR_NONE                   Socket data successfully transmitted &/or
+*                                                                       prepared for transmission.
+*                               NET_SOCK_ERR_INVALID_DATA_SIZE      Invalid data size.
+*                               NET_SOCK_ERR_INVALID_OP             Invalid socket operation (see Note #3).
+*                               NET_SOCK_ERR_TX_Q_CLOSED            Socket transmit queue closed.
+*                               NET_ERR_TX                          Transitory transmit error.
+*
+* Return(s)   : Number of positive data octets transmitted, if NO error(s).
+*
+*               NET_SOCK_BSD_RTN_CODE_CONN_CLOSED,          if socket connection closed.
+*
+*               NET_SOCK_BSD_ERR_TX,                        otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) (a) If the network buffer is handed to the stack, '*p_buf' is cleared to a NULL pointer &
+*                       the application MUST NOT access the network buffer again.
+*
+*                   (b) Otherwise, the application retains the network buffer & MAY retry the transmit or
+*                       release the buffer via NetSock_TxDataZeroCopyBufFree().
+*
+*               (3) Zero-copy transmit is NOT supported on secure sockets.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_SOCK_RTN_CODE  NetSock_TxDataZeroCopy (NET_SOCK_ID          sock_id,
+                                           NET_BUF            **p_buf,
+                                           CPU_INT16U           data_len,
+                                           NET_SOCK_API_FLAGS   flags,
+                                           NET_SOCK_ADDR       *p_addr_remote,
+                                           NET_SOCK_ADDR_LEN    addr_len,
+                                           NET_ERR             *p_err)
+{
+    NET_SOCK_RTN_CODE  rtn_code;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+                                                                /* ---------------- VALIDATE BUF PTR ------------------ */
+    if ((p_buf  == (NET_BUF **)0) ||
+        (*p_buf == (NET_BUF  *)0)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return (NET_SOCK_BSD_ERR_TX);
+    }
+
+                                                                /* --------------- VALIDATE/TX APP BUF ---------------- */
+    rtn_code = NetSock_TxDataHandler((NET_SOCK_ID       )sock_id,
+                                     (void             *)0,
+                                     (NET_SOCK_IO_VEC  *)0,
+                                     (CPU_INT16U        )0u,
+                                     (CPU_INT16U        )data_len,
+                                     (NET_SOCK_API_FLAGS)flags,
+                                     (NET_SOCK_ADDR    *)p_addr_remote,
+                                     (NET_SOCK_ADDR_LEN )addr_len,
+                                     (NET_BUF         **)p_buf,
+                                     (NET_ERR          *)p_err);
+
+    return (rtn_code);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   NetSock_TxDataZeroCopyBufFree()
+*
+* Description : Release a transmit network buffer NOT handed to the stack.
+*
+* Argument(s) : p_buf       Pointer to network buffer obtained by NetSock_TxDataZeroCopyBufGet().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE                   Network buffer successfully released.
+*                               NET_ERR_FAULT_NULL_PTR              Argument 'p_buf' passed a NULL pointer.
+*
+*                                                                   ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE          Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+void  NetSock_TxDataZeroCopyBufFree (NET_BUF  *p_buf,
+                                     NET_ERR  *p_err)
+{
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == (NET_ERR *)0) {
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+    if (p_buf == (NET_BUF *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+
+    Net_GlobalLockAcquire((void *)&NetSock_TxDataZeroCopyBufFree, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        return;
+    }
+
+   (void)NetBuf_FreeBuf(p_buf, (NET_CTR *)0);
+
+    Net_GlobalLockRelease();
+
+   *p_err = NET_SOCK_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Sel()
+*
+* Description : (1) Check multiple sockets for available resources &/or operations :
+*
+*                   (a) Acquire network lock
+*                   (b) Check sockets for available resources &/or operations :
+*                       (1) Validate socket descriptors' sockets
+*                       (2) Check    sockets for available resources &/or operations        See Note #3b2
+*                       (3) Prepare  sockets for wait on appropriate socket events
+*
+*                   (c) Handle timeout :                                                    See Note #3b3
+*                       (1) Prepare timeout
+*                       (2) Handle  time delay, if any
+*
+*                   (d) Wait on socket descriptor events :
+*                       (1) Demultiplex ready socket event(s) to appropriate socket descriptor(s)
+*
+*                   (e) Release network lock
+*
+*
+* Argument(s) : sock_nbr_max        Maximum number of socket descriptors/handle identifiers in the socket
+*                                       descriptor sets (see Note #3b1).
+*
+*               p_sock_desc_rd       Pointer to a set of socket descriptors/handle identifiers to :
+*
+*                                       (a) Check for available read  operation(s) [see Note #3b2A1].
+*
+*                                       (b) (1) Return the actual socket descriptors/handle identifiers
+*                                                   ready for available read  operation(s), if NO error(s)
+*                                                   [see Note #3b2B1a1];
+*                                           (2) Return the initial, non-modified set of socket descriptors/
+*                                                   handle identifiers, on any error(s) [see Note #3c2A];
+*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
+*                                                   if any timeout expires (see Note #3c2B).
+*
+*               p_sock_desc_wr       Pointer to a set of socket descriptors/handle identifiers to :
+*
+*                                       (a) Check for available write operation(s) [see Note #3b2A2].
+*
+*                                       (b) (1) Return the actual socket descriptors/handle identifiers
+*                                                   ready for available write operation(s), if NO error(s)
+*                                                   [see Note #3b2B1a1];
+*                                           (2) Return the initial, non-modified set of socket descriptors/
+*                                                   handle identifiers, on any error(s) [see Note #3c2A];
+*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
+*                                                   if any timeout expires (see Note #3c2B).
+*
+*               p_sock_desc_err      Pointer to a set of socket descriptors/handle identifiers to :
+*
+*                                       (a) Check for any error(s) &/or exception(s) [see Note #3b2A3].
+*
+*                                       (b) (1) Return the actual socket descriptors/handle identifiers
+*                                                   flagged with any error(s) &/or exception(s), if NO
+*                                                   non-descriptor-related error(s) [see Note #3b2B1a1];
+*                                           (2) Return the initial, non-modified set of socket descriptors/
+*                                                   handle identifiers, on any error(s) [see Note #3c2A];
+*                                           (3) Return a null-valued (i.e. zero-cleared) descriptor set,
+*                                                   if any timeout expires (see Note #3c2B).
+*
+*               p_timeout           Pointer to a timeout (see Note #3b3).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket descriptors successfully checked for
+*                                                                   available resources &/or operations;
+*                                                                   check return value for the number of
+*                                                                   ready socket descriptors with available
+*                                                                   resources &/or operations.
+*
+*                               NET_SOCK_ERR_TIMEOUT            Socket descriptors NOT ready within timeout
+*                                                                   (see Note #3b3A1a2).
+*
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_SOCK_ERR_INVALID_DESC       Invalid socket descriptor/number.
+*                               NET_SOCK_ERR_INVALID_TIMEOUT    Invalid timeout.
+*
+*                                                               - RETURNED BY NetSock_SelDescHandlerRd() : --
+*                                                               - RETURNED BY NetSock_SelDescHandlerWr() : --
+*                                                               - RETURNED BY NetSock_SelDescHandlerErr() : -
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_INVALID_TYPE       Invalid socket type.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT currently used.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : ---
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : Number of socket descriptors with available resources &/or operations, if any     (see Note #3c1A1).
+*
+*               NET_SOCK_BSD_RTN_CODE_TIMEOUT,                                         on timeout (see Note #3c1B).
+*
+*               NET_SOCK_BSD_ERR_SEL,                                                  otherwise  (see Note #3c1A2a).
+*
+* Caller(s)   : select().
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (2) NetSock_Sel() blocked until network initialization completes.
+*
+*               (3) (a) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*
+*                       (1) (A) "select() ... shall support" the following file descriptor types :
+*
+*                               (1) "regular files,"                        ...
+*                               (2) "terminal and pseudo-terminal devices," ...
+*                               (3) "STREAMS-based files,"                  ...
+*                               (4) "FIFOs,"                                ...
+*                               (5) "pipes,"                                ...
+*                               (6) "sockets."
+*
+*                           (B) "The behavior of ... select() on ... other types of ... file descriptors
+*                                ... is unspecified."
+*
+*                       (2) Network Socket Layer supports BSD 4.x select() functionality with the following
+*                           restrictions/constraints :
+*
+*                           (A) ONLY supports the following file descriptor types :
+*                               (1) Sockets
+*
+*
+*                   (b) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*
+*                       (1) (A) "The 'nfds' argument ('sock_nbr_max') specifies the range of descriptors to be
+*                                tested.  The first 'nfds' descriptors shall be checked in each set; that is,
+*                                the [following] descriptors ... in the descriptor sets shall be examined" :
+*
+*                               (1) "from zero" ...
+*                               (2) "through nfds-1."
+*
+*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                               6th Printing, Section 6.3, Page 163 states that :
+*
+*                               (1) ... since "descriptors start at 0" ...
+*
+*                               (2) "the ['nfds'] argument" specifies :
+*                                   (a) "the number of descriptors," ...
+*                                   (b) "not the largest value."
+*
+*                       (2) "The select() function shall ... examine the file descriptor sets whose addresses
+*                            are passed in the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
+*                            'errorfds' ('p_sock_desc_err') parameters to see whether some of their descriptors
+*                            are ready for reading, are ready for writing, or have an exceptional condition
+*                            pending, respectively."
+*
+*                           (A) (1) (a) "If the 'readfds'  argument ('p_sock_desc_rd')  is not a null pointer,
+*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
+*                                        input specifies the file descriptors to be checked for being ready
+*                                        to read,  and on output indicates which file descriptors are ready
+*                                        to read."
+*
+*                                   (b) "A descriptor shall be considered ready for reading when a call to
+*                                        an input function ... would not block, whether or not the function
+*                                        would transfer data successfully.  (The function might return data,
+*                                        an end-of-file indication, or an error other than one indicating
+*                                        that it is blocked, and in each of these cases the descriptor shall
+*                                        be considered ready for reading.)" :
+*
+*                                       (1) "If the socket is currently listening, then it shall be marked
+*                                            as readable if an incoming connection request has been received,
+*                                            and a call to the accept() function shall complete without
+*                                            blocking."
+*
+*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Pages 164-165 states that "a socket is ready
+*                                       for reading if any of the following ... conditions is true" :
+*
+*                                       (1) "A read operation on the socket will not block and will return a
+*                                            value greater than 0 (i.e., the data that is ready to be read)."
+*
+*                                       (2) "The read half of the connection is closed (i.e., a TCP connection
+*                                            that has received a FIN).  A read operation ... will not block and
+*                                            will return 0 (i.e., EOF)."
+*
+*                                       (3) "The socket is a listening socket and the number of completed
+*                                            connections is nonzero.  An accept() on the listening socket
+*                                            will ... not block."
+*
+*                                       (4) "A socket error is pending.  A read operation on the socket will
+*                                            not block and will return an error (-1) with 'errno' set to the
+*                                            specific error condition."
+*
+*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
+*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
+*                                               when an error occurs on a socket, it is [also] marked as both
+*                                               readable and writeable by select()".
+*
+*                                               See also Notes #3b2A2c4A & #3b2A3d.
+*
+*                               (2) (a) "If the 'writefds' argument ('p_sock_desc_wr')  is not a null pointer,
+*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
+*                                        input specifies the file descriptors to be checked for being ready
+*                                        to write, and on output indicates which file descriptors are ready
+*                                        to write."
+*
+*                                   (b) "A descriptor shall be considered ready for writing when a call to
+*                                        an output function ... would not block, whether or not the function
+*                                        would transfer data successfully" :
+*
+*                                       (1) "If a non-blocking call to the connect() function has been made
+*                                            for a socket, and the connection attempt has either succeeded
+*                                            or failed leaving a pending error, the socket shall be marked
+*                                            as writable."
+*
+*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Page 165 states that "a socket is ready for
+*                                       writing if any of the following ... conditions is true" :
+*
+*                                       (1) "A write operation will not block and will return a positive value
+*                                            (e.g., the number of bytes accepted by the transport layer)."
+*
+*                                       (2) "The write half of the connection is closed."
+*
+*                                       (3) "A socket using a non-blocking connect() has completed the
+*                                            connection, or the connect() has failed."
+*
+*                                       (4) "A socket error is pending.  A write operation on the socket will
+*                                            not block and will return an error (-1) with 'errno' set to the
+*                                            specific error condition."
+*
+*                                           (A) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1,
+*                                               3rd Edition, 6th Printing, Section 6.3, Page 165 states "that
+*                                               when an error occurs on a socket, it is [also] marked as both
+*                                               readable and writeable by select()".
+*
+*                                               See also Notes #3b2A1c4A & #3b2A3d.
+*
+*                               (3) (a) "If the 'errorfds' argument ('p_sock_desc_err') is not a null pointer,
+*                                        it points to an object of type 'fd_set' ('NET_SOCK_DESC') that on
+*                                        input specifies the file descriptors to be checked for error
+*                                        conditions pending, and on output indicates which file descriptors
+*                                        have error conditions pending."
+*
+*                                   (b) "A file descriptor ... shall be considered to have an exceptional
+*                                        condition pending ... as noted below" :
+*
+*                                       (1) (A) "A socket ... receive operation ... [that] would return
+*                                                out-of-band data without blocking."
+*                                           (B) "A socket ... [with] out-of-band data ... present in the
+*                                                receive queue."
+*
+*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+*
+*                                       (2) "If a socket has a pending error."
+*
+*                                       (3) "Other circumstances under which a socket may be considered to
+*                                            have an exceptional condition pending are protocol-specific
+*                                            and implementation-defined."
+*
+*                                   (c) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Page 165 states that "a socket has an
+*                                       exception condition pending if ... any of the following ... conditions
+*                                       is true" :
+*
+*                                       (1) (A) "Out-of-band data for the socket" is currently available; ...
+*                                           (B) "Or the socket is still at the out-of-band mark."
+*
+*                                           Out-of-band data NOT supported (see 'net_tcp.h  Note #1b').
+*
+*                                   (d) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                                       6th Printing, Section 6.3, Page 165 states "that when an error occurs on
+*                                       a socket, it is [also] marked as both readable and writeable by select()".
+*
+*                                       See also Notes #3b2A1c4A & #3b2A2c4A.
+*
+*                           (B) (1) (a) "Upon successful completion, ... select() ... shall" :
+*
+*                                       (1) "modify the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
+*                                            'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err')
+*                                            arguments to indicate which file descriptors are ready for
+*                                            reading, ready for writing, or have an error condition pending,
+*                                            respectively," ...
+*
+*                                       (2) "and shall return the total number of ready descriptors in all
+*                                            the output sets."
+*
+*                                            See also Note #3c1A1.
+*
+*                                   (b) (1) "For each file descriptor less than nfds ('sock_nbr_max'), the
+*                                            corresponding bit shall be set on successful completion" :
+*
+*                                           (A) "if it was set on input" ...
+*                                           (B) "and the associated condition is true for that file descriptor."
+*
+*                                       (2) Conversely, "for each file descriptor ... the corresponding bit
+*                                           shall be ... [clear] ... on ... completion" :
+*
+*                                           (A) If it was clear on input;                                         ...
+*                                           (B) If the associated condition is NOT true for that file descriptor; ...
+*                                           (C) Or it was set on input, but any timeout occurs (see Note #3c2B).
+*
+*                               (2) select() can NOT absolutely guarantee that descriptors returned as ready
+*                                   will still be ready during subsequent operations since any higher priority
+*                                   tasks or processes may asynchronously consume the descriptors' operations
+*                                   &/or resources.  This can occur since select() functionality & subsequent
+*                                   operations are NOT atomic operations protected by network, file system,
+*                                   or operating system mechanisms.
+*
+*                                   However, as long as no higher priority tasks or processes access any of
+*                                   the same descriptors, then a single task or process can assume that all
+*                                   descriptors returned as ready by select() will still be ready during
+*                                   subsequent operations.
+*
+*                       (3) (A) "The 'timeout' parameter ('ptimeout') controls how long ... select() ... shall
+*                                take before timing out."
+*
+*                               (1) (a) "If the 'timeout' parameter ('ptimeout') is not a null pointer, it
+*                                        specifies a maximum interval to wait for the selection to complete."
+*
+*                                       (1) "If none of the selected descriptors are ready for the requested
+*                                            operation, ... select() ... shall block until at least one of the
+*                                            requested operations becomes ready ... or ... until the timeout
+*                                            occurs."
+*
+*                                       (2) "If the specified time interval expires without any requested
+*                                            operation becoming ready, the function shall return."
+*
+*                                       (3) "To effect a poll, the 'timeout' parameter ('ptimeout') should not be
+*                                            a null pointer, and should point to a zero-valued timespec structure
+*                                            ('NET_SOCK_TIMEOUT')."
+*
+*                                   (b) (1) (A) "If the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'),
+*                                                and 'errorfds' ('p_sock_desc_err') arguments are"                ...
+*                                               (1) "all null pointers"                                          ...
+*                                               (2) [or all null-valued (i.e. no file descriptors set)]          ...
+*                                           (B) "and the 'timeout' argument ('ptimeout') is not a null pointer," ...
+*
+*                                       (2) ... then "select() ... shall block for the time specified".
+*
+*                               (2) "If the 'timeout' parameter ('ptimeout') is a null pointer, then the call to
+*                                    ... select() shall block indefinitely until at least one descriptor meets the
+*                                    specified criteria."
+*
+*                                   (a) (1) Although IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION'
+*                                           states that select() may "block indefinitely until ... one of the
+*                                           requested operations becomes ready ... or until interrupted by a signal",
+*                                           it does NOT explicity specify how to handle the case where the descriptor
+*                                           arguments & the timeout parameter argument are all NULL pointers.
+*
+*                                           Therefore, it seems reasonable that select() should "block indefinitely
+*                                           ... until interrupted by a signal" if the descriptor arguments & the
+*                                           timeout parameter argument are all NULL pointers.
+*
+*                                       (2) However, since inter-process signals are NOT currently supported, it
+*                                           does NOT seem reasonable to block a task or process indefinitely (i.e.
+*                                           forever) if the descriptor arguments & the timeout parameter argument
+*                                           are all NULL pointers.  Instead, an 'invalid timeout interval' error
+*                                           should be returned.
+*
+*                                           See also Note #3d2B.
+*
+*                           (B) (1) "For the select() function, the timeout period is given ... in an argument
+*                                   ('ptimeout') of type struct 'timeval' ('NET_SOCK_TIMEOUT')" ... :
+*
+*                                   (a) "in seconds" ...
+*                                   (b) "and microseconds."
+*
+*                               (2) (a) (1) "Implementations may place limitations on the maximum timeout interval
+*                                            supported" :
+*
+*                                           (A) "All implementations shall support a maximum timeout interval of
+*                                                at least 31 days."
+*
+*                                               (1) However, since maximum timeout interval values are dependent
+*                                                   on the specific OS implementation; a maximum timeout interval
+*                                                   can NOT be guaranteed.
+*
+*                                           (B) "If the 'timeout' argument ('ptimeout') specifies a timeout interval
+*                                                greater than the implementation-defined maximum value, the maximum
+*                                                value shall be used as the actual timeout value."
+*
+*                                       (2) "Implementations may also place limitations on the granularity of
+*                                            timeout intervals" :
+*
+*                                           (A) "If the requested 'timeout' interval requires a finer granularity
+*                                                than the implementation supports, the actual timeout interval
+*                                                shall be rounded up to the next supported value."
+*
+*                                   (b) Operating systems may have different minimum/maximum ranges & resolutions
+*                                       for timeouts while pending or waiting on an operating system resource to
+*                                       become available (see Note #3b3A1a) versus time delays for suspending a
+*                                       task or process that is NOT pending or waiting for an operating system
+*                                       resource (see Note #3b3A1b).
+*
+*                   (c) (1) (A) IEEE Std 1003.1, 2004 Edition, Section 'select() : RETURN VALUE' states that :
+*
+*                               (1) "Upon successful completion, ... select() ... shall return the total
+*                                    number of bits set in the bit masks."
+*
+*                               (2) (a) "Otherwise, -1 shall be returned," ...
+*                                   (b) "and 'errno' shall be set to indicate the error."
+*                                       'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+*
+*                           (B) Stevens/Fenner/Rudoff, UNIX Network Programming, Volume 1, 3rd Edition,
+*                               6th Printing, Section 6.3, Page 161 states that BSD select() function
+*                               "returns ... 0 on timeout".
+*
+*                       (2) IEEE Std 1003.1, 2004 Edition, Section 'select() : DESCRIPTION' states that :
+*
+*                           (A) "On failure, the objects pointed to by the 'readfds' ('p_sock_desc_rd'),
+*                                'writefds' ('p_sock_desc_wr'), and 'errorfds' ('p_sock_desc_err') arguments
+*                                shall not be modified."
+*
+*                               (1) Since 'p_sock_desc_rd', 'p_sock_desc_wr', & 'p_sock_desc_err' arguments
+*                                   are both input & output arguments; their input values, prior to use,
+*                                   MUST be copied to return their initial input values PRIOR to all other
+*                                   validation or function handling in case of any error(s).
+*
+*                           (B) "If the 'timeout' interval expires without the specified condition being
+*                                true for any of the specified file descriptors, the objects pointed to
+*                                by the 'readfds' ('p_sock_desc_rd'), 'writefds' ('p_sock_desc_wr'), and
+*                                'errorfds' ('p_sock_desc_err') arguments shall have all bits set to 0."
+*
+*                   (d) IEEE Std 1003.1, 2004 Edition, Section 'select() : ERRORS' states that "under the
+*                       following conditions, ... select() shall fail and set 'errno' to" :
+*
+*                       (1) "[EBADF] - One or more of the file descriptor sets specified a file descriptor
+*                            that is not a valid open file descriptor."
+*
+*                       (2) "[EINVAL]" -
+*
+*                           (A) "The 'nfds' argument ('sock_nbr_max') is" :
+*                               (1) "less than 0 or" ...
+*                               (2) "greater than FD_SETSIZE."
+*
+*                               See also Note #3b1.
+*
+*                           (B) "An invalid timeout interval was specified."
+*
+*                               See also Note #3b3.
+*
+*                           'errno' NOT currently supported (see 'net_bsd.h  Note #1b').
+*
+*               (4) A socket events table lists requested socket or connection ID numbers/handle identifiers
+*                   & their respective socket event operations.
+*
+*                   (a) Socket event tables are terminated with NULL table entry values.
+*
+*                   (b) (1) NET_SOCK_CFG_SEL_NBR_EVENTS_MAX configures socket event tables' maximum number
+*                           of socket events/operations.
+*
+*                       (2) This value is used to declare the size of the socket events tables.  Note that
+*                           one additional table entry is added for a terminating NULL table entry at a
+*                           maximum table index 'NET_SOCK_CFG_SEL_NBR_EVENTS_MAX' (see Note #4a).
+*
+*               (5) Since datagram-type sockets typically never wait on transmit operations, no socket
+*                   event should wait on datagram-type socket transmit operations or transmit errors.
+*
+*                   See also 'NetSock_IsRdyTxDatagram()            Note #3'
+*                          & 'NetSock_SelDescHandlerErrDatagram()  Note #4'.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+NET_SOCK_RTN_CODE  NetSock_Sel (NET_SOCK_QTY       sock_nbr_max,
+                                NET_SOCK_DESC     *p_sock_desc_rd,
+                                NET_SOCK_DESC     *p_sock_desc_wr,
+                                NET_SOCK_DESC     *p_sock_desc_err,
+                                NET_SOCK_TIMEOUT  *p_timeout,
+                                NET_ERR           *p_err)
+{
+    NET_SOCK_SEL_OBJ   *p_sel_obj = DEF_NULL;
+    KAL_SEM_HANDLE      task_sem;
+    NET_SOCK           *p_sock;
+    NET_SOCK_ID         sock_id;
+    NET_SOCK_ID         cnt_sock_id;                            /* Used for modification purposes within for loop       */
+    NET_SOCK_QTY        sock_nbr_max_actual;
+    NET_SOCK_RTN_CODE   sock_nbr_rdy;
+    NET_SOCK_DESC       sock_desc_rtn_rd;
+    NET_SOCK_DESC       sock_desc_rtn_wr;
+    NET_SOCK_DESC       sock_desc_rtn_err;
+    CPU_BOOLEAN         sock_desc_used_rd;
+    CPU_BOOLEAN         sock_desc_used_wr;
+    CPU_BOOLEAN         sock_desc_used_err;
+    NET_SOCK_SEL_OBJ   *p_sel_obj_cur  = DEF_NULL;
+    NET_SOCK_SEL_OBJ   *p_sel_obj_next = DEF_NULL;
+    CPU_INT32U          timeout_sec;
+    CPU_INT32U          timeout_us;
+    CPU_INT32U          timeout_ms;
+    LIB_ERR             lib_err;
+    KAL_ERR             err_kal;
+    KAL_ERR             err_kal_del;
+    NET_ERR             err;
+
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+                                                                /* -------------- VALIDATE MAX SOCK DESC -------------- */
+#if (NET_SOCK_DESC_NBR_MIN_DESC > DEF_INT_16U_MIN_VAL)
+    if (sock_nbr_max < NET_SOCK_DESC_NBR_MIN_DESC) {            /* If max nbr sock desc < min, ...                      */
+       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A1).                       */
+        goto exit_lock_fault;
+    }
+#endif
+    if (sock_nbr_max > NET_SOCK_DESC_NBR_MAX_DESC) {            /* If max nbr sock desc > max (see Note #3b1B2a),       */
+       *p_err =  NET_SOCK_ERR_INVALID_DESC;                     /* ... rtn err (see Note #3d2A2).                       */
+        goto exit_lock_fault;
+    }
+
+                                                                /* ----------------- VALIDATE TIMEOUT ----------------- */
+    if (p_timeout != DEF_NULL) {
+        if (p_timeout->timeout_sec < 0) {
+           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
+            goto exit_lock_fault;
+        }
+        if (p_timeout->timeout_us  < 0) {
+           *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
+            goto exit_lock_fault;
+        }
+    }
+#endif
+
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit (see Note #2).            */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_err_sel;
+    }
+#endif
+
+
+
+                                                                /* ---- VALIDATE / CHK / CFG SOCK DESC(S) FOR RDY ----- */
+    sock_nbr_max_actual = DEF_MIN(sock_nbr_max, NET_SOCK_DESC_NBR_MAX_DESC);
+
+    if (sock_nbr_max_actual > 0) {
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_COPY(&sock_desc_rtn_rd,  p_sock_desc_rd);
+        } else {
+            NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_COPY(&sock_desc_rtn_wr,  p_sock_desc_wr);
+        } else {
+            NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_COPY(&sock_desc_rtn_err,  p_sock_desc_err);
+        } else {
+            NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+        }
+
+        sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
+                                             &sock_desc_rtn_rd,
+                                             &sock_desc_rtn_wr,
+                                             &sock_desc_rtn_err,
+                                              p_err);
+
+        switch (*p_err) {
+            case NET_INIT_ERR_NOT_COMPLETED:
             case NET_SOCK_ERR_INVALID_TYPE:
             case NET_SOCK_ERR_INVALID_SOCK:
             case NET_SOCK_ERR_NOT_USED:
@@ -6315,421 +7379,1006 @@ NET_SOCK_RTN_CODE  NetSock_Sel (NET_SOCK_QTY       sock_nbr_max,
                  break;
 
 
-            default:
-                 break;
-        }
+            default:
+                 break;
+        }
+    } else {
+        sock_nbr_rdy = 0;
+    }
+
+    if (sock_nbr_rdy != 0) {                                    /* If any     sock desc's rdy,                  ..      */
+                                                                /* .. rtn rdy sock desc's (see Note #3b2B1a1) & ..      */
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_COPY(p_sock_desc_rd,  &sock_desc_rtn_rd );
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
+        }
+
+       *p_err =   NET_SOCK_ERR_NONE;
+        goto exit_release;
+    }
+
+
+                                                                /* ---------- CFG TIMEOUT / HANDLE TIME DLY ----------- */
+    if (p_timeout != DEF_NULL) {                                /* If avail, cfg timeout vals    (see Note #3b3A1),     */
+        timeout_sec = (CPU_INT32U)p_timeout->timeout_sec;
+        timeout_us  = (CPU_INT32U)p_timeout->timeout_us;
+    } else {                                                    /* .. else  cfg timeout to block (see Note #3b3A2).     */
+        timeout_sec = NET_TMR_TIME_INFINITE;
+        timeout_us  = NET_TMR_TIME_INFINITE;
+    }
+
+
+    if ((timeout_sec == 0) && (timeout_us == 0)) {              /* If timeout = 0, handle as non-blocking poll ..       */
+                                                                /* .. timeout (see Note #3b3A1a3).                      */
+
+                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
+                                                                /* Clr because no sock is ready at this point.          */
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_rd );
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_wr );
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_err);
+        }
+
+       *p_err = NET_SOCK_ERR_TIMEOUT;
+        goto exit_err_timeout;
+    }
+
+
+    if (sock_nbr_max < 1) {                                     /* If NO sock events cfg'd to wait on ...               */
+
+        Net_GlobalLockRelease();
+        if (p_timeout == DEF_NULL) {                            /* ... & NO timeout req'd,            ...               */
+           *p_err = NET_SOCK_ERR_INVALID_TIMEOUT;               /* ... rtn err (see Note #3b3A2a2).                     */
+            sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+            goto exit;
+        }
+
+        Net_TimeDly(timeout_sec, timeout_us, &err);             /* Else dly for timeout (see Note #3b3A1b2).            */
+        switch (err) {
+            case NET_ERR_NONE:
+            case NET_ERR_TIME_DLY_MAX:
+                 break;
+
+            case NET_ERR_TIME_DLY_FAULT:
+            case NET_ERR_INVALID_TIME:
+            default:
+                *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
+                 sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+                 goto exit;
+        }
+                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
+        if (p_sock_desc_rd != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_rd );
+        }
+
+        if (p_sock_desc_wr != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_wr );
+        }
+
+        if (p_sock_desc_err != DEF_NULL) {
+            NET_SOCK_DESC_INIT(p_sock_desc_err);
+        }
+
+       *p_err = NET_SOCK_ERR_TIMEOUT;
+        sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+        goto exit;
+    }
+
+
+
+    task_sem  =  KAL_SemCreate((const  CPU_CHAR  *)"Net Sock Sel Task",
+                                                    DEF_NULL,
+                                                   &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_MEM_ALLOC:
+             *p_err = NET_ERR_FAULT_MEM_ALLOC;
+              goto exit_err_sel;
+
+        case KAL_ERR_ISR:
+        case KAL_ERR_INVALID_ARG:
+        case KAL_ERR_CREATE:
+        default:
+           *p_err = NET_SOCK_ERR_SEL_SIGNAL_FAULT;
+            goto exit_err_sel;
+
+    }
+
+
+    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
+         p_sock = &NetSock_Tbl[sock_id];
+                                                                /* Null argument checks - Set for Read/Write or Error   */
+         if (p_sock_desc_rd != DEF_NULL) {
+             sock_desc_used_rd = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_rd);
+         } else {
+             sock_desc_used_rd = DEF_NO;
+         }
+
+         if (p_sock_desc_wr != DEF_NULL) {
+             sock_desc_used_wr = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_wr);
+         } else {
+             sock_desc_used_wr = DEF_NO;
+         }
+
+         if (p_sock_desc_err != DEF_NULL) {
+             sock_desc_used_err = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_err);
+         } else {
+             sock_desc_used_err = DEF_NO;
+         }
+
+
+         if ((sock_desc_used_rd  == DEF_YES) ||
+             (sock_desc_used_wr  == DEF_YES) ||
+             (sock_desc_used_err == DEF_YES)) {
+
+             p_sel_obj = (NET_SOCK_SEL_OBJ *)Mem_DynPoolBlkGet(&NetSock_SelObjPool, &lib_err);
+             if (p_sel_obj == DEF_NULL) {
+                cnt_sock_id = sock_id - 1;
+
+                while (cnt_sock_id >= 0) {
+                    NET_SOCK_SEL_OBJ  *p_sel_obj_to_free;
+
+
+                    sock_desc_used_rd  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_rd);
+                    sock_desc_used_wr  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_wr);
+                    sock_desc_used_err = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_err);
+
+                    if ((sock_desc_used_rd  == DEF_YES) ||
+                        (sock_desc_used_wr  == DEF_YES) ||
+                        (sock_desc_used_err == DEF_YES)) {
+
+                        p_sock                = &NetSock_Tbl[cnt_sock_id];
+                        p_sel_obj_to_free     =  p_sock->SelObjTailPtr;
+                        p_sock->SelObjTailPtr =  p_sel_obj_to_free->ObjPrevPtr;
+
+                        Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
+                    }
+
+                    cnt_sock_id--;
+                }
+
+                 KAL_SemDel(task_sem, &err_kal_del);
+                *p_err = NET_ERR_FAULT_MEM_ALLOC;
+                 goto exit_err_sel;
+             }
+
+             p_sel_obj->SockSelPendingFlags = NET_SOCK_SEL_EVENT_FLAG_NONE;
+
+             if (sock_desc_used_rd == DEF_YES) {
+                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_RD;
+             }
+
+             if (sock_desc_used_wr == DEF_YES) {
+                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_WR;
+             }
+
+             if (sock_desc_used_err == DEF_YES) {
+                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_ERR;
+             }
+
+             p_sel_obj->SockSelTaskSignalObj = task_sem;
+             p_sel_obj->ObjPrevPtr           = p_sock->SelObjTailPtr;
+             p_sock->SelObjTailPtr           = p_sel_obj;
+         }
+    }
+
+
+    timeout_ms = NetUtil_TimeSec_uS_To_ms(timeout_sec, timeout_us);
+    if (timeout_ms == NET_TMR_TIME_INFINITE) {
+        timeout_ms =  KAL_TIMEOUT_INFINITE;
+    }
+
+                                                                /* ------ WAIT ON MULTIPLE SOCK DESC'S / EVENTS ------- */
+    Net_GlobalLockRelease();
+
+    KAL_SemPend(task_sem, KAL_OPT_PEND_NONE, timeout_ms, &err_kal);
+    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
+    if (*p_err != NET_ERR_NONE) {
+        *p_err  = err;                                          /* Rtn err from Net_GlobalLockAcquire().                */
+         goto exit_lock_fault;
+    }
+
+
+    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
+         p_sock = &NetSock_Tbl[sock_id];
+
+         if (p_sock->SelObjTailPtr != DEF_NULL) {               /* Remove p_sel_obj from Socket Select objects list     */
+
+             p_sel_obj_cur  = p_sock->SelObjTailPtr;
+             p_sel_obj_next = DEF_NULL;
+
+             while (p_sel_obj_cur != DEF_NULL) {
+                 NET_SOCK_SEL_OBJ  *p_sel_obj_prev = p_sel_obj_cur->ObjPrevPtr;
+
+
+                 if (p_sel_obj_cur->SockSelTaskSignalObj.SemObjPtr == task_sem.SemObjPtr) {
+                     NET_SOCK_SEL_OBJ   *p_sel_obj_to_free  = DEF_NULL;
+
+
+                     if (p_sock->SelObjTailPtr == p_sel_obj_cur) {
+                         p_sock->SelObjTailPtr  = p_sel_obj_prev;
+
+                     } else if (p_sel_obj_next != DEF_NULL) {
+                         p_sel_obj_next->ObjPrevPtr = p_sel_obj_prev;
+                     } else {
+                                                                /* Empty Else Statement                                 */
+                     }
+
+                     p_sel_obj_to_free = p_sel_obj_cur;
+                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
+
+                     Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
+
+                 } else {
+                     p_sel_obj_next = p_sel_obj_cur;
+                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
+                 }
+             }
+         }
+    }
+
+
+    KAL_SemDel(task_sem, &err_kal_del);
+   (void)&err_kal_del;
+
+
+
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+        case KAL_ERR_TIMEOUT:
+             if (p_sock_desc_rd != DEF_NULL) {
+                 NET_SOCK_DESC_INIT(p_sock_desc_rd );
+             }
+
+             if (p_sock_desc_wr != DEF_NULL) {
+                 NET_SOCK_DESC_INIT(p_sock_desc_wr );
+             }
+
+             if (p_sock_desc_err != DEF_NULL) {
+                 NET_SOCK_DESC_INIT(p_sock_desc_err);
+             }
+            *p_err = NET_SOCK_ERR_TIMEOUT;
+             goto exit_err_timeout;
+
+        case KAL_ERR_WOULD_BLOCK:
+        case KAL_ERR_ISR:
+        case KAL_ERR_ABORT:
+        case KAL_ERR_OS:
+        default:
+             goto exit_err_sel;
+    }
+
+
+
+    if (p_sock_desc_rd != DEF_NULL) {
+        NET_SOCK_DESC_COPY(&sock_desc_rtn_rd, p_sock_desc_rd);
     } else {
-        sock_nbr_rdy = 0;
+        NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
     }
 
-    if (sock_nbr_rdy != 0) {                                    /* If any     sock desc's rdy,                  ..      */
-                                                                /* .. rtn rdy sock desc's (see Note #3b2B1a1) & ..      */
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_COPY(p_sock_desc_rd,  &sock_desc_rtn_rd );
-        }
+    if (p_sock_desc_wr != DEF_NULL) {
+        NET_SOCK_DESC_COPY(&sock_desc_rtn_wr, p_sock_desc_wr);
+    } else {
+        NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+    }
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
-        }
+    if (p_sock_desc_err != DEF_NULL) {
+        NET_SOCK_DESC_COPY(&sock_desc_rtn_err, p_sock_desc_err);
+    } else {
+        NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+    }
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
-        }
 
-       *p_err =   NET_SOCK_ERR_NONE;
-        goto exit_release;
+    sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
+                                         &sock_desc_rtn_rd,
+                                         &sock_desc_rtn_wr,
+                                         &sock_desc_rtn_err,
+                                          p_err);
+    if (p_sock_desc_rd != DEF_NULL) {
+        NET_SOCK_DESC_COPY(p_sock_desc_rd, &sock_desc_rtn_rd);
     }
 
+    if (p_sock_desc_wr != DEF_NULL) {
+        NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
+    }
 
-                                                                /* ---------- CFG TIMEOUT / HANDLE TIME DLY ----------- */
-    if (p_timeout != DEF_NULL) {                                /* If avail, cfg timeout vals    (see Note #3b3A1),     */
-        timeout_sec = (CPU_INT32U)p_timeout->timeout_sec;
-        timeout_us  = (CPU_INT32U)p_timeout->timeout_us;
-    } else {                                                    /* .. else  cfg timeout to block (see Note #3b3A2).     */
-        timeout_sec = NET_TMR_TIME_INFINITE;
-        timeout_us  = NET_TMR_TIME_INFINITE;
+    if (p_sock_desc_err != DEF_NULL) {
+        NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
     }
 
+   *p_err = NET_SOCK_ERR_NONE;
 
-    if ((timeout_sec == 0) && (timeout_us == 0)) {              /* If timeout = 0, handle as non-blocking poll ..       */
-                                                                /* .. timeout (see Note #3b3A1a3).                      */
+    goto exit_release;
 
-                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
-                                                                /* Clr because no sock is ready at this point.          */
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_rd );
-        }
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_wr );
-        }
+exit_lock_fault:
+    return (NET_SOCK_BSD_ERR_SEL);
+
+exit_err_timeout:
+    sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+    goto exit_release;
+
+exit_err_sel:
+    sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (sock_nbr_rdy);                                       /* Rtn nbr rdy sock desc's (see Note #3c1A1).           */
+}
+#endif
+
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_SelAbort()
+*
+* Description : Abort (unblock) all tasks that are pending on a particular socket using the select.
+*
+* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to abort the select.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                                 NET_SOCK_ERR_NONE              No error
+*
+*                                 NET_SOCK_ERR_INVALID_ARG       Invalid socket ID
+*                                 NET_SOCK_ERR_NONE_AVAIL        No task pending on the socket.
+*                                 NET_SOCK_ERR_INVALID_FLAG      No 'select' pend flag is set.
+*                                 NET_SOCK_ERR_SEL_SIGNAL_FAULT  Internal error.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : None.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
+void  NetSock_SelAbort (NET_SOCK_ID   sock_id,
+                        NET_ERR      *p_err)
+{
+    NET_SOCK           *p_sock;
+    NET_SOCK_SEL_OBJ   *p_sel_obj;
+    CPU_BOOLEAN         post_success;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
+    }
+#endif
+
+    p_sock = NetSock_GetObj(sock_id);
+    if (p_sock == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_INVALID_ARG;
+        goto exit;
+    }
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_err);
-        }
+    p_sel_obj = p_sock->SelObjTailPtr;
+    if (p_sel_obj == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_NONE_AVAIL;
+        goto exit;
+    }
 
-       *p_err = NET_SOCK_ERR_TIMEOUT;
-        goto exit_err_timeout;
+    if (p_sel_obj->SockSelPendingFlags == NET_SOCK_SEL_EVENT_FLAG_NONE) {
+       *p_err = NET_SOCK_ERR_INVALID_FLAG;
+        goto exit;
     }
 
+    post_success = NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_SEL_ABORT);
 
-    if (sock_nbr_max < 1) {                                     /* If NO sock events cfg'd to wait on ...               */
+   *p_err        = (post_success == DEF_OK) ?
+                   (NET_SOCK_ERR_NONE)      :
+                   (NET_SOCK_ERR_SEL_SIGNAL_FAULT);
 
-        Net_GlobalLockRelease();
-        if (p_timeout == DEF_NULL) {                            /* ... & NO timeout req'd,            ...               */
-           *p_err = NET_SOCK_ERR_INVALID_TIMEOUT;               /* ... rtn err (see Note #3b3A2a2).                     */
-            sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
-            goto exit;
-        }
+exit:
+    return;
+}
+#endif
 
-        Net_TimeDly(timeout_sec, timeout_us, &err);             /* Else dly for timeout (see Note #3b3A1b2).            */
-        switch (err) {
-            case NET_ERR_NONE:
-            case NET_ERR_TIME_DLY_MAX:
-                 break;
 
-            case NET_ERR_TIME_DLY_FAULT:
-            case NET_ERR_INVALID_TIME:
-            default:
-                *p_err =  NET_SOCK_ERR_INVALID_TIMEOUT;
-                 sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
-                 goto exit;
-        }
-                                                                /* Zero-clr rtn sock desc's (see Note #3c2B).           */
-        if (p_sock_desc_rd != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_rd );
-        }
+/*
+*********************************************************************************************************
+*                                       NetSock_EventSetCreate()
+*
+* Description : Create a socket event set.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket event set successfully created.
+*                               NET_SOCK_ERR_SEL_SIGNAL_FAULT   Event set signal creation failed.
+*                               NET_ERR_FAULT_MEM_ALLOC         Event set allocation failed.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*
+*                                                               - RETURNED BY Net_GlobalLockAcquire() : -
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : Pointer to the socket event set, if NO error(s).
+*
+*               Pointer to NULL,                 otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) A socket event set is a persistent, epoll-like alternative to NetSock_Sel() :
+*
+*                   (a) Sockets are registered once with NetSock_EventSetCtl() instead of being passed in
+*                       socket descriptor sets on each call.
+*
+*                   (b) NetSock_EventSetWait() returns only the ready sockets & only re-checks the sockets
+*                       signaled since the previous wait, instead of checking every socket descriptor.
+*
+*                   See also 'net_sock.h  NETWORK SOCKET EVENT SET DATA TYPES  Note #1'.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+NET_SOCK_EVENT_SET  *NetSock_EventSetCreate (NET_ERR  *p_err)
+{
+    NET_SOCK_EVENT_SET  *p_set = DEF_NULL;
+    LIB_ERR              err_lib;
+    KAL_ERR              err_kal;
 
-        if (p_sock_desc_wr != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_wr );
-        }
 
-        if (p_sock_desc_err != DEF_NULL) {
-            NET_SOCK_DESC_INIT(p_sock_desc_err);
-        }
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+#endif
 
-       *p_err = NET_SOCK_ERR_TIMEOUT;
-        sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
-        goto exit;
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_EventSetCreate, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit;
     }
 
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_release;
+    }
+#endif
 
+                                                                /* ------------------ ALLOC EVENT SET ----------------- */
+    p_set = (NET_SOCK_EVENT_SET *)Mem_DynPoolBlkGet(&NetSock_EventSetPool, &err_lib);
+    if (err_lib != LIB_MEM_ERR_NONE) {
+        p_set = DEF_NULL;
+       *p_err = NET_ERR_FAULT_MEM_ALLOC;
+        goto exit_release;
+    }
 
-    task_sem  =  KAL_SemCreate((const  CPU_CHAR  *)"Net Sock Sel Task",
-                                                    DEF_NULL,
-                                                   &err_kal);
+    p_set->SignalObj = KAL_SemCreate((const  CPU_CHAR *)"Net Sock Event Set",
+                                                         DEF_NULL,
+                                                        &err_kal);
     switch (err_kal) {
         case KAL_ERR_NONE:
              break;
 
         case KAL_ERR_MEM_ALLOC:
-             *p_err = NET_ERR_FAULT_MEM_ALLOC;
-              goto exit_err_sel;
+            *p_err = NET_ERR_FAULT_MEM_ALLOC;
+             goto exit_free;
 
         case KAL_ERR_ISR:
         case KAL_ERR_INVALID_ARG:
         case KAL_ERR_CREATE:
         default:
-           *p_err = NET_SOCK_ERR_SEL_SIGNAL_FAULT;
-            goto exit_err_sel;
-
+            *p_err = NET_SOCK_ERR_SEL_SIGNAL_FAULT;
+             goto exit_free;
     }
 
+    p_set->WaitPending = DEF_NO;
+    p_set->RegCnt      = 0u;
+    p_set->RdyCnt      = 0u;
+    p_set->RdyHeadPtr  = DEF_NULL;
+    p_set->RdyTailPtr  = DEF_NULL;
 
-    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
-         p_sock = &NetSock_Tbl[sock_id];
-                                                                /* Null argument checks - Set for Read/Write or Error   */
-         if (p_sock_desc_rd != DEF_NULL) {
-             sock_desc_used_rd = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_rd);
-         } else {
-             sock_desc_used_rd = DEF_NO;
-         }
-
-         if (p_sock_desc_wr != DEF_NULL) {
-             sock_desc_used_wr = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_wr);
-         } else {
-             sock_desc_used_wr = DEF_NO;
-         }
-
-         if (p_sock_desc_err != DEF_NULL) {
-             sock_desc_used_err = NET_SOCK_DESC_IS_SET(sock_id, p_sock_desc_err);
-         } else {
-             sock_desc_used_err = DEF_NO;
-         }
-
-
-         if ((sock_desc_used_rd  == DEF_YES) ||
-             (sock_desc_used_wr  == DEF_YES) ||
-             (sock_desc_used_err == DEF_YES)) {
-
-             p_sel_obj = (NET_SOCK_SEL_OBJ *)Mem_DynPoolBlkGet(&NetSock_SelObjPool, &lib_err);
-             if (p_sel_obj == DEF_NULL) {
-                cnt_sock_id = sock_id - 1;
-
-                while (cnt_sock_id >= 0) {
-                    NET_SOCK_SEL_OBJ  *p_sel_obj_to_free;
-
-
-                    sock_desc_used_rd  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_rd);
-                    sock_desc_used_wr  = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_wr);
-                    sock_desc_used_err = NET_SOCK_DESC_IS_SET(cnt_sock_id, p_sock_desc_err);
-
-                    if ((sock_desc_used_rd  == DEF_YES) ||
-                        (sock_desc_used_wr  == DEF_YES) ||
-                        (sock_desc_used_err == DEF_YES)) {
-
-                        p_sock                = &NetSock_Tbl[cnt_sock_id];
-                        p_sel_obj_to_free     =  p_sock->SelObjTailPtr;
-                        p_sock->SelObjTailPtr =  p_sel_obj_to_free->ObjPrevPtr;
+   *p_err = NET_SOCK_ERR_NONE;
+    goto exit_release;
 
-                        Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
-                    }
 
-                    cnt_sock_id--;
-                }
+exit_free:
+    Mem_DynPoolBlkFree(&NetSock_EventSetPool, p_set, &err_lib);
+    p_set = DEF_NULL;
 
-                 KAL_SemDel(task_sem, &err_kal_del);
-                *p_err = NET_ERR_FAULT_MEM_ALLOC;
-                 goto exit_err_sel;
-             }
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
 
-             p_sel_obj->SockSelPendingFlags = NET_SOCK_SEL_EVENT_FLAG_NONE;
+exit:
+    return (p_set);
+}
+#endif
 
-             if (sock_desc_used_rd == DEF_YES) {
-                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_RD;
-             }
 
-             if (sock_desc_used_wr == DEF_YES) {
-                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_WR;
-             }
+/*
+*********************************************************************************************************
+*                                        NetSock_EventSetDel()
+*
+* Description : Delete a socket event set & all its socket registrations.
+*
+* Argument(s) : p_set       Pointer to the socket event set to delete.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket event set successfully deleted.
+*                               NET_SOCK_ERR_NULL_PTR           Argument 'p_set' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_STATE      A task is waiting on the event set.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*
+*                                                               - RETURNED BY Net_GlobalLockAcquire() : -
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) Registrations are NOT linked on their event set; every socket's registration list is
+*                   searched until all the event set's registrations are freed.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+void  NetSock_EventSetDel (NET_SOCK_EVENT_SET  *p_set,
+                           NET_ERR             *p_err)
+{
+    NET_SOCK            *p_sock;
+    NET_SOCK_EVENT_REG  *p_reg;
+    NET_SOCK_EVENT_REG  *p_reg_next;
+    NET_SOCK_ID          sock_id;
+    LIB_ERR              err_lib;
+    KAL_ERR              err_kal;
 
-             if (sock_desc_used_err == DEF_YES) {
-                 p_sel_obj->SockSelPendingFlags |= NET_SOCK_SEL_EVENT_FLAG_ERR;
-             }
 
-             p_sel_obj->SockSelTaskSignalObj = task_sem;
-             p_sel_obj->ObjPrevPtr           = p_sock->SelObjTailPtr;
-             p_sock->SelObjTailPtr           = p_sel_obj;
-         }
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* ------------------- VALIDATE ARGS ------------------ */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
     }
 
-
-    timeout_ms = NetUtil_TimeSec_uS_To_ms(timeout_sec, timeout_us);
-    if (timeout_ms == NET_TMR_TIME_INFINITE) {
-        timeout_ms =  KAL_TIMEOUT_INFINITE;
+    if (p_set == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_NULL_PTR;
+        goto exit;
     }
+#endif
 
-                                                                /* ------ WAIT ON MULTIPLE SOCK DESC'S / EVENTS ------- */
-    Net_GlobalLockRelease();
-
-    KAL_SemPend(task_sem, KAL_OPT_PEND_NONE, timeout_ms, &err_kal);
-    Net_GlobalLockAcquire((void *)&NetSock_Sel, p_err);
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_EventSetDel, p_err);
     if (*p_err != NET_ERR_NONE) {
-        *p_err  = err;                                          /* Rtn err from Net_GlobalLockAcquire().                */
-         goto exit_lock_fault;
-    }
-
-
-    for (sock_id = 0; sock_id < sock_nbr_max; sock_id++) {
-         p_sock = &NetSock_Tbl[sock_id];
-
-         if (p_sock->SelObjTailPtr != DEF_NULL) {               /* Remove p_sel_obj from Socket Select objects list     */
-
-             p_sel_obj_cur  = p_sock->SelObjTailPtr;
-             p_sel_obj_next = DEF_NULL;
-
-             while (p_sel_obj_cur != DEF_NULL) {
-                 NET_SOCK_SEL_OBJ  *p_sel_obj_prev = p_sel_obj_cur->ObjPrevPtr;
-
-
-                 if (p_sel_obj_cur->SockSelTaskSignalObj.SemObjPtr == task_sem.SemObjPtr) {
-                     NET_SOCK_SEL_OBJ   *p_sel_obj_to_free  = DEF_NULL;
-
-
-                     if (p_sock->SelObjTailPtr == p_sel_obj_cur) {
-                         p_sock->SelObjTailPtr  = p_sel_obj_prev;
-
-                     } else if (p_sel_obj_next != DEF_NULL) {
-                         p_sel_obj_next->ObjPrevPtr = p_sel_obj_prev;
-                     } else {
-                                                                /* Empty Else Statement                                 */
-                     }
-
-                     p_sel_obj_to_free = p_sel_obj_cur;
-                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
-
-                     Mem_DynPoolBlkFree(&NetSock_SelObjPool, p_sel_obj_to_free, &lib_err);
-
-                 } else {
-                     p_sel_obj_next = p_sel_obj_cur;
-                     p_sel_obj_cur  = p_sel_obj_cur->ObjPrevPtr;
-                 }
-             }
-         }
+         goto exit;
     }
 
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_release;
+    }
+#endif
 
-    KAL_SemDel(task_sem, &err_kal_del);
-   (void)&err_kal_del;
+    if (p_set->WaitPending == DEF_YES) {                        /* Do NOT del set while a task waits on it.             */
+       *p_err = NET_SOCK_ERR_INVALID_STATE;
+        goto exit_release;
+    }
 
+                                                                /* --------------- FREE SET'S SOCK REGS --------------- */
+    sock_id = 0;
+    while ((p_set->RegCnt > 0) &&                               /* See Note #1.                                         */
+           (sock_id       < (NET_SOCK_ID)(NET_SOCK_NBR_SOCK))) {
+        p_sock = &NetSock_Tbl[sock_id];
+        p_reg  =  p_sock->EventRegListPtr;
+        while (p_reg != DEF_NULL) {
+            p_reg_next = p_reg->SockNextPtr;
+            if (p_reg->SetPtr == p_set) {
+                NetSock_EventSetRegFree(p_sock, p_reg);
+            }
+            p_reg = p_reg_next;
+        }
+        sock_id++;
+    }
 
+                                                                /* ------------------- FREE EVENT SET ----------------- */
+    KAL_SemDel(p_set->SignalObj, &err_kal);
+   (void)&err_kal;
 
-    switch (err_kal) {
-        case KAL_ERR_NONE:
-             break;
+    Mem_DynPoolBlkFree(&NetSock_EventSetPool, p_set, &err_lib);
+   (void)&err_lib;
 
-        case KAL_ERR_TIMEOUT:
-             if (p_sock_desc_rd != DEF_NULL) {
-                 NET_SOCK_DESC_INIT(p_sock_desc_rd );
-             }
+   *p_err = NET_SOCK_ERR_NONE;
 
-             if (p_sock_desc_wr != DEF_NULL) {
-                 NET_SOCK_DESC_INIT(p_sock_desc_wr );
-             }
 
-             if (p_sock_desc_err != DEF_NULL) {
-                 NET_SOCK_DESC_INIT(p_sock_desc_err);
-             }
-            *p_err = NET_SOCK_ERR_TIMEOUT;
-             goto exit_err_timeout;
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
 
-        case KAL_ERR_WOULD_BLOCK:
-        case KAL_ERR_ISR:
-        case KAL_ERR_ABORT:
-        case KAL_ERR_OS:
-        default:
-             goto exit_err_sel;
-    }
+exit:
+    return;
+}
+#endif
 
 
+/*
+*********************************************************************************************************
+*                                        NetSock_EventSetCtl()
+*
+* Description : Add, modify or remove a socket registration in a socket event set.
+*
+* Argument(s) : p_set       Pointer to the socket event set.
+*
+*               op          Registration operation :
+*
+*                               NET_SOCK_EVENT_SET_OP_ADD       Register   socket with requested events.
+*                               NET_SOCK_EVENT_SET_OP_MOD       Change     socket's requested events.
+*                               NET_SOCK_EVENT_SET_OP_DEL       Unregister socket.
+*
+*               sock_id     Socket descriptor/handle identifier of socket to (un)register.
+*
+*               events      Requested events, bit-field flags logically OR'd (ignored for NET_SOCK_EVENT_SET_OP_DEL) :
+*
+*                               NET_SOCK_SEL_EVENT_FLAG_RD      Socket ready to read     (or accept).
+*                               NET_SOCK_SEL_EVENT_FLAG_WR      Socket ready to write    (or connected).
+*                               NET_SOCK_SEL_EVENT_FLAG_ERR     Socket error &/or closed.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Registration successfully updated.
+*                               NET_SOCK_ERR_NULL_PTR           Argument 'p_set' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_ARG        Invalid registration operation.
+*                               NET_SOCK_ERR_INVALID_FLAG       NO valid requested event.
+*                               NET_SOCK_ERR_INVALID_OP         Socket already registered (add) or NOT
+*                                                                   registered (modify/remove).
+*                               NET_ERR_FAULT_MEM_ALLOC         Registration allocation failed.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
+*
+*                                                               ------ RETURNED BY NetSock_IsUsed() : ------
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket number.
+*                               NET_SOCK_ERR_NOT_USED           Socket NOT used.
+*
+*                                                               - RETURNED BY Net_GlobalLockAcquire() : -
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) An added or modified registration is queued on the event set's ready list so that the
+*                   socket's current state is checked by the next NetSock_EventSetWait().
+*
+*               (2) Registrations are freed when their socket is freed (see NetSock_Free()).
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+void  NetSock_EventSetCtl (NET_SOCK_EVENT_SET       *p_set,
+                           NET_SOCK_EVENT_SET_OP     op,
+                           NET_SOCK_ID               sock_id,
+                           NET_SOCK_SEL_EVENT_FLAG   events,
+                           NET_ERR                  *p_err)
+{
+    NET_SOCK            *p_sock;
+    NET_SOCK_EVENT_REG  *p_reg;
+    CPU_BOOLEAN          used;
+    LIB_ERR              err_lib;
+
 
-    if (p_sock_desc_rd != DEF_NULL) {
-        NET_SOCK_DESC_COPY(&sock_desc_rtn_rd, p_sock_desc_rd);
-    } else {
-        NET_SOCK_DESC_INIT(&sock_desc_rtn_rd);
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* ------------------- VALIDATE ARGS ------------------ */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
     }
 
-    if (p_sock_desc_wr != DEF_NULL) {
-        NET_SOCK_DESC_COPY(&sock_desc_rtn_wr, p_sock_desc_wr);
-    } else {
-        NET_SOCK_DESC_INIT(&sock_desc_rtn_wr);
+    if (p_set == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_NULL_PTR;
+        goto exit;
     }
+#endif
 
-    if (p_sock_desc_err != DEF_NULL) {
-        NET_SOCK_DESC_COPY(&sock_desc_rtn_err, p_sock_desc_err);
-    } else {
-        NET_SOCK_DESC_INIT(&sock_desc_rtn_err);
+    events &= (NET_SOCK_SEL_EVENT_FLAG_RD  |
+               NET_SOCK_SEL_EVENT_FLAG_WR  |
+               NET_SOCK_SEL_EVENT_FLAG_ERR);
+    if ((op     != NET_SOCK_EVENT_SET_OP_DEL) &&
+        (events == NET_SOCK_SEL_EVENT_FLAG_NONE)) {
+       *p_err = NET_SOCK_ERR_INVALID_FLAG;
+        goto exit;
     }
 
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_EventSetCtl, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit;
+    }
 
-    sock_nbr_rdy = NetSock_SelDescHandler(sock_nbr_max_actual,
-                                         &sock_desc_rtn_rd,
-                                         &sock_desc_rtn_wr,
-                                         &sock_desc_rtn_err,
-                                          p_err);
-    if (p_sock_desc_rd != DEF_NULL) {
-        NET_SOCK_DESC_COPY(p_sock_desc_rd, &sock_desc_rtn_rd);
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_release;
     }
+#endif
 
-    if (p_sock_desc_wr != DEF_NULL) {
-        NET_SOCK_DESC_COPY(p_sock_desc_wr,  &sock_desc_rtn_wr );
+                                                                /* ------------------ VALIDATE SOCK ------------------- */
+    used = NetSock_IsUsed(sock_id, p_err);
+    if (used != DEF_YES) {
+        goto exit_release;
     }
 
-    if (p_sock_desc_err != DEF_NULL) {
-        NET_SOCK_DESC_COPY(p_sock_desc_err, &sock_desc_rtn_err);
+    p_sock = &NetSock_Tbl[sock_id];
+                                                                /* ------------------ SRCH SOCK REG ------------------- */
+    p_reg  =  p_sock->EventRegListPtr;
+    while ((p_reg         != DEF_NULL) &&
+           (p_reg->SetPtr != p_set)) {
+        p_reg = p_reg->SockNextPtr;
     }
 
-   *p_err = NET_SOCK_ERR_NONE;
 
-    goto exit_release;
+    switch (op) {
+        case NET_SOCK_EVENT_SET_OP_ADD:
+             if (p_reg != DEF_NULL) {
+                *p_err = NET_SOCK_ERR_INVALID_OP;
+                 goto exit_release;
+             }
 
+             p_reg = (NET_SOCK_EVENT_REG *)Mem_DynPoolBlkGet(&NetSock_EventRegPool, &err_lib);
+             if (err_lib != LIB_MEM_ERR_NONE) {
+                *p_err = NET_ERR_FAULT_MEM_ALLOC;
+                 goto exit_release;
+             }
 
-exit_lock_fault:
-    return (NET_SOCK_BSD_ERR_SEL);
+             p_reg->SetPtr          = p_set;
+             p_reg->SockID          = sock_id;
+             p_reg->EventsReq       = events;
+             p_reg->IsRdy           = DEF_NO;
+             p_reg->RdyNextPtr      = DEF_NULL;
+             p_reg->SockNextPtr     = p_sock->EventRegListPtr;  /* Link reg on sock's reg list.                         */
+             p_sock->EventRegListPtr = p_reg;
+             p_set->RegCnt++;
 
-exit_err_timeout:
-    sock_nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
-    goto exit_release;
+             NetSock_EventSetRdyInsert(p_reg);                  /* Chk sock on next wait (see Note #1).                 */
+             break;
+
+
+        case NET_SOCK_EVENT_SET_OP_MOD:
+             if (p_reg == DEF_NULL) {
+                *p_err = NET_SOCK_ERR_INVALID_OP;
+                 goto exit_release;
+             }
+
+             p_reg->EventsReq = events;
+             NetSock_EventSetRdyInsert(p_reg);                  /* Chk sock on next wait (see Note #1).                 */
+             break;
+
+
+        case NET_SOCK_EVENT_SET_OP_DEL:
+             if (p_reg == DEF_NULL) {
+                *p_err = NET_SOCK_ERR_INVALID_OP;
+                 goto exit_release;
+             }
+
+             NetSock_EventSetRegFree(p_sock, p_reg);
+             break;
+
+
+        default:
+            *p_err = NET_SOCK_ERR_INVALID_ARG;
+             goto exit_release;
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
 
-exit_err_sel:
-    sock_nbr_rdy = NET_SOCK_BSD_ERR_SEL;
 
 exit_release:
                                                                 /* ----------------- RELEASE NET LOCK ----------------- */
-   Net_GlobalLockRelease();
+    Net_GlobalLockRelease();
 
 exit:
-   return (sock_nbr_rdy);                                       /* Rtn nbr rdy sock desc's (see Note #3c1A1).           */
+    return;
 }
 #endif
 
 
-
 /*
 *********************************************************************************************************
-*                                          NetSock_SelAbort()
+*                                        NetSock_EventSetWait()
 *
-* Description : Abort (unblock) all tasks that are pending on a particular socket using the select.
+* Description : Wait for any registered socket of a socket event set to be ready.
 *
-* Argument(s) : sock_id     Socket descriptor/handle identifier of socket to abort the select.
+* Argument(s) : p_set       Pointer to the socket event set.
+*
+*               p_events    Pointer to an array of socket events to receive the ready sockets & their ready
+*                               events (NET_SOCK_SEL_EVENT_FLAG_&&&).
+*
+*               events_max  Maximum number of socket events to return in 'p_events'.
+*
+*               timeout_ms  Timeout value :
+*
+*                               0                       Do NOT wait; only check ready sockets.
+*                               NET_TMR_TIME_INFINITE   Wait until a socket is ready.
+*                               In number of milliseconds, otherwise.
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                                 NET_SOCK_ERR_NONE              No error
+*                               NET_SOCK_ERR_NONE               At least one socket ready.
+*                               NET_SOCK_ERR_TIMEOUT            NO socket ready before timeout.
+*                               NET_SOCK_ERR_NULL_PTR           Argument 'p_set'/'p_events' passed a NULL pointer.
+*                               NET_SOCK_ERR_INVALID_ARG        Argument 'events_max' passed a zero value.
+*                               NET_SOCK_ERR_INVALID_STATE      Another task already waits on the event set.
+*                               NET_SOCK_ERR_SEL_SIGNAL_FAULT   Event set signal wait failed.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
 *
-*                                 NET_SOCK_ERR_INVALID_ARG       Invalid socket ID
-*                                 NET_SOCK_ERR_NONE_AVAIL        No task pending on the socket.
-*                                 NET_SOCK_ERR_INVALID_FLAG      No 'select' pend flag is set.
-*                                 NET_SOCK_ERR_SEL_SIGNAL_FAULT  Internal error.
+*                                                               - RETURNED BY Net_GlobalLockAcquire() : -
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : None.
+* Return(s)   : Number of ready sockets returned in 'p_events', if NO error(s).
 *
-* Caller(s)   : None.
+*               NET_SOCK_BSD_RTN_CODE_TIMEOUT,                  if timeout.
 *
-* Note(s)     : None.
+*               NET_SOCK_BSD_ERR_SEL,                           otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) Only ONE task may wait on an event set at a time.
+*
+*               (2) The event set signal is cleared before each wait since every registration signaled
+*                   while the network lock was held is already queued on the ready list.
+*
+*               (3) Socket events are level-triggered : a socket still ready stays queued on the ready
+*                   list & is returned again by the next wait.
+*
+*                   See also 'NetSock_EventSetRdyHandler()  Note #2'.
 *********************************************************************************************************
 */
-#if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
-void  NetSock_SelAbort (NET_SOCK_ID   sock_id,
-                        NET_ERR      *p_err)
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+NET_SOCK_RTN_CODE  NetSock_EventSetWait (NET_SOCK_EVENT_SET  *p_set,
+                                         NET_SOCK_EVENT      *p_events,
+                                         NET_SOCK_QTY         events_max,
+                                         CPU_INT32U           timeout_ms,
+                                         NET_ERR             *p_err)
 {
-    NET_SOCK           *p_sock;
-    NET_SOCK_SEL_OBJ   *p_sel_obj;
-    CPU_BOOLEAN         post_success;
+    NET_SOCK_RTN_CODE  nbr_rdy;
+    NET_TS_MS          ts_start_ms;
+    NET_TS_MS          ts_elapsed_ms;
+    CPU_INT32U         timeout_kal_ms;
+    KAL_ERR            err_kal;
+    NET_ERR            err;
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+                                                                /* ------------------- VALIDATE ARGS ------------------ */
     if (p_err == DEF_NULL) {
         CPU_SW_EXCEPTION((NET_SOCK_RTN_CODE)0);
     }
-#endif
 
-    p_sock = NetSock_GetObj(sock_id);
-    if (p_sock == DEF_NULL) {
+    if ((p_set    == DEF_NULL) ||
+        (p_events == DEF_NULL)) {
+       *p_err = NET_SOCK_ERR_NULL_PTR;
+        goto exit_fault;
+    }
+
+    if (events_max < 1) {
        *p_err = NET_SOCK_ERR_INVALID_ARG;
-        goto exit;
+        goto exit_fault;
     }
+#endif
 
-    p_sel_obj = p_sock->SelObjTailPtr;
-    if (p_sel_obj == DEF_NULL) {
-       *p_err = NET_SOCK_ERR_NONE_AVAIL;
-        goto exit;
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetSock_EventSetWait, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_fault;
     }
 
-    if (p_sel_obj->SockSelPendingFlags == NET_SOCK_SEL_EVENT_FLAG_NONE) {
-       *p_err = NET_SOCK_ERR_INVALID_FLAG;
-        goto exit;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit.                          */
+       *p_err =  NET_INIT_ERR_NOT_COMPLETED;
+        goto exit_err;
     }
+#endif
 
-    post_success = NetSock_SelPost(p_sock, NET_SOCK_EVENT_TYPE_SEL_ABORT);
+    if (p_set->WaitPending == DEF_YES) {                        /* See Note #1.                                         */
+       *p_err = NET_SOCK_ERR_INVALID_STATE;
+        goto exit_err;
+    }
 
-   *p_err        = (post_success == DEF_OK) ?
-                   (NET_SOCK_ERR_NONE)      :
-                   (NET_SOCK_ERR_SEL_SIGNAL_FAULT);
+                                                                /* ------------------ CHK RDY SOCKS ------------------- */
+    ts_start_ms = NetUtil_TS_Get_ms();
+    nbr_rdy     = (NET_SOCK_RTN_CODE)NetSock_EventSetRdyHandler(p_set, p_events, events_max);
 
-exit:
-    return;
+    while ((nbr_rdy    == 0) &&
+           (timeout_ms != 0u)) {
+        if (timeout_ms == NET_TMR_TIME_INFINITE) {
+            timeout_kal_ms = KAL_TIMEOUT_INFINITE;
+        } else {
+            ts_elapsed_ms = NetUtil_TS_Get_ms() - ts_start_ms;
+            if (ts_elapsed_ms >= timeout_ms) {
+                break;
+            }
+            timeout_kal_ms = timeout_ms - ts_elapsed_ms;
+        }
+
+                                                                /* ---------------- WAIT ON EVENT SET ----------------- */
+        KAL_SemSet(p_set->SignalObj, 0u, &err_kal);             /* See Note #2.                                         */
+        p_set->WaitPending = DEF_YES;
+
+        Net_GlobalLockRelease();
+
+        KAL_SemPend(p_set->SignalObj, KAL_OPT_PEND_NONE, timeout_kal_ms, &err_kal);
+
+        Net_GlobalLockAcquire((void *)&NetSock_EventSetWait, &err);
+        p_set->WaitPending = DEF_NO;
+        if (err != NET_ERR_NONE) {
+           *p_err = err;                                        /* Rtn err from Net_GlobalLockAcquire().                */
+            goto exit_fault;
+        }
+
+        switch (err_kal) {
+            case KAL_ERR_NONE:
+                 break;
+
+            case KAL_ERR_TIMEOUT:
+                 goto exit_timeout;
+
+            case KAL_ERR_WOULD_BLOCK:
+            case KAL_ERR_ISR:
+            case KAL_ERR_ABORT:
+            case KAL_ERR_OS:
+            default:
+                *p_err = NET_SOCK_ERR_SEL_SIGNAL_FAULT;
+                 goto exit_err;
+        }
+
+        nbr_rdy = (NET_SOCK_RTN_CODE)NetSock_EventSetRdyHandler(p_set, p_events, events_max);
+    }
+
+    if (nbr_rdy == 0) {
+        goto exit_timeout;
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+    goto exit_release;
+
+
+exit_timeout:
+   *p_err   = NET_SOCK_ERR_TIMEOUT;
+    nbr_rdy = NET_SOCK_BSD_RTN_CODE_TIMEOUT;
+    goto exit_release;
+
+exit_err:
+    nbr_rdy = NET_SOCK_BSD_ERR_SEL;
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+    return (nbr_rdy);
+
+
+exit_fault:
+    return (NET_SOCK_BSD_ERR_SEL);
 }
 #endif
 
@@ -6823,6 +8472,10 @@ static  void  NetSock_AppPostTx (NET_CONN_ID  conn_id_app)
 *
 * Note(s)     : (1) At least one of the socket's Select Pending Flags (.SockSelPendingFlags) must be set
 *                   in order to properly post to the KAL_SemPend() call in NetSock_Sel().
+*
+*               (2) Socket event sets are signaled with the same events as select pending objects.
+*
+*                   See also 'NetSock_EventSetPost()  Note #1'.
 *********************************************************************************************************
 */
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
@@ -6835,7 +8488,13 @@ static  CPU_BOOLEAN  NetSock_SelPost (NET_SOCK             *p_sock,
 
 
     if (p_sel_obj == DEF_NULL) {
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+        if (p_sock->EventRegListPtr == DEF_NULL) {
+            goto exit;
+        }
+#else
         goto exit;
+#endif
     }
 
 
@@ -6873,6 +8532,11 @@ static  CPU_BOOLEAN  NetSock_SelPost (NET_SOCK             *p_sock,
              break;
     }
 
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+    if (p_sock->EventRegListPtr != DEF_NULL) {                  /* Signal sock's event sets (see Note #2).              */
+        NetSock_EventSetPost(p_sock, flags_mask);
+    }
+#endif
 
     while (p_sel_obj != DEF_NULL) {
         if ((p_sel_obj->SockSelPendingFlags & flags_mask) > 0) {/* See Note 1.                                          */
@@ -6894,6 +8558,255 @@ exit:
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        NetSock_EventSetPost()
+*
+* Description : Signal the socket event sets registered on a socket that one of their requested events
+*                   may have occurred.
+*
+* Argument(s) : p_sock      Pointer to the signaled socket.
+*               ------      Argument validated in NetSock_SelPost().
+*
+*               flags_mask  Socket events that may have occurred (NET_SOCK_SEL_EVENT_FLAG_&&&).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_SelPost().
+*
+* Note(s)     : (1) Each matching registration is only queued on its event set's ready list; whether the
+*                   socket is actually ready is checked by NetSock_EventSetWait().
+*
+*               (2) The event set signal is only posted if a task waits on the event set.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+static  void  NetSock_EventSetPost (NET_SOCK                 *p_sock,
+                                    NET_SOCK_SEL_EVENT_FLAG   flags_mask)
+{
+    NET_SOCK_EVENT_REG  *p_reg;
+    NET_SOCK_EVENT_SET  *p_set;
+    KAL_ERR              err_kal;
+
+
+    p_reg = p_sock->EventRegListPtr;
+    while (p_reg != DEF_NULL) {
+        if ((p_reg->EventsReq & flags_mask) != NET_SOCK_SEL_EVENT_FLAG_NONE) {
+            p_set = p_reg->SetPtr;
+            NetSock_EventSetRdyInsert(p_reg);                   /* See Note #1.                                         */
+
+            if (p_set->WaitPending == DEF_YES) {                /* See Note #2.                                         */
+                KAL_SemPost(p_set->SignalObj, KAL_OPT_POST_NONE, &err_kal);
+               (void)&err_kal;
+            }
+        }
+
+        p_reg = p_reg->SockNextPtr;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetSock_EventSetRdyInsert()
+*
+* Description : Queue a socket registration at the tail of its event set's ready list.
+*
+* Argument(s) : p_reg       Pointer to the socket registration.
+*               -----       Argument validated in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_EventSetCtl(),
+*               NetSock_EventSetPost(),
+*               NetSock_EventSetRdyHandler().
+*
+* Note(s)     : (1) A registration already queued is NOT queued again.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+static  void  NetSock_EventSetRdyInsert (NET_SOCK_EVENT_REG  *p_reg)
+{
+    NET_SOCK_EVENT_SET  *p_set;
+
+
+    if (p_reg->IsRdy == DEF_YES) {                              /* See Note #1.                                         */
+        return;
+    }
+
+    p_set             = p_reg->SetPtr;
+    p_reg->RdyNextPtr = DEF_NULL;
+    p_reg->IsRdy      = DEF_YES;
+
+    if (p_set->RdyTailPtr != DEF_NULL) {
+        p_set->RdyTailPtr->RdyNextPtr = p_reg;
+    } else {
+        p_set->RdyHeadPtr             = p_reg;
+    }
+    p_set->RdyTailPtr = p_reg;
+    p_set->RdyCnt++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetSock_EventSetRdyHandler()
+*
+* Description : Check the socket registrations queued on an event set's ready list & return the ready ones.
+*
+* Argument(s) : p_set       Pointer to the socket event set.
+*               -----       Argument validated in NetSock_EventSetWait().
+*
+*               p_events    Pointer to an array of socket events to receive the ready sockets.
+*               --------    Argument validated in NetSock_EventSetWait().
+*
+*               events_max  Maximum number of socket events to return in 'p_events'.
+*
+* Return(s)   : Number of ready sockets returned in 'p_events'.
+*
+* Caller(s)   : NetSock_EventSetWait().
+*
+* Note(s)     : (1) Each registration is checked with the same handlers as NetSock_Sel() uses; a socket
+*                   that is NOT ready is removed from the ready list until it is signaled again.
+*
+*               (2) (a) A ready socket is re-queued at the ready list's tail (see 'NetSock_EventSetWait()
+*                       Note #3').
+*
+*                   (b) Each queued registration is checked at most once per call & registrations NOT
+*                       checked once 'events_max' sockets are returned stay at the ready list's head, so
+*                       that every ready socket is eventually returned.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+static  NET_SOCK_QTY  NetSock_EventSetRdyHandler (NET_SOCK_EVENT_SET  *p_set,
+                                                  NET_SOCK_EVENT      *p_events,
+                                                  NET_SOCK_QTY         events_max)
+{
+    NET_SOCK_EVENT_REG       *p_reg;
+    NET_SOCK_SEL_EVENT_FLAG   events;
+    NET_SOCK_QTY              nbr_chk;
+    NET_SOCK_QTY              nbr_rdy;
+    CPU_BOOLEAN               sock_rdy;
+    NET_ERR                   err;
+
+
+    nbr_rdy = 0u;
+    nbr_chk = p_set->RdyCnt;                                    /* See Note #2b.                                        */
+
+    while ((nbr_chk > 0) &&
+           (nbr_rdy < events_max)) {
+                                                                /* Unlink reg from rdy list head.                       */
+        p_reg             = p_set->RdyHeadPtr;
+        p_set->RdyHeadPtr = p_reg->RdyNextPtr;
+        if (p_set->RdyHeadPtr == DEF_NULL) {
+            p_set->RdyTailPtr  = DEF_NULL;
+        }
+        p_reg->RdyNextPtr = DEF_NULL;
+        p_reg->IsRdy      = DEF_NO;
+        p_set->RdyCnt--;
+        nbr_chk--;
+
+                                                                /* Chk req'd events (see Note #1).                      */
+        events = NET_SOCK_SEL_EVENT_FLAG_NONE;
+        if ((p_reg->EventsReq & NET_SOCK_SEL_EVENT_FLAG_RD) != NET_SOCK_SEL_EVENT_FLAG_NONE) {
+            sock_rdy = NetSock_SelDescHandlerRd(p_reg->SockID, &err);
+            if (sock_rdy == DEF_YES) {
+                events |= NET_SOCK_SEL_EVENT_FLAG_RD;
+            }
+        }
+        if ((p_reg->EventsReq & NET_SOCK_SEL_EVENT_FLAG_WR) != NET_SOCK_SEL_EVENT_FLAG_NONE) {
+            sock_rdy = NetSock_SelDescHandlerWr(p_reg->SockID, &err);
+            if (sock_rdy == DEF_YES) {
+                events |= NET_SOCK_SEL_EVENT_FLAG_WR;
+            }
+        }
+        if ((p_reg->EventsReq & NET_SOCK_SEL_EVENT_FLAG_ERR) != NET_SOCK_SEL_EVENT_FLAG_NONE) {
+            sock_rdy = NetSock_SelDescHandlerErr(p_reg->SockID, &err);
+            if (sock_rdy == DEF_YES) {
+                events |= NET_SOCK_SEL_EVENT_FLAG_ERR;
+            }
+        }
+
+        if (events != NET_SOCK_SEL_EVENT_FLAG_NONE) {
+            p_events[nbr_rdy].SockID = p_reg->SockID;
+            p_events[nbr_rdy].Events = events;
+            nbr_rdy++;
+
+            NetSock_EventSetRdyInsert(p_reg);                   /* See Note #2a.                                        */
+        }
+    }
+
+    return (nbr_rdy);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetSock_EventSetRegFree()
+*
+* Description : Unlink a socket registration from its socket & event set & free it.
+*
+* Argument(s) : p_sock      Pointer to the registered socket.
+*               ------      Argument validated in caller(s).
+*
+*               p_reg       Pointer to the socket registration.
+*               -----       Argument validated in caller(s).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSock_EventSetCtl(),
+*               NetSock_EventSetDel(),
+*               NetSock_Free().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+static  void  NetSock_EventSetRegFree (NET_SOCK            *p_sock,
+                                       NET_SOCK_EVENT_REG  *p_reg)
+{
+    NET_SOCK_EVENT_SET   *p_set;
+    NET_SOCK_EVENT_REG  **p_reg_prev_next;
+    LIB_ERR               err_lib;
+
+
+    p_set = p_reg->SetPtr;
+                                                                /* ------------- UNLINK FROM SOCK REG LIST ------------ */
+    p_reg_prev_next = &p_sock->EventRegListPtr;
+    while (*p_reg_prev_next != p_reg) {
+        p_reg_prev_next = &(*p_reg_prev_next)->SockNextPtr;
+    }
+   *p_reg_prev_next = p_reg->SockNextPtr;
+
+                                                                /* --------------- UNLINK FROM RDY LIST --------------- */
+    if (p_reg->IsRdy == DEF_YES) {
+        NET_SOCK_EVENT_REG  *p_reg_prev = DEF_NULL;
+
+
+        p_reg_prev_next = &p_set->RdyHeadPtr;
+        while (*p_reg_prev_next != p_reg) {
+            p_reg_prev      = *p_reg_prev_next;
+            p_reg_prev_next = &p_reg_prev->RdyNextPtr;
+        }
+       *p_reg_prev_next = p_reg->RdyNextPtr;
+
+        if (p_set->RdyTailPtr == p_reg) {
+            p_set->RdyTailPtr  = p_reg_prev;
+        }
+        p_set->RdyCnt--;
+    }
+
+    p_set->RegCnt--;
+
+    Mem_DynPoolBlkFree(&NetSock_EventRegPool, p_reg, &err_lib);
+   (void)&err_lib;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetSock_CfgBlock()
@@ -8141,6 +10054,7 @@ exit:
 *                       NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
 *                       NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
 *                                                                                                          value (in seconds)
+*                       NET_SOCK_OPT_TCP_CONG_CTRL      NET_TCP_CONG_CTRL_ALGO  TCP congestion control algorithm
 *********************************************************************************************************
 */
 
@@ -8204,6 +10118,7 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
        case NET_SOCK_OPT_TCP_KEEP_CNT:
        case NET_SOCK_OPT_TCP_KEEP_IDLE:
        case NET_SOCK_OPT_TCP_KEEP_INTVL:
+       case NET_SOCK_OPT_TCP_CONG_CTRL:
             if (level != NET_SOCK_PROTOCOL_TCP) {
                *p_err =  NET_SOCK_ERR_INVALID_OPT_LEVEL;
                 goto exit_lock_fault;                           /* Sock opt incompatible with protocol level.           */
@@ -8430,6 +10345,26 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
 
            *p_err = NET_SOCK_ERR_NONE;
             break;
+
+
+       case NET_SOCK_OPT_TCP_CONG_CTRL:
+            if (*p_opt_len < (CPU_INT32S)sizeof(NET_TCP_CONG_CTRL_ALGO)) {
+                *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
+                 goto exit_err_opt_get;
+            }
+
+            if (!is_used) {
+                goto exit_err_opt_get;                          /* 'p_err' has value last set by NetTCP_ConnIsUsed().   */
+            }
+            p_conn    = &NetTCP_ConnTbl[conn_id_tcp];
+           *p_opt_len =  sizeof(NET_TCP_CONG_CTRL_ALGO);
+
+            Mem_Copy(             p_opt_val,
+                     (void     *)&p_conn->CongCtrlAlgo,
+                     (CPU_SIZE_T)*p_opt_len);
+
+           *p_err = NET_SOCK_ERR_NONE;
+            break;
 #endif
 
        case NET_SOCK_OPT_SOCK_TYPE:                             /* ---------------- SOCK-LEVEL OPTIONS ---------------- */
@@ -16388,6 +18323,11 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 *               p_data_buf           Pointer to an application data buffer that will receive the socket's received
 *                                       data.
 *
+*               p_iov               Pointer to an array of I/O vectors that will receive the socket's received
+*                                       data (see Note #12), if available; NULL pointer, otherwise.
+*
+*               iov_cnt             Number of I/O vectors in array.
+*
 *               data_buf_len        Size of the   application data buffer (in octets) [see Note #2].
 *
 *               flags               Flags to select receive options (see Note #3); bit-field flags logically OR'd :
@@ -16424,6 +18364,11 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 *               p_ip_opts_len        Pointer to variable that will receive the return size of any received IP options,
 *                                       if NO error(s).
 *
+*               p_buf_zero_copy     Pointer to a variable that will receive the received network buffer (see Note #11) :
+*
+*                                       NULL pointer,  if data received into 'p_data_buf';
+*                                       valid pointer, if data received by zero-copy receive.
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_ERR_FAULT_NULL_PTR              Argument 'p_data_buf'    passed a NULL pointer.
@@ -16481,7 +18426,8 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 *               NET_SOCK_BSD_ERR_RX,                     otherwise                   (see Note #7c1).
 *
 * Caller(s)   : NetSock_RxDataFrom(),
-*               NetSock_RxData().
+*               NetSock_RxData(),
+*               NetSock_RxDataV().
 *
 * Note(s)     : (2) (a) (1) (A) Datagram-type sockets transmit & receive all data atomically -- i.e. every
 *                               single, complete datagram transmitted MUST be received as a single, complete
@@ -16585,11 +18531,27 @@ static  CPU_BOOLEAN  NetSock_ConnAcceptQ_ConnID_Remove (NET_SOCK     *p_sock,
 *                   included as an extra precaution in case 'SockType' is incorrectly modified.
 *
 *              (10) IP options arguments may NOT be necessary (remove if unnecessary).
+*
+*              (11) Zero-copy receive returns the received network buffer(s) to the application instead of
+*                   copying data into 'p_data_buf'.  Since the buffer(s) are dequeued, peek is NOT supported.
+*
+*                   See also 'NetSock_RxDataZeroCopy()  Note #2'.
+*
+*              (12) (a) Scatter receive copies the socket's received data directly into the array of I/O
+*                       vectors, in order, instead of into 'p_data_buf'; 'data_buf_len' is the total size of
+*                       the I/O vectors.
+*
+*                   (b) Secure sockets decrypt received data into a single application buffer; thus scatter
+*                       receive on a secure socket receives into the first non-empty I/O vector only.
+*
+*                   See also 'NetSock_RxDataV()  Note #2'.
 *********************************************************************************************************
 */
 
 static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
                                                   void                *p_data_buf,
+                                                  NET_SOCK_IO_VEC     *p_iov,
+                                                  CPU_INT16U           iov_cnt,
                                                   CPU_INT16U           data_buf_len,
                                                   NET_SOCK_API_FLAGS   flags,
                                                   NET_SOCK_ADDR       *p_addr_remote,
@@ -16597,6 +18559,7 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
                                                   void                *p_ip_opts_buf,
                                                   CPU_INT08U           ip_opts_buf_len,
                                                   CPU_INT08U          *p_ip_opts_len,
+                                                  NET_BUF            **p_buf_zero_copy,
                                                   NET_ERR             *p_err)
 {
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
@@ -16611,22 +18574,29 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_buf_zero_copy == (NET_BUF **)0) {
                                                                 /* --------------- VALIDATE RX DATA BUF --------------- */
-    if (p_data_buf == (void *)0) {
-        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
-       *p_err = NET_ERR_FAULT_NULL_PTR;
-        return (NET_SOCK_BSD_ERR_RX);
-    }
-    if (data_buf_len < 1) {
-        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullSizeCtr);
-       *p_err = NET_ERR_FAULT_NULL_PTR;
-        return (NET_SOCK_BSD_ERR_RX);
+        if ((p_data_buf == (void            *)0) &&             /* Validate data buf ptr (see Note #12a).               */
+            (p_iov      == (NET_SOCK_IO_VEC *)0)) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
+           *p_err = NET_ERR_FAULT_NULL_PTR;
+            return (NET_SOCK_BSD_ERR_RX);
+        }
+        if (data_buf_len < 1) {
+            NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullSizeCtr);
+           *p_err = NET_ERR_FAULT_NULL_PTR;
+            return (NET_SOCK_BSD_ERR_RX);
+        }
+
+        flag_mask = NET_SOCK_FLAG_NONE         |
+                    NET_SOCK_FLAG_RX_DATA_PEEK |
+                    NET_SOCK_FLAG_RX_NO_BLOCK;
+    } else {                                                    /* Zero-copy rx always consumes data (see Note #11).    */
+        flag_mask = NET_SOCK_FLAG_NONE         |
+                    NET_SOCK_FLAG_RX_NO_BLOCK;
     }
 
                                                                 /* ----------------- VALIDATE RX FLAGS ---------------- */
-    flag_mask = NET_SOCK_FLAG_NONE         |
-                NET_SOCK_FLAG_RX_DATA_PEEK |
-                NET_SOCK_FLAG_RX_NO_BLOCK;
                                                                 /* If any invalid flags req'd, rtn err (see Note #3).   */
     if (((NET_SOCK_FLAGS)flags & (NET_SOCK_FLAGS)~flag_mask) != NET_SOCK_FLAG_NONE) {
         NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidFlagsCtr);
@@ -16654,6 +18624,8 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
              rtn_code = NetSock_RxDataHandlerDatagram((NET_SOCK_ID        )sock_id,
                                                       (NET_SOCK          *)p_sock,
                                                       (void              *)p_data_buf,
+                                                      (NET_SOCK_IO_VEC   *)p_iov,
+                                                      (CPU_INT16U         )iov_cnt,
                                                       (CPU_INT16U         )data_buf_len,
                                                       (NET_SOCK_API_FLAGS )flags,
                                                       (NET_SOCK_ADDR     *)p_addr_remote,
@@ -16661,6 +18633,7 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
                                                       (void              *)p_ip_opts_buf,
                                                       (CPU_INT08U         )ip_opts_buf_len,
                                                       (CPU_INT08U        *)p_ip_opts_len,
+                                                      (NET_BUF          **)p_buf_zero_copy,
                                                       (NET_ERR           *)p_err);
              break;
 
@@ -16676,14 +18649,36 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandler (NET_SOCK_ID          sock_id,
                  rtn_code = NetSock_RxDataHandlerStream((NET_SOCK_ID        )sock_id,
                                                         (NET_SOCK          *)p_sock,
                                                         (void              *)p_data_buf,
+                                                        (NET_SOCK_IO_VEC   *)p_iov,
+                                                        (CPU_INT16U         )iov_cnt,
                                                         (CPU_INT16U         )data_buf_len,
                                                         (NET_SOCK_API_FLAGS )flags,
                                                         (NET_SOCK_ADDR     *)p_addr_remote,
                                                         (NET_SOCK_ADDR_LEN *)p_addr_len,
+                                                        (NET_BUF          **)p_buf_zero_copy,
                                                         (NET_ERR           *)p_err);
              }
 #ifdef  NET_SECURE_MODULE_EN                                    /* If sock secure, rx data via secure handler.          */
-               else {
+               else if (p_buf_zero_copy != (NET_BUF **)0) {     /* Secure data MUST be decrypted into app buf.          */
+                 NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidOpCtr);
+                *p_err = NET_SOCK_ERR_INVALID_OP;
+                 goto exit_err_rx;
+             } else if (p_iov != (NET_SOCK_IO_VEC *)0) {        /* Rx into first non-empty iov (see Note #12b).         */
+                 while ((iov_cnt          > 0u) &&
+                        (p_iov->DataLen  < 1u)) {
+                     p_iov++;
+                     iov_cnt--;
+                 }
+                 if (iov_cnt < 1u) {
+                     NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullSizeCtr);
+                    *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                     goto exit_err_rx;
+                 }
+                 rtn_code = NetSecure_SockRxDataHandler((NET_SOCK *)p_sock,
+                                                        (void     *)p_iov->DataPtr,
+                                                        (CPU_INT16U)DEF_MIN(p_iov->DataLen, data_buf_len),
+                                                        (NET_ERR  *)p_err);
+             } else {
                  rtn_code = NetSecure_SockRxDataHandler((NET_SOCK *)p_sock,
                                                         (void     *)p_data_buf,
                                                         (CPU_INT16U)data_buf_len,
@@ -16743,6 +18738,13 @@ exit_release:
 *
 *                                   Argument checked   in NetSock_RxDataHandler().
 *
+*               p_iov               Pointer to an array of I/O vectors that will receive the socket's received
+*               -----                   data (see Note #16), if available; NULL pointer, otherwise.
+*
+*                                   Argument checked   in NetSock_RxDataHandler().
+*
+*               iov_cnt             Number of I/O vectors in array.
+*
 *               data_buf_len        Size of the   application data buffer (in octets) [see Note #2b].
 *               ------------        Argument checked   in NetSock_RxDataHandler().
 *
@@ -16783,6 +18785,11 @@ exit_release:
 *               p_ip_opts_len        Pointer to variable that will receive the return size of any received IP options,
 *                                       if NO error(s).
 *
+*               p_buf_zero_copy     Pointer to a variable that will receive the received packet buffer(s), if
+*               ---------------         zero-copy receive (see Note #15); NULL pointer, otherwise.
+*
+*                                   Argument checked   in NetSock_RxDataHandler().
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_SOCK_ERR_NONE                   Socket data successfully received; check return
@@ -16926,12 +18933,23 @@ exit_release:
 *                          & 'NetSock_SelDescHandlerErrDatagram()  Note #3'.
 *
 *              (14) IP options arguments may NOT be necessary (remove if unnecessary).
+*
+*              (15) For zero-copy receive, the datagram's packet buffer(s) are dequeued & returned to the
+*                   application instead of being copied & freed by the transport layer.  The application
+*                   MUST free the packet buffer(s) via NetSock_RxDataZeroCopyFree().
+*
+*              (16) For scatter receive, one complete datagram is scattered across the I/O vectors; any
+*                   datagram octets beyond the I/O vectors' total size are discarded (see Note #2b).
+*
+*                   See also 'NetSock_RxDataHandler()  Note #12'.
 *********************************************************************************************************
 */
 
 static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          sock_id,
                                                           NET_SOCK            *p_sock,
                                                           void                *p_data_buf,
+                                                          NET_SOCK_IO_VEC     *p_iov,
+                                                          CPU_INT16U           iov_cnt,
                                                           CPU_INT16U           data_buf_len,
                                                           NET_SOCK_API_FLAGS   flags,
                                                           NET_SOCK_ADDR       *p_addr_remote,
@@ -16939,6 +18957,7 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
                                                           void                *p_ip_opts_buf,
                                                           CPU_INT08U           ip_opts_buf_len,
                                                           CPU_INT08U          *p_ip_opts_len,
+                                                          NET_BUF            **p_buf_zero_copy,
                                                           NET_ERR             *p_err)
 {
 #ifdef  NET_IPv4_MODULE_EN
@@ -17114,14 +19133,31 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
                  DEF_BIT_SET(flags_transport, NET_UDP_FLAG_RX_DATA_PEEK);
              }
 
-             data_len_tot = NetUDP_RxAppData((NET_BUF     *) p_buf_head,
-                                             (void        *) p_data_buf,
-                                             (CPU_INT16U   ) data_buf_len,
-                                             (NET_UDP_FLAGS) flags_transport,
-                                             (void        *) p_ip_opts_buf,
-                                             (CPU_INT08U   ) ip_opts_buf_len,
-                                             (CPU_INT08U  *) p_ip_opts_len,
-                                             (NET_ERR     *)&err);
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+             if (p_buf_zero_copy != (NET_BUF **)0) {            /* Lend pkt buf(s) to app (see Note #15).               */
+                 data_len_tot = NetUDP_RxAppDataZeroCopy(p_buf_head, &err);
+             } else
+#endif
+             if (p_iov != (NET_SOCK_IO_VEC *)0) {               /* Scatter datagram into app iovs (see Note #16).       */
+                 data_len_tot = NetUDP_RxAppDataV((NET_BUF         *) p_buf_head,
+                                                  (NET_SOCK_IO_VEC *) p_iov,
+                                                  (CPU_INT16U       ) iov_cnt,
+                                                  (CPU_INT16U       ) data_buf_len,
+                                                  (NET_UDP_FLAGS    ) flags_transport,
+                                                  (void            *) p_ip_opts_buf,
+                                                  (CPU_INT08U       ) ip_opts_buf_len,
+                                                  (CPU_INT08U      *) p_ip_opts_len,
+                                                  (NET_ERR         *)&err);
+             } else {
+                 data_len_tot = NetUDP_RxAppData((NET_BUF     *) p_buf_head,
+                                                 (void        *) p_data_buf,
+                                                 (CPU_INT16U   ) data_buf_len,
+                                                 (NET_UDP_FLAGS) flags_transport,
+                                                 (void        *) p_ip_opts_buf,
+                                                 (CPU_INT08U   ) ip_opts_buf_len,
+                                                 (CPU_INT08U  *) p_ip_opts_len,
+                                                 (NET_ERR     *)&err);
+             }
              switch (err) {
                  case NET_UDP_ERR_NONE:
                       err_rtn = NET_SOCK_ERR_NONE;
@@ -17210,6 +19246,18 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
 
 
                                                                 /* ---------------- RTN RX'D SOCK DATA ---------------- */
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+    if (p_buf_zero_copy != (NET_BUF **)0) {                     /* If zero-copy rx, ...                                 */
+        if (data_len_tot < 1) {                                 /* ... free empty datagram                      ...     */
+            NetBuf_FreeBufList(p_buf_head, (NET_CTR *)0);
+        } else {
+           *p_buf_zero_copy = p_buf_head;                       /* ... or rtn pkt buf(s) to app (see Note #15).         */
+        }
+    }
+#else
+   (void)&p_buf_zero_copy;                                      /* Prevent 'variable unused' compiler warning.          */
+#endif
+
     if (data_len_tot < 1) {                                     /* If rx'd data len < 1, ...                            */
        *p_err =  NET_SOCK_ERR_RX_Q_EMPTY;                       /* ... rtn rx Q empty err (see Note #7b1).              */
         return (NET_SOCK_BSD_ERR_RX);
@@ -17250,6 +19298,14 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
 *
 *                                   Argument checked   in NetSock_RxDataHandler().
 *
+*               p_iov               Pointer to an array of I/O vectors that will receive the socket's received
+*               -----                  data, if available; NULL pointer, otherwise.
+*
+*                                   Argument checked   in NetSock_RxDataHandler()
+*                                       (see 'NetSock_RxDataHandler()  Note #12').
+*
+*               iov_cnt             Number of I/O vectors in array.
+*
 *               data_buf_len        Size of the   application data buffer (in octets).
 *               ------------        Argument checked   in NetSock_RxDataHandler().
 *
@@ -17283,6 +19339,9 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
 *
 *                                   See Note #4b.
 *
+*               p_buf_zero_copy     Pointer to a variable that will receive the lent segment buffer(s), if
+*               ---------------         zero-copy receive (see Note #13); NULL pointer, otherwise.
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_SOCK_ERR_NONE                   Socket data successfully received; check return
@@ -17421,6 +19480,12 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
 *                          & 'NetSock_SelDescHandlerErrStream()  Note #3'.
 *
 *              (12) 'sock_id' may NOT be necessary but is included for consistency.
+*
+*              (13) For zero-copy receive, the next received TCP segment is lent to the application instead
+*                   of being copied into 'p_data_buf'.  The TCP connection's receive window is NOT re-opened
+*                   until the application releases the segment via NetSock_RxDataZeroCopyFree().
+*
+*                   See also 'net_tcp.c  NetTCP_RxAppDataZeroCopy()  Note #4'.
 *********************************************************************************************************
 */
 
@@ -17428,10 +19493,13 @@ static  NET_SOCK_RTN_CODE  NetSock_RxDataHandlerDatagram (NET_SOCK_ID          s
 NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
                                                 NET_SOCK            *p_sock,
                                                 void                *p_data_buf,
+                                                NET_SOCK_IO_VEC     *p_iov,
+                                                CPU_INT16U           iov_cnt,
                                                 CPU_INT16U           data_buf_len,
                                                 NET_SOCK_API_FLAGS   flags,
                                                 NET_SOCK_ADDR       *p_addr_remote,
                                                 NET_SOCK_ADDR_LEN   *p_addr_len,
+                                                NET_BUF            **p_buf_zero_copy,
                                                 NET_ERR             *p_err)
 {
 #ifdef  NET_IPv4_MODULE_EN
@@ -17598,11 +19666,23 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
                  DEF_BIT_SET(flags_transport, NET_TCP_FLAG_RX_DATA_PEEK);
              }
 
-             data_len_tot = NetTCP_RxAppData(conn_id_transport,
-                                             p_data_buf,
-                                             data_buf_len,
-                                             flags_transport,
-                                            &err);
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+             if (p_buf_zero_copy != (NET_BUF **)0) {            /* Lend rx'd seg to app (see Note #13).                 */
+                 data_len_tot = NetTCP_RxAppDataZeroCopy(conn_id_transport,
+                                                         p_buf_zero_copy,
+                                                         flags_transport,
+                                                        &err);
+             } else
+#endif
+             {
+                 data_len_tot = NetTCP_RxAppData(conn_id_transport,
+                                                 p_data_buf,
+                                                 p_iov,
+                                                 iov_cnt,
+                                                 data_buf_len,
+                                                 flags_transport,
+                                                &err);
+             }
              switch (err) {
                  case NET_TCP_ERR_NONE:
                       err_rtn = NET_SOCK_ERR_NONE;
@@ -17684,10 +19764,21 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 
                                                                 /* ---------------- RTN RX'D SOCK DATA ---------------- */
     if (data_len_tot < 1) {                                     /* If rx'd data len < 1, ...                            */
-       *p_err =  NET_SOCK_ERR_RX_Q_EMPTY;                       /* ... rtn rx Q empty err (see Note #7b1).              */
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+        if (p_buf_zero_copy != (NET_BUF **)0) {                 /* ... rel any empty lent seg                   ...     */
+            if (*p_buf_zero_copy != (NET_BUF *)0) {
+                 NetTCP_RxAppDataZeroCopyFree(conn_id_transport, *p_buf_zero_copy, &err);
+                *p_buf_zero_copy = (NET_BUF *)0;
+            }
+        }
+#endif
+       *p_err =  NET_SOCK_ERR_RX_Q_EMPTY;                       /* ... & rtn rx Q empty err (see Note #7b1).            */
         return (NET_SOCK_BSD_ERR_RX);
     }
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN != DEF_ENABLED)
+   (void)&p_buf_zero_copy;                                      /* Prevent 'variable unused' compiler warning.          */
+#endif
 
    *p_err =   err_rtn;
 
@@ -17715,6 +19806,11 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *
 *               p_data          Pointer to application data to transmit.
 *
+*               p_iov           Pointer to an array of I/O vectors to transmit data from (see Note #8), if
+*                                   available; NULL pointer, otherwise.
+*
+*               iov_cnt         Number of I/O vectors in array.
+*
 *               data_len        Length of  application data to transmit (in octets) [see Note #2].
 *
 *               flags           Flags to select transmit options (see Note #3); bit-field flags logically OR'd :
@@ -17726,6 +19822,9 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *
 *               addr_len        Length of  destination address buffer (in octets).
 *
+*               p_buf_zero_copy Pointer to a variable holding the network buffer to transmit, if zero-copy
+*                                   transmit (see Note #7); NULL pointer, otherwise.
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_ERR_FAULT_NULL_PTR               Argument 'p_data' passed a NULL pointer.
@@ -17797,7 +19896,8 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *               NET_SOCK_BSD_ERR_TX,                        otherwise                   (see Note #5a2A).
 *
 * Caller(s)   : NetSock_TxDataTo(),
-*               NetSock_TxData().
+*               NetSock_TxData(),
+*               NetSock_TxDataV().
 *
 * Note(s)     : (2) (a) (1) (A) Datagram-type sockets transmit & receive all data atomically -- i.e. every
 *                               single, complete datagram transmitted MUST be received as a single, complete
@@ -17881,15 +19981,33 @@ NET_SOCK_RTN_CODE  NetSock_RxDataHandlerStream (NET_SOCK_ID          sock_id,
 *
 *               (6) Default case already invalidated in NetSock_Open().  However, the default case is
 *                   included as an extra precaution in case 'SockType' is incorrectly modified.
+*
+*               (7) For zero-copy transmit, the application data is already in the network buffer pointed
+*                   to by 'p_buf_zero_copy'; thus 'p_data' is NOT used.
+*
+*                   See also 'NetSock_TxDataZeroCopy()  Note #2'.
+*
+*               (8) (a) Gather transmit copies the application data directly from the array of I/O vectors,
+*                       in order, into the transport layer's transmit buffer(s); thus 'p_data' is NOT used &
+*                       'data_len' is the total length of the I/O vectors.
+*
+*                   (b) Secure sockets encrypt application data from a single application buffer; thus
+*                       gather transmit on a secure socket transmits each I/O vector in turn & stops at the
+*                       first I/O vector NOT completely transmitted.
+*
+*                   See also 'NetSock_TxDataV()  Note #2'.
 **********************************************************************************************************
 */
 
 static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
                                                   void                *p_data,
+                                                  NET_SOCK_IO_VEC     *p_iov,
+                                                  CPU_INT16U           iov_cnt,
                                                   CPU_INT16U           data_len,
                                                   NET_SOCK_API_FLAGS   flags,
                                                   NET_SOCK_ADDR       *p_addr_remote,
                                                   NET_SOCK_ADDR_LEN    addr_len,
+                                                  NET_BUF            **p_buf_zero_copy,
                                                   NET_ERR             *p_err)
 {
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN  == DEF_ENABLED)
@@ -17898,6 +20016,10 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
 #endif
 #ifdef  NET_SOCK_TYPE_STREAM_MODULE_EN
    CPU_BOOLEAN         secure;
+#endif
+#ifdef  NET_SECURE_MODULE_EN
+   NET_SOCK_RTN_CODE   rtn_code_iov;
+   CPU_INT16U          data_len_iov;
 #endif
    NET_SOCK           *p_sock;
    NET_SOCK_RTN_CODE   rtn_code;
@@ -17906,7 +20028,9 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
                                                                 /* ----------------- VALIDATE TX DATA ----------------- */
-   if (p_data == (void *)0) {                                   /* Validate data ptr.                                   */
+   if ((p_data          == (void            *)0) &&             /* Validate data ptr (see Notes #7 & #8a).              */
+       (p_iov           == (NET_SOCK_IO_VEC *)0) &&
+       (p_buf_zero_copy == (NET_BUF        **)0)) {
        NET_CTR_ERR_INC(Net_ErrCtrs.Sock.NullPtrCtr);
       *p_err =  NET_ERR_FAULT_NULL_PTR;
        return (NET_SOCK_BSD_ERR_TX);
@@ -17966,9 +20090,12 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
             rtn_code = NetSock_TxDataHandlerDatagram((NET_SOCK_ID       )sock_id,
                                                      (NET_SOCK         *)p_sock,
                                                      (void             *)p_data,
+                                                     (NET_SOCK_IO_VEC  *)p_iov,
+                                                     (CPU_INT16U        )iov_cnt,
                                                      (CPU_INT16U        )data_len,
                                                      (NET_SOCK_API_FLAGS)flags,
                                                      (NET_SOCK_ADDR    *)p_addr_remote,
+                                                     (NET_BUF         **)p_buf_zero_copy,
                                                      (NET_ERR          *)p_err);
             break;
 
@@ -17984,12 +20111,46 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandler (NET_SOCK_ID          sock_id,
                 rtn_code = NetSock_TxDataHandlerStream((NET_SOCK_ID       )sock_id,
                                                        (NET_SOCK         *)p_sock,
                                                        (void             *)p_data,
+                                                       (NET_SOCK_IO_VEC  *)p_iov,
+                                                       (CPU_INT16U        )iov_cnt,
                                                        (CPU_INT16U        )data_len,
                                                        (NET_SOCK_API_FLAGS)flags,
+                                                       (NET_BUF         **)p_buf_zero_copy,
                                                        (NET_ERR          *)p_err);
             }
 #ifdef  NET_SECURE_MODULE_EN                                    /* If sock secure, tx data via secure handler.          */
-              else {
+              else if (p_buf_zero_copy != (NET_BUF **)0) {      /* Secure data MUST be encrypted from app buf.          */
+               NET_CTR_ERR_INC(Net_ErrCtrs.Sock.InvalidOpCtr);
+              *p_err    = NET_SOCK_ERR_INVALID_OP;
+               rtn_code = NET_SOCK_BSD_ERR_TX;
+            } else if (p_iov != (NET_SOCK_IO_VEC *)0) {         /* Tx each iov in turn (see Note #8b).                  */
+                rtn_code = 0;
+                while ((iov_cnt  > 0u) &&
+                       (data_len > 0u)) {
+                    data_len_iov = (CPU_INT16U)DEF_MIN(p_iov->DataLen, data_len);
+                    if (data_len_iov > 0u) {
+                        rtn_code_iov = NetSecure_SockTxDataHandler((NET_SOCK *)p_sock,
+                                                                   (void     *)p_iov->DataPtr,
+                                                                   (CPU_INT16U)data_len_iov,
+                                                                   (NET_ERR  *)p_err);
+                        if (rtn_code_iov <= 0) {                /* On err, rtn any data already tx'd.                   */
+                            if (rtn_code > 0) {
+                               *p_err    = NET_SOCK_ERR_NONE;
+                            } else {
+                                rtn_code = rtn_code_iov;
+                            }
+                            break;
+                        }
+                        rtn_code += rtn_code_iov;
+                        data_len -= (CPU_INT16U)rtn_code_iov;
+                        if (rtn_code_iov < (NET_SOCK_RTN_CODE)data_len_iov) {
+                            break;
+                        }
+                    }
+                    p_iov++;
+                    iov_cnt--;
+                }
+            } else {
                 rtn_code = NetSecure_SockTxDataHandler((NET_SOCK *)p_sock,
                                                        (void     *)p_data,
                                                        (CPU_INT16U)data_len,
@@ -18054,6 +20215,11 @@ exit_release:
 *               p_data          Pointer to application data.
 *               ------          Argument checked   in NetSock_TxDataHandler().
 *
+*               p_iov           Pointer to an array of I/O vectors to transmit data from, if available; NULL
+*               -----               pointer, otherwise (see 'NetSock_TxDataHandler()  Note #8').
+*
+*               iov_cnt         Number of I/O vectors in array.
+*
 *               data_len        Length of  application data (in octets) [see Note #2].
 *               --------        Argument checked   in NetSock_TxDataHandler().
 *
@@ -18068,6 +20234,9 @@ exit_release:
 *               p_addr_remote   Pointer to destination address buffer (see Note #4).
 *               -------------   Argument checked   in NetSock_TxDataHandler().
 *
+*               p_buf_zero_copy Pointer to a variable holding the network buffer to transmit, if zero-copy
+*                                   transmit (see Note #13); NULL pointer, otherwise.
+*
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_SOCK_ERR_NONE                   Socket data successfully transmitted.
@@ -18225,15 +20394,24 @@ exit_release:
 *                   (b) IP transmit options currently NOT implemented
 *
 *              (12) 'sock_id' may NOT be necessary but is included for consistency.
+*
+*              (13) For zero-copy transmit, the application-filled network buffer is transmitted in place.
+*                   The buffer is consumed by the transport layer ONLY if it is queued for transmit; the
+*                   buffer pointer is then cleared.  Otherwise, the application retains the buffer.
+*
+*                   See also 'net_udp.c  NetUDP_TxAppBufHandlerIPv4()  Note #1'.
 *********************************************************************************************************
 */
 
 static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          sock_id,
                                                           NET_SOCK            *p_sock,
                                                           void                *p_data,
+                                                          NET_SOCK_IO_VEC     *p_iov,
+                                                          CPU_INT16U           iov_cnt,
                                                           CPU_INT16U           data_len,
                                                           NET_SOCK_API_FLAGS   flags,
                                                           NET_SOCK_ADDR       *p_addr_remote,
+                                                          NET_BUF            **p_buf_zero_copy,
                                                           NET_ERR             *p_err)
 {
 #ifdef  NET_IPv4_MODULE_EN
@@ -18280,6 +20458,9 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
 
 
    (void)&sock_id;                                              /* Prevent 'variable unused' warning (see Note #12).    */
+#if (NET_SOCK_CFG_ZERO_COPY_EN != DEF_ENABLED)
+   (void)&p_buf_zero_copy;
+#endif
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
                                                                 /* --------------- VALIDATE RTN ERR PTR --------------- */
@@ -18578,8 +20759,27 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
                      }
 #endif
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+                      if (p_buf_zero_copy != (NET_BUF **)0) {   /* Tx app-filled buf (see Note #13).                    */
+                          data_len_tot = NetUDP_TxAppBufHandlerIPv4((NET_BUF         **) p_buf_zero_copy,
+                                                                    (CPU_INT16U        ) data_len,
+                                                                    (NET_IPv4_ADDR     ) src_addrv4,
+                                                                    (NET_UDP_PORT_NBR  ) src_port,
+                                                                    (NET_IPv4_ADDR     ) dest_addrv4,
+                                                                    (NET_UDP_PORT_NBR  ) dest_port,
+                                                                    (NET_IPv4_TOS      ) TOS,
+                                                                    (NET_IPv4_TTL      ) TTL,
+                                                                    (NET_UDP_FLAGS     ) flags_transport,
+                                                                    (NET_IPv4_FLAGS    ) flags_ipv4,
+                                                                    (void             *) 0,
+                                                                    (NET_ERR          *)&err);
+                          break;
+                      }
+#endif
                                                                 /* See Note #11b.                                       */
                       data_len_tot = NetUDP_TxAppDataHandlerIPv4((void            *) p_data,
+                                                                 (NET_SOCK_IO_VEC *) p_iov,
+                                                                 (CPU_INT16U       ) iov_cnt,
                                                                  (CPU_INT16U       ) data_len,
                                                                  (NET_IPv4_ADDR    ) src_addrv4,
                                                                  (NET_UDP_PORT_NBR ) src_port,
@@ -18620,8 +20820,26 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
                      }
 #endif
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+                      if (p_buf_zero_copy != (NET_BUF **)0) {   /* Tx app-filled buf (see Note #13).                    */
+                          data_len_tot = NetUDP_TxAppBufHandlerIPv6((NET_BUF              **) p_buf_zero_copy,
+                                                                    (CPU_INT16U             ) data_len,
+                                                                    (NET_IPv6_ADDR         *)&src_addrv6,
+                                                                    (NET_UDP_PORT_NBR       ) src_port,
+                                                                    (NET_IPv6_ADDR         *)&dest_addrv6,
+                                                                    (NET_UDP_PORT_NBR       ) dest_port,
+                                                                    (NET_IPv6_TRAFFIC_CLASS ) traffic_class,
+                                                                    (NET_IPv6_FLOW_LABEL    ) flow_label,
+                                                                    (NET_IPv6_HOP_LIM       ) hop_lim,
+                                                                    (NET_UDP_FLAGS          ) flags_transport,
+                                                                    (NET_ERR               *)&err);
+                          break;
+                      }
+#endif
                                                                 /* See Note #11b.                                       */
                       data_len_tot = NetUDP_TxAppDataHandlerIPv6((void                 *) p_data,
+                                                                 (NET_SOCK_IO_VEC      *) p_iov,
+                                                                 (CPU_INT16U            ) iov_cnt,
                                                                  (CPU_INT16U            ) data_len,
                                                                  (NET_IPv6_ADDR        *)&src_addrv6,
                                                                  (NET_UDP_PORT_NBR      ) src_port,
@@ -18742,6 +20960,11 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
 *               p_data          Pointer to application data.
 *               ------          Argument checked   in NetSock_TxDataHandler().
 *
+*               p_iov           Pointer to an array of I/O vectors to transmit data from, if available; NULL
+*               -----               pointer, otherwise (see 'NetSock_TxDataHandler()  Note #8').
+*
+*               iov_cnt         Number of I/O vectors in array.
+*
 *               data_len        Length of  application data (in octets) [see Note #3].
 *               --------        Argument checked   in NetSock_TxDataHandler().
 *
@@ -18753,6 +20976,9 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
 *
 *                               Argument checked   in NetSock_TxDataHandler().
 *
+*               p_buf_zero_copy Pointer to a variable holding the network buffer to transmit, if zero-copy
+*                                   transmit (see Note #10); NULL pointer, otherwise.
+*
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
 *                               NET_SOCK_ERR_NONE                   Socket data successfully transmitted.
@@ -18900,6 +21126,12 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
 *                          & 'NetSock_SelDescHandlerErrStream()  Note #3'.
 *
 *               (9) 'sock_id' may NOT be necessary but is included for consistency.
+*
+*              (10) For zero-copy transmit, the application-filled network buffer is queued as a single TCP
+*                   segment.  The buffer pointer is cleared once the segment is queued; otherwise, the
+*                   application retains the buffer.
+*
+*                   See also 'net_tcp.c  NetTCP_TxConnAppBuf()  Note #1'.
 *********************************************************************************************************
 */
 
@@ -18907,8 +21139,11 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
 NET_SOCK_RTN_CODE  NetSock_TxDataHandlerStream (NET_SOCK_ID          sock_id,
                                                 NET_SOCK            *p_sock,
                                                 void                *p_data,
+                                                NET_SOCK_IO_VEC     *p_iov,
+                                                CPU_INT16U           iov_cnt,
                                                 CPU_INT16U           data_len,
                                                 NET_SOCK_API_FLAGS   flags,
+                                                NET_BUF            **p_buf_zero_copy,
                                                 NET_ERR             *p_err)
 {
     CPU_BOOLEAN         no_block;
@@ -18923,6 +21158,9 @@ NET_SOCK_RTN_CODE  NetSock_TxDataHandlerStream (NET_SOCK_ID          sock_id,
 
 
    (void)&sock_id;                                              /* Prevent 'variable unused' warning (see Note #9).     */
+#if (NET_SOCK_CFG_ZERO_COPY_EN != DEF_ENABLED)
+   (void)&p_buf_zero_copy;
+#endif
 
                                                                 /* ------------- VALIDATE SOCK CONN STATE ------------- */
     switch (p_sock->State) {
@@ -19018,11 +21256,24 @@ NET_SOCK_RTN_CODE  NetSock_TxDataHandlerStream (NET_SOCK_ID          sock_id,
                  DEF_BIT_SET(flags_transport, NET_TCP_FLAG_TX_BLOCK);
              }
 
-             data_len_tot = NetTCP_TxConnAppData((NET_TCP_CONN_ID) conn_id_transport,
-                                                 (void          *) p_data,
-                                                 (CPU_INT16U     ) data_len,
-                                                 (NET_TCP_FLAGS  ) flags_transport,
-                                                 (NET_ERR       *)&err);
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+             if (p_buf_zero_copy != (NET_BUF **)0) {            /* Q app-filled buf as seg (see Note #10).              */
+                 data_len_tot = NetTCP_TxConnAppBuf((NET_TCP_CONN_ID) conn_id_transport,
+                                                    (NET_BUF      **) p_buf_zero_copy,
+                                                    (CPU_INT16U     ) data_len,
+                                                    (NET_TCP_FLAGS  ) flags_transport,
+                                                    (NET_ERR       *)&err);
+             } else
+#endif
+             {
+                 data_len_tot = NetTCP_TxConnAppData((NET_TCP_CONN_ID  ) conn_id_transport,
+                                                     (void            *) p_data,
+                                                     (NET_SOCK_IO_VEC *) p_iov,
+                                                     (CPU_INT16U       ) iov_cnt,
+                                                     (CPU_INT16U       ) data_len,
+                                                     (NET_TCP_FLAGS    ) flags_transport,
+                                                     (NET_ERR         *)&err);
+             }
              switch (err) {
                  case NET_TCP_ERR_NONE:
                       err_rtn = NET_SOCK_ERR_NONE;
@@ -21872,7 +24123,7 @@ static  void  NetSock_CloseConnFree (NET_CONN_ID  conn_id)
 *               NetSock_CloseHandler(),
 *               NetSock_CloseHandlerStream().
 *
-* Note(s)     : none.
+* Note(s)     : (1) A freed socket is removed from every socket event set it is registered on.
 *********************************************************************************************************
 */
 
@@ -21900,6 +24151,12 @@ static  void  NetSock_Free (NET_SOCK  *p_sock)
     p_sock->SecureSession = (void *)0;                          /* Clr secure session.                                  */
 #endif
 
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+    while (p_sock->EventRegListPtr != DEF_NULL) {               /* Free sock's event set regs (see Note #1).            */
+        NetSock_EventSetRegFree(p_sock, p_sock->EventRegListPtr);
+    }
+#endif
+
     p_sock->State = NET_SOCK_STATE_FREE;                        /* Set sock as freed/NOT used.                          */
     DEF_BIT_CLR(p_sock->Flags, NET_SOCK_FLAG_SOCK_USED);
     p_sock->ShutdownMode = NET_SOCK_SHUTDOWN_MODE_NONE;
@@ -22097,6 +24354,9 @@ static  void  NetSock_Clr (NET_SOCK  *p_sock)
     p_sock->NextPtr             = (NET_SOCK         *)0;
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
     p_sock->SelObjTailPtr       = (NET_SOCK_SEL_OBJ *)0;
+#endif
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+    p_sock->EventRegListPtr     = (NET_SOCK_EVENT_REG *)0;
 #endif
     p_sock->RxQ_Head            = (NET_BUF          *)0;
     p_sock->RxQ_Tail            = (NET_BUF          *)0;
@@ -22223,6 +24483,51 @@ static  void  NetSock_Discard (NET_SOCK  *p_sock)
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetSock_IO_VecLenGet()
+*
+* Description : Get the total data length of an array of I/O vectors.
+*
+* Argument(s) : p_iov       Pointer to an array of I/O vectors.
+*
+*               iov_cnt     Number of I/O vectors in array.
+*
+* Return(s)   : Total length of I/O vectors' data buffers (in octets), limited to the maximum socket
+*                   data length (see Note #1).
+*
+* Caller(s)   : NetSock_RxDataV(),
+*               NetSock_TxDataV().
+*
+* Note(s)     : (1) Socket receives & transmits are limited to 16-bit data lengths; any I/O vector data
+*                   beyond the maximum length is NOT received into nor transmitted from.
+*
+*               (2) I/O vectors with a NULL data pointer are treated as zero-length.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetSock_IO_VecLenGet (NET_SOCK_IO_VEC  *p_iov,
+                                          CPU_INT16U        iov_cnt)
+{
+    CPU_SIZE_T  len_tot;
+    CPU_INT16U  i;
+
+
+    len_tot = 0u;
+    for (i = 0u; i < iov_cnt; i++) {
+        if (p_iov[i].DataPtr == (void *)0) {                    /* See Note #2.                                         */
+            continue;
+        }
+        if (p_iov[i].DataLen >= (DEF_INT_16U_MAX_VAL - len_tot)) {
+            return (DEF_INT_16U_MAX_VAL);                       /* Limit tot len (see Note #1).                         */
+        }
+        len_tot += p_iov[i].DataLen;
+    }
+
+    return ((CPU_INT16U)len_tot);
+}
+
+
 /*
 *********************************************************************************************************
 *                                     NetSock_RandomPortNbrGet()
@@ -22644,6 +24949,7 @@ exit:
 *                       NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
 *                       NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
 *                                                                                                          value (in seconds)
+*                       NET_SOCK_OPT_TCP_CONG_CTRL      NET_TCP_CONG_CTRL_ALGO  TCP congestion control algorithm
 *********************************************************************************************************
 */
 
@@ -22671,6 +24977,7 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
            CPU_INT16U         *p_int16u_val;
            CPU_INT32U         *p_int32u_val;
            CPU_BOOLEAN        *p_bool_val;
+           NET_TCP_WIN_SIZE    win_size;
 #endif
                                                                 /* -------------- VALIDATE OPTION LEVEL --------------- */
     switch(opt_name) {
@@ -22689,6 +24996,7 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
         case NET_SOCK_OPT_TCP_KEEP_CNT:
         case NET_SOCK_OPT_TCP_KEEP_IDLE:
         case NET_SOCK_OPT_TCP_KEEP_INTVL:
+        case NET_SOCK_OPT_TCP_CONG_CTRL:
              if (level != NET_SOCK_PROTOCOL_TCP) {
                 *p_err =   NET_SOCK_ERR_INVALID_OPT_LEVEL;
                  goto exit_lock_fault;                          /* Sock opt incompatible with protocol level.           */
@@ -22771,15 +25079,21 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
 
 
                          case NET_SOCK_OPT_SOCK_TX_BUF_SIZE:
-                              if (opt_len != sizeof(NET_TCP_WIN_SIZE)) {
+                                                                /* Accept 16-bit or 32-bit win size val.                */
+                              if (opt_len == sizeof(CPU_INT16U)) {
+                                  p_int16u_val = (CPU_INT16U *)p_opt_val;
+                                  win_size     = (NET_TCP_WIN_SIZE)*p_int16u_val;
+                              } else if (opt_len == sizeof(NET_TCP_WIN_SIZE)) {
+                                  p_int32u_val = (CPU_INT32U *)p_opt_val;
+                                  win_size     = (NET_TCP_WIN_SIZE)*p_int32u_val;
+                              } else {
                                  *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
                                   break;
                               }
 
-                              p_int16u_val = (CPU_INT16U *)p_opt_val;
-                             (void)NetTCP_ConnCfgTxWinSizeHandler(                   conn_id_transport,
-                                                                  (NET_TCP_WIN_SIZE)*p_int16u_val,
-                                                                                     p_err);
+                             (void)NetTCP_ConnCfgTxWinSizeHandler(conn_id_transport,
+                                                                  win_size,
+                                                                  p_err);
                               if (*p_err == NET_TCP_ERR_NONE) {
                                   *p_err  = NET_SOCK_ERR_NONE;
                               }
@@ -22803,15 +25117,21 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
 
 
                          case NET_SOCK_OPT_SOCK_RX_BUF_SIZE:
-                              if (opt_len != sizeof(NET_TCP_WIN_SIZE)) {
+                                                                /* Accept 16-bit or 32-bit win size val.                */
+                              if (opt_len == sizeof(CPU_INT16U)) {
+                                  p_int16u_val = (CPU_INT16U *)p_opt_val;
+                                  win_size     = (NET_TCP_WIN_SIZE)*p_int16u_val;
+                              } else if (opt_len == sizeof(NET_TCP_WIN_SIZE)) {
+                                  p_int32u_val = (CPU_INT32U *)p_opt_val;
+                                  win_size     = (NET_TCP_WIN_SIZE)*p_int32u_val;
+                              } else {
                                  *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
                                   break;
                               }
 
-                              p_int16u_val = (CPU_INT16U *)p_opt_val;
-                             (void)NetTCP_ConnCfgRxWinSizeHandler(                   conn_id_transport,
-                                                                  (NET_TCP_WIN_SIZE)*p_int16u_val,
-                                                                                     p_err);
+                             (void)NetTCP_ConnCfgRxWinSizeHandler(conn_id_transport,
+                                                                  win_size,
+                                                                  p_err);
                               if (*p_err == NET_TCP_ERR_NONE) {
                                   *p_err  = NET_SOCK_ERR_NONE;
                               }
@@ -22898,6 +25218,21 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (       NET_SOCK_ID         sock_id,
                               break;
 
 
+                         case NET_SOCK_OPT_TCP_CONG_CTRL:
+                              if (opt_len != sizeof(NET_TCP_CONG_CTRL_ALGO)) {
+                                 *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                                  break;
+                              }
+
+                             (void)NetTCP_ConnCfgCongCtrlHandler((NET_TCP_CONN_ID       ) conn_id_transport,
+                                                                *(NET_TCP_CONG_CTRL_ALGO *)p_opt_val,
+                                                                                          p_err);
+                              if (*p_err == NET_TCP_ERR_NONE) {
+                                  *p_err  = NET_SOCK_ERR_NONE;
+                              }
+                              break;
+
+
                          default:                               /* Unsupported options.                                 */
                              *p_err = NET_SOCK_ERR_INVALID_OP;
                               break;
@@ -644,6 +644,7 @@ typedef  enum  net_sock_opt_name {
     NET_SOCK_OPT_TCP_KEEP_CNT                = TCP_KEEPCNT,
     NET_SOCK_OPT_TCP_KEEP_IDLE               = TCP_KEEPIDLE,
     NET_SOCK_OPT_TCP_KEEP_INTVL              = TCP_KEEPINTVL,
+    NET_SOCK_OPT_TCP_CONG_CTRL               = TCP_CONGESTION,
 
     NET_SOCK_OPT_IP_TOS                      = IP_TOS,
     NET_SOCK_OPT_IP_TTL                      = IP_TTL,
@@ -788,6 +789,19 @@ typedef  struct  net_sock_accept_q_obj {
 } NET_SOCK_ACCEPT_Q_OBJ;
 
 
+/*
+*********************************************************************************************************
+*                                  NETWORK SOCKET I/O VECTOR DATA TYPE
+*
+* Note(s) : (1) Socket I/O vectors describe scattered application data areas for NetSock_TxDataV() &
+*               NetSock_RxDataV(); the data is copied directly between the I/O vectors & the network
+*               buffers (see 'net_buf.h  NETWORK BUFFER I/O VECTOR DATA TYPE').
+*********************************************************************************************************
+*/
+
+typedef  NET_BUF_IO_VEC  NET_SOCK_IO_VEC;
+
+
 /*
 *********************************************************************************************************
 *                                   NETWORK SOCKET SEL EVENT DATA TYPES
@@ -815,6 +829,58 @@ typedef  CPU_INT08U  NET_SOCK_SEL_EVENT_FLAG;
 #define  NET_SOCK_SEL_EVENT_FLAG_ERR            DEF_BIT_02
 
 
+/*
+*********************************************************************************************************
+*                                  NETWORK SOCKET EVENT SET DATA TYPES
+*
+* Note(s) : (1) (a) A socket event set is a persistent set of socket registrations, each with its own
+*                   requested events (NET_SOCK_SEL_EVENT_FLAG_&&&).
+*
+*               (b) Each registration is linked both on its socket's registration list & on its event set's
+*                   ready list whenever NetSock_SelPost() signals one of its requested events, so that
+*                   NetSock_EventSetWait() only re-checks the sockets signaled since the last wait.
+*
+*           (2) 'IsRdy' is set while a registration is linked on its event set's ready list.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+typedef  enum  net_sock_event_set_op {
+    NET_SOCK_EVENT_SET_OP_ADD,
+    NET_SOCK_EVENT_SET_OP_MOD,
+    NET_SOCK_EVENT_SET_OP_DEL
+} NET_SOCK_EVENT_SET_OP;
+
+
+typedef  struct  net_sock_event_set  NET_SOCK_EVENT_SET;
+typedef  struct  net_sock_event_reg  NET_SOCK_EVENT_REG;
+
+struct  net_sock_event_reg {
+        NET_SOCK_EVENT_SET       *SetPtr;                               /* Ptr to reg's event set.                      */
+        NET_SOCK_ID               SockID;                               /* Reg'd sock ID.                               */
+        NET_SOCK_SEL_EVENT_FLAG   EventsReq;                            /* Req'd events.                                */
+        CPU_BOOLEAN               IsRdy;                                /* Indicate if reg on rdy list (see Note #2).   */
+        NET_SOCK_EVENT_REG       *SockNextPtr;                          /* Ptr to next reg on sock's reg list.          */
+        NET_SOCK_EVENT_REG       *RdyNextPtr;                           /* Ptr to next reg on set's  rdy list.          */
+};
+
+struct  net_sock_event_set {
+        KAL_SEM_HANDLE            SignalObj;                            /* Wait signal.                                 */
+        CPU_BOOLEAN               WaitPending;                          /* Indicate if a task waits on set.             */
+        NET_SOCK_QTY              RegCnt;                               /* Nbr of reg'd socks.                          */
+        NET_SOCK_QTY              RdyCnt;                               /* Nbr of regs on rdy list.                     */
+        NET_SOCK_EVENT_REG       *RdyHeadPtr;                           /* Ptr to head of rdy list.                     */
+        NET_SOCK_EVENT_REG       *RdyTailPtr;                           /* Ptr to tail of rdy list.                     */
+};
+
+
+typedef  struct  net_sock_event {                                       /* Event rtn'd by NetSock_EventSetWait().       */
+    NET_SOCK_ID                   SockID;
+    NET_SOCK_SEL_EVENT_FLAG       Events;
+} NET_SOCK_EVENT;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      NETWORK SOCKET DATA TYPE
@@ -864,6 +930,9 @@ struct  net_sock {
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
     NET_SOCK_SEL_OBJ           *SelObjTailPtr;
 #endif
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+    NET_SOCK_EVENT_REG         *EventRegListPtr;                        /* Ptr to sock's event set reg list.            */
+#endif
 
     KAL_SEM_HANDLE              RxQ_SignalObj;
     CPU_INT32U                  RxQ_SignalTimeout_ms;
@@ -1242,6 +1311,63 @@ NET_SOCK_RTN_CODE   NetSock_TxData                       (       NET_SOCK_ID
                                                                  NET_SOCK_API_FLAGS             flags,
                                                                  NET_ERR                       *p_err);
 
+
+NET_SOCK_RTN_CODE   NetSock_RxDataV                      (       NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_IO_VEC               *p_iov,
+                                                                 CPU_INT16U                     iov_cnt,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN             *p_addr_len,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_TxDataV                      (       NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_IO_VEC               *p_iov,
+                                                                 CPU_INT16U                     iov_cnt,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN              addr_len,
+                                                                 NET_ERR                       *p_err);
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_SOCK_RTN_CODE   NetSock_RxDataZeroCopy               (       NET_SOCK_ID                    sock_id,
+                                                                 NET_BUF                      **p_buf,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN             *p_addr_len,
+                                                                 NET_ERR                       *p_err);
+
+
+void                NetSock_RxDataZeroCopyFree           (       NET_SOCK_ID                    sock_id,
+                                                                 NET_BUF                       *p_buf,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_BUF            *NetSock_ZeroCopyBufDataGet           (       NET_BUF                       *p_buf,
+                                                                 CPU_INT08U                   **p_data,
+                                                                 CPU_INT16U                    *p_data_len,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_BUF            *NetSock_TxDataZeroCopyBufGet         (       NET_SOCK_ID                    sock_id,
+                                                                 CPU_INT16U                    *p_data_len,
+                                                                 CPU_INT08U                   **p_data,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_TxDataZeroCopy               (       NET_SOCK_ID                    sock_id,
+                                                                 NET_BUF                      **p_buf,
+                                                                 CPU_INT16U                     data_len,
+                                                                 NET_SOCK_API_FLAGS             flags,
+                                                                 NET_SOCK_ADDR                 *p_addr_remote,
+                                                                 NET_SOCK_ADDR_LEN              addr_len,
+                                                                 NET_ERR                       *p_err);
+
+
+void                NetSock_TxDataZeroCopyBufFree        (       NET_BUF                       *p_buf,
+                                                                 NET_ERR                       *p_err);
+#endif
+
 #if (NET_SOCK_CFG_SEL_EN == DEF_ENABLED)
 NET_SOCK_RTN_CODE   NetSock_Sel                          (       NET_SOCK_QTY                   sock_nbr_max,
                                                                  NET_SOCK_DESC                 *psock_desc_rd,
@@ -1255,6 +1381,28 @@ void                NetSock_SelAbort                     (       NET_SOCK_ID
                                                                  NET_ERR                       *p_err);
 #endif /* NET_SOCK_CFG_SEL_EN */
 
+#if (NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED)
+NET_SOCK_EVENT_SET *NetSock_EventSetCreate               (       NET_ERR                       *p_err);
+
+
+void                NetSock_EventSetDel                  (       NET_SOCK_EVENT_SET            *p_set,
+                                                                 NET_ERR                       *p_err);
+
+
+void                NetSock_EventSetCtl                  (       NET_SOCK_EVENT_SET            *p_set,
+                                                                 NET_SOCK_EVENT_SET_OP          op,
+                                                                 NET_SOCK_ID                    sock_id,
+                                                                 NET_SOCK_SEL_EVENT_FLAG        events,
+                                                                 NET_ERR                       *p_err);
+
+
+NET_SOCK_RTN_CODE   NetSock_EventSetWait                 (       NET_SOCK_EVENT_SET            *p_set,
+                                                                 NET_SOCK_EVENT                *p_events,
+                                                                 NET_SOCK_QTY                   events_max,
+                                                                 CPU_INT32U                     timeout_ms,
+                                                                 NET_ERR                       *p_err);
+#endif /* NET_SOCK_CFG_EVENT_SET_EN */
+
 CPU_BOOLEAN         NetSock_IsConn                       (       NET_SOCK_ID                    sock_id,
                                                                  NET_ERR                       *p_err);
 
@@ -1485,18 +1633,24 @@ void                NetSock_ConnSignalClose              (       NET_SOCK_ID
 NET_SOCK_RTN_CODE   NetSock_RxDataHandlerStream          (       NET_SOCK_ID                    sock_id,
                                                                  NET_SOCK                      *psock,
                                                                  void                          *pdata_buf,
+                                                                 NET_SOCK_IO_VEC               *p_iov,
+                                                                 CPU_INT16U                     iov_cnt,
                                                                  CPU_INT16U                     data_buf_len,
                                                                  NET_SOCK_API_FLAGS             flags,
                                                                  NET_SOCK_ADDR                 *paddr_remote,
                                                                  NET_SOCK_ADDR_LEN             *paddr_len,
+                                                                 NET_BUF                      **p_buf_zero_copy,
                                                                  NET_ERR                       *p_err);
 
 
 NET_SOCK_RTN_CODE   NetSock_TxDataHandlerStream          (       NET_SOCK_ID                    sock_id,
                                                                  NET_SOCK                      *psock,
                                                                  void                          *p_data,
+                                                                 NET_SOCK_IO_VEC               *p_iov,
+                                                                 CPU_INT16U                     iov_cnt,
                                                                  CPU_INT16U                     data_len,
                                                                  NET_SOCK_API_FLAGS             flags,
+                                                                 NET_BUF                      **p_buf_zero_copy,
                                                                  NET_ERR                       *p_err);
 #endif /* NET_SOCK_TYPE_STREAM_MODULE_EN */
 
@@ -1660,6 +1814,28 @@ CPU_INT32U          NetSock_ConnCloseTimeoutGet_ms   (NET_SOCK     *p_sock,
 #endif
 
 
+#if    ((NET_SOCK_CFG_EVENT_SET_EN != DEF_DISABLED) && \
+        (NET_SOCK_CFG_EVENT_SET_EN != DEF_ENABLED ))
+#error  "NET_SOCK_CFG_EVENT_SET_EN            illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  DEF_DISABLED]           "
+#error  "                                     [     ||  DEF_ENABLED ]           "
+
+#elif   ((NET_SOCK_CFG_EVENT_SET_EN == DEF_ENABLED) && \
+         (NET_SOCK_CFG_SEL_EN       != DEF_ENABLED))
+#error  "NET_SOCK_CFG_EVENT_SET_EN            illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  DEF_DISABLED    when    ]"
+#error  "                                     [NET_SOCK_CFG_SEL_EN DEF_DISABLED]"
+#endif
+
+
+#if    ((NET_SOCK_CFG_ZERO_COPY_EN != DEF_DISABLED) && \
+        (NET_SOCK_CFG_ZERO_COPY_EN != DEF_ENABLED ))
+#error  "NET_SOCK_CFG_ZERO_COPY_EN            illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  DEF_DISABLED]           "
+#error  "                                     [     ||  DEF_ENABLED ]           "
+#endif
+
+
 #ifndef  NET_SOCK_CFG_RX_Q_SIZE_OCTET
 #error  "NET_SOCK_CFG_RX_Q_SIZE_OCTET               not #define'd in 'net_cfg.h'  "
 #error  "                                     [MUST be  >= NET_SOCK_DATA_SIZE_MIN]"
@@ -35,13 +35,18 @@
 *                (c) The following TCP options NOT supported :
 *
 *                    (1) Window Scale                                      RFC #1072, Section 2
-*                                                                          RFC #1323, Section 2
+*                            NOT supported if NET_TCP_CFG_WIN_SCALE_EN     RFC #1323, Section 2
+*                            is DEF_DISABLED                               RFC #7323, Section 2
 *                    (2) Selective Acknowledgement (SACK)                  RFC #1072, Section 3
-*                                                                          RFC #2018
-*                                                                          RFC #2883
+*                            NOT supported if NET_TCP_CFG_SACK_EN          RFC #2018
+*                            is DEF_DISABLED                               RFC #2883
 *                    (3) TCP Echo                                          RFC #1072, Section 4
 *                    (4) Timestamp                                         RFC #1323, Section 3.2
+*                            NOT supported if NET_TCP_CFG_TS_EN            RFC #7323, Section 3
+*                            is DEF_DISABLED
 *                    (5) Protection Against Wrapped Sequences (PAWS)       RFC #1323, Section 4
+*                            NOT supported if NET_TCP_CFG_TS_EN            RFC #7323, Section 5
+*                            is DEF_DISABLED
 *
 *                (d) IP-Options-to-TCP-Connection                          RFC #1122, Section 4.2.3.8
 *                           Handling NOT supported #### NET-804
@@ -399,13 +404,29 @@
 *               RFC #793, Section 3.7 'Data Communication : Managing the Window' states that for "the
 *               window ... there is an assumption that this is related to the currently available data
 *               buffer space available for this connection".
+*
+*           (2) (a) The TCP header window field is 16 bits wide.  When the TCP Window Scale option is
+*                   negotiated, window sizes are encoded in TCP headers right-shifted by the window scale
+*                   shift count (see RFC #7323, Section 2.3).
+*
+*               (b) RFC #7323, Section 2.3 states that "the maximum scale exponent is limited to 14 for a
+*                   maximum permissible receive window size of 1 GiB (2^(14+16))".
 *********************************************************************************************************
 */
 
 #define  NET_TCP_WIN_SIZE_NONE                             0
 
 #define  NET_TCP_WIN_SIZE_MIN                            NET_TCP_MAX_SEG_SIZE_MIN
-#define  NET_TCP_WIN_SIZE_MAX                            DEF_INT_16U_MAX_VAL
+#define  NET_TCP_WIN_SIZE_HDR_MAX                        DEF_INT_16U_MAX_VAL   /* Max TCP hdr win field (see Note #2a). */
+
+#define  NET_TCP_WIN_SCALE_NONE                            0
+#define  NET_TCP_WIN_SCALE_MAX                            14                    /* See Note #2b.                         */
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+#define  NET_TCP_WIN_SIZE_MAX                          (NET_TCP_WIN_SIZE_HDR_MAX << NET_TCP_WIN_SCALE_MAX)
+#else
+#define  NET_TCP_WIN_SIZE_MAX                            NET_TCP_WIN_SIZE_HDR_MAX
+#endif
 
 
 /*
@@ -471,6 +492,19 @@
 *
 *           (4) 'NET_TCP_OPT_SIZE'  MUST be pre-defined PRIOR to all definitions that require TCP option
 *                size data type.
+*
+*           (5) Each SACK block is 8 octets.  Since SACK options are transmitted preceded by two NOP options
+*               to 32-bit align the blocks, at most 4 blocks fit within the 40-octet TCP option list
+*               (see RFC #2018, Section 3) :
+*
+*                   2 NOP octets + 2 SACK type/len octets + (4 * 8 SACK block octets) = 36 octets
+*
+*           (6) The Window Scale option is transmitted preceded by one NOP option & the Timestamps option
+*               preceded by two NOP options to keep the TCP option list word-aligned (see RFC #7323,
+*               Appendix A).  Since the Timestamps option is sent on every segment once negotiated, at
+*               most 3 SACK blocks fit with it within the 40-octet TCP option list :
+*
+*                   12 TS octets + 2 NOP octets + 2 SACK type/len octets + (3 * 8 SACK block octets) = 40
 *********************************************************************************************************
 */
 
@@ -498,6 +532,13 @@
 
 #define  NET_TCP_HDR_OPT_LEN_SACK_MIN                      6
 #define  NET_TCP_HDR_OPT_LEN_SACK_MAX                     38
+#define  NET_TCP_HDR_OPT_LEN_SACK_BLK                      8    /* SACK blk : 32-bit left & right edges (see Note #5).  */
+
+#define  NET_TCP_HDR_OPT_SACK_BLK_NBR_MAX                  4    /* Max nbr of SACK blks per seg         (see Note #5).  */
+#define  NET_TCP_HDR_OPT_SACK_BLK_NBR_MAX_TS               3    /* Max nbr of SACK blks per seg with TS (see Note #6).  */
+
+#define  NET_TCP_HDR_OPT_LEN_WIN_SCALE_PAD                 4    /* NOP      + win scale opt             (see Note #6).  */
+#define  NET_TCP_HDR_OPT_LEN_TS_PAD                       12    /* NOP, NOP + TS        opt             (see Note #6).  */
 
 #define  NET_TCP_HDR_OPT_LEN_MIN                           1
 #define  NET_TCP_HDR_OPT_LEN_MIN_LEN                       2
@@ -607,6 +648,20 @@ typedef  enum  net_tcp_opt_type {
                                                   75                             )  /* ... dflt = 675 sec (see Note #3a)*/
 
 
+/*
+*********************************************************************************************************
+*                                      TCP TIMESTAMPS DEFINES
+*
+* Note(s) : (1) RFC #7323, Section 5.5 states that "if a connection remains idle for more than 2**31
+*               ticks of the timestamp clock ... TS.Recent ... [is] invalidated ... an implementation ...
+*               [may] set ... a limit of 24 days".
+*********************************************************************************************************
+*/
+
+                                                                /* Max TS.Recent age = 24 days (see Note #1).           */
+#define  NET_TCP_TS_RECENT_AGE_MAX_MS           (24u * DEF_TIME_NBR_SEC_PER_DAY * DEF_TIME_NBR_mS_PER_SEC)
+
+
 /*
 *********************************************************************************************************
 *                              TCP CONNECTION KEEP-ALIVE & PROBE DEFINES
@@ -721,6 +776,8 @@ typedef  enum  net_tcp_opt_type {
 #define  NET_TCP_CONN_TX_WIN_CONG_SET_SLOW_START         165u   /* Set         tx cong   win size to slow start    th.  */
 #define  NET_TCP_CONN_TX_WIN_CONG_SET_FAST_RECOVERY      166u   /* Set         tx cong   win size to fast recovery th.  */
 #define  NET_TCP_CONN_TX_WIN_CONG_SET_TIMEOUT            167u   /* Set         tx cong   win size to timeout       th.  */
+#define  NET_TCP_CONN_TX_WIN_CONG_SET_RECOVERY_EXIT      168u   /* Set         tx cong   win size on  recovery exit.    */
+#define  NET_TCP_CONN_TX_WIN_CONG_SET_PARTIAL_ACK        169u   /* Deflate     tx cong   win size on  partial ack.      */
 
 #define  NET_TCP_CONN_TX_RTT_RESET                       170u   /* Reset    tx RTT     ctrls.                           */
 #define  NET_TCP_CONN_TX_RTT_RTO_INIT                    171u   /* Init     tx RTT/RTO ctrls.                           */
@@ -1010,6 +1067,86 @@ typedef  enum  net_tcp_opt_type {
                                                                                 /* .. M + 1 for validation purposes.    */
 
 
+/*
+*********************************************************************************************************
+*                              TCP CONGESTION CONTROL ALGORITHM DEFINES
+*
+* Note(s) : (1) TCP connections' congestion avoidance policy is selected per connection from a table of
+*               congestion control algorithms (see 'TCP CONGESTION CONTROL API DATA TYPE').  Slow start,
+*               fast re-transmit & fast recovery remain common to ALL algorithms.
+*
+*               (a) NewReno   RFC #5681 & RFC #6582                                 See Note #2
+*               (b) CUBIC     RFC #8312                                             See Note #3
+*               (c) User      Application-registered algorithm (see 'net_tcp.c  NetTCP_CongCtrlReg()')
+*
+*           (2) RFC #6582, Section 3.2 states that "the value of recover is incremented to the value of the
+*               highest sequence number transmitted" when entering fast recovery & that fast recovery ends
+*               only on a "full acknowledgment", i.e. one that "acknowledges all of the data up to and
+*               including recover".  Any "partial acknowledgment" re-transmits the first unacknowledged
+*               segment & "deflate[s] the congestion window by the amount of new data acknowledged".
+*
+*           (3) RFC #8312, Section 4.1 grows the congestion window along a cubic function of the time
+*               elapsed since the last congestion event :
+*
+*                   (a) W_cubic(t)  =  C * (t - K)^3  +  W_max
+*
+*                   (b) K           =  cubic_root(W_max * (1 - beta_cubic) / C)
+*
+*                       (1) Since the congestion window starts each epoch at 'W_max * beta_cubic', K is
+*                           equivalently computed from the actual window at the start of the epoch :
+*
+*                               K  =  cubic_root((W_max - cwnd_epoch) / C)
+*
+*                           where
+*                                   C               Scaling constant  (RFC #8312, Section 5 : 0.4)
+*                                   beta_cubic      Multiplicative window decrease factor  (0.7)
+*                                   W_max           Window size just before the last reduction (in MSS)
+*                                   t, K            Elapsed time & time to reach W_max (in seconds)
+*
+*               (c) RFC #8312, Section 4.2 also limits CUBIC to no less than the window that a standard
+*                   TCP would reach ("TCP-friendly region") :
+*
+*                   W_est(t)  =  W_max * beta_cubic  +  [3 * (1 - beta_cubic) / (1 + beta_cubic)] * (t / RTT)
+*
+*               (d) Elapsed time is limited to avoid 64-bit overflow of the cubic term; the congestion window
+*                   is already limited to the maximum window size well before that limit.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_CONG_CTRL_ALGO_NONE                       0u
+#define  NET_TCP_CONG_CTRL_ALGO_NEW_RENO                   1u   /* See Note #1a.                                        */
+#define  NET_TCP_CONG_CTRL_ALGO_CUBIC                      2u   /* See Note #1b.                                        */
+#define  NET_TCP_CONG_CTRL_ALGO_USER                       3u   /* See Note #1c.                                        */
+#define  NET_TCP_CONG_CTRL_ALGO_NBR_MAX                    4u
+
+#define  NET_TCP_CONG_CTRL_EVENT_FAST_RE_TX                1u   /* Loss detected by fast re-tx.                         */
+#define  NET_TCP_CONG_CTRL_EVENT_TIMEOUT                   2u   /* Loss detected by re-tx timeout.                      */
+
+#define  NET_TCP_CONG_CTRL_STATE_SLOW_START                1u
+#define  NET_TCP_CONG_CTRL_STATE_CONG_AVOID                2u
+#define  NET_TCP_CONG_CTRL_STATE_FAST_RECOVERY             3u
+
+                                                                                /* See Note #3.                         */
+#define  NET_TCP_CONG_CUBIC_BETA_NUMER                     7u
+#define  NET_TCP_CONG_CUBIC_BETA_DENOM                    10u
+                                                                                /* Fast convergence : (1 + beta) / 2.   */
+#define  NET_TCP_CONG_CUBIC_CONVERGE_NUMER                17u
+#define  NET_TCP_CONG_CUBIC_CONVERGE_DENOM                20u
+                                                                                /* 1 / C = 2.5 s^3 per MSS ...          */
+                                                                                /* ... = 2.5 * 10^9 ms^3 per MSS.       */
+#define  NET_TCP_CONG_CUBIC_C_INV_MS3_SCALED         2500000u
+#define  NET_TCP_CONG_CUBIC_C_INV_MS3_SCALE             1000u
+                                                                                /* Lim target to 1.5 * cong win.        */
+#define  NET_TCP_CONG_CUBIC_TARGET_MAX_NUMER               3u
+#define  NET_TCP_CONG_CUBIC_TARGET_MAX_DENOM               2u
+                                                                                /* 3 * (1 - beta) / (1 + beta) ~ 0.529. */
+#define  NET_TCP_CONG_CUBIC_EST_NUMER                    529u
+#define  NET_TCP_CONG_CUBIC_EST_DENOM                   1000u
+
+#define  NET_TCP_CONG_CUBIC_TIME_MAX_MS               100000u   /* See Note #3d.                                        */
+#define  NET_TCP_CONG_CUBIC_INC_TH_MSS_SCALAR            100u   /* Win inc th when cong win >= target.                  */
+
+
 /*
 *********************************************************************************************************
 *                    TCP ROUND-TRIP TIME (RTT) / RE-TRANSMIT TIMEOUT (RTO) DEFINES
@@ -1050,8 +1187,18 @@ typedef  enum  net_tcp_opt_type {
 *                                                   RTO                 Retransmission Timeout
 *                                                   RTT                 Round-Trip Time
 *
-*                               (A) RFC #2988, Section 2.1 reiterates that "until a round-trip time (RTT)
-*                                   measurement has been made ... the sender SHOULD set RTO <- 3 seconds".
+*                               (A) (1) RFC #2988, Section 2.1 reiterates that "until a round-trip time
+*                                       (RTT) measurement has been made ... the sender SHOULD set RTO <- 3
+*                                       seconds".
+*
+*                                   (2) However, RFC #6298, Section 2.1 amends that "until a round-trip time
+*                                       (RTT) measurement has been made ... the sender SHOULD set RTO <- 1
+*                                       second" & Section 5.7 adds that "if the timer expires awaiting the
+*                                       ACK of a SYN segment and the TCP implementation is using an RTO less
+*                                       than 3 seconds, the RTO MUST be re-initialized to 3 seconds when data
+*                                       transmission begins (i.e., after the three-way handshake completes)".
+*
+*                                       See also 'net_tcp.c  NetTCP_TxConnRTO_InitSync()  Note #1'.
 *
 *                               (B) Furthermore, RFC #1122, Section 4.2.3.1.(b) states that "the smoothed
 *                                   variance is to be initialized to the value that will result in" these
@@ -1190,11 +1337,23 @@ typedef  enum  net_tcp_opt_type {
 *                       (B) Thus the TCP retransmission timer exponential back-off scalar value is 2.
 *
 *                       See also 'net_tcp.c  NetTCP_TxConnRTO_CalcBackOff()  Note #1a'.
+*
+*           (4) (a) When high-resolution network timers are enabled (see 'net_tmr.h  NETWORK TIMER
+*                   HIGH-RESOLUTION DEFAULT CONFIGURATION'), RTT measurements are timestamped in
+*                   microseconds & the re-transmit, delayed acknowledgement, & persist timers are armed
+*                   in milliseconds rather than in network timer ticks.
+*
+*               (b) RTT calculations are still performed in milliseconds scaled by 8 (see Note #3a2Ba),
+*                   so microsecond RTT measurements are kept to a 125-microsecond resolution.
+*
+*               (c) The RTT clock granularity G (see Note #3b1A2) is then 1 millisecond, the resolution
+*                   of the re-transmit timer, rather than the network timer task period.
 *********************************************************************************************************
 */
 
 #define  NET_TCP_TX_RTT_AVG_INIT_SEC                       0    /* RTT avg init = 0 sec     (see Note #3a1A1a).         */
-#define  NET_TCP_TX_RTT_RTO_INIT_SEC                       3    /* RTT RTO init = 3 sec     (see Note #3a1A1b).         */
+#define  NET_TCP_TX_RTT_RTO_INIT_SEC                       1    /* RTT RTO init = 1 sec     (see Note #3a1A1A2).        */
+#define  NET_TCP_TX_RTT_RTO_SYNC_RE_TX_SEC                 3    /* RTO after SYN re-tx = 3 sec (see Note #3a1A1A2).     */
 
 
                                                                 /* RTT avg init gain = 1    (see Note #3a1Ba4).         */
@@ -1238,8 +1397,19 @@ typedef  enum  net_tcp_opt_type {
 #define  NET_TCP_TX_RTT_NONE                               0
 #define  NET_TCP_TX_RTT_TS_NONE                            0
 
-                                                                /* RTT clk resolution (see Note #3b1A2).                */
-#if     (NET_TMR_TASK_PERIOD_mS > 0)
+                                                                /* RTT ts get fnct    (see Note #4a).                   */
+#if     (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+#define  NET_TCP_TX_RTT_TS_GET()                         ((NET_TCP_TX_RTT_TS)NetUtil_TS_Get_us())
+#define  NET_TCP_TX_RTT_TS_PER_MS                        (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC)
+#else
+#define  NET_TCP_TX_RTT_TS_GET()                         ((NET_TCP_TX_RTT_TS)NetUtil_TS_Get_ms())
+#define  NET_TCP_TX_RTT_TS_PER_MS                          1u
+#endif
+
+                                                                /* RTT clk resolution (see Notes #3b1A2 & #4c).         */
+#if     (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+#define  NET_TCP_TX_RTT_TS_CLK_MS                          1u
+#elif   (NET_TMR_TASK_PERIOD_mS > 0)
 #define  NET_TCP_TX_RTT_TS_CLK_MS                        NET_TMR_TASK_PERIOD_mS
 #else
 #define  NET_TCP_TX_RTT_TS_CLK_MS                        NET_TMR_TIME_TICK
@@ -1271,6 +1441,49 @@ typedef  enum  net_tcp_opt_type {
 #define  NET_TCP_TX_RTT_RTO_STATE_RE_TX                   30u
 
 
+/*
+*********************************************************************************************************
+*                                  TCP CONNECTION TELEMETRY DEFINES
+*
+* Note(s) : (1) TCP connection telemetry addresses are sized for IPv6 addresses; IPv4 addresses are stored
+*               in the first NET_IPv4_ADDR_SIZE octets & the remaining octets cleared.
+*
+*           (2) (a) TCP connection telemetry is exported as a header followed by fixed-size records, with
+*                   ALL multi-octet values in network-order :
+*
+*                         0        1        2        3
+*                   +--------+--------+--------+--------+
+*                   |  Ver   | Flags  |    Rec Size     |
+*                   +--------+--------+--------+--------+
+*                   |     Rec Nbr     |    Reserved     |
+*                   +--------+--------+--------+--------+
+*                   |        Export Timestamp (ms)      |
+*                   +--------+--------+--------+--------+
+*
+*               (b) Each record holds, in order, the connection's ID (2 octets), state (1), address family
+*                   (1), local & remote port numbers (2 each), local & remote addresses (16 each), receive
+*                   segment & octet counters, transmit segment & octet counters, re-transmit counter,
+*                   smoothed RTT (ms), RTO (ms), congestion window, application receive queue, transmit
+*                   queue & re-transmit queue octets (4 octets each).
+*
+*               (c) The truncated flag is set if the export buffer could NOT hold ALL used connections.
+*
+*               See also 'net_tcp.c  NetTCP_ConnTelemetryExport()'.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_TELEMETRY_ADDR_LEN                       16u   /* See Note #1.                                         */
+
+#define  NET_TCP_TELEMETRY_EXPORT_VER                      1u   /* See Note #2a.                                        */
+#define  NET_TCP_TELEMETRY_EXPORT_FLAG_TRUNC            0x01u   /* See Note #2c.                                        */
+
+#define  NET_TCP_TELEMETRY_EXPORT_HDR_SIZE                12u
+#define  NET_TCP_TELEMETRY_EXPORT_REC_SIZE               (8u + (2u * NET_TCP_TELEMETRY_ADDR_LEN) + (11u * 4u))
+
+#define  NET_TCP_TELEMETRY_EXPORT_SIZE_MAX              (NET_TCP_TELEMETRY_EXPORT_HDR_SIZE + \
+                                                        (NET_TCP_TELEMETRY_EXPORT_REC_SIZE * NET_TCP_NBR_CONN))
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1326,7 +1539,7 @@ typedef  CPU_INT16U  NET_TCP_SEG_SIZE;
 */
 
 #if 0                                                           /* See Note #1.                                         */
-typedef  CPU_INT16U  NET_TCP_WIN_SIZE;
+typedef  CPU_INT32U  NET_TCP_WIN_SIZE;
 #endif
 
 
@@ -1402,7 +1615,7 @@ typedef  CPU_INT08U  NET_TCP_TX_Q_STATE;
 * Note(s) : (1) RTT measurement data types MUST be defined to ensure sufficient range for both scaled
 *               & un-scaled, signed & unsigned time measurement values.
 *
-*           (2) 'NET_TCP_TX_RTT_TS_MS' pre-defined in 'net_type.h' PRIOR to all other network modules
+*           (2) 'NET_TCP_TX_RTT_TS' pre-defined in 'net_type.h' PRIOR to all other network modules
 *                that require TCP Transmit Round-Trip Time data type(s).
 *********************************************************************************************************
 */
@@ -1414,7 +1627,7 @@ typedef  NET_TS_MS   NET_TCP_TX_RTT_MS;
 typedef  CPU_INT32S  NET_TCP_TX_RTT_MS_SCALED;
 
 #if 0                                                           /* See Note #2.                                         */
-typedef  NET_TS_MS   NET_TCP_TX_RTT_TS_MS;
+typedef  NET_TS      NET_TCP_TX_RTT_TS;
 #endif
 typedef  CPU_INT32S  NET_TCP_TX_RTT_TS_MS_SCALED;
 
@@ -1429,6 +1642,17 @@ typedef  CPU_INT32U  NET_TCP_TIMEOUT_MS;
 typedef  CPU_INT16U  NET_TCP_TIMEOUT_SEC;
 
 
+/*
+*********************************************************************************************************
+*                                 TCP CONGESTION CONTROL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  NET_TCP_CONG_CTRL_ALGO;
+typedef  CPU_INT08U  NET_TCP_CONG_CTRL_EVENT;
+typedef  CPU_INT08U  NET_TCP_CONG_CTRL_STATE;
+
+
 /*
 *********************************************************************************************************
 *                                  TCP CONNECTION QUANTITY DATA TYPE
@@ -1516,6 +1740,9 @@ typedef  CPU_INT16U  NET_TCP_HDR_FLAGS;
 *                                           '1' - Connection Close               requested
 *
 *           (3) Urgent pointer & data NOT supported (see 'net_tcp.h  Note #1b').
+*
+*           (4) The window size field is a 16-bit header field; 'NET_TCP_WIN_SIZE' holds un-scaled 32-bit
+*               window sizes & MUST NOT be used for it (see 'net_type.h  TCP WINDOW SIZE DATA TYPE  Note #2').
 *********************************************************************************************************
 */
 
@@ -1526,7 +1753,7 @@ typedef  struct  net_tcp_hdr {
     NET_TCP_SEQ_NBR         SeqNbr;                             /* TCP seg  seq  nbr.                                   */
     NET_TCP_SEQ_NBR         AckNbr;                             /* TCP seg  ack  nbr.                                   */
     NET_TCP_HDR_FLAGS       HdrLen_Flags;                       /* TCP seg  hdr  len/flags (see Note #2).               */
-    NET_TCP_WIN_SIZE        WinSize;                            /* TCP conn win size.                                   */
+    CPU_INT16U              WinSize;                            /* TCP conn win size       (see Note #4).               */
     NET_CHK_SUM             ChkSum;                             /* TCP seg  chk sum.                                    */
     CPU_INT16U              UrgentPtr;                          /* TCP seg  urgent ptr     (see Note #3).               */
     NET_TCP_OPT_SIZE        Opts[NET_TCP_HDR_OPT_NBR_MAX];      /* TCP seg  opts (if any).                              */
@@ -1570,6 +1797,63 @@ typedef  struct  net_tcp_opt_cfg_max_seg_size {
 } NET_TCP_OPT_CFG_MAX_SEG_SIZE;
 
 
+/*
+*********************************************************************************************************
+*                     TCP SELECTIVE ACKNOWLEDGEMENT OPTION CONFIGURATION DATA TYPES
+*
+* Note(s) : (1) SACK blocks are configured in transmit order; i.e. the first block reports either a
+*               duplicate segment (D-SACK) or the most recently received out-of-order segment (see
+*               RFC #2018, Section 4 & RFC #2883, Section 4).
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_cfg_sack_permit {
+    NET_TCP_OPT_TYPE        Type;
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_SACK_PERMIT;
+
+
+typedef  struct  net_tcp_opt_sack_blk {
+    NET_TCP_SEQ_NBR         SeqNbrLeft;                         /* Seq nbr of first octet       of blk.                 */
+    NET_TCP_SEQ_NBR         SeqNbrRight;                        /* Seq nbr following last octet of blk.                 */
+} NET_TCP_OPT_SACK_BLK;
+
+
+typedef  struct  net_tcp_opt_cfg_sack {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT08U              BlkNbr;                             /* Nbr of SACK blks.                                    */
+    NET_TCP_OPT_SACK_BLK    Blks[NET_TCP_HDR_OPT_SACK_BLK_NBR_MAX];     /* SACK blks (see Note #1).                     */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_SACK;
+
+
+/*
+*********************************************************************************************************
+*                          TCP WINDOW SCALE OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_cfg_win_scale {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT08U              Shift;                              /* TCP win scale shift cnt.                             */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_WIN_SCALE;
+
+
+/*
+*********************************************************************************************************
+*                            TCP TIMESTAMPS OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_cfg_ts {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT32U              TS_Val;                             /* TCP TS val  (TSval).                                 */
+    CPU_INT32U              TS_Echo;                            /* TCP TS echo (TSecr).                                 */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_TS;
+
+
 /*
 *********************************************************************************************************
 *                                   APP CALLBACK FUNCTION DATA TYPE
@@ -1614,6 +1898,9 @@ typedef  void         (*NET_TCP_APP_POST_FNCT)             (NET_CONN_ID   conn_i
 *
 *               (b) Some TCP connection timeouts are dynamically calculated at run-time & CANNOT &/or are
 *                   NOT necessary to pre-compute/convert to 'NET_TMR_TICK' ticks.
+*
+*           (2) Congestion control algorithm selected from 'NetTCP_CongCtrlAPI_Tbl[]'; see also 'TCP
+*               CONGESTION CONTROL ALGORITHM DEFINES  Note #1'.
 *********************************************************************************************************
 */
 
@@ -1666,6 +1953,27 @@ struct  net_tcp_conn {
     NET_BUF                             *RxQ_App_Head;                  /* Head of app data  rx Q to q TCP pkts until app rd(s).*/
     NET_BUF                             *RxQ_App_Tail;                  /* Tail of app data  rx Q to q TCP pkts until app rd(s).*/
 
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    CPU_BOOLEAN                          SackPermit;                    /* SACK permitted by both hosts.                        */
+
+    NET_TCP_SEQ_NBR                      RxSackSeqNbrLast;              /* Rx  seq nbr of last out-of-order seg q'd.            */
+    NET_TCP_SEQ_NBR                      RxSackDupSeqNbr;               /* Rx  seq nbr of last dup          seg rx'd (D-SACK).  */
+    NET_TCP_SEG_SIZE                     RxSackDupLen;                  /* Rx  len     of last dup          seg rx'd (D-SACK).  */
+#endif
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+    CPU_BOOLEAN                          WinScaleEn;                    /* Win scale negotiated by both hosts.                  */
+    CPU_INT08U                           RxWinScale;                    /* Rx win scale shift cnt (adv'd by local  host).       */
+    CPU_INT08U                           TxWinScale;                    /* Tx win scale shift cnt (adv'd by remote host).       */
+#endif
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+    CPU_BOOLEAN                          TS_En;                         /* TS negotiated by both hosts.                         */
+    CPU_INT32U                           TS_Recent;                     /* Most recent TS val rx'd (TS.Recent).                 */
+    NET_TS_MS                            TS_RecentAge_ms;               /* Local time TS.Recent last updated.                   */
+    NET_TCP_SEQ_NBR                      TS_LastAckSent;                /* Ack nbr of last seg tx'd (Last.ACK.sent).            */
+#endif
+
 
 
     NET_TCP_SEQ_NBR                      TxSeqNbrSync;                  /* Sync  tx seq nbr.                                    */
@@ -1703,6 +2011,17 @@ struct  net_tcp_conn {
     NET_TCP_WIN_SIZE                     TxWinSizeCongCalcdCur;         /* Tx  win size cur    calc'd    cong ctrl.             */
     NET_TCP_WIN_SIZE                     TxWinSizeCongRem;              /* Tx  win size rem'ing       by cong ctrl.             */
 
+    NET_TCP_CONG_CTRL_ALGO               CongCtrlAlgo;                  /* Cong ctrl alg (see Note #2).                         */
+    NET_TCP_SEQ_NBR                      TxSeqNbrRecover;               /* Fast recovery seq nbr (see RFC #6582, Section 3.2).  */
+#if (NET_TCP_CFG_CONG_CTRL_CUBIC_EN == DEF_ENABLED)
+    NET_TCP_WIN_SIZE                     CongCUBIC_WinMax;              /* CUBIC win size before last reduction.                */
+    NET_TCP_WIN_SIZE                     CongCUBIC_WinLastMax;          /* CUBIC win size before prev reduction.                */
+    NET_TCP_WIN_SIZE                     CongCUBIC_WinOrigin;           /* CUBIC win size origin  of cur epoch.                 */
+    NET_TS_MS                            CongCUBIC_EpochStart_ms;       /* CUBIC start ts         of cur epoch (in ms).         */
+    CPU_BOOLEAN                          CongCUBIC_EpochEn;             /* CUBIC cur epoch started.                             */
+    CPU_INT32U                           CongCUBIC_K_ms;                /* CUBIC time to reach win max         (in ms).         */
+#endif
+
     NET_TCP_WIN_SIZE                     TxWinSizeAvail;                /* Tx  win size avail.                                  */
 
     NET_TCP_WIN_SIZE                     TxWinSizeMinTh;                /* Tx  win size min th (tx silly win ctrl).             */
@@ -1758,6 +2077,10 @@ struct  net_tcp_conn {
     NET_BUF                             *ReTxQ_Head;                    /* Head of Q of TCP pkts to re-tx on timeout.           */
     NET_BUF                             *ReTxQ_Tail;                    /* Tail of Q of TCP pkts to re-tx on timeout.           */
     NET_TMR                             *ReTxQ_Tmr;                     /*   Re-tx Q         tmr.                               */
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    NET_TCP_SEQ_NBR                      TxSackSeqNbrHigh;              /* Highest tx seq nbr SACK'd   by remote host.          */
+    NET_TCP_SEQ_NBR                      TxSackSeqNbrReTx;              /* Highest tx seq nbr re-tx'd  in fast recovery.        */
+#endif
 
 
 
@@ -1773,6 +2096,23 @@ struct  net_tcp_conn {
 
     NET_TCP_FLAGS                        Flags;                         /* TCP conn flags.                                      */
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+    CPU_INT32U                           RxZeroCopyGen;                 /* Conn gen stamped on zero-copy rx'd bufs.             */
+#endif
+
+#if (NET_TCP_CFG_TX_COPY_UNLOCK_EN == DEF_ENABLED)
+    CPU_INT32U                           TxAppCopyToken;                /* Token of app data copy in progress w/o net lock.     */
+    CPU_BOOLEAN                          TxAppCopyWait;                 /* Indicate tx waiting on app data copy.                */
+#endif
+
+#if (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED)
+                                                                        /* ---------------- TCP CONN TELEMETRY ---------------- */
+    NET_CTR                              TelemetryRxSegCtr;             /* Nbr rx'd   segs.                                     */
+    NET_CTR                              TelemetryRxOctetCtr;           /* Nbr rx'd   data octets.                              */
+    NET_CTR                              TelemetryTxSegCtr;             /* Nbr tx'd   segs.                                     */
+    NET_CTR                              TelemetryTxOctetCtr;           /* Nbr tx'd   data octets.                              */
+    NET_CTR                              TelemetryReTxSegCtr;           /* Nbr re-tx'd segs.                                    */
+#endif
 
     NET_TCP_APP_LISTEN_Q_IS_AVAIL_FNCT   FnctAppListenQ_IsAvail;        /* Is connection should be accepted callback function.  */
     NET_TCP_APP_POST_FNCT                FnctAppPostRx;                 /* Notify RX Data                   callback function.  */
@@ -1780,6 +2120,110 @@ struct  net_tcp_conn {
 };
 
 
+/*
+*********************************************************************************************************
+*                                 TCP CONGESTION CONTROL API DATA TYPE
+*
+* Note(s) : (1) (a) Congestion control algorithms provide ONLY the congestion avoidance window increase &
+*                   the slow start threshold computed on loss; slow start, fast re-transmit & fast recovery
+*                   are handled by NetTCP_TxConnWinSizeHandlerCongCtrl() for ALL algorithms.
+*
+*               (b) 'WinIncThGet()' returns the number of acknowledged octets required to increase the
+*                   congestion window by one maximum segment size during congestion avoidance.
+*
+*               (c) 'SlowStartThCalc()' returns the slow start threshold on a congestion event & MAY
+*                   update any algorithm-specific connection state.
+*
+*           (2) API functions are called with the global network lock acquired & MUST NOT block.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_cong_ctrl_api {
+    void               (*Init)           (NET_TCP_CONN             *p_conn);    /* Init cong ctrl   state.                      */
+
+    NET_TCP_WIN_SIZE   (*WinIncThGet)    (NET_TCP_CONN             *p_conn);    /* Get  win inc th (see Note #1b).              */
+
+    NET_TCP_WIN_SIZE   (*SlowStartThCalc)(NET_TCP_CONN             *p_conn,     /* Calc slow start th (see Note #1c).           */
+                                          NET_TCP_CONG_CTRL_EVENT   event);
+} NET_TCP_CONG_CTRL_API;
+
+
+/*
+*********************************************************************************************************
+*                            TCP CONGESTION CONTROL INSTRUMENTATION DATA TYPES
+*
+* Note(s) : (1) Instrumentation hook function called with the global network lock acquired after each TCP
+*               connection congestion window update; hook function MUST NOT block nor call network
+*               suite API functions.
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_cong_ctrl_stats {
+    NET_TCP_CONG_CTRL_ALGO    Algo;                             /* Cong ctrl alg.                                       */
+    NET_TCP_CONG_CTRL_STATE   State;                            /* Cong ctrl state.                                     */
+    NET_TCP_WIN_SIZE          CongWin;                          /* Cong win size        (in octets).                    */
+    NET_TCP_WIN_SIZE          SlowStartTh;                      /* Slow start th        (in octets).                    */
+    NET_TCP_WIN_SIZE          FlightSize;                       /* Un-ack'd data        (in octets).                    */
+    NET_TCP_WIN_SIZE          RemoteWin;                        /* Remote win size      (in octets).                    */
+    NET_TCP_TIMEOUT_MS        RTT_Avg_ms;                       /* Smoothed RTT         (in ms).                        */
+    NET_TCP_TIMEOUT_MS        RTT_Dev_ms;                       /* RTT deviation        (in ms).                        */
+    NET_TCP_TIMEOUT_MS        RTO_ms;                           /* Re-tx timeout        (in ms).                        */
+} NET_TCP_CONG_CTRL_STATS;
+
+                                                                /* See Note #1.                                         */
+typedef  void  (*NET_TCP_CONG_CTRL_HOOK_FNCT)(NET_TCP_CONN_ID                  conn_id,
+                                              const  NET_TCP_CONG_CTRL_STATS  *p_stats);
+
+
+/*
+*********************************************************************************************************
+*                                  TCP CONNECTION TELEMETRY DATA TYPE
+*
+* Note(s) : (1) (a) Segment & octet counters are updated per TCP segment handled by the connection; segments
+*                   coalesced by the interface layer are counted as a single received segment.
+*
+*               (b) Octet counters count ONLY TCP data octets, NOT TCP/IP header octets.
+*
+*               (c) The transmit segment counter includes re-transmitted segments; the transmit octet
+*                   counter does NOT.
+*
+*           (2) Queue occupancies are the number of data octets NOT yet read by the application, NOT yet
+*               transmitted & NOT yet acknowledged by the remote host, respectively.
+*
+*           (3) Port numbers in host-order; addresses in network-order (see also 'TCP CONNECTION TELEMETRY
+*               DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+#if (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED)
+typedef  struct  net_tcp_conn_telemetry {
+    NET_TCP_CONN_ID           ConnID;                           /* TCP conn id.                                         */
+    NET_TCP_CONN_STATE        ConnState;                        /* TCP conn state.                                      */
+
+    NET_IP_ADDR_FAMILY        AddrFamily;                       /* Addr family (see Note #3).                           */
+    NET_PORT_NBR              PortLocal;                        /* Local  port nbr.                                     */
+    NET_PORT_NBR              PortRemote;                       /* Remote port nbr.                                     */
+                                                                /* Local/remote addrs.                                  */
+    CPU_INT08U                AddrLocal[NET_TCP_TELEMETRY_ADDR_LEN];
+    CPU_INT08U                AddrRemote[NET_TCP_TELEMETRY_ADDR_LEN];
+
+    NET_CTR                   RxSegCtr;                         /* Nbr rx'd    segs       (see Note #1a).               */
+    NET_CTR                   RxOctetCtr;                       /* Nbr rx'd    data octets (see Note #1b).              */
+    NET_CTR                   TxSegCtr;                         /* Nbr tx'd    segs       (see Note #1c).               */
+    NET_CTR                   TxOctetCtr;                       /* Nbr tx'd    data octets (see Note #1c).              */
+    NET_CTR                   ReTxSegCtr;                       /* Nbr re-tx'd segs.                                    */
+
+    NET_TCP_TIMEOUT_MS        RTT_Avg_ms;                       /* Smoothed RTT         (in ms).                        */
+    NET_TCP_TIMEOUT_MS        RTO_ms;                           /* Re-tx timeout        (in ms).                        */
+    NET_TCP_WIN_SIZE          CongWin;                          /* Cong win size        (in octets).                    */
+
+    CPU_INT32U                RxQ_Octets;                       /* App rx Q occupancy   (in octets; see Note #2).       */
+    CPU_INT32U                TxQ_Octets;                       /*     Tx Q occupancy   (in octets).                    */
+    CPU_INT32U                ReTxQ_Octets;                     /*  Re-tx Q occupancy   (in octets).                    */
+} NET_TCP_CONN_TELEMETRY;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1941,6 +2385,31 @@ CPU_BOOLEAN         NetTCP_ConnCfgMSL_Timeout            (NET_TCP_CONN_ID
                                                           NET_TCP_TIMEOUT_SEC                  msl_timeout_sec,
                                                           NET_ERR                             *p_err);
 
+CPU_BOOLEAN         NetTCP_ConnCfgCongCtrl               (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          NET_TCP_CONG_CTRL_ALGO               algo,
+                                                          NET_ERR                             *p_err);
+
+void                NetTCP_ConnCongCtrlStatsGet          (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          NET_TCP_CONG_CTRL_STATS             *p_stats,
+                                                          NET_ERR                             *p_err);
+
+void                NetTCP_CongCtrlReg                   (NET_TCP_CONG_CTRL_ALGO               algo,
+                                                          const  NET_TCP_CONG_CTRL_API        *p_api,
+                                                          NET_ERR                             *p_err);
+
+void                NetTCP_CongCtrlHookSet               (NET_TCP_CONG_CTRL_HOOK_FNCT          fnct,
+                                                          NET_ERR                             *p_err);
+
+#if (NET_TCP_CFG_TELEMETRY_EN == DEF_ENABLED)
+CPU_BOOLEAN         NetTCP_ConnTelemetryGetNext          (NET_TCP_CONN_ID                     *p_conn_id_tcp,
+                                                          NET_TCP_CONN_TELEMETRY              *p_telemetry,
+                                                          NET_ERR                             *p_err);
+
+CPU_SIZE_T          NetTCP_ConnTelemetryExport           (CPU_INT08U                          *p_buf,
+                                                          CPU_SIZE_T                           buf_len,
+                                                          NET_ERR                             *p_err);
+#endif
+
 NET_STAT_POOL       NetTCP_ConnPoolStatGet               (void);
 
 void                NetTCP_ConnPoolStatResetMaxUsed      (void);
@@ -1962,10 +2431,23 @@ void             NetTCP_Rx                            (NET_BUF              *pbu
 
 CPU_INT16U       NetTCP_RxAppData                     (NET_TCP_CONN_ID       conn_id_tcp,
                                                        void                 *pdata_buf,
+                                                       NET_BUF_IO_VEC       *p_iov,
+                                                       CPU_INT16U            iov_cnt,
                                                        CPU_INT16U            data_buf_len,
                                                        NET_TCP_FLAGS         flags,
                                                        NET_ERR              *p_err);
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+CPU_INT16U       NetTCP_RxAppDataZeroCopy             (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       NET_BUF             **p_buf_rtn,
+                                                       NET_TCP_FLAGS         flags,
+                                                       NET_ERR              *p_err);
+
+void             NetTCP_RxAppDataZeroCopyFree         (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       NET_BUF              *p_buf,
+                                                       NET_ERR              *p_err);
+#endif
+
 
 
                                                                                     /* ----------- TX FNCTS ----------- */
@@ -1979,10 +2461,25 @@ void             NetTCP_TxConnReqClose                (NET_TCP_CONN_ID       con
 
 CPU_INT16U       NetTCP_TxConnAppData                 (NET_TCP_CONN_ID       conn_id_tcp,
                                                        void                 *p_data,
+                                                       NET_BUF_IO_VEC       *p_iov,
+                                                       CPU_INT16U            iov_cnt,
                                                        CPU_INT16U            data_len,
                                                        NET_TCP_FLAGS         flags,
                                                        NET_ERR              *p_err);
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_BUF         *NetTCP_TxConnAppBufGet               (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       CPU_INT16U           *p_data_len,
+                                                       CPU_INT08U          **p_data,
+                                                       NET_ERR              *p_err);
+
+CPU_INT16U       NetTCP_TxConnAppBuf                  (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       NET_BUF             **p_buf_tx,
+                                                       CPU_INT16U            data_len,
+                                                       NET_TCP_FLAGS         flags,
+                                                       NET_ERR              *p_err);
+#endif
+
 
 
                                                                                     /* ---- TCP RX/TX STATUS FNCTS ---- */
@@ -2082,6 +2579,10 @@ CPU_BOOLEAN      NetTCP_ConnCfgMSL_TimeoutHandler     (NET_TCP_CONN_ID
                                                        NET_TCP_TIMEOUT_SEC                  msl_timeout_sec,
                                                        NET_ERR                             *p_err);
 
+CPU_BOOLEAN      NetTCP_ConnCfgCongCtrlHandler        (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       NET_TCP_CONG_CTRL_ALGO               algo,
+                                                       NET_ERR                             *p_err);
+
 
                                                                                     /* ---- TCP CONN STATUS FNCTS ----- */
 CPU_BOOLEAN      NetTCP_ConnIsUsed                    (NET_TCP_CONN_ID       conn_id_tcp,
@@ -2286,6 +2787,69 @@ NET_TCP_SEQ_NBR  NetTCP_ConnFiveTupleSeqNbrGet        (NET_CONN             *p_c
 #endif
 
 
+#if    ((NET_TCP_CFG_SACK_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_SACK_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_SACK_EN                       illegally #define'd in 'net_cfg.h' "
+#error  "                                         [MUST be  DEF_DISABLED]            "
+#error  "                                         [     ||  DEF_ENABLED ]            "
+#endif
+
+
+#if    ((NET_TCP_CFG_WIN_SCALE_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_WIN_SCALE_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_WIN_SCALE_EN                  illegally #define'd in 'net_cfg.h' "
+#error  "                                         [MUST be  DEF_DISABLED]            "
+#error  "                                         [     ||  DEF_ENABLED ]            "
+#endif
+
+
+#if    ((NET_TCP_CFG_TS_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_TS_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_TS_EN                         illegally #define'd in 'net_cfg.h' "
+#error  "                                         [MUST be  DEF_DISABLED]            "
+#error  "                                         [     ||  DEF_ENABLED ]            "
+#endif
+
+
+#if    ((NET_TCP_CFG_CONG_CTRL_CUBIC_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_CONG_CTRL_CUBIC_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_CONG_CTRL_CUBIC_EN            illegally #define'd in 'net_cfg.h' "
+#error  "                                         [MUST be  DEF_DISABLED]            "
+#error  "                                         [     ||  DEF_ENABLED ]            "
+#endif
+
+
+#if    ((NET_TCP_CFG_CONG_CTRL_DFLT != NET_TCP_CONG_CTRL_ALGO_NEW_RENO) && \
+        (NET_TCP_CFG_CONG_CTRL_DFLT != NET_TCP_CONG_CTRL_ALGO_CUBIC   ))
+#error  "NET_TCP_CFG_CONG_CTRL_DFLT                illegally #define'd in 'net_cfg.h'     "
+#error  "                                         [MUST be  NET_TCP_CONG_CTRL_ALGO_NEW_RENO]"
+#error  "                                         [     ||  NET_TCP_CONG_CTRL_ALGO_CUBIC   ]"
+
+#elif  ((NET_TCP_CFG_CONG_CTRL_DFLT     == NET_TCP_CONG_CTRL_ALGO_CUBIC) && \
+        (NET_TCP_CFG_CONG_CTRL_CUBIC_EN != DEF_ENABLED                 ))
+#error  "NET_TCP_CFG_CONG_CTRL_DFLT                illegally #define'd in 'net_cfg.h'     "
+#error  "                                         [MUST NOT be NET_TCP_CONG_CTRL_ALGO_CUBIC]"
+#error  "                                         [if NET_TCP_CFG_CONG_CTRL_CUBIC_EN      ]"
+#error  "                                         [        is  DEF_DISABLED            ]"
+#endif
+
+
+#if    ((NET_TCP_CFG_TELEMETRY_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_TELEMETRY_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_TELEMETRY_EN                  illegally #define'd in 'net_cfg.h' "
+#error  "                                         [MUST be  DEF_DISABLED]            "
+#error  "                                         [     ||  DEF_ENABLED ]            "
+#endif
+
+
+#if    ((NET_TCP_CFG_TX_COPY_UNLOCK_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_TX_COPY_UNLOCK_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_TX_COPY_UNLOCK_EN             illegally #define'd in 'net_cfg.h' "
+#error  "                                         [MUST be  DEF_DISABLED]            "
+#error  "                                         [     ||  DEF_ENABLED ]            "
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
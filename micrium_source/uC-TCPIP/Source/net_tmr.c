@@ -50,6 +50,9 @@
                                                                 /* -------------------- TASK NAMES -------------------- */
 #define  NET_TMR_TASK_NAME                  "Net Tmr Task"
 
+                                                                /* ------------------- SIGNAL NAMES ------------------- */
+#define  NET_TMR_HI_RES_SIGNAL_NAME         "Net Tmr Hi-Res Signal"
+
 
 /*
 *********************************************************************************************************
@@ -65,9 +68,15 @@ static  NET_TMR         NetTmr_Tbl[NET_TMR_CFG_NBR_TMR];
 static  NET_TMR        *NetTmr_PoolPtr;                    /* Ptr to pool of free net tmrs.                        */
 static  NET_STAT_POOL   NetTmr_PoolStat;
 
-static  NET_TMR        *NetTmr_TaskListHead;               /* Ptr to head of Tmr Task List.                        */
+static  NET_TMR        *NetTmr_Wheel[NET_TMR_CFG_WHEEL_SIZE];   /* Tmr Wheel slot lists.                         */
+static  NET_TMR_TICK    NetTmr_TickCur;                    /* Cur tmr task tick.                                   */
 static  NET_TMR        *NetTmr_TaskListPtr;                /* Ptr to cur     Tmr Task List tmr to update.          */
 
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+static  NET_TMR        *NetTmr_HiResListHead;              /* Ptr to head of Hi-Res Tmr List.                      */
+static  KAL_SEM_HANDLE  NetTmr_HiResSignal;                /* Signal Tmr Task of new Hi-Res Tmr List head.         */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -84,6 +93,20 @@ static  void  NetTmr_Task          (       void          *p_data);
 
 static  void  NetTmr_Clr           (       NET_TMR       *p_tmr);
 
+static  void  NetTmr_WheelInsert   (       NET_TMR       *p_tmr,
+                                           NET_TMR_TICK   time);
+
+static  void  NetTmr_WheelRemove   (       NET_TMR       *p_tmr);
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+static  void  NetTmr_TaskHandlerHiRes(void);
+
+static  CPU_BOOLEAN  NetTmr_HiResInsert(NET_TMR     *p_tmr,
+                                        CPU_INT32U   time_ms);
+
+static  void  NetTmr_HiResRemove   (       NET_TMR       *p_tmr);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -94,7 +117,7 @@ static  void  NetTmr_Clr           (       NET_TMR       *p_tmr);
 *                   (a) Perform Timer Module/OS initialization
 *                   (b) Initialize timer pool
 *                   (c) Initialize timer table
-*                   (d) Initialize timer task list pointer
+*                   (d) Initialize timer wheel, timer task list pointer & high-resolution timer list
 *
 *
 * Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
@@ -154,9 +177,15 @@ void  NetTmr_Init (const  NET_TASK_CFG  *p_tmr_task_cfg,
     }
 
 
-                                                                /* -------------- INIT TMR TASK LIST PTR -------------- */
-    NetTmr_TaskListHead = DEF_NULL;
-    NetTmr_TaskListPtr  = DEF_NULL;
+                                                                /* ------------ INIT TMR WHEEL & TASK LIST ------------ */
+    for (i = 0u; i < NET_TMR_CFG_WHEEL_SIZE; i++) {
+        NetTmr_Wheel[i] = DEF_NULL;
+    }
+    NetTmr_TickCur     = 0u;
+    NetTmr_TaskListPtr = DEF_NULL;
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    NetTmr_HiResListHead = DEF_NULL;
+#endif
 
 
    *p_err = NET_TMR_ERR_NONE;
@@ -173,7 +202,9 @@ void  NetTmr_Init (const  NET_TASK_CFG  *p_tmr_task_cfg,
 *
 *                       (1) OS ticker / Network Timer Task frequency
 *
-*                   (b) Create Network Timer Task
+*                   (b) Create Network Timer High-Resolution Signal             See Note #2
+*
+*                   (c) Create Network Timer Task
 *
 *
 * Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
@@ -195,7 +226,8 @@ void  NetTmr_Init (const  NET_TASK_CFG  *p_tmr_task_cfg,
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) The high-resolution signal MUST be created PRIOR to the Timer Task, which pends on it
+*                   (see 'NetTmr_Task()  Note #4').
 *********************************************************************************************************
 */
 
@@ -213,6 +245,28 @@ static  void  NetTmr_TaskInit (const  NET_TASK_CFG  *p_tmr_task_cfg,
     }
 
 
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+                                                                /* ------ CREATE NETWORK TIMER HI-RES SIGNAL ---------- */
+    NetTmr_HiResSignal = KAL_SemCreate((const  CPU_CHAR *)NET_TMR_HI_RES_SIGNAL_NAME,
+                                                          DEF_NULL,
+                                                         &err_kal);
+    switch (err_kal) {
+        case KAL_ERR_NONE:
+             break;
+
+
+        case KAL_ERR_MEM_ALLOC:
+            *p_err = NET_ERR_FAULT_MEM_ALLOC;
+             return;
+
+
+        default:
+            *p_err = NET_TMR_ERR_INIT_TASK_CREATE;
+             return;
+    }
+#endif
+
+
                                                                 /* ------------ CREATE NETWORK TIMER TASK ------------- */
     NetTmr_TaskHandle = KAL_TaskAlloc((const  CPU_CHAR *)NET_TMR_TASK_NAME,
                                                          p_tmr_task_cfg->StkPtr,
@@ -293,73 +347,139 @@ static  void  NetTmr_TaskInit (const  NET_TASK_CFG  *p_tmr_task_cfg,
 *                   (a) Failure to delay timer task will prevent some network task(s)/operation(s) from
 *                       functioning correctly.  Thus, timer task is assumed to be successfully delayed
 *                       since NO error handling could be performed to counteract failure.
+*
+*               (4) (a) If high-resolution timers are enabled, the timer task pends on the high-resolution
+*                       signal until the earlier of :
+*
+*                       (1) The next NET_TMR_CFG_TASK_FREQ tick, which runs NetTmr_TaskHandler()
+*                       (2) The expiration of the head of the High-Resolution Timer List, which runs
+*                           NetTmr_TaskHandlerHiRes()
+*
+*                   (b) The signal is posted whenever a timer is inserted at the head of the High-Resolution
+*                       Timer List so that the pend timeout is re-computed.
+*
+*                   (c) Network timer task ticks are scheduled on absolute OS ticks; if the task runs late,
+*                       any missed network timer task ticks are handled without further delay.
 *********************************************************************************************************
 */
 
 static  void  NetTmr_Task (void  *p_data)
 {
-    KAL_TICK  dly;
+    KAL_TICK    dly;
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    KAL_TICK    tick_cur;
+    KAL_TICK    tick_next;
+    KAL_TICK    tick_dly;
+    KAL_TICK    tick_dly_hi_res;
+    CPU_INT32U  dly_ms;
+    KAL_ERR     err_kal;
+    CPU_SR_ALLOC();
+#endif
 
 
    (void)&p_data;                                               /* Prevent 'variable unused' compiler warning.          */
 
     dly = KAL_TickRate / NET_TMR_CFG_TASK_FREQ;                 /* Delay task at NET_TMR_CFG_TASK_FREQ rate.            */
 
+#if (NET_TMR_CFG_HI_RES_EN != DEF_ENABLED)
     while (DEF_ON) {
         KAL_DlyTick(dly, KAL_OPT_DLY_PERIODIC);
         NetTmr_TaskHandler();
     }
+
+#else
+    tick_next = KAL_TickGet(&err_kal) + dly;
+
+    while (DEF_ON) {
+        tick_cur = KAL_TickGet(&err_kal);
+        tick_dly = tick_next - tick_cur;                        /* Calc dly until next net tmr tick ...                 */
+        if ((CPU_INT32S)tick_dly < 0) {
+            tick_dly = 0u;
+        }
+                                                                /* ... or until hi-res head tmr expires (see Note #4a). */
+        CPU_CRITICAL_ENTER();
+        if (NetTmr_HiResListHead != DEF_NULL) {
+            tick_dly_hi_res = (KAL_TICK)NetTmr_HiResListHead->TmrExpire - tick_cur;
+            if ((CPU_INT32S)tick_dly_hi_res < 0) {
+                tick_dly_hi_res = 0u;
+            }
+            if (tick_dly_hi_res < tick_dly) {
+                tick_dly = tick_dly_hi_res;
+            }
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (tick_dly > 0u) {                                    /* Round dly up to ms.                                  */
+            dly_ms = ((tick_dly * DEF_TIME_NBR_mS_PER_SEC) + (KAL_TickRate - 1u)) / KAL_TickRate;
+            KAL_SemPend(NetTmr_HiResSignal,                     /* Wait for dly or new hi-res head (see Note #4b).      */
+                        KAL_OPT_PEND_NONE,
+                        dly_ms,
+                       &err_kal);
+        }
+
+        NetTmr_TaskHandlerHiRes();
+
+        tick_cur = KAL_TickGet(&err_kal);
+        if ((CPU_INT32S)(tick_cur - tick_next) >= 0) {          /* If net tmr tick reached, ...                         */
+            NetTmr_TaskHandler();                               /* ... handle net tmr tick  ...                         */
+            tick_next += dly;                                   /* ... & sched next tick (see Note #4c).                */
+        }
+    }
+#endif
 }
 
 /*
 *********************************************************************************************************
 *                                         NetTmr_TaskHandler()
 *
-* Description : (1) Handle network timers in the Timer Task List :
+* Description : (1) Handle network timers that expire on the current tick :
 *
 *                   (a) Acquire network lock                                            See Note #4
 *
-*                   (b) Handle every  network timer in Timer Task List :
-*                       (1) Decrement network timer(s)
+*                   (b) Advance the current tick
+*
+*                   (c) Handle every  network timer in the current tick's Timer Wheel slot :
+*                       (1) Skip timer(s) that expire on a later revolution of the Timer Wheel
 *                       (2) For any timer that expires :                                See Note #8
 *                           (A) Execute timer's callback function
-*                           (B) Free from Timer Task List
+*                           (B) Free from Timer Wheel
 *
-*                   (c) Release network lock
+*                   (d) Release network lock
 *
 *
-*               (2) (a) Timers are managed in a doubly-linked Timer List.
+*               (2) (a) Timers are managed in a hashed Timer Wheel of NET_TMR_CFG_WHEEL_SIZE slots.
 *
-*                       (1) 'NetTmr_TaskListHead' points to the head of the Timer List.
+*                       (1) Each timer records the absolute tick on which it expires, 'TmrExpire'.
 *
-*                       (2) Timers' 'PrevPtr' & 'NextPtr' doubly-link each timer to form the Timer List.
+*                       (2) Each timer is linked into the slot indexed by its expiration tick modulo
+*                           NET_TMR_CFG_WHEEL_SIZE; timers' 'PrevPtr' & 'NextPtr' doubly-link the timers
+*                           of a slot to form that slot's Timer List.
 *
-*                   (b) New timers are added at the head of the Timer List.
+*                   (b) New timers are added at the head of their slot's Timer List.
 *
-*                   (c) As timers are added into the list, older timers migrate to the tail of the Timer
-*                       List.  Once a timer expires or is discarded, it is removed from the Timer List.
+*                   (c) Each tick, ONLY the current tick's slot is handled; every timer of the slot either
+*                       expires on this tick or on a later revolution of the Timer Wheel.  Thus the cost of
+*                       a tick does NOT grow with the number of timers, provided NET_TMR_CFG_WHEEL_SIZE is
+*                       large enough to spread the timers over the slots.
 *
 *
-*                                        |                                               |
-*                                        |<-------------- List of Timers --------------->|
-*                                        |                (see Note #2a)                 |
-*
-*                                      New Timers
-*                                   inserted at head                         Oldest Timer in List
-*                                    (see Note #2b)                            (see Note #2c)
-*
-*                                           |                 NextPtr                 |
-*                                           |             (see Note #2a2)             |
-*                                           v                    |                    v
-*                                                                |
-*                        Head of         -------       -------   v   -------       -------
-*                       Timer List  ---->|     |------>|     |------>|     |------>|     |
-*                                        |     |<------|     |<------|     |<------|     |
-*                    (see Note #2a1)     -------       -------   ^   -------       -------
-*                                                                |
-*                                                                |
-*                                                             PrevPtr
-*                                                         (see Note #2a2)
+*                                        Slot for      Current tick's
+*                                        tick  0          slot            Slot for tick
+*                                           |               |      (NET_TMR_CFG_WHEEL_SIZE - 1)
+*                                           v               v                   |
+*                                                                               v
+*                                        -------  ... -------  ...           -------
+*                         Timer Wheel    |  O  |      |  O  |                |  O  |
+*                                        ---|---      ---|---                ---|---
+*                                           v            v                      v
+*                                        -------      -------                -------
+*                                        |     |      |     |                |     |
+*                                        -------      -------                -------
+*                                          ^ |           |
+*                             PrevPtr -----| v           v                  Timer List
+*                             NextPtr    -------       NULL                  per slot
+*                                        |     |                          (see Note #2a2)
+*                                        -------
 *
 *
 * Argument(s) : none.
@@ -376,8 +496,8 @@ static  void  NetTmr_Task (void  *p_data)
 *               (4) NetTmr_TaskHandler() blocks ALL other network protocol tasks by pending on & acquiring
 *                   the global network lock (see 'net.h  Note #3').
 *
-*               (5) (a) NetTmr_TaskHandler() handles all valid timers in Timer Task List, up to the first
-*                       corrupted timer in the Timer Task List, if any.
+*               (5) (a) NetTmr_TaskHandler() handles all valid timers in the current slot's Timer List, up
+*                       to the first corrupted timer in the Timer List, if any.
 *
 *                   (b) If ANY timer(s) in Timer Task List are corrupted :
 *
@@ -388,16 +508,16 @@ static  void  NetTmr_Task (void  *p_data)
 *
 *                       (2) Timer Task is aborted.
 *
-*               (6) Since NetTmr_TaskHandler() is asynchronous to NetTmr_Free() [via execution of certain
-*                   timer callback functions], the Timer Task List timer ('NetTmr_TaskListPtr') MUST be
+*               (6) Since NetTmr_TaskHandler() is asynchronous to NetTmr_Free() & NetTmr_Set() [via
+*                   execution of certain timer callback functions], the Timer Task List timer ('NetTmr_TaskListPtr') MUST be
 *                   coordinated with NetTmr_Free() to avoid Timer Task List corruption :
 *
 *                   (a) (1) Timer Task List timer is typically advanced by NetTmr_TaskHandler() to the next
 *                           timer in the Timer Task List.
 *
 *                       (2) However, whenever the Timer Task List timer is freed by an asynchronous timer
-*                           callback function, the Timer Task List timer MUST be advanced to the next
-*                           valid & available timer in the Timer Task List.
+*                           callback function, or moved to another slot, the Timer Task List timer MUST be
+*                           advanced to the next valid & available timer in the Timer Task List.
 *
 *                           See also 'NetTmr_Free()  Note #3a'.
 *
@@ -409,8 +529,9 @@ static  void  NetTmr_Task (void  *p_data)
 *
 *               (7) Since NetTmr_TaskHandler() is asynchronous to ANY timer Get/Set, one additional tick
 *                   is added to each timer's count-down so that the requested timeout is ALWAYS satisfied.
-*                   This additional tick is added by NOT checking for zero ticks after decrementing; any
-*                   timer that expires is recognized at the next tick.
+*                   A timer set to 'time' ticks on tick N expires on tick (N + time + 1).
+*
+*                   See also 'NetTmr_WheelInsert()  Note #1'.
 *
 *               (8) When a network timer expires, the timer SHOULD be freed PRIOR to executing the timer
 *                   callback function.  This ensures that at least one timer is available if the timer
@@ -421,6 +542,7 @@ static  void  NetTmr_Task (void  *p_data)
 void  NetTmr_TaskHandler (void)
 {
     NET_TMR       *p_tmr;
+    NET_TMR_TICK   tick_cur;
     void          *obj;
     CPU_FNCT_PTR   fnct;
     NET_ERR        err;
@@ -442,7 +564,10 @@ void  NetTmr_TaskHandler (void)
 
                                                                 /* --------------- HANDLE TMR TASK LIST --------------- */
     CPU_CRITICAL_ENTER();
-    NetTmr_TaskListPtr = NetTmr_TaskListHead;                   /* Start @ Tmr Task List head.                          */
+    NetTmr_TickCur++;                                           /* Adv cur tick (see Note #1b).                         */
+    tick_cur           = NetTmr_TickCur;
+                                                                /* Start @ cur tick's slot head (see Note #2c).         */
+    NetTmr_TaskListPtr = NetTmr_Wheel[tick_cur & (NET_TMR_CFG_WHEEL_SIZE - 1u)];
     p_tmr              = NetTmr_TaskListPtr;
     CPU_CRITICAL_EXIT();
 
@@ -450,10 +575,7 @@ void  NetTmr_TaskHandler (void)
         CPU_CRITICAL_ENTER();
         NetTmr_TaskListPtr = NetTmr_TaskListPtr->NextPtr;       /* Set next tmr to update (see Note #6a1).              */
 
-        if (p_tmr->TmrVal > 0) {                                /* If tmr val > 0, dec tmr val (see Note #7).           */
-            p_tmr->TmrVal--;
-
-        } else {                                                /* Else tmr expired;           ...                      */
+        if (p_tmr->TmrExpire == tick_cur) {                     /* If tmr expires on cur tick;   ...                    */
 
             obj  = p_tmr->Obj;                                  /* Get obj for ...                                      */
             fnct = p_tmr->Fnct;                                 /* ... tmr callback fnct.                               */
@@ -480,6 +602,104 @@ void  NetTmr_TaskHandler (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetTmr_TaskHandlerHiRes()
+*
+* Description : (1) Handle high-resolution network timers that have expired :
+*
+*                   (a) Return if head of High-Resolution Timer List NOT yet expired      See Note #3
+*                   (b) Acquire network lock
+*                   (c) For every expired timer at the head of the High-Resolution Timer List :
+*                       (1) Free timer
+*                       (2) Execute timer's callback function
+*                   (d) Release network lock
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_Task().
+*
+* Note(s)     : (2) NetTmr_TaskHandlerHiRes() blocked until network initialization completes.
+*
+*               (3) Since the Timer Task may be woken up before any high-resolution timer expires (see
+*                   'NetTmr_Task()  Note #4'), the global network lock is ONLY acquired if the head of the
+*                   High-Resolution Timer List has expired.
+*
+*               (4) The High-Resolution Timer List is sorted by expiration OS tick; thus ONLY timers at the
+*                   head of the list need to be checked.  Since the current OS tick is read only once &
+*                   every new timer expires on a later OS tick (see 'NetTmr_HiResInsert()  Note #1'), timers
+*                   re-started by timer callback functions are NOT handled until the next call.
+*
+*               (5) See 'NetTmr_TaskHandler()  Note #8'.
+*********************************************************************************************************
+*/
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+static  void  NetTmr_TaskHandlerHiRes (void)
+{
+    NET_TMR       *p_tmr;
+    KAL_TICK       tick_cur;
+    void          *obj;
+    CPU_FNCT_PTR   fnct;
+    CPU_BOOLEAN    expired;
+    KAL_ERR        err_kal;
+    NET_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, ...                            */
+        Net_InitCompWait(&err);                                 /* ... wait on net init (see Note #2).                  */
+        if (err != NET_ERR_NONE) {
+            return;
+        }
+    }
+
+    tick_cur = KAL_TickGet(&err_kal);
+                                                                /* ----------- CHK HI-RES TMR LIST HEAD EXP ----------- */
+    CPU_CRITICAL_ENTER();
+    p_tmr   = NetTmr_HiResListHead;
+    expired = ((p_tmr != DEF_NULL) &&
+              ((CPU_INT32S)(tick_cur - (KAL_TICK)p_tmr->TmrExpire) >= 0)) ? DEF_YES : DEF_NO;
+    CPU_CRITICAL_EXIT();
+    if (expired != DEF_YES) {                                   /* If head tmr NOT exp'd, rtn (see Note #3).            */
+        return;
+    }
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+    Net_GlobalLockAcquire((void *)&NetTmr_TaskHandlerHiRes, &err);
+    if (err != NET_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------- HANDLE HI-RES TMR LIST --------------- */
+    CPU_CRITICAL_ENTER();
+    p_tmr = NetTmr_HiResListHead;
+    while ((p_tmr != DEF_NULL) &&                               /* Handle exp'd head tmrs (see Note #4).                */
+           ((CPU_INT32S)(tick_cur - (KAL_TICK)p_tmr->TmrExpire) >= 0)) {
+
+        obj  = p_tmr->Obj;                                      /* Get obj for ...                                      */
+        fnct = p_tmr->Fnct;                                     /* ... tmr callback fnct.                               */
+
+        NetTmr_Free(p_tmr);                                     /* Free tmr (see Note #5); ...                          */
+
+        CPU_CRITICAL_EXIT();
+        if (fnct != DEF_NULL) {                                 /* ... & if avail,         ...                          */
+            fnct(obj);                                          /* ... exec tmr callback fnct.                          */
+        }
+        CPU_CRITICAL_ENTER();
+
+        p_tmr = NetTmr_HiResListHead;
+    }
+    CPU_CRITICAL_EXIT();
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            NetTmr_Get()
@@ -489,7 +709,7 @@ void  NetTmr_TaskHandler (void)
 *                   (a) Get        timer
 *                   (b) Validate   timer
 *                   (c) Initialize timer
-*                   (d) Insert     timer at head of Timer Task List
+*                   (d) Insert     timer into Timer Wheel
 *                   (e) Update timer pool statistics
 *                   (f) Return pointer to timer
 *                         OR
@@ -617,17 +837,11 @@ NET_TMR  *NetTmr_Get (CPU_FNCT_PTR    fnct,
     }
 
                                                                 /* --------------------- INIT TMR --------------------- */
-    p_tmr->PrevPtr = DEF_NULL;
-    p_tmr->NextPtr = (NET_TMR *)NetTmr_TaskListHead;
     p_tmr->Obj     =  obj;
     p_tmr->Fnct    =  fnct;
-    p_tmr->TmrVal  =  time;                                     /* Set tmr val (in ticks).                              */
 
-                                                                /* ---------- INSERT TMR INTO TMR TASK LIST ----------- */
-    if (NetTmr_TaskListHead != DEF_NULL) {                      /* If list NOT empty, insert before head.               */
-        NetTmr_TaskListHead->PrevPtr = p_tmr;
-    }
-    NetTmr_TaskListHead = p_tmr;                                /* Insert tmr @ list head (see Note #5).                */
+                                                                /* ------------ INSERT TMR INTO TMR WHEEL ------------- */
+    NetTmr_WheelInsert(p_tmr, time);                            /* See Note #5.                                         */
 
                                                                 /* --------------- UPDATE TMR POOL STATS -------------- */
     CPU_CRITICAL_EXIT();
@@ -646,7 +860,7 @@ NET_TMR  *NetTmr_Get (CPU_FNCT_PTR    fnct,
 *
 * Description : (1) Free a network timer :
 *
-*                   (a) Remove timer from Timer Task List
+*                   (a) Remove timer from Timer Wheel
 *                   (b) Clear  timer controls
 *                   (c) Free   timer back to timer pool
 *                   (d) Update timer pool statistics
@@ -680,14 +894,13 @@ NET_TMR  *NetTmr_Get (CPU_FNCT_PTR    fnct,
 *                   (a) Whenever the Timer Task List timer is freed, the Timer Task List timer MUST be
 *                       advanced to the next valid & available timer in the Timer Task List.
 *
-*                       See also 'NetTmr_TaskHandler()  Note #6a2'.
+*                       See also 'NetTmr_TaskHandler()  Note #6a2'
+*                              & 'NetTmr_WheelRemove()  Note #1'.
 *********************************************************************************************************
 */
 
 void  NetTmr_Free (NET_TMR  *p_tmr)
 {
-    NET_TMR  *p_tmr_prev;
-    NET_TMR  *p_tmr_next;
     NET_ERR   err;
     CPU_SR_ALLOC();
 
@@ -706,31 +919,8 @@ void  NetTmr_Free (NET_TMR  *p_tmr)
         return;                                                 /* Timer has already been freed. (see Note #2).         */
     }
 
-                                                                /* ----------- REMOVE TMR FROM TMR TASK LIST ---------- */
-    if (p_tmr == NetTmr_TaskListPtr) {                          /* If tmr is next Tmr Task tmr to update, ...           */
-        p_tmr_next          = NetTmr_TaskListPtr->NextPtr;
-        NetTmr_TaskListPtr  = p_tmr_next;                       /* ... adv Tmr Task ptr to skip this tmr (see Note #3a).*/
-    }
-
-    p_tmr_prev = p_tmr->PrevPtr;
-    p_tmr_next = p_tmr->NextPtr;
-    if (p_tmr_prev != DEF_NULL) {                               /* If tmr is NOT    the head of Tmr Task List, ...      */
-        p_tmr_prev->NextPtr  = p_tmr_next;                      /* ...  set prev tmr to skip tmr.                       */
-    } else {                                                    /* Else set next tmr as head of Tmr Task List.          */
-        NetTmr_TaskListHead = p_tmr_next;
-
-        if (p_tmr_next != DEF_NULL) {                           /* Clear the new head's prev tmr.                       */
-            p_tmr_next->PrevPtr = DEF_NULL;
-        }
-
-    }
-    if (p_tmr_next != DEF_NULL) {                               /* If tmr is NOT @  the tail of Tmr Task List, ...      */
-        p_tmr_next->PrevPtr  = p_tmr_prev;                      /* ...  set next tmr to skip tmr.                       */
-    } else {
-        if (p_tmr_prev != DEF_NULL) {
-            p_tmr_prev->NextPtr = DEF_NULL;                     /* Clear the new tail's next tmr.                       */
-        }
-    }
+                                                                /* ------------- REMOVE TMR FROM TMR WHEEL ------------ */
+    NetTmr_WheelRemove(p_tmr);                                  /* See Note #3a.                                        */
 
                                                                 /* --------------------- FREE TMR --------------------- */
     p_tmr->NextPtr = NetTmr_PoolPtr;
@@ -803,6 +993,9 @@ void  NetTmr_Free (NET_TMR  *p_tmr)
 *               (3) Timer value of 0 ticks/seconds allowed; next tick will expire timer.
 *
 *                   See also 'NetTmr_TaskHandler()  Note #7'.
+*
+*               (4) Since the timer's slot depends on its expiration tick, the timer is removed from its
+*                   current slot & inserted into its new slot (see 'NetTmr_TaskHandler()  Note #6a2').
 *********************************************************************************************************
 */
 
@@ -837,8 +1030,10 @@ void  NetTmr_Set (NET_TMR       *p_tmr,
         return;
     }
 
-    p_tmr->Fnct   = fnct;
-    p_tmr->TmrVal = time;
+    p_tmr->Fnct = fnct;
+                                                                /* Move tmr to its new slot (see Note #4).              */
+    NetTmr_WheelRemove(p_tmr);
+    NetTmr_WheelInsert(p_tmr, time);
 
     CPU_CRITICAL_EXIT();
 
@@ -846,6 +1041,238 @@ void  NetTmr_Set (NET_TMR       *p_tmr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetTmr_TimeRemainGet()
+*
+* Description : Get the number of ticks remaining before a network timer expires.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*
+* Return(s)   : Number of ticks remaining (in 'NET_TMR_TICK' ticks) [see Note #2].
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Assumes network timer is ALREADY owned by a valid network object.
+*
+*               (2) The remaining time does NOT include the additional tick added to each timer's count-
+*                   down (see 'NetTmr_TaskHandler()  Note #7'); i.e. a timer just set to 'time' ticks
+*                   returns 'time'.
+*
+*               (3) (a) The remaining time of a high-resolution timer is converted from OS ticks to network
+*                       timer ticks, rounded down.
+*
+*                   (b) The number of OS ticks per network timer tick is validated by NetTmr_TaskInit() (see
+*                       'NetTmr_TaskInit()  Note #1a1') but is NOT re-validated here; thus a null ratio is
+*                       handled as a single OS tick per network timer tick to prevent a division by zero.
+*********************************************************************************************************
+*/
+
+NET_TMR_TICK  NetTmr_TimeRemainGet (NET_TMR  *p_tmr)
+{
+    NET_TMR_TICK  time;
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    KAL_TICK      tick_cur;
+    KAL_TICK      tick_per_tmr_tick;
+    KAL_ERR       err_kal;
+#endif
+    CPU_SR_ALLOC();
+
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    tick_cur          = KAL_TickGet(&err_kal);
+    tick_per_tmr_tick = KAL_TickRate / NET_TMR_CFG_TASK_FREQ;
+    if (tick_per_tmr_tick < 1u) {                               /* See Note #3b.                                        */
+        tick_per_tmr_tick = 1u;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    if (p_tmr->HiRes == DEF_YES) {                              /* See Note #3a.                                        */
+        time = (NET_TMR_TICK)p_tmr->TmrExpire - (NET_TMR_TICK)tick_cur;
+        if ((CPU_INT32S)time < 0) {
+            time = 0u;
+        }
+        time = time / (NET_TMR_TICK)tick_per_tmr_tick;
+        CPU_CRITICAL_EXIT();
+        return (time);
+    }
+#endif
+    time = p_tmr->TmrExpire - NetTmr_TickCur - 1u;              /* See Note #2.                                         */
+    CPU_CRITICAL_EXIT();
+
+    return (time);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetTmr_Get_ms()
+*
+* Description : Allocate & initialize a high-resolution network timer.
+*
+* Argument(s) : fnct        Pointer to callback function to execute when timer expires (see 'NetTmr_Get()
+*                               Note #3').
+*
+*               obj         Pointer to object that requests a timer (MAY be NULL).
+*
+*               time_ms     Initial timer value (in milliseconds) [see Note #2].
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TMR_ERR_NONE                Network timer successfully allocated & initialized.
+*
+*                                                               --- RETURNED BY NetTmr_Get() : ----
+*                               NET_ERR_FAULT_NULL_FNCT         Argument 'fnct' passed a NULL pointer.
+*                               NET_TMR_ERR_NONE_AVAIL          NO available timers to allocate.
+*                               NET_TMR_ERR_IN_USE              Network timer from pool already in use.
+*
+* Return(s)   : Pointer to network timer, if NO error(s).
+*
+*               Pointer to NULL,          otherwise.
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) High-resolution timers are allocated from the same pool as network timers & are freed
+*                   by NetTmr_Free().
+*
+*               (2) (a) High-resolution timers are kept in the High-Resolution Timer List, sorted by the
+*                       OS tick on which they expire, rather than in the Timer Wheel.
+*
+*                   (b) High-resolution timers expire on the first OS tick after 'time_ms' milliseconds
+*                       have elapsed, regardless of NET_TMR_CFG_TASK_FREQ (see 'NetTmr_Task()  Note #4').
+*
+*                   See also 'NetTmr_HiResInsert()  Note #1'.
+*
+*               (3) The timer is first allocated as a network timer, then moved to the High-Resolution
+*                   Timer List.  Since network timers are ONLY handled with the global network lock
+*                   acquired, the timer CANNOT expire in between.
+*********************************************************************************************************
+*/
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+NET_TMR  *NetTmr_Get_ms (CPU_FNCT_PTR    fnct,
+                         void           *obj,
+                         CPU_INT32U      time_ms,
+                         NET_ERR        *p_err)
+{
+    NET_TMR      *p_tmr;
+    CPU_BOOLEAN   head;
+    KAL_ERR       err_kal;
+    CPU_SR_ALLOC();
+
+                                                                /* -------------------- GET TMR ----------------------- */
+    p_tmr = NetTmr_Get(fnct, obj, NET_TMR_TIME_0S, p_err);
+    if (*p_err != NET_TMR_ERR_NONE) {
+         return (DEF_NULL);
+    }
+
+                                                                /* ------ MOVE TMR INTO HI-RES TMR LIST (Note #3) ----- */
+    CPU_CRITICAL_ENTER();
+    NetTmr_WheelRemove(p_tmr);
+    head = NetTmr_HiResInsert(p_tmr, time_ms);
+    CPU_CRITICAL_EXIT();
+
+    if (head == DEF_YES) {                                      /* If new list head, signal tmr task.                   */
+        KAL_SemPost(NetTmr_HiResSignal, KAL_OPT_POST_NONE, &err_kal);
+    }
+
+    return (p_tmr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           NetTmr_Set_ms()
+*
+* Description : Update a network timer with a new callback function & high-resolution timer value.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*
+*               fnct        Pointer to callback function to execute when timer expires (see 'NetTmr_Set()
+*                               Note #2').
+*
+*               time_ms     Update timer value (in milliseconds) [see 'NetTmr_Get_ms()  Note #2'].
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TMR_ERR_NONE                Network timer time successfully updated.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_tmr' passed a NULL pointer.
+*                               NET_ERR_FAULT_NULL_FNCT         Argument 'fnct' passed a NULL pointer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : various.
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Assumes network timer is ALREADY owned by a valid network object.
+*
+*               (2) Network timers & high-resolution timers MAY be updated by either NetTmr_Set() or
+*                   NetTmr_Set_ms(); the timer is moved to the Timer Wheel or High-Resolution Timer List
+*                   accordingly.
+*********************************************************************************************************
+*/
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+void  NetTmr_Set_ms (NET_TMR       *p_tmr,
+                     CPU_FNCT_PTR   fnct,
+                     CPU_INT32U     time_ms,
+                     NET_ERR       *p_err)
+{
+    CPU_BOOLEAN  head;
+    KAL_ERR      err_kal;
+    CPU_SR_ALLOC();
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ------------------ VALIDATE PTRS ------------------- */
+    if (p_tmr == DEF_NULL) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Tmr.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+
+    if (fnct == DEF_NULL) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Tmr.NullFnctCtr);
+       *p_err = NET_ERR_FAULT_NULL_FNCT;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+
+    if (p_tmr->Fnct == DEF_NULL) {
+        CPU_CRITICAL_EXIT();
+       *p_err = NET_ERR_FAULT_NULL_PTR;                         /* Trying to update a timer that's been freed           */
+        return;
+    }
+
+    p_tmr->Fnct = fnct;
+                                                                /* Move tmr to its new pos (see Note #2).               */
+    NetTmr_WheelRemove(p_tmr);
+    head = NetTmr_HiResInsert(p_tmr, time_ms);
+
+    CPU_CRITICAL_EXIT();
+
+    if (head == DEF_YES) {                                      /* If new list head, signal tmr task.                   */
+        KAL_SemPost(NetTmr_HiResSignal, KAL_OPT_POST_NONE, &err_kal);
+    }
+
+   *p_err = NET_TMR_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        NetTmr_PoolStatGet()
@@ -971,9 +1398,235 @@ void  NetTmr_PoolStatResetMaxUsed (void)
 
 static  void  NetTmr_Clr (NET_TMR  *p_tmr)
 {
+    p_tmr->PrevPtr   = DEF_NULL;
+    p_tmr->NextPtr   = DEF_NULL;
+    p_tmr->Obj       = DEF_NULL;
+    p_tmr->Fnct      = DEF_NULL;
+    p_tmr->TmrExpire = NET_TMR_TIME_0S;
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    p_tmr->HiRes     = DEF_NO;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetTmr_WheelInsert()
+*
+* Description : Insert a network timer at the head of its Timer Wheel slot.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*               ----        Argument validated in NetTmr_Get(),
+*                                                 NetTmr_Set().
+*
+*               time        Timer value (in 'NET_TMR_TICK' ticks).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_Get(),
+*               NetTmr_Set().
+*
+* Note(s)     : (1) The timer expires on tick (current tick + 'time' + 1); see 'NetTmr_TaskHandler()
+*                   Note #7'.  Tick arithmetic wraps around; a timer set to NET_TMR_TIME_INFINITE expires
+*                   after 2^32 ticks.
+*
+*               (2) MUST be called with the critical section entered.
+*********************************************************************************************************
+*/
+
+static  void  NetTmr_WheelInsert (NET_TMR       *p_tmr,
+                                  NET_TMR_TICK   time)
+{
+    NET_TMR      **p_slot;
+
+
+    p_tmr->TmrExpire = NetTmr_TickCur + time + 1u;              /* See Note #1.                                         */
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    p_tmr->HiRes     = DEF_NO;
+#endif
+
+    p_slot           = &NetTmr_Wheel[p_tmr->TmrExpire & (NET_TMR_CFG_WHEEL_SIZE - 1u)];
+    p_tmr->PrevPtr   =  DEF_NULL;
+    p_tmr->NextPtr   = *p_slot;
+    if (*p_slot != DEF_NULL) {                                  /* If slot NOT empty, insert before head.               */
+      (*p_slot)->PrevPtr = p_tmr;
+    }
+   *p_slot = p_tmr;                                             /* Insert tmr @ slot head.                              */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetTmr_WheelRemove()
+*
+* Description : Remove a network timer from its Timer Wheel slot.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*               ----        Argument validated in NetTmr_Free(),
+*                                                 NetTmr_Set().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_Free(),
+*               NetTmr_Set(),
+*               NetTmr_Get_ms(),
+*               NetTmr_Set_ms().
+*
+* Note(s)     : (1) If the timer is the next timer to be handled by NetTmr_TaskHandler(), the Timer Task
+*                   List timer is advanced to skip it (see 'NetTmr_TaskHandler()  Note #6a2').
+*
+*               (2) MUST be called with the critical section entered.
+*
+*               (3) High-resolution timers are NOT in the Timer Wheel & are removed from the High-Resolution
+*                   Timer List instead (see 'NetTmr_Get_ms()  Note #2a').
+*********************************************************************************************************
+*/
+
+static  void  NetTmr_WheelRemove (NET_TMR  *p_tmr)
+{
+    NET_TMR  *p_tmr_prev;
+    NET_TMR  *p_tmr_next;
+
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    if (p_tmr->HiRes == DEF_YES) {                              /* See Note #3.                                         */
+        NetTmr_HiResRemove(p_tmr);
+        return;
+    }
+#endif
+
+    if (p_tmr == NetTmr_TaskListPtr) {                          /* If tmr is next Tmr Task tmr to update, ...           */
+        NetTmr_TaskListPtr = p_tmr->NextPtr;                    /* ... adv Tmr Task ptr to skip this tmr (see Note #1). */
+    }
+
+    p_tmr_prev = p_tmr->PrevPtr;
+    p_tmr_next = p_tmr->NextPtr;
+    if (p_tmr_prev != DEF_NULL) {                               /* If tmr is NOT    the head of its slot, ...           */
+        p_tmr_prev->NextPtr = p_tmr_next;                       /* ...  set prev tmr to skip tmr.                       */
+    } else {                                                    /* Else set next tmr as head of slot.                   */
+        NetTmr_Wheel[p_tmr->TmrExpire & (NET_TMR_CFG_WHEEL_SIZE - 1u)] = p_tmr_next;
+    }
+    if (p_tmr_next != DEF_NULL) {                               /* If tmr is NOT @  the tail of its slot, ...           */
+        p_tmr_next->PrevPtr = p_tmr_prev;                       /* ...  set next tmr to skip tmr.                       */
+    }
+
     p_tmr->PrevPtr = DEF_NULL;
     p_tmr->NextPtr = DEF_NULL;
-    p_tmr->Obj     = DEF_NULL;
-    p_tmr->Fnct    = DEF_NULL;
-    p_tmr->TmrVal  = NET_TMR_TIME_0S;
 }
+
+
+/*
+*********************************************************************************************************
+*                                        NetTmr_HiResInsert()
+*
+* Description : Insert a network timer into the High-Resolution Timer List, sorted by expiration OS tick.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*               ----        Argument validated in NetTmr_Get_ms(),
+*                                                 NetTmr_Set_ms().
+*
+*               time_ms     Timer value (in milliseconds).
+*
+* Return(s)   : DEF_YES, if timer inserted at the head of the High-Resolution Timer List.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetTmr_Get_ms(),
+*               NetTmr_Set_ms().
+*
+* Note(s)     : (1) The timer value is rounded up to OS ticks, & one additional OS tick is added since the
+*                   current OS tick is already partially elapsed; the timer thus expires after at least
+*                   'time_ms' milliseconds.
+*
+*               (2) Timers with the same expiration OS tick are kept in insertion order.
+*
+*               (3) MUST be called with the critical section entered.
+*********************************************************************************************************
+*/
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  NetTmr_HiResInsert (NET_TMR     *p_tmr,
+                                         CPU_INT32U   time_ms)
+{
+    NET_TMR   *p_tmr_prev;
+    NET_TMR   *p_tmr_next;
+    KAL_TICK   tick_cur;
+    KAL_TICK   time_tick;
+    KAL_TICK   tick_expire;
+    KAL_ERR    err_kal;
+
+
+    tick_cur    = KAL_TickGet(&err_kal);
+                                                                /* Conv ms to OS ticks, rounded up (see Note #1).       */
+    time_tick   = ((time_ms / DEF_TIME_NBR_mS_PER_SEC) *  KAL_TickRate)
+                + ((time_ms % DEF_TIME_NBR_mS_PER_SEC) *  KAL_TickRate + (DEF_TIME_NBR_mS_PER_SEC - 1u)) / DEF_TIME_NBR_mS_PER_SEC;
+    tick_expire = tick_cur + time_tick + 1u;
+
+    p_tmr->TmrExpire = (NET_TMR_TICK)tick_expire;
+    p_tmr->HiRes     =  DEF_YES;
+
+    p_tmr_prev = DEF_NULL;                                      /* Find first tmr expiring after tmr (see Note #2).     */
+    p_tmr_next = NetTmr_HiResListHead;
+    while ((p_tmr_next != DEF_NULL) &&
+           ((CPU_INT32S)((KAL_TICK)p_tmr_next->TmrExpire - tick_expire) <= 0)) {
+        p_tmr_prev = p_tmr_next;
+        p_tmr_next = p_tmr_next->NextPtr;
+    }
+
+    p_tmr->PrevPtr = p_tmr_prev;
+    p_tmr->NextPtr = p_tmr_next;
+    if (p_tmr_next != DEF_NULL) {
+        p_tmr_next->PrevPtr = p_tmr;
+    }
+    if (p_tmr_prev != DEF_NULL) {
+        p_tmr_prev->NextPtr = p_tmr;
+        return (DEF_NO);
+    }
+
+    NetTmr_HiResListHead = p_tmr;                               /* Insert tmr @ list head.                              */
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetTmr_HiResRemove()
+*
+* Description : Remove a network timer from the High-Resolution Timer List.
+*
+* Argument(s) : p_tmr       Pointer to a network timer.
+*               ----        Argument validated in NetTmr_WheelRemove().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTmr_WheelRemove().
+*
+* Note(s)     : (1) MUST be called with the critical section entered.
+*********************************************************************************************************
+*/
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+static  void  NetTmr_HiResRemove (NET_TMR  *p_tmr)
+{
+    NET_TMR  *p_tmr_prev;
+    NET_TMR  *p_tmr_next;
+
+
+    p_tmr_prev = p_tmr->PrevPtr;
+    p_tmr_next = p_tmr->NextPtr;
+    if (p_tmr_prev != DEF_NULL) {                               /* If tmr is NOT the list head, ...                     */
+        p_tmr_prev->NextPtr  = p_tmr_next;                      /* ... set prev tmr to skip tmr.                        */
+    } else {                                                    /* Else set next tmr as list head.                      */
+        NetTmr_HiResListHead = p_tmr_next;
+    }
+    if (p_tmr_next != DEF_NULL) {
+        p_tmr_next->PrevPtr  = p_tmr_prev;
+    }
+
+    p_tmr->PrevPtr = DEF_NULL;
+    p_tmr->NextPtr = DEF_NULL;
+    p_tmr->HiRes   = DEF_NO;
+}
+#endif
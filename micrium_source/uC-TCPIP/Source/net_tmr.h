@@ -59,6 +59,45 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                 NETWORK TIMER WHEEL DEFAULT CONFIGURATION
+*
+* Note(s) : (1) NET_TMR_CFG_WHEEL_SIZE configures the number of slots of the network Timer Wheel (see
+*               'net_tmr.c  NetTmr_TaskHandler()  Note #2') :
+*
+*               (a) MUST be a power of 2.
+*
+*               (b) SHOULD be at least the number of timers expected to be simultaneously active, divided
+*                   by the average number of timers to handle per tick.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_TMR_CFG_WHEEL_SIZE
+#define  NET_TMR_CFG_WHEEL_SIZE                         256u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                            NETWORK TIMER HIGH-RESOLUTION DEFAULT CONFIGURATION
+*
+* Note(s) : (1) NET_TMR_CFG_HI_RES_EN enables/disables millisecond network timers, which expire on OS ticks
+*               rather than on network timer task ticks (see 'net_tmr.c  NetTmr_Get_ms()  Note #2') :
+*
+*               (a) The Timer Task is woken up between its NET_TMR_CFG_TASK_FREQ ticks to expire high-
+*                   resolution timers; their resolution is thus limited ONLY by KAL_TickRate.
+*
+*               (b) TCP retransmission, delayed acknowledgement & persist timers use high-resolution
+*                   timers (see 'net_tcp.h  TCP ROUND-TRIP TIME (RTT) / RE-TRANSMIT TIMEOUT (RTO) DEFINES
+*                   Note #4').
+*********************************************************************************************************
+*/
+
+#ifndef  NET_TMR_CFG_HI_RES_EN
+#define  NET_TMR_CFG_HI_RES_EN                  DEF_DISABLED
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -145,10 +184,13 @@ typedef  NET_FLAGS  NET_TMR_FLAGS;
 *                                |-------------|       Object       |  Object   |
 *                                |      O----------> Expiration     |   that    |
 *                                |-------------|      Function      | requested |
-*                                |   Current   |                    |   Timer   |
-*                                | Timer value |                    |           |
+*                                | Expiration  |                    |   Timer   |
+*                                |    tick     |                    |           |
 *                                |-------------|                    -------------
 *
+*
+* Note(s) : (1) For high-resolution timers, 'TmrExpire' holds the OS tick on which the timer expires (see
+*               'net_tmr.c  NetTmr_Get_ms()  Note #2').
 *********************************************************************************************************
 */
 
@@ -162,7 +204,10 @@ struct  net_tmr {
     void           *Obj;                                        /* Ptr to obj  using TMR.                               */
     CPU_FNCT_PTR    Fnct;                                       /* Ptr to fnct used on obj when TMR expires.            */
 
-    NET_TMR_TICK    TmrVal;                                     /* Cur tmr val (in NET_TMR_TICK ticks).                 */
+    NET_TMR_TICK    TmrExpire;                                  /* Tick on which tmr expires (in NET_TMR_TICK ticks).   */
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)
+    CPU_BOOLEAN     HiRes;                                      /* Indicates hi-res tmr      (see Note #1).             */
+#endif
 };
 
 
@@ -226,6 +271,21 @@ void            NetTmr_Set                 (      NET_TMR        *p_tmr,
                                                   NET_TMR_TICK    time,
                                                   NET_ERR        *p_err);
 
+NET_TMR_TICK    NetTmr_TimeRemainGet       (      NET_TMR        *p_tmr);
+
+
+#if (NET_TMR_CFG_HI_RES_EN == DEF_ENABLED)                      /* -------------- HI-RES TMR (ms) FNCTS --------------- */
+NET_TMR        *NetTmr_Get_ms              (      CPU_FNCT_PTR    fnct,
+                                                  void           *obj,
+                                                  CPU_INT32U      time_ms,
+                                                  NET_ERR        *p_err);
+
+void            NetTmr_Set_ms              (      NET_TMR        *p_tmr,
+                                                  CPU_FNCT_PTR    fnct,
+                                                  CPU_INT32U      time_ms,
+                                                  NET_ERR        *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -259,6 +319,28 @@ void            NetTmr_Set                 (      NET_TMR        *p_tmr,
 
 
 
+#if     (NET_TMR_CFG_WHEEL_SIZE < 1u)
+#error  "NET_TMR_CFG_WHEEL_SIZE illegally #define'd in 'net_cfg.h'"
+#error  "                       [MUST be  >= 1]                   "
+
+#elif  ((NET_TMR_CFG_WHEEL_SIZE & (NET_TMR_CFG_WHEEL_SIZE - 1u)) != 0u)
+#error  "NET_TMR_CFG_WHEEL_SIZE illegally #define'd in 'net_cfg.h'"
+#error  "                       [MUST be  a power of 2]           "
+#endif
+
+
+
+
+#if    ((NET_TMR_CFG_HI_RES_EN != DEF_DISABLED) && \
+        (NET_TMR_CFG_HI_RES_EN != DEF_ENABLED ))
+#error  "NET_TMR_CFG_HI_RES_EN  illegally #define'd in 'net_cfg.h'"
+#error  "                       [MUST be  DEF_DISABLED]           "
+#error  "                       [     ||  DEF_ENABLED ]           "
+#endif
+
+
+
+
 #ifndef  NET_TMR_CFG_TASK_FREQ
 #error  "NET_TMR_CFG_TASK_FREQ        not #define'd in 'net_cfg.h'"
 #error  "                       [MUST be  > 0 Hz]                 "
@@ -133,6 +133,7 @@ typedef  CPU_INT16U  NET_CHK_SUM;
 
 typedef  CPU_INT32U  NET_TS;
 typedef  NET_TS      NET_TS_MS;
+typedef  NET_TS      NET_TS_US;
 
 
 /*
@@ -151,6 +152,8 @@ typedef  CPU_INT16U  NET_BUF_QTY;                               /* Defines max q
 
 typedef  struct  net_buf  NET_BUF;
 
+typedef  struct  net_buf_io_vec  NET_BUF_IO_VEC;
+
 
 /*
 *********************************************************************************************************
@@ -400,11 +403,19 @@ typedef  CPU_INT16U  NET_TCP_HDR_FLAGS;
 *
 * Note(s) : (1) 'NET_TCP_WIN_SIZE' pre-defined in 'net_type.h' PRIOR to all other network modules that
 *                require TCP window size data type(s).
+*
+*           (2) TCP window sizes are kept un-scaled in 32-bit values so that windows larger than the
+*               16-bit TCP header window field may be configured when the TCP Window Scale option is
+*               enabled (see RFC #7323, Section 2.2).  Window sizes are ONLY limited to 16-bit values
+*               when (de-)encoded in TCP headers (see 'net_tcp.h  TCP WINDOW SIZE DEFINES  Note #2').
+*
+*               Since 'net_type.h' is included by 'net_cfg.h' PRIOR to any network configuration,
+*               the window size data type can NOT depend on 'NET_TCP_CFG_WIN_SCALE_EN'.
 *********************************************************************************************************
 */
 
-                                                                /* See Note #1.                                         */
-typedef  CPU_INT16U  NET_TCP_WIN_SIZE;
+                                                                /* See Notes #1 & #2.                                   */
+typedef  CPU_INT32U  NET_TCP_WIN_SIZE;
 
 /*
 *********************************************************************************************************
@@ -413,12 +424,12 @@ typedef  CPU_INT16U  NET_TCP_WIN_SIZE;
 * Note(s) : (1) RTT measurement data types MUST be defined to ensure sufficient range for both scaled
 *               & un-scaled, signed & unsigned time measurement values.
 *
-*           (2) 'NET_TCP_TX_RTT_TS_MS' pre-defined in 'net_type.h' PRIOR to all other network modules
+*           (2) 'NET_TCP_TX_RTT_TS' pre-defined in 'net_type.h' PRIOR to all other network modules
 *                that require TCP Transmit Round-Trip Time data type(s).
 *********************************************************************************************************
 */
                                                                 /* See Note #2.                                         */
-typedef  NET_TS_MS   NET_TCP_TX_RTT_TS_MS;
+typedef  NET_TS      NET_TCP_TX_RTT_TS;
 
 
 /*
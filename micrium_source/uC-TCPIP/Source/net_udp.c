@@ -342,6 +342,97 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *********************************************************************************************************
 *                                         NetUDP_RxAppData()
 *
+* Description : Deframe application data from received UDP packet buffer(s) into a contiguous application
+*               buffer.
+*
+* Argument(s) : p_buf                Pointer to network buffer that received UDP datagram.
+*
+*               pdata_buf           Pointer to application buffer to receive application data.
+*
+*               data_buf_len        Size    of application receive buffer (in octets).
+*
+*               flags               Flags to select receive options; bit-field flags logically OR'd :
+*
+*                                       NET_UDP_FLAG_NONE               No      UDP receive flags selected.
+*                                       NET_UDP_FLAG_RX_DATA_PEEK       Receive UDP application data without consuming
+*                                                                           the data; i.e. do NOT free any UDP receive
+*                                                                           packet buffer(s).
+*
+*               pip_opts_buf        Pointer to buffer to receive possible IP options, if NO error(s).
+*
+*               ip_opts_buf_len     Size of IP options receive buffer (in octets).
+*
+*               pip_opts_len        Pointer to variable that will receive the return size of any received IP options,
+*                                       if NO error(s).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               ------- RETURNED BY NetUDP_RxAppDataV() : -------
+*                               NET_UDP_ERR_NONE                UDP application data successfully deframed; check
+*                                                                   return value for number of data octets received.
+*                               NET_UDP_ERR_INVALID_DATA_SIZE   UDP data receive buffer insufficient size; some,
+*                                                                   but not all, UDP application data deframed
+*                                                                   into receive buffer.
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_ERR_FAULT_NULL_PTR            Argument 'p_buf'/'pdata_buf' passed a NULL pointer.
+*                               NET_UDP_ERR_INVALID_FLAG        Invalid UDP flags.
+*                               NET_UDP_ERR_INVALID_ARG         Invalid argument(s).
+*                               NET_ERR_RX                      Receive error; packet discarded.
+*
+* Return(s)   : Total application data octets deframed into receive buffer, if NO error(s).
+*
+*               0,                                                          otherwise.
+*
+* Caller(s)   : NetSock_RxDataHandlerDatagram().
+*
+*               This function is a network protocol suite application programming interface (API) function & MAY
+*               be called by application function(s) [see also Note #1].
+*
+* Note(s)     : (1) NetUDP_RxAppData() MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetUDP_RxAppDataV()  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
+                              void           *pdata_buf,
+                              CPU_INT16U      data_buf_len,
+                              NET_UDP_FLAGS   flags,
+                              void           *pip_opts_buf,
+                              CPU_INT08U      ip_opts_buf_len,
+                              CPU_INT08U     *pip_opts_len,
+                              NET_ERR        *p_err)
+{
+    NET_BUF_IO_VEC   iov_data;
+    NET_BUF_IO_VEC  *p_iov;
+    CPU_INT16U       data_len_tot;
+
+
+    p_iov = (NET_BUF_IO_VEC *)0;
+    if (pdata_buf != (void *)0) {                               /* Rx into app buf as single iov.                       */
+        iov_data.DataPtr =  pdata_buf;
+        iov_data.DataLen =  data_buf_len;
+        p_iov            = &iov_data;
+    }
+
+    data_len_tot = NetUDP_RxAppDataV(p_buf,
+                                     p_iov,
+                                     1u,
+                                     data_buf_len,
+                                     flags,
+                                     pip_opts_buf,
+                                     ip_opts_buf_len,
+                                     pip_opts_len,
+                                     p_err);
+
+    return (data_len_tot);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetUDP_RxAppDataV()
+*
 * Description : (1) Deframe application data from received UDP packet buffer(s) :
 *
 *                   (a) Validate receive packet buffer(s)
@@ -354,9 +445,11 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *
 * Argument(s) : p_buf                Pointer to network buffer that received UDP datagram.
 *
-*               pdata_buf           Pointer to application buffer to receive application data.
+*               p_iov               Pointer to array of I/O vectors to scatter application data into (see Note #11).
+*
+*               iov_cnt             Number of I/O vectors in array.
 *
-*               data_buf_len        Size    of application receive buffer (in octets) [see Note #4].
+*               data_buf_len        Size    of application receive buffer(s) (in octets) [see Note #4].
 *
 *               flags               Flags to select receive options (see Note #5); bit-field flags logically OR'd :
 *
@@ -381,7 +474,7 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *                                                                   into receive buffer (see Note #4b).
 *
 *                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
-*                               NET_ERR_FAULT_NULL_PTR            Argument 'p_buf'/'pdata_buf' passed a NULL pointer.
+*                               NET_ERR_FAULT_NULL_PTR            Argument 'p_buf'/'p_iov' passed a NULL pointer.
 *                               NET_UDP_ERR_INVALID_FLAG        Invalid UDP flags.
 *                               NET_UDP_ERR_INVALID_ARG         Invalid argument(s).
 *
@@ -392,17 +485,17 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *
 *               0,                                                          otherwise.
 *
-* Caller(s)   : NetUDP_RxAppDataHandler(),
+* Caller(s)   : NetUDP_RxAppData(),
 *               NetSock_RxDataHandlerDatagram().
 *
 *               This function is a network protocol suite application programming interface (API) function & MAY
 *               be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetUDP_RxAppData() MUST be called with the global network lock already acquired.
+* Note(s)     : (2) NetUDP_RxAppDataV() MUST be called with the global network lock already acquired.
 *
 *                   See also 'NetUDP_RxPktDemuxAppData()  Note #1a1A1b'.
 *
-*               (3) NetUDP_RxAppData() blocked until network initialization completes.
+*               (3) NetUDP_RxAppDataV() blocked until network initialization completes.
 *
 *               (4) (a) Application data receive buffer should be large enough to receive either ...
 *
@@ -414,7 +507,7 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *                       the remaining application data octets are discarded & NET_UDP_ERR_INVALID_DATA_SIZE error
 *                       is returned.
 *
-*               (5) If UDP receive flag options that are NOT implemented are requested, NetUDP_RxAppData() aborts
+*               (5) If UDP receive flag options that are NOT implemented are requested, NetUDP_RxAppDataV() aborts
 *                   & returns appropriate error codes so that requested flag options are NOT silently ignored.
 *
 *               (6) (a) If ...
@@ -456,20 +549,24 @@ void  NetUDP_Rx (NET_BUF  *p_buf,
 *
 *                   (b) On any external application errors, UDP receive packets are NOT discarded;
 *                       the application MAY continue to attempt to receive the application data
-*                       via NetUDP_RxAppData().
+*                       via NetUDP_RxAppDataV().
 *
 *              (10) IP options arguments may NOT be necessary.
+*
+*              (11) The datagram is scattered across the I/O vectors in order, as if they formed a single
+*                   contiguous application buffer of 'data_buf_len' octets.
 *********************************************************************************************************
 */
 
-CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
-                              void           *pdata_buf,
-                              CPU_INT16U      data_buf_len,
-                              NET_UDP_FLAGS   flags,
-                              void           *pip_opts_buf,
-                              CPU_INT08U      ip_opts_buf_len,
-                              CPU_INT08U     *pip_opts_len,
-                              NET_ERR        *p_err)
+CPU_INT16U  NetUDP_RxAppDataV (NET_BUF         *p_buf,
+                               NET_BUF_IO_VEC  *p_iov,
+                               CPU_INT16U       iov_cnt,
+                               CPU_INT16U       data_buf_len,
+                               NET_UDP_FLAGS    flags,
+                               void            *pip_opts_buf,
+                               CPU_INT08U       ip_opts_buf_len,
+                               CPU_INT08U      *pip_opts_len,
+                               NET_ERR         *p_err)
 {
 #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
@@ -490,7 +587,6 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
     NET_BUF_SIZE    data_len_pkt;
     CPU_INT16U      data_len_buf_rem;
     CPU_INT16U      data_len_tot;
-    CPU_INT08U     *p_data;
 
     NET_ERR         err;
     NET_ERR         err_rtn;
@@ -534,7 +630,7 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
     }
 
                                                                 /* --------------- VALIDATE RX DATA BUF --------------- */
-    if (pdata_buf == (CPU_INT08U *)0) {
+    if (p_iov == (NET_BUF_IO_VEC *)0) {
        *p_err =  NET_ERR_FAULT_NULL_PTR;                           /* See Note #9b.                                        */
         return (0u);
     }
@@ -586,7 +682,6 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
                                                                 /* ------------- DEFRAME UDP APP RX DATA -------------- */
     p_buf_head       =  p_buf;
     p_buf_head_hdr   = &p_buf_head->Hdr;
-    p_data           = (CPU_INT08U *)pdata_buf;
     data_len_buf_rem =  data_buf_len;
     data_len_tot     =  0u;
     err_rtn          =  NET_UDP_ERR_NONE;
@@ -604,17 +699,18 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
             err_rtn      =  NET_UDP_ERR_INVALID_DATA_SIZE;      /* ... & rtn data size err code (see Note #4b).         */
         }
 
-        NetBuf_DataRd(p_buf,
-                      p_buf_hdr->DataIx,
-                      data_len_pkt,
-                      p_data,
-                     &err);
+        NetBuf_DataRdV(p_buf,                                   /* Scatter pkt buf data into iovs (see Note #11).       */
+                       p_buf_hdr->DataIx,
+                       data_len_pkt,
+                       p_iov,
+                       iov_cnt,
+                       data_len_tot,
+                      &err);
         if (err != NET_BUF_ERR_NONE) {                          /* See Note #9a.                                        */
             NetUDP_RxPktDiscard(p_buf_head, p_err);
             return (0u);
         }
-                                                                /* Update data ptr & lens.                              */
-        p_data           +=             data_len_pkt;           /* MUST NOT cast ptr operand (see Note #8b).            */
+                                                                /* Update data lens.                                    */
         data_len_tot     += (CPU_INT16U)data_len_pkt;
         data_len_buf_rem -= (CPU_INT16U)data_len_pkt;
 
@@ -636,6 +732,88 @@ CPU_INT16U  NetUDP_RxAppData (NET_BUF        *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                     NetUDP_RxAppDataZeroCopy()
+*
+* Description : Prepare a received UDP datagram to be lent to the application WITHOUT copying.
+*
+* Argument(s) : p_buf       Pointer to network buffer that received UDP datagram.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_UDP_ERR_NONE                UDP datagram successfully prepared.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf' passed a NULL pointer.
+*                               NET_ERR_RX                      Invalid/unused network buffer.
+*
+* Return(s)   : Total application data octets in the datagram's packet buffer(s), if NO error(s).
+*
+*               0,                                                               otherwise.
+*
+* Caller(s)   : NetSock_RxDataHandlerDatagram().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The datagram is unlinked from any other packet buffers/chains but NOT freed; the caller
+*                   owns the packet buffer(s) & MUST eventually free them.
+*
+*               (2) Each packet buffer's data index & length already describe ONLY the UDP application data
+*                   (see 'NetUDP_RxAppData()  DEFRAME UDP APP RX DATA').
+*
+*               (3) Any received IP options are NOT returned.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+CPU_INT16U  NetUDP_RxAppDataZeroCopy (NET_BUF  *p_buf,
+                                      NET_ERR  *p_err)
+{
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+    CPU_BOOLEAN   used;
+#endif
+    NET_BUF      *p_buf_frag;
+    NET_BUF_HDR  *p_buf_hdr;
+    CPU_INT16U    data_len_tot;
+
+
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+                                                                /* --------------- VALIDATE RX PKT BUFS --------------- */
+    if (p_buf == (NET_BUF *)0) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (0u);
+    }
+
+    used = NetBuf_IsUsed(p_buf);
+    if (used != DEF_YES) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.UDP.RxPktDiscardedCtr);
+       *p_err =  NET_ERR_RX;
+        return (0u);
+    }
+#endif
+
+    data_len_tot = 0u;                                          /* Calc datagram's tot data len (see Note #2).          */
+    p_buf_frag   = p_buf;
+    while (p_buf_frag != (NET_BUF *)0) {
+        p_buf_hdr     = &p_buf_frag->Hdr;
+        data_len_tot += (CPU_INT16U)p_buf_hdr->DataLen;
+        p_buf_frag    =  p_buf_hdr->NextBufPtr;
+    }
+
+    p_buf_hdr                  = &p_buf->Hdr;                   /* Unlink from any other pkt bufs/chains (see Note #1). */
+    p_buf_hdr->NextPrimListPtr = (NET_BUF *)0;
+    p_buf_hdr->PrevPrimListPtr = (NET_BUF *)0;
+
+
+   *p_err =  NET_UDP_ERR_NONE;
+
+    return (data_len_tot);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetUDP_TxAppData()
@@ -803,6 +981,8 @@ CPU_INT16U  NetUDP_TxAppDataIPv4 (void              *p_data,
     }
                                                                 /* Tx UDP app data.                                     */
     data_len_tot = NetUDP_TxAppDataHandlerIPv4(p_data,
+                                               DEF_NULL,
+                                               0u,
                                                data_len,
                                                src_addr,
                                                src_port,
@@ -991,6 +1171,8 @@ CPU_INT16U  NetUDP_TxAppDataIPv6 (void                    *p_data,
     }
                                                                 /* Tx UDP app data.                                     */
     data_len_tot = NetUDP_TxAppDataHandlerIPv6(p_data,
+                                               DEF_NULL,
+                                               0u,
                                                data_len,
                                                p_src_addr,
                                                src_port,
@@ -1027,7 +1209,12 @@ exit_lock_fault:
 *                       (5) Free UDP packet buffer(s)
 *
 *
-* Argument(s) : p_data      Pointer to application data.
+* Argument(s) : p_data      Pointer to application data, if NOT transmitted from I/O vectors.
+*
+*               p_iov       Pointer to array of I/O vectors to gather application data from (see Note #7),
+*                               if available; otherwise, NULL pointer.
+*
+*               iov_cnt     Number of I/O vectors in array.
 *
 *               data_len    Length  of application data (in octets) [see Note #5].
 *
@@ -1150,10 +1337,19 @@ exit_lock_fault:
 *                   (b) 'data_len' of 0 octets NOT allowed.
 *
 *               (6) On ANY transmit error, any remaining application data transmit is immediately aborted.
+*
+*               (7) Application data scattered across several I/O vectors is gathered directly into the
+*                   datagram's transmit buffer so that the datagram is transmitted atomically (see Note #5a1).
+*
+*               (8) If transmit check-sums are calculated in software, the application data's check-sum
+*                   sum is calculated while the data is copied into the transmit buffer & is NOT re-read
+*                   by the UDP check-sum calculation (see 'net_buf.c  NetBuf_DataWrSumV()  Note #1').
 *********************************************************************************************************
 */
 #ifdef  NET_IPv4_MODULE_EN
 CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
+                                         NET_BUF_IO_VEC     *p_iov,
+                                         CPU_INT16U          iov_cnt,
                                          CPU_INT16U          data_len,
                                          NET_IPv4_ADDR       src_addr,
                                          NET_UDP_PORT_NBR    src_port,
@@ -1177,6 +1373,10 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     NET_BUF_SIZE    data_len_pkt;
     CPU_INT16U      data_len_tot;
     CPU_INT08U     *p_data_pkt;
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+    NET_BUF_IO_VEC  iov_data;
+#endif
     NET_ERR         err;
 
 
@@ -1196,7 +1396,8 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
 #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
                                                                 /* ---------------- VALIDATE APP DATA ----------------- */
-    if (p_data == (void *)0) {
+    if ((p_data == (void           *)0) &&
+        (p_iov  == (NET_BUF_IO_VEC *)0)) {
        *p_err =  NET_ERR_FAULT_NULL_PTR;
         return (0u);
     }
@@ -1273,11 +1474,38 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     }
 
     data_ix_pkt += data_ix_pkt_offset;
-    NetBuf_DataWr(p_buf,                           /* Wr app data into app data tx buf.                    */
-                  data_ix_pkt,
-                  data_len_pkt,
-                  p_data_pkt,
-                  p_err);
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+    if (p_iov == (NET_BUF_IO_VEC *)0) {
+        iov_data.DataPtr = (void *)p_data_pkt;
+        iov_data.DataLen =  data_len_pkt;
+        p_iov            = &iov_data;
+        iov_cnt          =  1u;
+    }
+    NetBuf_DataWrSumV(p_buf,                                    /* Wr & sum app data into app data tx buf ...           */
+                      data_ix_pkt,                              /* ... (see Notes #7 & #8).                             */
+                      data_len_pkt,
+                      p_iov,
+                      iov_cnt,
+                      0u,
+                      p_err);
+#else
+    if (p_iov != (NET_BUF_IO_VEC *)0) {                         /* Gather app data into app data tx buf (see Note #7).  */
+        NetBuf_DataWrV(p_buf,
+                       data_ix_pkt,
+                       data_len_pkt,
+                       p_iov,
+                       iov_cnt,
+                       0u,
+                       p_err);
+    } else {
+        NetBuf_DataWr(p_buf,                                    /* Wr app data into app data tx buf.                    */
+                      data_ix_pkt,
+                      data_len_pkt,
+                      p_data_pkt,
+                      p_err);
+    }
+#endif
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
          return (data_len_tot);
@@ -1333,7 +1561,12 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
 *                       (5) Free UDP packet buffer(s)
 *
 *
-* Argument(s) : p_data      Pointer to application data.
+* Argument(s) : p_data      Pointer to application data, if NOT transmitted from I/O vectors.
+*
+*               p_iov       Pointer to array of I/O vectors to gather application data from (see Note #7),
+*                               if available; otherwise, NULL pointer.
+*
+*               iov_cnt     Number of I/O vectors in array.
 *
 *               data_len    Length  of application data (in octets) [see Note #5].
 *
@@ -1456,10 +1689,19 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
 *                   (b) 'data_len' of 0 octets NOT allowed.
 *
 *               (6) On ANY transmit error, any remaining application data transmit is immediately aborted.
+*
+*               (7) Application data scattered across several I/O vectors is gathered directly into the
+*                   datagram's transmit buffer so that the datagram is transmitted atomically (see Note #5a1).
+*
+*               (8) If transmit check-sums are calculated in software, the application data's check-sum
+*                   sum is calculated while the data is copied into the transmit buffer & is NOT re-read
+*                   by the UDP check-sum calculation (see 'net_buf.c  NetBuf_DataWrSumV()  Note #1').
 *********************************************************************************************************
 */
 #ifdef  NET_IPv6_MODULE_EN
 CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
+                                        NET_BUF_IO_VEC          *p_iov,
+                                        CPU_INT16U               iov_cnt,
                                         CPU_INT16U               data_len,
                                         NET_IPv6_ADDR           *p_src_addr,
                                         NET_UDP_PORT_NBR         src_port,
@@ -1482,6 +1724,10 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
     NET_BUF_SIZE    data_len_pkt;
     CPU_INT16U      data_len_tot;
     CPU_INT08U     *p_data_pkt;
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+    NET_BUF_IO_VEC  iov_data;
+#endif
     NET_ERR         err;
 
 
@@ -1501,7 +1747,8 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
 #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
                                                                 /* ---------------- VALIDATE APP DATA ----------------- */
-    if (p_data == (void *)0) {
+    if ((p_data == (void           *)0) &&
+        (p_iov  == (NET_BUF_IO_VEC *)0)) {
        *p_err =  NET_ERR_FAULT_NULL_PTR;
         return (0u);
     }
@@ -1568,11 +1815,38 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
     }
 
     data_ix_pkt += data_ix_pkt_offset;
-    NetBuf_DataWr((NET_BUF    *)p_buf,                           /* Wr app data into app data tx buf.                    */
-                  (NET_BUF_SIZE)data_ix_pkt,
-                  (NET_BUF_SIZE)data_len_pkt,
-                  (CPU_INT08U *)p_data_pkt,
-                  (NET_ERR    *)p_err);
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+    if (p_iov == (NET_BUF_IO_VEC *)0) {
+        iov_data.DataPtr = (void *)p_data_pkt;
+        iov_data.DataLen =  data_len_pkt;
+        p_iov            = &iov_data;
+        iov_cnt          =  1u;
+    }
+    NetBuf_DataWrSumV((NET_BUF        *)p_buf,                  /* Wr & sum app data into app data tx buf ...           */
+                      (NET_BUF_SIZE    )data_ix_pkt,            /* ... (see Notes #7 & #8).                             */
+                      (NET_BUF_SIZE    )data_len_pkt,
+                      (NET_BUF_IO_VEC *)p_iov,
+                      (CPU_INT16U      )iov_cnt,
+                      (CPU_SIZE_T      )0u,
+                      (NET_ERR        *)p_err);
+#else
+    if (p_iov != (NET_BUF_IO_VEC *)0) {                         /* Gather app data into app data tx buf (see Note #7).  */
+        NetBuf_DataWrV((NET_BUF        *)p_buf,
+                       (NET_BUF_SIZE    )data_ix_pkt,
+                       (NET_BUF_SIZE    )data_len_pkt,
+                       (NET_BUF_IO_VEC *)p_iov,
+                       (CPU_INT16U      )iov_cnt,
+                       (CPU_SIZE_T      )0u,
+                       (NET_ERR        *)p_err);
+    } else {
+        NetBuf_DataWr((NET_BUF    *)p_buf,                      /* Wr app data into app data tx buf.                    */
+                      (NET_BUF_SIZE)data_ix_pkt,
+                      (NET_BUF_SIZE)data_len_pkt,
+                      (CPU_INT08U *)p_data_pkt,
+                      (NET_ERR    *)p_err);
+    }
+#endif
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
          return (data_len_tot);
@@ -1618,6 +1892,505 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        NetUDP_TxAppBufGet()
+*
+* Description : Get a UDP transmit buffer for the application to fill with datagram data in place.
+*
+* Argument(s) : if_nbr      Interface number the datagram is expected to be transmitted on.
+*
+*               protocol    UDP protocol type :
+*
+*                               NET_PROTOCOL_TYPE_UDP_V4        UDP over IPv4.
+*                               NET_PROTOCOL_TYPE_UDP_V6        UDP over IPv6.
+*
+*               p_data_len  Pointer to variable that :
+*
+*                               (a) Passes the requested application data length (in octets); ...
+*                               (b) Returns   the granted   application data length (see Note #2).
+*
+*               p_data      Pointer to variable that will receive a pointer to the buffer's data area.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_UDP_ERR_NONE                Transmit buffer successfully allocated.
+*                               NET_ERR_FAULT_NULL_PTR          Argument(s) passed a NULL pointer.
+*                               NET_UDP_ERR_INVALID_DATA_SIZE   Invalid requested data length.
+*                               NET_ERR_INVALID_PROTOCOL        Invalid/unknown protocol type.
+*
+*                                                               ----- RETURNED BY NetIF_MTU_GetProtocol() : ------
+*                               NET_IF_ERR_INVALID_IF           Invalid network interface number.
+*
+*                                                               ----------- RETURNED BY NetBuf_Get() : -----------
+*                               NET_BUF_ERR_NONE_AVAIL          NO available buffers to allocate.
+*
+* Return(s)   : Pointer to UDP transmit buffer, if NO error(s).
+*
+*               Pointer to NULL,                otherwise.
+*
+* Caller(s)   : NetSock_TxDataZeroCopyBufGet().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The buffer's data index is offset past ALL lower-layer protocol headers so that the
+*                   application writes only its data, starting at the returned data pointer.
+*
+*               (2) The granted data length is limited to the minimum of the buffer's maximum data size &
+*                   the interface's UDP MTU since IP transmit fragmentation is NOT supported.
+*
+*                   See also 'NetUDP_TxAppDataHandlerIPv4()  Note #5a2B'.
+*********************************************************************************************************
+*/
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_BUF  *NetUDP_TxAppBufGet (NET_IF_NBR          if_nbr,
+                              NET_PROTOCOL_TYPE   protocol,
+                              CPU_INT16U         *p_data_len,
+                              CPU_INT08U        **p_data,
+                              NET_ERR            *p_err)
+{
+    NET_BUF       *p_buf;
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_MTU        udp_mtu;
+    NET_BUF_SIZE   buf_size_max;
+    NET_BUF_SIZE   data_len_max;
+    NET_BUF_SIZE   data_len_pkt;
+    NET_BUF_SIZE   data_ix_pkt;
+    NET_BUF_SIZE   data_ix_pkt_offset;
+    NET_ERR        err;
+
+
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+                                                                /* ---------------- VALIDATE PTRS/LEN ----------------- */
+    if ((p_data_len == (CPU_INT16U  *)0) ||
+        (p_data     == (CPU_INT08U **)0)) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return ((NET_BUF *)0);
+    }
+    if (*p_data_len < 1) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.UDP.TxInvalidSizeCtr);
+       *p_err =  NET_UDP_ERR_INVALID_DATA_SIZE;
+        return ((NET_BUF *)0);
+    }
+#endif
+
+    switch (protocol) {
+        case NET_PROTOCOL_TYPE_UDP_V4:
+        case NET_PROTOCOL_TYPE_UDP_V6:
+             break;
+
+
+        default:
+            *p_err = NET_ERR_INVALID_PROTOCOL;
+             return ((NET_BUF *)0);
+    }
+                                                                /* Get IF's UDP MTU.                                    */
+    udp_mtu = NetIF_MTU_GetProtocol(if_nbr, protocol, NET_IF_FLAG_NONE, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+        return ((NET_BUF *)0);
+    }
+
+                                                                /* Calc data ix past ALL hdrs (see Note #1).            */
+    data_ix_pkt = 0u;
+    NetUDP_GetTxDataIx(if_nbr,
+                       protocol,
+                      *p_data_len,
+                       NET_UDP_FLAG_NONE,
+                      &data_ix_pkt,
+                      &err);
+                                                                /* Lim data len to single datagram (see Note #2).       */
+    buf_size_max = NetBuf_GetMaxSize(if_nbr, NET_TRANSACTION_TX, (NET_BUF *)0, data_ix_pkt);
+    data_len_max = (NET_BUF_SIZE)DEF_MIN(buf_size_max, udp_mtu);
+    data_len_pkt = (NET_BUF_SIZE)DEF_MIN(data_len_max, *p_data_len);
+    if (data_len_pkt < 1) {
+       *p_err = NET_UDP_ERR_INVALID_DATA_SIZE;
+        return ((NET_BUF *)0);
+    }
+
+    p_buf = NetBuf_Get(if_nbr,
+                       NET_TRANSACTION_TX,
+                       data_len_pkt,
+                       data_ix_pkt,
+                      &data_ix_pkt_offset,
+                       NET_BUF_FLAG_NONE,
+                       p_err);
+    if (*p_err != NET_BUF_ERR_NONE) {
+        return ((NET_BUF *)0);
+    }
+
+    data_ix_pkt               += data_ix_pkt_offset;
+                                                                /* Init app data tx buf ctrls.                          */
+    p_buf_hdr                  = &p_buf->Hdr;
+    p_buf_hdr->DataIx          =  data_ix_pkt;
+    p_buf_hdr->DataLen         =  0u;
+    p_buf_hdr->TotLen          =  0u;
+    p_buf_hdr->ProtocolHdrType =  protocol;
+
+   *p_data_len = (CPU_INT16U)data_len_pkt;
+   *p_data     = &p_buf->DataPtr[data_ix_pkt];
+   *p_err      =  NET_UDP_ERR_NONE;
+
+    return (p_buf);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetUDP_TxAppBufHandlerIPv4()
+*
+* Description : Transmit an application-filled UDP transmit buffer as a single IPv4 UDP datagram.
+*
+* Argument(s) : p_buf_tx    Pointer to variable that holds the transmit buffer (see Note #1).
+*
+*               data_len    Length of application data written into the transmit buffer (in octets).
+*
+*               src_addr    Source      IP address.
+*
+*               src_port    Source      UDP port.
+*
+*               dest_addr   Destination IP address.
+*
+*               dest_port   Destination UDP port.
+*
+*               TOS         Specific TOS to transmit UDP/IP packet.
+*
+*               TTL         Specific TTL to transmit UDP/IP packet.
+*
+*               flags_udp   Flags to select UDP transmit options.
+*
+*               flags_ip    Flags to select IP  transmit options.
+*
+*               p_opts_ip   Pointer to one or more IP options configuration data structures.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_UDP_ERR_NONE                Application data successfully transmitted.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf_tx' passed a NULL pointer.
+*                               NET_UDP_ERR_INVALID_DATA_SIZE   Argument 'data_len' passed an invalid size.
+*                               NET_UDP_ERR_INVALID_ADDR_SRC    Argument 'src_addr' passed an invalid address.
+*
+*                                                               ----------- RETURNED BY NetUDP_TxIPv4() : ----------
+*                               NET_ERR_TX                      Transmit error; packet(s) discarded.
+*
+* Return(s)   : Number of data octets transmitted, if NO error(s).
+*
+*               0,                                 otherwise.
+*
+* Caller(s)   : NetSock_TxDataHandlerDatagram().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) (a) Once the transmit buffer is passed to the UDP transmit path, the caller's buffer pointer
+*                       is set to NULL; the buffer is freed by UDP whether or not the transmit succeeds.
+*
+*                   (b) On any error returned BEFORE the buffer is passed to the UDP transmit path, the
+*                       caller's buffer pointer is NOT cleared & the caller retains ownership of the buffer.
+*
+*               (2) If the source address resolves to a different interface than the one the buffer was
+*                   allocated for, the buffer's data is transmitted via NetUDP_TxAppDataHandlerIPv4() &
+*                   the buffer is then freed.
+*
+*               (3) IP options are prepared in front of the buffer's data index.  If 'p_opts_ip' is used,
+*                   the buffer MUST have been allocated with sufficient header room; otherwise the datagram
+*                   is discarded by the IP layer.
+*********************************************************************************************************
+*/
+
+#if ((NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED) && \
+     (defined(NET_IPv4_MODULE_EN)))
+CPU_INT16U  NetUDP_TxAppBufHandlerIPv4 (NET_BUF           **p_buf_tx,
+                                        CPU_INT16U          data_len,
+                                        NET_IPv4_ADDR       src_addr,
+                                        NET_UDP_PORT_NBR    src_port,
+                                        NET_IPv4_ADDR       dest_addr,
+                                        NET_UDP_PORT_NBR    dest_port,
+                                        NET_IPv4_TOS        TOS,
+                                        NET_IPv4_TTL        TTL,
+                                        NET_UDP_FLAGS       flags_udp,
+                                        NET_IPv4_FLAGS      flags_ip,
+                                        void               *p_opts_ip,
+                                        NET_ERR            *p_err)
+{
+    NET_BUF       *p_buf;
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_IF_NBR     if_nbr;
+    NET_MTU        udp_mtu;
+    NET_BUF_SIZE   buf_size_max;
+    NET_BUF_SIZE   buf_size_max_data;
+    CPU_INT16U     data_len_tot;
+
+
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+                                                                /* ---------------- VALIDATE APP BUF ------------------ */
+    if (p_buf_tx == (NET_BUF **)0) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (0u);
+    }
+    if (*p_buf_tx == (NET_BUF *)0) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (0u);
+    }
+#endif
+    if (data_len <= NET_UDP_DATA_LEN_MIN) {
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+        NET_CTR_ERR_INC(Net_ErrCtrs.UDP.TxInvalidSizeCtr);
+#endif
+       *p_err =  NET_UDP_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+
+    p_buf     = *p_buf_tx;
+    p_buf_hdr = &p_buf->Hdr;
+
+    if_nbr = NetIPv4_GetAddrHostIF_Nbr(src_addr);               /* Get IF nbr of src addr.                              */
+    if (if_nbr == NET_IF_NBR_NONE) {
+       *p_err =  NET_UDP_ERR_INVALID_ADDR_SRC;
+        return (0u);
+    }
+
+    if (if_nbr != p_buf_hdr->IF_Nbr) {                          /* If buf alloc'd for other IF, copy (see Note #2).     */
+        data_len_tot = NetUDP_TxAppDataHandlerIPv4(&p_buf->DataPtr[p_buf_hdr->DataIx],
+                                                    DEF_NULL,
+                                                    0u,
+                                                    data_len,
+                                                    src_addr,
+                                                    src_port,
+                                                    dest_addr,
+                                                    dest_port,
+                                                    TOS,
+                                                    TTL,
+                                                    flags_udp,
+                                                    flags_ip,
+                                                    p_opts_ip,
+                                                    p_err);
+        if (*p_err == NET_UDP_ERR_NONE) {
+           *p_buf_tx = (NET_BUF *)0;
+            NetUDP_TxPktFree(p_buf);
+        }
+        return (data_len_tot);
+    }
+                                                                /* Get IF's UDP MTU.                                    */
+    udp_mtu = NetIF_MTU_GetProtocol(if_nbr, NET_PROTOCOL_TYPE_UDP_V4, NET_IF_FLAG_NONE, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+        return (0u);
+    }
+
+    buf_size_max      = NetBuf_GetMaxSize(if_nbr, NET_TRANSACTION_TX, p_buf, p_buf_hdr->DataIx);
+    buf_size_max_data = (NET_BUF_SIZE)DEF_MIN(buf_size_max, udp_mtu);
+    if (data_len > buf_size_max_data) {                         /* If data len > max data size, abort tx.               */
+       *p_err = NET_UDP_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+
+                                                                /* Init app data tx buf ctrls.                          */
+    p_buf_hdr->DataLen         = (NET_BUF_SIZE)data_len;
+    p_buf_hdr->TotLen          =  p_buf_hdr->DataLen;
+    p_buf_hdr->ProtocolHdrType =  NET_PROTOCOL_TYPE_UDP_V4;
+
+   *p_buf_tx = (NET_BUF *)0;                                    /* Buf now owned by UDP tx (see Note #1a).              */
+
+    NetUDP_TxIPv4(p_buf,                                        /* Tx app data buf via UDP tx.                          */
+                  src_addr,
+                  src_port,
+                  dest_addr,
+                  dest_port,
+                  TOS,
+                  TTL,
+                  flags_udp,
+                  flags_ip,
+                  p_opts_ip,
+                  p_err);
+    if (*p_err != NET_UDP_ERR_NONE) {
+         return (0u);
+    }
+
+    NetUDP_TxPktFree(p_buf);                                    /* Free app data tx buf.                                */
+
+
+   *p_err = NET_UDP_ERR_NONE;
+
+    return (data_len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    NetUDP_TxAppBufHandlerIPv6()
+*
+* Description : Transmit an application-filled UDP transmit buffer as a single IPv6 UDP datagram.
+*
+* Argument(s) : p_buf_tx        Pointer to variable that holds the transmit buffer (see Note #1).
+*
+*               data_len        Length of application data written into the transmit buffer (in octets).
+*
+*               p_src_addr      Pointer to source      IPv6 address.
+*
+*               src_port        Source      UDP port.
+*
+*               p_dest_addr     Pointer to destination IPv6 address.
+*
+*               dest_port       Destination UDP port.
+*
+*               traffic_class   Specific traffic class to transmit UDP/IPv6 packet.
+*
+*               flow_label      Specific flow label    to transmit UDP/IPv6 packet.
+*
+*               hop_lim         Specific hop limit     to transmit UDP/IPv6 packet.
+*
+*               flags_udp       Flags to select UDP transmit options.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_UDP_ERR_NONE                Application data successfully transmitted.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf_tx' passed a NULL pointer.
+*                               NET_UDP_ERR_INVALID_DATA_SIZE   Argument 'data_len' passed an invalid size.
+*                               NET_UDP_ERR_INVALID_ADDR_SRC    Argument 'p_src_addr' passed an invalid address.
+*
+*                                                               ----------- RETURNED BY NetUDP_TxIPv6() : ----------
+*                               NET_ERR_TX                      Transmit error; packet(s) discarded.
+*
+* Return(s)   : Number of data octets transmitted, if NO error(s).
+*
+*               0,                                 otherwise.
+*
+* Caller(s)   : NetSock_TxDataHandlerDatagram().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) See 'NetUDP_TxAppBufHandlerIPv4()  Note #1'.
+*
+*               (2) See 'NetUDP_TxAppBufHandlerIPv4()  Note #2'.
+*********************************************************************************************************
+*/
+
+#if ((NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED) && \
+     (defined(NET_IPv6_MODULE_EN)))
+CPU_INT16U  NetUDP_TxAppBufHandlerIPv6 (NET_BUF                **p_buf_tx,
+                                        CPU_INT16U               data_len,
+                                        NET_IPv6_ADDR           *p_src_addr,
+                                        NET_UDP_PORT_NBR         src_port,
+                                        NET_IPv6_ADDR           *p_dest_addr,
+                                        NET_UDP_PORT_NBR         dest_port,
+                                        NET_IPv6_TRAFFIC_CLASS   traffic_class,
+                                        NET_IPv6_FLOW_LABEL      flow_label,
+                                        NET_IPv6_HOP_LIM         hop_lim,
+                                        NET_UDP_FLAGS            flags_udp,
+                                        NET_ERR                 *p_err)
+{
+    NET_BUF       *p_buf;
+    NET_BUF_HDR   *p_buf_hdr;
+    NET_IF_NBR     if_nbr;
+    NET_MTU        udp_mtu;
+    NET_BUF_SIZE   buf_size_max;
+    NET_BUF_SIZE   buf_size_max_data;
+    CPU_INT16U     data_len_tot;
+
+
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+                                                                /* ---------------- VALIDATE APP BUF ------------------ */
+    if (p_buf_tx == (NET_BUF **)0) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (0u);
+    }
+    if (*p_buf_tx == (NET_BUF *)0) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (0u);
+    }
+#endif
+    if (data_len < 1) {
+#if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
+     (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
+        NET_CTR_ERR_INC(Net_ErrCtrs.UDP.TxInvalidSizeCtr);
+#endif
+       *p_err =  NET_UDP_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+
+    p_buf     = *p_buf_tx;
+    p_buf_hdr = &p_buf->Hdr;
+
+    if_nbr = NetIPv6_GetAddrHostIF_Nbr(p_src_addr);             /* Get IF nbr of src addr.                              */
+    if (if_nbr == NET_IF_NBR_NONE) {
+       *p_err =  NET_UDP_ERR_INVALID_ADDR_SRC;
+        return (0u);
+    }
+
+    if (if_nbr != p_buf_hdr->IF_Nbr) {                          /* If buf alloc'd for other IF, copy (see Note #2).     */
+        data_len_tot = NetUDP_TxAppDataHandlerIPv6(&p_buf->DataPtr[p_buf_hdr->DataIx],
+                                                    DEF_NULL,
+                                                    0u,
+                                                    data_len,
+                                                    p_src_addr,
+                                                    src_port,
+                                                    p_dest_addr,
+                                                    dest_port,
+                                                    traffic_class,
+                                                    flow_label,
+                                                    hop_lim,
+                                                    flags_udp,
+                                                    p_err);
+        if (*p_err == NET_UDP_ERR_NONE) {
+           *p_buf_tx = (NET_BUF *)0;
+            NetUDP_TxPktFree(p_buf);
+        }
+        return (data_len_tot);
+    }
+                                                                /* Get IF's UDP MTU.                                    */
+    udp_mtu = NetIF_MTU_GetProtocol(if_nbr, NET_PROTOCOL_TYPE_UDP_V6, NET_IF_FLAG_NONE, p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+        return (0u);
+    }
+
+    buf_size_max      = NetBuf_GetMaxSize(if_nbr, NET_TRANSACTION_TX, p_buf, p_buf_hdr->DataIx);
+    buf_size_max_data = (NET_BUF_SIZE)DEF_MIN(buf_size_max, udp_mtu);
+    if (data_len > buf_size_max_data) {                         /* If data len > max data size, abort tx.               */
+       *p_err = NET_UDP_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+
+                                                                /* Init app data tx buf ctrls.                          */
+    p_buf_hdr->DataLen         = (NET_BUF_SIZE)data_len;
+    p_buf_hdr->TotLen          =  p_buf_hdr->DataLen;
+    p_buf_hdr->ProtocolHdrType =  NET_PROTOCOL_TYPE_UDP_V6;
+
+    DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME);
+
+   *p_buf_tx = (NET_BUF *)0;                                    /* Buf now owned by UDP tx (see Note #1).               */
+
+    NetUDP_TxIPv6(p_buf,                                        /* Tx app data buf via UDP tx.                          */
+                  p_src_addr,
+                  src_port,
+                  p_dest_addr,
+                  dest_port,
+                  traffic_class,
+                  flow_label,
+                  hop_lim,
+                  flags_udp,
+                  p_err);
+    if (*p_err != NET_UDP_ERR_NONE) {
+         return (0u);
+    }
+
+    NetUDP_TxPktFree(p_buf);                                    /* Free app data tx buf.                                */
+
+
+   *p_err = NET_UDP_ERR_NONE;
+
+    return (data_len);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -2870,6 +3643,7 @@ static  void  NetUDP_TxPktPrepareHdr (NET_BUF           *p_buf,
 
     if (tx_chk_sum == DEF_YES) {                                /* If en'd (see Note #3b), prepare UDP tx chk sum.      */
         NET_UTIL_VAL_SET_NET_16(&p_udp_hdr->ChkSum, 0x0000u);    /* Clr UDP chk sum            (see Note #3c).           */
+        udp_chk_sum = 0u;                                       /* Init chk sum for IP families NOT en'd.               */
                                                                 /* Cfg UDP chk sum pseudo-hdr (see Note #3d).           */
         if (DEF_BIT_IS_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
 #ifdef  NET_IPv4_MODULE_EN
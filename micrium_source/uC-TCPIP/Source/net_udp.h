@@ -261,6 +261,21 @@ CPU_INT16U  NetUDP_RxAppData       (NET_BUF           *pbuf,
                                     CPU_INT08U        *pip_opts_len,
                                     NET_ERR           *p_err);
 
+CPU_INT16U  NetUDP_RxAppDataV      (NET_BUF           *p_buf,
+                                    NET_BUF_IO_VEC    *p_iov,
+                                    CPU_INT16U         iov_cnt,
+                                    CPU_INT16U         data_buf_len,
+                                    NET_UDP_FLAGS      flags,
+                                    void              *pip_opts_buf,
+                                    CPU_INT08U         ip_opts_buf_len,
+                                    CPU_INT08U        *pip_opts_len,
+                                    NET_ERR           *p_err);
+
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+CPU_INT16U  NetUDP_RxAppDataZeroCopy(NET_BUF           *p_buf,
+                                     NET_ERR           *p_err);
+#endif
+
 
                                                                 /* --------------------- TX FNCTS --------------------- */
 CPU_INT16U  NetUDP_TxAppDataIPv4 (void              *p_data,
@@ -289,6 +304,8 @@ CPU_INT16U  NetUDP_TxAppDataIPv6 (void                    *p_data,
                                   NET_ERR                 *p_err);
 
 CPU_INT16U  NetUDP_TxAppDataHandlerIPv4(void               *p_data,
+                                        NET_BUF_IO_VEC     *p_iov,
+                                        CPU_INT16U          iov_cnt,
                                         CPU_INT16U          data_len,
                                         NET_IPv4_ADDR       src_addr,
                                         NET_UDP_PORT_NBR    src_port,
@@ -302,6 +319,8 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4(void               *p_data,
                                         NET_ERR            *p_err);
 
 CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
+                                        NET_BUF_IO_VEC          *p_iov,
+                                        CPU_INT16U               iov_cnt,
                                         CPU_INT16U               data_len,
                                         NET_IPv6_ADDR           *p_src_addr,
                                         NET_UDP_PORT_NBR         src_port,
@@ -313,6 +332,43 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
                                         NET_UDP_FLAGS            flags_udp,
                                         NET_ERR                 *p_err);
 
+#if (NET_SOCK_CFG_ZERO_COPY_EN == DEF_ENABLED)
+NET_BUF    *NetUDP_TxAppBufGet         (NET_IF_NBR               if_nbr,
+                                        NET_PROTOCOL_TYPE        protocol,
+                                        CPU_INT16U              *p_data_len,
+                                        CPU_INT08U             **p_data,
+                                        NET_ERR                 *p_err);
+
+#ifdef  NET_IPv4_MODULE_EN
+CPU_INT16U  NetUDP_TxAppBufHandlerIPv4 (NET_BUF                **p_buf_tx,
+                                        CPU_INT16U               data_len,
+                                        NET_IPv4_ADDR            src_addr,
+                                        NET_UDP_PORT_NBR         src_port,
+                                        NET_IPv4_ADDR            dest_addr,
+                                        NET_UDP_PORT_NBR         dest_port,
+                                        NET_IPv4_TOS             TOS,
+                                        NET_IPv4_TTL             TTL,
+                                        NET_UDP_FLAGS            flags_udp,
+                                        NET_IPv4_FLAGS           flags_ip,
+                                        void                    *p_opts_ip,
+                                        NET_ERR                 *p_err);
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+CPU_INT16U  NetUDP_TxAppBufHandlerIPv6 (NET_BUF                **p_buf_tx,
+                                        CPU_INT16U               data_len,
+                                        NET_IPv6_ADDR           *p_src_addr,
+                                        NET_UDP_PORT_NBR         src_port,
+                                        NET_IPv6_ADDR           *p_dest_addr,
+                                        NET_UDP_PORT_NBR         dest_port,
+                                        NET_IPv6_TRAFFIC_CLASS   traffic_class,
+                                        NET_IPv6_FLOW_LABEL      flow_label,
+                                        NET_IPv6_HOP_LIM         hop_lim,
+                                        NET_UDP_FLAGS            flags_udp,
+                                        NET_ERR                 *p_err);
+#endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                   EXTERNAL C LANGUAGE LINKAGE END
@@ -449,6 +449,132 @@ CPU_BOOLEAN  NetUtil_16BitOnesCplChkSumDataVerify (void        *pdata_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                  NetUtil_16BitOnesCplSumDataCopy()
+*
+* Description : Copy data & calculate its 16-bit one's-complement sum in a single pass.
+*
+* Argument(s) : p_dest      Pointer to destination memory buffer.
+*               ------      Argument validated by caller(s).
+*
+*               p_src       Pointer to source      memory buffer.
+*               -----       Argument validated by caller(s).
+*
+*               len         Number of octets to copy & sum.
+*
+*               sum_prev    16-bit one's-complement sum of the data that precedes the copied data (see Note #2).
+*
+*               offset      Number of octets that precede the copied data (see Note #2).
+*
+* Return(s)   : 16-bit one's-complement sum of the preceding & the copied data, in network-order (see Note #3).
+*
+* Caller(s)   : NetBuf_DataWrSumV().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Copying application data into network buffers & later calculating the check-sum over
+*                   the same data reads the data twice.  Calculating the sum while copying the data reads
+*                   each data octet only once.
+*
+*               (2) (a) A data area may be copied in several consecutive parts (e.g. several application
+*                       I/O vectors); 'sum_prev' & 'offset' allow each part's sum to be added to the sum
+*                       of the preceding parts.
+*
+*                   (b) RFC #1071, Section 2.(B) states that if a data area starts on an odd octet, its
+*                       16-bit sum is byte-swapped relative to the same data starting on an even octet.
+*                       Thus the copied data's sum is swapped when 'offset' is odd.
+*
+*                   (c) A last odd octet is padded on the right with an octet of zeros; as would any odd
+*                       packet length (see 'NetUtil_16BitSumDataCalc()  Note #8').  If further data is
+*                       later copied after this odd octet, the further data's odd offset correctly
+*                       completes the 16-bit word (see Note #2b).
+*
+*               (3) The 16-bit sum is returned as a network-order value so that it may be added to other
+*                   16-bit sums (see 'NetUtil_16BitSumDataCalc()  Note #5c1').
+*
+*               (4) Since many word-aligned processors REQUIRE that multi-octet words be located on word-
+*                   aligned addresses, data is copied & summed with 32-bit words ONLY if both memory
+*                   buffers are 32-bit aligned (see also 'NetUtil_16BitSumDataCalc()  Note #6b').
+*********************************************************************************************************
+*/
+
+CPU_INT16U  NetUtil_16BitOnesCplSumDataCopy (void        *p_dest,
+                                             void        *p_src,
+                                             CPU_INT16U   len,
+                                             CPU_INT16U   sum_prev,
+                                             CPU_INT32U   offset)
+{
+    CPU_INT32U   *p_dest_32;
+    CPU_INT32U   *p_src_32;
+    CPU_INT08U   *p_dest_08;
+    CPU_INT08U   *p_src_08;
+    CPU_INT64U    sum_64;
+    CPU_INT32U    sum_32;
+    CPU_INT32U    data_val_32;
+    CPU_INT16U    sum_16;
+    CPU_INT16U    size_rem;
+    CPU_DATA      mod_32;
+
+
+    sum_32    = 0u;
+    size_rem  = len;
+    p_dest_08 = (CPU_INT08U *)p_dest;
+    p_src_08  = (CPU_INT08U *)p_src;
+                                                                /* If both bufs 32-bit aligned (see Note #4), ...       */
+    mod_32    = (CPU_DATA)(((CPU_ADDR)p_dest % sizeof(CPU_INT32U)) | ((CPU_ADDR)p_src % sizeof(CPU_INT32U)));
+    if (mod_32 == 0u) {
+        p_dest_32 = (CPU_INT32U *)p_dest_08;
+        p_src_32  = (CPU_INT32U *)p_src_08;
+        sum_64    =  0u;
+        while (size_rem >= sizeof(CPU_INT32U)) {                /* ... copy & sum 32-bit data words in host-order.      */
+            data_val_32  = *p_src_32++;
+           *p_dest_32++  =  data_val_32;
+            sum_64      += (CPU_INT64U)data_val_32;
+            size_rem    -= (CPU_INT16U)sizeof(CPU_INT32U);
+        }
+        while ((sum_64 >> 16u) != 0u) {
+            sum_64 = (sum_64 & 0x0000FFFFu) + (sum_64 >> 16u);
+        }
+        sum_16    = (CPU_INT16U)sum_64;
+        sum_32    = (CPU_INT32U)NET_UTIL_HOST_TO_NET_16(sum_16);
+        p_dest_08 = (CPU_INT08U *)p_dest_32;
+        p_src_08  = (CPU_INT08U *)p_src_32;
+    }
+
+    while (size_rem >= sizeof(CPU_INT16U)) {                    /* Copy & sum rem'ing data in net-order.                */
+        data_val_32   = (CPU_INT32U)*p_src_08;
+       *p_dest_08++   = *p_src_08++;
+        data_val_32 <<=  DEF_OCTET_NBR_BITS;
+        data_val_32  += (CPU_INT32U)*p_src_08;
+       *p_dest_08++   = *p_src_08++;
+        sum_32       +=  data_val_32;
+        size_rem     -= (CPU_INT16U)sizeof(CPU_INT16U);
+    }
+    if (size_rem > 0u) {                                        /* Pad last odd octet (see Note #2c).                   */
+        data_val_32   = (CPU_INT32U)*p_src_08;
+       *p_dest_08     = *p_src_08;
+        sum_32       += (data_val_32 << DEF_OCTET_NBR_BITS);
+    }
+
+    while ((sum_32 >> 16u) != 0u) {
+        sum_32 = (sum_32 & 0x0000FFFFu) + (sum_32 >> 16u);
+    }
+    sum_16 = (CPU_INT16U)sum_32;
+    if ((offset % sizeof(CPU_INT16U)) != 0u) {                  /* Swap sum of data at odd offset (see Note #2b).       */
+        sum_16 = (CPU_INT16U)((sum_16 << DEF_OCTET_NBR_BITS) | (sum_16 >> DEF_OCTET_NBR_BITS));
+    }
+
+    sum_32 = (CPU_INT32U)sum_prev + (CPU_INT32U)sum_16;         /* Add to preceding data's sum (see Note #2a).          */
+    if ((sum_32 >> 16u) != 0u) {
+        sum_32 = (sum_32 & 0x0000FFFFu) + (sum_32 >> 16u);
+    }
+
+    return ((CPU_INT16U)sum_32);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetUtil_32BitCRC_Calc()
@@ -734,6 +860,10 @@ NET_TS  NetUtil_TS_Get (void)
 *                                           time_scalar     Constant   time scalar (e.g. 1000 ms/1 sec)
 *                                           N               Number of data type bits (e.g. 32)
 *
+*                       (2) Since CPU timestamp timers may run at CPU clock rates, a 32-bit product would
+*                           overflow for time deltas of only a few milliseconds (e.g. 4.3 ms at 1 GHz);
+*                           thus CPU timestamp time delta products are computed in 64-bit.
+*
 *
 *                   (b) To ensure timestamp calculation accuracy, timestamp calculations sum timestamp
 *                       integer remainders back into total accumulated timestamp :
@@ -773,7 +903,7 @@ NET_TS_MS  NetUtil_TS_Get_ms (void)
     static  NET_TS_MS        ts_ms_delta_rem_tot = 0u;
             NET_TS_MS        ts_ms_delta_rem_ovf;
             NET_TS_MS        ts_ms_delta_rem;
-            NET_TS_MS        ts_ms_delta_num;
+            CPU_INT64U       ts_ms_delta_num;
             NET_TS_MS        ts_ms_delta;
             CPU_ERR          err;
 
@@ -796,8 +926,8 @@ NET_TS_MS  NetUtil_TS_Get_ms (void)
                 ts_ms_tot           += (NET_TS_MS) ts_ms_delta;         /*     Update ts tot   (in ms) [see Note #2a].  */
 
             } else {
-                                                                        /*     Calc   ts delta (in ms) [see Note #2a1]. */
-                ts_ms_delta_num      = (NET_TS_MS)(ts_delta        * DEF_TIME_NBR_mS_PER_SEC);
+                                                                        /*     Calc   ts delta (in ms) [see Note #2a2]. */
+                ts_ms_delta_num      = (CPU_INT64U)ts_delta        * DEF_TIME_NBR_mS_PER_SEC;
                 ts_ms_delta          = (NET_TS_MS)(ts_ms_delta_num / ts_tmr_freq);
                 ts_ms_tot           += (NET_TS_MS) ts_ms_delta;         /*     Update ts tot   (in ms) [see Note #2a].  */
                                                                         /*     Calc   ts delta rem ovf (in ms) ...      */
@@ -878,6 +1008,104 @@ NET_TS_MS  NetUtil_TS_Get_ms (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetUtil_TS_Get_us()
+*
+* Description : Get current microsecond timestamp.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Timestamp, in microseconds.
+*
+* Caller(s)   : NetTCP_RxPktValidate(),
+*               NetTCP_TxPktPrepareHdr().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The microsecond timestamp wraps every 2^32 us (about 71 minutes); callers MUST
+*                   ONLY use it to compute time deltas shorter than the wrap period (e.g. TCP
+*                   round-trip time samples).
+*
+*               (2) Timestamps are updated by summing time delta differences converted into
+*                   microseconds, with remainders summed back into the total timestamp, as described
+*                   in 'NetUtil_TS_Get_ms()  Note #2'. The delta conversion is computed in 64-bit
+*                   to avoid the multiplicative overflow described in 'NetUtil_TS_Get_ms()  Note #2a1'.
+*
+*               (3) Resolution is that of the CPU timestamp timer, if available; otherwise, that of
+*                   the OS tick.
+*********************************************************************************************************
+*/
+
+NET_TS_US  NetUtil_TS_Get_us (void)
+{
+#if CPU_CFG_TS_32_EN == DEF_ENABLED
+    static  CPU_BOOLEAN      ts_active           = DEF_NO;
+    static  CPU_TS32         ts_prev             = 0u;
+    static  NET_TS_US        ts_us_tot           = 0u;
+    static  CPU_INT64U       ts_us_delta_rem_tot = 0u;
+            CPU_TS32         ts_cur;
+            CPU_TS_TMR_FREQ  ts_tmr_freq;
+            CPU_INT64U       ts_us_delta_num;
+            CPU_ERR          err;
+
+
+    ts_cur      = CPU_TS_Get32();
+    ts_tmr_freq = CPU_TS_TmrFreqGet(&err);
+    if (err != CPU_ERR_NONE) {
+        ts_tmr_freq = 0u;
+    }
+
+    if (ts_tmr_freq == 0u) {                                            /* If TS tmr freq unknown, fall back to ms ts.  */
+        return ((NET_TS_US)(NetUtil_TS_Get_ms() * (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC)));
+    }
+
+    if (ts_active == DEF_YES) {                                         /* If active, calc & update ts (see Note #2) :  */
+                                                                        /*     Calc ts delta num (in us) ...            */
+        ts_us_delta_num      = ((CPU_INT64U)(CPU_TS32)(ts_cur - ts_prev) * DEF_TIME_NBR_uS_PER_SEC) + ts_us_delta_rem_tot;
+        ts_us_tot           += (NET_TS_US)(ts_us_delta_num / ts_tmr_freq);
+        ts_us_delta_rem_tot  =              ts_us_delta_num % ts_tmr_freq; /* ... & carry rem to next update.       */
+    } else {
+        ts_active = DEF_YES;
+    }
+
+    ts_prev = ts_cur;                                                   /* Save cur time for next ts update.            */
+
+    return (ts_us_tot);
+#else
+    static  CPU_BOOLEAN  ts_active           = DEF_NO;
+    static  KAL_TICK     tick_prev           = 0u;
+    static  NET_TS_US    ts_us_tot           = 0u;
+    static  CPU_INT64U   ts_us_delta_rem_tot = 0u;
+            KAL_TICK     tick_cur;
+            CPU_INT64U   ts_us_delta_num;
+            KAL_ERR      err;
+
+
+    tick_cur = KAL_TickGet(&err);
+   (void)&err;
+
+    if (KAL_TickRate == 0u) {                                   /* If tick rate unknown, fall back to ms ts.            */
+        return ((NET_TS_US)(NetUtil_TS_Get_ms() * (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC)));
+    }
+
+    if (ts_active == DEF_YES) {                                 /* If active, calc & update ts (see Note #2) :          */
+                                                                /*     Calc ts delta num (in us) ...                    */
+        ts_us_delta_num      = ((CPU_INT64U)(KAL_TICK)(tick_cur - tick_prev) * DEF_TIME_NBR_uS_PER_SEC) + ts_us_delta_rem_tot;
+        ts_us_tot           += (NET_TS_US)(ts_us_delta_num / KAL_TickRate);
+        ts_us_delta_rem_tot  =              ts_us_delta_num % KAL_TickRate; /* ... & carry rem to next update.      */
+    } else {
+        ts_active = DEF_YES;
+    }
+
+    tick_prev = tick_cur;                                       /* Save cur time for next ts update.                    */
+
+    return (ts_us_tot);
+#endif
+}
+
+
 /*
 *********************************************************************************************************
 *                                      NetUtil_TimeSec_uS_To_ms()
@@ -1295,10 +1523,24 @@ static  CPU_INT32U  NetUtil_16BitSumHdrCalc (void        *phdr,
 *                           inverse operations, the final host-order check-sum value MUST NOT be converted
 *                           back to network-order for calculation or comparison.
 *
-*               (6) Optimized 32-bit sum calculations implemented in the network protocol suite's network-
-*                   specific library port optimization file(s).
+*               (6) (a) Optimized 32-bit sum calculations implemented in the network protocol suite's
+*                       network-specific library port optimization file(s).
+*
+*                       See also 'net_util.h  FUNCTION PROTOTYPES  DEFINED IN PRODUCT'S  net_util_a.*  Note #1'.
+*
+*                   (b) Otherwise, 32-bit data words are summed in host-order into a 64-bit accumulator :
+*
+*                       (1) RFC #1071, Section 2.(C) states that "on machines that have word-sizes that are
+*                           multiples of 16 bits, it is possible to develop even more efficient implementations"
+*                           by adding whole words & deferring the end-around carries.  Since a 32-bit word
+*                           is congruent, modulo 0xFFFF, to the sum of its two 16-bit words; the accumulator
+*                           is folded back into a 16-bit sum only once all words are summed.
+*
+*                       (2) The accumulator can NOT overflow since the data size is limited to 16 bits.
 *
-*                   See also 'net_util.h  FUNCTION PROTOTYPES  DEFINED IN PRODUCT'S  net_util_a.*  Note #1'.
+*                       (3) Since "the sum of 16-bit integers can be computed in either byte order" (see
+*                           Note #5a), the folded host-order sum is converted to network-order just once
+*                           instead of converting each 16-bit data word.
 *
 *               (7) Since pointer arithmetic is based on the specific pointer data type & inherent pointer
 *                   data type size, pointer arithmetic operands :
@@ -1332,7 +1574,7 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
     CPU_INT16U    size_rem_32;
 #else
     CPU_INT32U   *pdata_32;
-    CPU_INT32U    data_val_32;
+    CPU_INT64U    sum_64;
 #endif
     CPU_INT32U    sum_32;
     CPU_INT32U    sum_val_32;
@@ -1420,20 +1662,27 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
 
 #else
         pdata_32 = (CPU_INT32U *)pdata_16;
-        while (size_rem >=  sizeof(CPU_INT32U)) {                   /* While pkt data aligned on 32-bit boundary; ...   */
-            data_val_32  = (CPU_INT32U) *pdata_32++;                /* ... get sum data with 32-bit data words,   ...   */
-
-            data_val_16  = (CPU_INT16U)((data_val_32 >> 16u) & 0x0000FFFFu);
-            sum_val_32   = (CPU_INT32U)  NET_UTIL_HOST_TO_NET_16(data_val_16);  /* Conv to net-order (see Note #5b).    */
-            sum_32      += (CPU_INT32U)  sum_val_32;                /* ... & calc sum with upper 16-bit data word ...   */
-
-            data_val_16  = (CPU_INT16U) (data_val_32         & 0x0000FFFFu);
-            sum_val_32   = (CPU_INT32U)  NET_UTIL_HOST_TO_NET_16(data_val_16);  /* Conv to net-order (see Note #5b).    */
-            sum_32      += (CPU_INT32U)  sum_val_32;                /* ...               & lower 16-bit data word.      */
+        sum_64   =  0u;
+        while (size_rem >= (4u * sizeof(CPU_INT32U))) {             /* While pkt data aligned on 32-bit boundary; ...   */
+            sum_64   += (CPU_INT64U)pdata_32[0];                    /* ... calc sum with four 32-bit data words   ...   */
+            sum_64   += (CPU_INT64U)pdata_32[1];                    /* ... in host-order (see Note #6b).                */
+            sum_64   += (CPU_INT64U)pdata_32[2];
+            sum_64   += (CPU_INT64U)pdata_32[3];
+            pdata_32 += 4u;
+            size_rem -= (CPU_INT16U)(4u * sizeof(CPU_INT32U));
+        }
+        while (size_rem >= sizeof(CPU_INT32U)) {
+            sum_64   += (CPU_INT64U)*pdata_32++;
+            size_rem -= (CPU_INT16U) sizeof(CPU_INT32U);
+        }
 
-            size_rem    -= (CPU_INT16U)  sizeof(CPU_INT32U);
+        while ((sum_64 >> 16u) != 0u) {                             /* Fold sum into 16 bits (see Note #6b1).            */
+            sum_64 = (sum_64 & 0x0000FFFFu) + (sum_64 >> 16u);
         }
-        pdata_16 = (CPU_INT16U *)pdata_32;
+        data_val_16  = (CPU_INT16U)sum_64;
+        sum_val_32   = (CPU_INT32U)NET_UTIL_HOST_TO_NET_16(data_val_16);    /* Conv to net-order (see Note #6b3).       */
+        sum_32      += (CPU_INT32U)sum_val_32;
+        pdata_16     = (CPU_INT16U *)pdata_32;
 #endif
 
         while (size_rem >=  sizeof(CPU_INT16U)) {                   /* While pkt data aligned on 16-bit boundary; ..    */
@@ -1539,6 +1788,21 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
 *
 *                   (b) ... the one's-complement sum MUST be converted to host-order but MUST NOT be re-
 *                       converted back to network-order (see 'NetUtil_16BitSumDataCalc()  Note #5c3').
+*
+*               (7) (a) Application data summed while written into a transmit buffer is NOT re-read; only
+*                       the protocol header is summed & the cached application data sum is added (see
+*                       'net_buf.c  NetBuf_DataWrSumV()  Note #1').
+*
+*                   (b) The cached sum is used ONLY if :
+*
+*                       (1) The cached sum covers exactly the buffer's current application data area;
+*                       (2) The application data immediately follows the protocol header;
+*                       (3) The protocol header has a non-zero, even length; &
+*                       (4) No odd octet is carried into or out of the application data, i.e. NO previous
+*                           octet is prepended & the application data length is even unless the buffer
+*                           is the packet's last buffer.
+*
+*                       Otherwise, the buffer's header & data are summed as a whole.
 *********************************************************************************************************
 */
 
@@ -1557,12 +1821,14 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
     CPU_INT16U    sum_ones_cpl_host;
     CPU_INT16U    data_ix;
     CPU_INT16U    data_len;
+    CPU_INT16U    hdr_len;
     CPU_INT08U    sum_err;
     CPU_INT08U    octet_prev;
     CPU_INT08U    octet_last;
     CPU_BOOLEAN   octet_prev_valid;
     CPU_BOOLEAN   octet_last_valid;
     CPU_BOOLEAN   mem_buf_last;
+    CPU_BOOLEAN   data_sum_cached;
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
     CPU_BOOLEAN   mem_buf_first;
     CPU_BOOLEAN   mem_buf_null_size;
@@ -1649,14 +1915,41 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
         p_data       = (void    *)&pbuf->DataPtr[data_ix];
         pbuf_next    = (NET_BUF *) pbuf_hdr->NextBufPtr;
         mem_buf_last = (pbuf_next == (NET_BUF *)0) ? DEF_YES : DEF_NO;
-                                                                    /* Calc pkt buf's 16-bit sum.                       */
-        sum_val      =  NetUtil_16BitSumDataCalc((void       *) p_data,
-                                                 (CPU_INT16U  ) data_len,
-                                                 (CPU_INT08U *)&octet_prev,
-                                                 (CPU_INT08U *)&octet_last,
-                                                 (CPU_BOOLEAN ) octet_prev_valid,
-                                                 (CPU_BOOLEAN ) mem_buf_last,
-                                                 (CPU_INT08U *)&sum_err);
+
+        hdr_len         = data_len - (CPU_INT16U)pbuf_hdr->DataLen;
+        data_sum_cached = DEF_NO;
+        if ((octet_prev_valid        == DEF_NO)             &&      /* If app data sum cached (see Note #7b), ...       */
+            (pbuf_hdr->DataChkSumLen >  0u)                 &&
+            (pbuf_hdr->DataChkSumLen == pbuf_hdr->DataLen)  &&
+            (pbuf_hdr->DataChkSumIx  == pbuf_hdr->DataIx)   &&
+            (hdr_len                 >  0u)                 &&
+            ((hdr_len % 2u)          == 0u)                 &&
+            ((data_ix + hdr_len)     == pbuf_hdr->DataIx)) {
+            if ((mem_buf_last == DEF_YES) ||
+               ((pbuf_hdr->DataLen % 2u) == 0u)) {
+                data_sum_cached = DEF_YES;
+            }
+        }
+
+        if (data_sum_cached == DEF_YES) {                           /* ... calc pkt buf's hdr 16-bit sum & ...          */
+            sum_val      =  NetUtil_16BitSumDataCalc((void       *) p_data,
+                                                     (CPU_INT16U  ) hdr_len,
+                                                     (CPU_INT08U *)&octet_prev,
+                                                     (CPU_INT08U *)&octet_last,
+                                                     (CPU_BOOLEAN ) octet_prev_valid,
+                                                     (CPU_BOOLEAN ) DEF_NO,
+                                                     (CPU_INT08U *)&sum_err);
+            sum_val     += (CPU_INT32U)pbuf_hdr->DataChkSum;        /* ... add cached app data sum (see Note #7a).      */
+
+        } else {                                                    /* Else calc pkt buf's 16-bit sum.                  */
+            sum_val      =  NetUtil_16BitSumDataCalc((void       *) p_data,
+                                                     (CPU_INT16U  ) data_len,
+                                                     (CPU_INT08U *)&octet_prev,
+                                                     (CPU_INT08U *)&octet_last,
+                                                     (CPU_BOOLEAN ) octet_prev_valid,
+                                                     (CPU_BOOLEAN ) mem_buf_last,
+                                                     (CPU_INT08U *)&sum_err);
+        }
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
         if (mem_buf_first == DEF_YES) {
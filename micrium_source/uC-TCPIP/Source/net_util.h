@@ -437,6 +437,12 @@ CPU_BOOLEAN  NetUtil_16BitOnesCplChkSumDataVerify(void        *pdata_buf,
                                                   CPU_INT16U   pseudo_hdr_size,
                                                   NET_ERR     *p_err);
 
+CPU_INT16U   NetUtil_16BitOnesCplSumDataCopy     (void        *p_dest,
+                                                  void        *p_src,
+                                                  CPU_INT16U   len,
+                                                  CPU_INT16U   sum_prev,
+                                                  CPU_INT32U   offset);
+
 
                                                                 /* -------------------- CRC FNCTS --------------------- */
 CPU_INT32U   NetUtil_32BitCRC_Calc               (CPU_INT08U  *p_data,
@@ -458,6 +464,8 @@ NET_TS      NetUtil_TS_Get                       (void);
 
 NET_TS_MS   NetUtil_TS_Get_ms                    (void);
 
+NET_TS_US   NetUtil_TS_Get_us                    (void);
+
 
 
 CPU_INT32U  NetUtil_InitSeqNbrGet                (void);
@@ -171,6 +171,10 @@ proc generate {ucos_handle} {
 
     set_define "./src/lib_cfg.h" "LIB_MEM_CFG_HEAP_BASE_ADDR"     [format "%u" [get_property CONFIG.LIB_MEM_CFG_HEAP_BASE_ADDR $ucos_handle]]
 
+    set_define "./src/lib_cfg.h" "LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN" [expr ([get_property CONFIG.LIB_MEM_CFG_DYN_POOL_LOCK_FREE_EN $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/lib_cfg.h" "LIB_MEM_CFG_DYN_POOL_CACHE_EN"     [expr ([get_property CONFIG.LIB_MEM_CFG_DYN_POOL_CACHE_EN     $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/lib_cfg.h" "LIB_MEM_CFG_OPTIMIZE_SIMD_EN"      [expr ([get_property CONFIG.LIB_MEM_CFG_OPTIMIZE_SIMD_EN      $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+
     if {$clk_enabled == "true"} {
         set_define "./src/clk_cfg.h" "CLK_CFG_ARG_CHK_EN"             [expr ([get_property CONFIG.CLK_CFG_ARG_CHK_EN              $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
         set_define "./src/clk_cfg.h" "CLK_CFG_STR_CONV_EN"            [expr ([get_property CONFIG.CLK_CFG_STR_CONV_EN             $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
@@ -54,22 +54,33 @@ proc generate {ucos_handle} {
     set_define "./src/net_cfg.h" "NET_ERR_CFG_ARG_CHK_DBG_EN"   [expr ([get_property CONFIG.NET_ERR_CFG_ARG_CHK_DBG_EN         $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_CTR_CFG_STAT_EN"          [expr ([get_property CONFIG.NET_CTR_CFG_STAT_EN                $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_CTR_CFG_ERR_EN"           [expr ([get_property CONFIG.NET_CTR_CFG_ERR_EN                 $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_CTR_CFG_LOCK_STAT_EN"     [expr ([get_property CONFIG.NET_CTR_CFG_LOCK_STAT_EN           $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
 
     set_define "./src/net_cfg.h" "NET_IF_CFG_MAX_NBR_IF"            [format "%u" [get_property CONFIG.NET_IF_CFG_MAX_NBR_IF             $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_IF_CFG_LOOPBACK_EN"           [expr ([get_property CONFIG.NET_IF_CFG_LOOPBACK_EN                  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_IF_CFG_ETHER_EN"              [expr ([get_property CONFIG.NET_IF_CFG_ETHER_EN                     $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_IF_CFG_WIFI_EN"               [expr ([get_property CONFIG.NET_IF_CFG_WIFI_EN                      $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_IF_CFG_TX_SUSPEND_TIMEOUT_MS" [format "%u" [get_property CONFIG.NET_IF_CFG_TX_SUSPEND_TIMEOUT_MS  $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_IF_CFG_RX_BATCH_MAX"          [format "%u" [get_property CONFIG.NET_IF_CFG_RX_BATCH_MAX           $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_IF_CFG_RX_GRO_EN"             [expr ([get_property CONFIG.NET_IF_CFG_RX_GRO_EN                    $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_IF_CFG_RX_GRO_SEG_MAX"        [format "%u" [get_property CONFIG.NET_IF_CFG_RX_GRO_SEG_MAX         $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_IF_CFG_TX_TSO_EN"             [expr ([get_property CONFIG.NET_IF_CFG_TX_TSO_EN                    $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_IF_CFG_TX_TSO_SEG_MAX"        [format "%u" [get_property CONFIG.NET_IF_CFG_TX_TSO_SEG_MAX         $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_BUF_CFG_CACHE_EN"             [expr ([get_property CONFIG.NET_BUF_CFG_CACHE_EN                    $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_BUF_CFG_CACHE_SIZE"           [format "%u" [get_property CONFIG.NET_BUF_CFG_CACHE_SIZE            $ucos_handle]]
 
     set_define "./src/net_cfg.h" "NET_ARP_CFG_CACHE_NBR"  [format "%u" [get_property CONFIG.NET_ARP_CFG_CACHE_NBR  $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_ARP_CFG_CACHE_HASH_TBL_SIZE"  [format "%u" [get_property CONFIG.NET_ARP_CFG_CACHE_HASH_TBL_SIZE  $ucos_handle]]
 
     set_define "./src/net_cfg.h" "NET_NDP_CFG_CACHE_NBR"   [format "%u" [get_property CONFIG.NET_NDP_CFG_CACHE_NBR             $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_NDP_CFG_CACHE_HASH_TBL_SIZE" [format "%u" [get_property CONFIG.NET_NDP_CFG_CACHE_HASH_TBL_SIZE   $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_NDP_CFG_DEST_NBR"    [format "%u" [get_property CONFIG.NET_NDP_CFG_DEST_NBR              $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_NDP_CFG_PREFIX_NBR"  [format "%u" [get_property CONFIG.NET_NDP_CFG_PREFIX_NBR            $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_NDP_CFG_ROUTER_NBR"  [format "%u" [get_property CONFIG.NET_NDP_CFG_ROUTER_NBR            $ucos_handle]]
 
     set_define "./src/net_cfg.h" "NET_IPv4_CFG_EN"               [expr ([get_property CONFIG.NET_IPv4_CFG_EN                     $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_IPv4_CFG_IF_MAX_NBR_ADDR"  [format "%u" [get_property CONFIG.NET_IPv4_CFG_IF_MAX_NBR_ADDR  $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX"  [format "%u" [get_property CONFIG.NET_IPv4_CFG_FRAG_REASM_SRC_SIZE_MAX  $ucos_handle]]
 
     set_define "./src/net_cfg.h" "NET_IPv6_CFG_EN"                [expr ([get_property CONFIG.NET_IPv6_CFG_EN                $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_IPv6_CFG_ADDR_AUTO_CFG_EN"  [expr ([get_property CONFIG.NET_IPv6_CFG_ADDR_AUTO_CFG_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
@@ -83,17 +94,29 @@ proc generate {ucos_handle} {
     set_define "./src/net_cfg.h" "NET_SOCK_CFG_SOCK_NBR_TCP"     [format "%u" [get_property CONFIG.NET_SOCK_CFG_SOCK_NBR_TCP  $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_SOCK_CFG_SOCK_NBR_UDP"     [format "%u" [get_property CONFIG.NET_SOCK_CFG_SOCK_NBR_UDP  $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_SOCK_CFG_SEL_EN"           [expr ([get_property CONFIG.NET_SOCK_CFG_SEL_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_SOCK_CFG_EVENT_SET_EN"     [expr ([get_property CONFIG.NET_SOCK_CFG_EVENT_SET_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_SOCK_CFG_ZERO_COPY_EN"     [expr ([get_property CONFIG.NET_SOCK_CFG_ZERO_COPY_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX"  [format "%u" [get_property CONFIG.NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX  $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_SOCK_CFG_RX_Q_SIZE_OCTET"  [format "%u" [get_property CONFIG.NET_SOCK_CFG_RX_Q_SIZE_OCTET  $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_SOCK_CFG_TX_Q_SIZE_OCTET"  [format "%u" [get_property CONFIG.NET_SOCK_CFG_TX_Q_SIZE_OCTET  $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_CONN_CFG_HASH_TBL_SIZE"    [format "%u" [get_property CONFIG.NET_CONN_CFG_HASH_TBL_SIZE    $ucos_handle]]
 
     set_define "./src/net_cfg.h" "NET_TCP_CFG_EN" [expr ([get_property CONFIG.NET_TCP_CFG_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_SACK_EN" [expr ([get_property CONFIG.NET_TCP_CFG_SACK_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_WIN_SCALE_EN" [expr ([get_property CONFIG.NET_TCP_CFG_WIN_SCALE_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_TS_EN" [expr ([get_property CONFIG.NET_TCP_CFG_TS_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_CONG_CTRL_CUBIC_EN" [expr ([get_property CONFIG.NET_TCP_CFG_CONG_CTRL_CUBIC_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_CONG_CTRL_DFLT" [expr ([get_property CONFIG.NET_TCP_CFG_CONG_CTRL_DFLT  $ucos_handle] == "cubic")?"NET_TCP_CONG_CTRL_ALGO_CUBIC":"NET_TCP_CONG_CTRL_ALGO_NEW_RENO"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_TX_COPY_UNLOCK_EN" [expr ([get_property CONFIG.NET_TCP_CFG_TX_COPY_UNLOCK_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
+    set_define "./src/net_cfg.h" "NET_TCP_CFG_TELEMETRY_EN" [expr ([get_property CONFIG.NET_TCP_CFG_TELEMETRY_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
 
     set_define "./src/net_cfg.h" "NET_UDP_CFG_RX_CHK_SUM_DISCARD_EN" [expr ([get_property CONFIG.NET_UDP_CFG_RX_CHK_SUM_DISCARD_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
     set_define "./src/net_cfg.h" "NET_UDP_CFG_TX_CHK_SUM_EN" [expr ([get_property CONFIG.NET_UDP_CFG_TX_CHK_SUM_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
 
     set_define "./src/net_cfg.h" "NET_TMR_CFG_NBR_TMR"    [format "%u" [get_property CONFIG.NET_TMR_CFG_NBR_TMR  $ucos_handle]]
     set_define "./src/net_cfg.h" "NET_TMR_CFG_TASK_FREQ"  [format "%u" [get_property CONFIG.NET_TMR_CFG_TASK_FREQ  $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_TMR_CFG_WHEEL_SIZE" [format "%u" [get_property CONFIG.NET_TMR_CFG_WHEEL_SIZE $ucos_handle]]
+    set_define "./src/net_cfg.h" "NET_TMR_CFG_HI_RES_EN"  [expr ([get_property CONFIG.NET_TMR_CFG_HI_RES_EN  $ucos_handle] == true)?"DEF_ENABLED":"DEF_DISABLED"]
 
     set dns_en [get_property CONFIG.NET_EXT_MODULE_CFG_DNS_EN $ucos_handle]
 